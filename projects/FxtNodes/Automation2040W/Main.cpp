@@ -29,6 +29,7 @@
 #include "Fxt/Card/Mock/TShell/Aout8.h"
 #include "Fxt/Card/Mock/TShell/Dio8.h"
 #include "Fxt/Node/TShell/Node.h"
+#include "Fxt/Node/TShell/Profile.h"
 #include "Fxt/Node/SBC/Automation2040W/Factory.h"
 #include "Fxt/Node/SBC/Automation2040W/Drivers.h"
 #include "Cpl/System/Shutdown.h"
@@ -66,6 +67,7 @@ static Cpl::TShell::Cmd::Trace                      traceCmd_( g_cmdlist );
 static Cpl::TShell::Cmd::TPrint                     tprintCmd_( g_cmdlist );
 
 static Fxt::Node::TShell::Node                      nodeCmd_( g_cmdlist, nodeFactory_, pointDb_ );
+static Fxt::Node::TShell::Profile                   profCmd_( g_cmdlist );
 static Fxt::Card::Mock::TShell::Ain8                ain8Cmd_( g_cmdlist );
 static Fxt::Card::Mock::TShell::Aout8               aout8Cmd_( g_cmdlist );
 static Fxt::Card::Mock::TShell::Dio8                dio8Cmd_( g_cmdlist );
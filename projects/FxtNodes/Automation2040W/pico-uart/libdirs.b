@@ -13,6 +13,9 @@ src/Cpl/System/RP2040/_console
 # BSP
 src/Bsp/RP2040/Automation2040W/gcc
 
+# Foxtail - Platform specific
+src/Fxt/System/_rp2040
+
 # OSAL - Platform specific
 src/Cpl/System/RP2040
 src/Cpl/System/RP2040/_fatalerror
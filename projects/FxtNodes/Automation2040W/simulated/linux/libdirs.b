@@ -5,6 +5,7 @@ src/Cpl/System/_trace/_stdout
 # Platforms
 src/Cpl/Io/Stdio/_posix
 src/Cpl/Text/_mappings/_posix
+src/Fxt/System/_posix < PerfCounter.cpp
 
 # OSAL Platform
 [cpp11]src/Cpl/System/Cpp11
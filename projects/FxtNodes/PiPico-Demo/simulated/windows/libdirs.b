@@ -4,6 +4,7 @@ src/Cpl/System/_trace/_stdout
 
 # Platforms
 src/Cpl/Io/Stdio/_win32
+src/Fxt/System/_cpp11
 
 # OSAL Platform
 [cpp11]src/Cpl/System/Cpp11
@@ -151,6 +151,15 @@ def resolveExecutionSet( exeset_obj ):
     for lc in logicChains_list:
         utils.print_verbose( f"    Resolving Logic Chain references: {lc['name']}" )
 
+        # Connector Points that are aliases of another point
+        if ( "connectionPts" in lc ):
+            for pt in lc["connectionPts"]:
+                if ( "aliasOf" in pt ):
+                    id_symbol = pt['aliasOf']
+                    if ( not id_symbol in _point_dict_by_name ):
+                        sys.exit( f"ERROR: Missing alias point reference: {id_symbol}" )
+                    pt['aliasOf'] = _point_dict_by_name[id_symbol]
+
         # Components
         if ( not "components" in lc ):
             sys.exit( "ERROR: Input file is missing 'components' array in LogicChain object" )
@@ -0,0 +1,171 @@
+#! /usr/bin/env python3
+"""
+
+Compiles a Node file (with numeric point IDs) into a binary Node Image
+================================================================================
+usage: nodeimage.py [options] <infile> [<outfile>]
+
+Arguments:
+    <infile>       Input file. Must be the output of name2id.py, i.e. numeric
+                   point IDs and type GUIDs.
+    <outfile>      Output file. Defaults to <infile>.img
+
+Options:
+    -s             Strip unused (by the firmware) KVPs
+    -v             Be verbose
+    -w             Disable warnings
+    -h, --help     Displays this information
+
+Notes:
+    1. See src/Fxt/Node/Image.h for the layout of the Node Image.
+    2. The individual Card, Logic Chain, and Shared Point objects are stored
+       as MessagePack blobs.
+
+"""
+
+import sys
+import os
+import struct
+
+from docopt.docopt import docopt
+import utils
+import name2id
+
+# Must match src/Fxt/Node/Image.h
+IMAGE_MAGIC          = 0x494E5846
+IMAGE_VERSION        = 1
+IMAGE_HEADER_SIZE    = 16
+IMAGE_GUID_SIZE      = 37
+RECORD_NODE          = b'N'
+RECORD_CHASSIS       = b'C'
+RECORD_SCANNER       = b'S'
+RECORD_CARD          = b'c'
+RECORD_EXESET        = b'E'
+RECORD_LOGIC_CHAIN   = b'L'
+RECORD_SHARED_PT     = b'P'
+
+#------------------------------------------------------------------------------
+# Minimal MessagePack encoder (only the JSON data types)
+def msgpack( obj ):
+    if ( obj is None ):
+        return b'\xc0'
+    if ( obj is True ):
+        return b'\xc3'
+    if ( obj is False ):
+        return b'\xc2'
+    if ( isinstance( obj, int ) ):
+        if ( 0 <= obj < 0x80 ):
+            return struct.pack( '<B', obj )
+        if ( -32 <= obj < 0 ):
+            return struct.pack( '<b', obj )
+        if ( obj >= 0 ):
+            for tag, fmt, limit in ((0xcc,'>B',1<<8), (0xcd,'>H',1<<16), (0xce,'>I',1<<32), (0xcf,'>Q',1<<64)):
+                if ( obj < limit ):
+                    return bytes([tag]) + struct.pack( fmt, obj )
+        else:
+            for tag, fmt, limit in ((0xd0,'>b',1<<7), (0xd1,'>h',1<<15), (0xd2,'>i',1<<31), (0xd3,'>q',1<<63)):
+                if ( obj >= -limit ):
+                    return bytes([tag]) + struct.pack( fmt, obj )
+        sys.exit( f"ERROR: Integer out of range: {obj}" )
+    if ( isinstance( obj, float ) ):
+        return b'\xcb' + struct.pack( '>d', obj )
+    if ( isinstance( obj, str ) ):
+        b = obj.encode( 'utf-8' )
+        n = len(b)
+        if ( n < 32 ):
+            return bytes([0xa0 | n]) + b
+        if ( n < (1<<8) ):
+            return b'\xd9' + struct.pack( '>B', n ) + b
+        if ( n < (1<<16) ):
+            return b'\xda' + struct.pack( '>H', n ) + b
+        return b'\xdb' + struct.pack( '>I', n ) + b
+    if ( isinstance( obj, list ) ):
+        n = len(obj)
+        hdr = bytes([0x90 | n]) if n < 16 else b'\xdc' + struct.pack( '>H', n ) if n < (1<<16) else b'\xdd' + struct.pack( '>I', n )
+        return hdr + b''.join( msgpack(e) for e in obj )
+    if ( isinstance( obj, dict ) ):
+        n = len(obj)
+        hdr = bytes([0x80 | n]) if n < 16 else b'\xde' + struct.pack( '>H', n ) if n < (1<<16) else b'\xdf' + struct.pack( '>I', n )
+        return hdr + b''.join( msgpack(k) + msgpack(v) for k,v in obj.items() )
+    sys.exit( f"ERROR: Unsupported JSON type: {obj}" )
+
+#------------------------------------------------------------------------------
+# CRC-32 (must match Cpl::Checksum::Crc32EthernetFast)
+def crc32( data ):
+    crc = 0xFFFFFFFF
+    for b in data:
+        crc ^= b << 24
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x04C11DB7) if (crc & 0x80000000) else (crc << 1)
+            crc &= 0xFFFFFFFF
+    return crc
+
+#------------------------------------------------------------------------------
+def element( tag, obj ):
+    blob = msgpack( obj )
+    return tag + struct.pack( '<I', len(blob) ) + blob
+
+def required( obj, key, context ):
+    if ( not key in obj ):
+        sys.exit( f"ERROR: Missing '{key}' for: {context}" )
+    return obj[key]
+
+def compile_node( json_dict ):
+    chassis_list = required( json_dict, 'chassis', 'node' )
+    guid         = required( json_dict, 'type', 'node' ).encode( 'utf-8' )
+    if ( len(guid) >= IMAGE_GUID_SIZE ):
+        sys.exit( f"ERROR: Invalid node type GUID: {guid}" )
+
+    payload = bytearray()
+    payload += RECORD_NODE + struct.pack( '<B', len(chassis_list) ) + guid.ljust( IMAGE_GUID_SIZE, b'\0' )
+    for ch in chassis_list:
+        scanners   = required( ch, 'scanners', 'chassis' )
+        exesets    = required( ch, 'executionSets', 'chassis' )
+        shared_pts = ch.get( 'sharedPts', [] )
+        payload   += RECORD_CHASSIS + struct.pack( '<QHHH', required( ch, 'fer', 'chassis' ), len(scanners), len(exesets), len(shared_pts) )
+        for s in scanners:
+            cards    = required( s, 'cards', 'scanner' )
+            payload += RECORD_SCANNER + struct.pack( '<IH', required( s, 'scanRateMultiplier', 'scanner' ), len(cards) )
+            for c in cards:
+                payload += element( RECORD_CARD, c )
+        for e in exesets:
+            chains   = required( e, 'logicChains', 'execution set' )
+            payload += RECORD_EXESET + struct.pack( '<IH', required( e, 'exeRateMultiplier', 'execution set' ), len(chains) )
+            for lc in chains:
+                payload += element( RECORD_LOGIC_CHAIN, lc )
+        for pt in shared_pts:
+            payload += element( RECORD_SHARED_PT, pt )
+        utils.print_verbose( f"Chassis: scanners={len(scanners)}, executionSets={len(exesets)}, sharedPts={len(shared_pts)}" )
+
+    header = struct.pack( '<IHHII', IMAGE_MAGIC, IMAGE_VERSION, IMAGE_HEADER_SIZE, len(payload), crc32(payload) )
+    return header + payload
+
+#------------------------------------------------------------------------------
+if __name__ == '__main__':
+
+    # Parse command line
+    args = docopt(__doc__, version='0.0.1' )
+
+    # Set quite & verbose modes
+    utils.set_quite_mode( args['-w'] )
+    utils.set_verbose_mode( args['-v'] )
+
+    # Load input file
+    json_dict = utils.load_node_file( args['<infile>'] )
+    if ( json_dict == None ):
+        sys.exit( f"ERROR: Can not open file: {args['<infile>']}, OR invalid JSON syntax" );
+
+    # Set output file name
+    root,ext  = os.path.splitext( args['<infile>'] )
+    outfile   = root + ".img"
+    if ( args['<outfile>'] != None ):
+        outfile = args['<outfile>']
+
+    # Compact the image by removing KVP not used by the firmware
+    if ( args['-s'] ):
+        name2id.strip_unused_kvp( json_dict )
+
+    image = compile_node( json_dict )
+    with open( outfile, "wb" ) as fd:
+        fd.write( image )
+    utils.print_verbose( f"Image: {outfile}, {len(image)} bytes" )
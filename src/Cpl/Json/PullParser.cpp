@@ -0,0 +1,348 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "PullParser.h"
+#include "Cpl/System/Api.h"
+
+using namespace Cpl::Json;
+
+static inline bool isWhiteSpace_( int c )
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static inline bool isDigit_( int c )
+{
+    return c >= '0' && c <= '9';
+}
+
+
+//////////////////////////////////
+PullParser::PullParser( Cpl::Io::Input& src ) noexcept
+    : m_src( src )
+    , m_bytesConsumed( 0 )
+    , m_bufLen( 0 )
+    , m_bufIdx( 0 )
+    , m_error( false )
+{
+}
+
+//////////////////////////////////
+int PullParser::nextChar( bool consume ) noexcept
+{
+    // Refill the read-ahead buffer
+    if ( m_bufIdx >= m_bufLen )
+    {
+        if ( m_error )
+        {
+            return -1;
+        }
+
+        // A zero byte read means 'no data yet' -->yield the CPU instead of spinning
+        int      bytesRead  = 0;
+        unsigned emptyReads = 0;
+        for ( ;;)
+        {
+            if ( !m_src.read( m_buf, sizeof( m_buf ), bytesRead ) )
+            {
+                return -1;
+            }
+            if ( bytesRead > 0 )
+            {
+                break;
+            }
+            if ( ++emptyReads >= OPTION_CPL_JSON_PULL_PARSER_MAX_EMPTY_READS )
+            {
+                return -1;
+            }
+            Cpl::System::Api::sleep( OPTION_CPL_JSON_PULL_PARSER_EMPTY_READ_SLEEP_MS );
+        }
+
+        m_bufLen = bytesRead;
+        m_bufIdx = 0;
+    }
+
+    int c = (uint8_t) m_buf[m_bufIdx];
+    if ( consume )
+    {
+        m_bufIdx++;
+        m_bytesConsumed++;
+    }
+    return c;
+}
+
+int PullParser::peekToken() noexcept
+{
+    int c = nextChar( false );
+    while ( isWhiteSpace_( c ) )
+    {
+        nextChar( true );
+        c = nextChar( false );
+    }
+    return c;
+}
+
+bool PullParser::expect( char c ) noexcept
+{
+    if ( m_error || peekToken() != (uint8_t) c )
+    {
+        return fail();
+    }
+    nextChar( true );
+    return true;
+}
+
+bool PullParser::scanString( char* dst, size_t maxLen, bool truncate ) noexcept
+{
+    size_t idx      = 0;
+    bool   overflow = false;
+    for ( ;;)
+    {
+        int c = nextChar( true );
+        if ( c < 0 )
+        {
+            return fail();
+        }
+        if ( c == '"' )
+        {
+            break;
+        }
+
+        // Copy escape sequences as is (but do not end on an escaped quote)
+        int count = 1;
+        if ( c == '\\' )
+        {
+            count = 2;
+        }
+        while ( count-- )
+        {
+            if ( dst )
+            {
+                if ( idx + 1 < maxLen )
+                {
+                    dst[idx++] = (char) c;
+                }
+                else
+                {
+                    overflow = true;
+                }
+            }
+            if ( count )
+            {
+                c = nextChar( true );
+                if ( c < 0 )
+                {
+                    return fail();
+                }
+            }
+        }
+    }
+
+    if ( dst && maxLen > 0 )
+    {
+        dst[idx] = '\0';
+    }
+    if ( overflow && !truncate )
+    {
+        return fail();
+    }
+    return true;
+}
+
+//////////////////////////////////
+bool PullParser::beginObject() noexcept
+{
+    return expect( '{' );
+}
+
+bool PullParser::nextKey( char* dstKey, size_t maxKeyLen ) noexcept
+{
+    if ( m_error )
+    {
+        return false;
+    }
+
+    int c = peekToken();
+    if ( c == '}' )
+    {
+        nextChar( true );
+        return false;
+    }
+    if ( c == ',' )
+    {
+        nextChar( true );
+        c = peekToken();
+    }
+    if ( c != '"' )
+    {
+        return fail();
+    }
+    nextChar( true );
+    return scanString( dstKey, maxKeyLen, true ) && expect( ':' );
+}
+
+bool PullParser::beginArray() noexcept
+{
+    return expect( '[' );
+}
+
+bool PullParser::nextElement() noexcept
+{
+    if ( m_error )
+    {
+        return false;
+    }
+
+    int c = peekToken();
+    if ( c == ']' )
+    {
+        nextChar( true );
+        return false;
+    }
+    if ( c == ',' )
+    {
+        nextChar( true );
+        c = peekToken();
+    }
+    if ( c < 0 )
+    {
+        return fail();
+    }
+    return true;
+}
+
+//////////////////////////////////
+bool PullParser::readString( char* dst, size_t maxLen ) noexcept
+{
+    return expect( '"' ) && scanString( dst, maxLen, false );
+}
+
+bool PullParser::readUnsigned( uint64_t& dst ) noexcept
+{
+    if ( m_error || !isDigit_( peekToken() ) )
+    {
+        return fail();
+    }
+
+    uint64_t value = 0;
+    int      c     = nextChar( false );
+    while ( isDigit_( c ) )
+    {
+        value = value * 10 + (c - '0');
+        nextChar( true );
+        c = nextChar( false );
+    }
+
+    // Reject fractions/exponents
+    if ( c == '.' || c == 'e' || c == 'E' )
+    {
+        return fail();
+    }
+
+    dst = value;
+    return true;
+}
+
+bool PullParser::skipValue() noexcept
+{
+    if ( m_error )
+    {
+        return false;
+    }
+
+    int c = peekToken();
+
+    // String
+    if ( c == '"' )
+    {
+        nextChar( true );
+        return scanString( nullptr, 0, true );
+    }
+
+    // Object/Array
+    if ( c == '{' || c == '[' )
+    {
+        unsigned depth = 0;
+        do
+        {
+            c = nextChar( true );
+            if ( c < 0 )
+            {
+                return fail();
+            }
+            if ( c == '"' )
+            {
+                if ( !scanString( nullptr, 0, true ) )
+                {
+                    return false;
+                }
+            }
+            else if ( c == '{' || c == '[' )
+            {
+                depth++;
+            }
+            else if ( c == '}' || c == ']' )
+            {
+                depth--;
+            }
+        } while ( depth > 0 );
+        return true;
+    }
+
+    // Scalar (number, true, false, null)
+    unsigned count = 0;
+    while ( c >= 0 && c != ',' && c != '}' && c != ']' && !isWhiteSpace_( c ) )
+    {
+        nextChar( true );
+        c = nextChar( false );
+        count++;
+    }
+    return count > 0 ? true : fail();
+}
+
+DeserializationError PullParser::readValue( JsonDocument& dstDoc ) noexcept
+{
+    int c = peekToken();
+    if ( m_error || (c != '{' && c != '[') )
+    {
+        fail();
+        return DeserializationError::InvalidInput;
+    }
+
+    DeserializationError err = deserializeJson( dstDoc, *this );
+    if ( err != DeserializationError::Ok )
+    {
+        fail();
+    }
+    return err;
+}
+
+//////////////////////////////////
+int PullParser::read() noexcept
+{
+    return nextChar( true );
+}
+
+size_t PullParser::readBytes( char* buffer, size_t length ) noexcept
+{
+    size_t count = 0;
+    while ( count < length )
+    {
+        int c = nextChar( true );
+        if ( c < 0 )
+        {
+            break;
+        }
+        buffer[count++] = (char) c;
+    }
+    return count;
+}
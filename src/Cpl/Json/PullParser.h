@@ -0,0 +1,207 @@
+#ifndef Cpl_Json_PullParser_h_
+#define Cpl_Json_PullParser_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/Io/Input.h"
+#include "Cpl/Json/Arduino.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/// Size, in bytes, of the parser's read-ahead buffer
+#ifndef OPTION_CPL_JSON_PULL_PARSER_BUFFER_SIZE
+#define OPTION_CPL_JSON_PULL_PARSER_BUFFER_SIZE     64
+#endif
+
+/** Time, in milliseconds, the parser sleeps when the input stream returns
+    zero bytes (i.e. no data available yet) before retrying the read
+ */
+#ifndef OPTION_CPL_JSON_PULL_PARSER_EMPTY_READ_SLEEP_MS
+#define OPTION_CPL_JSON_PULL_PARSER_EMPTY_READ_SLEEP_MS     1
+#endif
+
+/** Maximum number of consecutive zero byte reads before the parser treats
+    the input stream as having reached end-of-stream
+ */
+#ifndef OPTION_CPL_JSON_PULL_PARSER_MAX_EMPTY_READS
+#define OPTION_CPL_JSON_PULL_PARSER_MAX_EMPTY_READS         1000
+#endif
+
+///
+namespace Cpl {
+///
+namespace Json {
+
+/** This concrete class is a 'pull' parser for walking a JSON text that is
+    read from an input stream - WITHOUT reading the entire JSON text into
+    memory.  The parser only consumes the input as the Application navigates
+    the JSON structure (i.e. the memory usage is constant/independent of the
+    size of the JSON text).
+
+    The Application navigates the outer structure of the JSON text using the
+    beginObject()/nextKey() and beginArray()/nextElement() methods, and then
+    either reads the current value as a scalar (readString(), readUnsigned()),
+    skips it (skipValue()), or deserializes it - and ONLY it - into an
+    ArduinoJson document (readValue()).  The latter allows an arbitrarily
+    large JSON text to be processed one element at a time using a bounded,
+    'element sized', JsonDocument.
+
+    Usage:
+    \code
+
+        // JSON text: { "name": "bob", "items": [ {...}, {...}, ... ] }
+        PullParser parser( fd );
+        char       key[32];
+        parser.beginObject();
+        while ( parser.nextKey( key, sizeof( key ) ) )
+        {
+            if ( strcmp( key, "items" ) == 0 )
+            {
+                parser.beginArray();
+                while ( parser.nextElement() )
+                {
+                    parser.readValue( elementDoc );
+                    // Do something with elementDoc...
+                }
+            }
+            else
+            {
+                parser.skipValue();
+            }
+        }
+        if ( parser.isError() ) ...
+
+    \endcode
+
+    NOTES:
+        - The parser is NOT a validating parser, e.g. it does not detect
+          missing or extra commas between array elements or key/value pairs.
+        - Once an error has been detected, all subsequent operations fail,
+          i.e. the Application only needs to check isError() at the end of
+          its parsing.
+        - String escape sequences are copied verbatim (i.e. not decoded)
+          by nextKey() and readString().
+        - The parser reads the input stream in blocks of (up to)
+          OPTION_CPL_JSON_PULL_PARSER_BUFFER_SIZE bytes, i.e. it can consume
+          bytes from the stream that follow the end of the JSON text.
+        - A read that succeeds with zero bytes is treated as 'would block',
+          i.e. the parser sleeps OPTION_CPL_JSON_PULL_PARSER_EMPTY_READ_SLEEP_MS
+          and retries.  After OPTION_CPL_JSON_PULL_PARSER_MAX_EMPTY_READS
+          consecutive empty reads the stream is treated as end-of-stream.
+        - The class provides the 'Reader' semantics required by ArduinoJson,
+          i.e. the read() and readBytes() methods.  These methods are NOT
+          intended to be called directly by the Application.
+ */
+class PullParser
+{
+public:
+    /// Constructor
+    PullParser( Cpl::Io::Input& src ) noexcept;
+
+public:
+    /** Consumes the opening '{' of an object. Returns false if the next
+        token is not an object
+     */
+    bool beginObject() noexcept;
+
+    /** Returns true (and the key name) if the current object contains another
+        key/value pair.  After a true return, the Application MUST consume the
+        associated value.  Returns false when the closing '}' has been consumed
+        or an error occurred.  Key names longer than 'maxKeyLen'-1 are truncated.
+     */
+    bool nextKey( char* dstKey, size_t maxKeyLen ) noexcept;
+
+    /** Consumes the opening '[' of an array. Returns false if the next
+        token is not an array
+     */
+    bool beginArray() noexcept;
+
+    /** Returns true if the current array contains another element. After a
+        true return, the Application MUST consume the element.  Returns false
+        when the closing ']' has been consumed or an error occurred.
+     */
+    bool nextElement() noexcept;
+
+public:
+    /** Reads a string value.  Returns false if the next value is not a string
+        or the string does not fit in 'dst' (including the null terminator)
+     */
+    bool readString( char* dst, size_t maxLen ) noexcept;
+
+    /** Reads an unsigned integer value.  Returns false if the next value is
+        not an unsigned integer
+     */
+    bool readUnsigned( uint64_t& dst ) noexcept;
+
+    /// Consumes (and discards) the next value - of any type.
+    bool skipValue() noexcept;
+
+    /** Deserializes the next value (which MUST be an object or an array) into
+        'dstDoc'.  The input stream is NOT consumed beyond the end of the value.
+        Returns the ArduinoJson result code.
+     */
+    DeserializationError readValue( JsonDocument& dstDoc ) noexcept;
+
+public:
+    /// Returns true if an error (syntax, stream, etc.) has been encountered
+    bool isError() const noexcept { return m_error; }
+
+    /// Returns the total number of bytes consumed from the input stream
+    size_t getBytesConsumed() const noexcept { return m_bytesConsumed; }
+
+public:
+    /// ArduinoJson Reader semantics. Returns -1 on end-of-stream
+    int read() noexcept;
+
+    /// ArduinoJson Reader semantics.
+    size_t readBytes( char* buffer, size_t length ) noexcept;
+
+protected:
+    /// Helper method: returns the next character (returns -1 on end-of-stream). The character is only consumed when 'consume' is true
+    int nextChar( bool consume ) noexcept;
+
+    /// Helper method: returns the next non-whitespace character WITHOUT consuming it (returns -1 on end-of-stream)
+    int peekToken() noexcept;
+
+    /// Helper method: consumes the specified character (after skipping whitespace)
+    bool expect( char c ) noexcept;
+
+    /// Helper method: reads/copies/skips a quoted string (the leading quote has already been consumed)
+    bool scanString( char* dst, size_t maxLen, bool truncate ) noexcept;
+
+    /// Helper method: marks the parser as failed
+    bool fail() noexcept { m_error = true; return false; }
+
+protected:
+    /// Input stream
+    Cpl::Io::Input& m_src;
+
+    /// Bytes consumed
+    size_t          m_bytesConsumed;
+
+    /// Number of valid bytes in the read-ahead buffer
+    int             m_bufLen;
+
+    /// Index of the next unconsumed byte in the read-ahead buffer
+    int             m_bufIdx;
+
+    /// Error state
+    bool            m_error;
+
+    /// Read-ahead buffer
+    char            m_buf[OPTION_CPL_JSON_PULL_PARSER_BUFFER_SIZE];
+};
+
+};      // end namespaces
+};
+#endif  // end header latch
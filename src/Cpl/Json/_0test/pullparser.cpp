@@ -0,0 +1,214 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/Json/PullParser.h"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include <string.h>
+
+
+///
+using namespace Cpl::Json;
+
+namespace {
+
+/// Input stream that returns a string in small chunks
+class StringInput : public Cpl::Io::Input
+{
+public:
+    StringInput( const char* text, int chunkSize ) :m_text( text ), m_remaining( (int) strlen( text ) ), m_chunkSize( chunkSize ) {}
+
+    bool read( void* buffer, int numBytes, int& bytesRead )
+    {
+        if ( m_remaining == 0 )
+        {
+            return false;
+        }
+        bytesRead = numBytes < m_chunkSize ? numBytes : m_chunkSize;
+        bytesRead = bytesRead < m_remaining ? bytesRead : m_remaining;
+        memcpy( buffer, m_text, bytesRead );
+        m_text      += bytesRead;
+        m_remaining -= bytesRead;
+        return true;
+    }
+    bool available() { return m_remaining > 0; }
+    bool isEos() { return m_remaining == 0; }
+    void close() {}
+
+    const char* m_text;
+    int         m_remaining;
+    int         m_chunkSize;
+};
+
+/// Input stream that returns zero bytes for N calls before each real read
+class StallingInput : public StringInput
+{
+public:
+    StallingInput( const char* text, int chunkSize, int emptyReads ) :StringInput( text, chunkSize ), m_emptyReads( emptyReads ), m_count( 0 ), m_numReads( 0 ) {}
+
+    bool read( void* buffer, int numBytes, int& bytesRead )
+    {
+        m_numReads++;
+        if ( m_emptyReads < 0 || m_count < m_emptyReads )
+        {
+            m_count++;
+            bytesRead = 0;
+            return true;
+        }
+        m_count = 0;
+        return StringInput::read( buffer, numBytes, bytesRead );
+    }
+
+    int m_emptyReads;
+    int m_count;
+    int m_numReads;
+};
+
+};
+
+#define TEXT_   " { \"name\" : \"bob \\\"the\\\" builder\", \"id\": 1234, \"skip\": [1, {\"a\":\"]}\"}, [true]], " \
+                "\"items\": [ {\"x\":1}, {\"x\":2, \"y\":[3,4]}, {\"x\":3} ], \"f\": -1.5e3, \"last\": null }"
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "PullParser" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+
+    SECTION( "walk" )
+    {
+        for ( int chunk=1; chunk < 8; chunk++ )
+        {
+            StringInput              fd( TEXT_, chunk );
+            PullParser               uut( fd );
+            StaticJsonDocument<256>  doc;
+            char                     key[8];
+            char                     name[32];
+            uint64_t                 id       = 0;
+            unsigned                 numItems = 0;
+            uint64_t                 sumX     = 0;
+
+            REQUIRE( uut.beginObject() );
+            while ( uut.nextKey( key, sizeof( key ) ) )
+            {
+                if ( strcmp( key, "name" ) == 0 )
+                {
+                    REQUIRE( uut.readString( name, sizeof( name ) ) );
+                }
+                else if ( strcmp( key, "id" ) == 0 )
+                {
+                    REQUIRE( uut.readUnsigned( id ) );
+                }
+                else if ( strcmp( key, "items" ) == 0 )
+                {
+                    REQUIRE( uut.beginArray() );
+                    while ( uut.nextElement() )
+                    {
+                        REQUIRE( uut.readValue( doc ) == DeserializationError::Ok );
+                        sumX += doc["x"].as<unsigned>();
+                        numItems++;
+                    }
+                }
+                else
+                {
+                    REQUIRE( uut.skipValue() );
+                }
+            }
+
+            REQUIRE( uut.isError() == false );
+            REQUIRE( strcmp( name, "bob \\\"the\\\" builder" ) == 0 );
+            REQUIRE( id == 1234 );
+            REQUIRE( numItems == 3 );
+            REQUIRE( sumX == 6 );
+            REQUIRE( uut.getBytesConsumed() == strlen( TEXT_ ) );
+        }
+    }
+
+    SECTION( "empty-reads" )
+    {
+        char key[8];
+        {
+            StallingInput fd( "{\"a\": 12}", 4, 3 );
+            PullParser    uut( fd );
+            uint64_t      val;
+            REQUIRE( uut.beginObject() );
+            REQUIRE( uut.nextKey( key, sizeof( key ) ) );
+            REQUIRE( uut.readUnsigned( val ) );
+            REQUIRE( val == 12 );
+            REQUIRE( uut.nextKey( key, sizeof( key ) ) == false );
+            REQUIRE( uut.isError() == false );
+        }
+        {
+            // Never delivers data -->bounded number of reads, then treated as EOS
+            StallingInput fd( "{}", 4, -1 );
+            PullParser    uut( fd );
+            REQUIRE( uut.beginObject() == false );
+            REQUIRE( uut.isError() );
+            REQUIRE( fd.m_numReads == OPTION_CPL_JSON_PULL_PARSER_MAX_EMPTY_READS );
+        }
+    }
+
+    SECTION( "errors" )
+    {
+        char key[8];
+        {
+            StringInput fd( "[1,2]", 4 );
+            PullParser  uut( fd );
+            REQUIRE( uut.beginObject() == false );
+            REQUIRE( uut.isError() );
+            REQUIRE( uut.beginArray() == false );
+        }
+        {
+            StringInput fd( "{\"a\" 1}", 4 );
+            PullParser  uut( fd );
+            REQUIRE( uut.beginObject() );
+            REQUIRE( uut.nextKey( key, sizeof( key ) ) == false );
+            REQUIRE( uut.isError() );
+        }
+        {
+            StringInput fd( "{\"a\": \"toolongforme\"}", 4 );
+            PullParser  uut( fd );
+            char        val[4];
+            REQUIRE( uut.beginObject() );
+            REQUIRE( uut.nextKey( key, sizeof( key ) ) );
+            REQUIRE( uut.readString( val, sizeof( val ) ) == false );
+            REQUIRE( uut.isError() );
+        }
+        {
+            StringInput fd( "{\"a\": 1.5}", 4 );
+            PullParser  uut( fd );
+            uint64_t    val;
+            REQUIRE( uut.beginObject() );
+            REQUIRE( uut.nextKey( key, sizeof( key ) ) );
+            REQUIRE( uut.readUnsigned( val ) == false );
+            REQUIRE( uut.isError() );
+        }
+        {
+            StringInput             fd( "[ {\"a\": [1,2,3,4,5,6,7,8,9,10]} ]", 4 );
+            PullParser              uut( fd );
+            StaticJsonDocument<32>  doc;
+            REQUIRE( uut.beginArray() );
+            REQUIRE( uut.nextElement() );
+            REQUIRE( uut.readValue( doc ) == DeserializationError::NoMemory );
+            REQUIRE( uut.isError() );
+            REQUIRE( uut.nextElement() == false );
+        }
+        {
+            StringInput fd( "{\"a\": [1,2", 4 );
+            PullParser  uut( fd );
+            REQUIRE( uut.beginObject() );
+            REQUIRE( uut.nextKey( key, sizeof( key ) ) );
+            REQUIRE( uut.skipValue() == false );
+            REQUIRE( uut.isError() );
+        }
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -82,6 +82,14 @@ void setCategoryMask( uint32_t newMask ) noexcept;
  */
 uint32_t getCategoryEnabledMask() noexcept;
 
+/** This method returns the total number of log entries that have been dropped
+    because the log entry queue was full, i.e. the running total of the
+    'overflow count' across all queue-overflow episodes.
+
+    The method is thread safe
+ */
+uint32_t getOverflowCount() noexcept;
+
 
 /*---------------------------------------------------------------------------*/
 /** This method is used to create log entry. The method has printf() semantics.
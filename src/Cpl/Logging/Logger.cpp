@@ -19,6 +19,7 @@ using namespace Cpl::Logging;
 
 static bool                                       queueFull_;
 static unsigned                                   overflowCount_;
+static uint32_t                                   totalOverflowCount_;
 static Cpl::Container::RingBufferMP<EntryData_T>* logEntryFIFO_;
 static Cpl::System::Mutex                         lock_;
 static uint32_t                                   categoryMask_;
@@ -44,7 +45,8 @@ void Cpl::Logging::initialize( Cpl::Container::RingBufferMP<EntryData_T>& logEnt
     overflowCatText_ = categoryQueueOverflowText;
     overflowMsgId_   = messageIdForQueueOverflow;
     overflowMsgText_ = messageQueueOverflowText;
-    queueFull_ = false;
+    queueFull_          = false;
+    totalOverflowCount_ = 0;
     logEntryFIFO.clearTheBuffer();
 }
 
@@ -80,6 +82,12 @@ void Cpl::Logging::setCategoryMask( uint32_t newMask ) noexcept
     categoryMask_ = newMask;
 }
 
+uint32_t Cpl::Logging::getOverflowCount() noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( lock_ );
+    return totalOverflowCount_;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 inline static void startText( Cpl::Text::String& dst,
                               const char*        catIdText,
@@ -129,6 +137,7 @@ static bool isQueFull() noexcept
 
     // No space - count the number of 'dropped' log entries
     overflowCount_++;
+    totalOverflowCount_++;
     return true;
 }
 
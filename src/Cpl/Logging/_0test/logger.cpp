@@ -194,6 +194,7 @@ TEST_CASE( "logger" )
         bool     valid = mp_fifoCount.read( logCount );
         REQUIRE( valid );
         REQUIRE( logCount == MAX_FIFO_ENTRIES - 1 );
+        REQUIRE( getOverflowCount() == 4 );
 
         EntryData_T logEntry;
         bool result = logFifo_.remove( logEntry );
@@ -234,6 +235,7 @@ TEST_CASE( "logger" )
         REQUIRE( result );
         REQUIRE( logEntry.category == CategoryId::WARNING );
         REQUIRE( logEntry.msgId == WarningMsg::LOGGING_OVERFLOW );
+        REQUIRE( getOverflowCount() == 4 );
 
         result = logFifo_.remove( logEntry );
         REQUIRE( result );
@@ -52,6 +52,11 @@ void Cpl::Logging::setCategoryMask( uint32_t newMask ) noexcept
 {
 }
 
+uint32_t Cpl::Logging::getOverflowCount() noexcept
+{
+    return 0;
+}
+
 uint32_t g_logEntryCount = 0;
 
 
@@ -21,7 +21,7 @@ using namespace Cpl::Memory;
 #define BYTES_TO_WORDS(n)		(( (n) + ( sizeof( size_t ) - 1 ) ) / sizeof( size_t ))
 
 /////////////////////////////
-LeanHeap::LeanHeap( size_t* heapMemory, size_t sizeInBytes )
+LeanHeap::LeanHeap( size_t* heapMemory, size_t sizeInBytes, bool zeroFill )
     : m_ptrBase( heapMemory )
     , m_staringHeapSize( BYTES_TO_WORDS( sizeInBytes ) )
     , m_ptr( heapMemory )
@@ -30,7 +30,10 @@ LeanHeap::LeanHeap( size_t* heapMemory, size_t sizeInBytes )
     CPL_SYSTEM_ASSERT( m_wordsRemaining * 4 <= sizeInBytes );
 
     // Zero out all of memory
-    memset( m_ptr, 0, sizeInBytes );
+    if ( zeroFill )
+    {
+        memset( m_ptr, 0, sizeInBytes );
+    }
 }
 
 
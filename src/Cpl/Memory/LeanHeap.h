@@ -35,9 +35,12 @@ class LeanHeap: public ContiguousAllocator
 
 public:
     /** Constructor.  The memory size of 'heapMemory' MUST be a multiple
-        of sizeof(size_t).
+        of sizeof(size_t).  When 'zeroFill' is false, the caller guarantees
+        that 'heapMemory' is already zero filled (e.g. memory from calloc() or
+        a fresh anonymous memory mapping), i.e. the constructor does NOT
+        touch the memory.
      */
-    LeanHeap( size_t* heapMemory, size_t sizeInBytes );
+    LeanHeap( size_t* heapMemory, size_t sizeInBytes, bool zeroFill = true );
 
 
 public:
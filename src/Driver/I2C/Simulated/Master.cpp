@@ -0,0 +1,112 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Master.h"
+#include <string.h>
+
+///
+using namespace Driver::I2C::Simulated;
+
+
+//////////////////////////////////////////////////////////////////////////////
+Master::Master( size_t baudrate, size_t timeoutMs )
+    : m_baudrate( baudrate )
+    , m_timeoutMs( timeoutMs )
+    , m_numTransfers( 0 )
+    , m_numNoStops( 0 )
+    , m_started( false )
+{
+    memset( m_devices, 0, sizeof( m_devices ) );
+}
+
+bool Master::attach( uint8_t device7BitAddress, Device& device ) noexcept
+{
+    if ( device7BitAddress >= MAX_ADDRESSES || m_devices[device7BitAddress] != nullptr )
+    {
+        return false;
+    }
+    m_devices[device7BitAddress] = &device;
+    return true;
+}
+
+void Master::detach( uint8_t device7BitAddress ) noexcept
+{
+    if ( device7BitAddress < MAX_ADDRESSES )
+    {
+        m_devices[device7BitAddress] = nullptr;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool Master::start() noexcept
+{
+    m_started = true;
+    return true;
+}
+
+void Master::stop() noexcept
+{
+    m_started = false;
+}
+
+Driver::I2C::Master::Result_T Master::writeToDevice( uint8_t     device7BitAddress,
+                                                     size_t      numBytesToTransmit,
+                                                     const void* srcData,
+                                                     bool        noStop ) noexcept
+{
+    if ( !m_started )
+    {
+        return eNOT_STARTED;
+    }
+
+    Device* device = lookup( device7BitAddress, noStop );
+    return device ? device->write( (const uint8_t*) srcData, numBytesToTransmit ) : eNO_ACK;
+}
+
+Driver::I2C::Master::Result_T Master::readFromDevice( uint8_t device7BitAddress,
+                                                      size_t  numBytesToRead,
+                                                      void*   dstData,
+                                                      bool    noStop )
+{
+    if ( !m_started )
+    {
+        return eNOT_STARTED;
+    }
+
+    Device* device = lookup( device7BitAddress, noStop );
+    return device ? device->read( (uint8_t*) dstData, numBytesToRead ) : eNO_ACK;
+}
+
+size_t Master::setBaudRate( size_t newBaudRateHz ) noexcept
+{
+    size_t prev = m_baudrate;
+    m_baudrate  = newBaudRateHz;
+    return prev;
+}
+
+size_t Master::setTransactionTimeout( size_t maxTimeMs ) noexcept
+{
+    size_t prev = m_timeoutMs;
+    m_timeoutMs = maxTimeMs;
+    return prev;
+}
+
+Device* Master::lookup( uint8_t device7BitAddress, bool noStop ) noexcept
+{
+    m_numTransfers++;
+    if ( noStop )
+    {
+        m_numNoStops++;
+    }
+    return device7BitAddress < MAX_ADDRESSES ? m_devices[device7BitAddress] : nullptr;
+}
@@ -0,0 +1,132 @@
+#ifndef Driver_I2C_Simulated_Master_h_
+#define Driver_I2C_Simulated_Master_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Driver/I2C/Master.h"
+
+///
+namespace Driver {
+///
+namespace I2C {
+///
+namespace Simulated {
+
+
+/** This abstract class defines the interface for a simulated I2C slave
+    device that is attached to a simulated I2C bus.
+ */
+class Device
+{
+public:
+    /// The device received 'numBytes' of data.  Return eSUCCESS to ACK the transfer
+    virtual Master::Result_T write( const uint8_t* data, size_t numBytes ) noexcept = 0;
+
+    /// The device is requested to transmit 'numBytes' of data.  Return eSUCCESS to ACK the transfer
+    virtual Master::Result_T read( uint8_t* dstData, size_t numBytes ) noexcept = 0;
+
+public:
+    /// Virtual destructor
+    virtual ~Device() {}
+};
+
+
+/** This class implements the I2C Master interface as a simulated bus, i.e.
+    transfers are dispatched to the simulated Device instances that are
+    attached to the bus.  A transfer to an address that does not have an
+    attached device is NOT acknowledged.
+
+    The class is intended for unit testing the I2C device drivers on a
+    host platform.  The class is NOT thread safe.
+ */
+class Master : public Driver::I2C::Master
+{
+public:
+    /// Maximum number of 7 bit addresses
+    static constexpr unsigned MAX_ADDRESSES = 128;
+
+public:
+    /// Constructor
+    Master( size_t baudrate  = 100 * 1000,   // 100KHz
+            size_t timeoutMs = 1000 );       // 1 second
+
+public:
+    /** Attaches a simulated device at the specified address. Returns false if
+        the address is invalid or is already in use
+     */
+    bool attach( uint8_t device7BitAddress, Device& device ) noexcept;
+
+    /// Detaches the device at the specified address
+    void detach( uint8_t device7BitAddress ) noexcept;
+
+public:
+    /// Returns the number of transfers (reads plus writes) that have been executed
+    inline uint32_t getNumTransfers() const noexcept { return m_numTransfers; }
+
+    /// Returns the number of transfers that did not include a Stop
+    inline uint32_t getNumNoStopTransfers() const noexcept { return m_numNoStops; }
+
+public:
+    /// See Driver::I2C::Master
+    bool start() noexcept;
+
+    /// See Driver::I2C::Master
+    void stop() noexcept;
+
+    /// See Driver::I2C::Master
+    Result_T  writeToDevice( uint8_t     device7BitAddress,
+                             size_t      numBytesToTransmit,
+                             const void* srcData,
+                             bool        noStop = false ) noexcept;
+
+    /// See Driver::I2C::Master
+    Result_T readFromDevice( uint8_t   device7BitAddress,
+                             size_t    numBytesToRead,
+                             void*     dstData,
+                             bool      noStop = false );
+
+    /// See Driver::I2C::Master
+    size_t setBaudRate( size_t newBaudRateHz ) noexcept;
+
+    /// See Driver::I2C::Master
+    size_t setTransactionTimeout( size_t maxTimeMs ) noexcept;
+
+protected:
+    /// Helper method
+    Device* lookup( uint8_t device7BitAddress, bool noStop ) noexcept;
+
+protected:
+    /// Attached devices (indexed by address)
+    Device*     m_devices[MAX_ADDRESSES];
+
+    /// The current I2C baud rate
+    size_t      m_baudrate;
+
+    /// The current transaction timeout value
+    size_t      m_timeoutMs;
+
+    /// Number of transfers
+    uint32_t    m_numTransfers;
+
+    /// Number of transfers without a Stop
+    uint32_t    m_numNoStops;
+
+    /// Track my started state
+    bool        m_started;
+};
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,137 @@
+#ifndef Driver_I2C_Transaction_h_
+#define Driver_I2C_Transaction_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Driver/I2C/Master.h"
+#include "Cpl/Container/Item.h"
+
+///
+namespace Driver {
+///
+namespace I2C {
+
+/// Forward reference
+class Transaction;
+
+
+/** This abstract class defines the callback interface that is used to
+    notify the client when its queued I2C transaction has completed.
+ */
+class TransactionCallback
+{
+public:
+    /** This method is called (from the TransactionQueue's thread) when the
+        transaction has completed.  The result of the transaction is
+        available via transaction.getResult().
+
+        The transaction is no longer in the queue when this method is called,
+        i.e. the client is free to re-post (or modify) the transaction from
+        within the callback.
+     */
+    virtual void transactionCompleted( Transaction& transaction ) noexcept = 0;
+
+public:
+    /// Virtual destructor
+    virtual ~TransactionCallback() {}
+};
+
+
+/** This class defines a single I2C transaction that is queued for execution
+    by a TransactionQueue.  A transaction consists of an optional write
+    followed by an optional read to the same device.  When both a write and
+    a read are specified, the read begins with a Restart (i.e. no Stop is
+    issued between the write and the read).
+
+    The client owns the transaction instance AND its data buffers.  The
+    buffers must remain valid until the transaction has completed.  A
+    transaction can only be in one queue at a time.
+ */
+class Transaction : public Cpl::Container::Item
+{
+public:
+    /// Constructor
+    Transaction( TransactionCallback& callback )
+        : m_callback( callback )
+        , m_writeData( nullptr )
+        , m_readData( nullptr )
+        , m_numBytesToWrite( 0 )
+        , m_numBytesToRead( 0 )
+        , m_delayMs( 0 )
+        , m_timeMarker( 0 )
+        , m_result( Master::eSUCCESS )
+        , m_device7BitAddress( 0 )
+    {
+    }
+
+public:
+    /** This method configures the transaction.  'delayMs' is the minimum
+        amount of time, in milliseconds, from when the transaction is posted
+        until it is executed (e.g. the conversion time of a sensor).
+
+        The method must NOT be called while the transaction is queued.
+     */
+    inline void configure( uint8_t     device7BitAddress,
+                           size_t      numBytesToWrite,
+                           const void* srcData,
+                           size_t      numBytesToRead = 0,
+                           void*       dstData = nullptr,
+                           unsigned    delayMs = 0 ) noexcept
+    {
+        m_device7BitAddress = device7BitAddress;
+        m_numBytesToWrite   = numBytesToWrite;
+        m_writeData         = srcData;
+        m_numBytesToRead    = numBytesToRead;
+        m_readData          = dstData;
+        m_delayMs           = delayMs;
+    }
+
+    /// Returns the result of the last execution of the transaction
+    inline Master::Result_T getResult() const noexcept { return m_result; }
+
+    /// Returns the transaction's device address
+    inline uint8_t getDeviceAddress() const noexcept { return m_device7BitAddress; }
+
+public:
+    /// Completion callback
+    TransactionCallback&    m_callback;
+
+    /// Data to write
+    const void*             m_writeData;
+
+    /// Buffer for the read data
+    void*                   m_readData;
+
+    /// Number of bytes to write
+    size_t                  m_numBytesToWrite;
+
+    /// Number of bytes to read
+    size_t                  m_numBytesToRead;
+
+    /// Minimum delay, in milliseconds, from being posted to being executed
+    unsigned                m_delayMs;
+
+    /// Time (in milliseconds) that the transaction was posted
+    unsigned long           m_timeMarker;
+
+    /// Result of the transaction
+    Master::Result_T        m_result;
+
+    /// Device address
+    uint8_t                 m_device7BitAddress;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,160 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "TransactionQueue.h"
+#include "Cpl/System/ElapsedTime.h"
+#include "Cpl/System/Trace.h"
+
+#define SECT_ "Driver::I2C::TransactionQueue"
+
+///
+using namespace Driver::I2C;
+
+
+//////////////////////////////////////////////////////////////////////////////
+TransactionQueue::TransactionQueue( Master&                     i2cDriver,
+                                    Cpl::System::TimerManager&  timingSource,
+                                    unsigned long               pollIntervalMs )
+    : Cpl::System::Timer( timingSource )
+    , m_i2cDriver( i2cDriver )
+    , m_pollIntervalMs( pollIntervalMs )
+    , m_numTransactions( 0 )
+    , m_numErrors( 0 )
+    , m_numBatches( 0 )
+    , m_maxBatchSize( 0 )
+    , m_started( false )
+{
+}
+
+void TransactionQueue::start() noexcept
+{
+    if ( !m_started )
+    {
+        m_started = true;
+        Timer::start( m_pollIntervalMs );
+    }
+}
+
+void TransactionQueue::stop() noexcept
+{
+    if ( m_started )
+    {
+        m_started = false;
+        Timer::stop();
+
+        // Fail all pending transactions
+        Transaction* t = m_pending.get();
+        while ( t )
+        {
+            t->m_result = Master::eNOT_STARTED;
+            t->m_callback.transactionCompleted( *t );
+            t = m_pending.get();
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool TransactionQueue::post( Transaction& transaction ) noexcept
+{
+    if ( !m_started || m_pending.find( transaction ) )
+    {
+        return false;
+    }
+
+    transaction.m_timeMarker = Cpl::System::ElapsedTime::milliseconds();
+    m_pending.put( transaction );
+    return true;
+}
+
+bool TransactionQueue::cancel( Transaction& transaction ) noexcept
+{
+    return m_pending.remove( transaction );
+}
+
+bool TransactionQueue::isPending( const Transaction& transaction ) const noexcept
+{
+    return m_pending.find( transaction );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TransactionQueue::expired() noexcept
+{
+    // Execute all ready transactions back-to-back
+    Cpl::Container::SList<Transaction> completed;
+    uint32_t                           batchSize = 0;
+    unsigned long                      now       = Cpl::System::ElapsedTime::milliseconds();
+    Transaction*                       t         = m_pending.first();
+    while ( t )
+    {
+        Transaction* next = m_pending.next( *t );
+        if ( t->m_delayMs == 0 || Cpl::System::ElapsedTime::expiredMilliseconds( t->m_timeMarker, t->m_delayMs, now ) )
+        {
+            m_pending.remove( *t );
+            t->m_result = execute( *t );
+            completed.put( *t );
+            batchSize++;
+        }
+        t = next;
+    }
+
+    // Update metrics
+    if ( batchSize > 0 )
+    {
+        m_numBatches++;
+        if ( batchSize > m_maxBatchSize )
+        {
+            m_maxBatchSize = batchSize;
+        }
+    }
+
+    // Notify the clients (in execution order). Note: Transactions posted by the callbacks are executed on the next interval
+    t = completed.get();
+    while ( t )
+    {
+        t->m_callback.transactionCompleted( *t );
+        t = completed.get();
+    }
+
+    // Note: a callback could have stopped the queue
+    if ( m_started )
+    {
+        Timer::start( m_pollIntervalMs );
+    }
+}
+
+Master::Result_T TransactionQueue::execute( Transaction& transaction ) noexcept
+{
+    m_numTransactions++;
+
+    Master::Result_T result = Master::eSUCCESS;
+    if ( transaction.m_numBytesToWrite > 0 )
+    {
+        result = m_i2cDriver.writeToDevice( transaction.m_device7BitAddress,
+                                            transaction.m_numBytesToWrite,
+                                            transaction.m_writeData,
+                                            transaction.m_numBytesToRead > 0 );
+    }
+    if ( result == Master::eSUCCESS && transaction.m_numBytesToRead > 0 )
+    {
+        result = m_i2cDriver.readFromDevice( transaction.m_device7BitAddress,
+                                             transaction.m_numBytesToRead,
+                                             transaction.m_readData );
+    }
+
+    if ( result != Master::eSUCCESS )
+    {
+        m_numErrors++;
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Transaction failed (i2c addr=%02X). result=%d", transaction.m_device7BitAddress, result) );
+    }
+    return result;
+}
@@ -0,0 +1,134 @@
+#ifndef Driver_I2C_TransactionQueue_h_
+#define Driver_I2C_TransactionQueue_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "colony_config.h"
+#include "Driver/I2C/Transaction.h"
+#include "Cpl/Container/SList.h"
+#include "Cpl/System/Timer.h"
+
+
+/// Interval, in milliseconds, at which the queue services the bus
+#ifndef OPTION_DRIVER_I2C_TRANSACTION_QUEUE_POLL_MS
+#define OPTION_DRIVER_I2C_TRANSACTION_QUEUE_POLL_MS         2
+#endif
+
+///
+namespace Driver {
+///
+namespace I2C {
+
+
+/** This class implements a non-blocking transaction scheduler for a single
+    I2C bus.  Clients (e.g. the drivers for multiple sensors that share the
+    bus) post transactions to the queue and are notified via a callback when
+    their transaction completes.  The queue periodically services the bus and
+    executes ALL transactions that are ready as a single batch, i.e. the
+    clients do not have to run their own timers or busy-wait on the bus.
+
+    Transactions are executed in the order they were posted, except that a
+    transaction with a delay is skipped (but retains its position) until its
+    delay has expired.  This allows a client to 'wait' on a device (e.g. a
+    sensor conversion) without blocking the bus for the other clients.
+
+    The Application is RESPONSIBLE for starting/stopping the I2C Master
+    driver since it is a shared resource.
+
+    The class is NOT thread safe.  The queue's timer executes in the thread
+    of the TimerManager that is provided in the constructor, and ALL clients
+    of the queue (i.e. calls to post()/cancel() and the transaction callbacks)
+    are required to execute in this same thread.
+ */
+class TransactionQueue : public Cpl::System::Timer
+{
+public:
+    /// Constructor
+    TransactionQueue( Master&                     i2cDriver,
+                      Cpl::System::TimerManager&  timingSource,
+                      unsigned long               pollIntervalMs = OPTION_DRIVER_I2C_TRANSACTION_QUEUE_POLL_MS );
+
+public:
+    /// Starts servicing the bus
+    void start() noexcept;
+
+    /** Stops servicing the bus.  All pending transactions are completed with
+        a result of Master::eNOT_STARTED.
+     */
+    void stop() noexcept;
+
+public:
+    /** This method queues the transaction for execution.  The method returns
+        false if the queue is not started OR the transaction is already queued.
+     */
+    bool post( Transaction& transaction ) noexcept;
+
+    /** This method removes a queued transaction.  The transaction's callback
+        is NOT called.  The method returns false if the transaction was not
+        queued.
+     */
+    bool cancel( Transaction& transaction ) noexcept;
+
+    /// Returns true if the transaction is queued
+    bool isPending( const Transaction& transaction ) const noexcept;
+
+public:
+    /// Returns the number of transactions that have been executed
+    inline uint32_t getNumTransactions() const noexcept { return m_numTransactions; }
+
+    /// Returns the number of transactions that failed
+    inline uint32_t getNumErrors() const noexcept { return m_numErrors; }
+
+    /// Returns the number of batches (i.e. timer ticks that executed at least one transaction)
+    inline uint32_t getNumBatches() const noexcept { return m_numBatches; }
+
+    /// Returns the largest number of transactions executed in a single batch
+    inline uint32_t getMaxBatchSize() const noexcept { return m_maxBatchSize; }
+
+protected:
+    /// Timer expired callback
+    void expired() noexcept;
+
+    /// Helper method that executes a single transaction
+    Master::Result_T execute( Transaction& transaction ) noexcept;
+
+protected:
+    /// I2C bus
+    Master&                                 m_i2cDriver;
+
+    /// Pending transactions
+    Cpl::Container::SList<Transaction>      m_pending;
+
+    /// Service interval
+    unsigned long                           m_pollIntervalMs;
+
+    /// Number of executed transactions
+    uint32_t                                m_numTransactions;
+
+    /// Number of failed transactions
+    uint32_t                                m_numErrors;
+
+    /// Number of batches
+    uint32_t                                m_numBatches;
+
+    /// Largest batch
+    uint32_t                                m_maxBatchSize;
+
+    /// My started state
+    bool                                    m_started;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,382 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Driver/I2C/TransactionQueue.h"
+#include "Driver/I2C/Simulated/Master.h"
+#include "Driver/RHTemp/HUT31D/AsyncApi.h"
+#include "Driver/RHTemp/HUT31D/Commands.h"
+#include "Cpl/System/TimerManager.h"
+#include "Cpl/System/ElapsedTime.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/Trace.h"
+#include "Cpl/Math/real.h"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include <string.h>
+
+#define SECT_               "_0test"
+
+#define MAX_WAIT_MS         2000
+#define NUM_SENSORS         12
+#define FIRST_SENSOR_ADDR   0x40
+
+///
+using namespace Driver::I2C;
+
+namespace {
+
+/// Simple device: a write stores the data, a read returns the last write
+class EchoDevice : public Simulated::Device
+{
+public:
+    EchoDevice() :m_len( 0 ) {}
+
+    Master::Result_T write( const uint8_t* data, size_t numBytes ) noexcept
+    {
+        m_len = numBytes > sizeof( m_data ) ? sizeof( m_data ) : numBytes;
+        memcpy( m_data, data, m_len );
+        return Master::eSUCCESS;
+    }
+
+    Master::Result_T read( uint8_t* dstData, size_t numBytes ) noexcept
+    {
+        if ( numBytes > m_len )
+        {
+            return Master::eERROR;
+        }
+        memcpy( dstData, m_data, numBytes );
+        return Master::eSUCCESS;
+    }
+
+    uint8_t m_data[8];
+    size_t  m_len;
+};
+
+/// Simulated HUT31D sensor
+class Hut31dDevice : public Simulated::Device
+{
+public:
+    Hut31dDevice( uint16_t rawRh=0x8000, uint16_t rawTemp=0x8000 )
+        : m_rawRh( rawRh ), m_rawTemp( rawTemp ), m_lastCmd( 0xFF ), m_numResets( 0 ), m_numConversions( 0 ), m_heaterOn( false ), m_converted( false )
+    {
+    }
+
+    Master::Result_T write( const uint8_t* data, size_t numBytes ) noexcept
+    {
+        m_lastCmd = data[0];
+        if ( m_lastCmd == Driver::RHTemp::HUT31D::CMD_RESET )
+        {
+            m_numResets++;
+            m_converted = false;
+        }
+        else if ( m_lastCmd == Driver::RHTemp::HUT31D::CMD_CONVERSION )
+        {
+            m_numConversions++;
+            m_converted = true;
+        }
+        else if ( m_lastCmd == Driver::RHTemp::HUT31D::CMD_HEATER_ON || m_lastCmd == Driver::RHTemp::HUT31D::CMD_HEATER_OFF )
+        {
+            m_heaterOn = m_lastCmd == Driver::RHTemp::HUT31D::CMD_HEATER_ON;
+        }
+        return Master::eSUCCESS;
+    }
+
+    Master::Result_T read( uint8_t* dstData, size_t numBytes ) noexcept
+    {
+        if ( m_lastCmd == Driver::RHTemp::HUT31D::CMD_READ_DIAGNOSTIC && numBytes == 2 )
+        {
+            dstData[0] = m_heaterOn ? 1 : 0;
+            dstData[1] = Driver::RHTemp::HUT31D::crc( dstData[0] );
+            return Master::eSUCCESS;
+        }
+        if ( m_lastCmd == Driver::RHTemp::HUT31D::CMD_READ_RH_TEMP && numBytes == 6 && m_converted )
+        {
+            dstData[0] = (uint8_t) (m_rawTemp >> 8);
+            dstData[1] = (uint8_t) m_rawTemp;
+            dstData[2] = Driver::RHTemp::HUT31D::crc( m_rawTemp );
+            dstData[3] = (uint8_t) (m_rawRh >> 8);
+            dstData[4] = (uint8_t) m_rawRh;
+            dstData[5] = Driver::RHTemp::HUT31D::crc( m_rawRh );
+            return Master::eSUCCESS;
+        }
+        return Master::eERROR;
+    }
+
+    uint16_t m_rawRh;
+    uint16_t m_rawTemp;
+    uint8_t  m_lastCmd;
+    unsigned m_numResets;
+    unsigned m_numConversions;
+    bool     m_heaterOn;
+    bool     m_converted;
+};
+
+/// Records the completion order
+class Recorder : public TransactionCallback
+{
+public:
+    Recorder() :m_count( 0 ) {}
+
+    void transactionCompleted( Transaction& transaction ) noexcept
+    {
+        if ( m_count < 10 )
+        {
+            m_order[m_count] = &transaction;
+            m_times[m_count] = Cpl::System::ElapsedTime::milliseconds();
+        }
+        m_count++;
+    }
+
+    Transaction*  m_order[10];
+    unsigned long m_times[10];
+    unsigned      m_count;
+};
+
+} // end anonymous namespace
+
+
+/// Runs the timers (in the current thread) until 'count' reaches 'target'
+static void pump( Cpl::System::TimerManager& timers, const unsigned& count, unsigned target )
+{
+    unsigned long start = Cpl::System::ElapsedTime::milliseconds();
+    while ( count < target && !Cpl::System::ElapsedTime::expiredMilliseconds( start, MAX_WAIT_MS ) )
+    {
+        timers.processTimers();
+        Cpl::System::Api::sleep( 1 );
+    }
+}
+
+static void pumpFor( Cpl::System::TimerManager& timers, unsigned long durationMs )
+{
+    unsigned long start = Cpl::System::ElapsedTime::milliseconds();
+    while ( !Cpl::System::ElapsedTime::expiredMilliseconds( start, durationMs ) )
+    {
+        timers.processTimers();
+        Cpl::System::Api::sleep( 1 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "TransactionQueue" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::System::TimerManager timers;
+    timers.startManager();
+    timers.processTimers();     // Establishes the manager's time base
+
+    Simulated::Master bus;
+    EchoDevice        dev1;
+    EchoDevice        dev2;
+    REQUIRE( bus.attach( 0x10, dev1 ) );
+    REQUIRE( bus.attach( 0x11, dev2 ) );
+    REQUIRE( bus.attach( 0x11, dev1 ) == false );
+    REQUIRE( bus.start() );
+
+    TransactionQueue uut( bus, timers, 1 );
+    Recorder         recorder;
+    Transaction      t1( recorder );
+    Transaction      t2( recorder );
+    Transaction      t3( recorder );
+    uint8_t          tx1[2] ={ 1, 2 };
+    uint8_t          tx2[1] ={ 3 };
+    uint8_t          rx2[1] ={ 0 };
+
+    // Not started
+    t1.configure( 0x10, sizeof( tx1 ), tx1 );
+    REQUIRE( uut.post( t1 ) == false );
+    uut.start();
+
+    SECTION( "batch" )
+    {
+        t2.configure( 0x11, sizeof( tx2 ), tx2, sizeof( rx2 ), rx2 );
+        t3.configure( 0x22, sizeof( tx2 ), tx2 );   // No device
+        REQUIRE( uut.post( t1 ) );
+        REQUIRE( uut.post( t2 ) );
+        REQUIRE( uut.post( t3 ) );
+        REQUIRE( uut.post( t1 ) == false );   // Already queued
+        REQUIRE( uut.isPending( t2 ) );
+        REQUIRE( recorder.m_count == 0 );     // Non-blocking
+
+        pump( timers, recorder.m_count, 3 );
+        REQUIRE( recorder.m_count == 3 );
+        REQUIRE( recorder.m_order[0] == &t1 );
+        REQUIRE( recorder.m_order[1] == &t2 );
+        REQUIRE( recorder.m_order[2] == &t3 );
+        REQUIRE( t1.getResult() == Master::eSUCCESS );
+        REQUIRE( t2.getResult() == Master::eSUCCESS );
+        REQUIRE( t3.getResult() == Master::eNO_ACK );
+        REQUIRE( dev1.m_len == 2 );
+        REQUIRE( rx2[0] == 3 );
+        REQUIRE( bus.getNumNoStopTransfers() == 1 );  // The write-then-read uses a Restart
+        REQUIRE( uut.getNumTransactions() == 3 );
+        REQUIRE( uut.getNumErrors() == 1 );
+        REQUIRE( uut.getNumBatches() == 1 );
+        REQUIRE( uut.getMaxBatchSize() == 3 );
+        REQUIRE( uut.isPending( t2 ) == false );
+    }
+
+    SECTION( "delay" )
+    {
+        t2.configure( 0x11, sizeof( tx2 ), tx2, 0, nullptr, 30 );
+        t3.configure( 0x10, sizeof( tx2 ), tx2 );
+        unsigned long start = Cpl::System::ElapsedTime::milliseconds();
+        REQUIRE( uut.post( t2 ) );
+        REQUIRE( uut.post( t3 ) );
+
+        // The delayed transaction does NOT block the other transactions
+        pump( timers, recorder.m_count, 1 );
+        REQUIRE( recorder.m_count == 1 );
+        REQUIRE( recorder.m_order[0] == &t3 );
+        REQUIRE( uut.isPending( t2 ) );
+
+        pump( timers, recorder.m_count, 2 );
+        REQUIRE( recorder.m_count == 2 );
+        REQUIRE( recorder.m_order[1] == &t2 );
+        REQUIRE( Cpl::System::ElapsedTime::deltaMilliseconds( start, recorder.m_times[1] ) >= 30 );
+    }
+
+    SECTION( "cancel/stop" )
+    {
+        t2.configure( 0x11, sizeof( tx2 ), tx2, 0, nullptr, 1000 );
+        REQUIRE( uut.post( t1 ) );
+        REQUIRE( uut.post( t2 ) );
+        REQUIRE( uut.cancel( t1 ) );
+        REQUIRE( uut.cancel( t1 ) == false );
+        pumpFor( timers, 10 );
+        REQUIRE( recorder.m_count == 0 );
+
+        uut.stop();
+        REQUIRE( recorder.m_count == 1 );
+        REQUIRE( recorder.m_order[0] == &t2 );
+        REQUIRE( t2.getResult() == Master::eNOT_STARTED );
+        REQUIRE( uut.post( t1 ) == false );
+    }
+
+    uut.stop();
+    bus.stop();
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "HUT31D AsyncApi" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::System::TimerManager timers;
+    timers.startManager();
+    timers.processTimers();     // Establishes the manager's time base
+
+    Simulated::Master bus;
+    TransactionQueue  queue( bus, timers, 1 );
+    REQUIRE( bus.start() );
+    queue.start();
+
+    // A dozen sensors on one bus
+    Hut31dDevice*                     devices[NUM_SENSORS];
+    Driver::RHTemp::HUT31D::AsyncApi* sensors[NUM_SENSORS];
+    for ( unsigned i=0; i < NUM_SENSORS; i++ )
+    {
+        devices[i] = new Hut31dDevice( 0x8000, 0x8000 + i );
+        sensors[i] = new Driver::RHTemp::HUT31D::AsyncApi( queue, FIRST_SENSOR_ADDR + i );
+        REQUIRE( bus.attach( FIRST_SENSOR_ADDR + i, *devices[i] ) );
+        REQUIRE( sensors[i]->start() );
+        REQUIRE( sensors[i]->start() == false );
+        REQUIRE( sensors[i]->getSamplingState() == Driver::RHTemp::Api::eNOT_STARTED );
+    }
+
+    SECTION( "sampling" )
+    {
+        // Start all of the sensors sampling (none of the calls block)
+        for ( unsigned i=0; i < NUM_SENSORS; i++ )
+        {
+            REQUIRE( sensors[i]->startSample() == Driver::RHTemp::Api::eSAMPLING );
+            REQUIRE( sensors[i]->startSample() == Driver::RHTemp::Api::eERROR );
+        }
+        REQUIRE( sensors[0]->setHeaterState( true ) );
+
+        // Wait for all of the samples
+        unsigned numReady = 0;
+        unsigned long start = Cpl::System::ElapsedTime::milliseconds();
+        while ( numReady < NUM_SENSORS && !Cpl::System::ElapsedTime::expiredMilliseconds( start, MAX_WAIT_MS ) )
+        {
+            timers.processTimers();
+            Cpl::System::Api::sleep( 1 );
+            numReady = 0;
+            for ( unsigned i=0; i < NUM_SENSORS; i++ )
+            {
+                numReady += sensors[i]->getSamplingState() == Driver::RHTemp::Api::eSAMPLE_READY ? 1 : 0;
+            }
+        }
+        unsigned long elapsed = Cpl::System::ElapsedTime::deltaMilliseconds( start );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("%u sensors sampled in %lu ms. batches=%lu, maxBatch=%lu", NUM_SENSORS, elapsed, (unsigned long) queue.getNumBatches(), (unsigned long) queue.getMaxBatchSize()) );
+        REQUIRE( numReady == NUM_SENSORS );
+        REQUIRE( queue.getNumErrors() == 0 );
+        REQUIRE( queue.getMaxBatchSize() >= NUM_SENSORS );   // The sensors' transactions are batched
+        REQUIRE( devices[0]->m_heaterOn );
+
+        for ( unsigned i=0; i < NUM_SENSORS; i++ )
+        {
+            float rh, temp;
+            REQUIRE( sensors[i]->getSample( rh, temp ) == Driver::RHTemp::Api::eSAMPLE_READY );
+            REQUIRE( Cpl::Math::areFloatsEqual( rh, Driver::RHTemp::HUT31D::convertRH( 0x8000 ) ) );
+            REQUIRE( Cpl::Math::areFloatsEqual( temp, Driver::RHTemp::HUT31D::convertTemp( 0x8000 + i ) ) );
+            REQUIRE( devices[i]->m_numResets == 1 );
+            REQUIRE( devices[i]->m_numConversions == 1 );
+        }
+
+        // Next sample (no reset sequence)
+        REQUIRE( sensors[1]->startSample() == Driver::RHTemp::Api::eSAMPLING );
+        start = Cpl::System::ElapsedTime::milliseconds();
+        while ( sensors[1]->getSamplingState() == Driver::RHTemp::Api::eSAMPLING && !Cpl::System::ElapsedTime::expiredMilliseconds( start, MAX_WAIT_MS ) )
+        {
+            timers.processTimers();
+            Cpl::System::Api::sleep( 1 );
+        }
+        REQUIRE( sensors[1]->getSamplingState() == Driver::RHTemp::Api::eSAMPLE_READY );
+        REQUIRE( devices[1]->m_numResets == 1 );
+        REQUIRE( devices[1]->m_numConversions == 2 );
+        float rh, temp;
+        REQUIRE( sensors[1]->sample( rh, temp ) == false );  // Blocking sampling is not supported
+    }
+
+    SECTION( "missing device" )
+    {
+        Driver::RHTemp::HUT31D::AsyncApi missing( queue, 0x70 );
+        REQUIRE( missing.start() );
+        REQUIRE( missing.startSample() == Driver::RHTemp::Api::eSAMPLING );
+        pumpFor( timers, 30 );
+        REQUIRE( missing.getSamplingState() == Driver::RHTemp::Api::eERROR );
+
+        // Device 'appears' -->the reset sequence is retried
+        Hut31dDevice device;
+        REQUIRE( bus.attach( 0x70, device ) );
+        REQUIRE( missing.startSample() == Driver::RHTemp::Api::eSAMPLING );
+        unsigned long start = Cpl::System::ElapsedTime::milliseconds();
+        while ( missing.getSamplingState() == Driver::RHTemp::Api::eSAMPLING && !Cpl::System::ElapsedTime::expiredMilliseconds( start, MAX_WAIT_MS ) )
+        {
+            timers.processTimers();
+            Cpl::System::Api::sleep( 1 );
+        }
+        REQUIRE( missing.getSamplingState() == Driver::RHTemp::Api::eSAMPLE_READY );
+        REQUIRE( device.m_numResets == 1 );
+        missing.stop();
+        REQUIRE( missing.startSample() == Driver::RHTemp::Api::eERROR );
+    }
+
+    for ( unsigned i=0; i < NUM_SENSORS; i++ )
+    {
+        sensors[i]->stop();
+        delete sensors[i];
+        delete devices[i];
+    }
+    queue.stop();
+    bus.stop();
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
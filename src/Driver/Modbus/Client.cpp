@@ -0,0 +1,219 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Client.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/ElapsedTime.h"
+#include "Cpl/System/Trace.h"
+
+#define SECT_   "Driver::Modbus"
+
+///
+using namespace Driver::Modbus;
+
+
+/////////////////////////////////////
+Client::Client( uint8_t maxInFlight, uint32_t timeoutMs ) noexcept
+    : m_timeoutMs( timeoutMs )
+    , m_numWrites( 0 )
+    , m_nextTransactionId( 1 )
+    , m_numInFlight( 0 )
+    , m_maxInFlight( maxInFlight == 0 ? 1 : maxInFlight > OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT ? OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT : maxInFlight )
+    , m_lastExceptionCode( 0 )
+{
+}
+
+/////////////////////////////////////
+bool Client::execute( Cpl::Io::InputOutput& stream,
+                      const Planner&        plan,
+                      uint16_t*             registers,
+                      uint8_t*              requestResults ) noexcept
+{
+    uint16_t numRequests = plan.getNumRequests();
+    uint16_t nextRequest = 0;
+    uint16_t numDone     = 0;
+    m_numInFlight        = 0;
+    for ( unsigned i=0; i < m_maxInFlight; i++ )
+    {
+        m_inFlight[i].inUse = false;
+    }
+    for ( uint16_t i=0; i < numRequests; i++ )
+    {
+        requestResults[i] = eTIMEOUT;
+    }
+
+    while ( numDone < numRequests )
+    {
+        // Fill the in-flight window and send the requests as a single batch
+        size_t txLen = 0;
+        for ( unsigned slot=0; slot < m_maxInFlight && nextRequest < numRequests; slot++ )
+        {
+            if ( m_inFlight[slot].inUse )
+            {
+                continue;
+            }
+
+            const Planner::Range_T& req = plan.getRequest( nextRequest );
+            uint16_t                tid = m_nextTransactionId++;
+            if ( Protocol::isReadFunction( req.functionCode ) )
+            {
+                txLen += Protocol::encodeReadRequest( m_txBuf + txLen, tid, req.unitId, req.functionCode, req.address, req.count );
+            }
+            else if ( req.count == 1 )
+            {
+                txLen += Protocol::encodeWriteSingleRequest( m_txBuf + txLen, tid, req.unitId, req.address, registers[req.bufferOffset] );
+            }
+            else
+            {
+                txLen += Protocol::encodeWriteRequest( m_txBuf + txLen, tid, req.unitId, req.address, req.count, registers + req.bufferOffset );
+            }
+            m_inFlight[slot].transactionId = tid;
+            m_inFlight[slot].requestIdx    = nextRequest++;
+            m_inFlight[slot].inUse         = true;
+            m_numInFlight++;
+        }
+        if ( txLen > 0 )
+        {
+            m_numWrites++;
+            if ( !stream.write( m_txBuf, (int) txLen ) )
+            {
+                CPL_SYSTEM_TRACE_MSG( SECT_, ("Client: write failed") );
+                for ( unsigned slot=0; slot < m_maxInFlight; slot++ )
+                {
+                    if ( m_inFlight[slot].inUse )
+                    {
+                        requestResults[m_inFlight[slot].requestIdx] = eIO_ERROR;
+                    }
+                }
+                return false;
+            }
+        }
+
+        // Wait for (at least) one response
+        unsigned long      timeMarker = Cpl::System::ElapsedTime::milliseconds();
+        bool               timedOut   = false;
+        Protocol::Header_T hdr;
+        if ( !readResponseBytes( stream, m_rxBuf, Protocol::MBAP_SIZE, timeMarker, timedOut ) ||
+             !Protocol::decodeHeader( m_rxBuf, hdr ) ||
+             !readResponseBytes( stream, m_rxBuf + Protocol::MBAP_SIZE, hdr.length - 1, timeMarker, timedOut ) ||
+             !processResponse( plan, registers, requestResults, hdr, m_rxBuf + Protocol::MBAP_SIZE, hdr.length - 1 ) )
+        {
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("Client: %s (done=%u of %u)", timedOut ? "timeout" : "bad response", numDone, numRequests) );
+            for ( unsigned slot=0; slot < m_maxInFlight; slot++ )
+            {
+                if ( m_inFlight[slot].inUse && !timedOut )
+                {
+                    requestResults[m_inFlight[slot].requestIdx] = eIO_ERROR;
+                }
+            }
+            return false;
+        }
+        numDone++;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////
+bool Client::readResponseBytes( Cpl::Io::InputOutput& stream, uint8_t* dst, size_t numBytes, unsigned long& timeMarker, bool& timedOut ) noexcept
+{
+    while ( numBytes > 0 )
+    {
+        // Poll the stream so that a non-responsive device does not block the driver thread
+        if ( !stream.available() )
+        {
+            if ( Cpl::System::ElapsedTime::expiredMilliseconds( timeMarker, m_timeoutMs ) )
+            {
+                timedOut = true;
+                return false;
+            }
+            Cpl::System::Api::sleep( OPTION_DRIVER_MODBUS_POLL_MS );
+            continue;
+        }
+
+        int bytesRead = 0;
+        if ( !stream.read( dst, (int) numBytes, bytesRead ) )
+        {
+            return false;
+        }
+        dst        += bytesRead;
+        numBytes   -= bytesRead;
+        timeMarker  = Cpl::System::ElapsedTime::milliseconds();
+    }
+    return true;
+}
+
+bool Client::processResponse( const Planner& plan, uint16_t* registers, uint8_t* requestResults, const Protocol::Header_T& hdr, const uint8_t* pdu, size_t pduLen ) noexcept
+{
+    // Match the response to its request
+    unsigned slot;
+    for ( slot=0; slot < m_maxInFlight; slot++ )
+    {
+        if ( m_inFlight[slot].inUse && m_inFlight[slot].transactionId == hdr.transactionId )
+        {
+            break;
+        }
+    }
+    if ( slot >= m_maxInFlight )
+    {
+        return false;
+    }
+    const Planner::Range_T& req = plan.getRequest( m_inFlight[slot].requestIdx );
+    if ( hdr.unitId != req.unitId )
+    {
+        return false;
+    }
+    uint8_t fc = req.functionCode;
+    if ( !Protocol::isReadFunction( fc ) && req.count == 1 )
+    {
+        fc = Protocol::FC_WRITE_SINGLE;
+    }
+
+    // Exception response
+    uint8_t result = eSUCCESS;
+    if ( pdu[0] == (fc | Protocol::EXCEPTION_BIT) )
+    {
+        if ( pduLen != 2 )
+        {
+            return false;
+        }
+        m_lastExceptionCode = pdu[1];
+        result              = eEXCEPTION;
+    }
+
+    // Read response
+    else if ( Protocol::isReadFunction( req.functionCode ) )
+    {
+        if ( pdu[0] != fc || pduLen != 2 + ((size_t) req.count) * 2 || pdu[1] != req.count * 2 )
+        {
+            return false;
+        }
+        uint16_t* dst = registers + req.bufferOffset;
+        for ( uint16_t i=0; i < req.count; i++ )
+        {
+            dst[i] = Protocol::get16( pdu + 2 + i * 2 );
+        }
+    }
+
+    // Write response
+    else
+    {
+        if ( pdu[0] != fc || pduLen != 5 || Protocol::get16( pdu + 1 ) != req.address )
+        {
+            return false;
+        }
+    }
+
+    requestResults[m_inFlight[slot].requestIdx] = result;
+    m_inFlight[slot].inUse                      = false;
+    m_numInFlight--;
+    return true;
+}
@@ -0,0 +1,150 @@
+#ifndef Driver_Modbus_Client_h_
+#define Driver_Modbus_Client_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "colony_config.h"
+#include "Driver/Modbus/Planner.h"
+#include "Driver/Modbus/Protocol.h"
+#include "Cpl/Io/InputOutput.h"
+
+
+/** Maximum number of requests that can be outstanding (per connection) at
+    the same time
+ */
+#ifndef OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT
+#define OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT      8
+#endif
+
+/// Default response timeout in milliseconds
+#ifndef OPTION_DRIVER_MODBUS_TIMEOUT_MS
+#define OPTION_DRIVER_MODBUS_TIMEOUT_MS         100
+#endif
+
+/// Interval, in milliseconds, between polls of the stream while waiting for a response
+#ifndef OPTION_DRIVER_MODBUS_POLL_MS
+#define OPTION_DRIVER_MODBUS_POLL_MS            1
+#endif
+
+
+///
+namespace Driver {
+///
+namespace Modbus {
+
+
+/** This class implements the client (aka master) side of the Modbus/TCP
+    protocol.  The client executes the requests of a Planner, i.e. it
+    reads/writes all of the planned register ranges in a single call.
+
+    The requests are pipelined: up to 'maxInFlight' requests are outstanding
+    on the connection at the same time.  The requests that fit in the
+    in-flight window are encoded into a single buffer and written to the
+    stream with a single write operation.  The Planner orders the requests
+    by unit ID, i.e. the requests for a unit ID are always batched together.
+    Responses are matched to requests by transaction ID and can arrive in
+    any order.
+
+    The class is NOT thread safe.
+ */
+class Client
+{
+public:
+    /// Per request result
+    enum Result_T
+    {
+        eSUCCESS = 0,   //!< The request completed successfully
+        eEXCEPTION,     //!< The remote device returned an exception response
+        eTIMEOUT,       //!< No response was received
+        eIO_ERROR,      //!< The stream failed or a malformed response was received
+    };
+
+public:
+    /// Constructor. 'maxInFlight' is clamped to [1, OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT]
+    Client( uint8_t  maxInFlight = OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT,
+            uint32_t timeoutMs   = OPTION_DRIVER_MODBUS_TIMEOUT_MS ) noexcept;
+
+public:
+    /** This method executes all of the requests in 'plan'.  'registers' is
+        the plan's register buffer (see Planner::getBufferSize()), i.e. the
+        source of the values for write requests, and the destination of
+        the values for read requests.  The result of each request is
+        returned via 'requestResults' (one entry per request, see Result_T).
+
+        Returns true if all requests received a response (note: exception
+        responses are still 'responses').  Returns false on a timeout or an
+        IO/protocol error, in which case the state of the connection is
+        unknown and the caller should close it.
+     */
+    bool execute( Cpl::Io::InputOutput& stream,
+                  const Planner&        plan,
+                  uint16_t*             registers,
+                  uint8_t*              requestResults ) noexcept;
+
+public:
+    /// Returns the exception code of the most recent exception response
+    inline uint8_t getLastExceptionCode() const noexcept { return m_lastExceptionCode; }
+
+    /// Returns the number of write operations made to the stream (across all execute() calls)
+    inline uint32_t getNumStreamWrites() const noexcept { return m_numWrites; }
+
+    /// Returns the configured maximum number of in-flight requests
+    inline uint8_t getMaxInFlight() const noexcept { return m_maxInFlight; }
+
+protected:
+    /// Helper method: reads exactly 'numBytes'. Returns false on timeout/error
+    bool readResponseBytes( Cpl::Io::InputOutput& stream, uint8_t* dst, size_t numBytes, unsigned long& timeMarker, bool& timedOut ) noexcept;
+
+    /// Helper method: validates and consumes a response. Returns false if the response is malformed
+    bool processResponse( const Planner& plan, uint16_t* registers, uint8_t* requestResults, const Protocol::Header_T& hdr, const uint8_t* pdu, size_t pduLen ) noexcept;
+
+protected:
+    /// In-flight request
+    struct InFlight_T
+    {
+        uint16_t    transactionId;  //!< Transaction ID of the request
+        uint16_t    requestIdx;     //!< Index of the plan's request
+        bool        inUse;          //!< True if the slot is in use
+    };
+
+    /// In-flight requests
+    InFlight_T      m_inFlight[OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT];
+
+    /// Response timeout
+    uint32_t        m_timeoutMs;
+
+    /// Number of stream writes
+    uint32_t        m_numWrites;
+
+    /// Next transaction ID
+    uint16_t        m_nextTransactionId;
+
+    /// Number of in-flight requests
+    uint8_t         m_numInFlight;
+
+    /// Maximum number of in-flight requests
+    uint8_t         m_maxInFlight;
+
+    /// Last exception code
+    uint8_t         m_lastExceptionCode;
+
+    /// Transmit buffer
+    uint8_t         m_txBuf[OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT * Protocol::MAX_ADU_SIZE];
+
+    /// Receive buffer
+    uint8_t         m_rxBuf[Protocol::MAX_ADU_SIZE];
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
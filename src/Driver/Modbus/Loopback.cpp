@@ -0,0 +1,275 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Loopback.h"
+#include <string.h>
+
+///
+using namespace Driver::Modbus;
+
+#define ANY_UNIT_ID     0xFF
+
+
+/////////////////////////////////////
+Loopback::Loopback()
+    : m_remote( *this )
+    , m_numServers( 0 )
+    , m_numWrites( 0 )
+    , m_numConnects( 0 )
+    , m_connected( false )
+    , m_allowed( true )
+    , m_unresponsive( false )
+    , m_reverse( false )
+{
+    m_toRemote.len = 0;
+    m_toLocal.len  = 0;
+}
+
+bool Loopback::attach( Server& server ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    if ( m_numServers >= OPTION_DRIVER_MODBUS_LOOPBACK_MAX_SERVERS )
+    {
+        return false;
+    }
+    m_servers[m_numServers++] = &server;
+    return true;
+}
+
+void Loopback::setUnresponsive( bool enabled ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    m_unresponsive = enabled;
+}
+
+void Loopback::setReverseResponses( bool enabled ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    m_reverse = enabled;
+}
+
+void Loopback::setConnectionAllowed( bool allowed ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    m_allowed = allowed;
+    if ( !allowed )
+    {
+        m_connected = false;
+    }
+}
+
+bool Loopback::isConnected() noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    return m_connected;
+}
+
+uint32_t Loopback::getNumWrites() noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    return m_numWrites;
+}
+
+uint32_t Loopback::getNumConnects() noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    return m_numConnects;
+}
+
+/////////////////////////////////////
+Cpl::Io::InputOutput* Loopback::connect() noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    if ( !m_allowed )
+    {
+        return nullptr;
+    }
+    if ( !m_connected )
+    {
+        // A new connection discards any stale data
+        m_connected    = true;
+        m_numWrites    = 0;
+        m_toRemote.len = 0;
+        m_toLocal.len  = 0;
+        m_numConnects++;
+        for ( unsigned i=0; i < m_numServers; i++ )
+        {
+            m_servers[i]->reset();
+        }
+    }
+    return this;
+}
+
+void Loopback::disconnect() noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    m_connected = false;
+}
+
+/////////////////////////////////////
+bool Loopback::read( void* buffer, int numBytes, int& bytesRead )
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    return m_connected && pop( m_toLocal, buffer, numBytes, bytesRead );
+}
+
+bool Loopback::available()
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    return m_connected && m_toLocal.len > 0;
+}
+
+bool Loopback::write( const void* buffer, int maxBytes, int& bytesWritten )
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    bytesWritten = 0;
+    if ( !m_connected || !push( m_toRemote, buffer, maxBytes ) )
+    {
+        return false;
+    }
+    m_numWrites++;
+    bytesWritten = maxBytes;
+    processRequests();
+    return true;
+}
+
+bool Loopback::isEos()
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    return !m_connected;
+}
+
+void Loopback::close()
+{
+    disconnect();
+}
+
+/////////////////////////////////////
+bool Loopback::Remote::read( void* buffer, int numBytes, int& bytesRead )
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_loopback.m_lock );
+    return m_loopback.m_connected && pop( m_loopback.m_toRemote, buffer, numBytes, bytesRead );
+}
+
+bool Loopback::Remote::available()
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_loopback.m_lock );
+    return m_loopback.m_connected && m_loopback.m_toRemote.len > 0;
+}
+
+bool Loopback::Remote::write( const void* buffer, int maxBytes, int& bytesWritten )
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_loopback.m_lock );
+    bytesWritten = 0;
+    if ( !m_loopback.m_connected || !push( m_loopback.m_toLocal, buffer, maxBytes ) )
+    {
+        return false;
+    }
+    bytesWritten = maxBytes;
+    return true;
+}
+
+bool Loopback::Remote::isEos()
+{
+    return m_loopback.isEos();
+}
+
+void Loopback::Remote::close()
+{
+    m_loopback.disconnect();
+}
+
+/////////////////////////////////////
+bool Loopback::pop( Queue_T& src, void* buffer, int numBytes, int& bytesRead ) noexcept
+{
+    size_t len = src.len < (size_t) numBytes ? src.len : (size_t) numBytes;
+    memcpy( buffer, src.buf, len );
+    memmove( src.buf, src.buf + len, src.len - len );
+    src.len   -= len;
+    bytesRead  = (int) len;
+    return true;
+}
+
+bool Loopback::push( Queue_T& dst, const void* buffer, int numBytes ) noexcept
+{
+    if ( numBytes < 0 || dst.len + numBytes > sizeof( dst.buf ) )
+    {
+        return false;
+    }
+    memcpy( dst.buf + dst.len, buffer, numBytes );
+    dst.len += numBytes;
+    return true;
+}
+
+void Loopback::processRequests() noexcept
+{
+    if ( m_numServers == 0 )
+    {
+        return;
+    }
+
+    size_t batchStart = m_toLocal.len;
+    size_t offset     = 0;
+    while ( m_toRemote.len - offset >= Protocol::MBAP_SIZE )
+    {
+        Protocol::Header_T hdr;
+        if ( !Protocol::decodeHeader( m_toRemote.buf + offset, hdr ) )
+        {
+            // Framing error -->drop the connection
+            m_connected = false;
+            return;
+        }
+        size_t frameLen = Protocol::MBAP_SIZE - 1 + hdr.length;
+        if ( m_toRemote.len - offset < frameLen )
+        {
+            break;
+        }
+
+        // Route the request
+        size_t rspLen = 0;
+        if ( !m_unresponsive )
+        {
+            Server* server = nullptr;
+            for ( unsigned i=0; i < m_numServers && server == nullptr; i++ )
+            {
+                if ( m_servers[i]->getUnitId() == hdr.unitId || m_servers[i]->getUnitId() == ANY_UNIT_ID )
+                {
+                    server = m_servers[i];
+                }
+            }
+            if ( server )
+            {
+                rspLen = server->processRequest( m_toRemote.buf + offset, frameLen, m_rspBuf );
+            }
+            else
+            {
+                Protocol::encodeHeader( m_rspBuf, hdr.transactionId, hdr.unitId, 2 );
+                m_rspBuf[Protocol::MBAP_SIZE]     = m_toRemote.buf[offset + Protocol::MBAP_SIZE] | Protocol::EXCEPTION_BIT;
+                m_rspBuf[Protocol::MBAP_SIZE + 1] = Protocol::EX_GATEWAY_TARGET;
+                rspLen                            = Protocol::MBAP_SIZE + 2;
+            }
+        }
+        offset += frameLen;
+
+        // Queue the response
+        if ( rspLen > 0 && m_toLocal.len + rspLen <= sizeof( m_toLocal.buf ) )
+        {
+            size_t insertAt = m_reverse ? batchStart : m_toLocal.len;
+            memmove( m_toLocal.buf + insertAt + rspLen, m_toLocal.buf + insertAt, m_toLocal.len - insertAt );
+            memcpy( m_toLocal.buf + insertAt, m_rspBuf, rspLen );
+            m_toLocal.len += rspLen;
+        }
+    }
+
+    // Remove the processed requests
+    memmove( m_toRemote.buf, m_toRemote.buf + offset, m_toRemote.len - offset );
+    m_toRemote.len -= offset;
+}
@@ -0,0 +1,224 @@
+#ifndef Driver_Modbus_Loopback_h_
+#define Driver_Modbus_Loopback_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "colony_config.h"
+#include "Driver/Modbus/TransportApi.h"
+#include "Driver/Modbus/Server.h"
+#include "Cpl/System/Mutex.h"
+
+
+/// Maximum number of Servers that can be attached to a Loopback instance
+#ifndef OPTION_DRIVER_MODBUS_LOOPBACK_MAX_SERVERS
+#define OPTION_DRIVER_MODBUS_LOOPBACK_MAX_SERVERS   8
+#endif
+
+/// Size, in bytes, of each of the Loopback's data queues
+#ifndef OPTION_DRIVER_MODBUS_LOOPBACK_QUEUE_SIZE
+#define OPTION_DRIVER_MODBUS_LOOPBACK_QUEUE_SIZE    (16*Driver::Modbus::Protocol::MAX_ADU_SIZE)
+#endif
+
+
+///
+namespace Driver {
+///
+namespace Modbus {
+
+
+/** This concrete class is an in-process stand-in for a Modbus/TCP connection.
+    It is intended for unit testing.  The class implements the 'local' end of
+    the connection (i.e. the TransportApi and its stream), and provides the
+    'remote' end of the connection via getRemote().
+
+    When Server instances are attached to the loopback, the requests written
+    to the local end are processed synchronously by the attached Server with
+    the matching unit ID (requests for unknown unit IDs are answered with a
+    gateway exception).  When no Servers are attached, the loopback is a
+    simple bi-directional pipe between the local and remote ends.
+
+    The class is thread safe.  The attached Servers are only accessed while
+    the loopback's mutex is locked, i.e. a test thread must use getLock()
+    when accessing the registers of an attached Server.
+ */
+class Loopback : public TransportApi, public Cpl::Io::InputOutput
+{
+public:
+    /// The remote end of the connection
+    class Remote : public Cpl::Io::InputOutput
+    {
+    public:
+        /// Constructor
+        Remote( Loopback& loopback ) : m_loopback( loopback ) {}
+
+    public:
+        /// Pull in overloaded methods from base class
+        using Cpl::Io::InputOutput::read;
+
+        /// See Cpl::Io::Input
+        bool read( void* buffer, int numBytes, int& bytesRead );
+
+        /// See Cpl::Io::Input
+        bool available();
+
+        /// Pull in overloaded methods from base class
+        using Cpl::Io::InputOutput::write;
+
+        /// See Cpl::Io::Output
+        bool write( const void* buffer, int maxBytes, int& bytesWritten );
+
+        /// See Cpl::Io::Output
+        void flush() {}
+
+        /// See Cpl::Io::IsEos
+        bool isEos();
+
+        /// See Cpl::Io::Close
+        void close();
+
+    protected:
+        /// The loopback
+        Loopback& m_loopback;
+    };
+
+public:
+    /// Constructor
+    Loopback();
+
+public:
+    /// Attaches a Server to the loopback.  Returns false if there are too many attached Servers
+    bool attach( Server& server ) noexcept;
+
+    /** When 'enabled' is true, the attached Servers do NOT respond to
+        requests (i.e. simulates a non-responsive device)
+     */
+    void setUnresponsive( bool enabled ) noexcept;
+
+    /** When 'enabled' is true, the responses to the requests contained in a
+        single write operation are returned in reverse order
+     */
+    void setReverseResponses( bool enabled ) noexcept;
+
+    /** When 'allowed' is false, connect() fails (and the current connection,
+        if any, is closed).
+     */
+    void setConnectionAllowed( bool allowed ) noexcept;
+
+    /// Returns true if there is an open connection
+    bool isConnected() noexcept;
+
+    /// Returns the number of write operations to the local end since the last connect()
+    uint32_t getNumWrites() noexcept;
+
+    /// Returns the number of connections that have been established
+    uint32_t getNumConnects() noexcept;
+
+    /// Returns the remote end of the connection
+    inline Cpl::Io::InputOutput& getRemote() noexcept { return m_remote; }
+
+    /// Returns the mutex that protects the attached Servers
+    inline Cpl::System::Mutex& getLock() noexcept { return m_lock; }
+
+public:
+    /// See Driver::Modbus::TransportApi
+    Cpl::Io::InputOutput* connect() noexcept;
+
+    /// See Driver::Modbus::TransportApi
+    void disconnect() noexcept;
+
+public:
+    /// Pull in overloaded methods from base class
+    using Cpl::Io::InputOutput::read;
+
+    /// See Cpl::Io::Input
+    bool read( void* buffer, int numBytes, int& bytesRead );
+
+    /// See Cpl::Io::Input
+    bool available();
+
+    /// Pull in overloaded methods from base class
+    using Cpl::Io::InputOutput::write;
+
+    /// See Cpl::Io::Output
+    bool write( const void* buffer, int maxBytes, int& bytesWritten );
+
+    /// See Cpl::Io::Output
+    void flush() {}
+
+    /// See Cpl::Io::IsEos
+    bool isEos();
+
+    /// See Cpl::Io::Close
+    void close();
+
+protected:
+    /// Byte queue
+    struct Queue_T
+    {
+        size_t  len;                                            //!< Number of bytes in the queue
+        uint8_t buf[OPTION_DRIVER_MODBUS_LOOPBACK_QUEUE_SIZE];  //!< Queue storage
+    };
+
+    /// Helper method (mutex must be locked)
+    static bool pop( Queue_T& src, void* buffer, int numBytes, int& bytesRead ) noexcept;
+
+    /// Helper method (mutex must be locked)
+    static bool push( Queue_T& dst, const void* buffer, int numBytes ) noexcept;
+
+    /// Helper method: processes the complete requests in the 'toRemote' queue (mutex must be locked)
+    void processRequests() noexcept;
+
+protected:
+    /// Mutex
+    Cpl::System::Mutex  m_lock;
+
+    /// Remote end
+    Remote              m_remote;
+
+    /// Attached servers
+    Server*             m_servers[OPTION_DRIVER_MODBUS_LOOPBACK_MAX_SERVERS];
+
+    /// Number of attached servers
+    unsigned            m_numServers;
+
+    /// Number of local writes
+    uint32_t            m_numWrites;
+
+    /// Number of connections
+    uint32_t            m_numConnects;
+
+    /// Connection state
+    bool                m_connected;
+
+    /// Connection allowed
+    bool                m_allowed;
+
+    /// Unresponsive
+    bool                m_unresponsive;
+
+    /// Reverse the responses
+    bool                m_reverse;
+
+    /// Local -> Remote data
+    Queue_T             m_toRemote;
+
+    /// Remote -> Local data
+    Queue_T             m_toLocal;
+
+    /// Scratch response buffer
+    uint8_t             m_rspBuf[Protocol::MAX_ADU_SIZE];
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,152 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Planner.h"
+#include "Protocol.h"
+
+///
+using namespace Driver::Modbus;
+
+
+/////////////////////////////////////
+Planner::Planner( Cpl::Memory::ContiguousAllocator& allocator, uint16_t maxItems ) noexcept
+    : m_items( nullptr )
+    , m_requests( nullptr )
+    , m_order( nullptr )
+    , m_itemRequest( nullptr )
+    , m_itemOffset( nullptr )
+    , m_maxItems( maxItems )
+    , m_numItems( 0 )
+    , m_numRequests( 0 )
+    , m_bufferSize( 0 )
+{
+    if ( maxItems > 0 )
+    {
+        Range_T*  items    = (Range_T*) allocator.allocate( sizeof( Range_T ) * maxItems );
+        Range_T*  requests = (Range_T*) allocator.allocate( sizeof( Range_T ) * maxItems );
+        uint16_t* indexes  = (uint16_t*) allocator.allocate( sizeof( uint16_t ) * maxItems * 3 );
+        if ( items && requests && indexes )
+        {
+            m_items       = items;
+            m_requests    = requests;
+            m_order       = indexes;
+            m_itemRequest = indexes + maxItems;
+            m_itemOffset  = indexes + maxItems * 2;
+        }
+    }
+}
+
+void Planner::clear() noexcept
+{
+    m_numItems    = 0;
+    m_numRequests = 0;
+    m_bufferSize  = 0;
+}
+
+bool Planner::add( uint8_t unitId, uint8_t functionCode, uint16_t address, uint16_t count ) noexcept
+{
+    if ( m_items == nullptr || m_numItems >= m_maxItems || count == 0 || count > Protocol::getMaxRegisters( functionCode ) )
+    {
+        return false;
+    }
+
+    // Write requests are always planned as 'multiple' writes (the Client uses a single write when possible)
+    if ( functionCode == Protocol::FC_WRITE_SINGLE )
+    {
+        functionCode = Protocol::FC_WRITE_MULTIPLE;
+    }
+
+    Range_T& item     = m_items[m_numItems++];
+    item.unitId       = unitId;
+    item.functionCode = functionCode;
+    item.address      = address;
+    item.count        = count;
+    item.bufferOffset = 0;
+    return true;
+}
+
+bool Planner::isBefore( const Range_T& a, const Range_T& b ) noexcept
+{
+    if ( a.unitId != b.unitId )
+    {
+        return a.unitId < b.unitId;
+    }
+    if ( a.functionCode != b.functionCode )
+    {
+        return a.functionCode < b.functionCode;
+    }
+    return a.address < b.address;
+}
+
+void Planner::build( uint16_t maxGap ) noexcept
+{
+    m_numRequests = 0;
+    m_bufferSize  = 0;
+    if ( m_numItems == 0 )
+    {
+        return;
+    }
+
+    // Sort the items (insertion sort: the number of items is small and typically already ordered)
+    for ( uint16_t i=0; i < m_numItems; i++ )
+    {
+        uint16_t idx = i;
+        uint16_t j   = i;
+        while ( j > 0 && isBefore( m_items[idx], m_items[m_order[j - 1]] ) )
+        {
+            m_order[j] = m_order[j - 1];
+            j--;
+        }
+        m_order[j] = idx;
+    }
+
+    // Coalesce the items into requests
+    Range_T* cur = nullptr;
+    for ( uint16_t i=0; i < m_numItems; i++ )
+    {
+        uint16_t       itemIdx = m_order[i];
+        const Range_T& item    = m_items[itemIdx];
+        uint32_t       itemEnd = (uint32_t) item.address + item.count;
+        if ( cur )
+        {
+            uint32_t curEnd = (uint32_t) cur->address + cur->count;
+            uint16_t gap    = Protocol::isReadFunction( item.functionCode ) ? maxGap : 0;
+            uint32_t newEnd = itemEnd > curEnd ? itemEnd : curEnd;
+            if ( cur->unitId == item.unitId &&
+                 cur->functionCode == item.functionCode &&
+                 item.address <= curEnd + gap &&
+                 newEnd - cur->address <= Protocol::getMaxRegisters( item.functionCode ) )
+            {
+                cur->count                = (uint16_t) (newEnd - cur->address);
+                m_itemRequest[itemIdx]    = (uint16_t) (m_numRequests - 1);
+                m_itemOffset[itemIdx]     = (uint16_t) (item.address - cur->address);
+                continue;
+            }
+        }
+
+        // Start a new request
+        cur                    = &m_requests[m_numRequests++];
+        *cur                   = item;
+        m_itemRequest[itemIdx] = (uint16_t) (m_numRequests - 1);
+        m_itemOffset[itemIdx]  = 0;
+    }
+
+    // Assign the register buffer regions
+    for ( uint16_t i=0; i < m_numRequests; i++ )
+    {
+        m_requests[i].bufferOffset  = m_bufferSize;
+        m_bufferSize               += m_requests[i].count;
+    }
+    for ( uint16_t i=0; i < m_numItems; i++ )
+    {
+        m_itemOffset[i] += m_requests[m_itemRequest[i]].bufferOffset;
+    }
+}
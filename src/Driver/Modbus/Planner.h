@@ -0,0 +1,141 @@
+#ifndef Driver_Modbus_Planner_h_
+#define Driver_Modbus_Planner_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/Memory/ContiguousAllocator.h"
+#include <stdint.h>
+
+
+///
+namespace Driver {
+///
+namespace Modbus {
+
+
+/** This class coalesces a set of register ranges (aka items) into the minimum
+    number of Modbus requests.  Items with the same unit ID and function code
+    are merged when their register ranges overlap, are adjacent, or (for read
+    functions only) are separated by no more than 'maxGap' registers.  A
+    merged request never exceeds the protocol's maximum register count for
+    its function code.
+
+    The requests are ordered by unit ID, then function code, then register
+    address, i.e. all of the requests for a unit ID are contiguous in the
+    request list (which allows the Client to batch them).
+
+    Each request is assigned a region in a flat 'register buffer' (see
+    Range_T::bufferOffset).  After build(), the location of an individual
+    item's registers in the register buffer is returned by getItemOffset().
+
+    The memory for the planner is allocated from a Contiguous Allocator when
+    the planner is constructed, i.e. the planner does NOT free any memory.
+
+    The class is NOT thread safe.
+ */
+class Planner
+{
+public:
+    /// Register range
+    struct Range_T
+    {
+        uint16_t    address;        //!< Starting register address
+        uint16_t    count;          //!< Number of registers
+        uint16_t    bufferOffset;   //!< Offset (in registers) of the range in the register buffer (only valid for requests)
+        uint8_t     unitId;         //!< Unit identifier
+        uint8_t     functionCode;   //!< Modbus function code
+    };
+
+public:
+    /// Constructor. 'maxItems' is the maximum number of items that can be added
+    Planner( Cpl::Memory::ContiguousAllocator& allocator, uint16_t maxItems ) noexcept;
+
+    /// Returns false if the constructor was unable to allocate its memory
+    inline bool isValid() const noexcept { return m_items != nullptr; }
+
+public:
+    /// Removes all items and requests
+    void clear() noexcept;
+
+    /** Adds an item.  Returns false if the planner is full, the range is
+        empty, or the range is too large for a single request.  Write items
+        are always planned as Write Multiple Registers requests.
+     */
+    bool add( uint8_t unitId, uint8_t functionCode, uint16_t address, uint16_t count ) noexcept;
+
+    /** Builds the request list from the current items.  'maxGap' is the
+        maximum number of unused registers that can be included in a read
+        request in order to merge two ranges into a single request.
+     */
+    void build( uint16_t maxGap = 0 ) noexcept;
+
+public:
+    /// Returns the number of items
+    inline uint16_t getNumItems() const noexcept { return m_numItems; }
+
+    /// Returns the number of requests (valid after build())
+    inline uint16_t getNumRequests() const noexcept { return m_numRequests; }
+
+    /// Returns the specified request (valid after build()).  No range checking is performed
+    inline const Range_T& getRequest( uint16_t requestIdx ) const noexcept { return m_requests[requestIdx]; }
+
+    /// Returns the total size, in registers, of the register buffer (valid after build())
+    inline uint16_t getBufferSize() const noexcept { return m_bufferSize; }
+
+    /** Returns the offset, in the register buffer, of the first register of
+        the specified item (valid after build()).  The index of the request
+        that contains the item is returned via 'requestIdx'.  No range
+        checking is performed.
+     */
+    inline uint16_t getItemOffset( uint16_t itemIdx, uint16_t& requestIdx ) const noexcept
+    {
+        requestIdx = m_itemRequest[itemIdx];
+        return m_itemOffset[itemIdx];
+    }
+
+protected:
+    /// Returns true if item 'a' sorts before item 'b'
+    static bool isBefore( const Range_T& a, const Range_T& b ) noexcept;
+
+protected:
+    /// Items (in the order they were added)
+    Range_T*    m_items;
+
+    /// Requests
+    Range_T*    m_requests;
+
+    /// Sorted order of the items
+    uint16_t*   m_order;
+
+    /// Request index for each item
+    uint16_t*   m_itemRequest;
+
+    /// Register buffer offset for each item
+    uint16_t*   m_itemOffset;
+
+    /// Maximum number of items
+    uint16_t    m_maxItems;
+
+    /// Number of items
+    uint16_t    m_numItems;
+
+    /// Number of requests
+    uint16_t    m_numRequests;
+
+    /// Size of the register buffer
+    uint16_t    m_bufferSize;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,166 @@
+#ifndef Driver_Modbus_Protocol_h_
+#define Driver_Modbus_Protocol_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+///
+namespace Driver {
+///
+namespace Modbus {
+
+
+/** This class defines the Modbus/TCP constants and provides helper methods
+    for encoding/decoding ADUs (i.e. MBAP header + PDU).  All multi-byte
+    fields are big endian on the wire.
+ */
+class Protocol
+{
+public:
+    /// Function code: Read Holding Registers
+    static constexpr uint8_t    FC_READ_HOLDING         = 3;
+
+    /// Function code: Read Input Registers
+    static constexpr uint8_t    FC_READ_INPUT           = 4;
+
+    /// Function code: Write Single Register
+    static constexpr uint8_t    FC_WRITE_SINGLE         = 6;
+
+    /// Function code: Write Multiple Registers
+    static constexpr uint8_t    FC_WRITE_MULTIPLE       = 16;
+
+    /// Bit that is set in the function code of an exception response
+    static constexpr uint8_t    EXCEPTION_BIT           = 0x80;
+
+    /// Exception code: Illegal function
+    static constexpr uint8_t    EX_ILLEGAL_FUNCTION     = 0x01;
+
+    /// Exception code: Illegal data address
+    static constexpr uint8_t    EX_ILLEGAL_ADDRESS      = 0x02;
+
+    /// Exception code: Illegal data value
+    static constexpr uint8_t    EX_ILLEGAL_VALUE        = 0x03;
+
+    /// Exception code: Gateway target device failed to respond (i.e. unknown unit ID)
+    static constexpr uint8_t    EX_GATEWAY_TARGET       = 0x0B;
+
+    /// Size, in bytes, of the MBAP header (including the unit ID)
+    static constexpr size_t     MBAP_SIZE               = 7;
+
+    /// Maximum size, in bytes, of an ADU
+    static constexpr size_t     MAX_ADU_SIZE            = 260;
+
+    /// Maximum number of registers in a single read request
+    static constexpr uint16_t   MAX_READ_REGISTERS      = 125;
+
+    /// Maximum number of registers in a single write request
+    static constexpr uint16_t   MAX_WRITE_REGISTERS     = 123;
+
+    /// MBAP header
+    struct Header_T
+    {
+        uint16_t    transactionId;  //!< Transaction identifier
+        uint16_t    protocolId;     //!< Protocol identifier (always zero)
+        uint16_t    length;         //!< Number of bytes that follow (unit ID + PDU)
+        uint8_t     unitId;         //!< Unit identifier
+    };
+
+public:
+    /// Returns true if the function code is a read function
+    static inline bool isReadFunction( uint8_t functionCode ) noexcept
+    {
+        return functionCode == FC_READ_HOLDING || functionCode == FC_READ_INPUT;
+    }
+
+    /// Returns the maximum number of registers per request for the function code
+    static inline uint16_t getMaxRegisters( uint8_t functionCode ) noexcept
+    {
+        return isReadFunction( functionCode ) ? MAX_READ_REGISTERS : MAX_WRITE_REGISTERS;
+    }
+
+    /// Stores a 16 bit value (big endian)
+    static inline void put16( uint8_t* dst, uint16_t value ) noexcept
+    {
+        dst[0] = (uint8_t) (value >> 8);
+        dst[1] = (uint8_t) value;
+    }
+
+    /// Loads a 16 bit value (big endian)
+    static inline uint16_t get16( const uint8_t* src ) noexcept
+    {
+        return (uint16_t) ((((uint16_t) src[0]) << 8) | src[1]);
+    }
+
+    /// Encodes a MBAP header. 'pduLength' is the number of PDU bytes (i.e. excluding the unit ID)
+    static inline void encodeHeader( uint8_t* dst, uint16_t transactionId, uint8_t unitId, size_t pduLength ) noexcept
+    {
+        put16( dst, transactionId );
+        put16( dst + 2, 0 );
+        put16( dst + 4, (uint16_t) (pduLength + 1) );
+        dst[6] = unitId;
+    }
+
+    /** Decodes a MBAP header.  Returns false if the header is not a valid
+        Modbus/TCP header (the buffer must contain at least MBAP_SIZE bytes)
+     */
+    static inline bool decodeHeader( const uint8_t* src, Header_T& hdr ) noexcept
+    {
+        hdr.transactionId = get16( src );
+        hdr.protocolId    = get16( src + 2 );
+        hdr.length        = get16( src + 4 );
+        hdr.unitId        = src[6];
+        return hdr.protocolId == 0 && hdr.length >= 2 && hdr.length <= MAX_ADU_SIZE - MBAP_SIZE + 1;
+    }
+
+    /// Encodes a Read Holding/Input Registers request. Returns the size of the ADU
+    static inline size_t encodeReadRequest( uint8_t* dst, uint16_t transactionId, uint8_t unitId, uint8_t functionCode, uint16_t address, uint16_t count ) noexcept
+    {
+        encodeHeader( dst, transactionId, unitId, 5 );
+        dst[MBAP_SIZE] = functionCode;
+        put16( dst + MBAP_SIZE + 1, address );
+        put16( dst + MBAP_SIZE + 3, count );
+        return MBAP_SIZE + 5;
+    }
+
+    /// Encodes a Write Single Register request. Returns the size of the ADU
+    static inline size_t encodeWriteSingleRequest( uint8_t* dst, uint16_t transactionId, uint8_t unitId, uint16_t address, uint16_t value ) noexcept
+    {
+        encodeHeader( dst, transactionId, unitId, 5 );
+        dst[MBAP_SIZE] = FC_WRITE_SINGLE;
+        put16( dst + MBAP_SIZE + 1, address );
+        put16( dst + MBAP_SIZE + 3, value );
+        return MBAP_SIZE + 5;
+    }
+
+    /// Encodes a Write Multiple Registers request. Returns the size of the ADU
+    static inline size_t encodeWriteRequest( uint8_t* dst, uint16_t transactionId, uint8_t unitId, uint16_t address, uint16_t count, const uint16_t* values ) noexcept
+    {
+        encodeHeader( dst, transactionId, unitId, 6 + count * 2 );
+        dst[MBAP_SIZE] = FC_WRITE_MULTIPLE;
+        put16( dst + MBAP_SIZE + 1, address );
+        put16( dst + MBAP_SIZE + 3, count );
+        dst[MBAP_SIZE + 5] = (uint8_t) (count * 2);
+        for ( uint16_t i=0; i < count; i++ )
+        {
+            put16( dst + MBAP_SIZE + 6 + i * 2, values[i] );
+        }
+        return MBAP_SIZE + 6 + count * 2;
+    }
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,193 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Server.h"
+#include <string.h>
+
+///
+using namespace Driver::Modbus;
+
+#define ANY_UNIT_ID     0xFF
+
+
+/////////////////////////////////////
+Server::Server( uint8_t   unitId,
+                uint16_t* holdingRegisters,
+                uint16_t  numHoldingRegisters,
+                uint16_t* inputRegisters,
+                uint16_t  numInputRegisters,
+                bool*     holdingWritten ) noexcept
+    : m_holding( holdingRegisters )
+    , m_input( inputRegisters )
+    , m_holdingWritten( holdingWritten )
+    , m_numHolding( holdingRegisters ? numHoldingRegisters : 0 )
+    , m_numInput( inputRegisters ? numInputRegisters : 0 )
+    , m_writeCount( 0 )
+    , m_requestCount( 0 )
+    , m_rxLen( 0 )
+    , m_unitId( unitId )
+{
+}
+
+/////////////////////////////////////
+size_t Server::exceptionResponse( const Protocol::Header_T& hdr, uint8_t functionCode, uint8_t exceptionCode, uint8_t* rsp ) noexcept
+{
+    Protocol::encodeHeader( rsp, hdr.transactionId, hdr.unitId, 2 );
+    rsp[Protocol::MBAP_SIZE]     = functionCode | Protocol::EXCEPTION_BIT;
+    rsp[Protocol::MBAP_SIZE + 1] = exceptionCode;
+    return Protocol::MBAP_SIZE + 2;
+}
+
+size_t Server::processRequest( const uint8_t* req, size_t reqLen, uint8_t* rsp ) noexcept
+{
+    Protocol::Header_T hdr;
+    if ( reqLen < Protocol::MBAP_SIZE + 1 || !Protocol::decodeHeader( req, hdr ) || reqLen != Protocol::MBAP_SIZE - 1 + hdr.length )
+    {
+        return 0;
+    }
+
+    m_requestCount++;
+    const uint8_t* pdu    = req + Protocol::MBAP_SIZE;
+    size_t         pduLen = reqLen - Protocol::MBAP_SIZE;
+    uint8_t        fc     = pdu[0];
+    if ( m_unitId != ANY_UNIT_ID && hdr.unitId != m_unitId )
+    {
+        return exceptionResponse( hdr, fc, Protocol::EX_GATEWAY_TARGET, rsp );
+    }
+
+    switch ( fc )
+    {
+    case Protocol::FC_READ_HOLDING:
+    case Protocol::FC_READ_INPUT:
+    {
+        if ( pduLen != 5 )
+        {
+            return exceptionResponse( hdr, fc, Protocol::EX_ILLEGAL_VALUE, rsp );
+        }
+        uint16_t addr  = Protocol::get16( pdu + 1 );
+        uint16_t count = Protocol::get16( pdu + 3 );
+        if ( count == 0 || count > Protocol::MAX_READ_REGISTERS )
+        {
+            return exceptionResponse( hdr, fc, Protocol::EX_ILLEGAL_VALUE, rsp );
+        }
+        const uint16_t* table    = fc == Protocol::FC_READ_HOLDING ? m_holding : m_input;
+        uint16_t        tableLen = fc == Protocol::FC_READ_HOLDING ? m_numHolding : m_numInput;
+        if ( ((uint32_t) addr) + count > tableLen )
+        {
+            return exceptionResponse( hdr, fc, Protocol::EX_ILLEGAL_ADDRESS, rsp );
+        }
+
+        Protocol::encodeHeader( rsp, hdr.transactionId, hdr.unitId, 2 + count * 2 );
+        rsp[Protocol::MBAP_SIZE]     = fc;
+        rsp[Protocol::MBAP_SIZE + 1] = (uint8_t) (count * 2);
+        for ( uint16_t i=0; i < count; i++ )
+        {
+            Protocol::put16( rsp + Protocol::MBAP_SIZE + 2 + i * 2, table[addr + i] );
+        }
+        return Protocol::MBAP_SIZE + 2 + count * 2;
+    }
+
+    case Protocol::FC_WRITE_SINGLE:
+    case Protocol::FC_WRITE_MULTIPLE:
+    {
+        if ( pduLen < 5 )
+        {
+            return exceptionResponse( hdr, fc, Protocol::EX_ILLEGAL_VALUE, rsp );
+        }
+        uint16_t       addr   = Protocol::get16( pdu + 1 );
+        uint16_t       count  = 1;
+        const uint8_t* values = pdu + 3;
+        if ( fc == Protocol::FC_WRITE_SINGLE )
+        {
+            if ( pduLen != 5 )
+            {
+                return exceptionResponse( hdr, fc, Protocol::EX_ILLEGAL_VALUE, rsp );
+            }
+        }
+        else
+        {
+            count  = pduLen >= 6 ? Protocol::get16( pdu + 3 ) : 0;
+            values = pdu + 6;
+            if ( count == 0 || count > Protocol::MAX_WRITE_REGISTERS || pdu[5] != count * 2 || pduLen != 6 + ((size_t) count) * 2 )
+            {
+                return exceptionResponse( hdr, fc, Protocol::EX_ILLEGAL_VALUE, rsp );
+            }
+        }
+        if ( ((uint32_t) addr) + count > m_numHolding )
+        {
+            return exceptionResponse( hdr, fc, Protocol::EX_ILLEGAL_ADDRESS, rsp );
+        }
+
+        for ( uint16_t i=0; i < count; i++ )
+        {
+            m_holding[addr + i] = Protocol::get16( values + i * 2 );
+            if ( m_holdingWritten )
+            {
+                m_holdingWritten[addr + i] = true;
+            }
+        }
+        m_writeCount++;
+
+        // Both responses echo the first 5 bytes of the request's PDU
+        Protocol::encodeHeader( rsp, hdr.transactionId, hdr.unitId, 5 );
+        memcpy( rsp + Protocol::MBAP_SIZE, pdu, 5 );
+        return Protocol::MBAP_SIZE + 5;
+    }
+
+    default:
+        return exceptionResponse( hdr, fc, Protocol::EX_ILLEGAL_FUNCTION, rsp );
+    }
+}
+
+/////////////////////////////////////
+bool Server::service( Cpl::Io::InputOutput& stream ) noexcept
+{
+    for ( ;;)
+    {
+        // Determine how many bytes are needed to complete the current frame
+        size_t needed = Protocol::MBAP_SIZE;
+        if ( m_rxLen >= Protocol::MBAP_SIZE )
+        {
+            Protocol::Header_T hdr;
+            if ( !Protocol::decodeHeader( m_rxBuf, hdr ) )
+            {
+                m_rxLen = 0;
+                return false;
+            }
+            needed = Protocol::MBAP_SIZE - 1 + hdr.length;
+        }
+
+        // Process a complete frame
+        if ( m_rxLen == needed && needed > Protocol::MBAP_SIZE )
+        {
+            size_t rspLen = processRequest( m_rxBuf, m_rxLen, m_txBuf );
+            m_rxLen       = 0;
+            if ( rspLen > 0 && !stream.write( m_txBuf, (int) rspLen ) )
+            {
+                return false;
+            }
+            continue;
+        }
+
+        // Read more data (without blocking)
+        if ( !stream.available() )
+        {
+            return true;
+        }
+        int bytesRead = 0;
+        if ( !stream.read( m_rxBuf + m_rxLen, (int) (needed - m_rxLen), bytesRead ) )
+        {
+            m_rxLen = 0;
+            return false;
+        }
+        m_rxLen += bytesRead;
+    }
+}
@@ -0,0 +1,123 @@
+#ifndef Driver_Modbus_Server_h_
+#define Driver_Modbus_Server_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Driver/Modbus/Protocol.h"
+#include "Cpl/Io/InputOutput.h"
+
+
+///
+namespace Driver {
+///
+namespace Modbus {
+
+
+/** This class implements the server (aka slave) side of the Modbus/TCP
+    protocol for a single unit ID.  The server exposes two register tables:
+    holding registers (read/write by the remote client) and input registers
+    (read only by the remote client).  The register memory is owned by the
+    application.
+
+    The server does NOT provide any thread safety for the register tables,
+    i.e. the application is responsible for only accessing the tables from
+    the thread that calls service()/processRequest().
+
+    The class is NOT thread safe.
+ */
+class Server
+{
+public:
+    /** Constructor.  A unit ID of 0xFF means that the server responds to
+        all unit IDs.  'holdingWritten' is an optional array (one flag per
+        holding register) that is set to true when the remote client writes
+        the corresponding holding register.
+     */
+    Server( uint8_t   unitId,
+            uint16_t* holdingRegisters,
+            uint16_t  numHoldingRegisters,
+            uint16_t* inputRegisters,
+            uint16_t  numInputRegisters,
+            bool*     holdingWritten = nullptr ) noexcept;
+
+public:
+    /** This method processes a single request ADU and generates the response
+        ADU.  Returns the size of the response ADU, or zero if the request
+        is malformed (i.e. no response should be sent).  'rsp' must be at
+        least Protocol::MAX_ADU_SIZE bytes.
+     */
+    size_t processRequest( const uint8_t* req, size_t reqLen, uint8_t* rsp ) noexcept;
+
+    /** This method services the connection, i.e. it processes all of the
+        complete requests that are currently available on the stream.  The
+        method does NOT block waiting for data.  Partially received requests
+        are retained until the next call.  Returns false if an IO error or a
+        framing error occurred (i.e. the connection should be closed).
+     */
+    bool service( Cpl::Io::InputOutput& stream ) noexcept;
+
+    /// Discards any partially received request (e.g. when a new connection is accepted)
+    inline void reset() noexcept { m_rxLen = 0; }
+
+public:
+    /// Returns the server's unit ID
+    inline uint8_t getUnitId() const noexcept { return m_unitId; }
+
+    /// Returns the number of write requests that have been successfully processed
+    inline uint32_t getWriteCount() const noexcept { return m_writeCount; }
+
+    /// Returns the number of requests that have been processed (including exception responses)
+    inline uint32_t getRequestCount() const noexcept { return m_requestCount; }
+
+protected:
+    /// Helper method
+    size_t exceptionResponse( const Protocol::Header_T& hdr, uint8_t functionCode, uint8_t exceptionCode, uint8_t* rsp ) noexcept;
+
+protected:
+    /// Holding registers
+    uint16_t*   m_holding;
+
+    /// Input registers
+    uint16_t*   m_input;
+
+    /// Holding register written flags
+    bool*       m_holdingWritten;
+
+    /// Number of holding registers
+    uint16_t    m_numHolding;
+
+    /// Number of input registers
+    uint16_t    m_numInput;
+
+    /// Number of write requests
+    uint32_t    m_writeCount;
+
+    /// Number of requests
+    uint32_t    m_requestCount;
+
+    /// Number of bytes in the receive buffer
+    size_t      m_rxLen;
+
+    /// Unit ID
+    uint8_t     m_unitId;
+
+    /// Receive buffer
+    uint8_t     m_rxBuf[Protocol::MAX_ADU_SIZE];
+
+    /// Transmit buffer
+    uint8_t     m_txBuf[Protocol::MAX_ADU_SIZE];
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,62 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "ClientTransport.h"
+#include "Cpl/System/Trace.h"
+
+#define SECT_   "Driver::Modbus::Tcp"
+
+///
+using namespace Driver::Modbus::Tcp;
+
+
+/////////////////////////////////////
+ClientTransport::ClientTransport( Cpl::Io::Socket::Connector& connector, const char* remoteHostName, int portNum ) noexcept
+    : m_connector( connector )
+    , m_host( remoteHostName )
+    , m_port( portNum )
+    , m_connected( false )
+{
+}
+
+ClientTransport::~ClientTransport()
+{
+    disconnect();
+}
+
+/////////////////////////////////////
+Cpl::Io::InputOutput* ClientTransport::connect() noexcept
+{
+    if ( m_connected )
+    {
+        return &m_stream;
+    }
+
+    Cpl::Io::Descriptor fd;
+    if ( m_connector.establish( m_host, m_port, fd ) != Cpl::Io::Socket::Connector::eSUCCESS )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Unable to connect to %s:%d", m_host, m_port) );
+        return nullptr;
+    }
+
+    m_stream.activate( fd );
+    m_connected = true;
+    return &m_stream;
+}
+
+void ClientTransport::disconnect() noexcept
+{
+    if ( m_connected )
+    {
+        m_stream.close();
+        m_connected = false;
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef Driver_Modbus_Tcp_ClientTransport_h_
+#define Driver_Modbus_Tcp_ClientTransport_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Driver/Modbus/TransportApi.h"
+#include "Cpl/Io/Socket/Connector.h"
+#include "Cpl/Io/Socket/InputOutput.h"
+
+
+///
+namespace Driver {
+///
+namespace Modbus {
+///
+namespace Tcp {
+
+
+/** This concrete class implements the TransportApi for the client side of a
+    Modbus/TCP connection, i.e. it connects to a remote Modbus/TCP server.
+
+    The class is NOT thread safe.
+ */
+class ClientTransport : public Driver::Modbus::TransportApi
+{
+public:
+    /// Default Modbus/TCP port number
+    static constexpr int DEFAULT_PORT = 502;
+
+public:
+    /** Constructor.  The 'remoteHostName' string must stay in scope for the
+        life time of the transport
+     */
+    ClientTransport( Cpl::Io::Socket::Connector& connector, const char* remoteHostName, int portNum = DEFAULT_PORT ) noexcept;
+
+    /// Destructor
+    ~ClientTransport();
+
+public:
+    /// See Driver::Modbus::TransportApi
+    Cpl::Io::InputOutput* connect() noexcept;
+
+    /// See Driver::Modbus::TransportApi
+    void disconnect() noexcept;
+
+protected:
+    /// Socket connector
+    Cpl::Io::Socket::Connector&     m_connector;
+
+    /// Socket stream
+    Cpl::Io::Socket::InputOutput    m_stream;
+
+    /// Remote host
+    const char*                     m_host;
+
+    /// Remote port
+    int                             m_port;
+
+    /// Connection state
+    bool                            m_connected;
+};
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
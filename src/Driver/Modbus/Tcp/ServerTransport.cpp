@@ -0,0 +1,87 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "ServerTransport.h"
+#include "Cpl/System/Trace.h"
+
+#define SECT_   "Driver::Modbus::Tcp"
+
+///
+using namespace Driver::Modbus::Tcp;
+
+
+/////////////////////////////////////
+ServerTransport::ServerTransport() noexcept
+    : m_pending( false )
+    , m_connected( false )
+{
+}
+
+ServerTransport::~ServerTransport()
+{
+    disconnect();
+    if ( m_pending )
+    {
+        Cpl::Io::Socket::InputOutput discard( m_pendingFd );
+        discard.close();
+    }
+}
+
+/////////////////////////////////////
+Cpl::Io::InputOutput* ServerTransport::connect() noexcept
+{
+    Cpl::Io::Descriptor fd;
+    bool                newConnection = false;
+    {
+        Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+        if ( m_pending )
+        {
+            fd            = m_pendingFd;
+            m_pending     = false;
+            newConnection = true;
+        }
+    }
+
+    // The newest connection wins
+    if ( newConnection )
+    {
+        disconnect();
+        m_stream.activate( fd );
+        m_connected = true;
+    }
+    return m_connected ? &m_stream : nullptr;
+}
+
+void ServerTransport::disconnect() noexcept
+{
+    if ( m_connected )
+    {
+        m_stream.close();
+        m_connected = false;
+    }
+}
+
+/////////////////////////////////////
+bool ServerTransport::newConnection( Cpl::Io::Descriptor newFd, const char* rawConnectionInfo )
+{
+    CPL_SYSTEM_TRACE_MSG( SECT_, ("Accepted connection from: %s", rawConnectionInfo) );
+
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    if ( m_pending )
+    {
+        // Discard the previous connection that was never handed off
+        Cpl::Io::Socket::InputOutput discard( m_pendingFd );
+        discard.close();
+    }
+    m_pendingFd = newFd;
+    m_pending   = true;
+    return true;
+}
@@ -0,0 +1,80 @@
+#ifndef Driver_Modbus_Tcp_ServerTransport_h_
+#define Driver_Modbus_Tcp_ServerTransport_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Driver/Modbus/TransportApi.h"
+#include "Cpl/Io/Socket/Listener.h"
+#include "Cpl/Io/Socket/InputOutput.h"
+#include "Cpl/System/Mutex.h"
+
+
+///
+namespace Driver {
+///
+namespace Modbus {
+///
+namespace Tcp {
+
+
+/** This concrete class implements the TransportApi for the server side of a
+    Modbus/TCP connection, i.e. it accepts connections from remote Modbus/TCP
+    clients.  Only one connection is active at a time: a newly accepted
+    connection replaces the current connection.
+
+    The application is responsible for starting the Listener (with this
+    instance as the Listener's client).  The newConnection() callback
+    executes in the Listener's thread; the accepted connection is handed off
+    to the driver thread the next time connect() is called.
+ */
+class ServerTransport : public Driver::Modbus::TransportApi, public Cpl::Io::Socket::Listener::Client
+{
+public:
+    /// Constructor
+    ServerTransport() noexcept;
+
+    /// Destructor
+    ~ServerTransport();
+
+public:
+    /// See Driver::Modbus::TransportApi
+    Cpl::Io::InputOutput* connect() noexcept;
+
+    /// See Driver::Modbus::TransportApi
+    void disconnect() noexcept;
+
+public:
+    /// See Cpl::Io::Socket::Listener::Client
+    bool newConnection( Cpl::Io::Descriptor newFd, const char* rawConnectionInfo );
+
+protected:
+    /// Mutex (protects the pending connection)
+    Cpl::System::Mutex              m_lock;
+
+    /// Socket stream
+    Cpl::Io::Socket::InputOutput    m_stream;
+
+    /// Accepted connection that has not yet been handed off to the driver thread
+    Cpl::Io::Descriptor             m_pendingFd;
+
+    /// True when there is pending connection
+    bool                            m_pending;
+
+    /// Connection state
+    bool                            m_connected;
+};
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
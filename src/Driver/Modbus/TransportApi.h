@@ -0,0 +1,56 @@
+#ifndef Driver_Modbus_TransportApi_h_
+#define Driver_Modbus_TransportApi_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/Io/InputOutput.h"
+
+
+///
+namespace Driver {
+///
+namespace Modbus {
+
+
+/** This abstract class defines the interface for the physical connection
+    that Modbus ADUs are exchanged over.
+
+    NOTE: The transport is NOT thread safe, i.e. it is intended to be used
+          by a single (driver) thread.
+ */
+class TransportApi
+{
+public:
+    /** This method returns the stream for the connection.  If there is no
+        current connection, the method attempts to establish one.  Returns
+        nullptr if there is no connection (e.g. the remote device refused
+        the connection, or for a server - no remote client has connected yet).
+        The method does not block for 'long periods' when no connection can
+        be established.
+     */
+    virtual Cpl::Io::InputOutput* connect() noexcept = 0;
+
+    /** This method closes the current connection (if there is one).  It
+        is typically called when an IO error or a protocol error has been
+        detected.
+     */
+    virtual void disconnect() noexcept = 0;
+
+public:
+    /// Virtual destructor
+    virtual ~TransportApi() {}
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
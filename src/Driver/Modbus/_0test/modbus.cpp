@@ -0,0 +1,288 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Driver/Modbus/Planner.h"
+#include "Driver/Modbus/Client.h"
+#include "Driver/Modbus/Server.h"
+#include "Driver/Modbus/Loopback.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+///
+using namespace Driver::Modbus;
+
+static size_t heap_[2000];
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Planner" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap allocator( heap_, sizeof( heap_ ) );
+    Planner               uut( allocator, 8 );
+    REQUIRE( uut.isValid() );
+    uint16_t reqIdx;
+
+    SECTION( "coalesce" )
+    {
+        REQUIRE( uut.add( 1, Protocol::FC_READ_HOLDING, 10, 2 ) );     // item 0
+        REQUIRE( uut.add( 1, Protocol::FC_READ_HOLDING, 0, 4 ) );      // item 1
+        REQUIRE( uut.add( 1, Protocol::FC_READ_HOLDING, 4, 1 ) );      // item 2: adjacent to item 1
+        REQUIRE( uut.add( 1, Protocol::FC_READ_INPUT, 0, 1 ) );        // item 3: different function
+        REQUIRE( uut.add( 2, Protocol::FC_READ_HOLDING, 0, 1 ) );      // item 4: different unit
+        REQUIRE( uut.add( 1, Protocol::FC_READ_HOLDING, 2, 1 ) );      // item 5: overlaps item 1
+        uut.build();
+        REQUIRE( uut.getNumRequests() == 4 );
+        REQUIRE( uut.getRequest( 0 ).address == 0 );
+        REQUIRE( uut.getRequest( 0 ).count == 5 );
+        REQUIRE( uut.getRequest( 1 ).address == 10 );
+        REQUIRE( uut.getRequest( 1 ).count == 2 );
+        REQUIRE( uut.getRequest( 2 ).functionCode == (uint8_t) Protocol::FC_READ_INPUT );
+        REQUIRE( uut.getRequest( 3 ).unitId == 2 );
+        REQUIRE( uut.getBufferSize() == 9 );
+        REQUIRE( uut.getItemOffset( 0, reqIdx ) == 5 );
+        REQUIRE( reqIdx == 1 );
+        REQUIRE( uut.getItemOffset( 2, reqIdx ) == 4 );
+        REQUIRE( reqIdx == 0 );
+        REQUIRE( uut.getItemOffset( 5, reqIdx ) == 2 );
+        REQUIRE( uut.getItemOffset( 4, reqIdx ) == 8 );
+        REQUIRE( reqIdx == 3 );
+
+        // Allow gaps in read requests
+        uut.build( 6 );
+        REQUIRE( uut.getNumRequests() == 3 );
+        REQUIRE( uut.getRequest( 0 ).count == 12 );
+        REQUIRE( uut.getItemOffset( 0, reqIdx ) == 10 );
+        REQUIRE( reqIdx == 0 );
+    }
+
+    SECTION( "writes" )
+    {
+        REQUIRE( uut.add( 1, Protocol::FC_WRITE_SINGLE, 0, 1 ) );
+        REQUIRE( uut.add( 1, Protocol::FC_WRITE_MULTIPLE, 2, 1 ) );
+        uut.build( 10 );
+        REQUIRE( uut.getNumRequests() == 2 );       // Gaps are never written
+        REQUIRE( uut.getRequest( 0 ).functionCode == (uint8_t) Protocol::FC_WRITE_MULTIPLE );
+    }
+
+    SECTION( "limits" )
+    {
+        REQUIRE( uut.add( 1, Protocol::FC_READ_HOLDING, 0, 0 ) == false );
+        REQUIRE( uut.add( 1, Protocol::FC_READ_HOLDING, 0, Protocol::MAX_READ_REGISTERS + 1 ) == false );
+        REQUIRE( uut.add( 1, Protocol::FC_READ_HOLDING, 0, 100 ) );
+        REQUIRE( uut.add( 1, Protocol::FC_READ_HOLDING, 100, 100 ) );
+        uut.build();
+        REQUIRE( uut.getNumRequests() == 2 );       // Exceeds the max registers per request
+        for ( unsigned i=0; i < 6; i++ )
+        {
+            REQUIRE( uut.add( 3, Protocol::FC_READ_INPUT, i * 2, 1 ) );
+        }
+        REQUIRE( uut.add( 3, Protocol::FC_READ_INPUT, 20, 1 ) == false );
+        uut.clear();
+        REQUIRE( uut.getNumItems() == 0 );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Client/Server" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap allocator( heap_, sizeof( heap_ ) );
+    uint16_t              holding1[200];
+    uint16_t              input1[10];
+    bool                  written1[200];
+    uint16_t              holding2[10];
+    for ( uint16_t i=0; i < 200; i++ )
+    {
+        holding1[i] = 1000 + i;
+        written1[i] = false;
+    }
+    for ( uint16_t i=0; i < 10; i++ )
+    {
+        input1[i]   = 2000 + i;
+        holding2[i] = 3000 + i;
+    }
+    Server   server1( 1, holding1, 200, input1, 10, written1 );
+    Server   server2( 2, holding2, 10, nullptr, 0 );
+    Loopback loopback;
+    REQUIRE( loopback.attach( server1 ) );
+    REQUIRE( loopback.attach( server2 ) );
+    Cpl::Io::InputOutput* stream = loopback.connect();
+    REQUIRE( stream );
+
+    Planner  plan( allocator, 16 );
+    uint16_t regs[256];
+    uint8_t  results[16];
+    uint16_t reqIdx;
+
+    SECTION( "pipelined reads" )
+    {
+        for ( uint16_t i=0; i < 8; i++ )
+        {
+            REQUIRE( plan.add( 1, Protocol::FC_READ_HOLDING, i * 20, 2 ) );
+        }
+        REQUIRE( plan.add( 1, Protocol::FC_READ_INPUT, 3, 2 ) );
+        REQUIRE( plan.add( 2, Protocol::FC_READ_HOLDING, 9, 1 ) );
+        plan.build();
+        REQUIRE( plan.getNumRequests() == 10 );
+
+        Client uut( 4 );
+        REQUIRE( uut.execute( *stream, plan, regs, results ) );
+        for ( uint16_t i=0; i < plan.getNumRequests(); i++ )
+        {
+            REQUIRE( results[i] == Client::eSUCCESS );
+        }
+        REQUIRE( regs[plan.getItemOffset( 0, reqIdx )] == 1000 );
+        REQUIRE( regs[plan.getItemOffset( 7, reqIdx ) + 1] == 1141 );
+        REQUIRE( regs[plan.getItemOffset( 8, reqIdx )] == 2003 );
+        REQUIRE( regs[plan.getItemOffset( 9, reqIdx )] == 3009 );
+        REQUIRE( loopback.getNumWrites() == 10 - 4 + 1 );   // Initial window is one write, then one write per completed response
+        REQUIRE( uut.getNumStreamWrites() == loopback.getNumWrites() );
+
+        // Out of order responses
+        loopback.setReverseResponses( true );
+        memset( regs, 0, sizeof( regs ) );
+        REQUIRE( uut.execute( *stream, plan, regs, results ) );
+        REQUIRE( regs[plan.getItemOffset( 3, reqIdx )] == 1060 );
+        REQUIRE( regs[plan.getItemOffset( 9, reqIdx )] == 3009 );
+    }
+
+    SECTION( "writes" )
+    {
+        REQUIRE( plan.add( 1, Protocol::FC_WRITE_MULTIPLE, 10, 3 ) );
+        REQUIRE( plan.add( 1, Protocol::FC_WRITE_MULTIPLE, 50, 1 ) );
+        plan.build();
+        regs[plan.getItemOffset( 0, reqIdx )]     = 11;
+        regs[plan.getItemOffset( 0, reqIdx ) + 2] = 13;
+        regs[plan.getItemOffset( 1, reqIdx )]     = 51;
+        Client uut;
+        REQUIRE( uut.execute( *stream, plan, regs, results ) );
+        REQUIRE( results[0] == Client::eSUCCESS );
+        REQUIRE( results[1] == Client::eSUCCESS );
+        REQUIRE( holding1[10] == 11 );
+        REQUIRE( holding1[12] == 13 );
+        REQUIRE( holding1[50] == 51 );
+        REQUIRE( written1[11] );
+        REQUIRE( written1[13] == false );
+        REQUIRE( server1.getWriteCount() == 2 );
+        REQUIRE( loopback.getNumWrites() == 1 );
+    }
+
+    SECTION( "exceptions" )
+    {
+        REQUIRE( plan.add( 1, Protocol::FC_READ_INPUT, 8, 4 ) );       // Beyond the table
+        REQUIRE( plan.add( 7, Protocol::FC_READ_HOLDING, 0, 1 ) );     // Unknown unit
+        REQUIRE( plan.add( 2, Protocol::FC_READ_HOLDING, 0, 1 ) );
+        plan.build();
+        Client uut;
+        REQUIRE( uut.execute( *stream, plan, regs, results ) );
+        REQUIRE( results[0] == Client::eEXCEPTION );
+        REQUIRE( results[1] == Client::eSUCCESS );
+        REQUIRE( results[2] == Client::eEXCEPTION );
+        REQUIRE( uut.getLastExceptionCode() == (uint8_t) Protocol::EX_GATEWAY_TARGET );
+        REQUIRE( regs[plan.getItemOffset( 2, reqIdx )] == 3000 );
+    }
+
+    SECTION( "timeout" )
+    {
+        REQUIRE( plan.add( 1, Protocol::FC_READ_HOLDING, 0, 1 ) );
+        plan.build();
+        loopback.setUnresponsive( true );
+        Client uut( 1, 20 );
+        REQUIRE( uut.execute( *stream, plan, regs, results ) == false );
+        REQUIRE( results[0] == Client::eTIMEOUT );
+
+        // Reconnect
+        loopback.disconnect();
+        loopback.setUnresponsive( false );
+        stream = loopback.connect();
+        REQUIRE( stream );
+        REQUIRE( loopback.getNumConnects() == 2 );
+        REQUIRE( uut.execute( *stream, plan, regs, results ) );
+        REQUIRE( results[0] == Client::eSUCCESS );
+    }
+
+    SECTION( "disconnected" )
+    {
+        REQUIRE( plan.add( 1, Protocol::FC_READ_HOLDING, 0, 1 ) );
+        plan.build();
+        loopback.setConnectionAllowed( false );
+        Client uut;
+        REQUIRE( uut.execute( *stream, plan, regs, results ) == false );
+        REQUIRE( results[0] == Client::eIO_ERROR );
+        REQUIRE( loopback.connect() == nullptr );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Server" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    uint16_t holding[4] ={ 1, 2, 3, 4 };
+    Server   uut( 5, holding, 4, nullptr, 0 );
+    uint8_t  req[Protocol::MAX_ADU_SIZE];
+    uint8_t  rsp[Protocol::MAX_ADU_SIZE];
+
+    SECTION( "processRequest" )
+    {
+        size_t len = Protocol::encodeWriteSingleRequest( req, 7, 5, 3, 0x1234 );
+        REQUIRE( uut.processRequest( req, len, rsp ) == len );
+        REQUIRE( memcmp( req, rsp, len ) == 0 );
+        REQUIRE( holding[3] == 0x1234 );
+
+        len = Protocol::encodeReadRequest( req, 8, 5, Protocol::FC_READ_INPUT, 0, 1 );
+        REQUIRE( uut.processRequest( req, len, rsp ) == Protocol::MBAP_SIZE + 2 );
+        REQUIRE( rsp[Protocol::MBAP_SIZE] == (Protocol::FC_READ_INPUT | Protocol::EXCEPTION_BIT) );
+        REQUIRE( rsp[Protocol::MBAP_SIZE + 1] == (uint8_t) Protocol::EX_ILLEGAL_ADDRESS );
+
+        req[Protocol::MBAP_SIZE] = 0x2B;
+        REQUIRE( uut.processRequest( req, len, rsp ) == Protocol::MBAP_SIZE + 2 );
+        REQUIRE( rsp[Protocol::MBAP_SIZE + 1] == (uint8_t) Protocol::EX_ILLEGAL_FUNCTION );
+
+        // Truncated frame
+        REQUIRE( uut.processRequest( req, len - 1, rsp ) == 0 );
+    }
+
+    SECTION( "service" )
+    {
+        Loopback loopback;
+        REQUIRE( loopback.connect() );
+        Cpl::Io::InputOutput& remote = loopback.getRemote();
+
+        // Partial frame
+        size_t len = Protocol::encodeReadRequest( req, 9, 5, Protocol::FC_READ_HOLDING, 1, 2 );
+        REQUIRE( loopback.write( req, 5 ) );
+        REQUIRE( uut.service( remote ) );
+        REQUIRE( loopback.available() == false );
+        REQUIRE( loopback.write( req + 5, (int) len - 5 ) );
+        REQUIRE( uut.service( remote ) );
+        int bytesRead = 0;
+        REQUIRE( loopback.read( rsp, sizeof( rsp ), bytesRead ) );
+        REQUIRE( bytesRead == (int) (Protocol::MBAP_SIZE + 2 + 4) );
+        REQUIRE( Protocol::get16( rsp ) == 9 );
+        REQUIRE( Protocol::get16( rsp + Protocol::MBAP_SIZE + 2 ) == 2 );
+        REQUIRE( Protocol::get16( rsp + Protocol::MBAP_SIZE + 4 ) == 3 );
+
+        // Framing error
+        req[2] = 1;
+        REQUIRE( loopback.write( req, (int) len ) );
+        REQUIRE( uut.service( remote ) == false );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
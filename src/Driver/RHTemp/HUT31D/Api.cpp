@@ -11,6 +11,7 @@
 /** @file */
 
 #include "Api.h"
+#include "Commands.h"
 #include "Cpl/System/Assert.h"
 #include "Cpl/System/Api.h"
 #include "Cpl/System/Trace.h"
@@ -21,13 +22,6 @@ using namespace Driver::RHTemp::HUT31D;
 
 #define SECT_ "Driver::RHTemp::HUT31D"
 
-#define MAX_CONVERSION_TIME 50      // Approximate double the time in the datasheet
-#define WAIT_ON_RESET_MS    10      // Approximate double the time in the datasheet
-
-static uint8_t htu31dCrc( uint16_t value );
-static float convertRH( uint16_t rawRH );
-static float convertTemp( uint16_t rawTemp );
-
 //////////////////////////////////////////////////////////////////////////////
 Api::Api( Driver::I2C::Master& i2cDriver, uint8_t i2cDevice7BitAddress )
     : m_i2cDriver( i2cDriver )
@@ -42,7 +36,7 @@ bool Api::start() noexcept
     if ( !m_started )
     {
         // Reset the device
-        uint8_t cmd = 0x1E;
+        uint8_t cmd = CMD_RESET;
         m_i2cDriver.writeToDevice( m_devAddress, sizeof( cmd ), &cmd );
         Cpl::System::Api::sleep( WAIT_ON_RESET_MS );
 
@@ -52,11 +46,11 @@ bool Api::start() noexcept
         {
 
             uint8_t data[2] ={ 0, };
-            auto result = m_i2cDriver.registerRead<uint8_t[2]>( m_devAddress, 0x08, data );
+            auto result = m_i2cDriver.registerRead<uint8_t[2]>( m_devAddress, CMD_READ_DIAGNOSTIC, data );
             if ( result == Driver::I2C::Master::eSUCCESS )
             {
                 // Check if there are any errors (The LSb is heater on/off state)
-                if ( htu31dCrc( data[0] ) == data[1] && (data[0] & 0xFE) == 0x00 )
+                if ( isDiagnosticOk( data ) )
                 {
                     m_sampleState = eNOT_STARTED;
                     m_started     = true;
@@ -94,7 +88,7 @@ bool Api::sample( float& rhOut, float& tempCOut ) noexcept
     // Start the conversion
     if ( startConversion() == Driver::I2C::Master::eSUCCESS )
     {
-        Cpl::System::Api::sleep( MAX_CONVERSION_TIME );
+        Cpl::System::Api::sleep( MAX_CONVERSION_TIME_MS );
 
         if ( readConversionResult( rhOut, tempCOut ) == Driver::I2C::Master::eSUCCESS )
         {
@@ -107,7 +101,7 @@ bool Api::sample( float& rhOut, float& tempCOut ) noexcept
 
 Driver::I2C::Master::Result_T Api::startConversion()
 {
-    uint8_t conversion = 0x40 | (0x0F << 1); // Highest accuracy
+    uint8_t conversion = CMD_CONVERSION;
     return m_i2cDriver.writeToDevice( m_devAddress, sizeof( conversion ), &conversion );
 }
 
@@ -118,7 +112,7 @@ Driver::I2C::Master::Result_T Api::readConversionResult( float& rhOut, float& te
     // On my boards - the I2C transactions periodically fail -->so build in retry attempts
     for ( uint8_t readAttempts = OPTION_DRIVER_RHTEMP_HUT31D_READ_RESULT_ATTEMPTS; readAttempts; readAttempts-- )
     {
-        uint8_t readCmd  = 0;
+        uint8_t readCmd  = CMD_READ_RH_TEMP;
         result = m_i2cDriver.writeToDevice( m_devAddress, sizeof( readCmd ), &readCmd, true );
         if ( result == Driver::I2C::Master::eSUCCESS )
         {
@@ -127,11 +121,11 @@ Driver::I2C::Master::Result_T Api::readConversionResult( float& rhOut, float& te
             if ( result == Driver::I2C::Master::eSUCCESS )
             {
                 uint16_t rawTemp = ((uint16_t) (data[0]) << 8) | data[1];
-                uint8_t  crcTemp = htu31dCrc( rawTemp );
+                uint8_t  crcTemp = crc( rawTemp );
                 if ( crcTemp == data[2] )
                 {
                     uint16_t rawRh = ((uint16_t) (data[3]) << 8) | data[4];
-                    uint8_t  crcRh = htu31dCrc( rawRh );
+                    uint8_t  crcRh = crc( rawRh );
                     if ( crcRh == data[5] )
                     {
                         rhOut    = convertRH( rawRh );
@@ -188,7 +182,7 @@ Driver::RHTemp::Api::SamplingState_T Api::startSample() noexcept
 
 Driver::RHTemp::Api::SamplingState_T Api::checkSamplingTime()
 {
-    if ( m_sampleState == eSAMPLING && Cpl::System::ElapsedTime::expiredMilliseconds( m_timeMarker, MAX_CONVERSION_TIME ) )
+    if ( m_sampleState == eSAMPLING && Cpl::System::ElapsedTime::expiredMilliseconds( m_timeMarker, MAX_CONVERSION_TIME_MS ) )
     {
         m_sampleState = eSAMPLE_READY;
     }
@@ -217,7 +211,7 @@ Driver::RHTemp::Api::SamplingState_T Api::getSample( float& rhOut, float& tempCO
 //////////////////////////////////////////////////////////////////////////////
 bool Api::setHeaterState( bool enabled ) noexcept
 {
-    uint8_t heaterCmd = enabled ? 0x04 : 0x02;
+    uint8_t heaterCmd = enabled ? CMD_HEATER_ON : CMD_HEATER_OFF;
     Driver::I2C::Master::Result_T result = m_i2cDriver.writeToDevice( m_devAddress, sizeof( heaterCmd ), &heaterCmd );
     if ( result == Driver::I2C::Master::eSUCCESS )
     {
@@ -228,43 +222,3 @@ bool Api::setHeaterState( bool enabled ) noexcept
     CPL_SYSTEM_TRACE_MSG( SECT_, ("Failed to set the heater state (%d). result=%d", enabled, result) );
     return false;
 }
-
-//////////////////////////////////////////////////////////////////////////////
-float convertRH( uint16_t rawRH )
-{
-    // Convert to % (0-100)
-    float rh =  (rawRH / 65535.0) * 100;
-    return rh;
-}
-
-float convertTemp( uint16_t rawTemp )
-{
-    // Convert to degrees Centigrade
-    float temp = (rawTemp / 65535.0) * 165 - 40;
-    return temp;
-}
-
-uint8_t htu31dCrc( uint16_t value )
-{
-    uint32_t polynom = 0x988000; // x^8 + x^5 + x^4 + 1
-    uint32_t msb     = 0x800000;
-    uint32_t mask    = 0xFF8000;
-    uint32_t result  = (uint32_t) value << 8; // Pad with zeros as specified in spec
-
-    while ( msb != 0x80 )
-    {
-        // Check if msb of current value is 1 and apply XOR mask
-        if ( result & msb )
-        {
-            result = ((result ^ polynom) & mask) | (result & ~mask);
-        }
-
-        // Shift by one
-        msb >>= 1;
-        mask >>= 1;
-        polynom >>= 1;
-    }
-
-    return result;
-}
-
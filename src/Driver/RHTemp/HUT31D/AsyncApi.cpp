@@ -0,0 +1,232 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "AsyncApi.h"
+#include "Commands.h"
+#include "Cpl/System/Trace.h"
+
+using namespace Driver::RHTemp::HUT31D;
+
+#define SECT_ "Driver::RHTemp::HUT31D"
+
+
+//////////////////////////////////////////////////////////////////////////////
+AsyncApi::AsyncApi( Driver::I2C::TransactionQueue& i2cQueue, uint8_t i2cDevice7BitAddress )
+    : m_queue( i2cQueue )
+    , m_cmdTransaction( *this )
+    , m_heaterTransaction( *this )
+    , m_rh( 0.0F )
+    , m_temp( 0.0F )
+    , m_sampleState( eNOT_STARTED )
+    , m_step( eIDLE )
+    , m_cmd( 0 )
+    , m_heaterCmd( CMD_HEATER_OFF )
+    , m_devAddress( i2cDevice7BitAddress )
+    , m_initialized( false )
+    , m_conversionPending( false )
+    , m_heaterPending( false )
+    , m_started( false )
+{
+}
+
+bool AsyncApi::start() noexcept
+{
+    // Skip processing if already started
+    if ( !m_started )
+    {
+        // Reset the device (the diagnostic check is done when the reset completes)
+        m_started           = true;
+        m_initialized       = false;
+        m_conversionPending = false;
+        m_sampleState       = eNOT_STARTED;
+        postCommand( eRESET, CMD_RESET, 0, 0 );
+        if ( m_step == eRESET )
+        {
+            return true;
+        }
+        m_started = false;
+    }
+
+    return false;
+}
+
+void AsyncApi::stop() noexcept
+{
+    m_queue.cancel( m_cmdTransaction );
+    m_queue.cancel( m_heaterTransaction );
+    m_step    = eIDLE;
+    m_started = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool AsyncApi::sample( float& rhOut, float& tempCOut ) noexcept
+{
+    // Blocking sampling is not supported
+    return false;
+}
+
+bool AsyncApi::setHeaterState( bool enabled ) noexcept
+{
+    // Note: If the heater command is already queued, the new value is used when the transaction executes
+    m_heaterCmd     = enabled ? CMD_HEATER_ON : CMD_HEATER_OFF;
+    m_heaterPending = true;
+    if ( m_started && !m_queue.isPending( m_heaterTransaction ) )
+    {
+        m_heaterTransaction.configure( m_devAddress, sizeof( m_heaterCmd ), &m_heaterCmd );
+        m_queue.post( m_heaterTransaction );
+    }
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+Driver::RHTemp::Api::SamplingState_T AsyncApi::startSample() noexcept
+{
+    // Fail if sampling is in progress
+    if ( !m_started || m_sampleState == eSAMPLING )
+    {
+        return eERROR;
+    }
+
+    // Retry a failed heater command
+    if ( m_heaterPending && !m_queue.isPending( m_heaterTransaction ) )
+    {
+        setHeaterState( m_heaterCmd == CMD_HEATER_ON );
+    }
+
+    m_sampleState = eSAMPLING;
+
+    // Reset sequence is in progress -->start the conversion when it completes
+    if ( m_step != eIDLE )
+    {
+        m_conversionPending = true;
+    }
+
+    // Re-try the reset sequence (i.e. the previous attempt failed)
+    else if ( !m_initialized )
+    {
+        m_conversionPending = true;
+        postCommand( eRESET, CMD_RESET, 0, 0 );
+    }
+
+    // Start the conversion
+    else
+    {
+        postCommand( eCONVERSION, CMD_CONVERSION, 0, 0 );
+    }
+
+    return m_sampleState;
+}
+
+Driver::RHTemp::Api::SamplingState_T AsyncApi::getSamplingState() noexcept
+{
+    return m_sampleState;
+}
+
+Driver::RHTemp::Api::SamplingState_T AsyncApi::getSample( float& rhOut, float& tempCOut ) noexcept
+{
+    if ( m_sampleState == eSAMPLE_READY )
+    {
+        rhOut    = m_rh;
+        tempCOut = m_temp;
+    }
+
+    return m_sampleState;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void AsyncApi::transactionCompleted( Driver::I2C::Transaction& transaction ) noexcept
+{
+    bool success = transaction.getResult() == Driver::I2C::Master::eSUCCESS;
+    if ( &transaction == &m_heaterTransaction )
+    {
+        m_heaterPending = !success;
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Set the heater state (%d). result=%d", m_heaterCmd == CMD_HEATER_ON, transaction.getResult()) );
+        return;
+    }
+
+    commandCompleted( success );
+}
+
+void AsyncApi::commandCompleted( bool success ) noexcept
+{
+    Step_T step = m_step;
+    m_step      = eIDLE;
+
+    switch ( step )
+    {
+    case eRESET:
+        if ( success )
+        {
+            postCommand( eDIAGNOSTIC, CMD_READ_DIAGNOSTIC, 2, WAIT_ON_RESET_MS );
+            return;
+        }
+        break;
+
+    case eDIAGNOSTIC:
+        if ( success && isDiagnosticOk( m_readBuffer ) )
+        {
+            m_initialized = true;
+            if ( m_conversionPending )
+            {
+                m_conversionPending = false;
+                postCommand( eCONVERSION, CMD_CONVERSION, 0, 0 );
+            }
+            return;
+        }
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("HUT31D Sensor failed its reset sequence (i2c addr=%02X)", m_devAddress) );
+        break;
+
+    case eCONVERSION:
+        if ( success )
+        {
+            postCommand( eREAD_RESULT, CMD_READ_RH_TEMP, sizeof( m_readBuffer ), MAX_CONVERSION_TIME_MS );
+            return;
+        }
+        break;
+
+    case eREAD_RESULT:
+        if ( success && parseConversionResult( m_readBuffer, m_rh, m_temp ) )
+        {
+            m_sampleState = eSAMPLE_READY;
+            return;
+        }
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Failed to Read Conversion result (i2c addr=%02X)", m_devAddress) );
+        break;
+
+    default:
+        return;
+    }
+
+    // If I get here, the command sequence failed
+    if ( step == eRESET || step == eDIAGNOSTIC )
+    {
+        m_initialized = false;
+    }
+    m_conversionPending = false;
+    if ( m_sampleState == eSAMPLING )
+    {
+        m_sampleState = eERROR;
+    }
+}
+
+void AsyncApi::postCommand( Step_T step, uint8_t cmd, size_t numBytesToRead, unsigned delayMs ) noexcept
+{
+    m_cmd  = cmd;
+    m_step = step;
+    m_cmdTransaction.configure( m_devAddress, sizeof( m_cmd ), &m_cmd, numBytesToRead, m_readBuffer, delayMs );
+
+    // Trap the queue not running
+    if ( !m_queue.post( m_cmdTransaction ) )
+    {
+        commandCompleted( false );
+    }
+}
@@ -0,0 +1,153 @@
+#ifndef Driver_RHTemp_HUT31D_AsyncApi_h_
+#define Driver_RHTemp_HUT31D_AsyncApi_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Driver/RHTemp/Api.h"
+#include "Driver/I2C/TransactionQueue.h"
+
+
+///
+namespace Driver {
+///
+namespace RHTemp {
+///
+namespace HUT31D {
+
+/** This class implements the RH/Temperature driver interface using a TE HUT31D
+    RH/T Sensor IC, where ALL I2C transfers are performed asynchronously via
+    a Driver::I2C::TransactionQueue.  None of the methods block, i.e. multiple
+    sensors can share a single I2C bus (and driver thread) without being
+    serialized behind each other's conversion times.
+
+    Differences from the blocking HUT31D driver:
+        o start() does NOT verify that the device is present.  The device
+          is reset and its diagnostic register is checked in the background.
+          A failure is reported via the eERROR sampling state.
+        o The blocking sample() method is NOT supported (it always returns
+          false).
+        o setHeaterState() queues the heater command and always returns
+          true.  A failed heater command is retried on the next call to
+          startSample().
+
+    The Application is RESPONSIBLE for starting/stopping the transaction
+    queue (and the underlying I2C driver) since they are shared resources.
+
+    The class is NOT thread safe.  The driver MUST execute in the same thread
+    as the transaction queue.
+ */
+class AsyncApi : public Driver::RHTemp::Api, public Driver::I2C::TransactionCallback
+{
+public:
+    /// Constructor
+    AsyncApi( Driver::I2C::TransactionQueue& i2cQueue, uint8_t i2cDevice7BitAddress );
+
+public:
+    /// See Driver::RHTemp::Api
+    bool start() noexcept;
+
+    /// See Driver::RHTemp::Api
+    void stop() noexcept;
+
+public:
+    /// See Driver::RHTemp::Api (NOT supported)
+    bool sample( float& rhOut, float& tempCOut ) noexcept;
+
+public:
+    /// See Driver::RHTemp::Api
+    bool setHeaterState( bool enabled ) noexcept;
+
+public:
+    /// See Driver::RHTemp::Api
+    SamplingState_T startSample() noexcept;
+
+    /// See Driver::RHTemp::Api
+    SamplingState_T getSamplingState() noexcept;
+
+    /// See Driver::RHTemp::Api
+    SamplingState_T getSample( float& rhOut, float& tempCOut ) noexcept;
+
+public:
+    /// See Driver::I2C::TransactionCallback
+    void transactionCompleted( Driver::I2C::Transaction& transaction ) noexcept;
+
+protected:
+    /// Command sequence steps
+    enum Step_T
+    {
+        eIDLE,              //!< No command transaction in progress
+        eRESET,             //!< Resetting the device
+        eDIAGNOSTIC,        //!< Reading the diagnostic register
+        eCONVERSION,        //!< Starting a conversion
+        eREAD_RESULT        //!< Reading the conversion result
+    };
+
+    /// Helper method: Posts the next command transaction
+    void postCommand( Step_T step, uint8_t cmd, size_t numBytesToRead, unsigned delayMs ) noexcept;
+
+    /// Helper method: Completion of a command transaction
+    void commandCompleted( bool success ) noexcept;
+
+protected:
+    /// Transaction queue for the I2C bus
+    Driver::I2C::TransactionQueue&  m_queue;
+
+    /// Command transaction (the device commands are sequential)
+    Driver::I2C::Transaction        m_cmdTransaction;
+
+    /// Heater transaction
+    Driver::I2C::Transaction        m_heaterTransaction;
+
+    /// Latest conversion results
+    float                           m_rh;
+
+    /// Latest conversion results
+    float                           m_temp;
+
+    /// Current Sampling state
+    SamplingState_T                 m_sampleState;
+
+    /// Current step of the command sequence
+    Step_T                          m_step;
+
+    /// Command byte
+    uint8_t                         m_cmd;
+
+    /// Heater command byte
+    uint8_t                         m_heaterCmd;
+
+    /// Read buffer
+    uint8_t                         m_readBuffer[6];
+
+    /// Device address of the sensor
+    uint8_t                         m_devAddress;
+
+    /// Device has been successfully reset
+    bool                            m_initialized;
+
+    /// A conversion is waiting for the reset sequence to complete
+    bool                            m_conversionPending;
+
+    /// The heater command needs to be (re)sent
+    bool                            m_heaterPending;
+
+    /// Started state
+    bool                            m_started;
+};
+
+} // End namespace(s)
+}
+}
+
+/*--------------------------------------------------------------------------*/
+#endif  // end header latch
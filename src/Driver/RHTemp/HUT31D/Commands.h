@@ -0,0 +1,119 @@
+#ifndef Driver_RHTemp_HUT31D_Commands_h_
+#define Driver_RHTemp_HUT31D_Commands_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file
+
+    This file contains the HUT31D command set and data conversion helpers that
+    are shared by the blocking and the asynchronous drivers.
+ */
+
+#include <stdint.h>
+
+///
+namespace Driver {
+///
+namespace RHTemp {
+///
+namespace HUT31D {
+
+/// Reset command
+static constexpr uint8_t    CMD_RESET               = 0x1E;
+
+/// Read diagnostic register command
+static constexpr uint8_t    CMD_READ_DIAGNOSTIC     = 0x08;
+
+/// Start conversion command (highest accuracy)
+static constexpr uint8_t    CMD_CONVERSION          = 0x40 | (0x0F << 1);
+
+/// Read RH and Temperature conversion results command
+static constexpr uint8_t    CMD_READ_RH_TEMP        = 0x00;
+
+/// Heater on command
+static constexpr uint8_t    CMD_HEATER_ON           = 0x04;
+
+/// Heater off command
+static constexpr uint8_t    CMD_HEATER_OFF          = 0x02;
+
+/// Conversion time (approximate double the time in the datasheet)
+static constexpr unsigned   MAX_CONVERSION_TIME_MS  = 50;
+
+/// Time to wait after a reset (approximate double the time in the datasheet)
+static constexpr unsigned   WAIT_ON_RESET_MS        = 10;
+
+
+/// Calculates the CRC for a 16 bit data value
+inline uint8_t crc( uint16_t value )
+{
+    uint32_t polynom = 0x988000; // x^8 + x^5 + x^4 + 1
+    uint32_t msb     = 0x800000;
+    uint32_t mask    = 0xFF8000;
+    uint32_t result  = (uint32_t) value << 8; // Pad with zeros as specified in spec
+
+    while ( msb != 0x80 )
+    {
+        // Check if msb of current value is 1 and apply XOR mask
+        if ( result & msb )
+        {
+            result = ((result ^ polynom) & mask) | (result & ~mask);
+        }
+
+        // Shift by one
+        msb >>= 1;
+        mask >>= 1;
+        polynom >>= 1;
+    }
+
+    return result;
+}
+
+/// Converts a raw RH value to % (0-100)
+inline float convertRH( uint16_t rawRH )
+{
+    return (rawRH / 65535.0) * 100;
+}
+
+/// Converts a raw Temperature value to degrees Centigrade
+inline float convertTemp( uint16_t rawTemp )
+{
+    return (rawTemp / 65535.0) * 165 - 40;
+}
+
+/** Validates and converts the 6 byte conversion result.  Returns false if
+    there is a CRC error
+ */
+inline bool parseConversionResult( const uint8_t data[6], float& rhOut, float& tempCOut )
+{
+    uint16_t rawTemp = ((uint16_t) (data[0]) << 8) | data[1];
+    uint16_t rawRh   = ((uint16_t) (data[3]) << 8) | data[4];
+    if ( crc( rawTemp ) != data[2] || crc( rawRh ) != data[5] )
+    {
+        return false;
+    }
+    rhOut    = convertRH( rawRh );
+    tempCOut = convertTemp( rawTemp );
+    return true;
+}
+
+/** Returns true if the diagnostic register is valid and does not report any
+    errors (The LSb is heater on/off state)
+ */
+inline bool isDiagnosticOk( const uint8_t data[2] )
+{
+    return crc( data[0] ) == data[1] && (data[0] & 0xFE) == 0x00;
+}
+
+} // End namespace(s)
+}
+}
+
+/*--------------------------------------------------------------------------*/
+#endif  // end header latch
@@ -17,6 +17,8 @@
 #include "Cpl/Type/Guid.h"
 #include "Fxt/Type/Error.h"
 #include "Cpl/Itc/PostApi.h"
+#include "Fxt/Card/BlockTransferPlan.h"
+#include "Fxt/Card/SoeBuffer.h"
 #include <stdint.h>
 
 
@@ -94,6 +96,26 @@ public:
      */
     virtual bool flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept = 0;
 
+    /** This method is used by the Chassis Card scanner to take ownership of
+        the block copies between the card's IO Register points and its virtual
+        points.  The card adds its input copy (IO Registers -> virtual points)
+        to 'inputPlan' and its output copy (virtual points -> IO Registers) to
+        'outputPlan'.  Once a copy has been delegated, the card's scanInputs()
+        and flushOutputs() methods no longer perform that copy, i.e. the
+        scanner executes 'inputPlan' AFTER calling scanInputs() on all of its
+        cards, and executes 'outputPlan' BEFORE calling flushOutputs() on all
+        of its cards.
+
+        The delegation is cleared when the card is stopped.  The method must
+        only be called after the card has been successfully started.
+
+        The method returns false if the card does NOT support delegating one
+        or both of its copies (e.g. when the copy must be performed inside
+        of a card specific critical section), in which case the card continues
+        to perform the copies that were not delegated.
+     */
+    virtual bool delegateBlockTransfers( BlockTransferPlan& inputPlan, BlockTransferPlan& outputPlan ) noexcept = 0;
+
 
 public:
     /** This method returns the card's GUID (that identifies its type) as a
@@ -113,6 +135,14 @@ public:
      */
     virtual Fxt::Type::Error getErrorCode() const noexcept = 0;
 
+public:
+    /** This method returns the card's sequence-of-events buffer.  A nullptr
+        is returned if the card does not support, or was not configured for,
+        sequence-of-events capture.  The Application is the consumer of the
+        buffer, i.e. it is responsible for draining the captured events.
+     */
+    virtual SoeBuffer* getSoeBuffer() noexcept = 0;
+
 public:
     /// Virtual destructor to make the compiler happy
     virtual ~Api() {}
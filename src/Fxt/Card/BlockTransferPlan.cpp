@@ -0,0 +1,105 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "BlockTransferPlan.h"
+#include <string.h>
+
+///
+using namespace Fxt::Card;
+
+//////////////////////////////////////////////////
+BlockTransferPlan::BlockTransferPlan( Cpl::Memory::ContiguousAllocator& generalAllocator, uint16_t maxTransfers ) noexcept
+    : m_transfers( nullptr )
+    , m_maxTransfers( maxTransfers )
+    , m_numTransfers( 0 )
+{
+    // Note: On an allocation failure, m_maxTransfers is left non-zero so that isValid() returns false
+    if ( maxTransfers > 0 )
+    {
+        m_transfers = (Transfer_T*) generalAllocator.allocate( sizeof( Transfer_T ) * maxTransfers );
+    }
+}
+
+//////////////////////////////////////////////////
+bool BlockTransferPlan::add( void* dst, const void* src, size_t len ) noexcept
+{
+    if ( len == 0 )
+    {
+        return true;
+    }
+    if ( m_transfers == nullptr || m_numTransfers >= m_maxTransfers )
+    {
+        return false;
+    }
+
+    m_transfers[m_numTransfers].dst = dst;
+    m_transfers[m_numTransfers].src = src;
+    m_transfers[m_numTransfers].len = len;
+    m_numTransfers++;
+    return true;
+}
+
+void BlockTransferPlan::optimize() noexcept
+{
+    // Sort by destination address (insertion sort - the number of cards in a scanner is small)
+    for ( uint16_t i=1; i < m_numTransfers; i++ )
+    {
+        Transfer_T item = m_transfers[i];
+        uint16_t   j    = i;
+        while ( j > 0 && ((uint8_t*) m_transfers[j - 1].dst) > ((uint8_t*) item.dst) )
+        {
+            m_transfers[j] = m_transfers[j - 1];
+            j--;
+        }
+        m_transfers[j] = item;
+    }
+
+    // Merge copies where BOTH the source and destination regions are contiguous
+    uint16_t dstIdx = 0;
+    for ( uint16_t i=1; i < m_numTransfers; i++ )
+    {
+        Transfer_T& prev = m_transfers[dstIdx];
+        Transfer_T& cur  = m_transfers[i];
+        if ( ((uint8_t*) prev.dst) + prev.len == ((uint8_t*) cur.dst) &&
+             ((const uint8_t*) prev.src) + prev.len == ((const uint8_t*) cur.src) )
+        {
+            prev.len += cur.len;
+        }
+        else
+        {
+            m_transfers[++dstIdx] = cur;
+        }
+    }
+    if ( m_numTransfers > 0 )
+    {
+        m_numTransfers = dstIdx + 1;
+    }
+}
+
+void BlockTransferPlan::execute() const noexcept
+{
+    for ( uint16_t i=0; i < m_numTransfers; i++ )
+    {
+        memcpy( m_transfers[i].dst, m_transfers[i].src, m_transfers[i].len );
+    }
+}
+
+size_t BlockTransferPlan::getTotalBytes() const noexcept
+{
+    size_t total = 0;
+    for ( uint16_t i=0; i < m_numTransfers; i++ )
+    {
+        total += m_transfers[i].len;
+    }
+    return total;
+}
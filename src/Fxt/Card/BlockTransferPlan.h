@@ -0,0 +1,98 @@
+#ifndef Fxt_Card_BlockTransferPlan_h_
+#define Fxt_Card_BlockTransferPlan_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/Memory/ContiguousAllocator.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+///
+namespace Fxt {
+///
+namespace Card {
+
+/** This concrete class is a list of 'block copies' (e.g. the IO Register
+    Points to Virtual Points transfers for a set of IO Cards) that are
+    executed as a single operation.  After all of the copies have been added,
+    the plan is optimized by merging copies whose source AND destination
+    memory regions are both contiguous, i.e. N adjacent card banks are
+    transferred with a single memcpy().
+
+    The plan does NOT support overlapping copies, i.e. the set of destination
+    regions must not overlap with the set of source regions.
+
+    Note: The class is NOT thread-safe.
+ */
+class BlockTransferPlan
+{
+public:
+    /// A single block copy
+    struct Transfer_T
+    {
+        void*       dst;    //!< Destination
+        const void* src;    //!< Source
+        size_t      len;    //!< Number of bytes to copy
+    };
+
+public:
+    /** Constructor.  The memory for the plan (i.e. 'maxTransfers' entries) is
+        allocated from 'generalAllocator'.  Use isValid() to determine if the
+        memory allocation was successful
+     */
+    BlockTransferPlan( Cpl::Memory::ContiguousAllocator& generalAllocator, uint16_t maxTransfers ) noexcept;
+
+public:
+    /// Returns true if the plan's memory was successfully allocated
+    inline bool isValid() const noexcept { return m_transfers != nullptr || m_maxTransfers == 0; }
+
+    /// Removes all transfers from the plan
+    inline void clear() noexcept { m_numTransfers = 0; }
+
+    /** Adds a block copy to the plan. Zero length copies are silently
+        discarded.  Returns false if the plan is full.
+     */
+    bool add( void* dst, const void* src, size_t len ) noexcept;
+
+    /** Sorts the plan by destination address and merges adjacent copies.
+        This method should be called once after all copies have been added.
+     */
+    void optimize() noexcept;
+
+    /// Executes the plan, i.e. performs all of the block copies
+    void execute() const noexcept;
+
+public:
+    /// Returns the current number of copies in the plan
+    inline uint16_t getNumTransfers() const noexcept { return m_numTransfers; }
+
+    /// Returns the copy at the specified index.  Returns nullptr if the index is out of range
+    inline const Transfer_T* getTransfer( uint16_t index ) const noexcept { return index < m_numTransfers ? &m_transfers[index] : nullptr; }
+
+    /// Returns the total number of bytes copied when the plan is executed
+    size_t getTotalBytes() const noexcept;
+
+protected:
+    /// Array of block copies
+    Transfer_T* m_transfers;
+
+    /// Maximum number of copies
+    uint16_t    m_maxTransfers;
+
+    /// Current number of copies
+    uint16_t    m_numTransfers;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -17,6 +17,7 @@
 #include "Fxt/Point/Api.h"
 #include "Fxt/Logging/Api.h"
 #include "Cpl/Itc/SyncReturnHandler.h"
+#include <string.h>
 
 #define SECT_   "Fxt::Card"
 
@@ -28,6 +29,7 @@ Common_::Common_( uint16_t maxInputChannels,
                   uint16_t maxOutputChannels )
     : m_inputIoRegisterPoints( nullptr )
     , m_outputIoRegisterPoints( nullptr )
+    , m_soe( nullptr )
     , m_error( Fxt::Type::Error::SUCCESS() )
     , m_numInputs( 0 )
     , m_numOutputs( 0 )
@@ -35,6 +37,8 @@ Common_::Common_( uint16_t maxInputChannels,
     , m_maxOutputs( maxOutputChannels )
     , m_slotNum( 0xFF )
     , m_started( false )
+    , m_inputTransferDelegated( false )
+    , m_outputTransferDelegated( false )
 {
     // All of the work is done in the child class
 }
@@ -93,7 +97,9 @@ bool Common_::start( uint64_t currentElapsedTimeUsec ) noexcept
 {
     if ( !m_started && m_error == Fxt::Type::Error::SUCCESS() )
     {
-        m_started = setInitialPointValues();
+        m_inputTransferDelegated  = false;
+        m_outputTransferDelegated = false;
+        m_started                 = setInitialPointValues();
         return m_started;
     }
     return false;
@@ -103,7 +109,9 @@ void Common_::stop() noexcept
 {
     if ( m_started )
     {
-        m_started = false;
+        m_started                 = false;
+        m_inputTransferDelegated  = false;
+        m_outputTransferDelegated = false;
     }
 }
 
@@ -123,15 +131,77 @@ uint8_t Common_::getSlotNumber() const noexcept
     return m_slotNum;
 }
 
+SoeBuffer* Common_::getSoeBuffer() noexcept
+{
+    return m_soe;
+}
+
+bool Common_::parseSoeConfig( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                              JsonVariant&                       cardObject ) noexcept
+{
+    // SOE capture is optional
+    JsonObject soeObj = cardObject["soe"];
+    if ( soeObj.isNull() )
+    {
+        return true;
+    }
+
+    unsigned depth = soeObj["depth"] | OPTION_FXT_CARD_SOE_DEFAULT_DEPTH;
+    if ( depth == 0 || depth > OPTION_FXT_CARD_SOE_MAX_DEPTH )
+    {
+        m_error = fullErr( Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. soe.depth=%u", getTypeName(), depth );
+        return false;
+    }
+
+    m_soe = SoeBuffer::create( generalAllocator, depth );
+    if ( m_soe == nullptr )
+    {
+        m_error = fullErr( Err_T::MEMORY_CARD );
+        m_error.logIt( "%s. soe", getTypeName() );
+        return false;
+    }
+
+    return true;
+}
+
 //////////////////////////////////////////////////
 bool Common_::scanInputs( uint64_t currentElapsedTimeUsec ) noexcept
 {
-    return m_virtualInputs.copyStatefulMemoryFrom( m_ioRegisterInputs );
+    // Nothing to do if the Scanner is performing the copy
+    return m_inputTransferDelegated || m_virtualInputs.copyStatefulMemoryFrom( m_ioRegisterInputs );
 }
 
 bool Common_::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
 {
-    return m_ioRegisterOutputs.copyStatefulMemoryFrom( m_virtualOutputs );
+    // Nothing to do if the Scanner is performing the copy
+    return m_outputTransferDelegated || m_ioRegisterOutputs.copyStatefulMemoryFrom( m_virtualOutputs );
+}
+
+bool Common_::delegateBlockTransfers( BlockTransferPlan& inputPlan, BlockTransferPlan& outputPlan ) noexcept
+{
+    if ( !m_started )
+    {
+        return false;
+    }
+
+    // Note: The Banks for the IO Registers and the Virtual Points are always the same size (when successfully created)
+    if ( !m_inputTransferDelegated &&
+         m_virtualInputs.getStatefulAllocatedSize() == m_ioRegisterInputs.getStatefulAllocatedSize() )
+    {
+        m_inputTransferDelegated = inputPlan.add( (void*) m_virtualInputs.getStartOfStatefulMemory(),
+                                                  m_ioRegisterInputs.getStartOfStatefulMemory(),
+                                                  m_ioRegisterInputs.getStatefulAllocatedSize() );
+    }
+    if ( !m_outputTransferDelegated &&
+         m_ioRegisterOutputs.getStatefulAllocatedSize() == m_virtualOutputs.getStatefulAllocatedSize() )
+    {
+        m_outputTransferDelegated = outputPlan.add( (void*) m_ioRegisterOutputs.getStartOfStatefulMemory(),
+                                                    m_virtualOutputs.getStartOfStatefulMemory(),
+                                                    m_virtualOutputs.getStatefulAllocatedSize() );
+    }
+
+    return m_inputTransferDelegated && m_outputTransferDelegated;
 }
 
 
@@ -320,6 +390,28 @@ uint16_t Common_::getChannelNumber( JsonObject& channelObject, uint16_t minChann
     return channelNum;
 }
 
+uint16_t Common_::countChannels( JsonVariant& cardObject, const char* direction, unsigned maxChannels ) noexcept
+{
+    size_t count = cardObject["points"][direction].size();
+    return (uint16_t) (count > maxChannels ? maxChannels + 1 : count);
+}
+
+const char* Common_::copyString( Cpl::Memory::ContiguousAllocator& allocator, const char* src ) noexcept
+{
+    if ( src == nullptr || *src == '\0' )
+    {
+        return nullptr;
+    }
+
+    size_t len = strlen( src ) + 1;
+    char*  dst = (char*) allocator.allocate( len );
+    if ( dst )
+    {
+        memcpy( dst, src, len );
+    }
+    return dst;
+}
+
 Fxt::Point::Api* Common_::createPointForChannel( Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
                                                  Fxt::Point::Bank&                  pointBank,
                                                  bool                               isIoRegPt,
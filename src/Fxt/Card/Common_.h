@@ -65,9 +65,15 @@ public:
     /// See Fxt::Card::Api
     bool flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept;
 
+    /// See Fxt::Card::Api
+    bool delegateBlockTransfers( BlockTransferPlan& inputPlan, BlockTransferPlan& outputPlan ) noexcept;
+
     /// See Fxt::Card::Api
     Fxt::Type::Error getErrorCode() const noexcept;
 
+    /// See Fxt::Card::Api
+    SoeBuffer* getSoeBuffer() noexcept;
+
 protected:
     /** Helper method that does an initial parsing of the input and output
         points.  Creates the Virtual and IO Register Points and populates
@@ -112,6 +118,35 @@ protected:
     /// Returns the channel for an point element.  Returns 0 if invalid channel# and sets m_error
     uint16_t getChannelNumber( JsonObject& channelObject, uint16_t minChannelNum, uint16_t maxChannelNum ) noexcept;
 
+    /** Helper method for cards with a configurable number of channels.  Returns
+        the number of elements in the card's "inputs" or "outputs" ('direction')
+        points array.  When the number of elements exceeds 'maxChannels', the
+        value 'maxChannels+1' is returned, i.e. parseInputOutputPoints() will
+        detect the too-many-points error when the returned value is used as the
+        maximum number of channels.
+     */
+    static uint16_t countChannels( JsonVariant& cardObject, const char* direction, unsigned maxChannels ) noexcept;
+
+    /** Helper method that parses the card's OPTIONAL sequence-of-events
+        configuration and creates the SOE buffer.  Returns false (and sets
+        m_error) when there is an error.  When the card object does not contain
+        a "soe" object, no buffer is created and true is returned.
+
+        \code
+        "soe": {                // OPTIONAL: Enables sequence-of-events capture for the card's inputs
+          "depth": 64           // OPTIONAL: Maximum number of buffered events. Range: 1 - OPTION_FXT_CARD_SOE_MAX_DEPTH
+        }
+        \endcode
+     */
+    bool parseSoeConfig( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                         JsonVariant&                       cardObject ) noexcept;
+
+    /** Helper method that copies a string (e.g. a JSON string value) into
+        memory from the allocator.  Returns nullptr if 'src' is null/empty or
+        out-of-memory.
+     */
+    static const char* copyString( Cpl::Memory::ContiguousAllocator& allocator, const char* src ) noexcept;
+
 
 protected:
     /// Bank for the Card's Input IO Register Points
@@ -132,6 +167,9 @@ protected:
     /// Array of OUTPUT IoRegister Point Pointers.  
     Fxt::Point::Api**                   m_outputIoRegisterPoints;
 
+    /// Sequence-of-events buffer (is nullptr when SOE capture is not enabled)
+    SoeBuffer*                          m_soe;
+
     /// Error state. A value of 0 indicates NO error
     Fxt::Type::Error                    m_error;
 
@@ -152,6 +190,12 @@ protected:
 
     /// My started state
     bool                                m_started;
+
+    /// Set to true when the Scanner performs the input IO Register -> Virtual Point copy
+    bool                                m_inputTransferDelegated;
+
+    /// Set to true when the Scanner performs the output Virtual Point -> IO Register copy
+    bool                                m_outputTransferDelegated;
 };
 
 
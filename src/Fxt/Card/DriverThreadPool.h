@@ -0,0 +1,154 @@
+#ifndef Fxt_Card_DriverThreadPool_h_
+#define Fxt_Card_DriverThreadPool_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Card/DriverThreadPoolApi.h"
+#include "Fxt/System/CpuAffinity.h"
+#include "Cpl/System/Thread.h"
+#include "Cpl/Text/FString.h"
+
+/// Maximum length (not including the null terminator) of a driver thread's name
+#ifndef OPTION_FXT_CARD_DRIVER_THREAD_NAME_MAX_LEN
+#define OPTION_FXT_CARD_DRIVER_THREAD_NAME_MAX_LEN      15
+#endif
+
+///
+namespace Fxt {
+///
+namespace Card {
+
+/** This template class implements a fixed size pool of driver threads. Each
+    thread is optionally pinned to a CPU core (see Fxt::System::CpuAffinity).
+    The thread names are '<baseName><index>', e.g. "FxtDrv0".
+
+    The application is responsible for starting the pool BEFORE the Node is
+    started and for stopping the pool AFTER the Node has been stopped.
+
+    Template Args:
+        N:=     Number of driver threads
+ */
+template<unsigned N>
+class DriverThreadPool : public DriverThreadPoolApi
+{
+public:
+    /// Value for the 'cpuCores' array that indicates the thread is NOT pinned to a core
+    static constexpr int NOT_PINNED = -1;
+
+public:
+    /// Constructor
+    DriverThreadPool( const char* baseName = "FxtDrv", int priority = CPL_SYSTEM_THREAD_PRIORITY_NORMAL ) noexcept
+        : m_baseName( baseName )
+        , m_priority( priority )
+    {
+        for ( unsigned i=0; i < N; i++ )
+        {
+            m_threads[i] = nullptr;
+        }
+    }
+
+    /// Destructor
+    ~DriverThreadPool()
+    {
+        stop();
+    }
+
+public:
+    /** This method creates the driver threads.  'cpuCores' is an optional
+        array (of N elements) of CPU core indexes to pin the individual threads
+        to (use NOT_PINNED for a thread that is not pinned).  Returns false if
+        one or more threads could not be created or pinned. Note: A failure
+        to pin a thread does NOT stop the thread from being created.
+     */
+    bool start( const int* cpuCores = nullptr ) noexcept
+    {
+        bool result = true;
+        for ( unsigned i=0; i < N; i++ )
+        {
+            if ( m_threads[i] == nullptr )
+            {
+                Cpl::Text::FString<OPTION_FXT_CARD_DRIVER_THREAD_NAME_MAX_LEN> name;
+                name.format( "%s%u", m_baseName, i );
+                m_threads[i] = Cpl::System::Thread::create( m_mailboxes[i], name, m_priority );
+                if ( m_threads[i] == nullptr )
+                {
+                    result = false;
+                    continue;
+                }
+            }
+
+            if ( cpuCores && cpuCores[i] != NOT_PINNED )
+            {
+                result &= Fxt::System::CpuAffinity::setThreadAffinity( *(m_threads[i]), (unsigned) cpuCores[i] );
+            }
+        }
+        return result;
+    }
+
+    /// This method stops and destroys the driver threads
+    void stop() noexcept
+    {
+        for ( unsigned i=0; i < N; i++ )
+        {
+            if ( m_threads[i] )
+            {
+                m_mailboxes[i].pleaseStop();
+            }
+        }
+        for ( unsigned i=0; i < N; i++ )
+        {
+            if ( m_threads[i] )
+            {
+                // Note: destroy() waits (briefly) for the thread to terminate
+                Cpl::System::Thread::destroy( *(m_threads[i]) );
+                m_threads[i] = nullptr;
+            }
+        }
+    }
+
+public:
+    /// See Fxt::Card::DriverThreadPoolApi
+    Cpl::Dm::MailboxServer* getDriverMailbox( unsigned threadIndex ) noexcept
+    {
+        return threadIndex < N ? &(m_mailboxes[threadIndex]) : nullptr;
+    }
+
+    /// See Fxt::Card::DriverThreadPoolApi
+    unsigned getNumDriverThreads() const noexcept
+    {
+        return N;
+    }
+
+    /// Returns the thread for the specified index (nullptr if the index is out of range or the pool has not been started)
+    Cpl::System::Thread* getDriverThread( unsigned threadIndex ) noexcept
+    {
+        return threadIndex < N ? m_threads[threadIndex] : nullptr;
+    }
+
+protected:
+    /// Mailboxes (aka event loops) for the driver threads
+    Cpl::Dm::MailboxServer  m_mailboxes[N];
+
+    /// Driver threads
+    Cpl::System::Thread*    m_threads[N];
+
+    /// Base name for the threads
+    const char*             m_baseName;
+
+    /// Thread priority
+    int                     m_priority;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
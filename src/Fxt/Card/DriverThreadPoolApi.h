@@ -0,0 +1,48 @@
+#ifndef Fxt_Card_DriverThreadPoolApi_h_
+#define Fxt_Card_DriverThreadPoolApi_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/Dm/MailboxServer.h"
+
+///
+namespace Fxt {
+///
+namespace Card {
+
+/** This abstract class defines the interface for a pool of 'driver threads'
+    that IO Cards can execute their low-level drivers in, i.e. the card
+    'executor' for a Node.  A card selects its driver thread via the
+    "driverThread" field in its JSON definition.  Distributing slow bus IO
+    (e.g. I2C, SPI) across multiple driver threads ensures that one card's
+    IO does not add latency to the chassis thread or to other cards.
+ */
+class DriverThreadPoolApi
+{
+public:
+    /** This method returns the mailbox (aka thread) for the specified driver
+        thread index.  Returns nullptr if 'threadIndex' is out of range.
+     */
+    virtual Cpl::Dm::MailboxServer* getDriverMailbox( unsigned threadIndex ) noexcept = 0;
+
+    /// This method returns the number of driver threads in the pool
+    virtual unsigned getNumDriverThreads() const noexcept = 0;
+
+public:
+    /// Virtual destructor
+    virtual ~DriverThreadPoolApi() {}
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -21,6 +21,18 @@ FactoryCommon_::FactoryCommon_( FactoryDatabaseApi&     factoryDatabase,
                                 Cpl::Dm::MailboxServer* cardMbox,
                                 void*                   extraArgs )
     : m_cardMbox( cardMbox )
+    , m_driverThreads( nullptr )
+    , m_extraArgs( extraArgs )
+{
+    // Auto register with factory database
+    factoryDatabase.put( *this );
+}
+
+FactoryCommon_::FactoryCommon_( FactoryDatabaseApi&     factoryDatabase,
+                                DriverThreadPoolApi&    driverThreads,
+                                void*                   extraArgs )
+    : m_cardMbox( nullptr )
+    , m_driverThreads( &driverThreads )
     , m_extraArgs( extraArgs )
 {
     // Auto register with factory database
@@ -41,8 +53,24 @@ void FactoryCommon_::destroy( Api& cardToDestory ) noexcept
 Fxt::Type::Error FactoryCommon_::allocateAndParse( JsonVariant&                       obj,
                                                    Cpl::Memory::ContiguousAllocator&  generalAllocator,
                                                    size_t                             cardSizeInBytes,
-                                                   void*&                             memoryForCard ) noexcept
+                                                   void*&                             memoryForCard,
+                                                   Cpl::Dm::MailboxServer*&           cardMbox ) noexcept
 {
+    // Select the card's driver thread
+    cardMbox = m_cardMbox;
+    if ( m_driverThreads )
+    {
+        unsigned threadIdx = obj["driverThread"] | 0U;
+        cardMbox           = m_driverThreads->getDriverMailbox( threadIdx );
+        if ( cardMbox == nullptr )
+        {
+            Fxt::Type::Error errcode = fullErr( Err_T::INVALID_FIELD );
+            errcode.logIt( "%s. driverThread=%u (max=%u)", getGuid(), threadIdx, m_driverThreads->getNumDriverThreads() );
+            memoryForCard = nullptr;
+            return errcode;
+        }
+    }
+
     // Allocate memory for the card
     memoryForCard = generalAllocator.allocate( cardSizeInBytes );
     if ( memoryForCard == nullptr )
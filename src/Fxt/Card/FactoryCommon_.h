@@ -18,6 +18,7 @@
 #include "Fxt/Card/Error.h"
 #include "Fxt/Point/DatabaseApi.h"
 #include "Cpl/Memory/ContiguousAllocator.h"
+#include "Fxt/Card/DriverThreadPoolApi.h"
 #include "Cpl/Dm/MailboxServer.h"
 
 ///
@@ -28,6 +29,11 @@ namespace Card {
 
 /** This partially concrete class provide common infrastructure for a Card
     Factory.
+
+    The card's mailbox (aka driver thread) is either a single mailbox shared
+    by all cards created by the factory - or - is selected per card from a
+    pool of driver threads using the card's "driverThread" JSON field (the
+    default is thread index 0).
  */
 class FactoryCommon_ : public Fxt::Card::FactoryApi
 {
@@ -37,6 +43,11 @@ public:
                     Cpl::Dm::MailboxServer* cardMbox = nullptr,
                     void*                   extraArgs = nullptr );
 
+    /// Constructor. Cards are assigned to a driver thread from the pool
+    FactoryCommon_( FactoryDatabaseApi&     factoryDatabase,
+                    DriverThreadPoolApi&    driverThreads,
+                    void*                   extraArgs = nullptr );
+
     /// Destructor
     ~FactoryCommon_();
 
@@ -53,7 +64,8 @@ protected:
     Fxt::Type::Error allocateAndParse( JsonVariant&                       obj,
                                        Cpl::Memory::ContiguousAllocator&  generalAllocator,
                                        size_t                             cardSizeInBytes,
-                                       void*&                             memoryForCard ) noexcept;
+                                       void*&                             memoryForCard,
+                                       Cpl::Dm::MailboxServer*&           cardMbox ) noexcept;
 protected:
     /** Optional pointer to the Card's mailbox (aka Thread).  The mailbox/thread
         is required when the Card needs to execute other than when scanInputs() 
@@ -61,6 +73,11 @@ protected:
      */
     Cpl::Dm::MailboxServer* m_cardMbox;
 
+    /** Optional pointer to a pool of driver threads.  When not null, the 
+        card's mailbox is selected from the pool (instead of using m_cardMbox)
+     */
+    DriverThreadPoolApi*    m_driverThreads;
+
     /** Optional pointer for additional card constructor arguments
      */
     void*                   m_extraArgs;
@@ -80,6 +97,13 @@ public:
     {
     }
 
+    /// Constructor. Cards are assigned to a driver thread from the pool
+    Factory( FactoryDatabaseApi&        factoryDatabase,
+             DriverThreadPoolApi&       driverThreads,
+             void*                      extraArgs=nullptr ) : FactoryCommon_( factoryDatabase, driverThreads, extraArgs )
+    {
+    }
+
 public:
     /// See Fxt::Card::FactoryApi
     const char* getGuid() const noexcept { return CARDTYPE::GUID_STRING; }
@@ -94,8 +118,9 @@ public:
                  Fxt::Point::DatabaseApi&           dbForPoints ) noexcept
     {
         //  Get basic info about the card
-        void* memCardInstance;
-        cardErrorCode = allocateAndParse( cardObject, generalAllocator, sizeof( CARDTYPE ), memCardInstance );
+        void*                   memCardInstance;
+        Cpl::Dm::MailboxServer* cardMbox;
+        cardErrorCode = allocateAndParse( cardObject, generalAllocator, sizeof( CARDTYPE ), memCardInstance, cardMbox );
         if ( cardErrorCode == Fxt::Type::Error::SUCCESS()  )
         {
             // Create the card
@@ -105,7 +130,7 @@ public:
                                                             pointFactoryDb,
                                                             dbForPoints,
                                                             cardObject,
-                                                            m_cardMbox,
+                                                            cardMbox,
                                                             m_extraArgs );
 
             cardErrorCode = card->getErrorCode();
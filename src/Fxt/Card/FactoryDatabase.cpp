@@ -13,6 +13,7 @@
 
 #include "FactoryDatabase.h"
 #include "Error.h"
+#include "Fxt/System/AllocTag.h"
 #include "Cpl/System/Assert.h"
 
 ///
@@ -55,6 +56,8 @@ Api* FactoryDatabase::createCardfromJSON( JsonVariant                        car
         return nullptr;
     }
 
+    // Charge the memory allocations to the sub-system
+    Fxt::System::AllocTag::ScopeBlock allocTag( Fxt::System::AllocTag::eCARDS );
     return factory->create( cardObj, cardErrorCode, generalAllocator, cardStatefulDataAllocator, haStatefulDataAllocator, pointFactoryDb, dbForPoints );
 }
 
@@ -14,10 +14,24 @@
 #include "Dio30.h"
 #include "Driver/DIO/RP2040/InOut30.h"
 #include "Cpl/System/Assert.h"
+#include "hardware/gpio.h"
+#include "pico/time.h"
 
 ///
 using namespace Fxt::Card::Gpio::RP2040;
 
+/// Card instance that is capturing the edges of each GPIO (there is only one GPIO interrupt callback per core)
+static Dio30* volatile soeOwners_[Dio30::MAX_INPUT_CHANNELS];
+
+static void gpioCallback( uint gpio, uint32_t events )
+{
+    Dio30* card = gpio < Dio30::MAX_INPUT_CHANNELS ? soeOwners_[gpio] : nullptr;
+    if ( card )
+    {
+        card->isrCaptureEdge( gpio, events );
+    }
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 Dio30::Dio30( Cpl::Memory::ContiguousAllocator&  generalAllocator,
@@ -117,6 +131,9 @@ void Dio30::parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAlloca
             }
         }
     }
+
+    // Parse the OPTIONAL sequence-of-events configuration
+    parseSoeConfig( generalAllocator, cardObject );
 }
 
 void Dio30::parseDriverConfig( JsonObject & channelObj, Driver::DIO::InOut::Config_T cfg[], size_t arrayIdx, uint16_t channelNum )
@@ -143,6 +160,18 @@ bool Dio30::start( Cpl::Itc::PostApi & chassisMbox, uint64_t currentElapsedTimeU
     // Call the parent's start-up actions (Note: sets the VPoint/IORegPoints initial values)
     if ( Common_::start( currentElapsedTimeUsec ) )
     {
+        // A GPIO can only be captured by one card
+        for ( unsigned i=0; m_soe && i < m_numInputs; i++ )
+        {
+            Dio30* owner = soeOwners_[m_driverInCfg[i].pin];
+            if ( owner != nullptr && owner != this )
+            {
+                m_error = Fxt::Card::fullErr( Fxt::Card::Err_T::BAD_CHANNEL_ASSIGNMENTS );
+                m_error.logIt( "%s. SOE pin=%u is captured by a different card", getTypeName(), m_driverInCfg[i].pin );
+                return false;
+            }
+        }
+
         // Start the low-level driver
         if ( !Driver::DIO::InOut::start( (uint8_t) m_numInputs, m_driverInCfg, (uint8_t) m_numOutputs, m_driverOutCfg ) )
         {
@@ -163,6 +192,16 @@ bool Dio30::start( Cpl::Itc::PostApi & chassisMbox, uint64_t currentElapsedTimeU
             }
         }
 
+        // Enable edge capture (Note: the owner is set BEFORE the interrupt is enabled)
+        if ( m_soe )
+        {
+            for ( unsigned i=0; i < m_numInputs; i++ )
+            {
+                soeOwners_[m_driverInCfg[i].pin] = this;
+                gpio_set_irq_enabled_with_callback( m_driverInCfg[i].pin, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true, gpioCallback );
+            }
+        }
+
         // If I get here -->everything worked            
         return true;
     }
@@ -175,6 +214,9 @@ bool Dio30::start( Cpl::Itc::PostApi & chassisMbox, uint64_t currentElapsedTimeU
 
 void Dio30::stop( Cpl::Itc::PostApi& chassisMbox ) noexcept
 {
+    // Disable edge capture
+    disableEdgeCapture();
+
     // Stop the driver
     Driver::DIO::InOut::stop();
 
@@ -245,3 +287,38 @@ bool Dio30::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Dio30::disableEdgeCapture() noexcept
+{
+    // Only release the pins that I own
+    for ( unsigned i=0; m_soe && i < m_numInputs; i++ )
+    {
+        if ( soeOwners_[m_driverInCfg[i].pin] == this )
+        {
+            gpio_set_irq_enabled( m_driverInCfg[i].pin, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, false );
+            soeOwners_[m_driverInCfg[i].pin] = nullptr;
+        }
+    }
+}
+
+void Dio30::isrCaptureEdge( unsigned gpio, uint32_t events ) noexcept
+{
+    uint64_t now     = time_us_64();
+    uint16_t channel = (uint16_t) (gpio + 1);   // Note: ChannelNum is one-based and the GPIO number is zero-based
+
+    // Both edges latched before the interrupt was serviced -->the first edge is the opposite of the current level
+    if ( (events & (GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL)) == (GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL) )
+    {
+        bool level = gpio_get( gpio );
+        m_soe->captureEdge( channel, !level, now );
+        m_soe->captureEdge( channel, level, now );
+    }
+    else if ( events & GPIO_IRQ_EDGE_RISE )
+    {
+        m_soe->captureEdge( channel, true, now );
+    }
+    else if ( events & GPIO_IRQ_EDGE_FALL )
+    {
+        m_soe->captureEdge( channel, false, now );
+    }
+}
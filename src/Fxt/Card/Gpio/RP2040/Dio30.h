@@ -35,6 +35,17 @@ namespace RP2040 {
     Note: The IO operations (aka the low level driver) for the card execute
           in the chassis thread.
 
+    When sequence-of-events capture is enabled, the card's input pins are
+    configured to generate an interrupt on every edge.  The edges are time
+    stamped (using the RP2040's microsecond timer) and captured in the card's
+    SOE buffer from the GPIO interrupt, i.e. edges between scans are NOT lost.
+    Note: The card takes over the core's GPIO interrupt callback, i.e. it
+          replaces any callback that the Application registered using
+          gpio_set_irq_callback() or gpio_set_irq_enabled_with_callback().
+          Multiple cards can capture edges, however a GPIO can only be
+          captured by one card (start() fails with BAD_CHANNEL_ASSIGNMENTS
+          when the pin is already captured by a different card).
+
     \code
 
     JSON Definition
@@ -45,6 +56,9 @@ namespace RP2040 {
       "type": "c896faf0-6ea2-47d6-a1a6-7e4074c32a43",       // Identifies the card type.  Value comes from the Supported/Available-card-list
       "typeName": "Fxt::Card::Gpio::RP2040::Dio30",         // *Human readable type name
       "slot": 0,                                            // Physical identifier, e.g. its the card position in the Node's physical chassis
+      "soe": {                                              // OPTIONAL: Enables sequence-of-events capture of the input edges (see Fxt::Card::SoeBuffer)
+        "depth": 64                                         // OPTIONAL: Maximum number of buffered events.
+      },
       "points": {
         "inputs": [                                         // OPTIONAL: Inputs. The card supports 30 input points that are exposed as individual Bool points
           {
@@ -139,8 +153,15 @@ public:
     /// See Fxt::Card::Api
     bool flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept;
 
+public:
+    /// Captures an input edge. This method is called from the GPIO interrupt and should NOT be called by the Application
+    void isrCaptureEdge( unsigned gpio, uint32_t events ) noexcept;
+
 
 protected:
+    /// Helper method that disables edge capture for the input pins owned by the card
+    void disableEdgeCapture() noexcept;
+
     /// Helper method to parse the card's JSON config
     void parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
                              Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
@@ -12,123 +12,91 @@
 *----------------------------------------------------------------------------*/
 /** @file */
 
-#include "Cpl/Dm/MailboxServer.h"
-#include "Fxt/Card/IoFlushRequest.h"
-#include "Cpl/Memory/Aligned.h"
-#include <new>
+#include "Fxt/Card/TripleBuffer.h"
 
 ///
 namespace Fxt {
 ///
 namespace Card {
 
-/** This partially concrete class provides boiler plate code for ITC IO Flush
-    calls.  The child class (aka the 'server') is responsible
-    for provide the actual request( xxx msg ) methods.
+/** This partially concrete template class provides boiler plate code for
+    transferring Output data from the chassis thread to a card's driver thread.
+    The transfer is done via a lock-free triple buffer, i.e. neither thread
+    blocks and no ITC messages (or semaphore signals) are used.  The driver
+    thread is responsible for polling for new data (e.g. in its sampling
+    timer).
+
+    The child class is responsible for providing the populate/extract methods.
+
+    Template Args:
+        OUTPUT_T:=  The card specific data structure that is transferred
  */
-class IoFlushAsync :
-    public IoFlushRequest,
-    public IoFlushResponse
+template<class OUTPUT_T>
+class IoFlushAsync
 {
 protected:
     /// Constructor
-    IoFlushAsync( Cpl::Dm::MailboxServer& driverMbox ) noexcept
-        : m_driverbox( driverMbox )
-        , m_chassisbox( nullptr )
-        , m_flushInProgress( false )
+    IoFlushAsync() noexcept
     {
     }
 
-
 protected:
-    /// This method should/must be called when the card is started
-    void start( Cpl::Itc::PostApi&   chassisMbox )
+    /** This method should/must be called when the card is started (i.e.
+        before the driver thread and the chassis thread access the transfer
+        buffer)
+     */
+    void start() noexcept
     {
-        m_chassisbox          = &chassisMbox;
-        m_chassisOutputSeqNum = 0;
-        m_driverOutputSeqNum  = 0;
+        m_outputsTransfer.reset();
     }
 
 protected:
-    /** Invokes an asynchronous ITC IoFlushRequest (executes in the Chassis thread)
-        The child class should ONLY (actually must) call this method when there is 
-        NEW output IO Register data available.
+    /** Publishes the current Output IO Register values (executes in the
+        chassis thread). This method is intended to be called from the card's
+        flushOutputs() method.
      */
-    bool issueAsyncIoFlushRequest( bool incrementChassisSeqNum = true ) noexcept
+    void publishOutputs() noexcept
     {
-        // Default operation is to update the source's sequence number
-        if ( incrementChassisSeqNum )
-        {
-            m_chassisOutputSeqNum++;
-        }
-
-        // Only allow one outstanding Flush request (and only send on change
-        if ( !m_flushInProgress && m_chassisOutputSeqNum != m_driverOutputSeqNum )
-        {
-            popuplateOutputsTransferBuffer();
-            IoFlushRequest::IoFlushPayload* payload = new(m_memoryIoFlushPayload.m_byteMem) IoFlushRequest::IoFlushPayload();
-            IoFlushResponse::IoFlushRspMsg* msg     = new(m_memoryIoFlushRspMsg.m_byteMem) IoFlushResponse::IoFlushRspMsg( *this, *m_chassisbox, *this, *payload );
-            m_flushInProgress                       = true;
-            m_driverOutputSeqNum                    = m_chassisOutputSeqNum;
-            m_driverbox.post( msg->getRequestMsg() );
-
-            return true;
-        }
-
-        return false;
+        populateOutputsTransferBuffer( m_outputsTransfer.getWriteBuffer() );
+        m_outputsTransfer.publish();
     }
 
     /** This populates the transfer buffer from the data stored in the Output
-        IO Registers.  The concrete card is required to implement this method
+        IO Registers (executes in the chassis thread). The concrete card is
+        required to implement this method
      */
-    virtual void popuplateOutputsTransferBuffer() noexcept = 0;
+    virtual void populateOutputsTransferBuffer( OUTPUT_T& dstTransferBuffer ) noexcept = 0;
 
-public:
-    // ITC Request to update the driver with card data. NOTE: executes in the driver thread
-    void request( IoFlushReqMsg& msg )
+protected:
+    /** Updates the driver's data store if there is new data from the chassis
+        (executes in the driver thread). Returns true if the driver's data
+        was updated.
+     */
+    bool extractOutputs() noexcept
     {
-        // Update the driver data
-        extractOutputsTransferBuffer();
-
-        // Complete the ITC transaction
-        msg.returnToSender();
+        if ( m_outputsTransfer.consume() )
+        {
+            extractOutputsTransferBuffer( m_outputsTransfer.getReadBuffer() );
+            return true;
+        }
+        return false;
     }
 
-    /** This populates the driver's data store from the output transfer buffer.  
-        The concrete card is required to implement this method
+    /** This populates the driver's data store from the output transfer buffer
+        (executes in the driver thread). The concrete card is required to
+        implement this method
      */
-    virtual void extractOutputsTransferBuffer() noexcept = 0;
+    virtual void extractOutputsTransferBuffer( const OUTPUT_T& srcTransferBuffer ) noexcept = 0;
 
-    // ITC Response: executes in the Chassis thread
-    void response( IoFlushRspMsg& msg )
+    /// Returns the sequence number of the last extracted Output data (zero if none)
+    uint32_t getOutputsSequenceNumber() const noexcept
     {
-        m_flushInProgress = false;
-
-        // Start of new transfer if there is newer data (but don't increment the sequence number)
-        issueAsyncIoFlushRequest( false );
+        return m_outputsTransfer.getReadSequenceNumber();
     }
 
 protected:
-    /// The driver thread's mailbox reference
-    Cpl::Dm::MailboxServer&  m_driverbox;
-
-    /// The Chassis/card thread's mailbox reference
-    Cpl::Itc::PostApi*       m_chassisbox;
-
-    /// Memory for IoFlush Message
-    Cpl::Memory::AlignedClass<IoFlushResponse::IoFlushRspMsg>  	m_memoryIoFlushRspMsg;
-
-    /// Memory for the IoFlush Message Payload
-    Cpl::Memory::AlignedClass<IoFlushRequest::IoFlushPayload>   m_memoryIoFlushPayload;
-
-    /// Chassis sequence number for Output transfers
-    uint16_t    m_chassisOutputSeqNum;
-
-    /// Sequence number at the time the ITC request was made
-    uint16_t    m_driverOutputSeqNum;
-
-    /// Flush in progress
-    bool        m_flushInProgress;
+    /// Transfer buffer
+    TripleBuffer<OUTPUT_T>  m_outputsTransfer;
 };
 
 
@@ -12,125 +12,92 @@
 *----------------------------------------------------------------------------*/
 /** @file */
 
-#include "Cpl/Dm/MailboxServer.h"
-#include "Fxt/Card/IoScanRequest.h"
-#include "Cpl/Memory/Aligned.h"
-#include <new>
+#include "Fxt/Card/TripleBuffer.h"
 
 ///
 namespace Fxt {
 ///
 namespace Card {
 
-/** This partially concrete class provides boiler plate code for ITC IO Scan
-    calls.  The child class (aka the 'server') is responsible
-    for provide the actual request( xxx msg ) methods.
+/** This partially concrete template class provides boiler plate code for
+    transferring Input data from a card's driver thread to the chassis thread.
+    The transfer is done via a lock-free triple buffer, i.e. neither thread
+    blocks and no ITC messages (or semaphore signals) are used.  When the
+    driver publishes faster than the chassis scans, the chassis always gets
+    the latest data.
+
+    The child class is responsible for providing the populate/extract methods.
+
+    Template Args:
+        INPUT_T:=   The card specific data structure that is transferred
  */
-class IoScanAsync : 
-    public IoScanRequest,
-    public IoScanResponse
+template<class INPUT_T>
+class IoScanAsync
 {
 protected:
     /// Constructor
-    IoScanAsync( Cpl::Dm::MailboxServer& driverMbox ) noexcept
-        : m_driverbox( driverMbox )
-        , m_chassisbox( nullptr )
-        , m_scanInProgress( false )
+    IoScanAsync() noexcept
     {
     }
 
 protected:
-    /// This method should/must be called when the card is started
-    void start( Cpl::Itc::PostApi&   chassisMbox )
+    /** This method should/must be called when the card is started (i.e. 
+        before the driver thread and the chassis thread access the transfer
+        buffer)
+     */
+    void start() noexcept
     {
-        m_chassisbox         = &chassisMbox;
-        m_chassisInputSeqNum = 0;
-        m_driverInputsSeqNum = 0; 
+        m_inputsTransfer.reset();
     }
 
 protected:
-    /** Invokes an asynchronous ITC IoScanRequest (executes in the driver thread)
-        The child class should ONLY (actually must) call this method when there is
-        NEW set of Input data available.
+    /** Publishes a new set of Input data (executes in the driver thread).
+        The child class should ONLY call this method when there is NEW set of
+        Input data available.
      */
-    bool issueAsyncIoScanRequest( bool incrementDriverSeqNum = true ) noexcept
+    void publishInputs() noexcept
     {
-        // Default operation is to update the source's sequence number
-        if ( incrementDriverSeqNum )
-        {
-            m_driverInputsSeqNum++;
-        }
-
-        // Only allow one outstanding Scan request (and only send on change)
-        if ( !m_scanInProgress && m_driverInputsSeqNum != m_chassisInputSeqNum )
-        {
-            populateInputsTransferBuffer();  
-            IoScanRequest::IoScanPayload* payload = new(m_memoryIoScanPayload.m_byteMem) IoScanRequest::IoScanPayload;
-            IoScanResponse::IoScanRspMsg* msg     = new(m_memoryIoScanRspMsg.m_byteMem) IoScanResponse::IoScanRspMsg( *this, m_driverbox, *this, *payload );
-            m_scanInProgress                      = true;
-            m_chassisInputSeqNum                  = m_driverInputsSeqNum;
-            m_chassisbox->post( msg->getRequestMsg() );
-
-            return true;
-        }
-
-        return false;
+        populateInputsTransferBuffer( m_inputsTransfer.getWriteBuffer() );
+        m_inputsTransfer.publish();
     }
 
     /** This populates the input transfer buffer from the driver's data store
-        The concrete card is required to implement this method
+        (executes in the driver thread). The concrete card is required to
+        implement this method
      */
-    virtual void populateInputsTransferBuffer() noexcept = 0;
+    virtual void populateInputsTransferBuffer( INPUT_T& dstTransferBuffer ) noexcept = 0;
 
-public:
-    // ITC Request to update the chassis/card with driver data. NOTE: executes in the chassis thread
-    void request( IoScanReqMsg& msg )
+protected:
+    /** Updates the card's INPUT IO Registers if there is new data from the
+        driver (executes in the chassis thread). Returns true if the IO
+        Registers were updated.  This method is intended to be called from
+        the card's scanInputs() method.
+     */
+    bool extractInputs() noexcept
     {
-        // Update the card data
-        extractInputsTransferBuffer();
-        //memcpy( m_chassisCachedData, m_transferData, m_dataLen );
-
-        // Complete the ITC transaction
-        msg.returnToSender();
+        if ( m_inputsTransfer.consume() )
+        {
+            extractInputsTransferBuffer( m_inputsTransfer.getReadBuffer() );
+            return true;
+        }
+        return false;
     }
 
-    /** This populates the chassis/card's INPUT IO Registers from the input 
-        transfer buffer.
-        The concrete card is required to implement this method
+    /** This populates the chassis/card's INPUT IO Registers from the input
+        transfer buffer (executes in the chassis thread).  The concrete card
+        is required to implement this method
      */
-    virtual void extractInputsTransferBuffer() noexcept = 0;
+    virtual void extractInputsTransferBuffer( const INPUT_T& srcTransferBuffer ) noexcept = 0;
 
-    // ITC Response: executes in the driver thread
-    void response( IoScanRspMsg& msg )
+    /// Returns the sequence number of the last extracted Input data (zero if none)
+    uint32_t getInputsSequenceNumber() const noexcept
     {
-        m_scanInProgress = false;
-
-        // Start of new transfer if there is newer data (but don't increment the sequence number)
-        issueAsyncIoScanRequest( false );
+        return m_inputsTransfer.getReadSequenceNumber();
     }
 
 protected:
-    /// The driver thread's mailbox reference
-    Cpl::Dm::MailboxServer&  m_driverbox;
-
-    /// The Chassis/card thread's mailbox reference
-    Cpl::Itc::PostApi*       m_chassisbox;
-
-    /// Memory for IoScan Message
-    Cpl::Memory::AlignedClass<IoScanResponse::IoScanRspMsg>   m_memoryIoScanRspMsg;
-
-    /// Memory for the IoScan Message Payload
-    Cpl::Memory::AlignedClass<IoScanRequest::IoScanPayload>   m_memoryIoScanPayload;
-
-
-    /// Chassis sequence number for Inputs transfers
-    uint16_t    m_chassisInputSeqNum;
-
-    /// Sequence number at the time the ITC request was made
-    uint16_t    m_driverInputsSeqNum;
-
-    /// Scan in progress
-    bool        m_scanInProgress;
+    /// Transfer buffer
+    TripleBuffer<INPUT_T>   m_inputsTransfer;
 };
 
 
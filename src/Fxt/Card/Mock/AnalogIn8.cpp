@@ -105,6 +105,12 @@ bool AnalogIn8::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
     return true;
 }
 
+bool AnalogIn8::delegateBlockTransfers( BlockTransferPlan& inputPlan, BlockTransferPlan& outputPlan ) noexcept
+{
+    // The IO Register copies MUST be done inside of my critical section (since my IO Registers are updated from a different thread)
+    return false;
+}
+
 const char* AnalogIn8::getTypeGuid() const noexcept
 {
     return GUID_STRING;
@@ -115,6 +115,9 @@ public:
     /// See Fxt::Card::Api
     bool flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept;
 
+    /// See Fxt::Card::Api
+    bool delegateBlockTransfers( BlockTransferPlan& inputPlan, BlockTransferPlan& outputPlan ) noexcept;
+
     /// See Fxt::Card::Api
     const char* getTypeGuid() const noexcept;
 
@@ -104,6 +104,12 @@ bool AnalogOut8::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
     return Common_::flushOutputs( currentElapsedTimeUsec );
 }
 
+bool AnalogOut8::delegateBlockTransfers( BlockTransferPlan& inputPlan, BlockTransferPlan& outputPlan ) noexcept
+{
+    // The IO Register copies MUST be done inside of my critical section (since my IO Registers are updated from a different thread)
+    return false;
+}
+
 const char* AnalogOut8::getTypeGuid() const noexcept
 {
     return GUID_STRING;
@@ -13,6 +13,7 @@
 
 #include "Digital8.h"
 #include "Cpl/System/Assert.h"
+#include "Fxt/System/ElapsedTime.h"
 #include <stdint.h>
 
 ///
@@ -68,6 +69,8 @@ void Digital8::parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAll
         return;
     }
 
+    // Parse the OPTIONAL sequence-of-events configuration
+    parseSoeConfig( generalAllocator, cardObject );
 }
 
 
@@ -99,6 +102,12 @@ bool Digital8::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
     return Common_::flushOutputs( currentElapsedTimeUsec );
 }
 
+bool Digital8::delegateBlockTransfers( BlockTransferPlan& inputPlan, BlockTransferPlan& outputPlan ) noexcept
+{
+    // The IO Register copies MUST be done inside of my critical section (since my IO Registers are updated from a different thread)
+    return false;
+}
+
 const char* Digital8::getTypeGuid() const noexcept
 {
     return GUID_STRING;
@@ -132,11 +141,7 @@ void Digital8::writeInput( uint8_t bitPosition, bool newValue )
 
     if ( m_numInputs > 0 )
     {
-        Fxt::Point::Bool* pt = (Fxt::Point::Bool*) m_inputIoRegisterPoints[bitPosition];
-        if ( pt )
-        {
-            pt->write( newValue );
-        }
+        updateInput( bitPosition, newValue );
     }
 }
 
@@ -164,11 +169,7 @@ void Digital8::setInputBit( uint8_t bitPosition )
 
     if ( m_numInputs > 0 )
     {
-        Fxt::Point::Bool* pt = (Fxt::Point::Bool*) m_inputIoRegisterPoints[bitPosition];
-        if ( pt )
-        {
-            pt->write( true );
-        }
+        updateInput( bitPosition, true );
     }
 }
 
@@ -196,11 +197,7 @@ void Digital8::clearInputBit( uint8_t bitPosition )
 
     if ( m_numInputs > 0 )
     {
-        Fxt::Point::Bool* pt = (Fxt::Point::Bool*) m_inputIoRegisterPoints[bitPosition];
-        if ( pt )
-        {
-            pt->write( false );
-        }
+        updateInput( bitPosition, false );
     }
 }
 
@@ -233,11 +230,30 @@ void Digital8::toggleInputBit( uint8_t bitPosition )
         {
             bool curVal = false;
             pt->read( curVal );
-            pt->write( !curVal );
+            updateInput( bitPosition, !curVal );
         }
     }
 }
 
+void Digital8::updateInput( uint8_t bitPosition, bool newValue ) noexcept
+{
+    Fxt::Point::Bool* pt = (Fxt::Point::Bool*) m_inputIoRegisterPoints[bitPosition];
+    if ( pt )
+    {
+        // Capture the change-of-state
+        if ( m_soe && m_started )
+        {
+            bool prevValue = false;
+            if ( !pt->read( prevValue ) || prevValue != newValue )
+            {
+                m_soe->captureEdge( bitPosition + 1, newValue, Fxt::System::ElapsedTime::now() );
+            }
+        }
+
+        pt->write( newValue );
+    }
+}
+
 
 bool Digital8::getInputs( uint8_t& dstInputVal )
 {
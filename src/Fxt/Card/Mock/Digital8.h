@@ -33,6 +33,12 @@ namespace Mock {
     ARE thread safe to allow the application/test/console to drive/access the
     inputs/outputs.
 
+    When sequence-of-events capture is enabled, every change-of-state of an
+    input that is made (while the card is started) by the set/write methods is
+    time stamped and captured in the card's SOE buffer, i.e. the thread that
+    drives the inputs is the producer of the SOE buffer.  The first valid value
+    of an input is also captured.
+
     The class dynamically creates numerous thingys and objects when it is created.
     This memory is allocated via a 'Contiguous Allocator'.  This means the this
     class will NOT free the allocated memory in its destructor, it WILL however
@@ -51,6 +57,9 @@ namespace Mock {
       "type": "59d33888-62c7-45b2-a4d4-9dbc55914ed3",       // Identifies the card type.  Value comes from the Supported/Available-card-list
       "typeName": "Fxt::Card::Mock::Digital8",              // *Human readable type name
       "slot": 0,                                            // Physical identifier, e.g. its the card position in the Node's physical chassis
+      "soe": {                                              // OPTIONAL: Enables sequence-of-events capture of the input edges (see Fxt::Card::SoeBuffer)
+        "depth": 64                                         // OPTIONAL: Maximum number of buffered events.
+      },
       "points": {
         "inputs": [                                         // OPTIONA: Inputs.
           {
@@ -137,6 +146,9 @@ public:
     /// See Fxt::Card::Api
     bool flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept;
 
+    /// See Fxt::Card::Api
+    bool delegateBlockTransfers( BlockTransferPlan& inputPlan, BlockTransferPlan& outputPlan ) noexcept;
+
     /// See Fxt::Card::Api
     const char* getTypeGuid() const noexcept;
 
@@ -209,6 +221,12 @@ protected:
                              JsonVariant&                       cardObject ) noexcept;
 
 
+    /** Helper method that updates a single input and captures the change-of-state
+        in the SOE buffer.  The caller is required to hold the mutex.
+     */
+    void updateInput( uint8_t bitPosition, bool newValue ) noexcept;
+
+
 protected:
     /// Mutex to provide thread safety for the application driving/reading the mocked IO
     Cpl::System::Mutex  m_lock;
@@ -0,0 +1,405 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "LoadGen.h"
+#include "Fxt/Point/Bool.h"
+#include "Cpl/System/Trace.h"
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#define SECT_   "Fxt::Card::Mock::LoadGen"
+
+///
+using namespace Fxt::Card::Mock;
+
+#define DEFAULT_PERIOD_MS       1000
+#define RANDOM_STEP_DIVISOR     100.0
+#define TWO_PI                  6.283185307179586
+
+
+///////////////////////////////////////////////////////////////////////////////
+LoadGen::LoadGen( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                  Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                  Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                  Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                  Fxt::Point::DatabaseApi&           dbForPoints,
+                  JsonVariant&                       cardObject,
+                  Cpl::Dm::MailboxServer*            cardMboxNotUsed,
+                  void*                              extraArgsNotUsed )
+    : Fxt::Card::Common_( countChannels( cardObject, "inputs", MAX_INPUTS ), countChannels( cardObject, "outputs", MAX_OUTPUTS ) )
+    , m_waveforms( nullptr )
+    , m_expects( nullptr )
+    , m_startTimeUsec( 0 )
+    , m_rngState( 1 )
+{
+    memset( &m_stats, 0, sizeof( m_stats ) );
+    if ( initialize( generalAllocator, cardObject ) )
+    {
+        parseConfiguration( generalAllocator, cardStatefulDataAllocator, haStatefulDataAllocator, pointFactoryDb, dbForPoints, cardObject );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LoadGen::parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                                  Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                                  Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                                  Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                                  Fxt::Point::DatabaseApi&           dbForPoints,
+                                  JsonVariant&                       cardObject ) noexcept
+{
+    // Parse/Create Virtual & IO Register points
+    if ( !parseInputOutputPoints( generalAllocator,
+                                  cardStatefulDataAllocator,
+                                  haStatefulDataAllocator,
+                                  pointFactoryDb,
+                                  dbForPoints,
+                                  cardObject,
+                                  true,
+                                  0, 0 ) )
+    {
+        return;
+    }
+    // Note: The parent class allows for one more than the maximum channels (see countChannels())
+    if ( m_numInputs > MAX_INPUTS || m_numOutputs > MAX_OUTPUTS )
+    {
+        m_error = fullErr( m_numInputs > MAX_INPUTS ? Err_T::TOO_MANY_INPUT_POINTS : Err_T::TOO_MANY_OUTPUT_POINTS );
+        m_error.logIt( getTypeName() );
+        return;
+    }
+
+    // Allocate the per-channel data
+    m_waveforms = (Waveform_T*) generalAllocator.allocate( sizeof( Waveform_T ) * (m_numInputs + 1) );
+    m_expects   = (Expect_T*) generalAllocator.allocate( sizeof( Expect_T ) * (m_numOutputs + 1) );
+    if ( m_waveforms == nullptr || m_expects == nullptr )
+    {
+        m_error = fullErr( Err_T::MEMORY_CARD );
+        m_error.logIt( getTypeName() );
+        return;
+    }
+    memset( m_expects, 0, sizeof( Expect_T ) * (m_numOutputs + 1) );
+
+    // Card level settings
+    m_rngState = cardObject["seed"] | 1;
+    if ( m_rngState == 0 )
+    {
+        m_rngState = 1;     // Zero is an invalid xorshift state
+    }
+    Waveform_T defaultWave;
+    JsonObject defaultWaveObj = cardObject["waveform"];
+    if ( !parseWaveform( defaultWaveObj, defaultWave ) )
+    {
+        return;
+    }
+
+    // Input waveforms
+    JsonArray inputs = cardObject["points"]["inputs"];
+    for ( unsigned idx=0; idx < m_numInputs; idx++ )
+    {
+        JsonObject  channelObj = inputs[idx];
+        uint16_t    channelNum = getChannelNumber( channelObj, 1, m_numInputs );
+        if ( channelNum == 0 )
+        {
+            return;
+        }
+
+        Waveform_T& wave    = m_waveforms[channelNum - 1];
+        JsonObject  waveObj = channelObj["waveform"];
+        wave                = defaultWave;
+        if ( !waveObj.isNull() && !parseWaveform( waveObj, wave ) )
+        {
+            return;
+        }
+
+        const char* guid = m_inputIoRegisterPoints[channelNum - 1]->getTypeGuid();
+        wave.intAttr     = Fxt::Point::NumericHandlers::getIntegerPointAttributes( guid );
+        wave.floatAttr   = Fxt::Point::NumericHandlers::getFloatPointAttributes( guid );
+        if ( wave.intAttr == nullptr && wave.floatAttr == nullptr && strcmp( guid, Fxt::Point::Bool::GUID_STRING ) != 0 )
+        {
+            m_error = fullErr( Err_T::POINT_WRONG_TYPE );
+            m_error.logIt( "%s. input channel=%u", getTypeName(), channelNum );
+            return;
+        }
+    }
+
+    // Output expectations
+    JsonArray outputs = cardObject["points"]["outputs"];
+    for ( unsigned idx=0; idx < m_numOutputs; idx++ )
+    {
+        JsonObject  channelObj = outputs[idx];
+        uint16_t    channelNum = getChannelNumber( channelObj, 1, m_numOutputs );
+        if ( channelNum == 0 )
+        {
+            return;
+        }
+
+        Expect_T&   expect = m_expects[channelNum - 1];
+        const char* guid   = m_outputIoRegisterPoints[channelNum - 1]->getTypeGuid();
+        expect.intAttr     = Fxt::Point::NumericHandlers::getIntegerPointAttributes( guid );
+        expect.floatAttr   = Fxt::Point::NumericHandlers::getFloatPointAttributes( guid );
+        if ( expect.intAttr == nullptr && expect.floatAttr == nullptr && strcmp( guid, Fxt::Point::Bool::GUID_STRING ) != 0 )
+        {
+            m_error = fullErr( Err_T::POINT_WRONG_TYPE );
+            m_error.logIt( "%s. output channel=%u", getTypeName(), channelNum );
+            return;
+        }
+
+        JsonObject expectObj = channelObj["expect"];
+        if ( !expectObj.isNull() )
+        {
+            unsigned inputChannel = expectObj["inputChannel"] | 0;
+            if ( inputChannel < 1 || inputChannel > m_numInputs )
+            {
+                m_error = fullErr( Err_T::INVALID_FIELD );
+                m_error.logIt( "%s. expect.inputChannel=%u", getTypeName(), inputChannel );
+                return;
+            }
+            expect.inputIdx  = (uint16_t) inputChannel;
+            expect.gain      = expectObj["gain"] | 1.0;
+            expect.offset    = expectObj["offset"] | 0.0;
+            expect.tolerance = expectObj["tolerance"] | 0.0;
+        }
+    }
+}
+
+bool LoadGen::parseWaveform( JsonObject& waveObj, Waveform_T& dst ) noexcept
+{
+    const char* shape = waveObj["shape"] | "ramp";
+    if ( strcmp( shape, "ramp" ) == 0 )
+    {
+        dst.shape = eRAMP;
+    }
+    else if ( strcmp( shape, "sine" ) == 0 )
+    {
+        dst.shape = eSINE;
+    }
+    else if ( strcmp( shape, "square" ) == 0 )
+    {
+        dst.shape = eSQUARE;
+    }
+    else if ( strcmp( shape, "random" ) == 0 )
+    {
+        dst.shape = eRANDOM;
+    }
+    else
+    {
+        m_error = fullErr( Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. waveform shape=%s", getTypeName(), shape );
+        return false;
+    }
+
+    dst.minVal          = waveObj["min"] | 0.0;
+    dst.maxVal          = waveObj["max"] | 1.0;
+    uint32_t periodMs   = waveObj["periodMs"] | DEFAULT_PERIOD_MS;
+    dst.step            = waveObj["step"] | ((dst.maxVal - dst.minVal) / RANDOM_STEP_DIVISOR);
+    if ( dst.maxVal < dst.minVal || periodMs == 0 || periodMs > UINT32_MAX / 1000 )
+    {
+        m_error = fullErr( Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. waveform min/max/periodMs", getTypeName() );
+        return false;
+    }
+    dst.periodUsec = periodMs * 1000;
+    dst.current    = (dst.minVal + dst.maxVal) / 2.0;
+    dst.intAttr    = nullptr;
+    dst.floatAttr  = nullptr;
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+bool LoadGen::start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Call the parent's start-up actions (Note: sets the VPoint/IORegPoints initial values)
+    if ( !Common_::start( currentElapsedTimeUsec ) )
+    {
+        return false;
+    }
+
+    // Restart the waveforms
+    m_startTimeUsec = currentElapsedTimeUsec;
+    for ( unsigned i=0; i < m_numInputs; i++ )
+    {
+        m_waveforms[i].current = (m_waveforms[i].minVal + m_waveforms[i].maxVal) / 2.0;
+    }
+    return true;
+}
+
+void LoadGen::stop( Cpl::Itc::PostApi& chassisMbox ) noexcept
+{
+    Common_::stop();
+}
+
+bool LoadGen::scanInputs( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Generate the new input values
+    uint64_t elapsedUsec = currentElapsedTimeUsec - m_startTimeUsec;
+    for ( unsigned i=0; i < m_numInputs; i++ )
+    {
+        Waveform_T&      wave  = m_waveforms[i];
+        Fxt::Point::Api* pt    = m_inputIoRegisterPoints[i];
+        double           value = generate( wave, elapsedUsec );
+        if ( wave.floatAttr )
+        {
+            (wave.floatAttr->writeFunc)(pt, value);
+        }
+        else if ( wave.intAttr )
+        {
+            (wave.intAttr->writeFunc)(pt, (uint64_t) ((int64_t) llround( value )));
+        }
+        else
+        {
+            ((Fxt::Point::Bool*) pt)->write( value >= (wave.minVal + wave.maxVal) / 2.0 );
+        }
+    }
+
+    // Update my stats
+    {
+        Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+        m_stats.scanCount++;
+    }
+
+    return Common_::scanInputs( currentElapsedTimeUsec );
+}
+
+bool LoadGen::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Call parent class to manage the transfer between IO Registers and Virtual Points
+    if ( !Common_::flushOutputs( currentElapsedTimeUsec ) )
+    {
+        return false;
+    }
+
+    // Verify the outputs
+    uint32_t verified     = 0;
+    uint32_t mismatches   = 0;
+    uint16_t lastMismatch = 0;
+    for ( unsigned i=0; i < m_numOutputs; i++ )
+    {
+        Expect_T& expect = m_expects[i];
+        if ( expect.inputIdx == 0 )
+        {
+            continue;
+        }
+
+        double      inVal;
+        double      outVal;
+        Waveform_T& wave = m_waveforms[expect.inputIdx - 1];
+        verified++;
+        if ( !readPoint( m_inputIoRegisterPoints[expect.inputIdx - 1], wave.intAttr, wave.floatAttr, inVal ) ||
+             !readPoint( m_outputIoRegisterPoints[i], expect.intAttr, expect.floatAttr, outVal ) ||
+             fabs( outVal - (expect.gain * inVal + expect.offset) ) > expect.tolerance )
+        {
+            mismatches++;
+            lastMismatch = (uint16_t) (i + 1);
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("Mismatch: output channel=%u", i + 1) );
+        }
+    }
+
+    // Update my stats
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    m_stats.flushCount++;
+    m_stats.verifyCount   += verified;
+    m_stats.mismatchCount += mismatches;
+    if ( lastMismatch )
+    {
+        m_stats.lastMismatchChannel = lastMismatch;
+    }
+    return true;
+}
+
+const char* LoadGen::getTypeGuid() const noexcept
+{
+    return GUID_STRING;
+}
+
+const char* LoadGen::getTypeName() const noexcept
+{
+    return TYPE_NAME;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LoadGen::getStatistics( Stats_T& dst ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    dst = m_stats;
+}
+
+void LoadGen::clearStatistics() noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    memset( &m_stats, 0, sizeof( m_stats ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double LoadGen::generate( Waveform_T& wave, uint64_t elapsedUsec ) noexcept
+{
+    double range = wave.maxVal - wave.minVal;
+    double phase = ((double) (elapsedUsec % wave.periodUsec)) / ((double) wave.periodUsec);
+    switch ( wave.shape )
+    {
+    case eRAMP:
+        return wave.minVal + range * phase;
+
+    case eSINE:
+        return wave.minVal + range * (0.5 + 0.5 * sin( TWO_PI * phase ));
+
+    case eSQUARE:
+        return phase < 0.5 ? wave.maxVal : wave.minVal;
+
+    default:    // eRANDOM
+        wave.current += wave.step * nextRandom();
+        if ( wave.current > wave.maxVal )
+        {
+            wave.current = wave.maxVal;
+        }
+        else if ( wave.current < wave.minVal )
+        {
+            wave.current = wave.minVal;
+        }
+        return wave.current;
+    }
+}
+
+double LoadGen::nextRandom() noexcept
+{
+    // xorshift32
+    m_rngState ^= m_rngState << 13;
+    m_rngState ^= m_rngState >> 17;
+    m_rngState ^= m_rngState << 5;
+    return (((double) m_rngState) / ((double) UINT32_MAX)) * 2.0 - 1.0;
+}
+
+bool LoadGen::readPoint( Fxt::Point::Api*                                        pt,
+                         const Fxt::Point::NumericHandlers::IntegerAttributes_T* intAttr,
+                         const Fxt::Point::NumericHandlers::FloatAttributes_T*   floatAttr,
+                         double&                                                 dstValue ) noexcept
+{
+    if ( floatAttr )
+    {
+        return (floatAttr->readFunc)(pt, dstValue);
+    }
+
+    if ( intAttr )
+    {
+        // Note: The read functions sign extend signed integers
+        uint64_t raw;
+        bool     valid = (intAttr->readFunc)(pt, raw);
+        dstValue       = intAttr->isSigned ? (double) ((int64_t) raw) : (double) raw;
+        return valid;
+    }
+
+    bool bitVal;
+    bool valid = ((Fxt::Point::Bool*) pt)->read( bitVal );
+    dstValue   = bitVal ? 1.0 : 0.0;
+    return valid;
+}
@@ -0,0 +1,266 @@
+#ifndef Fxt_Card_Mock_LoadGen_h_
+#define Fxt_Card_Mock_LoadGen_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Card/Common_.h"
+#include "Fxt/Point/NumericHandlers.h"
+#include "Cpl/Json/Arduino.h"
+#include "Cpl/System/Mutex.h"
+#include "Cpl/Dm/MailboxServer.h"
+
+
+/** Maximum number of input channels (and separately output channels) that
+    a single LoadGen card supports
+ */
+#ifndef OPTION_FXT_CARD_MOCK_LOADGEN_MAX_CHANNELS
+#define OPTION_FXT_CARD_MOCK_LOADGEN_MAX_CHANNELS       4096
+#endif
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Mock {
+
+
+/** This concrete class implements a mocked/emulated IO card with a
+    configurable (large) number of channels that is intended to be used as
+    a load generator for benchmarking a Chassis.
+
+    The card's inputs can be any mix of numeric Point types and Bool points.
+    Every time the inputs are scanned, the card generates a new value for
+    each input channel from the channel's waveform (ramp, sine, square, or
+    random walk).  For a Bool input, the generated value is true when it is
+    greater than or equal to the mid-point of the waveform's range.
+
+    Every time the outputs are flushed, the card verifies each output channel
+    that has an 'expect' clause against the current value of an input channel,
+    i.e. expected := gain * input + offset.  A mismatch is counted (and
+    traced) when the difference exceeds the tolerance OR when the output is
+    invalid. The verification results are available via getStatistics().
+
+    The waveforms are generated in the Chassis thread (i.e. scanInputs()), so
+    there is no critical section around the IO Register transfers.  Only the
+    statistics are protected by a mutex (they are updated once per
+    scan/flush).
+
+    The class dynamically creates numerous thingys and objects when it is created.
+    This memory is allocated via a 'Contiguous Allocator'.  This means the this
+    class will NOT free the allocated memory in its destructor, it WILL however
+    call the destructor on any objects it directly created using the allocator.
+    The semantics with the Application is that the Application is RESPONSIBLE for
+    freeing/recycling the memory in the Contiguous Allocator when Card(s) are
+    deleted.
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+      "name": "My LoadGen Card",                            // *Text label for the card
+      "id": 0,                                              // *ID assigned to the card
+      "type": "7d0addb6-d1af-4f94-b440-904dd817cfcd",       // Identifies the card type.  Value comes from the Supported/Available-card-list
+      "typeName": "Fxt::Card::Mock::LoadGen",               // *Human readable type name
+      "slot": 0,                                            // Physical identifier, e.g. its the card position in the Node's physical chassis
+      "seed": 1,                                            // OPTIONAL: Seed for the random walk waveforms. Default is 1
+      "waveform": {                                         // OPTIONAL: Default waveform for input channels that do not specify a waveform
+        "shape": "ramp"|"sine"|"square"|"random",           // Waveform shape
+        "min": <numeric>,                                   // OPTIONAL: Minimum value. Default is 0
+        "max": <numeric>,                                   // OPTIONAL: Maximum value. Default is 1
+        "periodMs": <integer>,                              // OPTIONAL: Period in milliseconds (not used for 'random'). Default is 1000
+        "step": <numeric>                                   // OPTIONAL: Maximum step size per scan for 'random'. Default is (max-min)/100
+      },
+      "points": {
+        "inputs": [                                         // Inputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // Range: 1 to number of inputs
+            "id": 0,                                        // ID assigned to the Virtual Point that represents the input value
+            "ioRegId": 1,                                   // The ID of the Point's IO register.
+            "name": "My input#1 name"                       // *Text label for the input signal
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signal. Any numeric type or Bool
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the input signal
+            "waveform": { ... }                             // OPTIONAL: Same syntax as the card level "waveform"
+          }
+        ],
+        "outputs": [                                        // Outputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // Range: 1 to number of outputs
+            "id": 10,                                       // ID assigned to the Virtual Point that represents the output value
+            "ioRegId": 11,                                  // The ID of the Point's IO register.
+            "name": "My output#1 name"                      // *Text label for the output signal
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the output signal. Any numeric type or Bool
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the output signal
+            "expect": {                                     // OPTIONAL: Verify the output value
+              "inputChannel": 1,                            // Input channel that the output is compared against
+              "gain": 1.0,                                  // OPTIONAL: Default is 1
+              "offset": 0.0,                                // OPTIONAL: Default is 0
+              "tolerance": 0.0                              // OPTIONAL: Default is 0
+            }
+          }
+        ]
+      }
+    }
+
+    *The field is NOT parsed/used by the firmware
+
+    \endcode
+ */
+class LoadGen : public Fxt::Card::Common_
+{
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "7d0addb6-d1af-4f94-b440-904dd817cfcd";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Card::Mock::LoadGen";
+
+    /// Maximum number of input channels
+    static constexpr unsigned       MAX_INPUTS  = OPTION_FXT_CARD_MOCK_LOADGEN_MAX_CHANNELS;
+
+    /// Maximum number of output channels
+    static constexpr unsigned       MAX_OUTPUTS = OPTION_FXT_CARD_MOCK_LOADGEN_MAX_CHANNELS;
+
+public:
+    /// Waveform shapes
+    enum Shape_T
+    {
+        eRAMP = 0,      //!< Saw tooth from min to max
+        eSINE,          //!< Sine wave centered between min and max
+        eSQUARE,        //!< 50% duty cycle: max then min
+        eRANDOM         //!< Random walk bounded by min and max
+    };
+
+    /// Verification statistics
+    struct Stats_T
+    {
+        uint32_t scanCount;             //!< Number of times the inputs have been generated
+        uint32_t flushCount;            //!< Number of times the outputs have been verified
+        uint32_t verifyCount;           //!< Total number of output values verified
+        uint32_t mismatchCount;         //!< Total number of output values that did not match the expected value
+        uint16_t lastMismatchChannel;   //!< Output channel number of the most recent mismatch (0 when there has been no mismatch)
+    };
+
+public:
+    /// Constructor
+    LoadGen( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+             Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+             Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+             Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+             Fxt::Point::DatabaseApi&           dbForPoints,
+             JsonVariant&                       cardObject,
+             Cpl::Dm::MailboxServer*            cardMboxNotUsed = nullptr,
+             void*                              extraArgsNotUsed = nullptr );
+
+public:
+    /// See Fxt::Card::Api
+    bool start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    void stop( Cpl::Itc::PostApi& chassisMbox ) noexcept;
+
+    /// See Fxt::Card::Api
+    bool scanInputs( uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    bool flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    const char* getTypeGuid() const noexcept;
+
+    /// See Fxt::Card::Api
+    const char* getTypeName() const noexcept;
+
+public:
+    /// Returns (via the argument list) the current verification statistics.  This method is thread safe
+    void getStatistics( Stats_T& dst ) noexcept;
+
+    /// Clears the verification statistics.  This method is thread safe
+    void clearStatistics() noexcept;
+
+protected:
+    /// Per input channel waveform
+    struct Waveform_T
+    {
+        const Fxt::Point::NumericHandlers::IntegerAttributes_T* intAttr;    //!< Integer attributes (nullptr if not an integer point)
+        const Fxt::Point::NumericHandlers::FloatAttributes_T*   floatAttr;  //!< Float attributes (nullptr if not a float point)
+        double                                                  minVal;     //!< Minimum value
+        double                                                  maxVal;     //!< Maximum value
+        double                                                  step;       //!< Random walk step size
+        double                                                  current;    //!< Current random walk value
+        uint32_t                                                periodUsec; //!< Period
+        uint8_t                                                 shape;      //!< Shape_T
+    };
+
+    /// Per output channel expectation
+    struct Expect_T
+    {
+        const Fxt::Point::NumericHandlers::IntegerAttributes_T* intAttr;    //!< Integer attributes (nullptr if not an integer point)
+        const Fxt::Point::NumericHandlers::FloatAttributes_T*   floatAttr;  //!< Float attributes (nullptr if not a float point)
+        double                                                  gain;       //!< Gain
+        double                                                  offset;     //!< Offset
+        double                                                  tolerance;  //!< Allowed difference
+        uint16_t                                                inputIdx;   //!< Index of the input channel (0 when not verified)
+    };
+
+protected:
+    /// Helper method to parse the card's JSON config
+    void parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                             Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                             Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                             Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                             Fxt::Point::DatabaseApi&           dbForPoints,
+                             JsonVariant&                       cardObject ) noexcept;
+
+    /// Helper method that parses a waveform object. Returns false if the JSON is bad
+    bool parseWaveform( JsonObject& waveObj, Waveform_T& dst ) noexcept;
+
+    /// Helper method that generates the next value for a waveform
+    double generate( Waveform_T& wave, uint64_t elapsedUsec ) noexcept;
+
+    /// Helper method that reads a point as a double. Returns false if the point is invalid
+    static bool readPoint( Fxt::Point::Api*                                        pt,
+                           const Fxt::Point::NumericHandlers::IntegerAttributes_T* intAttr,
+                           const Fxt::Point::NumericHandlers::FloatAttributes_T*   floatAttr,
+                           double&                                                 dstValue ) noexcept;
+
+    /// Helper method that returns a pseudo random number in the range [-1.0, 1.0]
+    double nextRandom() noexcept;
+
+protected:
+    /// Mutex to provide thread safety for the statistics
+    Cpl::System::Mutex  m_lock;
+
+    /// Current statistics
+    Stats_T             m_stats;
+
+    /// Input waveforms (indexed by channel number - 1)
+    Waveform_T*         m_waveforms;
+
+    /// Output expectations (indexed by channel number - 1)
+    Expect_T*           m_expects;
+
+    /// Elapsed time when the card was started
+    uint64_t            m_startTimeUsec;
+
+    /// Random number generator state
+    uint32_t            m_rngState;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
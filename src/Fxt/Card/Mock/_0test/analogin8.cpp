@@ -19,6 +19,7 @@
 #include "Cpl/Math/real.h"
 #include "Fxt/Point/FactoryDatabase.h"
 #include "Fxt/Point/Factory.h"
+#include "Cpl/Dm/MailboxServer.h"
 #include <string.h>
 
 #define SECT_   "_0test"
@@ -96,6 +97,7 @@ TEST_CASE( "AnalogIn8" )
     Fxt::Point::Database<MAX_POINTS>                   pointDb;
     Fxt::Point::FactoryDatabase                        pointFactoryDb;
     Fxt::Point::Factory<Fxt::Point::Float>             factoryFloat( pointFactoryDb );
+    Cpl::Dm::MailboxServer                             chassisMbox;
     Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> errText;
 
     SECTION( "create card" )
@@ -147,7 +149,7 @@ TEST_CASE( "AnalogIn8" )
         pointPtr->setInvalid();
 
         REQUIRE( uut.isStarted() == false );
-        REQUIRE( uut.start( 0LL ) );
+        REQUIRE( uut.start( chassisMbox, 0LL ) );
         REQUIRE( uut.isStarted() );
 
         pointPtr = (Fxt::Point::Float*) pointDb.lookupById( 2 );
@@ -220,7 +222,7 @@ TEST_CASE( "AnalogIn8" )
         REQUIRE( pointPtr->isNotValid() );
 
 
-        uut.stop();
+        uut.stop( chassisMbox );
         REQUIRE( uut.isStarted() == false );
     }
 
@@ -240,7 +242,7 @@ TEST_CASE( "AnalogIn8" )
 
         REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS()  );
 
-        REQUIRE( uut.start( 0LL ) );
+        REQUIRE( uut.start( chassisMbox, 0LL ) );
 
         uut.setInput( 1, 22.2F );
         uut.setInput( 2, 2 );
@@ -15,6 +15,7 @@
 #include "Fxt/Point/Database.h"
 #include "Fxt/Point/FactoryDatabase.h"
 #include "Fxt/Point/Factory.h"
+#include "Cpl/Dm/MailboxServer.h"
 #include "Fxt/Point/Uint8.h"
 #include "Cpl/Memory/LeanHeap.h"
 #include "Cpl/System/Trace.h"
@@ -84,6 +85,7 @@ TEST_CASE( "Digital8" )
     Fxt::Point::Database<MAX_POINTS>                   pointDb;
     Fxt::Point::FactoryDatabase                        pointFactoryDb;
     Fxt::Point::Factory<Fxt::Point::Uint8>             factoryFloat( pointFactoryDb );
+    Cpl::Dm::MailboxServer                             chassisMbox;
     Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> errText;
 
     SECTION( "create card" )
@@ -126,7 +128,7 @@ TEST_CASE( "Digital8" )
 
 
         REQUIRE( uut.isStarted() == false );
-        REQUIRE( uut.start( 0LL ) );
+        REQUIRE( uut.start( chassisMbox, 0LL ) );
         REQUIRE( uut.isStarted() );
 
         pointPtr = (Fxt::Point::Uint8*) pointDb.lookupById( 2 );
@@ -164,7 +166,7 @@ TEST_CASE( "Digital8" )
         pointPtr = (Fxt::Point::Uint8*) pointDb.lookupById( 4 );
         REQUIRE( pointPtr->isNotValid() );
 
-        uut.stop();
+        uut.stop( chassisMbox );
         REQUIRE( uut.isStarted() == false );
     }
 
@@ -184,7 +186,7 @@ TEST_CASE( "Digital8" )
                       cardObj );
 
         REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS()  );
-        REQUIRE( uut.start( 0LL ) );
+        REQUIRE( uut.start( chassisMbox, 0LL ) );
 
         uut.setInputBit( 1 );
         Fxt::Point::Uint8* pointPtr   = (Fxt::Point::Uint8*) pointDb.lookupById( 2 );
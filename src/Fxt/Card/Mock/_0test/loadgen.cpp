@@ -0,0 +1,218 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Card/Mock/LoadGen.h"
+#include "Fxt/Point/Bool.h"
+#include "Fxt/Point/Float.h"
+#include "Fxt/Point/Int32.h"
+#include "Fxt/Point/Database.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/System/Trace.h"
+#include "Cpl/Math/real.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Factory.h"
+#include "Cpl/Dm/MailboxServer.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+///
+using namespace Fxt::Card::Mock;
+
+
+#define CARD_DEFINTION(shape,inCh)  "{" \
+                                    "  \"name\": \"bob\"," \
+                                    "  \"type\": \"7d0addb6-d1af-4f94-b440-904dd817cfcd\"," \
+                                    "  \"slot\": 1," \
+                                    "  \"waveform\": { \"shape\": \"square\", \"min\": 0, \"max\": 100, \"periodMs\": 1000 }," \
+                                    "  \"points\": {" \
+                                    "    \"inputs\": [" \
+                                    "      { \"channel\": 1, \"id\": 1, \"ioRegId\": 2, \"type\": \"708745fa-cef6-4364-abad-063a40f35cbc\"," \
+                                    "        \"waveform\": { \"shape\": \"" shape "\", \"min\": 0, \"max\": 10, \"periodMs\": 1000 } }," \
+                                    "      { \"channel\": 2, \"id\": 3, \"ioRegId\": 4, \"type\": \"c357de9a-a10b-4c87-83b9-ed230135752d\" }," \
+                                    "      { \"channel\": 3, \"id\": 5, \"ioRegId\": 6, \"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\" }" \
+                                    "    ]," \
+                                    "    \"outputs\": [" \
+                                    "      { \"channel\": 1, \"id\": 7, \"ioRegId\": 8, \"type\": \"708745fa-cef6-4364-abad-063a40f35cbc\"," \
+                                    "        \"expect\": { \"inputChannel\": " inCh ", \"gain\": 2.0, \"offset\": 1.0, \"tolerance\": 0.001 } }," \
+                                    "      { \"channel\": 2, \"id\": 9, \"ioRegId\": 10, \"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\"," \
+                                    "        \"expect\": { \"inputChannel\": 3 } }" \
+                                    "    ]" \
+                                    "  }" \
+                                    "}"
+
+#define NUM_BULK_CHANNELS   2000
+#define MAX_POINTS          (NUM_BULK_CHANNELS * 4 + 10)
+
+static size_t generalHeap_[250000];
+static size_t cardStateFullHeap_[50000];
+static size_t haStateFullHeap_[50000];
+
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "LoadGen" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap                              generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap                              cardStatefulAllocator( cardStateFullHeap_, sizeof( cardStateFullHeap_ ) );
+    Cpl::Memory::LeanHeap                              haStatefulAllocator( haStateFullHeap_, sizeof( haStateFullHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    Fxt::Point::Factory<Fxt::Point::Float>             factoryFloat( pointFactoryDb );
+    Fxt::Point::Factory<Fxt::Point::Int32>             factoryInt32( pointFactoryDb );
+    Fxt::Point::Factory<Fxt::Point::Bool>              factoryBool( pointFactoryDb );
+    Cpl::Dm::MailboxServer                             chassisMbox;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> errText;
+    LoadGen::Stats_T                                   stats;
+
+    SECTION( "mixed types" )
+    {
+        StaticJsonDocument<4096> doc;
+        REQUIRE( deserializeJson( doc, CARD_DEFINTION( "ramp", "1" ) ) == DeserializationError::Ok );
+        JsonVariant cardObj = doc.as<JsonVariant>();
+        LoadGen uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( uut.getErrorCode(), errText )) );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), LoadGen::GUID_STRING ) == 0 );
+
+        REQUIRE( uut.start( chassisMbox, 1000000 ) );
+        REQUIRE( uut.scanInputs( 1250000 ) );
+
+        float   floatVal;
+        int32_t intVal;
+        bool    boolVal;
+        REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->read( floatVal ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( floatVal, 2.5F ) );
+        REQUIRE( ((Fxt::Point::Int32*) pointDb.lookupById( 3 ))->read( intVal ) );
+        REQUIRE( intVal == 100 );
+        REQUIRE( ((Fxt::Point::Bool*) pointDb.lookupById( 5 ))->read( boolVal ) );
+        REQUIRE( boolVal == true );
+
+        // Matching outputs
+        ((Fxt::Point::Float*) pointDb.lookupById( 7 ))->write( 6.0F );
+        ((Fxt::Point::Bool*) pointDb.lookupById( 9 ))->write( true );
+        REQUIRE( uut.flushOutputs( 1250000 ) );
+        uut.getStatistics( stats );
+        REQUIRE( stats.scanCount == 1 );
+        REQUIRE( stats.flushCount == 1 );
+        REQUIRE( stats.verifyCount == 2 );
+        REQUIRE( stats.mismatchCount == 0 );
+        REQUIRE( stats.lastMismatchChannel == 0 );
+
+        // Second half of the square wave
+        REQUIRE( uut.scanInputs( 1750000 ) );
+        REQUIRE( ((Fxt::Point::Int32*) pointDb.lookupById( 3 ))->read( intVal ) );
+        REQUIRE( intVal == 0 );
+        REQUIRE( ((Fxt::Point::Bool*) pointDb.lookupById( 5 ))->read( boolVal ) );
+        REQUIRE( boolVal == false );
+        REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->read( floatVal ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( floatVal, 7.5F ) );
+
+        // Mismatched and invalid outputs
+        ((Fxt::Point::Float*) pointDb.lookupById( 7 ))->write( 6.0F );
+        ((Fxt::Point::Bool*) pointDb.lookupById( 9 ))->setInvalid();
+        REQUIRE( uut.flushOutputs( 1750000 ) );
+        uut.getStatistics( stats );
+        REQUIRE( stats.verifyCount == 4 );
+        REQUIRE( stats.mismatchCount == 2 );
+        REQUIRE( stats.lastMismatchChannel == 2 );
+
+        uut.clearStatistics();
+        uut.getStatistics( stats );
+        REQUIRE( stats.scanCount == 0 );
+        REQUIRE( stats.mismatchCount == 0 );
+        uut.stop( chassisMbox );
+    }
+
+    SECTION( "bad config" )
+    {
+        StaticJsonDocument<4096> doc;
+        REQUIRE( deserializeJson( doc, CARD_DEFINTION( "triangle", "1" ) ) == DeserializationError::Ok );
+        JsonVariant cardObj = doc.as<JsonVariant>();
+        LoadGen uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut.getErrorCode() == fullErr( Fxt::Card::Err_T::INVALID_FIELD ) );
+
+        pointDb.clearPoints();
+        REQUIRE( deserializeJson( doc, CARD_DEFINTION( "sine", "4" ) ) == DeserializationError::Ok );
+        cardObj = doc.as<JsonVariant>();
+        LoadGen uut2( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut2.getErrorCode() == fullErr( Fxt::Card::Err_T::INVALID_FIELD ) );
+    }
+
+    SECTION( "bulk" )
+    {
+        // Build a card with a large number of loop-back channels
+        DynamicJsonDocument doc( NUM_BULK_CHANNELS * 2 * 512 );
+        doc["slot"] = 2;
+        doc["seed"] = 42;
+        JsonObject wave  = doc.createNestedObject( "waveform" );
+        wave["shape"]    = "random";
+        wave["min"]      = -50;
+        wave["max"]      = 50;
+        JsonArray inputs  = doc["points"].createNestedArray( "inputs" );
+        JsonArray outputs = doc["points"].createNestedArray( "outputs" );
+        for ( unsigned i=0; i < NUM_BULK_CHANNELS; i++ )
+        {
+            JsonObject in  = inputs.createNestedObject();
+            in["channel"]  = i + 1;
+            in["id"]       = i * 4;
+            in["ioRegId"]  = i * 4 + 1;
+            in["type"]     = Fxt::Point::Float::GUID_STRING;
+            if ( i & 1 )
+            {
+                JsonObject sine  = in.createNestedObject( "waveform" );
+                sine["shape"]    = "sine";
+                sine["min"]      = 0;
+                sine["max"]      = i;
+                sine["periodMs"] = 100 + i;
+            }
+
+            JsonObject out              = outputs.createNestedObject();
+            out["channel"]              = i + 1;
+            out["id"]                   = i * 4 + 2;
+            out["ioRegId"]              = i * 4 + 3;
+            out["type"]                 = Fxt::Point::Float::GUID_STRING;
+            out["expect"]["inputChannel"] = i + 1;
+        }
+        REQUIRE( doc.overflowed() == false );
+
+        JsonVariant cardObj = doc.as<JsonVariant>();
+        LoadGen uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( uut.getErrorCode(), errText )) );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( chassisMbox, 0 ) );
+
+        // Run a number of scan cycles with 'logic' that copies the virtual inputs to the virtual outputs
+        for ( unsigned cycle=1; cycle <= 10; cycle++ )
+        {
+            REQUIRE( uut.scanInputs( cycle * 10000 ) );
+            for ( unsigned i=0; i < NUM_BULK_CHANNELS; i++ )
+            {
+                float val;
+                REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( i * 4 ))->read( val ) );
+                REQUIRE( val >= -50.0F );
+                REQUIRE( val <= (float) (i & 1 ? i : 50) );
+                ((Fxt::Point::Float*) pointDb.lookupById( i * 4 + 2 ))->write( val );
+            }
+            REQUIRE( uut.flushOutputs( cycle * 10000 ) );
+        }
+
+        uut.getStatistics( stats );
+        REQUIRE( stats.scanCount == 10 );
+        REQUIRE( stats.verifyCount == 10 * NUM_BULK_CHANNELS );
+        REQUIRE( stats.mismatchCount == 0 );
+        uut.stop( chassisMbox );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -0,0 +1,263 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Replay.h"
+#include <new>
+#include <stdint.h>
+#include <string.h>
+
+///
+using namespace Fxt::Card::Other;
+
+
+///////////////////////////////////////////////////////////////////////////////
+Replay::Replay( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                Fxt::Point::DatabaseApi&           dbForPoints,
+                JsonVariant&                       cardObject,
+                Cpl::Dm::MailboxServer*            cardMboxNotUsed,
+                void*                              extraArgsNotUsed )
+    : Fxt::Card::Common_( countChannels( cardObject, "inputs", MAX_INPUTS ), countChannels( cardObject, "outputs", MAX_OUTPUTS ) )
+    , m_outputTrace( nullptr )
+    , m_inputFileName( nullptr )
+    , m_outputFileName( nullptr )
+    , m_frames( nullptr )
+    , m_frameSize( 0 )
+    , m_numFrames( 0 )
+    , m_frameIdx( 0 )
+    , m_numRecorded( 0 )
+    , m_loop( false )
+{
+    if ( initialize( generalAllocator, cardObject ) )
+    {
+        parseConfiguration( generalAllocator, cardStatefulDataAllocator, haStatefulDataAllocator, pointFactoryDb, dbForPoints, cardObject );
+    }
+}
+
+Replay::~Replay()
+{
+    // Ensure the trace files get closed
+    Common_::stop();
+    closeOutputTrace();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Replay::parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                                 Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                                 Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                                 Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                                 Fxt::Point::DatabaseApi&           dbForPoints,
+                                 JsonVariant&                       cardObject ) noexcept
+{
+    // Parse/Create Virtual & IO Register points
+    if ( !parseInputOutputPoints( generalAllocator,
+                                  cardStatefulDataAllocator,
+                                  haStatefulDataAllocator,
+                                  pointFactoryDb,
+                                  dbForPoints,
+                                  cardObject,
+                                  true,
+                                  0, 0 ) )
+    {
+        return;
+    }
+
+    // Note: The parent class allows for one more than the maximum channels (see countChannels())
+    if ( m_numInputs > MAX_INPUTS || m_numOutputs > MAX_OUTPUTS )
+    {
+        m_error = fullErr( m_numInputs > MAX_INPUTS ? Err_T::TOO_MANY_INPUT_POINTS : Err_T::TOO_MANY_OUTPUT_POINTS );
+        m_error.logIt( getTypeName() );
+        return;
+    }
+
+    // Trace files
+    m_loop = cardObject["loop"] | false;
+    if ( m_numInputs > 0 )
+    {
+        m_inputFileName = copyString( generalAllocator, cardObject["inputTrace"].as<const char*>() );
+        if ( m_inputFileName == nullptr )
+        {
+            m_error = fullErr( Err_T::MISSING_REQUIRE_FIELD );
+            m_error.logIt( "%s. inputTrace", getTypeName() );
+            return;
+        }
+    }
+    if ( m_numOutputs > 0 && !cardObject["outputTrace"].isNull() )
+    {
+        m_outputFileName = copyString( generalAllocator, cardObject["outputTrace"].as<const char*>() );
+        if ( m_outputFileName == nullptr )
+        {
+            m_error = fullErr( Err_T::INVALID_FIELD );
+            m_error.logIt( "%s. outputTrace", getTypeName() );
+            return;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Replay::start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Call the parent's start-up actions (Note: sets the VPoint/IORegPoints initial values)
+    if ( !Common_::start( currentElapsedTimeUsec ) )
+    {
+        return false;
+    }
+
+    if ( !openInputTrace() || !openOutputTrace() )
+    {
+        m_inputTrace.close();
+        Common_::stop();
+        return false;
+    }
+    return true;
+}
+
+void Replay::stop( Cpl::Itc::PostApi& chassisMbox ) noexcept
+{
+    Common_::stop();
+    closeOutputTrace();
+    m_inputTrace.close();
+    m_frames    = nullptr;
+    m_numFrames = 0;
+}
+
+bool Replay::scanInputs( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Replay the next frame
+    if ( m_frameIdx < m_numFrames )
+    {
+        m_ioRegisterInputs.copyStatefulMemoryFrom( m_frames + ((size_t) m_frameIdx) * m_frameSize, m_frameSize );
+        if ( ++m_frameIdx >= m_numFrames && m_loop )
+        {
+            m_frameIdx = 0;
+        }
+    }
+
+    return Common_::scanInputs( currentElapsedTimeUsec );
+}
+
+bool Replay::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Call parent class to manage the transfer between IO Registers and Virtual Points
+    if ( !Common_::flushOutputs( currentElapsedTimeUsec ) )
+    {
+        return false;
+    }
+
+    // Record the frame
+    if ( m_outputTrace )
+    {
+        if ( !m_outputTrace->write( m_ioRegisterOutputs.getStartOfStatefulMemory(), (int) m_ioRegisterOutputs.getStatefulAllocatedSize() ) )
+        {
+            m_error = fullErr( Err_T::DRIVER_ERROR );
+            m_error.logIt( "%s. Failed to write frame %lu", getTypeName(), (unsigned long) m_numRecorded );
+            return false;
+        }
+        m_numRecorded++;
+    }
+    return true;
+}
+
+const char* Replay::getTypeGuid() const noexcept
+{
+    return GUID_STRING;
+}
+
+const char* Replay::getTypeName() const noexcept
+{
+    return TYPE_NAME;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Replay::openInputTrace() noexcept
+{
+    m_frames    = nullptr;
+    m_numFrames = 0;
+    m_frameIdx  = 0;
+    if ( m_inputFileName == nullptr )
+    {
+        return true;
+    }
+
+    if ( !m_inputTrace.open( m_inputFileName ) )
+    {
+        m_error = fullErr( Err_T::DRIVER_ERROR );
+        m_error.logIt( "%s. Unable to map: %s", getTypeName(), m_inputFileName );
+        return false;
+    }
+
+    // Validate the header
+    TraceHeader_T header;
+    if ( m_inputTrace.getSize() < sizeof( header ) )
+    {
+        m_error = fullErr( Err_T::DRIVER_ERROR );
+        m_error.logIt( "%s. Bad trace header: %s", getTypeName(), m_inputFileName );
+        return false;
+    }
+    memcpy( &header, m_inputTrace.getData(), sizeof( header ) );
+    if ( header.magic != TRACE_MAGIC ||
+         header.version != TRACE_VERSION ||
+         header.headerSize < sizeof( header ) ||
+         header.headerSize > m_inputTrace.getSize() ||
+         header.frameSize != m_ioRegisterInputs.getStatefulAllocatedSize() ||
+         header.numFrames == 0 ||
+         (m_inputTrace.getSize() - header.headerSize) / header.frameSize < header.numFrames )
+    {
+        m_error = fullErr( Err_T::DRIVER_ERROR );
+        m_error.logIt( "%s. Trace does not match the card: %s", getTypeName(), m_inputFileName );
+        return false;
+    }
+
+    m_frames    = ((const uint8_t*) m_inputTrace.getData()) + header.headerSize;
+    m_frameSize = header.frameSize;
+    m_numFrames = header.numFrames;
+    return true;
+}
+
+bool Replay::openOutputTrace() noexcept
+{
+    m_numRecorded = 0;
+    if ( m_outputFileName == nullptr )
+    {
+        return true;
+    }
+
+    m_outputTrace = new(m_outputTraceMem.m_byteMem) Cpl::Io::File::Output( m_outputFileName, true, true );
+    if ( !m_outputTrace->isOpened() )
+    {
+        m_outputTrace->~Output();
+        m_outputTrace = nullptr;
+        m_error       = fullErr( Err_T::DRIVER_ERROR );
+        m_error.logIt( "%s. Unable to create: %s", getTypeName(), m_outputFileName );
+        return false;
+    }
+
+    // Write a place holder header (the number of frames is updated when the trace is closed)
+    TraceHeader_T header ={ TRACE_MAGIC, TRACE_VERSION, sizeof( TraceHeader_T ), (uint32_t) m_ioRegisterOutputs.getStatefulAllocatedSize(), 0 };
+    return m_outputTrace->write( &header, sizeof( header ) );
+}
+
+void Replay::closeOutputTrace() noexcept
+{
+    if ( m_outputTrace )
+    {
+        TraceHeader_T header ={ TRACE_MAGIC, TRACE_VERSION, sizeof( TraceHeader_T ), (uint32_t) m_ioRegisterOutputs.getStatefulAllocatedSize(), m_numRecorded };
+        m_outputTrace->setAbsolutePos( 0 );
+        m_outputTrace->write( &header, sizeof( header ) );
+        m_outputTrace->close();
+        m_outputTrace->~Output();
+        m_outputTrace = nullptr;
+    }
+}
@@ -0,0 +1,257 @@
+#ifndef Fxt_Card_Other_Replay_h_
+#define Fxt_Card_Other_Replay_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Card/Common_.h"
+#include "Fxt/System/MappedFile.h"
+#include "Cpl/Io/File/Output.h"
+#include "Cpl/Memory/Aligned.h"
+#include "Cpl/Json/Arduino.h"
+#include "Cpl/Dm/MailboxServer.h"
+
+
+/** Maximum number of input channels (and separately output channels) that
+    a single Replay card supports
+ */
+#ifndef OPTION_FXT_CARD_OTHER_REPLAY_MAX_CHANNELS
+#define OPTION_FXT_CARD_OTHER_REPLAY_MAX_CHANNELS       1024
+#endif
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Other {
+
+
+/** This concrete class implements an IO card that replays recorded input
+    IO Register values from a binary trace file (one frame per input scan)
+    and optionally records its output IO Register values to a trace file
+    (one frame per output flush).  The card is intended to be used for
+    deterministic regression testing, e.g. when the Node is run with
+    simulated time (Cpl::System::SimTick) a day of recorded plant data can
+    be replayed faster than real time, and the recorded output traces from
+    two builds can be diff'd.
+
+    The input trace is memory mapped (see Fxt::System::MappedFile), i.e. each
+    scan is a single copy from the OS's page cache directly into the card's
+    IO Register Bank.
+
+    Trace file format (all fields are in host byte order):
+    \code
+        Header (see TraceHeader_T)
+            uint32_t    magic           // TRACE_MAGIC
+            uint16_t    version         // TRACE_VERSION
+            uint16_t    headerSize      // Offset, in bytes, of the first frame
+            uint32_t    frameSize       // Size, in bytes, of a frame
+            uint32_t    numFrames       // Number of frames
+        Frames
+            uint8_t     frame[frameSize]  // Image of the IO Register Bank's stateful memory
+            ...
+    \endcode
+
+    A frame is a raw image of the card's IO Register Bank, i.e. the trace
+    is only valid for a card definition with the same point types in the
+    same order.  An output trace can be used as the input trace for a card
+    whose inputs match the recording card's outputs.
+
+    When the end of the input trace is reached, the card either restarts
+    from the first frame ("loop": true) or holds the last frame.
+
+    The class dynamically creates numerous thingys and objects when it is created.
+    This memory is allocated via a 'Contiguous Allocator'.  This means the this
+    class will NOT free the allocated memory in its destructor, it WILL however
+    call the destructor on any objects it directly created using the allocator.
+    The semantics with the Application is that the Application is RESPONSIBLE for
+    freeing/recycling the memory in the Contiguous Allocator when Card(s) are
+    deleted.
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+      "name": "My Replay Card",                             // *Text label for the card
+      "id": 0,                                              // *ID assigned to the card
+      "type": "a0b2b6e4-6b3e-4bde-9a5c-0cc4f3a6d2e1",       // Identifies the card type.  Value comes from the Supported/Available-card-list
+      "typeName": "Fxt::Card::Other::Replay",               // *Human readable type name
+      "slot": 0,                                            // Physical identifier, e.g. its the card position in the Node's physical chassis
+      "inputTrace": "plant.trc",                            // Input trace file. REQUIRED when the card has inputs
+      "outputTrace": "outputs.trc",                         // OPTIONAL: Output trace file.  When not specified the outputs are not recorded
+      "loop": false,                                        // OPTIONAL: When true, the input trace restarts at the first frame. Default is false
+      "points": {
+        "inputs": [                                         // Inputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // Range: 1 to number of inputs
+            "id": 0,                                        // ID assigned to the Virtual Point that represents the input value
+            "ioRegId": 1,                                   // The ID of the Point's IO register.
+            "name": "My input#1 name"                       // *Text label for the input signal
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signal. Any Point type
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the input signal
+          }
+        ],
+        "outputs": [                                        // Outputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // Range: 1 to number of outputs
+            "id": 10,                                       // ID assigned to the Virtual Point that represents the output value
+            "ioRegId": 11,                                  // The ID of the Point's IO register.
+            "name": "My output#1 name"                      // *Text label for the output signal
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the output signal. Any Point type
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the output signal
+          }
+        ]
+      }
+    }
+
+    *The field is NOT parsed/used by the firmware
+
+    \endcode
+ */
+class Replay : public Fxt::Card::Common_
+{
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "a0b2b6e4-6b3e-4bde-9a5c-0cc4f3a6d2e1";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Card::Other::Replay";
+
+    /// Maximum number of input channels
+    static constexpr unsigned       MAX_INPUTS  = OPTION_FXT_CARD_OTHER_REPLAY_MAX_CHANNELS;
+
+    /// Maximum number of output channels
+    static constexpr unsigned       MAX_OUTPUTS = OPTION_FXT_CARD_OTHER_REPLAY_MAX_CHANNELS;
+
+    /// Trace file 'magic' value (the text "FXTR" when stored little endian)
+    static constexpr uint32_t       TRACE_MAGIC = 0x52545846;
+
+    /// Trace file format version
+    static constexpr uint16_t       TRACE_VERSION = 1;
+
+    /// Trace file header
+    struct TraceHeader_T
+    {
+        uint32_t    magic;          //!< Identifies the file as trace file
+        uint16_t    version;        //!< Format version
+        uint16_t    headerSize;     //!< Offset of the first frame
+        uint32_t    frameSize;      //!< Size, in bytes, of a frame
+        uint32_t    numFrames;      //!< Number of frames
+    };
+
+public:
+    /// Constructor
+    Replay( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+            Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+            Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+            Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+            Fxt::Point::DatabaseApi&           dbForPoints,
+            JsonVariant&                       cardObject,
+            Cpl::Dm::MailboxServer*            cardMboxNotUsed = nullptr,
+            void*                              extraArgsNotUsed = nullptr );
+
+    /// Destructor
+    ~Replay();
+
+public:
+    /// See Fxt::Card::Api
+    bool start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    void stop( Cpl::Itc::PostApi& chassisMbox ) noexcept;
+
+    /// See Fxt::Card::Api
+    bool scanInputs( uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    bool flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    const char* getTypeGuid() const noexcept;
+
+    /// See Fxt::Card::Api
+    const char* getTypeName() const noexcept;
+
+public:
+    /// Returns the number of frames in the input trace (zero when the card is not started)
+    inline uint32_t getNumInputFrames() const noexcept { return m_numFrames; }
+
+    /// Returns the index of the next input frame to be replayed
+    inline uint32_t getInputFrameIndex() const noexcept { return m_frameIdx; }
+
+    /// Returns true when the last input frame has been replayed (always false when looping)
+    inline bool isEndOfInputTrace() const noexcept { return m_numFrames > 0 && m_frameIdx >= m_numFrames; }
+
+    /// Returns the number of output frames recorded since the card was started
+    inline uint32_t getNumRecordedFrames() const noexcept { return m_numRecorded; }
+
+protected:
+    /// Helper method to parse the card's JSON config
+    void parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                             Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                             Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                             Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                             Fxt::Point::DatabaseApi&           dbForPoints,
+                             JsonVariant&                       cardObject ) noexcept;
+
+    /// Helper method that opens and validates the input trace.  Returns false on error
+    bool openInputTrace() noexcept;
+
+    /// Helper method that creates the output trace.  Returns false on error
+    bool openOutputTrace() noexcept;
+
+    /// Helper method that updates the output trace's header and closes the file
+    void closeOutputTrace() noexcept;
+
+protected:
+    /// Memory mapped input trace
+    Fxt::System::MappedFile                         m_inputTrace;
+
+    /// Memory for the output trace file instance
+    Cpl::Memory::AlignedClass<Cpl::Io::File::Output> m_outputTraceMem;
+
+    /// Output trace file (nullptr when not recording)
+    Cpl::Io::File::Output*                          m_outputTrace;
+
+    /// Input trace file name (nullptr when there is no input trace)
+    const char*                                     m_inputFileName;
+
+    /// Output trace file name (nullptr when not recording)
+    const char*                                     m_outputFileName;
+
+    /// Start of the first input frame
+    const uint8_t*                                  m_frames;
+
+    /// Input frame size
+    uint32_t                                        m_frameSize;
+
+    /// Number of input frames
+    uint32_t                                        m_numFrames;
+
+    /// Index of the next input frame
+    uint32_t                                        m_frameIdx;
+
+    /// Number of recorded output frames
+    uint32_t                                        m_numRecorded;
+
+    /// Restart at the first frame when the end of the input trace is reached
+    bool                                            m_loop;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
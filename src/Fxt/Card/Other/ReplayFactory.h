@@ -0,0 +1,33 @@
+#ifndef Fxt_Card_Other_ReplayFactory_h_
+#define Fxt_Card_Other_ReplayFactory_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Card/FactoryCommon_.h"
+#include "Fxt/Card/Other/Replay.h"
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Other {
+
+
+/// Define factory type
+typedef Factory<Replay> ReplayFactory;
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,185 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "ShmIo.h"
+
+///
+using namespace Fxt::Card::Other;
+
+
+///////////////////////////////////////////////////////////////////////////////
+ShmIo::ShmIo( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+              Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+              Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+              Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+              Fxt::Point::DatabaseApi&           dbForPoints,
+              JsonVariant&                       cardObject,
+              Cpl::Dm::MailboxServer*            cardMboxNotUsed,
+              void*                              extraArgsNotUsed )
+    : Fxt::Card::Common_( countChannels( cardObject, "inputs", MAX_INPUTS ), countChannels( cardObject, "outputs", MAX_OUTPUTS ) )
+    , m_segment( nullptr )
+    , m_segmentName( nullptr )
+    , m_inputFrame( nullptr )
+    , m_lastInputSeq( 0 )
+    , m_numStaleScans( 0 )
+    , m_readAttempts( OPTION_FXT_CARD_OTHER_SHMIO_READ_ATTEMPTS )
+{
+    if ( initialize( generalAllocator, cardObject ) )
+    {
+        parseConfiguration( generalAllocator, cardStatefulDataAllocator, haStatefulDataAllocator, pointFactoryDb, dbForPoints, cardObject );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ShmIo::parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                                Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                                Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                                Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                                Fxt::Point::DatabaseApi&           dbForPoints,
+                                JsonVariant&                       cardObject ) noexcept
+{
+    // Parse/Create Virtual & IO Register points
+    if ( !parseInputOutputPoints( generalAllocator,
+                                  cardStatefulDataAllocator,
+                                  haStatefulDataAllocator,
+                                  pointFactoryDb,
+                                  dbForPoints,
+                                  cardObject,
+                                  true,
+                                  0, 0 ) )
+    {
+        return;
+    }
+
+    // Note: The parent class allows for one more than the maximum channels (see countChannels())
+    if ( m_numInputs > MAX_INPUTS || m_numOutputs > MAX_OUTPUTS )
+    {
+        m_error = fullErr( m_numInputs > MAX_INPUTS ? Err_T::TOO_MANY_INPUT_POINTS : Err_T::TOO_MANY_OUTPUT_POINTS );
+        m_error.logIt( getTypeName() );
+        return;
+    }
+
+    // Segment
+    m_segmentName = copyString( generalAllocator, cardObject["segment"].as<const char*>() );
+    if ( m_segmentName == nullptr )
+    {
+        m_error = fullErr( Err_T::MISSING_REQUIRE_FIELD );
+        m_error.logIt( "%s. segment", getTypeName() );
+        return;
+    }
+    m_readAttempts = cardObject["readAttempts"] | (unsigned) OPTION_FXT_CARD_OTHER_SHMIO_READ_ATTEMPTS;
+    if ( m_readAttempts == 0 )
+    {
+        m_error = fullErr( Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. readAttempts", getTypeName() );
+        return;
+    }
+
+    // Scratch buffer for the inputs
+    size_t inputSize = m_ioRegisterInputs.getStatefulAllocatedSize();
+    if ( inputSize > 0 )
+    {
+        m_inputFrame = (uint8_t*) generalAllocator.allocate( inputSize );
+        if ( m_inputFrame == nullptr )
+        {
+            m_error = fullErr( Err_T::MEMORY_CARD );
+            m_error.logIt( getTypeName() );
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ShmIo::start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Call the parent's start-up actions (Note: sets the VPoint/IORegPoints initial values)
+    if ( !Common_::start( currentElapsedTimeUsec ) )
+    {
+        return false;
+    }
+
+    // Create the segment and publish the initial IO Register values
+    size_t inputSize  = m_ioRegisterInputs.getStatefulAllocatedSize();
+    size_t outputSize = m_ioRegisterOutputs.getStatefulAllocatedSize();
+    if ( !m_shm.create( m_segmentName, ShmIoSegment::computeSize( inputSize, outputSize ) ) )
+    {
+        m_error = fullErr( Err_T::DRIVER_ERROR );
+        m_error.logIt( "%s. Unable to create: %s", getTypeName(), m_segmentName );
+        Common_::stop();
+        return false;
+    }
+    m_segment = ShmIoSegment( m_shm.getData() );
+    m_segment.initialize( m_ioRegisterInputs.getStartOfStatefulMemory(), inputSize,
+                          m_ioRegisterOutputs.getStartOfStatefulMemory(), outputSize );
+
+    m_lastInputSeq  = m_segment.getInputSequence();
+    m_numStaleScans = 0;
+    return true;
+}
+
+void ShmIo::stop( Cpl::Itc::PostApi& chassisMbox ) noexcept
+{
+    Common_::stop();
+    if ( m_shm.getData() )
+    {
+        m_segment.markClosed();
+    }
+    m_shm.close();
+    m_segment = ShmIoSegment( nullptr );
+}
+
+bool ShmIo::scanInputs( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Only copy the input region when it has been updated
+    if ( m_started && m_inputFrame && m_segment.getInputSequence() != m_lastInputSeq )
+    {
+        size_t   inputSize = m_ioRegisterInputs.getStatefulAllocatedSize();
+        uint32_t seqNum;
+        if ( m_segment.readInputs( m_inputFrame, inputSize, m_readAttempts, seqNum ) )
+        {
+            m_ioRegisterInputs.copyStatefulMemoryFrom( m_inputFrame, inputSize );
+            m_lastInputSeq = seqNum;
+        }
+        else
+        {
+            m_numStaleScans++;
+        }
+    }
+
+    return Common_::scanInputs( currentElapsedTimeUsec );
+}
+
+bool ShmIo::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Call parent class to manage the transfer between IO Registers and Virtual Points
+    if ( !Common_::flushOutputs( currentElapsedTimeUsec ) )
+    {
+        return false;
+    }
+
+    // Publish the outputs
+    if ( m_started && m_numOutputs > 0 )
+    {
+        m_segment.writeOutputs( m_ioRegisterOutputs.getStartOfStatefulMemory(), m_ioRegisterOutputs.getStatefulAllocatedSize() );
+    }
+    return true;
+}
+
+const char* ShmIo::getTypeGuid() const noexcept
+{
+    return GUID_STRING;
+}
+
+const char* ShmIo::getTypeName() const noexcept
+{
+    return TYPE_NAME;
+}
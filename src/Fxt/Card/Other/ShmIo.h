@@ -0,0 +1,205 @@
+#ifndef Fxt_Card_Other_ShmIo_h_
+#define Fxt_Card_Other_ShmIo_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Card/Common_.h"
+#include "Fxt/Card/Other/ShmIoSegment.h"
+#include "Fxt/System/SharedMemory.h"
+#include "Cpl/Json/Arduino.h"
+#include "Cpl/Dm/MailboxServer.h"
+
+
+/** Maximum number of input channels (and separately output channels) that
+    a single ShmIo card supports
+ */
+#ifndef OPTION_FXT_CARD_OTHER_SHMIO_MAX_CHANNELS
+#define OPTION_FXT_CARD_OTHER_SHMIO_MAX_CHANNELS        1024
+#endif
+
+/** Default number of attempts to make a consistent copy of the input region
+    before the scan is skipped (i.e. the previous input values are retained)
+ */
+#ifndef OPTION_FXT_CARD_OTHER_SHMIO_READ_ATTEMPTS
+#define OPTION_FXT_CARD_OTHER_SHMIO_READ_ATTEMPTS       4
+#endif
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Other {
+
+
+/** This concrete class implements an IO card whose IO Registers are exchanged
+    with other processes on the same host via a named shared memory segment
+    (see Fxt::System::SharedMemory).  The layout of the segment and the
+    seqlock protocol used to access it are defined by ShmIoSegment, which is
+    header only so that the external processes can use it directly.
+
+    The card creates the segment when it is started - reusing an existing
+    segment of the same size - and marks it as closed when it is stopped (the
+    segment is NOT removed, see Fxt::System::SharedMemory::remove()).
+    External processes attach to the segment by name, and detect a stopped or
+    restarted card via the segment's closed flag and generation number (see
+    ShmIoSegment).
+
+    The scan/flush semantics are the same as Fxt::Card::Common_, i.e.:
+        o scanInputs() copies the input region (written by a single external
+          process) into the IO Register inputs and then to the Virtual Points.
+          The copy is skipped when the input region has not changed since the
+          last scan.  If a consistent copy can not be made (i.e. the writer
+          is continuously updating the region) the previous input values are
+          retained and the stale scan counter is incremented.
+        o flushOutputs() copies the Virtual Points to the IO Register outputs
+          and then publishes the IO Register outputs to the output region.
+
+    The class dynamically creates numerous thingys and objects when it is created.
+    This memory is allocated via a 'Contiguous Allocator'.  This means the this
+    class will NOT free the allocated memory in its destructor, it WILL however
+    call the destructor on any objects it directly created using the allocator.
+    The semantics with the Application is that the Application is RESPONSIBLE for
+    freeing/recycling the memory in the Contiguous Allocator when Card(s) are
+    deleted.
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+      "name": "My ShmIo Card",                              // *Text label for the card
+      "id": 0,                                              // *ID assigned to the card
+      "type": "3f1c9e5a-7b2d-4e8f-a6c1-5d9b0e2f4a73",       // Identifies the card type.  Value comes from the Supported/Available-card-list
+      "typeName": "Fxt::Card::Other::ShmIo",                // *Human readable type name
+      "slot": 0,                                            // Physical identifier, e.g. its the card position in the Node's physical chassis
+      "segment": "/fxt_vision",                             // REQUIRED: Name of the shared memory segment
+      "readAttempts": 4,                                    // OPTIONAL: Number of attempts to read a consistent input region. Default is OPTION_FXT_CARD_OTHER_SHMIO_READ_ATTEMPTS
+      "points": {
+        "inputs": [                                         // Inputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // Range: 1 to number of inputs
+            "id": 0,                                        // ID assigned to the Virtual Point that represents the input value
+            "ioRegId": 1,                                   // The ID of the Point's IO register.
+            "name": "My input#1 name"                       // *Text label for the input signal
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signal. Any Point type
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the input signal
+          }
+        ],
+        "outputs": [                                        // Outputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // Range: 1 to number of outputs
+            "id": 10,                                       // ID assigned to the Virtual Point that represents the output value
+            "ioRegId": 11,                                  // The ID of the Point's IO register.
+            "name": "My output#1 name"                      // *Text label for the output signal
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the output signal. Any Point type
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the output signal
+          }
+        ]
+      }
+    }
+
+    *The field is NOT parsed/used by the firmware
+
+    \endcode
+ */
+class ShmIo : public Fxt::Card::Common_
+{
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "3f1c9e5a-7b2d-4e8f-a6c1-5d9b0e2f4a73";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Card::Other::ShmIo";
+
+    /// Maximum number of input channels
+    static constexpr unsigned       MAX_INPUTS  = OPTION_FXT_CARD_OTHER_SHMIO_MAX_CHANNELS;
+
+    /// Maximum number of output channels
+    static constexpr unsigned       MAX_OUTPUTS = OPTION_FXT_CARD_OTHER_SHMIO_MAX_CHANNELS;
+
+public:
+    /// Constructor
+    ShmIo( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+           Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+           Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+           Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+           Fxt::Point::DatabaseApi&           dbForPoints,
+           JsonVariant&                       cardObject,
+           Cpl::Dm::MailboxServer*            cardMboxNotUsed = nullptr,
+           void*                              extraArgsNotUsed = nullptr );
+
+public:
+    /// See Fxt::Card::Api
+    bool start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    void stop( Cpl::Itc::PostApi& chassisMbox ) noexcept;
+
+    /// See Fxt::Card::Api
+    bool scanInputs( uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    bool flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    const char* getTypeGuid() const noexcept;
+
+    /// See Fxt::Card::Api
+    const char* getTypeName() const noexcept;
+
+public:
+    /// Returns the name of the shared memory segment
+    inline const char* getSegmentName() const noexcept { return m_segmentName; }
+
+    /// Returns the number of scans (since the card was started) where a consistent copy of the input region could not be made
+    inline uint32_t getNumStaleScans() const noexcept { return m_numStaleScans; }
+
+protected:
+    /// Helper method to parse the card's JSON config
+    void parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                             Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                             Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                             Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                             Fxt::Point::DatabaseApi&           dbForPoints,
+                             JsonVariant&                       cardObject ) noexcept;
+
+protected:
+    /// Shared memory segment
+    Fxt::System::SharedMemory   m_shm;
+
+    /// Segment accessor (only valid when the card is started)
+    ShmIoSegment                m_segment;
+
+    /// Segment name
+    const char*                 m_segmentName;
+
+    /// Scratch buffer for the seqlock'd copy of the input region
+    uint8_t*                    m_inputFrame;
+
+    /// Sequence number of the last input region that was copied
+    uint32_t                    m_lastInputSeq;
+
+    /// Number of stale scans
+    uint32_t                    m_numStaleScans;
+
+    /// Number of read attempts per scan
+    unsigned                    m_readAttempts;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
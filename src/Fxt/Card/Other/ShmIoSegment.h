@@ -0,0 +1,237 @@
+#ifndef Fxt_Card_Other_ShmIoSegment_h_
+#define Fxt_Card_Other_ShmIoSegment_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Other {
+
+
+/** This class defines the layout of - and the access protocol for - the
+    shared memory segment used by the ShmIo card.  The class is header only
+    and has no dependencies on the rest of Foxtail so that it can be used
+    directly by the external processes that exchange IO with the card.
+
+    Segment layout:
+    \code
+        Header_T                    // Offset 0
+        uint8_t inputs[inputSize]   // Offset: inputOffset.  Written by the external process, read by the card
+        uint8_t outputs[outputSize] // Offset: outputOffset. Written by the card, read by the external process(es)
+    \endcode
+
+    Each region is an image of the card's IO Register Bank's stateful memory,
+    i.e. the Points' stateful data (meta-data + value) in channel order.
+
+    Each region is protected by a sequence lock (seqlock).  There is exactly
+    ONE writer per region, i.e. only one external process may write the
+    inputs.  Readers never block the writer; a reader retries when it detects
+    that the region was modified while it was being copied.
+ */
+class ShmIoSegment
+{
+public:
+    /// Segment 'magic' value (the text "FXSM" when stored little endian)
+    static constexpr uint32_t   MAGIC   = 0x4D535846;
+
+    /// Segment format version
+    static constexpr uint16_t   VERSION = 2;
+
+    /// Alignment, in bytes, of the regions (avoids false sharing between the header and the regions)
+    static constexpr size_t     ALIGNMENT = 64;
+
+    /// Segment header
+    struct Header_T
+    {
+        uint32_t                magic;          //!< Identifies the segment
+        uint16_t                version;        //!< Format version
+        uint16_t                headerSize;     //!< Size of the header
+        uint32_t                inputOffset;    //!< Offset of the input region
+        uint32_t                inputSize;      //!< Size, in bytes, of the input region
+        uint32_t                outputOffset;   //!< Offset of the output region
+        uint32_t                outputSize;     //!< Size, in bytes, of the output region
+        std::atomic<uint32_t>   inputSeq;       //!< Input region sequence number (odd while being written)
+        std::atomic<uint32_t>   outputSeq;      //!< Output region sequence number (odd while being written)
+        std::atomic<uint32_t>   generation;     //!< Incremented each time the card (re)initializes the segment
+        std::atomic<uint32_t>   closed;         //!< Non-zero when the card has stopped servicing the segment
+    };
+
+public:
+    /// Constructor. 'segmentBase' is the start of the mapped segment
+    ShmIoSegment( void* segmentBase ) noexcept
+        : m_header( (Header_T*) segmentBase )
+    {
+    }
+
+public:
+    /// Returns the size, in bytes, of segment for the specified region sizes
+    static size_t computeSize( size_t inputSize, size_t outputSize ) noexcept
+    {
+        return alignUp( sizeof( Header_T ) ) + alignUp( inputSize ) + alignUp( outputSize );
+    }
+
+    /** Initializes a newly created - or reused - segment with the specified
+        initial region content.  The segment must be at least computeSize()
+        bytes.  The header's magic value is cleared first and written last,
+        i.e. the segment is not valid for other processes until the regions
+        have been initialized.  The generation of a reused segment is
+        incremented.
+     */
+    void initialize( const void* initialInputs, size_t inputSize, const void* initialOutputs, size_t outputSize ) noexcept
+    {
+        uint32_t generation    = m_header->magic == MAGIC && m_header->version == VERSION ? m_header->generation.load( std::memory_order_relaxed ) + 1 : 1;
+        m_header->magic        = 0;
+        std::atomic_thread_fence( std::memory_order_release );
+
+        m_header->headerSize   = sizeof( Header_T );
+        m_header->inputOffset  = (uint32_t) alignUp( sizeof( Header_T ) );
+        m_header->inputSize    = (uint32_t) inputSize;
+        m_header->outputOffset = (uint32_t) (m_header->inputOffset + alignUp( inputSize ));
+        m_header->outputSize   = (uint32_t) outputSize;
+        m_header->inputSeq.store( 0, std::memory_order_relaxed );
+        m_header->outputSeq.store( 0, std::memory_order_relaxed );
+        m_header->generation.store( generation, std::memory_order_relaxed );
+        m_header->closed.store( 0, std::memory_order_relaxed );
+        m_header->version      = VERSION;
+        memcpy( region( m_header->inputOffset ), initialInputs, inputSize );
+        memcpy( region( m_header->outputOffset ), initialOutputs, outputSize );
+
+        // Publish the segment
+        std::atomic_thread_fence( std::memory_order_release );
+        m_header->magic        = MAGIC;
+    }
+
+    /** Returns true if the segment has been initialized AND its layout is
+        compatible with the specified mapped size
+     */
+    bool isValid( size_t mappedSize ) const noexcept
+    {
+        if ( mappedSize < sizeof( Header_T ) || m_header->magic != MAGIC )
+        {
+            return false;
+        }
+        std::atomic_thread_fence( std::memory_order_acquire );
+        return m_header->version == VERSION &&
+            m_header->headerSize == sizeof( Header_T ) &&
+            ((size_t) m_header->inputOffset) + m_header->inputSize <= mappedSize &&
+            ((size_t) m_header->outputOffset) + m_header->outputSize <= mappedSize;
+    }
+
+    /// Returns the segment's header
+    inline Header_T& getHeader() noexcept { return *m_header; }
+
+    /// Marks the segment as no longer being serviced (called by the card when it stops)
+    inline void markClosed() noexcept { m_header->closed.store( 1, std::memory_order_release ); }
+
+    /// Returns true if the card has stopped servicing the segment
+    inline bool isClosed() const noexcept { return m_header->closed.load( std::memory_order_acquire ) != 0; }
+
+    /// Returns the segment's generation (see initialize())
+    inline uint32_t getGeneration() const noexcept { return m_header->generation.load( std::memory_order_acquire ); }
+
+public:
+    /// Writes the input region (called by the external process). 'srcSize' must equal the region size
+    inline void writeInputs( const void* src, size_t srcSize ) noexcept
+    {
+        write( m_header->inputSeq, region( m_header->inputOffset ), m_header->inputSize, src, srcSize );
+    }
+
+    /** Reads the input region (called by the card).  Returns false if a
+        consistent copy could not be made within 'maxAttempts' attempts. On
+        success, 'seqNum' is the region's sequence number for the copy.
+     */
+    inline bool readInputs( void* dst, size_t dstSize, unsigned maxAttempts, uint32_t& seqNum ) noexcept
+    {
+        return read( m_header->inputSeq, region( m_header->inputOffset ), m_header->inputSize, dst, dstSize, maxAttempts, seqNum );
+    }
+
+    /// Writes the output region (called by the card). 'srcSize' must equal the region size
+    inline void writeOutputs( const void* src, size_t srcSize ) noexcept
+    {
+        write( m_header->outputSeq, region( m_header->outputOffset ), m_header->outputSize, src, srcSize );
+    }
+
+    /// Reads the output region (called by the external process(es)). See readInputs()
+    inline bool readOutputs( void* dst, size_t dstSize, unsigned maxAttempts, uint32_t& seqNum ) noexcept
+    {
+        return read( m_header->outputSeq, region( m_header->outputOffset ), m_header->outputSize, dst, dstSize, maxAttempts, seqNum );
+    }
+
+    /// Returns the current (i.e. last completed) input sequence number
+    inline uint32_t getInputSequence() const noexcept { return m_header->inputSeq.load( std::memory_order_acquire ) & ~1U; }
+
+protected:
+    /// Helper method
+    static inline size_t alignUp( size_t size ) noexcept
+    {
+        return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+    /// Helper method
+    inline uint8_t* region( uint32_t offset ) noexcept
+    {
+        return ((uint8_t*) m_header) + offset;
+    }
+
+    /// Seqlock writer
+    static void write( std::atomic<uint32_t>& seq, uint8_t* dst, size_t dstSize, const void* src, size_t srcSize ) noexcept
+    {
+        size_t   len = srcSize < dstSize ? srcSize : dstSize;
+        uint32_t s   = seq.load( std::memory_order_relaxed );
+        seq.store( s + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        memcpy( dst, src, len );
+        seq.store( s + 2, std::memory_order_release );
+    }
+
+    /// Seqlock reader
+    static bool read( std::atomic<uint32_t>& seq, const uint8_t* src, size_t srcSize, void* dst, size_t dstSize, unsigned maxAttempts, uint32_t& seqNum ) noexcept
+    {
+        size_t len = srcSize < dstSize ? srcSize : dstSize;
+        for ( unsigned i=0; i < maxAttempts; i++ )
+        {
+            uint32_t s1 = seq.load( std::memory_order_acquire );
+            if ( s1 & 1 )
+            {
+                continue;   // Write in progress
+            }
+            memcpy( dst, src, len );
+            std::atomic_thread_fence( std::memory_order_acquire );
+            if ( seq.load( std::memory_order_relaxed ) == s1 )
+            {
+                seqNum = s1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+protected:
+    /// Start of the segment
+    Header_T*   m_header;
+};
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
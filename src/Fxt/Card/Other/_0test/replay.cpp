@@ -0,0 +1,190 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Card/Other/Replay.h"
+#include "Fxt/Point/Float.h"
+#include "Fxt/Point/Database.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/System/Trace.h"
+#include "Cpl/Math/real.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Factory.h"
+#include "Cpl/Dm/MailboxServer.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+///
+using namespace Fxt::Card::Other;
+
+#define TRACE_FILE          "replay_test.trc"
+#define TRACE_FILE2         "replay_test2.trc"
+
+#define FLOAT_TYPE          "\"type\": \"708745fa-cef6-4364-abad-063a40f35cbc\""
+
+#define RECORDER_DEFINITION "{ \"slot\": 1, \"outputTrace\": \"" TRACE_FILE "\"," \
+                            "  \"points\": { \"outputs\": [" \
+                            "    { \"channel\": 1, \"id\": 1, \"ioRegId\": 2, " FLOAT_TYPE " }," \
+                            "    { \"channel\": 2, \"id\": 3, \"ioRegId\": 4, " FLOAT_TYPE " } ] } }"
+
+#define PLAYER_DEFINITION(loop) "{ \"slot\": 2, \"inputTrace\": \"" TRACE_FILE "\", \"loop\": " loop "," \
+                                "  \"outputTrace\": \"" TRACE_FILE2 "\"," \
+                                "  \"points\": { \"inputs\": [" \
+                                "    { \"channel\": 1, \"id\": 11, \"ioRegId\": 12, " FLOAT_TYPE " }," \
+                                "    { \"channel\": 2, \"id\": 13, \"ioRegId\": 14, " FLOAT_TYPE " } ]," \
+                                "  \"outputs\": [" \
+                                "    { \"channel\": 1, \"id\": 15, \"ioRegId\": 16, " FLOAT_TYPE " } ] } }"
+
+#define MISMATCH_DEFINITION "{ \"slot\": 3, \"inputTrace\": \"" TRACE_FILE "\"," \
+                            "  \"points\": { \"inputs\": [" \
+                            "    { \"channel\": 1, \"id\": 21, \"ioRegId\": 22, " FLOAT_TYPE " } ] } }"
+
+#define MISSING_DEFINITION  "{ \"slot\": 4," \
+                            "  \"points\": { \"inputs\": [" \
+                            "    { \"channel\": 1, \"id\": 31, \"ioRegId\": 32, " FLOAT_TYPE " } ] } }"
+
+#define MAX_POINTS      100
+
+static size_t generalHeap_[10000];
+static size_t cardStateFullHeap_[10000];
+static size_t haStateFullHeap_[10000];
+
+static void verifyInputs( Fxt::Point::DatabaseApi& pointDb, float expected1, float expected2 )
+{
+    float val;
+    REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( 11 ))->read( val ) );
+    REQUIRE( Cpl::Math::areFloatsEqual( val, expected1 ) );
+    REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( 13 ))->read( val ) );
+    REQUIRE( Cpl::Math::areFloatsEqual( val, expected2 ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Replay" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap                              generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap                              cardStatefulAllocator( cardStateFullHeap_, sizeof( cardStateFullHeap_ ) );
+    Cpl::Memory::LeanHeap                              haStatefulAllocator( haStateFullHeap_, sizeof( haStateFullHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    Fxt::Point::Factory<Fxt::Point::Float>             factoryFloat( pointFactoryDb );
+    Cpl::Dm::MailboxServer                             chassisMbox;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> errText;
+    StaticJsonDocument<4096>                           doc;
+
+    // Record a trace
+    REQUIRE( deserializeJson( doc, RECORDER_DEFINITION ) == DeserializationError::Ok );
+    JsonVariant cardObj = doc.as<JsonVariant>();
+    Replay recorder( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+    CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( recorder.getErrorCode(), errText )) );
+    REQUIRE( recorder.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+    REQUIRE( strcmp( recorder.getTypeGuid(), Replay::GUID_STRING ) == 0 );
+    REQUIRE( recorder.start( chassisMbox, 0 ) );
+    for ( unsigned i=1; i <= 3; i++ )
+    {
+        REQUIRE( recorder.scanInputs( i * 1000 ) );
+        ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->write( (float) i );
+        ((Fxt::Point::Float*) pointDb.lookupById( 3 ))->write( (float) (i * 10) );
+        REQUIRE( recorder.flushOutputs( i * 1000 ) );
+    }
+    REQUIRE( recorder.getNumRecordedFrames() == 3 );
+    recorder.stop( chassisMbox );
+
+    // Validate the trace file
+    {
+        Fxt::System::MappedFile trace;
+        REQUIRE( trace.open( TRACE_FILE ) );
+        Replay::TraceHeader_T header;
+        memcpy( &header, trace.getData(), sizeof( header ) );
+        REQUIRE( header.magic == (uint32_t) Replay::TRACE_MAGIC );
+        REQUIRE( header.version == (uint16_t) Replay::TRACE_VERSION );
+        REQUIRE( header.headerSize == sizeof( header ) );
+        REQUIRE( header.frameSize > 0 );
+        REQUIRE( header.numFrames == 3 );
+        REQUIRE( trace.getSize() == header.headerSize + header.numFrames * header.frameSize );
+        trace.close();
+    }
+
+    SECTION( "replay" )
+    {
+        REQUIRE( deserializeJson( doc, PLAYER_DEFINITION( "false" ) ) == DeserializationError::Ok );
+        cardObj = doc.as<JsonVariant>();
+        Replay uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( chassisMbox, 0 ) );
+        REQUIRE( uut.getNumInputFrames() == 3 );
+        REQUIRE( uut.getInputFrameIndex() == 0 );
+
+        REQUIRE( uut.scanInputs( 1000 ) );
+        verifyInputs( pointDb, 1.0F, 10.0F );
+        REQUIRE( uut.scanInputs( 2000 ) );
+        verifyInputs( pointDb, 2.0F, 20.0F );
+        REQUIRE( uut.isEndOfInputTrace() == false );
+        REQUIRE( uut.scanInputs( 3000 ) );
+        verifyInputs( pointDb, 3.0F, 30.0F );
+        REQUIRE( uut.isEndOfInputTrace() );
+
+        // Hold the last frame, i.e. the IO Registers are no longer updated
+        ((Fxt::Point::Float*) pointDb.lookupById( 12 ))->write( 99.0F );
+        REQUIRE( uut.scanInputs( 4000 ) );
+        verifyInputs( pointDb, 99.0F, 30.0F );
+
+        REQUIRE( uut.flushOutputs( 4000 ) );
+        REQUIRE( uut.getNumRecordedFrames() == 1 );
+        uut.stop( chassisMbox );
+        REQUIRE( uut.getNumInputFrames() == 0 );
+
+        // Restarting replays from the first frame
+        REQUIRE( uut.start( chassisMbox, 0 ) );
+        REQUIRE( uut.scanInputs( 1000 ) );
+        verifyInputs( pointDb, 1.0F, 10.0F );
+        uut.stop( chassisMbox );
+    }
+
+    SECTION( "loop" )
+    {
+        REQUIRE( deserializeJson( doc, PLAYER_DEFINITION( "true" ) ) == DeserializationError::Ok );
+        cardObj = doc.as<JsonVariant>();
+        Replay uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( chassisMbox, 0 ) );
+        REQUIRE( uut.scanInputs( 1000 ) );
+        REQUIRE( uut.scanInputs( 2000 ) );
+        REQUIRE( uut.scanInputs( 3000 ) );
+        REQUIRE( uut.isEndOfInputTrace() == false );
+        REQUIRE( uut.getInputFrameIndex() == 0 );
+        REQUIRE( uut.scanInputs( 4000 ) );
+        verifyInputs( pointDb, 1.0F, 10.0F );
+        uut.stop( chassisMbox );
+    }
+
+    SECTION( "errors" )
+    {
+        // Frame size does not match the card's inputs
+        REQUIRE( deserializeJson( doc, MISMATCH_DEFINITION ) == DeserializationError::Ok );
+        cardObj = doc.as<JsonVariant>();
+        Replay uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( chassisMbox, 0 ) == false );
+        REQUIRE( uut.isStarted() == false );
+        REQUIRE( uut.getErrorCode() == fullErr( Fxt::Card::Err_T::DRIVER_ERROR ) );
+
+        // No input trace
+        REQUIRE( deserializeJson( doc, MISSING_DEFINITION ) == DeserializationError::Ok );
+        cardObj = doc.as<JsonVariant>();
+        Replay uut2( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut2.getErrorCode() == fullErr( Fxt::Card::Err_T::MISSING_REQUIRE_FIELD ) );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
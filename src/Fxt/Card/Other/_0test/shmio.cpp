@@ -0,0 +1,165 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Card/Other/ShmIo.h"
+#include "Fxt/Point/Float.h"
+#include "Fxt/Point/Database.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/System/Trace.h"
+#include "Cpl/Math/real.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Factory.h"
+#include "Cpl/Dm/MailboxServer.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+///
+using namespace Fxt::Card::Other;
+
+#define SEGMENT_NAME        "/fxt_shmio_test"
+
+#define FLOAT_TYPE          "\"type\": \"708745fa-cef6-4364-abad-063a40f35cbc\""
+
+#define CARD_DEFINITION     "{ \"slot\": 1, \"segment\": \"" SEGMENT_NAME "\", \"readAttempts\": 2," \
+                            "  \"points\": { " \
+                            "    \"inputs\": [ { \"channel\": 1, \"id\": 1, \"ioRegId\": 2, " FLOAT_TYPE " } ]," \
+                            "    \"outputs\": [ { \"channel\": 1, \"id\": 3, \"ioRegId\": 4, " FLOAT_TYPE " } ] } }"
+
+#define MISSING_DEFINITION  "{ \"slot\": 2," \
+                            "  \"points\": { \"inputs\": [ { \"channel\": 1, \"id\": 11, \"ioRegId\": 12, " FLOAT_TYPE " } ] } }"
+
+#define MAX_POINTS      100
+
+static size_t generalHeap_[10000];
+static size_t cardStateFullHeap_[10000];
+static size_t haStateFullHeap_[10000];
+
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "ShmIo" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap                              generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap                              cardStatefulAllocator( cardStateFullHeap_, sizeof( cardStateFullHeap_ ) );
+    Cpl::Memory::LeanHeap                              haStatefulAllocator( haStateFullHeap_, sizeof( haStateFullHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    Fxt::Point::Factory<Fxt::Point::Float>             factoryFloat( pointFactoryDb );
+    Cpl::Dm::MailboxServer                             chassisMbox;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> errText;
+    StaticJsonDocument<4096>                           doc;
+
+    SECTION( "loopback" )
+    {
+        REQUIRE( deserializeJson( doc, CARD_DEFINITION ) == DeserializationError::Ok );
+        JsonVariant cardObj = doc.as<JsonVariant>();
+        ShmIo uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( uut.getErrorCode(), errText )) );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), ShmIo::GUID_STRING ) == 0 );
+        REQUIRE( strcmp( uut.getSegmentName(), SEGMENT_NAME ) == 0 );
+        REQUIRE( uut.start( chassisMbox, 0 ) );
+
+        // Attach as an external process
+        Fxt::System::SharedMemory shm;
+        REQUIRE( shm.attach( SEGMENT_NAME ) );
+        ShmIoSegment client( shm.getData() );
+        REQUIRE( client.isValid( shm.getSize() ) );
+        REQUIRE( client.getHeader().inputSize > 0 );
+        REQUIRE( client.getHeader().inputSize == client.getHeader().outputSize );
+
+        // Outputs -->client
+        uint8_t  frame[256];
+        uint32_t seqNum;
+        REQUIRE( client.getHeader().outputSize <= sizeof( frame ) );
+        ((Fxt::Point::Float*) pointDb.lookupById( 3 ))->write( 1.5F );
+        REQUIRE( uut.flushOutputs( 1000 ) );
+        REQUIRE( client.readOutputs( frame, sizeof( frame ), 1, seqNum ) );
+        REQUIRE( seqNum == 2 );
+
+        // Client -->inputs (loopback)
+        client.writeInputs( frame, client.getHeader().inputSize );
+        REQUIRE( uut.scanInputs( 2000 ) );
+        float val;
+        REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->read( val ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( val, 1.5F ) );
+
+        // No update from the client -->the IO Registers are not overwritten
+        ((Fxt::Point::Float*) pointDb.lookupById( 2 ))->write( 7.0F );
+        REQUIRE( uut.scanInputs( 3000 ) );
+        REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->read( val ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( val, 7.0F ) );
+        REQUIRE( uut.getNumStaleScans() == 0 );
+
+        // Write in progress -->previous values are retained
+        client.getHeader().inputSeq.store( 5 );
+        REQUIRE( uut.scanInputs( 4000 ) );
+        REQUIRE( uut.getNumStaleScans() == 1 );
+        REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->read( val ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( val, 7.0F ) );
+        client.getHeader().inputSeq.store( 6 );
+        REQUIRE( uut.scanInputs( 5000 ) );
+        REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->read( val ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( val, 1.5F ) );
+
+        // Stopping the card marks the segment as closed (but does not remove it)
+        REQUIRE( client.isClosed() == false );
+        REQUIRE( client.getGeneration() == 1 );
+        uut.stop( chassisMbox );
+        REQUIRE( client.isClosed() );
+
+        // Restart -->the segment is reused, i.e. the attached client sees the new generation without re-attaching
+        REQUIRE( uut.start( chassisMbox, 0 ) );
+        REQUIRE( client.isValid( shm.getSize() ) );
+        REQUIRE( client.isClosed() == false );
+        REQUIRE( client.getGeneration() == 2 );
+        ((Fxt::Point::Float*) pointDb.lookupById( 3 ))->write( 2.5F );
+        REQUIRE( uut.flushOutputs( 6000 ) );
+        REQUIRE( client.readOutputs( frame, sizeof( frame ), 1, seqNum ) );
+        client.writeInputs( frame, client.getHeader().inputSize );
+        REQUIRE( uut.scanInputs( 7000 ) );
+        REQUIRE( ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->read( val ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( val, 2.5F ) );
+        uut.stop( chassisMbox );
+        shm.close();
+
+        // A segment with a different size is replaced (and starts a new generation)
+        Fxt::System::SharedMemory other;
+        REQUIRE( other.create( SEGMENT_NAME, 16 ) );
+        other.close();
+        REQUIRE( uut.start( chassisMbox, 0 ) );
+        REQUIRE( shm.attach( SEGMENT_NAME ) );
+        ShmIoSegment client2( shm.getData() );
+        REQUIRE( client2.isValid( shm.getSize() ) );
+        REQUIRE( client2.getGeneration() == 1 );
+        uut.stop( chassisMbox );
+        shm.close();
+
+        // The segment is only removed explicitly
+        REQUIRE( shm.attach( SEGMENT_NAME ) );
+        shm.close();
+        REQUIRE( Fxt::System::SharedMemory::remove( SEGMENT_NAME ) );
+        REQUIRE( shm.attach( SEGMENT_NAME ) == false );
+    }
+
+    SECTION( "errors" )
+    {
+        REQUIRE( deserializeJson( doc, MISSING_DEFINITION ) == DeserializationError::Ok );
+        JsonVariant cardObj = doc.as<JsonVariant>();
+        ShmIo uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut.getErrorCode() == fullErr( Fxt::Card::Err_T::MISSING_REQUIRE_FIELD ) );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -0,0 +1,199 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "ModbusClient.h"
+#include "Cpl/System/Trace.h"
+#include <string.h>
+
+#define SECT_ "Fxt::Card::Protocol::ModbusClient"
+
+///
+using namespace Fxt::Card::Protocol;
+
+
+///////////////////////////////////////////////////////////////////////////////
+ModbusClient::ModbusClient( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                            Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                            Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                            Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                            Fxt::Point::DatabaseApi&           dbForPoints,
+                            JsonVariant&                       cardObject,
+                            Cpl::Dm::MailboxServer*            cardMbox,
+                            void*                              extraArgsNotUsed )
+    : ModbusCommon_( cardObject, cardMbox, DEFAULT_UNIT_ID )
+    , m_readPlan( generalAllocator, countChannels( cardObject, "inputs", MAX_CHANNELS ) )
+    , m_writePlan( generalAllocator, countChannels( cardObject, "outputs", MAX_CHANNELS ) )
+    , m_client( cardObject["maxInFlight"] | (unsigned) OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT, cardObject["timeoutMs"] | (unsigned long) OPTION_DRIVER_MODBUS_TIMEOUT_MS )
+    , m_drvForceWrite( true )
+{
+    if ( initialize( generalAllocator, cardObject ) )
+    {
+        parseConfiguration( generalAllocator, cardStatefulDataAllocator, haStatefulDataAllocator, pointFactoryDb, dbForPoints, cardObject );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ModbusClient::parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                                       Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                                       Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                                       Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                                       Fxt::Point::DatabaseApi&           dbForPoints,
+                                       JsonVariant&                       cardObject ) noexcept
+{
+    if ( !parseCommon( generalAllocator, cardStatefulDataAllocator, haStatefulDataAllocator, pointFactoryDb, dbForPoints, cardObject ) )
+    {
+        return;
+    }
+
+    if ( (m_numInputs > 0 && !m_readPlan.isValid()) || (m_numOutputs > 0 && !m_writePlan.isValid()) )
+    {
+        m_error = fullErr( Err_T::MEMORY_CARD );
+        m_error.logIt( getTypeName() );
+        return;
+    }
+
+    // Coalesce the register ranges into requests
+    uint16_t maxGap = cardObject["maxGap"] | 0;
+    if ( !buildPlan( m_readPlan, m_inChannels, m_numInputs, maxGap, m_numInputRegs ) ||
+         !buildPlan( m_writePlan, m_outChannels, m_numOutputs, 0, m_numOutputRegs ) )
+    {
+        return;
+    }
+    CPL_SYSTEM_TRACE_MSG( SECT_, ("%u input channels -> %u read requests. %u output channels -> %u write requests",
+                                   m_numInputs, m_readPlan.getNumRequests(), m_numOutputs, m_writePlan.getNumRequests()) );
+}
+
+bool ModbusClient::buildPlan( Driver::Modbus::Planner& plan, Channel_T* channels, unsigned numChannels, uint16_t maxGap, uint16_t& numRegs ) noexcept
+{
+    plan.clear();
+    for ( unsigned i=0; i < numChannels; i++ )
+    {
+        if ( !plan.add( channels[i].unitId, channels[i].functionCode, channels[i].address, channels[i].numRegs ) )
+        {
+            m_error = fullErr( Err_T::INVALID_FIELD );
+            m_error.logIt( "%s. register=%u", getTypeName(), channels[i].address );
+            return false;
+        }
+    }
+    plan.build( maxGap );
+
+    if ( plan.getBufferSize() > MAX_REGISTERS )
+    {
+        m_error = fullErr( Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. Too many registers (%u)", getTypeName(), plan.getBufferSize() );
+        return false;
+    }
+    numRegs = plan.getBufferSize();
+
+    // Map the channels to the plan's register buffer
+    for ( unsigned i=0; i < numChannels; i++ )
+    {
+        uint16_t requestIdx;
+        channels[i].offset = plan.getItemOffset( (uint16_t) i, requestIdx );
+    }
+    return true;
+}
+
+/////////////////////////////////////////////
+const char* ModbusClient::getTypeGuid() const noexcept
+{
+    return GUID_STRING;
+}
+
+const char* ModbusClient::getTypeName() const noexcept
+{
+    return TYPE_NAME;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// NOTE: This method executes in the Driver Thread
+bool ModbusClient::drvStart() noexcept
+{
+    m_drvForceWrite = true;
+    return ModbusCommon_::drvStart();
+}
+
+// NOTE: This method executes in the Driver Thread
+void ModbusClient::drvInvalidateInputs() noexcept
+{
+    memset( m_drvInputs.isValid, 0, sizeof( m_drvInputs.isValid ) );
+    publishInputs();
+}
+
+// NOTE: This method executes in the Driver Thread
+void ModbusClient::drvPoll() noexcept
+{
+    Cpl::Io::InputOutput* stream = m_transport->connect();
+    if ( stream == nullptr )
+    {
+        m_drvNumErrors++;
+        m_drvForceWrite = true;
+        drvInvalidateInputs();
+        return;
+    }
+
+    // Write the outputs (only when they have changed)
+    size_t outputSize = m_numOutputRegs * sizeof( uint16_t );
+    if ( m_numOutputs > 0 && (m_drvForceWrite || (m_drvNewOutputs && memcmp( m_drvLastWritten, m_drvOutputs.regs, outputSize ) != 0)) )
+    {
+        if ( !m_client.execute( *stream, m_writePlan, m_drvOutputs.regs, m_drvResults ) )
+        {
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("Write failed (slot=%u)", m_slotNum) );
+            m_transport->disconnect();
+            m_drvNumErrors++;
+            m_drvForceWrite = true;
+            drvInvalidateInputs();
+            return;
+        }
+
+        // Retry on the next cycle if the remote device rejected a request
+        bool success = true;
+        for ( unsigned i=0; success && i < m_writePlan.getNumRequests(); i++ )
+        {
+            success = m_drvResults[i] == Driver::Modbus::Client::eSUCCESS;
+        }
+        if ( success )
+        {
+            memcpy( m_drvLastWritten, m_drvOutputs.regs, outputSize );
+            m_drvForceWrite = false;
+        }
+        else
+        {
+            m_drvNumErrors++;
+            m_drvForceWrite = true;
+        }
+    }
+    m_drvNewOutputs = false;
+
+    // Read the inputs
+    if ( m_numInputs > 0 )
+    {
+        if ( !m_client.execute( *stream, m_readPlan, m_drvInputs.regs, m_drvResults ) )
+        {
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("Read failed (slot=%u)", m_slotNum) );
+            m_transport->disconnect();
+            m_drvNumErrors++;
+            m_drvForceWrite = true;
+            drvInvalidateInputs();
+            return;
+        }
+
+        for ( unsigned i=0; i < m_numInputs; i++ )
+        {
+            uint16_t requestIdx;
+            m_readPlan.getItemOffset( (uint16_t) i, requestIdx );
+            m_drvInputs.isValid[i] = m_drvResults[requestIdx] == Driver::Modbus::Client::eSUCCESS;
+        }
+        publishInputs();
+    }
+}
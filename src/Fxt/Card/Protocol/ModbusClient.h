@@ -0,0 +1,184 @@
+#ifndef Fxt_Card_Protocol_ModbusClient_h_
+#define Fxt_Card_Protocol_ModbusClient_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Card/Protocol/ModbusCommon_.h"
+#include "Driver/Modbus/Planner.h"
+#include "Driver/Modbus/Client.h"
+
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Protocol {
+
+
+/** This concrete class implements an IO card that polls remote Modbus/TCP
+    device(s), i.e. the card is a Modbus client (aka master).  Input channels
+    are read from holding or input registers, and output channels are written
+    to holding registers.  A single card can poll multiple unit IDs (e.g.
+    the devices behind a Modbus/TCP gateway).
+
+    The register ranges of the channels are coalesced (see
+    Driver::Modbus::Planner) into the minimum number of requests when the card
+    is created, and the requests are pipelined (see Driver::Modbus::Client)
+    on the connection.  The polling executes in the card's driver thread, i.e.
+    the chassis thread never blocks on the network.
+
+    Each polling cycle the driver thread:
+        o Writes the output registers - but only when the output values have
+          changed since the last successful write (or after a reconnect)
+        o Reads the input registers and publishes them to the chassis thread
+
+    When a request fails (e.g. exception response) the input channels that
+    map to the request are set to invalid.  When the connection fails (e.g.
+    timeout) all of the input channels are set to invalid and the connection
+    is re-established on the next polling cycle.
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+      "name": "My Modbus Client Card",                      // *Text label for the card
+      "id": 0,                                              // *ID assigned to the card
+      "type": "5e0f6b9c-2a41-4d7e-9c3b-8f1a2d6e4b70",       // Identifies the card type.  Value comes from the Supported/Available-card-list
+      "typeName": "Fxt::Card::Protocol::ModbusClient",      // *Human readable type name
+      "slot": 0,                                            // Physical identifier. The containing node dedicates what are the valid values for 'slot' (i.e. slot number maps to a specific transport instance)
+      "driverInterval": <num_msec>,                         // REQUIRED: Polling rate/delay in milliseconds for the DRIVER level polling
+      "driverThread": 0,                                    // OPTIONAL: Index of the driver thread (when the factory uses a pool of driver threads). Default is 0
+      "unitId": 1,                                          // OPTIONAL: Default unit ID for the channels. Default is 1
+      "maxInFlight": 8,                                     // OPTIONAL: Maximum number of pipelined requests. Default is OPTION_DRIVER_MODBUS_MAX_IN_FLIGHT
+      "timeoutMs": 100,                                     // OPTIONAL: Response timeout in milliseconds. Default is OPTION_DRIVER_MODBUS_TIMEOUT_MS
+      "maxGap": 0,                                          // OPTIONAL: Maximum number of unused registers that are read to merge two ranges into one request. Default is 0
+      "points": {
+        "inputs": [                                         // Inputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // *Channel number (the channels are mapped by the order of the elements)
+            "id": 0,                                        // ID assigned to the Virtual Point that represents the input value
+            "ioRegId": 1,                                   // The ID of the Point's IO register.
+            "name": "My input#1 name"                       // *Text label for the input signal
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signal. Bool, integer, Float or Double Point type
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the input signal
+            "register": 100,                                // REQUIRED: Address of the first register
+            "unitId": 2,                                    // OPTIONAL: Unit ID. Default is the card's unit ID
+            "table": "holding"|"input"                      // OPTIONAL: Register table. Default is "holding"
+          }
+        ],
+        "outputs": [                                        // Outputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // *Channel number (the channels are mapped by the order of the elements)
+            "id": 10,                                       // ID assigned to the Virtual Point that represents the output value
+            "ioRegId": 11,                                  // The ID of the Point's IO register.
+            "name": "My output#1 name"                      // *Text label for the output signal
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the output signal. Bool, integer, Float or Double Point type
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the output signal
+            "register": 200,                                // REQUIRED: Address of the first (holding) register
+            "unitId": 2                                     // OPTIONAL: Unit ID. Default is the card's unit ID
+          }
+        ]
+      }
+    }
+
+    *The field is NOT parsed/used by the firmware
+
+    \endcode
+ */
+class ModbusClient : public ModbusCommon_
+{
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "5e0f6b9c-2a41-4d7e-9c3b-8f1a2d6e4b70";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Card::Protocol::ModbusClient";
+
+    /// Default unit ID
+    static constexpr uint8_t        DEFAULT_UNIT_ID = 1;
+
+public:
+    /// Constructor
+    ModbusClient( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                  Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                  Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                  Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                  Fxt::Point::DatabaseApi&           dbForPoints,
+                  JsonVariant&                       cardObject,
+                  Cpl::Dm::MailboxServer*            cardMbox,
+                  void*                              extraArgsNotUsed = nullptr );
+
+public:
+    /// See Fxt::Card::Api
+    const char* getTypeGuid() const noexcept;
+
+    /// See Fxt::Card::Api
+    const char* getTypeName() const noexcept;
+
+public:
+    /// Returns the number of read requests per polling cycle
+    inline uint16_t getNumReadRequests() const noexcept { return m_readPlan.getNumRequests(); }
+
+    /// Returns the number of write requests per polling cycle (when the outputs have changed)
+    inline uint16_t getNumWriteRequests() const noexcept { return m_writePlan.getNumRequests(); }
+
+protected:
+    /// Helper method to parse the card's JSON config
+    void parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                             Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                             Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                             Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                             Fxt::Point::DatabaseApi&           dbForPoints,
+                             JsonVariant&                       cardObject ) noexcept;
+
+    /// Helper method: builds a request plan and assigns the channels' register image offsets
+    bool buildPlan( Driver::Modbus::Planner& plan, Channel_T* channels, unsigned numChannels, uint16_t maxGap, uint16_t& numRegs ) noexcept;
+
+    /// Helper method: invalidates all of the input channels
+    void drvInvalidateInputs() noexcept;
+
+protected:
+    /// See Fxt::Card::Protocol::ModbusCommon_
+    bool drvStart() noexcept;
+
+    /// See Fxt::Card::Protocol::ModbusCommon_
+    void drvPoll() noexcept;
+
+protected:
+    /// Read requests
+    Driver::Modbus::Planner     m_readPlan;
+
+    /// Write requests
+    Driver::Modbus::Planner     m_writePlan;
+
+    /// Protocol engine
+    Driver::Modbus::Client      m_client;
+
+    /// Driver: Request results
+    uint8_t                     m_drvResults[MAX_CHANNELS];
+
+    /// Driver: Last successfully written output registers
+    uint16_t                    m_drvLastWritten[MAX_REGISTERS];
+
+    /// Driver: Set to true when the outputs must be written (regardless of their values)
+    bool                        m_drvForceWrite;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,48 @@
+#ifndef Fxt_Card_Protocol_ModbusClientFactory_h_
+#define Fxt_Card_Protocol_ModbusClientFactory_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Card/FactoryCommon_.h"
+#include "Fxt/Card/Protocol/ModbusClient.h"
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Protocol {
+
+
+/// Factory class for the Modbus Client card
+class ModbusClientFactory : public Fxt::Card::Factory<ModbusClient>
+{
+public:
+    /// Constructor -->require a Mailbox (and no extra args used)
+    ModbusClientFactory( FactoryDatabaseApi&  factoryDatabase, Cpl::Dm::MailboxServer* cardMbox )
+        : Fxt::Card::Factory<ModbusClient>( factoryDatabase, cardMbox )
+    {
+    }
+
+    /// Constructor -->cards are assigned to a driver thread from the pool (and no extra args used)
+    ModbusClientFactory( FactoryDatabaseApi&  factoryDatabase, DriverThreadPoolApi& driverThreads )
+        : Fxt::Card::Factory<ModbusClient>( factoryDatabase, driverThreads )
+    {
+    }
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,457 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "ModbusCommon_.h"
+#include "ModbusTransport.h"
+#include "Fxt/Point/Bool.h"
+#include "Driver/Modbus/Protocol.h"
+#include <string.h>
+
+///
+using namespace Fxt::Card::Protocol;
+
+
+///////////////////////////////////////////////////////////////////////////////
+ModbusCommon_::ModbusCommon_( JsonVariant& cardObject, Cpl::Dm::MailboxServer* cardMbox, uint8_t defaultUnitId ) noexcept
+    : Fxt::Card::Common_( countChannels( cardObject, "inputs", MAX_CHANNELS ), countChannels( cardObject, "outputs", MAX_CHANNELS ) )
+    , StartStopAsync( *cardMbox )
+    , Timer( *cardMbox )
+    , m_transport( nullptr )
+    , m_inChannels( nullptr )
+    , m_outChannels( nullptr )
+    , m_delayMs( 0 )
+    , m_numInputRegs( 0 )
+    , m_numOutputRegs( 0 )
+    , m_unitId( defaultUnitId )
+    , m_drvNumErrors( 0 )
+    , m_drvNewOutputs( false )
+{
+    memset( &m_drvInputs, 0, sizeof( m_drvInputs ) );
+    memset( &m_drvOutputs, 0, sizeof( m_drvOutputs ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ModbusCommon_::parseCommon( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                                 Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                                 Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                                 Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                                 Fxt::Point::DatabaseApi&           dbForPoints,
+                                 JsonVariant&                       cardObject ) noexcept
+{
+    // Get the transport instance
+    m_transport = ModbusTransport::get( m_slotNum );
+    if ( m_transport == nullptr )
+    {
+        m_error = fullErr( Err_T::DRIVER_ERROR );
+        m_error.logIt( "%s. No transport for slot %u", getTypeName(), m_slotNum );
+        return false;
+    }
+
+    // Parse/Create Virtual & IO Register points (Note: the channels are stored in JSON order)
+    if ( !parseInputOutputPoints( generalAllocator,
+                                  cardStatefulDataAllocator,
+                                  haStatefulDataAllocator,
+                                  pointFactoryDb,
+                                  dbForPoints,
+                                  cardObject,
+                                  false,
+                                  0, 0 ) )
+    {
+        return false;
+    }
+
+    // Note: The parent class allows for one more than the maximum channels (see countChannels())
+    if ( m_numInputs > MAX_CHANNELS || m_numOutputs > MAX_CHANNELS )
+    {
+        m_error = fullErr( m_numInputs > MAX_CHANNELS ? Err_T::TOO_MANY_INPUT_POINTS : Err_T::TOO_MANY_OUTPUT_POINTS );
+        m_error.logIt( getTypeName() );
+        return false;
+    }
+
+    // Parse background polling time
+    m_delayMs = cardObject["driverInterval"] | 0;
+    if ( m_delayMs < OPTION_FXT_CARD_PROTOCOL_MODBUS_MIN_DRIVER_INTERVAL_MS )
+    {
+        m_error = fullErr( m_delayMs == 0 ? Err_T::MISSING_REQUIRE_FIELD : Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. driverInterval", getTypeName() );
+        return false;
+    }
+
+    // Default unit ID
+    unsigned unitId = cardObject["unitId"] | (unsigned) m_unitId;
+    if ( unitId > 0xFF )
+    {
+        m_error = fullErr( Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. unitId", getTypeName() );
+        return false;
+    }
+    m_unitId = (uint8_t) unitId;
+
+    // Allocate the channel mappings
+    if ( m_numInputs > 0 )
+    {
+        m_inChannels = (Channel_T*) generalAllocator.allocate( sizeof( Channel_T ) * m_numInputs );
+    }
+    if ( m_numOutputs > 0 )
+    {
+        m_outChannels = (Channel_T*) generalAllocator.allocate( sizeof( Channel_T ) * m_numOutputs );
+    }
+    if ( (m_numInputs > 0 && m_inChannels == nullptr) || (m_numOutputs > 0 && m_outChannels == nullptr) )
+    {
+        m_error = fullErr( Err_T::MEMORY_CARD );
+        m_error.logIt( getTypeName() );
+        return false;
+    }
+
+    // Parse the register mappings
+    JsonArray inputs = cardObject["points"]["inputs"];
+    for ( unsigned idx=0; idx < m_numInputs; idx++ )
+    {
+        JsonObject channelObj = inputs[idx];
+        if ( !parseChannel( channelObj, m_inputIoRegisterPoints[idx], m_inChannels[idx], true ) )
+        {
+            return false;
+        }
+    }
+    JsonArray outputs = cardObject["points"]["outputs"];
+    for ( unsigned idx=0; idx < m_numOutputs; idx++ )
+    {
+        JsonObject channelObj = outputs[idx];
+        if ( !parseChannel( channelObj, m_outputIoRegisterPoints[idx], m_outChannels[idx], false ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ModbusCommon_::parseChannel( JsonObject& channelObj, Fxt::Point::Api* ioRegPt, Channel_T& dst, bool isInput ) noexcept
+{
+    // Number of registers
+    const char* guid = ioRegPt->getTypeGuid();
+    dst.intAttr      = Fxt::Point::NumericHandlers::getIntegerPointAttributes( guid );
+    dst.floatAttr    = Fxt::Point::NumericHandlers::getFloatPointAttributes( guid );
+    if ( dst.intAttr )
+    {
+        dst.numRegs = dst.intAttr->numBits <= 16 ? 1 : dst.intAttr->numBits / 16;
+    }
+    else if ( dst.floatAttr )
+    {
+        dst.numRegs = dst.floatAttr->numBits / 16;
+    }
+    else if ( strcmp( guid, Fxt::Point::Bool::GUID_STRING ) == 0 )
+    {
+        dst.numRegs = 1;
+    }
+    else
+    {
+        m_error = fullErr( Err_T::POINT_WRONG_TYPE );
+        m_error.logIt( "%s. ioRegId=%lu", getTypeName(), (unsigned long) ioRegPt->getId() );
+        return false;
+    }
+
+    // Register address
+    unsigned long address = channelObj["register"] | 0x10000UL;
+    if ( address + dst.numRegs > 0x10000UL )
+    {
+        m_error = fullErr( address == 0x10000UL ? Err_T::MISSING_REQUIRE_FIELD : Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. register (ioRegId=%lu)", getTypeName(), (unsigned long) ioRegPt->getId() );
+        return false;
+    }
+    dst.address = (uint16_t) address;
+    dst.offset  = 0;
+
+    // Unit ID
+    unsigned unitId = channelObj["unitId"] | (unsigned) m_unitId;
+    if ( unitId > 0xFF )
+    {
+        m_error = fullErr( Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. unitId (ioRegId=%lu)", getTypeName(), (unsigned long) ioRegPt->getId() );
+        return false;
+    }
+    dst.unitId = (uint8_t) unitId;
+
+    // Register table (only meaningful for inputs)
+    dst.functionCode     = isInput ? Driver::Modbus::Protocol::FC_READ_HOLDING : Driver::Modbus::Protocol::FC_WRITE_MULTIPLE;
+    const char* table    = channelObj["table"] | "holding";
+    if ( isInput && strcmp( table, "input" ) == 0 )
+    {
+        dst.functionCode = Driver::Modbus::Protocol::FC_READ_INPUT;
+    }
+    else if ( strcmp( table, "holding" ) != 0 )
+    {
+        m_error = fullErr( Err_T::INVALID_FIELD );
+        m_error.logIt( "%s. table=%s (ioRegId=%lu)", getTypeName(), table, (unsigned long) ioRegPt->getId() );
+        return false;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ModbusCommon_::encodeChannel( Fxt::Point::Api* pt, const Channel_T& channel, uint16_t* regs ) noexcept
+{
+    uint64_t value = 0;
+    bool     valid;
+    if ( channel.intAttr )
+    {
+        valid = channel.intAttr->readFunc( pt, value );
+    }
+    else if ( channel.floatAttr )
+    {
+        double realValue = 0.0;
+        valid            = channel.floatAttr->readFunc( pt, realValue );
+        if ( channel.floatAttr->numBits == 32 )
+        {
+            float    floatValue = (float) realValue;
+            uint32_t bits;
+            memcpy( &bits, &floatValue, sizeof( bits ) );
+            value = bits;
+        }
+        else
+        {
+            memcpy( &value, &realValue, sizeof( value ) );
+        }
+    }
+    else
+    {
+        bool boolValue = false;
+        valid          = ((Fxt::Point::Bool*) pt)->read( boolValue );
+        value          = boolValue ? 1 : 0;
+    }
+
+    if ( !valid )
+    {
+        value = 0;
+    }
+
+    // Most significant word first
+    for ( int i=channel.numRegs - 1; i >= 0; i-- )
+    {
+        regs[channel.offset + i]   = (uint16_t) value;
+        value                    >>= 16;
+    }
+    return valid;
+}
+
+void ModbusCommon_::decodeChannel( Fxt::Point::Api* pt, const Channel_T& channel, const uint16_t* regs ) noexcept
+{
+    // Most significant word first
+    uint64_t value = 0;
+    for ( unsigned i=0; i < channel.numRegs; i++ )
+    {
+        value = (value << 16) | regs[channel.offset + i];
+    }
+
+    if ( channel.intAttr )
+    {
+        unsigned numBits = channel.numRegs * 16;
+        if ( channel.intAttr->isSigned && numBits < 64 && (value & (1ULL << (numBits - 1))) )
+        {
+            value |= ~((1ULL << numBits) - 1);
+        }
+        channel.intAttr->writeFunc( pt, value );
+    }
+    else if ( channel.floatAttr )
+    {
+        if ( channel.floatAttr->numBits == 32 )
+        {
+            uint32_t bits = (uint32_t) value;
+            float    floatValue;
+            memcpy( &floatValue, &bits, sizeof( floatValue ) );
+            channel.floatAttr->writeFunc( pt, floatValue );
+        }
+        else
+        {
+            double realValue;
+            memcpy( &realValue, &value, sizeof( realValue ) );
+            channel.floatAttr->writeFunc( pt, realValue );
+        }
+    }
+    else
+    {
+        ((Fxt::Point::Bool*) pt)->write( value != 0 );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Executes in a Client thread (which will NEVER be the chassis thread)
+bool ModbusCommon_::start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Call the parent's start-up actions (note: returns false if ALREADY started OR if there is card error)
+    if ( !Common_::start( currentElapsedTimeUsec ) )
+    {
+        return false;
+    }
+
+    // Housekeeping
+    IoFlushAsync::start();
+    IoScanAsync::start();
+
+    // Initial outputs. Note: It is okay access the 'driver' data since the driver is NOT currently running
+    populateOutputsTransferBuffer( m_drvOutputs );
+    memset( m_drvInputs.isValid, 0, sizeof( m_drvInputs.isValid ) );
+    m_drvNewOutputs = true;
+    m_drvNumErrors  = 0;
+
+    // Request to start the driver (which executes in the driver thread)
+    return issueAsyncStartRequest( chassisMbox, currentElapsedTimeUsec );
+}
+
+// Note: This method executes in the 'driver thread'
+void ModbusCommon_::request( StartReqMsg& msg )
+{
+    StartRequest::StartPayload& payload = msg.getPayload();
+    payload.m_success                   = false;
+
+    if ( drvStart() )
+    {
+        // Start the background polling
+        expired();
+        payload.m_success = true;
+    }
+
+    // Complete the ITC transaction
+    msg.returnToSender();
+}
+
+// Note: This method executes in the 'chassis thread'
+void ModbusCommon_::response( StartRspMsg& msg )
+{
+    if ( msg.getPayload().m_success == false )
+    {
+        m_error = fullErr( Err_T::DRIVER_ERROR );
+        m_error.logIt( getTypeName() );
+    }
+
+    startTransactionCompleted();
+}
+
+// Executes in a Client thread (which will NEVER be the chassis thread)
+void ModbusCommon_::stop( Cpl::Itc::PostApi& chassisMbox ) noexcept
+{
+    if ( m_started )
+    {
+        // Request the driver to stop (which executes in the driver thread)
+        issueAsyncStopRequest( chassisMbox );
+    }
+}
+
+// Note: This method executes in the 'driver thread'
+void ModbusCommon_::request( StopReqMsg& msg )
+{
+    Timer::stop();
+    drvStop();
+    msg.returnToSender();
+}
+
+// Note: This method executes in the chassis thread
+void ModbusCommon_::response( StopRspMsg& msg )
+{
+    Common_::stop();
+    stopTransactionCompleted();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ModbusCommon_::drvStart() noexcept
+{
+    return m_transport != nullptr;
+}
+
+void ModbusCommon_::drvStop() noexcept
+{
+    m_transport->disconnect();
+}
+
+// NOTE: This method executes in the Driver Thread
+void ModbusCommon_::expired() noexcept
+{
+    // Get the latest output values from the chassis (if any)
+    if ( extractOutputs() )
+    {
+        m_drvNewOutputs = true;
+    }
+
+    drvPoll();
+
+    // Restart my polling timer
+    Timer::start( m_delayMs );
+}
+
+// NOTE: executes in the driver thread
+void ModbusCommon_::extractOutputsTransferBuffer( const ModbusRegisters_T& srcTransferBuffer ) noexcept
+{
+    memcpy( m_drvOutputs.regs, srcTransferBuffer.regs, m_numOutputRegs * sizeof( uint16_t ) );
+    memcpy( m_drvOutputs.isValid, srcTransferBuffer.isValid, m_numOutputs * sizeof( bool ) );
+}
+
+// NOTE: executes in the driver thread
+void ModbusCommon_::populateInputsTransferBuffer( ModbusRegisters_T& dstTransferBuffer ) noexcept
+{
+    memcpy( dstTransferBuffer.regs, m_drvInputs.regs, m_numInputRegs * sizeof( uint16_t ) );
+    memcpy( dstTransferBuffer.isValid, m_drvInputs.isValid, m_numInputs * sizeof( bool ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Note: This method executes in the 'Chassis thread'
+bool ModbusCommon_::scanInputs( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Update the Input IO Registers with the latest driver data (if any)
+    extractInputs();
+
+    // Call parent class to manage the transfer between IO Registers and Virtual Points
+    bool result = Common_::scanInputs( currentElapsedTimeUsec );
+
+    // Check for failures (including the async failures in starting the driver)
+    return result && m_error == Fxt::Type::Error::SUCCESS();
+}
+
+// Note: This method executes in the 'Chassis thread'
+void ModbusCommon_::extractInputsTransferBuffer( const ModbusRegisters_T& srcTransferBuffer ) noexcept
+{
+    for ( unsigned i=0; i < m_numInputs; i++ )
+    {
+        if ( srcTransferBuffer.isValid[i] )
+        {
+            decodeChannel( m_inputIoRegisterPoints[i], m_inChannels[i], srcTransferBuffer.regs );
+        }
+        else
+        {
+            m_inputIoRegisterPoints[i]->setInvalid();
+        }
+    }
+}
+
+// NOTE: executes in the Chassis thread
+bool ModbusCommon_::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // Call parent class to manage the transfer between IO Registers and Virtual Points
+    bool result = Common_::flushOutputs( currentElapsedTimeUsec );
+
+    // Make the data available to the driver thread
+    if ( result && m_numOutputs > 0 )
+    {
+        publishOutputs();
+    }
+
+    // Check for failures (including the async failures in starting the driver)
+    return result && m_error == Fxt::Type::Error::SUCCESS();
+}
+
+// NOTE: executes in the Chassis thread
+void ModbusCommon_::populateOutputsTransferBuffer( ModbusRegisters_T& dstTransferBuffer ) noexcept
+{
+    for ( unsigned i=0; i < m_numOutputs; i++ )
+    {
+        dstTransferBuffer.isValid[i] = encodeChannel( m_outputIoRegisterPoints[i], m_outChannels[i], dstTransferBuffer.regs );
+    }
+}
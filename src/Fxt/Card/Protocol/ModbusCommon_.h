@@ -0,0 +1,235 @@
+#ifndef Fxt_Card_Protocol_ModbusCommon_h_
+#define Fxt_Card_Protocol_ModbusCommon_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Card/Common_.h"
+#include "Fxt/Card/StartStopAsync.h"
+#include "Fxt/Card/IoFlushAsync.h"
+#include "Fxt/Card/IoScanAsync.h"
+#include "Fxt/Point/NumericHandlers.h"
+#include "Driver/Modbus/TransportApi.h"
+#include "Cpl/System/Timer.h"
+#include "Cpl/Json/Arduino.h"
+
+/// Maximum number of input channels (and separately output channels) for a Modbus card
+#ifndef OPTION_FXT_CARD_PROTOCOL_MODBUS_MAX_CHANNELS
+#define OPTION_FXT_CARD_PROTOCOL_MODBUS_MAX_CHANNELS        128
+#endif
+
+/// Maximum number of registers that the input channels (and separately the output channels) of a Modbus card can map to
+#ifndef OPTION_FXT_CARD_PROTOCOL_MODBUS_MAX_REGISTERS
+#define OPTION_FXT_CARD_PROTOCOL_MODBUS_MAX_REGISTERS       256
+#endif
+
+/// Minimum driver-background polling time in milliseconds
+#ifndef OPTION_FXT_CARD_PROTOCOL_MODBUS_MIN_DRIVER_INTERVAL_MS
+#define OPTION_FXT_CARD_PROTOCOL_MODBUS_MIN_DRIVER_INTERVAL_MS  1
+#endif
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Protocol {
+
+
+/// Data structure used to transfer register data between the driver thread and the chassis thread
+struct ModbusRegisters_T
+{
+    uint16_t regs[OPTION_FXT_CARD_PROTOCOL_MODBUS_MAX_REGISTERS];       //!< Register image.  The location of a channel's registers is card specific
+    bool     isValid[OPTION_FXT_CARD_PROTOCOL_MODBUS_MAX_CHANNELS];     //!< Valid state of each channel.  Order is the same as the JSON channel array
+};
+
+
+/** This partially concrete class provides the common infrastructure for the
+    Modbus cards, i.e. the mapping of Points to Modbus registers, the transfer
+    of register images between the chassis thread and the driver thread (via
+    lock-free triple buffers), and the start/stop of the driver (via ITC).
+
+    Point to register mapping:
+        o Bool:     1 register (0 = false, non-zero = true)
+        o Integers: 1 register for 8/16 bit integers, 2 registers for 32 bit
+                    integers, 4 registers for 64 bit integers.  Multi-register
+                    values are stored most significant word first.  Signed
+                    values are sign extended when read from the registers.
+        o Float:    2 registers (IEEE-754 single precision bit pattern, most
+                    significant word first)
+        o Double:   4 registers (IEEE-754 double precision bit pattern, most
+                    significant word first)
+
+    An invalid output Point is written to the registers as zero.
+
+    The child class is responsible for assigning the location of each
+    channel's registers in the register image (Channel_T::offset) and for
+    the driver thread's polling actions.
+
+    NOTES:
+        - The Factory class is responsible for providing the Mailbox (either a
+          single mailbox or a pool of driver threads)
+        - The application is responsible for providing the transport instance
+          via the ModbusTransport class.  The look-up for the transport
+          instance is based on slot number.
+ */
+class ModbusCommon_ :
+    public Fxt::Card::Common_,
+    public Fxt::Card::StartStopAsync,
+    public Fxt::Card::IoFlushAsync<ModbusRegisters_T>,
+    public Fxt::Card::IoScanAsync<ModbusRegisters_T>,
+    public Cpl::System::Timer
+{
+public:
+    /// Maximum number of input/output channels
+    static constexpr unsigned   MAX_CHANNELS  = OPTION_FXT_CARD_PROTOCOL_MODBUS_MAX_CHANNELS;
+
+    /// Maximum number of registers per direction
+    static constexpr unsigned   MAX_REGISTERS = OPTION_FXT_CARD_PROTOCOL_MODBUS_MAX_REGISTERS;
+
+public:
+    /// See Fxt::Card::Api (invokes the ITC start request)
+    bool start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api (invokes the ITC stop request)
+    void stop( Cpl::Itc::PostApi& chassisMbox ) noexcept;
+
+    /// See Fxt::Card::Api
+    bool scanInputs( uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Card::Api
+    bool flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept;
+
+public:
+    /// ITC Start request (runs in the driver thread)
+    void request( StartReqMsg& msg );
+
+    /// ITC Start response (runs in the chassis thread)
+    void response( StartRspMsg& msg );
+
+public:
+    /// ITC Stop request (runs in the driver thread)
+    void request( StopReqMsg& msg );
+
+    /// ITC Stop response (runs in the chassis thread)
+    void response( StopRspMsg& msg );
+
+public:
+    /// Returns the number of failed Modbus transactions/connection attempts (since the card was started)
+    inline uint32_t getNumDriverErrors() const noexcept { return m_drvNumErrors; }
+
+protected:
+    /// Register mapping for a single channel
+    struct Channel_T
+    {
+        const Fxt::Point::NumericHandlers::IntegerAttributes_T* intAttr;    //!< Integer handlers (nullptr if not an integer Point)
+        const Fxt::Point::NumericHandlers::FloatAttributes_T*   floatAttr;  //!< Float handlers (nullptr if not a floating point Point)
+        uint16_t                                                address;    //!< Modbus register address of the first register
+        uint16_t                                                offset;     //!< Offset of the first register in the register image
+        uint8_t                                                 numRegs;    //!< Number of registers
+        uint8_t                                                 unitId;     //!< Modbus unit ID
+        uint8_t                                                 functionCode; //!< Modbus read function code (inputs only)
+    };
+
+protected:
+    /// Constructor
+    ModbusCommon_( JsonVariant& cardObject, Cpl::Dm::MailboxServer* cardMbox, uint8_t defaultUnitId ) noexcept;
+
+    /** Helper method that parses the configuration that is common to all
+        Modbus cards (i.e. the points, the driver interval, and the register
+        mapping for each channel).  Returns false (and sets m_error) if an
+        error was encountered.
+     */
+    bool parseCommon( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                      Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                      Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                      Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                      Fxt::Point::DatabaseApi&           dbForPoints,
+                      JsonVariant&                       cardObject ) noexcept;
+
+    /// Helper method: parses the register mapping for a single channel
+    bool parseChannel( JsonObject& channelObj, Fxt::Point::Api* ioRegPt, Channel_T& dst, bool isInput ) noexcept;
+
+    /// Writes a Point's value to the register image. Returns false if the Point is invalid
+    static bool encodeChannel( Fxt::Point::Api* pt, const Channel_T& channel, uint16_t* regs ) noexcept;
+
+    /// Updates a Point from the register image
+    static void decodeChannel( Fxt::Point::Api* pt, const Channel_T& channel, const uint16_t* regs ) noexcept;
+
+protected:
+    /// Driver start action (executes in the driver thread). Returns false if the driver failed to start
+    virtual bool drvStart() noexcept;
+
+    /// Driver polling action (executes in the driver thread)
+    virtual void drvPoll() noexcept = 0;
+
+    /// Driver stop action (executes in the driver thread)
+    virtual void drvStop() noexcept;
+
+    /// Background polling timer expired (executes in the driver thread)
+    void expired( void ) noexcept;
+
+protected:
+    /// See Fxt::Card::IoScanAsync
+    void populateInputsTransferBuffer( ModbusRegisters_T& dstTransferBuffer ) noexcept;
+
+    /// See Fxt::Card::IoScanAsync
+    void extractInputsTransferBuffer( const ModbusRegisters_T& srcTransferBuffer ) noexcept;
+
+    /// See Fxt::Card::IoFlushAsync
+    void populateOutputsTransferBuffer( ModbusRegisters_T& dstTransferBuffer ) noexcept;
+
+    /// See Fxt::Card::IoFlushAsync
+    void extractOutputsTransferBuffer( const ModbusRegisters_T& srcTransferBuffer ) noexcept;
+
+protected:
+    /// Transport instance
+    Driver::Modbus::TransportApi*   m_transport;
+
+    /// Input channel mapping
+    Channel_T*                      m_inChannels;
+
+    /// Output channel mapping
+    Channel_T*                      m_outChannels;
+
+    /// Polling delay, in milliseconds
+    unsigned long                   m_delayMs;
+
+    /// Number of registers (in the register image) used by the input channels
+    uint16_t                        m_numInputRegs;
+
+    /// Number of registers (in the register image) used by the output channels
+    uint16_t                        m_numOutputRegs;
+
+    /// Default unit ID for the channels
+    uint8_t                         m_unitId;
+
+
+    /// Driver: latest input values
+    ModbusRegisters_T               m_drvInputs;
+
+    /// Driver: latest output values
+    ModbusRegisters_T               m_drvOutputs;
+
+    /// Driver: Number of errors
+    uint32_t                        m_drvNumErrors;
+
+    /// Driver: Set to true when new output values have been received from the chassis
+    bool                            m_drvNewOutputs;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,147 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "ModbusServer.h"
+#include "Cpl/System/Trace.h"
+#include <new>
+#include <string.h>
+
+#define SECT_ "Fxt::Card::Protocol::ModbusServer"
+
+///
+using namespace Fxt::Card::Protocol;
+
+
+///////////////////////////////////////////////////////////////////////////////
+ModbusServer::ModbusServer( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                            Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                            Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                            Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                            Fxt::Point::DatabaseApi&           dbForPoints,
+                            JsonVariant&                       cardObject,
+                            Cpl::Dm::MailboxServer*            cardMbox,
+                            void*                              extraArgsNotUsed )
+    : ModbusCommon_( cardObject, cardMbox, DEFAULT_UNIT_ID )
+    , m_server( nullptr )
+    , m_drvLastWriteCount( 0 )
+{
+    if ( initialize( generalAllocator, cardObject ) )
+    {
+        parseConfiguration( generalAllocator, cardStatefulDataAllocator, haStatefulDataAllocator, pointFactoryDb, dbForPoints, cardObject );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ModbusServer::parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                                       Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                                       Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                                       Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                                       Fxt::Point::DatabaseApi&           dbForPoints,
+                                       JsonVariant&                       cardObject ) noexcept
+{
+    if ( !parseCommon( generalAllocator, cardStatefulDataAllocator, haStatefulDataAllocator, pointFactoryDb, dbForPoints, cardObject ) )
+    {
+        return;
+    }
+
+    // The register address is the offset in the register image
+    if ( !mapRegisters( m_inChannels, m_numInputs, m_numInputRegs ) ||
+         !mapRegisters( m_outChannels, m_numOutputs, m_numOutputRegs ) )
+    {
+        return;
+    }
+
+    // Create the protocol engine
+    void* memServer = generalAllocator.allocate( sizeof( Driver::Modbus::Server ) );
+    if ( memServer == nullptr )
+    {
+        m_error = fullErr( Err_T::MEMORY_CARD );
+        m_error.logIt( getTypeName() );
+        return;
+    }
+    m_server = new(memServer) Driver::Modbus::Server( m_unitId, m_drvInputs.regs, m_numInputRegs, m_drvOutputs.regs, m_numOutputRegs, m_drvWritten );
+}
+
+bool ModbusServer::mapRegisters( Channel_T* channels, unsigned numChannels, uint16_t& numRegs ) noexcept
+{
+    numRegs = 0;
+    for ( unsigned i=0; i < numChannels; i++ )
+    {
+        unsigned endAddress = channels[i].address + channels[i].numRegs;
+        if ( endAddress > MAX_REGISTERS )
+        {
+            m_error = fullErr( Err_T::INVALID_FIELD );
+            m_error.logIt( "%s. register=%u", getTypeName(), channels[i].address );
+            return false;
+        }
+        channels[i].offset = channels[i].address;
+        if ( endAddress > numRegs )
+        {
+            numRegs = (uint16_t) endAddress;
+        }
+    }
+    return true;
+}
+
+/////////////////////////////////////////////
+const char* ModbusServer::getTypeGuid() const noexcept
+{
+    return GUID_STRING;
+}
+
+const char* ModbusServer::getTypeName() const noexcept
+{
+    return TYPE_NAME;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// NOTE: This method executes in the Driver Thread
+bool ModbusServer::drvStart() noexcept
+{
+    memset( m_drvWritten, 0, sizeof( m_drvWritten ) );
+    memset( m_drvInputs.regs, 0, sizeof( m_drvInputs.regs ) );
+    m_drvLastWriteCount = m_server->getWriteCount();
+    m_server->reset();
+    return ModbusCommon_::drvStart();
+}
+
+// NOTE: This method executes in the Driver Thread
+void ModbusServer::drvPoll() noexcept
+{
+    // Service the remote client (if there is one)
+    Cpl::Io::InputOutput* stream = m_transport->connect();
+    if ( stream && !m_server->service( *stream ) )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Connection dropped (slot=%u)", m_slotNum) );
+        m_transport->disconnect();
+        m_server->reset();
+        m_drvNumErrors++;
+    }
+
+    // Publish the inputs when the remote client has written to the holding registers
+    uint32_t writeCount = m_server->getWriteCount();
+    if ( writeCount != m_drvLastWriteCount )
+    {
+        m_drvLastWriteCount = writeCount;
+        for ( unsigned i=0; i < m_numInputs; i++ )
+        {
+            bool valid = true;
+            for ( unsigned j=0; j < m_inChannels[i].numRegs; j++ )
+            {
+                valid = valid && m_drvWritten[m_inChannels[i].offset + j];
+            }
+            m_drvInputs.isValid[i] = valid;
+        }
+        publishInputs();
+    }
+}
@@ -0,0 +1,151 @@
+#ifndef Fxt_Card_Protocol_ModbusServer_h_
+#define Fxt_Card_Protocol_ModbusServer_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Card/Protocol/ModbusCommon_.h"
+#include "Driver/Modbus/Server.h"
+
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Protocol {
+
+
+/** This concrete class implements an IO card that exposes its Points as
+    Modbus registers to a remote Modbus/TCP client (e.g. a SCADA system),
+    i.e. the card is a Modbus server (aka slave).
+        o Input channels are mapped to holding registers.  The input values
+          are written by the remote client.  An input channel is invalid
+          until all of its registers have been written by the remote client
+          (since the card was started).
+        o Output channels are mapped to input registers.  The remote client
+          reads the output values.  An invalid output is read as zero.
+
+    The remote client can also read the holding registers, i.e. read back the
+    input values.  The connection is serviced in the card's driver thread,
+    i.e. the chassis thread never blocks on the network.  The latency from a
+    remote write to the chassis is at most one 'driverInterval'.
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+      "name": "My Modbus Server Card",                      // *Text label for the card
+      "id": 0,                                              // *ID assigned to the card
+      "type": "c8d2a7e1-4f3b-4a96-b5e0-7d9c1f2a3e84",       // Identifies the card type.  Value comes from the Supported/Available-card-list
+      "typeName": "Fxt::Card::Protocol::ModbusServer",      // *Human readable type name
+      "slot": 0,                                            // Physical identifier. The containing node dedicates what are the valid values for 'slot' (i.e. slot number maps to a specific transport instance)
+      "driverInterval": <num_msec>,                         // REQUIRED: Polling rate/delay in milliseconds for servicing the connection
+      "driverThread": 0,                                    // OPTIONAL: Index of the driver thread (when the factory uses a pool of driver threads). Default is 0
+      "unitId": 255,                                        // OPTIONAL: Unit ID of the server. 255 responds to all unit IDs. Default is 255
+      "points": {
+        "inputs": [                                         // Inputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // *Channel number (the channels are mapped by the order of the elements)
+            "id": 0,                                        // ID assigned to the Virtual Point that represents the input value
+            "ioRegId": 1,                                   // The ID of the Point's IO register.
+            "name": "My input#1 name"                       // *Text label for the input signal
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signal. Bool, integer, Float or Double Point type
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the input signal
+            "register": 0                                   // REQUIRED: Address of the first holding register
+          }
+        ],
+        "outputs": [                                        // Outputs. The number of channels is the number of elements in the array
+          {
+            "channel": 1                                    // *Channel number (the channels are mapped by the order of the elements)
+            "id": 10,                                       // ID assigned to the Virtual Point that represents the output value
+            "ioRegId": 11,                                  // The ID of the Point's IO register.
+            "name": "My output#1 name"                      // *Text label for the output signal
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the output signal. Bool, integer, Float or Double Point type
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the output signal
+            "register": 0                                   // REQUIRED: Address of the first input register
+          }
+        ]
+      }
+    }
+
+    *The field is NOT parsed/used by the firmware
+
+    \endcode
+ */
+class ModbusServer : public ModbusCommon_
+{
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "c8d2a7e1-4f3b-4a96-b5e0-7d9c1f2a3e84";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Card::Protocol::ModbusServer";
+
+    /// Default unit ID (i.e. respond to all unit IDs)
+    static constexpr uint8_t        DEFAULT_UNIT_ID = 0xFF;
+
+public:
+    /// Constructor
+    ModbusServer( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                  Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                  Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                  Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                  Fxt::Point::DatabaseApi&           dbForPoints,
+                  JsonVariant&                       cardObject,
+                  Cpl::Dm::MailboxServer*            cardMbox,
+                  void*                              extraArgsNotUsed = nullptr );
+
+public:
+    /// See Fxt::Card::Api
+    const char* getTypeGuid() const noexcept;
+
+    /// See Fxt::Card::Api
+    const char* getTypeName() const noexcept;
+
+protected:
+    /// Helper method to parse the card's JSON config
+    void parseConfiguration( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                             Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+                             Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                             Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                             Fxt::Point::DatabaseApi&           dbForPoints,
+                             JsonVariant&                       cardObject ) noexcept;
+
+    /// Helper method: assigns the channels' register image offsets (i.e. the register address)
+    bool mapRegisters( Channel_T* channels, unsigned numChannels, uint16_t& numRegs ) noexcept;
+
+protected:
+    /// See Fxt::Card::Protocol::ModbusCommon_
+    bool drvStart() noexcept;
+
+    /// See Fxt::Card::Protocol::ModbusCommon_
+    void drvPoll() noexcept;
+
+protected:
+    /// Protocol engine (Note: the register tables are the driver's input/output register images)
+    Driver::Modbus::Server*     m_server;
+
+    /// Driver: Holding registers that have been written by the remote client
+    bool                        m_drvWritten[MAX_REGISTERS];
+
+    /// Driver: Server write count when the inputs were last published
+    uint32_t                    m_drvLastWriteCount;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
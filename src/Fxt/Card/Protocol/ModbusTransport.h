@@ -0,0 +1,46 @@
+#ifndef Fxt_Card_Protocol_ModbusTransport_h_
+#define Fxt_Card_Protocol_ModbusTransport_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Driver/Modbus/TransportApi.h"
+#include <stdint.h>
+
+///
+namespace Fxt {
+///
+namespace Card {
+///
+namespace Protocol {
+
+/** This class is used to get access to the Modbus transport (i.e. the
+    connection to the remote Modbus/TCP device(s) or client) for a Modbus card.
+
+    The Application/concrete Node is responsible for implementing this class.
+ */
+class ModbusTransport
+{
+public:
+    /** This method returns a Modbus transport instance based on the
+        specified slot number.
+
+        The method returns a null pointer when/if the specified slot is 'out-of-range'.
+
+        The application/concrete Node defines what the valid slot number range is.
+     */
+    static Driver::Modbus::TransportApi* get( uint8_t slotNumber ) noexcept;
+};
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
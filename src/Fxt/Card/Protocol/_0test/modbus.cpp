@@ -0,0 +1,318 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Card/Protocol/ModbusClient.h"
+#include "Fxt/Card/Protocol/ModbusServer.h"
+#include "Fxt/Card/Protocol/ModbusTransport.h"
+#include "Driver/Modbus/Loopback.h"
+#include "Fxt/Point/Float.h"
+#include "Fxt/Point/Bool.h"
+#include "Fxt/Point/Int32.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Factory.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/Dm/MailboxServer.h"
+#include "Cpl/System/Thread.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/Trace.h"
+#include "Cpl/Math/real.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+///
+using namespace Fxt::Card::Protocol;
+
+#define FLOAT_TYPE      "\"type\": \"708745fa-cef6-4364-abad-063a40f35cbc\""
+#define BOOL_TYPE       "\"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\""
+#define INT32_TYPE      "\"type\": \"c357de9a-a10b-4c87-83b9-ed230135752d\""
+
+#define CLIENT_DEFINITION   "{ \"slot\": 0, \"driverInterval\": 5, \"maxInFlight\": 2," \
+                            "  \"points\": { \"inputs\": [" \
+                            "    { \"channel\": 1, \"id\": 1, \"ioRegId\": 2, " FLOAT_TYPE ", \"register\": 10 }," \
+                            "    { \"channel\": 2, \"id\": 3, \"ioRegId\": 4, " INT32_TYPE ", \"register\": 12 }," \
+                            "    { \"channel\": 3, \"id\": 5, \"ioRegId\": 6, " BOOL_TYPE ", \"register\": 3, \"table\": \"input\" }," \
+                            "    { \"channel\": 4, \"id\": 7, \"ioRegId\": 8, " BOOL_TYPE ", \"register\": 0, \"unitId\": 9 } ]," \
+                            "  \"outputs\": [" \
+                            "    { \"channel\": 1, \"id\": 11, \"ioRegId\": 12, " FLOAT_TYPE ", \"register\": 100 }," \
+                            "    { \"channel\": 2, \"id\": 13, \"ioRegId\": 14, " BOOL_TYPE ", \"register\": 102 } ] } }"
+
+#define SERVER_DEFINITION   "{ \"slot\": 1, \"driverInterval\": 5," \
+                            "  \"points\": { \"inputs\": [" \
+                            "    { \"channel\": 1, \"id\": 21, \"ioRegId\": 22, " FLOAT_TYPE ", \"register\": 0 }," \
+                            "    { \"channel\": 2, \"id\": 23, \"ioRegId\": 24, " BOOL_TYPE ", \"register\": 2 } ]," \
+                            "  \"outputs\": [" \
+                            "    { \"channel\": 1, \"id\": 25, \"ioRegId\": 26, " INT32_TYPE ", \"register\": 0 }," \
+                            "    { \"channel\": 2, \"id\": 27, \"ioRegId\": 28, " BOOL_TYPE ", \"register\": 2 } ] } }"
+
+#define BAD_TABLE_DEFINITION "{ \"slot\": 0, \"driverInterval\": 5," \
+                             "  \"points\": { \"inputs\": [" \
+                             "    { \"channel\": 1, \"id\": 31, \"ioRegId\": 32, " FLOAT_TYPE ", \"register\": 10, \"table\": \"coils\" } ] } }"
+
+#define NO_TRANSPORT_DEFINITION "{ \"slot\": 7, \"driverInterval\": 5," \
+                                "  \"points\": { \"inputs\": [" \
+                                "    { \"channel\": 1, \"id\": 41, \"ioRegId\": 42, " FLOAT_TYPE ", \"register\": 10 } ] } }"
+
+#define MAX_POINTS      100
+#define WAIT_LOOPS      200
+
+static size_t generalHeap_[10000];
+static size_t cardStateFullHeap_[10000];
+static size_t haStateFullHeap_[10000];
+static size_t planHeap_[1000];
+
+static Driver::Modbus::Loopback loopbacks_[2];
+
+Driver::Modbus::TransportApi* ModbusTransport::get( uint8_t slotNumber ) noexcept
+{
+    return slotNumber < 2 ? &loopbacks_[slotNumber] : nullptr;
+}
+
+static void writeFloatRegs( uint16_t* regs, float value )
+{
+    uint32_t bits;
+    memcpy( &bits, &value, sizeof( bits ) );
+    regs[0] = (uint16_t) (bits >> 16);
+    regs[1] = (uint16_t) bits;
+}
+
+static void waitForStop( Fxt::Card::Api& card )
+{
+    for ( int i=0; i < WAIT_LOOPS && card.isStarted(); i++ )
+    {
+        Cpl::System::Api::sleep( 10 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Modbus cards" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap                              generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap                              cardStatefulAllocator( cardStateFullHeap_, sizeof( cardStateFullHeap_ ) );
+    Cpl::Memory::LeanHeap                              haStatefulAllocator( haStateFullHeap_, sizeof( haStateFullHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    Fxt::Point::Factory<Fxt::Point::Float>             factoryFloat( pointFactoryDb );
+    Fxt::Point::Factory<Fxt::Point::Bool>              factoryBool( pointFactoryDb );
+    Fxt::Point::Factory<Fxt::Point::Int32>             factoryInt32( pointFactoryDb );
+    Cpl::Dm::MailboxServer                             driverMbox;
+    Cpl::Dm::MailboxServer                             chassisMbox;
+    Cpl::System::Thread*                               driverThread  = Cpl::System::Thread::create( driverMbox, "Driver" );
+    Cpl::System::Thread*                               chassisThread = Cpl::System::Thread::create( chassisMbox, "Chassis" );
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> errText;
+    StaticJsonDocument<4096>                           doc;
+    uint64_t                                           now = 0;
+
+    SECTION( "client" )
+    {
+        // Remote device
+        uint16_t holding[200];
+        uint16_t input[10];
+        bool     written[200];
+        memset( holding, 0, sizeof( holding ) );
+        memset( input, 0, sizeof( input ) );
+        memset( written, 0, sizeof( written ) );
+        writeFloatRegs( holding + 10, 1.5F );
+        holding[12] = 0xFFFF;   // -5 as an int32
+        holding[13] = 0xFFFB;
+        input[3]    = 1;
+        Driver::Modbus::Server remote( 1, holding, 200, input, 10, written );
+        REQUIRE( loopbacks_[0].attach( remote ) );
+
+        REQUIRE( deserializeJson( doc, CLIENT_DEFINITION ) == DeserializationError::Ok );
+        JsonVariant  cardObj = doc.as<JsonVariant>();
+        ModbusClient uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj, &driverMbox );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( uut.getErrorCode(), errText )) );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), ModbusClient::GUID_STRING ) == 0 );
+        REQUIRE( uut.getNumReadRequests() == 3 );   // Holding 10-13 (unit 1), Input 3 (unit 1), Holding 0 (unit 9)
+        REQUIRE( uut.getNumWriteRequests() == 1 );  // Holding 100-102 (unit 1)
+
+        REQUIRE( uut.start( chassisMbox, now ) );
+
+        // Wait for the first poll
+        float   floatVal = 0.0F;
+        int32_t intVal   = 0;
+        bool    boolVal  = false;
+        for ( int i=0; i < WAIT_LOOPS; i++ )
+        {
+            Cpl::System::Api::sleep( 10 );
+            REQUIRE( uut.scanInputs( now ) );
+            if ( ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->read( floatVal ) )
+            {
+                break;
+            }
+        }
+        REQUIRE( Cpl::Math::areFloatsEqual( floatVal, 1.5F ) );
+        REQUIRE( ((Fxt::Point::Int32*) pointDb.lookupById( 3 ))->read( intVal ) );
+        REQUIRE( intVal == -5 );
+        REQUIRE( ((Fxt::Point::Bool*) pointDb.lookupById( 5 ))->read( boolVal ) );
+        REQUIRE( boolVal );
+        REQUIRE( pointDb.lookupById( 7 )->isNotValid() );   // Unknown unit ID -->exception response
+
+        // Outputs (Note: start() sets the initial point values)
+        uint32_t writeCount = 0;
+        ((Fxt::Point::Float*) pointDb.lookupById( 11 ))->write( 2.5F );
+        ((Fxt::Point::Bool*) pointDb.lookupById( 13 ))->write( true );
+        REQUIRE( uut.flushOutputs( now ) );
+        for ( int i=0; i < WAIT_LOOPS; i++ )
+        {
+            Cpl::System::Api::sleep( 10 );
+            Cpl::System::Mutex::ScopeBlock criticalSection( loopbacks_[0].getLock() );
+            if ( written[102] )
+            {
+                break;
+            }
+        }
+        {
+            Cpl::System::Mutex::ScopeBlock criticalSection( loopbacks_[0].getLock() );
+            uint16_t expected[2];
+            writeFloatRegs( expected, 2.5F );
+            REQUIRE( holding[100] == expected[0] );
+            REQUIRE( holding[101] == expected[1] );
+            REQUIRE( holding[102] == 1 );
+            writeCount = remote.getWriteCount();
+        }
+
+        // Unchanged outputs are NOT re-written
+        REQUIRE( uut.flushOutputs( now ) );
+        Cpl::System::Api::sleep( 50 );
+        {
+            Cpl::System::Mutex::ScopeBlock criticalSection( loopbacks_[0].getLock() );
+            REQUIRE( remote.getWriteCount() == writeCount );
+        }
+
+        // Lost connection
+        loopbacks_[0].setConnectionAllowed( false );
+        for ( int i=0; i < WAIT_LOOPS; i++ )
+        {
+            Cpl::System::Api::sleep( 10 );
+            REQUIRE( uut.scanInputs( now ) );
+            if ( pointDb.lookupById( 1 )->isNotValid() )
+            {
+                break;
+            }
+        }
+        REQUIRE( pointDb.lookupById( 1 )->isNotValid() );
+        REQUIRE( uut.getNumDriverErrors() > 0 );
+
+        // Reconnect -->the outputs are re-written
+        loopbacks_[0].setConnectionAllowed( true );
+        for ( int i=0; i < WAIT_LOOPS; i++ )
+        {
+            Cpl::System::Api::sleep( 10 );
+            REQUIRE( uut.scanInputs( now ) );
+            if ( ((Fxt::Point::Float*) pointDb.lookupById( 1 ))->read( floatVal ) )
+            {
+                break;
+            }
+        }
+        REQUIRE( Cpl::Math::areFloatsEqual( floatVal, 1.5F ) );
+        {
+            Cpl::System::Mutex::ScopeBlock criticalSection( loopbacks_[0].getLock() );
+            REQUIRE( remote.getWriteCount() == writeCount + 1 );
+        }
+
+        uut.stop( chassisMbox );
+        waitForStop( uut );
+        REQUIRE( uut.isStarted() == false );
+        REQUIRE( loopbacks_[0].isConnected() == false );
+    }
+
+    SECTION( "server" )
+    {
+        REQUIRE( deserializeJson( doc, SERVER_DEFINITION ) == DeserializationError::Ok );
+        JsonVariant  cardObj = doc.as<JsonVariant>();
+        ModbusServer uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj, &driverMbox );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( uut.getErrorCode(), errText )) );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), ModbusServer::GUID_STRING ) == 0 );
+
+        REQUIRE( loopbacks_[1].connect() );
+        REQUIRE( uut.start( chassisMbox, now ) );
+        ((Fxt::Point::Int32*) pointDb.lookupById( 25 ))->write( -7 );
+        ((Fxt::Point::Bool*) pointDb.lookupById( 27 ))->write( true );
+        REQUIRE( uut.flushOutputs( now ) );
+
+        // Remote client
+        Cpl::Memory::LeanHeap    planAllocator( planHeap_, sizeof( planHeap_ ) );
+        Driver::Modbus::Planner  writePlan( planAllocator, 2 );
+        Driver::Modbus::Planner  readPlan( planAllocator, 2 );
+        Driver::Modbus::Client   client( 2, 500 );
+        uint16_t                 regs[8];
+        uint8_t                  results[2];
+        REQUIRE( writePlan.add( 1, Driver::Modbus::Protocol::FC_WRITE_MULTIPLE, 0, 3 ) );
+        writePlan.build();
+        REQUIRE( readPlan.add( 1, Driver::Modbus::Protocol::FC_READ_INPUT, 0, 3 ) );
+        readPlan.build();
+
+        // Inputs are not valid until written by the remote client
+        Cpl::System::Api::sleep( 20 );
+        REQUIRE( uut.scanInputs( now ) );
+        REQUIRE( pointDb.lookupById( 21 )->isNotValid() );
+
+        writeFloatRegs( regs, 3.25F );
+        regs[2] = 1;
+        REQUIRE( client.execute( loopbacks_[1].getRemote(), writePlan, regs, results ) );
+        REQUIRE( results[0] == Driver::Modbus::Client::eSUCCESS );
+        float floatVal = 0.0F;
+        bool  boolVal  = false;
+        for ( int i=0; i < WAIT_LOOPS; i++ )
+        {
+            Cpl::System::Api::sleep( 10 );
+            REQUIRE( uut.scanInputs( now ) );
+            if ( ((Fxt::Point::Float*) pointDb.lookupById( 21 ))->read( floatVal ) )
+            {
+                break;
+            }
+        }
+        REQUIRE( Cpl::Math::areFloatsEqual( floatVal, 3.25F ) );
+        REQUIRE( ((Fxt::Point::Bool*) pointDb.lookupById( 23 ))->read( boolVal ) );
+        REQUIRE( boolVal );
+
+        // Outputs
+        REQUIRE( client.execute( loopbacks_[1].getRemote(), readPlan, regs, results ) );
+        REQUIRE( results[0] == Driver::Modbus::Client::eSUCCESS );
+        REQUIRE( regs[0] == 0xFFFF );
+        REQUIRE( regs[1] == 0xFFF9 );
+        REQUIRE( regs[2] == 1 );
+
+        uut.stop( chassisMbox );
+        waitForStop( uut );
+        REQUIRE( uut.isStarted() == false );
+    }
+
+    SECTION( "errors" )
+    {
+        REQUIRE( deserializeJson( doc, BAD_TABLE_DEFINITION ) == DeserializationError::Ok );
+        JsonVariant  cardObj = doc.as<JsonVariant>();
+        ModbusClient uut( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj, &driverMbox );
+        REQUIRE( uut.getErrorCode() == fullErr( Fxt::Card::Err_T::INVALID_FIELD ) );
+
+        REQUIRE( deserializeJson( doc, NO_TRANSPORT_DEFINITION ) == DeserializationError::Ok );
+        cardObj = doc.as<JsonVariant>();
+        ModbusClient uut2( generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb, cardObj, &driverMbox );
+        REQUIRE( uut2.getErrorCode() == fullErr( Fxt::Card::Err_T::DRIVER_ERROR ) );
+    }
+
+    // Shutdown threads
+    driverMbox.pleaseStop();
+    chassisMbox.pleaseStop();
+    Cpl::System::Api::sleep( 100 );
+    Cpl::System::Thread::destroy( *driverThread );
+    Cpl::System::Thread::destroy( *chassisThread );
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -44,8 +44,6 @@ RHTemperature::RHTemperature( Cpl::Memory::ContiguousAllocator&  generalAllocato
                               void*                              extraArgsNotUsed )
     : Fxt::Card::Common_( MAX_INPUT_CHANNELS, MAX_OUTPUT_CHANNELS )
     , StartStopAsync( *cardMbox )
-    , IoFlushAsync( *cardMbox )
-    , IoScanAsync( *cardMbox )
     , Timer( *cardMbox )
     , m_driver( nullptr )
     , m_rhIndex( INVALID_INDEX )
@@ -171,8 +169,8 @@ bool RHTemperature::start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElaps
     }
 
     // Housekeeping
-    IoFlushAsync::start( chassisMbox );
-    IoScanAsync::start( chassisMbox );
+    IoFlushAsync::start();
+    IoScanAsync::start();
 
     // Update the physical outputs (aka the heater)
     Fxt::Point::Bool* pt           = (Fxt::Point::Bool*) m_outputIoRegisterPoints[0];
@@ -268,6 +266,9 @@ const char* RHTemperature::getTypeName() const noexcept
 // NOTE: This method executes in the Driver Thread
 void RHTemperature::expired() noexcept
 {
+    // Get the latest output values from the chassis (if any)
+    extractOutputs();
+
     // Update output
     bool heaterEnabled = m_drvCommandedValues.values[0];
     if ( m_drvForceHeaterUpdate || heaterEnabled != m_drvLastHeaterEnable )
@@ -311,7 +312,7 @@ void RHTemperature::expired() noexcept
         }
 
         // Transfer the data to the card/chassis thread
-        issueAsyncIoScanRequest();
+        publishInputs();
 
         // Start the next sample
         m_driver->startSample();
@@ -322,15 +323,15 @@ void RHTemperature::expired() noexcept
 }
 
 // NOTE: executes in the driver thread
-void RHTemperature::extractOutputsTransferBuffer() noexcept
+void RHTemperature::extractOutputsTransferBuffer( const OutputData_T& srcTransferBuffer ) noexcept
 {
-    memcpy( &m_drvCommandedValues, &m_transferOutputsBuffer, sizeof( m_drvCommandedValues ) );
+    m_drvCommandedValues = srcTransferBuffer;
 }
 
 // NOTE: executes in the driver thread
-void RHTemperature::populateInputsTransferBuffer() noexcept
+void RHTemperature::populateInputsTransferBuffer( InputData_T& dstTransferBuffer ) noexcept
 {
-    memcpy( &m_transferInputsBuffer, &m_drvReceivedValues, sizeof( m_transferInputsBuffer) );
+    dstTransferBuffer = m_drvReceivedValues;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -338,6 +339,9 @@ void RHTemperature::populateInputsTransferBuffer() noexcept
 // Note: This method executes in the 'Chassis thread'
 bool RHTemperature::scanInputs( uint64_t currentElapsedTimeUsec ) noexcept
 {
+    // Update the Input IO Registers with the latest driver data (if any)
+    extractInputs();
+
     // Call parent class to manage the transfer between IO Registers and Virtual Points
     bool result = Common_::scanInputs( currentElapsedTimeUsec );
 
@@ -349,8 +353,8 @@ bool RHTemperature::scanInputs( uint64_t currentElapsedTimeUsec ) noexcept
     return true;
 }
 
-/// See Fxt::Card::IoFlushAsync
-void RHTemperature::extractInputsTransferBuffer() noexcept
+// Note: This method executes in the 'Chassis thread'
+void RHTemperature::extractInputsTransferBuffer( const InputData_T& srcTransferBuffer ) noexcept
 {
     // Copy the transferred data (from the data) to the Input IO Registers
     for ( unsigned i=0; i < MAX_INPUT_CHANNELS; i++ )
@@ -359,10 +363,10 @@ void RHTemperature::extractInputsTransferBuffer() noexcept
         {
             // Update the corresponding IO Register
             Fxt::Point::Float* pt         = (Fxt::Point::Float*) m_inputIoRegisterPoints[i];
-            bool               validInput = m_transferInputsBuffer.isValid[i];
+            bool               validInput = srcTransferBuffer.isValid[i];
             if ( validInput )
             {
-                pt->write( m_transferInputsBuffer.values[i] );
+                pt->write( srcTransferBuffer.values[i] );
             }
             else
             {
@@ -386,8 +390,8 @@ bool RHTemperature::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
         // NOTE: At most there will be ONE output (aka the Heater enable)
         if ( m_outputIoRegisterPoints[0] != nullptr )
         {
-            // Initiate the transfer of the data to the driver thread
-            issueAsyncIoFlushRequest();
+            // Make the data available to the driver thread
+            publishOutputs();
         }
     }
 
@@ -400,11 +404,11 @@ bool RHTemperature::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
 }
 
 // NOTE: executes in the Chassis thread
-void RHTemperature::popuplateOutputsTransferBuffer() noexcept
+void RHTemperature::populateOutputsTransferBuffer( OutputData_T& dstTransferBuffer ) noexcept
 {
     // Get the current value (and force the 'off state' if the Point is invalid)
-    Fxt::Point::Bool* pt              = (Fxt::Point::Bool*) m_outputIoRegisterPoints[0];
-    m_transferOutputsBuffer.values[0] = false;
-    pt->read( m_transferOutputsBuffer.values[0] );
+    Fxt::Point::Bool* pt          = (Fxt::Point::Bool*) m_outputIoRegisterPoints[0];
+    dstTransferBuffer.values[0]   = false;
+    pt->read( dstTransferBuffer.values[0] );
 }
 
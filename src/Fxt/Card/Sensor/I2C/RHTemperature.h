@@ -38,6 +38,20 @@ namespace Sensor {
 namespace I2C {
 
 
+/// Data structure used to transfer INPUT data from the driver thread to the chassis thread
+struct RHTemperatureInputData_T
+{
+    float values[2];    //!< Contains RH and Temp values.  The order of the parameter are the SAME order as IO Register indexes
+    bool  isValid[2];   //!< Valid state of the incoming values.  Order is the same as 'dataValues'
+};
+
+/// Data structure used to transfer OUTPUT data from the chassis thread to the driver thread
+struct RHTemperatureOutputData_T
+{
+    bool values[1];     //!< Contains Heater enable value.
+};
+
+
 /** This concrete class implements an IO card that is a single RH/Temperature
     device connect to the Node via an I2C bus.  The card reports a single RH
     value (in %) and a single Temperature value (in degrees Centigrade).  In
@@ -48,17 +62,25 @@ namespace I2C {
     The card requires a 'driver thread' to execute in independently of the calls to
     scanInputs() and flushOutputs().  This is so that the sensor can be scanned
     in the background so a 'current' value is available when scanInputs() is
-    called.
+    called.  Data is exchanged between the driver thread and the chassis thread
+    via lock-free triple buffers.  The driver thread picks up new output
+    values (i.e. the heater state) on its next sampling interval.
 
     CARD OUTPUTS/INVALID-STATE:
         The card sets its outputs (i.e. heater-enabled) to false/off when the
         Output IO Register is in the invalid state.
 
     NOTES: 
-        - The Factory class is responsible for providing the Mailbox
+        - The Factory class is responsible for providing the Mailbox (either a
+          single mailbox or a pool of driver threads)
         - The application is responsible for providing the driver instance
           via the RHTemperatureDriver class.  The look-up for the driver 
           instance is based on slot number.
+        - When multiple sensors share a single I2C bus, the application should
+          use the Driver::RHTemp::HUT31D::AsyncApi driver (with a per-bus
+          Driver::I2C::TransactionQueue that executes in the cards' driver
+          thread).  This prevents the cards' sampling from blocking the driver
+          thread and batches the sensors' transactions on the bus.
 
     \code
 
@@ -71,6 +93,7 @@ namespace I2C {
       "typeName": "Fxt::Card::Sensor::I2C::RHTemperature",  // *Human readable type name
       "slot": <sensor slot>,                                // Physical identifier. The containing node dedicates what are the valid values for 'slot' (i.e. slot number maps to a specific driver instance)
       "driverInterval": <num_msec>,                         // Sampling rate/delay in milliseconds for the DRIVER level scanning.  The value must be >= 100ms
+      "driverThread": 0,                                    // OPTIONAL: Index of the driver thread (when the factory uses a pool of driver threads). Default is 0
       "points": {
         "inputs": [                                         // Inputs.
           {
@@ -125,8 +148,8 @@ namespace I2C {
 class RHTemperature : 
     public Fxt::Card::Common_, 
     public Fxt::Card::StartStopAsync,
-    public Fxt::Card::IoFlushAsync,
-    public Fxt::Card::IoScanAsync,
+    public Fxt::Card::IoFlushAsync<RHTemperatureOutputData_T>,
+    public Fxt::Card::IoScanAsync<RHTemperatureInputData_T>,
     public Cpl::System::Timer
 {
 public:
@@ -198,31 +221,24 @@ protected:
 
 protected:
     /// Data structure used to transfer INPUT data between the chassis and driver threads
-    struct InputData_T
-    {
-        float values[2];    //!< Contains RH and Temp values.  The order of the parameter are the SAME order as IO Register indexes
-        bool  isValid[2];   //!< Valid state of the incoming values.  Order is the same as 'dataValues'
-    };
+    typedef RHTemperatureInputData_T    InputData_T;
 
-    /// See Fxt::Card::IoFlushAsync
-    void populateInputsTransferBuffer() noexcept;
+    /// See Fxt::Card::IoScanAsync
+    void populateInputsTransferBuffer( InputData_T& dstTransferBuffer ) noexcept;
 
-    /// See Fxt::Card::IoFlushAsync
-    void extractInputsTransferBuffer() noexcept;
+    /// See Fxt::Card::IoScanAsync
+    void extractInputsTransferBuffer( const InputData_T& srcTransferBuffer ) noexcept;
 
 
 protected:
     /// Data structure used to transfer OUTPUT data between the chassis and driver threads
-    struct OutputData_T
-    {
-        bool values[1];    //!< Contains Heater enable value.
-    };
+    typedef RHTemperatureOutputData_T   OutputData_T;
 
     /// See Fxt::Card::IoFlushAsync
-    void popuplateOutputsTransferBuffer() noexcept;
+    void populateOutputsTransferBuffer( OutputData_T& dstTransferBuffer ) noexcept;
 
     /// See Fxt::Card::IoFlushAsync
-    void extractOutputsTransferBuffer() noexcept;
+    void extractOutputsTransferBuffer( const OutputData_T& srcTransferBuffer ) noexcept;
 
 protected:
     /// Background polling timer expired
@@ -242,16 +258,9 @@ protected:
     uint16_t                m_tempIndex;
 
 
-    /// Buffer used to transfer the cached Input values to the card/chassis. 
-    InputData_T             m_transferInputsBuffer;
-
     /// Driver: latest input values
     InputData_T             m_drvReceivedValues;
 
-
-    /// Buffer used to transfer the cached Output values to the driver. 
-    OutputData_T            m_transferOutputsBuffer;
-
     /// Driver: Output value for heater
     OutputData_T            m_drvCommandedValues;
 
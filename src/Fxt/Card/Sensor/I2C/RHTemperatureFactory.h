@@ -34,6 +34,12 @@ public:
         : Fxt::Card::Factory<RHTemperature>( factoryDatabase, cardMbox )
     {
     }
+
+    /// Constructor -->cards are assigned to a driver thread from the pool (and no extra args used)
+    RHTemperatureFactory( FactoryDatabaseApi&  factoryDatabase, DriverThreadPoolApi& driverThreads )
+        : Fxt::Card::Factory<RHTemperature>( factoryDatabase, driverThreads )
+    {
+    }
 };
 
 
@@ -0,0 +1,96 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "SoeBuffer.h"
+#include <new>
+
+///
+using namespace Fxt::Card;
+
+//////////////////////////////////////////////////
+SoeBuffer::SoeBuffer( unsigned numElements, SoeEvent_T memoryForElements[] ) noexcept
+    : m_ring( numElements, memoryForElements )
+    , m_numCaptured( 0 )
+    , m_numOverflows( 0 )
+{
+}
+
+SoeBuffer* SoeBuffer::create( Cpl::Memory::ContiguousAllocator& allocator, unsigned maxEvents ) noexcept
+{
+    // Note: One ring buffer element is consumed to represent the empty state
+    void*       memBuffer = allocator.allocate( sizeof( SoeBuffer ) );
+    SoeEvent_T* memEvents = (SoeEvent_T*) allocator.allocate( sizeof( SoeEvent_T ) * (maxEvents + 1) );
+    if ( memBuffer == nullptr || memEvents == nullptr )
+    {
+        return nullptr;
+    }
+
+    return new(memBuffer) SoeBuffer( maxEvents + 1, memEvents );
+}
+
+//////////////////////////////////////////////////
+bool SoeBuffer::captureEdge( uint16_t channel, bool asserted, uint64_t timestampUsec ) noexcept
+{
+    SoeEvent_T event = { timestampUsec, channel, asserted };
+    if ( !m_ring.add( event ) )
+    {
+        m_numOverflows.fetch_add( 1, std::memory_order_relaxed );
+        return false;
+    }
+
+    m_numCaptured.fetch_add( 1, std::memory_order_relaxed );
+    return true;
+}
+
+//////////////////////////////////////////////////
+unsigned SoeBuffer::drain( SoeEvent_T dst[], unsigned maxEvents ) noexcept
+{
+    unsigned count = 0;
+    while ( count < maxEvents && m_ring.remove( dst[count] ) )
+    {
+        count++;
+    }
+    return count;
+}
+
+bool SoeBuffer::drain( SoeEvent_T& dst ) noexcept
+{
+    return m_ring.remove( dst );
+}
+
+unsigned SoeBuffer::getNumPending() const noexcept
+{
+    return m_ring.getNumItems();
+}
+
+unsigned SoeBuffer::getMaxEvents() const noexcept
+{
+    return m_ring.getMaxItems();
+}
+
+uint32_t SoeBuffer::getNumCaptured() const noexcept
+{
+    return m_numCaptured.load( std::memory_order_relaxed );
+}
+
+uint32_t SoeBuffer::getNumOverflows() const noexcept
+{
+    return m_numOverflows.load( std::memory_order_relaxed );
+}
+
+void SoeBuffer::clear() noexcept
+{
+    m_ring.clearTheBuffer();
+    m_numCaptured.store( 0, std::memory_order_relaxed );
+    m_numOverflows.store( 0, std::memory_order_relaxed );
+}
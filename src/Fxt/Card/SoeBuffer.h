@@ -0,0 +1,123 @@
+#ifndef Fxt_Card_SoeBuffer_h_
+#define Fxt_Card_SoeBuffer_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/Container/RingBuffer.h"
+#include "Cpl/Memory/ContiguousAllocator.h"
+#include <atomic>
+#include <stdint.h>
+
+
+/// Default number of events stored in a card's sequence-of-events buffer
+#ifndef OPTION_FXT_CARD_SOE_DEFAULT_DEPTH
+#define OPTION_FXT_CARD_SOE_DEFAULT_DEPTH       64
+#endif
+
+/// Maximum number of events that can be stored in a card's sequence-of-events buffer
+#ifndef OPTION_FXT_CARD_SOE_MAX_DEPTH
+#define OPTION_FXT_CARD_SOE_MAX_DEPTH           4096
+#endif
+
+///
+namespace Fxt {
+///
+namespace Card {
+
+
+/// A single sequence-of-events entry, i.e. a time stamped input edge
+struct SoeEvent_T
+{
+    uint64_t timestampUsec; //!< Elapsed time, in microseconds, of when the edge was captured
+    uint16_t channel;       //!< Card channel number (same numbering as the card's JSON "channel" field)
+    bool     asserted;      //!< The input's new state
+};
+
+
+/** This concrete class implements a sequence-of-events (SOE) buffer for
+    digital input cards.  Every change-of-state of an input is time stamped
+    (with microsecond resolution) when it is captured by the card's driver
+    (e.g. an edge interrupt or the thread that updates the IO Registers) -
+    independent of the chassis scan rate. The buffer is a stream: the
+    Application drains the captured events, in the order they occurred, for
+    post-trip analysis.
+
+    When the buffer is full, NEW events are discarded (and counted), i.e.
+    the events leading up to a trip are preserved.  The buffer is NOT
+    cleared when its card is stopped/re-started.
+
+    Thread/ISR Safety Notes:
+        - The buffer is lock-free.  Exactly ONE producer (the card's capture
+          context) and exactly ONE consumer (the Application) are supported.
+        - clear() is NOT thread safe, i.e. it should only be called when
+          the producer is not active.
+ */
+class SoeBuffer
+{
+public:
+    /** Constructor. The application is responsible for providing the memory
+        for the buffer.  'numElements' is the number of elements in
+        'memoryForElements' (the buffer stores at most numElements-1 events)
+     */
+    SoeBuffer( unsigned numElements, SoeEvent_T memoryForElements[] ) noexcept;
+
+    /** Creates a buffer that holds up to 'maxEvents' events using memory
+        from the allocator.  Returns nullptr if out-of-memory
+     */
+    static SoeBuffer* create( Cpl::Memory::ContiguousAllocator& allocator, unsigned maxEvents ) noexcept;
+
+public:
+    /** Producer: Captures an edge.  Returns false if the buffer is full (the
+        event is discarded)
+     */
+    bool captureEdge( uint16_t channel, bool asserted, uint64_t timestampUsec ) noexcept;
+
+public:
+    /** Consumer: Removes up to 'maxEvents' of the oldest events and copies
+        them into 'dst'.  Returns the number of events removed.
+     */
+    unsigned drain( SoeEvent_T dst[], unsigned maxEvents ) noexcept;
+
+    /// Consumer: Removes the oldest event. Returns false if the buffer is empty
+    bool drain( SoeEvent_T& dst ) noexcept;
+
+    /// Returns the number of events that are waiting to be drained
+    unsigned getNumPending() const noexcept;
+
+    /// Returns the maximum number of events that the buffer can hold
+    unsigned getMaxEvents() const noexcept;
+
+    /// Returns the total number of events captured (does NOT include the discarded events)
+    uint32_t getNumCaptured() const noexcept;
+
+    /// Returns the number of events that were discarded because the buffer was full
+    uint32_t getNumOverflows() const noexcept;
+
+public:
+    /// Discards all events and resets the counters.  NOT thread safe
+    void clear() noexcept;
+
+protected:
+    /// The event storage
+    Cpl::Container::RingBuffer<SoeEvent_T>  m_ring;
+
+    /// Number of captured events
+    std::atomic<uint32_t>                   m_numCaptured;
+
+    /// Number of discarded events
+    std::atomic<uint32_t>                   m_numOverflows;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,143 @@
+#ifndef Fxt_Card_TripleBuffer_h_
+#define Fxt_Card_TripleBuffer_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include <atomic>
+#include <stdint.h>
+
+///
+namespace Fxt {
+///
+namespace Card {
+
+/** This template class implements a lock-free, single-producer/single-consumer
+    'triple buffer'.  The producer always has a private buffer to write into,
+    and the consumer always has a private buffer to read from.  The third
+    buffer is exchanged (atomically) between the two when the producer
+    publishes and when the consumer consumes.  Neither side ever blocks.
+
+    If the producer publishes more than once between consumes, the consumer
+    only sees the latest data (i.e. intermediate updates are overwritten, not
+    queued). Each published buffer is stamped with a sequence number so that
+    the consumer can detect skipped updates.
+
+    NOTES:
+        - Exactly ONE thread may call the producer methods, and exactly ONE
+          thread may call the consumer methods.
+        - reset() is NOT thread safe, i.e. it should only be called when
+          neither the producer nor the consumer is active.
+
+    Template Args:
+        DATA:=  The type of the data being transferred. Must be copyable
+ */
+template<class DATA>
+class TripleBuffer
+{
+public:
+    /// Constructor
+    TripleBuffer() noexcept
+    {
+        reset();
+    }
+
+public:
+    /// Resets the buffer to its initial (empty) state.  NOT thread safe
+    void reset() noexcept
+    {
+        m_backIdx  = 0;
+        m_frontIdx = 1;
+        m_middle.store( 2, std::memory_order_relaxed );
+        m_pubSeqNum = 0;
+        m_seqNum[0] = m_seqNum[1] = m_seqNum[2] = 0;
+    }
+
+public:
+    /// Producer: Returns the buffer to write the next set of data into
+    inline DATA& getWriteBuffer() noexcept
+    {
+        return m_buffers[m_backIdx];
+    }
+
+    /** Producer: Makes the contents of the write buffer available to the
+        consumer.  After the call, the producer has a new (stale) write buffer,
+        i.e. the producer must fully re-populate the write buffer before the
+        next publish.
+     */
+    inline void publish() noexcept
+    {
+        m_seqNum[m_backIdx] = ++m_pubSeqNum;
+        uint8_t prev        = m_middle.exchange( (uint8_t) (m_backIdx | DIRTY_BIT), std::memory_order_acq_rel );
+        m_backIdx           = prev & INDEX_MASK;
+    }
+
+public:
+    /** Consumer: Acquires the most recently published data (if any).  Returns
+        true if new data was published since the last call; else false is
+        returned and the read buffer is left unchanged.
+     */
+    inline bool consume() noexcept
+    {
+        if ( (m_middle.load( std::memory_order_relaxed ) & DIRTY_BIT) == 0 )
+        {
+            return false;
+        }
+        uint8_t prev = m_middle.exchange( m_frontIdx, std::memory_order_acq_rel );
+        m_frontIdx   = prev & INDEX_MASK;
+        return true;
+    }
+
+    /// Consumer: Returns the data acquired by the last successful consume()
+    inline const DATA& getReadBuffer() const noexcept
+    {
+        return m_buffers[m_frontIdx];
+    }
+
+    /** Consumer: Returns the sequence number of the read buffer.  A value of
+        zero indicates that no data has been consumed.  A difference of more
+        than one between successive reads indicates skipped updates.
+     */
+    inline uint32_t getReadSequenceNumber() const noexcept
+    {
+        return m_seqNum[m_frontIdx];
+    }
+
+protected:
+    /// Flag bit (in m_middle) that indicates the middle buffer contains unconsumed data
+    static constexpr uint8_t DIRTY_BIT  = 0x04;
+
+    /// Mask for the buffer index (in m_middle)
+    static constexpr uint8_t INDEX_MASK = 0x03;
+
+    /// The buffers
+    DATA                    m_buffers[3];
+
+    /// Sequence number for each buffer
+    uint32_t                m_seqNum[3];
+
+    /// Index + dirty flag for the 'shared' buffer
+    std::atomic<uint8_t>    m_middle;
+
+    /// Producer's buffer index (only accessed by the producer)
+    uint8_t                 m_backIdx;
+
+    /// Consumer's buffer index (only accessed by the consumer)
+    uint8_t                 m_frontIdx;
+
+    /// Producer's sequence counter (only accessed by the producer)
+    uint32_t                m_pubSeqNum;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
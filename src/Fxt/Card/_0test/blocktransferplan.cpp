@@ -0,0 +1,105 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Card/BlockTransferPlan.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include <string.h>
+
+///
+using namespace Fxt::Card;
+
+static size_t generalHeap_[100];
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "BlockTransferPlan" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    BlockTransferPlan     uut( generalAllocator, 4 );
+    uint8_t               src[64];
+    uint8_t               dst[64];
+    for ( unsigned i=0; i < sizeof( src ); i++ )
+    {
+        src[i] = (uint8_t) i;
+    }
+    memset( dst, 0xFF, sizeof( dst ) );
+
+    SECTION( "empty" )
+    {
+        REQUIRE( uut.isValid() );
+        REQUIRE( uut.getNumTransfers() == 0 );
+        REQUIRE( uut.getTransfer( 0 ) == nullptr );
+        uut.optimize();
+        uut.execute();
+        REQUIRE( uut.getNumTransfers() == 0 );
+        REQUIRE( uut.getTotalBytes() == 0 );
+    }
+
+    SECTION( "merge" )
+    {
+        // Added out-of-order -->optimize() sorts by destination
+        REQUIRE( uut.add( dst + 8, src + 8, 8 ) );
+        REQUIRE( uut.add( dst + 0, src + 0, 8 ) );
+        REQUIRE( uut.add( dst + 16, src + 16, 4 ) );
+        REQUIRE( uut.add( dst + 20, src + 20, 0 ) );    // Zero length is discarded
+        REQUIRE( uut.getNumTransfers() == 3 );
+        uut.optimize();
+        REQUIRE( uut.getNumTransfers() == 1 );
+        REQUIRE( uut.getTransfer( 0 )->dst == dst );
+        REQUIRE( uut.getTransfer( 0 )->src == src );
+        REQUIRE( uut.getTransfer( 0 )->len == 20 );
+        REQUIRE( uut.getTotalBytes() == 20 );
+
+        uut.execute();
+        REQUIRE( memcmp( dst, src, 20 ) == 0 );
+        REQUIRE( dst[20] == 0xFF );
+    }
+
+    SECTION( "no merge" )
+    {
+        REQUIRE( uut.add( dst + 0, src + 32, 8 ) );
+        REQUIRE( uut.add( dst + 8, src + 48, 8 ) );     // Destination contiguous, source is NOT
+        REQUIRE( uut.add( dst + 24, src + 56, 8 ) );    // Source contiguous, destination is NOT
+        uut.optimize();
+        REQUIRE( uut.getNumTransfers() == 3 );
+        REQUIRE( uut.getTotalBytes() == 24 );
+
+        uut.execute();
+        REQUIRE( memcmp( dst, src + 32, 8 ) == 0 );
+        REQUIRE( memcmp( dst + 8, src + 48, 8 ) == 0 );
+        REQUIRE( dst[16] == 0xFF );
+        REQUIRE( memcmp( dst + 24, src + 56, 8 ) == 0 );
+    }
+
+    SECTION( "full" )
+    {
+        REQUIRE( uut.add( dst + 0, src + 0, 1 ) );
+        REQUIRE( uut.add( dst + 2, src + 2, 1 ) );
+        REQUIRE( uut.add( dst + 4, src + 4, 1 ) );
+        REQUIRE( uut.add( dst + 6, src + 6, 1 ) );
+        REQUIRE( uut.add( dst + 8, src + 8, 1 ) == false );
+        uut.clear();
+        REQUIRE( uut.getNumTransfers() == 0 );
+        REQUIRE( uut.add( dst + 8, src + 8, 1 ) );
+    }
+
+    SECTION( "out-of-memory" )
+    {
+        BlockTransferPlan bad( generalAllocator, 1000 );
+        REQUIRE( bad.isValid() == false );
+        REQUIRE( bad.add( dst, src, 1 ) == false );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -0,0 +1,151 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Card/DriverThreadPool.h"
+#include "Fxt/Card/Mock/Digital8.h"
+#include "Fxt/Card/FactoryCommon_.h"
+#include "Fxt/Card/FactoryDatabase.h"
+#include "Fxt/Point/Bool.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Factory.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/Trace.h"
+
+#define SECT_   "_0test"
+
+/// 
+using namespace Fxt::Card;
+
+
+#define CARD_DEFINTION(thrd)    "{" \
+                                "  \"name\": \"My Digital8 Card\"," \
+                                "  \"type\": \"59d33888-62c7-45b2-a4d4-9dbc55914ed3\"," \
+                                "  \"slot\": 0," \
+                                "  \"driverThread\": " thrd "," \
+                                "    \"points\": {" \
+                                "       \"inputs\": [" \
+                                "           {" \
+                                "               \"channel\": 1," \
+                                "                \"id\": 1," \
+                                "                \"ioRegId\": 2," \
+                                "                \"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\"," \
+                                "                \"typeName\": \"Fxt::Point::Bool\"," \
+                                "                \"name\": \"InputPt\"" \
+                                "           }" \
+                                "       ]" \
+                                "    }" \
+                                "}" 
+
+namespace {
+
+/// Card that captures the mailbox it was created with
+class MyCard : public Fxt::Card::Mock::Digital8
+{
+public:
+    ///
+    MyCard( Cpl::Memory::ContiguousAllocator&  generalAllocator,
+            Cpl::Memory::ContiguousAllocator&  cardStatefulDataAllocator,
+            Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+            Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+            Fxt::Point::DatabaseApi&           dbForPoints,
+            JsonVariant&                       cardObject,
+            Cpl::Dm::MailboxServer*            cardMbox,
+            void*                              extraArgs )
+        : Fxt::Card::Mock::Digital8( generalAllocator, cardStatefulDataAllocator, haStatefulDataAllocator, pointFactoryDb, dbForPoints, cardObject )
+    {
+        g_cardMbox = cardMbox;
+    }
+
+    ///
+    static Cpl::Dm::MailboxServer* g_cardMbox;
+};
+
+Cpl::Dm::MailboxServer* MyCard::g_cardMbox;
+
+};
+
+static size_t generalHeap_[10000];
+static size_t cardStateFullHeap_[10000];
+static size_t haStateFullHeap_[10000];
+
+#define MAX_POINTS      100
+#define NUM_THREADS     2
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "DriverThreadPool" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    DriverThreadPool<NUM_THREADS> uut( "TestDrv" );
+
+    SECTION( "mailboxes" )
+    {
+        REQUIRE( uut.getNumDriverThreads() == NUM_THREADS );
+        REQUIRE( uut.getDriverMailbox( 0 ) != nullptr );
+        REQUIRE( uut.getDriverMailbox( 1 ) != nullptr );
+        REQUIRE( uut.getDriverMailbox( 0 ) != uut.getDriverMailbox( 1 ) );
+        REQUIRE( uut.getDriverMailbox( NUM_THREADS ) == nullptr );
+        REQUIRE( uut.getDriverThread( 0 ) == nullptr );
+    }
+
+    SECTION( "start/stop" )
+    {
+        int cores[NUM_THREADS] ={ 0, DriverThreadPool<NUM_THREADS>::NOT_PINNED };
+        bool pinned = uut.start( cores );
+        REQUIRE( pinned == (Fxt::System::CpuAffinity::getNumCores() > 0) );
+        REQUIRE( uut.getDriverThread( 0 ) != nullptr );
+        REQUIRE( uut.getDriverThread( 1 ) != nullptr );
+        REQUIRE( strcmp( uut.getDriverThread( 1 )->getName(), "TestDrv1" ) == 0 );
+        Cpl::System::Api::sleep( 100 );
+        REQUIRE( uut.getDriverThread( 0 )->isRunning() );
+        REQUIRE( uut.getDriverThread( 1 )->isRunning() );
+
+        uut.stop();
+        REQUIRE( uut.getDriverThread( 0 ) == nullptr );
+        REQUIRE( uut.getDriverThread( 1 ) == nullptr );
+    }
+
+    SECTION( "card assignment" )
+    {
+        Cpl::Memory::LeanHeap                  generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+        Cpl::Memory::LeanHeap                  cardStatefulAllocator( cardStateFullHeap_, sizeof( cardStateFullHeap_ ) );
+        Cpl::Memory::LeanHeap                  haStatefulAllocator( haStateFullHeap_, sizeof( haStateFullHeap_ ) );
+        Fxt::Point::Database<MAX_POINTS>       pointDb;
+        Fxt::Point::FactoryDatabase            pointFactoryDb;
+        Fxt::Point::Factory<Fxt::Point::Bool>  factoryBool( pointFactoryDb );
+        Fxt::Card::FactoryDatabase             cardFactoryDb;
+        Fxt::Card::Factory<MyCard>             factory( cardFactoryDb, uut );
+        Fxt::Type::Error                       cardErrorCode;
+        StaticJsonDocument<2048>               doc;
+
+        REQUIRE( deserializeJson( doc, CARD_DEFINTION( "1" ) ) == DeserializationError::Ok );
+        JsonVariant     cardObj = doc.as<JsonVariant>();
+        Fxt::Card::Api* card    = factory.create( cardObj, cardErrorCode, generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( card != nullptr );
+        REQUIRE( cardErrorCode == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( MyCard::g_cardMbox == uut.getDriverMailbox( 1 ) );
+        factory.destroy( *card );
+
+        // Out-of-range thread index
+        pointDb.clearPoints();
+        REQUIRE( deserializeJson( doc, CARD_DEFINTION( "2" ) ) == DeserializationError::Ok );
+        cardObj = doc.as<JsonVariant>();
+        card    = factory.create( cardObj, cardErrorCode, generalAllocator, cardStatefulAllocator, haStatefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( card == nullptr );
+        REQUIRE( cardErrorCode == fullErr( Err_T::INVALID_FIELD ) );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
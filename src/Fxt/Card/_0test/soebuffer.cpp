@@ -0,0 +1,214 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Card/SoeBuffer.h"
+#include "Fxt/Card/Mock/Digital8.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Factory.h"
+#include "Fxt/Point/Bool.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/Itc/PostApi.h"
+
+///
+using namespace Fxt::Card;
+
+#define CARD_DEFINTION(soe) "{" \
+                            "  \"name\": \"My Digital8 Card\"," \
+                            "  \"type\": \"59d33888-62c7-45b2-a4d4-9dbc55914ed3\"," \
+                            "  \"slot\": 0," \
+                            soe \
+                            "  \"points\": {" \
+                            "     \"inputs\": [" \
+                            "         {" \
+                            "            \"channel\": 1," \
+                            "            \"id\": 1," \
+                            "            \"ioRegId\": 2," \
+                            "            \"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\"," \
+                            "            \"initial\": { \"valid\": true, \"val\": false, \"id\": 3 }" \
+                            "         }," \
+                            "         {" \
+                            "            \"channel\": 3," \
+                            "            \"id\": 4," \
+                            "            \"ioRegId\": 5," \
+                            "            \"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\"" \
+                            "         }" \
+                            "     ]" \
+                            "  }" \
+                            "}"
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+
+#define MAX_POINTS      100
+
+namespace {
+
+class NullMbox : public Cpl::Itc::PostApi
+{
+public:
+    void post( Cpl::Itc::Message& msg ) noexcept {}
+    void postSync( Cpl::Itc::Message& msg ) noexcept {}
+};
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "SoeBuffer" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+
+    SECTION( "capture/drain" )
+    {
+        SoeBuffer* uut = SoeBuffer::create( generalAllocator, 4 );
+        REQUIRE( uut );
+        REQUIRE( uut->getMaxEvents() == 4 );
+        REQUIRE( uut->getNumPending() == 0 );
+
+        SoeEvent_T event;
+        REQUIRE( uut->drain( event ) == false );
+
+        REQUIRE( uut->captureEdge( 2, true, 100 ) );
+        REQUIRE( uut->captureEdge( 2, false, 101 ) );
+        REQUIRE( uut->captureEdge( 7, true, 150 ) );
+        REQUIRE( uut->getNumPending() == 3 );
+        REQUIRE( uut->getNumCaptured() == 3 );
+
+        REQUIRE( uut->drain( event ) );
+        REQUIRE( event.channel == 2 );
+        REQUIRE( event.asserted == true );
+        REQUIRE( event.timestampUsec == 100 );
+
+        SoeEvent_T events[4];
+        REQUIRE( uut->drain( events, 4 ) == 2 );
+        REQUIRE( events[0].channel == 2 );
+        REQUIRE( events[0].asserted == false );
+        REQUIRE( events[0].timestampUsec == 101 );
+        REQUIRE( events[1].channel == 7 );
+        REQUIRE( events[1].timestampUsec == 150 );
+        REQUIRE( uut->getNumPending() == 0 );
+        REQUIRE( uut->getNumOverflows() == 0 );
+    }
+
+    SECTION( "overflow" )
+    {
+        SoeBuffer* uut = SoeBuffer::create( generalAllocator, 2 );
+        REQUIRE( uut );
+        REQUIRE( uut->captureEdge( 1, true, 10 ) );
+        REQUIRE( uut->captureEdge( 1, false, 11 ) );
+        REQUIRE( uut->captureEdge( 1, true, 12 ) == false );
+        REQUIRE( uut->getNumCaptured() == 2 );
+        REQUIRE( uut->getNumOverflows() == 1 );
+
+        // Oldest events are preserved
+        SoeEvent_T events[3];
+        REQUIRE( uut->drain( events, 3 ) == 2 );
+        REQUIRE( events[0].timestampUsec == 10 );
+        REQUIRE( events[1].timestampUsec == 11 );
+
+        uut->captureEdge( 1, true, 13 );
+        uut->clear();
+        REQUIRE( uut->getNumPending() == 0 );
+        REQUIRE( uut->getNumCaptured() == 0 );
+        REQUIRE( uut->getNumOverflows() == 0 );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
+
+TEST_CASE( "Digital8 SOE" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap                   generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap                   statefulAllocator( statefulHeap_, sizeof( statefulHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>        pointDb;
+    Fxt::Point::FactoryDatabase             pointFactoryDb;
+    Fxt::Point::Factory<Fxt::Point::Bool>   factoryBool( pointFactoryDb );
+    NullMbox                                mbox;
+
+    SECTION( "not enabled" )
+    {
+        StaticJsonDocument<2048> doc;
+        REQUIRE( deserializeJson( doc, CARD_DEFINTION( "" ) ) == DeserializationError::Ok );
+        JsonVariant cardObj = doc.as<JsonVariant>();
+        Mock::Digital8 uut( generalAllocator, statefulAllocator, statefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.getSoeBuffer() == nullptr );
+    }
+
+    SECTION( "bad depth" )
+    {
+        StaticJsonDocument<2048> doc;
+        REQUIRE( deserializeJson( doc, CARD_DEFINTION( "\"soe\": { \"depth\": 0 }," ) ) == DeserializationError::Ok );
+        JsonVariant cardObj = doc.as<JsonVariant>();
+        Mock::Digital8 uut( generalAllocator, statefulAllocator, statefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut.getErrorCode() == fullErr( Err_T::INVALID_FIELD ) );
+    }
+
+    SECTION( "capture" )
+    {
+        StaticJsonDocument<2048> doc;
+        REQUIRE( deserializeJson( doc, CARD_DEFINTION( "\"soe\": { \"depth\": 8 }," ) ) == DeserializationError::Ok );
+        JsonVariant cardObj = doc.as<JsonVariant>();
+        Mock::Digital8 uut( generalAllocator, statefulAllocator, statefulAllocator, pointFactoryDb, pointDb, cardObj );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        SoeBuffer* soe = uut.getSoeBuffer();
+        REQUIRE( soe );
+        REQUIRE( soe->getMaxEvents() == 8 );
+
+        // No capture when the card is not started
+        uut.setInputBit( 0 );
+        REQUIRE( soe->getNumPending() == 0 );
+
+        REQUIRE( uut.start( mbox, 0 ) );
+
+        // Every edge is captured - even when there is no scan
+        uut.setInputBit( 0 );       // edge
+        uut.setInputBit( 0 );       // no change
+        uut.clearInputBit( 0 );     // edge
+        uut.toggleInputBit( 0 );    // edge
+        uut.writeInput( 2, false ); // first valid value
+        uut.writeInputs( 0x04 );    // ch1: edge, ch3: edge
+        REQUIRE( soe->getNumPending() == 6 );
+
+        SoeEvent_T events[8];
+        REQUIRE( soe->drain( events, 8 ) == 6 );
+        REQUIRE( events[0].channel == 1 );
+        REQUIRE( events[0].asserted == true );
+        REQUIRE( events[1].channel == 1 );
+        REQUIRE( events[1].asserted == false );
+        REQUIRE( events[2].channel == 1 );
+        REQUIRE( events[2].asserted == true );
+        REQUIRE( events[3].channel == 3 );
+        REQUIRE( events[3].asserted == false );
+        REQUIRE( events[4].channel == 1 );
+        REQUIRE( events[4].asserted == false );
+        REQUIRE( events[5].channel == 3 );
+        REQUIRE( events[5].asserted == true );
+        for ( unsigned i=1; i < 6; i++ )
+        {
+            REQUIRE( events[i].timestampUsec >= events[i - 1].timestampUsec );
+        }
+
+        // Events survive a restart
+        uut.toggleInputBit( 2 );
+        uut.stop( mbox );
+        REQUIRE( uut.start( mbox, 0 ) );
+        REQUIRE( soe->getNumPending() == 1 );
+        uut.stop( mbox );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -0,0 +1,102 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Card/TripleBuffer.h"
+
+/// 
+using namespace Fxt::Card;
+
+namespace {
+
+struct Data_T
+{
+    uint32_t a;
+    uint32_t b;
+};
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "TripleBuffer" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    TripleBuffer<Data_T> uut;
+
+    SECTION( "empty" )
+    {
+        REQUIRE( uut.consume() == false );
+        REQUIRE( uut.getReadSequenceNumber() == 0 );
+    }
+
+    SECTION( "publish/consume" )
+    {
+        uut.getWriteBuffer().a = 1;
+        uut.getWriteBuffer().b = 2;
+        uut.publish();
+
+        REQUIRE( uut.consume() == true );
+        REQUIRE( uut.getReadBuffer().a == 1 );
+        REQUIRE( uut.getReadBuffer().b == 2 );
+        REQUIRE( uut.getReadSequenceNumber() == 1 );
+
+        // No new data -->read buffer is unchanged
+        REQUIRE( uut.consume() == false );
+        REQUIRE( uut.getReadBuffer().a == 1 );
+        REQUIRE( uut.getReadSequenceNumber() == 1 );
+
+        uut.getWriteBuffer().a = 3;
+        uut.getWriteBuffer().b = 4;
+        uut.publish();
+        REQUIRE( uut.consume() == true );
+        REQUIRE( uut.getReadBuffer().a == 3 );
+        REQUIRE( uut.getReadBuffer().b == 4 );
+        REQUIRE( uut.getReadSequenceNumber() == 2 );
+    }
+
+    SECTION( "overwrite" )
+    {
+        for ( uint32_t i=1; i <= 10; i++ )
+        {
+            uut.getWriteBuffer().a = i;
+            uut.getWriteBuffer().b = i * 2;
+            uut.publish();
+        }
+
+        // Only the latest data is seen
+        REQUIRE( uut.consume() == true );
+        REQUIRE( uut.getReadBuffer().a == 10 );
+        REQUIRE( uut.getReadBuffer().b == 20 );
+        REQUIRE( uut.getReadSequenceNumber() == 10 );
+        REQUIRE( uut.consume() == false );
+
+        // The producer never writes into the consumer's buffer
+        uut.getWriteBuffer().a = 11;
+        uut.publish();
+        uut.getWriteBuffer().a = 12;
+        REQUIRE( uut.getReadBuffer().a == 10 );
+        REQUIRE( uut.consume() == true );
+        REQUIRE( uut.getReadBuffer().a == 11 );
+        REQUIRE( uut.getReadSequenceNumber() == 11 );
+    }
+
+    SECTION( "reset" )
+    {
+        uut.publish();
+        uut.reset();
+        REQUIRE( uut.consume() == false );
+        REQUIRE( uut.getReadSequenceNumber() == 0 );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -23,6 +23,7 @@
 #include "Fxt/Chassis/ExecutionSetApi.h"
 #include "Cpl/Memory/ContiguousAllocator.h"
 #include "Cpl/Json/Arduino.h"
+#include "Cpl/Json/PullParser.h"
 #include <stdint.h>
 
 
@@ -126,6 +127,55 @@ public:
      */
     virtual Fxt::Type::Error buildSchedule() noexcept = 0;
 
+public:
+    /** This method replaces (i.e. hot-swaps) the Scanner at 'scannerIndex' with
+        'newScanner' - without stopping the rest of the Chassis.  This is how
+        an IO Card is added, replaced, or removed on a running Node (i.e. the
+        replacement Scanner contains the updated list of cards).
+
+        The Points created for 'newScanner' MUST be contained in 'stagingDb'
+        (and NOT in 'pointDb').  When a staged Point has the same ID as an
+        existing Point in 'pointDb', the existing Point (and any Point that is
+        an alias of the existing Point) is redirected to the new Point's
+        stateful data, i.e. existing references to the Point remain valid.
+        Staged Points with new IDs are added to 'pointDb'.  A staged Point
+        MUST have the same type and stateful data size as the existing Point
+        with the same ID.
+
+        When the Chassis is running, the swap is done at a FER boundary, i.e.
+        the Chassis Server is paused for at least one FER period, the old
+        Scanner is stopped, the new Scanner is started, and then the Chassis
+        Server is resumed.  If the new Scanner fails to start, the original
+        Scanner is restarted and the Point Database is NOT modified.
+
+        On success, the replaced Scanner is returned via 'replacedScanner'.
+        The replaced Scanner is in the stopped state (but is NOT destroyed),
+        and its memory is NOT reclaimed.  Note: When the replaced Scanner
+        contains cards with asynchronous start/stop semantics, the caller is
+        required to poll replacedScanner->isStarted() before destroying it.
+
+        This method MUST NOT be called from the Chassis thread.
+     */
+    virtual Fxt::Type::Error replaceScanner( uint16_t                 scannerIndex,
+                                             ScannerApi&              newScanner,
+                                             Fxt::Point::DatabaseApi& stagingDb,
+                                             Fxt::Point::DatabaseApi& pointDb,
+                                             uint64_t                 currentElapsedTimeUsec,
+                                             ScannerApi*&             replacedScanner ) noexcept = 0;
+
+    /** This method replaces (i.e. hot-swaps) the ExecutionSet at 'executionSetIndex'
+        with 'newExecutionSet'. This is how a Logic Chain is added, replaced,
+        or removed on a running Node.  The 'newExecutionSet' MUST have already
+        successfully resolved its Point references.  The semantics are the same
+        as replaceScanner().
+     */
+    virtual Fxt::Type::Error replaceExecutionSet( uint16_t                 executionSetIndex,
+                                                  ExecutionSetApi&         newExecutionSet,
+                                                  Fxt::Point::DatabaseApi& stagingDb,
+                                                  Fxt::Point::DatabaseApi& pointDb,
+                                                  uint64_t                 currentElapsedTimeUsec,
+                                                  ExecutionSetApi*&        replacedExecutionSet ) noexcept = 0;
+
 public:
     /** This method returns the Chassis Fundamental Execution Rate (FER) in
         microseconds.
@@ -138,6 +188,13 @@ public:
      */
     virtual Fxt::Type::Error getErrorCode() const noexcept = 0;
 
+    /** This method returns the Chassis's Server, i.e. the runnable object that
+        executes the Chassis.  Messages posted to the Server's mailbox are
+        processed - in the Chassis thread - between passes of the Chassis's
+        schedulers, i.e. on a FER boundary.
+     */
+    virtual ServerApi& getServer() noexcept = 0;
+
 
 public:
     /** Returns the total number of Scanner instances. If the Chassis is in an
@@ -182,6 +239,10 @@ public:
               has stopped.  Depending on the threading model of the application,
               the polling of the isStarted() state may have to be done asynchronously,
               i.e. NOT is busy wait loop.
+
+        NOTE: The stateful data for Shared Points is cache line aligned and
+              padded (see Fxt::System::CacheAlignedAllocator) because Shared
+              Points are accessed by multiple Chassis.
      */
     static Api* createChassisfromJSON( JsonVariant                         chassisJsonObject,
                                        ServerApi&                          chassisServer,
@@ -193,6 +254,32 @@ public:
                                        Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
                                        Fxt::Point::DatabaseApi&            dbForPoints,
                                        Fxt::Type::Error&                   chassisErrorode ) noexcept;
+
+    /** Same as createChassisfromJSON() - except the Chassis is parsed from a
+        JSON stream, i.e. the Chassis's JSON text is never held in memory as a
+        whole.  The 'parser' MUST be positioned at the Chassis's JSON Object.
+        The individual IO Cards, Logic Chains, and Shared Points are
+        deserialized - one at a time - into 'elementDoc'.  The capacity of
+        'elementDoc' only needs to be large enough for the largest individual
+        element (NOT the entire Chassis).
+
+        Because the number of Scanners, Execution Sets, etc. is not known until
+        the end of their respective JSON arrays, the child objects are created
+        first and the containing objects are created when their JSON Object
+        has been fully parsed.  The key/value pairs can be in any order.
+     */
+    static Api* createChassisfromStream( Cpl::Json::PullParser&              parser,
+                                         JsonDocument&                       elementDoc,
+                                         ServerApi&                          chassisServer,
+                                         Fxt::Component::FactoryDatabaseApi& componentFactory,
+                                         Fxt::Card::FactoryDatabaseApi&      cardFactoryDb,
+                                         Cpl::Memory::ContiguousAllocator&   generalAllocator,
+                                         Cpl::Memory::ContiguousAllocator&   cardStatefulDataAllocator,
+                                         Cpl::Memory::ContiguousAllocator&   haStatefulDataAllocator,
+                                         Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
+                                         Fxt::Point::DatabaseApi&            dbForPoints,
+                                         Fxt::Type::Error&                   chassisErrorode ) noexcept;
+
 public:
     /// Virtual destructor to make the compiler happy
     virtual ~Api() {}
@@ -13,9 +13,14 @@
 
 #include "Chassis.h"
 #include "Error.h"
+#include "Stream_.h"
+#include "Fxt/System/CacheAlignedAllocator.h"
+#include "Fxt/Point/OwnershipDatabase.h"
 #include "Cpl/System/Assert.h"
 #include "Cpl/Container/DList.h"
+#include "Cpl/Container/SList.h"
 #include <new>
+#include <string.h>
 
 
 ///
@@ -27,11 +32,13 @@ Chassis::Chassis( ServerApi&                         chassisServer,
                   uint64_t                           fer,
                   uint16_t                           numScanners,
                   uint16_t                           numExecutionSets,
-                  uint16_t                           numSharedPts )
+                  uint16_t                           numSharedPts,
+                  uint8_t*                           ownedPoints )
     : m_server( chassisServer )
     , m_executionSets( nullptr )
     , m_scanners( nullptr )
     , m_sharedPts( nullptr )
+    , m_ownedPts( ownedPoints )
     , m_inputPeriods( nullptr )
     , m_executionPeriods( nullptr )
     , m_outputPeriods( nullptr )
@@ -151,6 +158,19 @@ Chassis::~Chassis()
     }
 }
 
+//////////////////////////////////////////////////
+uint8_t* Chassis::allocateOwnedPoints( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                       Fxt::Point::DatabaseApi&          pointDb ) noexcept
+{
+    size_t   size   = Fxt::Point::OwnershipDatabase::bitmapSize( pointDb.getMaxNumPoints() );
+    uint8_t* bitmap = (uint8_t*) generalAllocator.allocate( size );
+    if ( bitmap )
+    {
+        memset( bitmap, 0, size );
+    }
+    return bitmap;
+}
+
 //////////////////////////////////////////////////
 Fxt::Type::Error Chassis::resolveReferences( Fxt::Point::DatabaseApi & pointDb )  noexcept
 {
@@ -302,6 +322,11 @@ uint64_t Chassis::getFER() const noexcept
     return m_fer;
 }
 
+ServerApi& Chassis::getServer() noexcept
+{
+    return m_server;
+}
+
 uint16_t Chassis::getNumScanners() const noexcept
 {
     return m_error == Fxt::Type::Error::SUCCESS() ? m_numScanners : 0;
@@ -488,6 +513,11 @@ Fxt::Type::Error Chassis::buildSchedule() noexcept
         curScannerElem                 = sortedScannerList.next( *curScannerElem );
     }
 
+    // Empty the sorted list so that the schedule can be re-built (e.g. after a hot-swap)
+    while ( sortedScannerList.get() )
+    {
+    }
+
     // Sort ExecutionSets by their's ERM (lowest multiplier first)
     Cpl::Container::DList<ExecutionSetApi> sortedExecutionSetList;
     for ( uint16_t i=0; i < m_numExecutionSets; i++ )
@@ -539,9 +569,356 @@ Fxt::Type::Error Chassis::buildSchedule() noexcept
         curExeSetElem                     = sortedExecutionSetList.next( *curExeSetElem );
     }
 
+    // Empty the sorted list so that the schedule can be re-built
+    while ( sortedExecutionSetList.get() )
+    {
+    }
+
+    return Fxt::Type::Error::SUCCESS();
+}
+
+//////////////////////////////////////////////////
+Fxt::Type::Error Chassis::replaceScanner( uint16_t                 scannerIndex,
+                                          ScannerApi&              newScanner,
+                                          Fxt::Point::DatabaseApi& stagingDb,
+                                          Fxt::Point::DatabaseApi& pointDb,
+                                          uint64_t                 currentElapsedTimeUsec,
+                                          ScannerApi*&             replacedScanner ) noexcept
+{
+    if ( m_error != Fxt::Type::Error::SUCCESS() )
+    {
+        return m_error;
+    }
+    if ( scannerIndex >= m_numScanners || m_scanners[scannerIndex] == nullptr )
+    {
+        Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_INVALID_INDEX );
+        errcode.logIt( "scannerIndex=%u", scannerIndex );
+        return errcode;
+    }
+    if ( newScanner.getErrorCode() != Fxt::Type::Error::SUCCESS() )
+    {
+        Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_UNIT_ERROR );
+        errcode.logIt();
+        return errcode;
+    }
+
+    // Check for duplicate Slot numbers (the cards being replaced are excluded)
+    bool usedSlots[256];
+    memset( usedSlots, 0, sizeof( usedSlots ) );
+    for ( uint16_t i=0; i < m_numScanners; i++ )
+    {
+        if ( i != scannerIndex && m_scanners[i] )
+        {
+            for ( uint16_t idx=0; idx < m_scanners[i]->getNumCards(); idx++ )
+            {
+                usedSlots[m_scanners[i]->getCard( idx )->getSlotNumber()] = true;
+            }
+        }
+    }
+    for ( uint16_t idx=0; idx < newScanner.getNumCards(); idx++ )
+    {
+        Fxt::Card::Api* card = newScanner.getCard( idx );
+        if ( usedSlots[card->getSlotNumber()] )
+        {
+            Fxt::Type::Error errcode = fullErr( Err_T::DUPLICATE_SLOT_ASSIGNMENTS );
+            errcode.logIt( card->getTypeName() );
+            return errcode;
+        }
+        usedSlots[card->getSlotNumber()] = true;
+    }
+
+    // Build the Point redirects BEFORE pausing the Chassis (i.e. only pointer swaps occur while paused)
+    Redirect_T       plan[OPTION_FXT_CHASSIS_MAX_HOTSWAP_REDIRECTS];
+    unsigned         numPlanned = 0;
+    Fxt::Type::Error errcode    = planStagedPoints( stagingDb, pointDb, plan, numPlanned );
+    if ( errcode != Fxt::Type::Error::SUCCESS() )
+    {
+        return errcode;
+    }
+
+    // Swap the Scanners at a FER boundary
+    ScannerApi* oldScanner = m_scanners[scannerIndex];
+    pauseServer();
+    if ( m_started )
+    {
+        oldScanner->stop( m_server.getMailbox() );
+        if ( !newScanner.start( m_server.getMailbox(), currentElapsedTimeUsec ) )
+        {
+            // Restore the original Scanner
+            newScanner.stop( m_server.getMailbox() );
+            if ( !oldScanner->start( m_server.getMailbox(), currentElapsedTimeUsec ) )
+            {
+                // Leave the Chassis Server paused (same as a failed Chassis start)
+                m_error = fullErr( Err_T::HOTSWAP_FAILED_RESTORE );
+                m_error.logIt();
+                return m_error;
+            }
+            resumeServer();
+
+            errcode = fullErr( Err_T::HOTSWAP_FAILED_START );
+            errcode.logIt();
+            return errcode;
+        }
+    }
+
+    applyStagedPoints( pointDb, plan, numPlanned );
+    m_scanners[scannerIndex] = &newScanner;
+    memcpy( m_usedSlots, usedSlots, sizeof( m_usedSlots ) );
+    replacedScanner = oldScanner;
+    resumeServer();
+    return Fxt::Type::Error::SUCCESS();
+}
+
+Fxt::Type::Error Chassis::replaceExecutionSet( uint16_t                 executionSetIndex,
+                                               ExecutionSetApi&         newExecutionSet,
+                                               Fxt::Point::DatabaseApi& stagingDb,
+                                               Fxt::Point::DatabaseApi& pointDb,
+                                               uint64_t                 currentElapsedTimeUsec,
+                                               ExecutionSetApi*&        replacedExecutionSet ) noexcept
+{
+    if ( m_error != Fxt::Type::Error::SUCCESS() )
+    {
+        return m_error;
+    }
+    if ( executionSetIndex >= m_numExecutionSets || m_executionSets[executionSetIndex] == nullptr )
+    {
+        Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_INVALID_INDEX );
+        errcode.logIt( "executionSetIndex=%u", executionSetIndex );
+        return errcode;
+    }
+    if ( newExecutionSet.getErrorCode() != Fxt::Type::Error::SUCCESS() )
+    {
+        Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_UNIT_ERROR );
+        errcode.logIt();
+        return errcode;
+    }
+
+    // Build the Point redirects BEFORE pausing the Chassis (i.e. only pointer swaps occur while paused)
+    Redirect_T       plan[OPTION_FXT_CHASSIS_MAX_HOTSWAP_REDIRECTS];
+    unsigned         numPlanned = 0;
+    Fxt::Type::Error errcode    = planStagedPoints( stagingDb, pointDb, plan, numPlanned );
+    if ( errcode != Fxt::Type::Error::SUCCESS() )
+    {
+        return errcode;
+    }
+
+    // Swap the Execution Sets at a FER boundary
+    ExecutionSetApi* oldExeSet = m_executionSets[executionSetIndex];
+    pauseServer();
+    if ( m_started )
+    {
+        oldExeSet->stop();
+        if ( newExecutionSet.start( currentElapsedTimeUsec ) != Fxt::Type::Error::SUCCESS() )
+        {
+            // Restore the original Execution Set
+            newExecutionSet.stop();
+            if ( oldExeSet->start( currentElapsedTimeUsec ) != Fxt::Type::Error::SUCCESS() )
+            {
+                // Leave the Chassis Server paused (same as a failed Chassis start)
+                m_error = fullErr( Err_T::HOTSWAP_FAILED_RESTORE );
+                m_error.logIt();
+                return m_error;
+            }
+            resumeServer();
+
+            errcode = fullErr( Err_T::HOTSWAP_FAILED_START );
+            errcode.logIt();
+            return errcode;
+        }
+    }
+
+    applyStagedPoints( pointDb, plan, numPlanned );
+    m_executionSets[executionSetIndex] = &newExecutionSet;
+    replacedExecutionSet               = oldExeSet;
+    resumeServer();
+    return Fxt::Type::Error::SUCCESS();
+}
+
+namespace {
+
+/// Old stateful data of a replaced Point and its replacement
+struct Replaced_T
+{
+    uintptr_t        oldState;
+    Fxt::Point::Api* producer;
+};
+
+/// Helper method: binary search of the (sorted) replaced Points. Returns nullptr if not found
+Fxt::Point::Api* findReplaced_( const Replaced_T* replaced, unsigned numReplaced, uintptr_t state )
+{
+    unsigned lo = 0;
+    unsigned hi = numReplaced;
+    while ( lo < hi )
+    {
+        unsigned mid = lo + (hi - lo) / 2;
+        if ( replaced[mid].oldState == state )
+        {
+            return replaced[mid].producer;
+        }
+        if ( replaced[mid].oldState < state )
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return nullptr;
+}
+
+} // end anonymous namespace
+
+Fxt::Type::Error Chassis::planStagedPoints( Fxt::Point::DatabaseApi& stagingDb,
+                                            Fxt::Point::DatabaseApi& pointDb,
+                                            Redirect_T*              plan,
+                                            unsigned&                numPlanned ) noexcept
+{
+    Replaced_T replaced[OPTION_FXT_CHASSIS_MAX_HOTSWAP_REDIRECTS];
+    unsigned   numReplaced = 0;
+    numPlanned             = 0;
+
+    // Validate the staged Points, and collect the new Points and the stateful data of the replaced Points
+    for ( uint32_t id=0; id < stagingDb.getMaxNumPoints(); id++ )
+    {
+        Fxt::Point::Api* staged = stagingDb.lookupById( id );
+        if ( staged == nullptr )
+        {
+            continue;
+        }
+
+        Fxt::Point::Api* existing = pointDb.lookupById( id );
+        if ( existing == nullptr )
+        {
+            // New Point ID -->must fit in the Node's Point database
+            if ( id >= pointDb.getMaxNumPoints() )
+            {
+                Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_POINT_DB_FULL );
+                errcode.logIt( "id=%lu", (unsigned long) id );
+                return errcode;
+            }
+            if ( numPlanned >= OPTION_FXT_CHASSIS_MAX_HOTSWAP_REDIRECTS )
+            {
+                Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_TOO_MANY_REDIRECTS );
+                errcode.logIt();
+                return errcode;
+            }
+            plan[numPlanned++] = { nullptr, staged };
+            continue;
+        }
+        if ( existing == staged )
+        {
+            continue;
+        }
+        if ( !existing->isSameType( *staged ) || existing->getStatefulDataSize() != staged->getStatefulDataSize() )
+        {
+            Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_INCOMPATIBLE_POINT );
+            errcode.logIt( "id=%lu", (unsigned long) id );
+            return errcode;
+        }
+
+        uintptr_t oldState = (uintptr_t) existing->getStartOfStatefulMemory_();
+        if ( oldState == 0 || oldState == (uintptr_t) staged->getStartOfStatefulMemory_() )
+        {
+            continue;
+        }
+        if ( numReplaced >= OPTION_FXT_CHASSIS_MAX_HOTSWAP_REDIRECTS )
+        {
+            Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_TOO_MANY_REDIRECTS );
+            errcode.logIt();
+            return errcode;
+        }
+
+        // Keep the list sorted by the old stateful data address (insertion sort)
+        unsigned idx = numReplaced++;
+        while ( idx > 0 && replaced[idx - 1].oldState > oldState )
+        {
+            replaced[idx] = replaced[idx - 1];
+            idx--;
+        }
+        replaced[idx] = { oldState, staged };
+    }
+
+    // Single pass of the Node's Point database to find the replaced Points - and all of their aliases
+    if ( numReplaced > 0 )
+    {
+        for ( uint32_t id=0; id < pointDb.getMaxNumPoints(); id++ )
+        {
+            Fxt::Point::Api* pt = pointDb.lookupById( id );
+            if ( pt == nullptr )
+            {
+                continue;
+            }
+            Fxt::Point::Api* producer = findReplaced_( replaced, numReplaced, (uintptr_t) pt->getStartOfStatefulMemory_() );
+            if ( producer == nullptr )
+            {
+                continue;
+            }
+
+            // Points of other (running) Chassis can NOT be redirected at this Chassis's FER boundary
+            if ( !isOwnedPoint( id ) )
+            {
+                Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_FOREIGN_POINT );
+                errcode.logIt( "id=%lu", (unsigned long) id );
+                return errcode;
+            }
+            if ( numPlanned >= OPTION_FXT_CHASSIS_MAX_HOTSWAP_REDIRECTS )
+            {
+                Fxt::Type::Error errcode = fullErr( Err_T::HOTSWAP_TOO_MANY_REDIRECTS );
+                errcode.logIt();
+                return errcode;
+            }
+            plan[numPlanned++] = { pt, producer };
+        }
+    }
+
     return Fxt::Type::Error::SUCCESS();
 }
 
+void Chassis::applyStagedPoints( Fxt::Point::DatabaseApi& pointDb, const Redirect_T* plan, unsigned numPlanned ) noexcept
+{
+    // NOTE: The plan has already been validated, i.e. the add/aliasing can not fail
+    for ( unsigned i=0; i < numPlanned; i++ )
+    {
+        if ( plan[i].point == nullptr )
+        {
+            pointDb.add( *plan[i].producer );
+            if ( m_ownedPts )
+            {
+                Fxt::Point::OwnershipDatabase::setOwned( m_ownedPts, plan[i].producer->getId() );
+            }
+        }
+        else
+        {
+            plan[i].point->aliasTo_( *plan[i].producer );
+        }
+    }
+}
+
+bool Chassis::isOwnedPoint( uint32_t pointId ) const noexcept
+{
+    return m_ownedPts == nullptr || Fxt::Point::OwnershipDatabase::isOwned( m_ownedPts, pointId );
+}
+
+void Chassis::pauseServer() noexcept
+{
+    // Note: The Chassis Server processes the close request between passes of its schedulers, i.e. on a FER boundary
+    if ( m_started )
+    {
+        m_server.close();
+    }
+}
+
+void Chassis::resumeServer() noexcept
+{
+    buildSchedule();
+    if ( m_started )
+    {
+        ChassisPeriods_T periodsInfo ={ m_inputPeriods, m_executionPeriods, m_outputPeriods };
+        m_server.open( &periodsInfo );
+    }
+}
+
 //////////////////////////////////////////////////
 Api* Api::createChassisfromJSON( JsonVariant                         chassisJsonObject,
                                  ServerApi&                          chassisServer,
@@ -602,6 +979,16 @@ Api* Api::createChassisfromJSON( JsonVariant                         chassisJson
         return nullptr;
     }
 
+    // Allocate the bitmap used to track the Points owned by the Chassis (see hot-swap)
+    uint8_t* ownedPts = Chassis::allocateOwnedPoints( generalAllocator, dbForPoints );
+    if ( ownedPts == nullptr )
+    {
+        chassisErrorode = fullErr( Err_T::NO_MEMORY_OWNED_PTS_LIST );
+        chassisErrorode.logIt();
+        return nullptr;
+    }
+    Fxt::Point::OwnershipDatabase ownedDb( dbForPoints, ownedPts );
+
     // Create Chassis instance
     void* memChassis = generalAllocator.allocate( sizeof( Chassis ) );
     if ( memChassis == nullptr )
@@ -610,7 +997,7 @@ Api* Api::createChassisfromJSON( JsonVariant                         chassisJson
         chassisErrorode.logIt();
         return nullptr;
     }
-    Api* chassis = new(memChassis) Chassis( chassisServer, generalAllocator, fer, (uint16_t) numScanners, (uint16_t) numExecutionSets, (uint16_t) numSharedPts );
+    Api* chassis = new(memChassis) Chassis( chassisServer, generalAllocator, fer, (uint16_t) numScanners, (uint16_t) numExecutionSets, (uint16_t) numSharedPts, ownedPts );
 
     // Create Scanners
     for ( uint16_t i=0; i < numScanners; i++ )
@@ -623,7 +1010,7 @@ Api* Api::createChassisfromJSON( JsonVariant                         chassisJson
                                                                            haStatefulDataAllocator,
                                                                            cardFactoryDb,
                                                                            pointFactoryDb,
-                                                                           dbForPoints,
+                                                                           ownedDb,
                                                                            errorCode );
         if ( scanner == nullptr )
         {
@@ -657,7 +1044,7 @@ Api* Api::createChassisfromJSON( JsonVariant                         chassisJson
                                                                                     generalAllocator,
                                                                                     haStatefulDataAllocator,
                                                                                     pointFactoryDb,
-                                                                                    dbForPoints,
+                                                                                    ownedDb,
                                                                                     errorCode );
         if ( exeSet == nullptr )
         {
@@ -681,7 +1068,8 @@ Api* Api::createChassisfromJSON( JsonVariant                         chassisJson
         }
     }
 
-    // Create Shared Points
+    // Create Shared Points.  Note: The Shared Points' stateful data is cache line aligned/padded (they are read/written by multiple chassis)
+    Fxt::System::CacheAlignedAllocator sharedPtsAllocator( haStatefulDataAllocator );
     for ( size_t i=0; i < sharedPtsObj.size(); i++ )
     {
         Fxt::Type::Error pointError;
@@ -689,8 +1077,8 @@ Api* Api::createChassisfromJSON( JsonVariant                         chassisJson
         Fxt::Point::Api* pt = pointFactoryDb.createPointfromJSON( pointJson,
                                                                   pointError,
                                                                   generalAllocator,
-                                                                  haStatefulDataAllocator,     // Note: Share points ARE part of the HA data
-                                                                  dbForPoints,
+                                                                  sharedPtsAllocator,          // Note: Share points ARE part of the HA data
+                                                                  ownedDb,
                                                                   "id",
                                                                   true );
         if ( pt == nullptr )
@@ -720,3 +1108,235 @@ Api* Api::createChassisfromJSON( JsonVariant                         chassisJson
     return chassis;
 }
 
+//////////////////////////////////////////////////
+Api* Api::createChassisfromStream( Cpl::Json::PullParser&              parser,
+                                   JsonDocument&                       elementDoc,
+                                   ServerApi&                          chassisServer,
+                                   Fxt::Component::FactoryDatabaseApi& componentFactory,
+                                   Fxt::Card::FactoryDatabaseApi&      cardFactoryDb,
+                                   Cpl::Memory::ContiguousAllocator&   generalAllocator,
+                                   Cpl::Memory::ContiguousAllocator&   cardStatefulDataAllocator,
+                                   Cpl::Memory::ContiguousAllocator&   haStatefulDataAllocator,
+                                   Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
+                                   Fxt::Point::DatabaseApi&            dbForPoints,
+                                   Fxt::Type::Error&                   chassisErrorode ) noexcept
+{
+    // The child objects are created BEFORE the Chassis (their counts are not known until the end of their arrays)
+    typedef StreamLink_<Fxt::Point::Api>     PointLink_T;
+    Cpl::Container::SList<ScannerApi>        scanners;
+    Cpl::Container::SList<ExecutionSetApi>   executionSets;
+    Cpl::Container::SList<PointLink_T>       sharedPts;
+    size_t                                   numScanners      = 0;
+    size_t                                   numExecutionSets = 0;
+    size_t                                   numSharedPts     = 0;
+    bool                                     foundScanners    = false;
+    bool                                     foundExeSets     = false;
+    uint64_t                                 fer              = (uint64_t) (-1);
+    char                                     key[OPTION_FXT_CHASSIS_STREAM_MAX_KEY_LEN];
+
+    // Allocate the bitmap used to track the Points owned by the Chassis (see hot-swap)
+    uint8_t* ownedPts = Chassis::allocateOwnedPoints( generalAllocator, dbForPoints );
+    if ( ownedPts == nullptr )
+    {
+        chassisErrorode = fullErr( Err_T::NO_MEMORY_OWNED_PTS_LIST );
+        chassisErrorode.logIt();
+        return nullptr;
+    }
+    Fxt::Point::OwnershipDatabase ownedDb( dbForPoints, ownedPts );
+
+    chassisErrorode = Fxt::Type::Error::SUCCESS();
+    parser.beginObject();
+    while ( chassisErrorode == Fxt::Type::Error::SUCCESS() && parser.nextKey( key, sizeof( key ) ) )
+    {
+        // Create Scanners
+        if ( strcmp( key, "scanners" ) == 0 )
+        {
+            foundScanners = true;
+            parser.beginArray();
+            while ( parser.nextElement() )
+            {
+                Fxt::Type::Error  errorCode = Fxt::Type::Error::SUCCESS();
+                ScannerApi*       scanner   = ScannerApi::createScannerfromStream( parser,
+                                                                                   elementDoc,
+                                                                                   generalAllocator,
+                                                                                   cardStatefulDataAllocator,
+                                                                                   haStatefulDataAllocator,
+                                                                                   cardFactoryDb,
+                                                                                   pointFactoryDb,
+                                                                                   ownedDb,
+                                                                                   errorCode );
+                if ( scanner == nullptr )
+                {
+                    chassisErrorode = fullErr( Err_T::FAILED_CREATE_SCANNER );
+                    chassisErrorode.logIt();
+                    break;
+                }
+                scanners.put( *scanner );
+                numScanners++;
+            }
+        }
+
+        // Create ExecutionSets
+        else if ( strcmp( key, "executionSets" ) == 0 )
+        {
+            foundExeSets = true;
+            parser.beginArray();
+            while ( parser.nextElement() )
+            {
+                Fxt::Type::Error  errorCode = Fxt::Type::Error::SUCCESS();
+                ExecutionSetApi*  exeSet    = ExecutionSetApi::createExecutionSetfromStream( parser,
+                                                                                             elementDoc,
+                                                                                             componentFactory,
+                                                                                             generalAllocator,
+                                                                                             haStatefulDataAllocator,
+                                                                                             pointFactoryDb,
+                                                                                             ownedDb,
+                                                                                             errorCode );
+                if ( exeSet == nullptr )
+                {
+                    chassisErrorode = fullErr( Err_T::FAILED_CREATE_EXESET );
+                    chassisErrorode.logIt();
+                    break;
+                }
+                executionSets.put( *exeSet );
+                numExecutionSets++;
+            }
+        }
+
+        // Create Shared Points
+        else if ( strcmp( key, "sharedPts" ) == 0 )
+        {
+            Fxt::System::CacheAlignedAllocator sharedPtsAllocator( haStatefulDataAllocator );   // Same cache line padding as createChassisfromJSON()
+            parser.beginArray();
+            while ( parser.nextElement() )
+            {
+                if ( !readStreamElement_( parser, elementDoc, chassisErrorode ) )
+                {
+                    break;
+                }
+
+                Fxt::Type::Error pointError;
+                JsonObject       pointJson = elementDoc.as<JsonObject>();
+                Fxt::Point::Api* pt = pointFactoryDb.createPointfromJSON( pointJson,
+                                                                          pointError,
+                                                                          generalAllocator,
+                                                                          sharedPtsAllocator,          // Note: Share points ARE part of the HA data
+                                                                          ownedDb,
+                                                                          "id",
+                                                                          true );
+                if ( pt == nullptr )
+                {
+                    chassisErrorode = fullErr( Err_T::FAILED_CREATE_SHARED_POINTS );
+                    chassisErrorode.logIt();
+                    break;
+                }
+                PointLink_T* link = new(std::nothrow) PointLink_T( *pt );
+                if ( link == nullptr )
+                {
+                    chassisErrorode = fullErr( Err_T::NO_MEMORY_SHARED_PTS_LIST );
+                    chassisErrorode.logIt();
+                    break;
+                }
+                sharedPts.put( *link );
+                numSharedPts++;
+            }
+        }
+
+        // Parse Fundamental Execution Rate
+        else if ( strcmp( key, "fer" ) == 0 )
+        {
+            parser.readUnsigned( fer );
+        }
+        else
+        {
+            parser.skipValue();
+        }
+    }
+
+    // Minimal syntax checking of the JSON input
+    if ( checkStream_( parser, chassisErrorode ) )
+    {
+        if ( !foundScanners || numScanners == 0 )
+        {
+            chassisErrorode = fullErr( Err_T::PARSE_SCANNER_ARRAY );
+            chassisErrorode.logIt();
+        }
+        else if ( !foundExeSets || numExecutionSets == 0 )
+        {
+            chassisErrorode = fullErr( Err_T::PARSE_EXECUTION_SET_ARRAY );
+            chassisErrorode.logIt();
+        }
+        else if ( fer == ((uint64_t) (-1)) )
+        {
+            chassisErrorode = fullErr( Err_T::MISSING_FER );
+            chassisErrorode.logIt();
+        }
+    }
+
+    // Create Chassis instance
+    Api* chassis = nullptr;
+    if ( chassisErrorode == Fxt::Type::Error::SUCCESS() )
+    {
+        void* memChassis = generalAllocator.allocate( sizeof( Chassis ) );
+        if ( memChassis == nullptr )
+        {
+            chassisErrorode = fullErr( Err_T::NO_MEMORY_CHASSIS );
+            chassisErrorode.logIt();
+        }
+        else
+        {
+            chassis = new(memChassis) Chassis( chassisServer, generalAllocator, fer, (uint16_t) numScanners, (uint16_t) numExecutionSets, (uint16_t) numSharedPts, ownedPts );
+        }
+    }
+
+    // Transfer the child objects to the Chassis (or clean-up on failure)
+    ScannerApi* scanner;
+    while ( (scanner = scanners.get()) )
+    {
+        if ( chassis && chassisErrorode == Fxt::Type::Error::SUCCESS() )
+        {
+            chassisErrorode = chassis->add( *scanner );
+            if ( chassisErrorode == Fxt::Type::Error::SUCCESS() )
+            {
+                continue;
+            }
+        }
+        scanner->~ScannerApi();
+    }
+    ExecutionSetApi* exeSet;
+    while ( (exeSet = executionSets.get()) )
+    {
+        if ( chassis && chassisErrorode == Fxt::Type::Error::SUCCESS() )
+        {
+            chassisErrorode = chassis->add( *exeSet );
+            if ( chassisErrorode == Fxt::Type::Error::SUCCESS() )
+            {
+                continue;
+            }
+        }
+        exeSet->~ExecutionSetApi();
+    }
+    PointLink_T* link;
+    while ( (link = sharedPts.get()) )
+    {
+        // Note: Shared Points are owned by the Point Database (i.e. they are NOT destroyed on failure)
+        if ( chassis && chassisErrorode == Fxt::Type::Error::SUCCESS() )
+        {
+            chassisErrorode = chassis->add( link->m_item );
+        }
+        delete link;
+    }
+
+    // Build the Chassis's execution schedule
+    if ( chassis && chassisErrorode == Fxt::Type::Error::SUCCESS() )
+    {
+        chassisErrorode = chassis->buildSchedule();
+    }
+    if ( chassis && chassisErrorode != Fxt::Type::Error::SUCCESS() )
+    {
+        chassis->~Api();
+        return nullptr;
+    }
+
+    return chassis;
+}
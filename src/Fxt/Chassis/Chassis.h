@@ -16,6 +16,16 @@
 #include "Fxt/Chassis/Api.h"
 #include "Fxt/Chassis/Server.h"
 
+
+/** Maximum number of Point redirects/additions that a single hot-swap can
+    perform (i.e. the number of Point instances - including aliases - whose
+    stateful data is redirected plus the number of new Points).  The redirect
+    plan is built on the caller's stack BEFORE the Chassis is paused.
+ */
+#ifndef OPTION_FXT_CHASSIS_MAX_HOTSWAP_REDIRECTS
+#define OPTION_FXT_CHASSIS_MAX_HOTSWAP_REDIRECTS        64
+#endif
+
 ///
 namespace Fxt {
 ///
@@ -27,17 +37,29 @@ namespace Chassis {
 class Chassis : public Api
 {
 public:
-    /// Constructor
+    /** Constructor.  The 'ownedPoints' argument is the bitmap of the Point
+        IDs that are created by the Chassis (see allocateOwnedPoints() and
+        Fxt::Point::OwnershipDatabase).  When 'ownedPoints' is nullptr, ALL
+        Points are treated as being owned by the Chassis.
+     */
     Chassis( ServerApi&                         chassisServer,
              Cpl::Memory::ContiguousAllocator&  generalAllocator, 
              uint64_t                           fer,
              uint16_t                           numScanners,
              uint16_t                           numExecutionSets,
-             uint16_t                           numSharedPts );
+             uint16_t                           numSharedPts,
+             uint8_t*                           ownedPoints = nullptr );
     
     /// Destructor
     ~Chassis();
 
+public:
+    /** This method allocates (and zeros) the bitmap used to track the Points
+        owned by a Chassis.  Returns nullptr if there is not enough memory.
+     */
+    static uint8_t* allocateOwnedPoints( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                         Fxt::Point::DatabaseApi&          pointDb ) noexcept;
+
 public:
     /// See Fxt::Chassis::Api
     Fxt::Type::Error resolveReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept;
@@ -63,12 +85,31 @@ public:
     /// See Fxt::Chassis::Api
     Fxt::Type::Error buildSchedule() noexcept;
 
+    /// See Fxt::Chassis::Api
+    Fxt::Type::Error replaceScanner( uint16_t                 scannerIndex,
+                                     ScannerApi&              newScanner,
+                                     Fxt::Point::DatabaseApi& stagingDb,
+                                     Fxt::Point::DatabaseApi& pointDb,
+                                     uint64_t                 currentElapsedTimeUsec,
+                                     ScannerApi*&             replacedScanner ) noexcept;
+
+    /// See Fxt::Chassis::Api
+    Fxt::Type::Error replaceExecutionSet( uint16_t                 executionSetIndex,
+                                          ExecutionSetApi&         newExecutionSet,
+                                          Fxt::Point::DatabaseApi& stagingDb,
+                                          Fxt::Point::DatabaseApi& pointDb,
+                                          uint64_t                 currentElapsedTimeUsec,
+                                          ExecutionSetApi*&        replacedExecutionSet ) noexcept;
+
     /// See Fxt::Chassis::Api
     Fxt::Type::Error getErrorCode() const noexcept;
 
     /// See Fxt::Chassis::Api
     uint64_t getFER() const noexcept;
 
+    /// See Fxt::Chassis::Api
+    ServerApi& getServer() noexcept;
+
     /// See Fxt::Chassis::Api
     uint16_t getNumScanners() const noexcept;
 
@@ -81,6 +122,38 @@ public:
     /// See Fxt::Chassis::Api
     Fxt::Chassis::ExecutionSetApi* getExecutionSet( uint16_t executionSetIndex ) noexcept;
 
+protected:
+    /** A single step of the hot-swap Point merge.  When 'point' is nullptr,
+        'producer' is a new Point that is added to the Node's Point Database;
+        else 'point' is redirected to the stateful data of 'producer'.
+     */
+    struct Redirect_T
+    {
+        Fxt::Point::Api* point;     //!< Existing Point (or alias) to redirect
+        Fxt::Point::Api* producer;  //!< Staged Point
+    };
+
+    /** Helper method: verifies that the staged Points can replace the existing
+        Points and builds the list of Point redirects/additions.  MUST be called
+        BEFORE the Chassis is paused.
+     */
+    Fxt::Type::Error planStagedPoints( Fxt::Point::DatabaseApi& stagingDb,
+                                       Fxt::Point::DatabaseApi& pointDb,
+                                       Redirect_T*              plan,
+                                       unsigned&                numPlanned ) noexcept;
+
+    /// Helper method: applies the redirects/additions built by planStagedPoints()
+    void applyStagedPoints( Fxt::Point::DatabaseApi& pointDb, const Redirect_T* plan, unsigned numPlanned ) noexcept;
+
+    /// Helper method: returns true if the Point ID was created by the Chassis
+    bool isOwnedPoint( uint32_t pointId ) const noexcept;
+
+    /// Helper method: pauses the Chassis server (when running)
+    void pauseServer() noexcept;
+
+    /// Helper method: rebuilds the schedule and resumes the Chassis server (when running)
+    void resumeServer() noexcept;
+
 protected:
     /// Reference/Handle to the Chassis server (aka the runnable-object/thread that executes the chassis)
     ServerApi&                          m_server;
@@ -94,6 +167,9 @@ protected:
     /// Array/List of Shared points
     Fxt::Point::Api**                   m_sharedPts;
 
+    /// Bitmap of the Point IDs owned by the Chassis (nullptr -->all Points are owned)
+    uint8_t*                            m_ownedPts;
+
     /// Array/List of Periods for scanning inputs
     Fxt::System::PeriodApi**            m_inputPeriods;
 
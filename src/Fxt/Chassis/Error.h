@@ -79,6 +79,18 @@ namespace Chassis {
     @param TOO_MANY_SHARED_PTS              Attempted to add more Shared Points that what was specified when the Chassis was constructed
     @param MISSING_SHARED_PTS               At least one or more Shared Points where not added to the Chassis (as defined by the number specified in the Chassis constructor)
     @param DUPLICATE_SLOT_ASSIGNMENTS       One or more cards have the same slot number/assignment in the chassis
+    @param NO_MEMORY_TRANSFER_PLAN          Unable to allocate memory for the Scanner's IO Register block transfer plans
+    @param HOTSWAP_INVALID_INDEX            Hot-swap: The Scanner/ExecutionSet index is out of range
+    @param HOTSWAP_UNIT_ERROR               Hot-swap: The replacement Scanner/ExecutionSet is in the error state
+    @param HOTSWAP_INCOMPATIBLE_POINT       Hot-swap: A replacement Point has a different type/size than the existing Point with the same ID
+    @param HOTSWAP_POINT_DB_FULL            Hot-swap: Unable to add a new Point to the Node's Point Database
+    @param HOTSWAP_FAILED_START             Hot-swap: The replacement Scanner/ExecutionSet failed to start (the original was restored)
+    @param HOTSWAP_FAILED_RESTORE           Hot-swap: The original Scanner/ExecutionSet failed to re-start after a failed swap
+    @param STREAM_SYNTAX_ERROR              Streamed JSON input is malformed or was truncated
+    @param STREAM_ELEMENT_TOO_LARGE         A streamed Card, Logic Chain, or Shared Point does not fit in the element JSON document
+    @param NO_MEMORY_OWNED_PTS_LIST         Unable to allocate memory for the list of Points owned by the Chassis
+    @param HOTSWAP_FOREIGN_POINT            Hot-swap: A replaced Point is owned by - or is aliased by a Point owned by - another Chassis
+    @param HOTSWAP_TOO_MANY_REDIRECTS       Hot-swap: The number of Point redirects/additions exceeds OPTION_FXT_CHASSIS_MAX_HOTSWAP_REDIRECTS
  */
 BETTER_ENUM( Err_T, uint8_t
              , SUCCESS = 0
@@ -130,6 +142,18 @@ BETTER_ENUM( Err_T, uint8_t
              , TOO_MANY_SHARED_PTS
              , MISSING_SHARED_PTS
              , DUPLICATE_SLOT_ASSIGNMENTS
+             , NO_MEMORY_TRANSFER_PLAN
+             , HOTSWAP_INVALID_INDEX
+             , HOTSWAP_UNIT_ERROR
+             , HOTSWAP_INCOMPATIBLE_POINT
+             , HOTSWAP_POINT_DB_FULL
+             , HOTSWAP_FAILED_START
+             , HOTSWAP_FAILED_RESTORE
+             , STREAM_SYNTAX_ERROR
+             , STREAM_ELEMENT_TOO_LARGE
+             , NO_MEMORY_OWNED_PTS_LIST
+             , HOTSWAP_FOREIGN_POINT
+             , HOTSWAP_TOO_MANY_REDIRECTS
 );
 
 /** This concrete class defines the Error Category for the Logic Chain namespace.
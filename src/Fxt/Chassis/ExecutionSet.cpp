@@ -13,8 +13,11 @@
 
 #include "ExecutionSet.h"
 #include "Error.h"
+#include "Stream_.h"
+#include "Cpl/Container/SList.h"
 #include "Cpl/System/Assert.h"
 #include <new>
+#include <string.h>
 
 
 ///
@@ -280,3 +283,140 @@ ExecutionSetApi* ExecutionSetApi::createExecutionSetfromJSON( JsonVariant
     return executionSet;
 }
 
+//////////////////////////////////////////////////
+ExecutionSetApi* ExecutionSetApi::createExecutionSetfromStream( Cpl::Json::PullParser&              parser,
+                                                                JsonDocument&                       elementDoc,
+                                                                Fxt::Component::FactoryDatabaseApi& componentFactory,
+                                                                Cpl::Memory::ContiguousAllocator&   generalAllocator,
+                                                                Cpl::Memory::ContiguousAllocator&   haStatefulDataAllocator,
+                                                                Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
+                                                                Fxt::Point::DatabaseApi&            dbForPoints,
+                                                                Fxt::Type::Error&                   executionSetErrorode ) noexcept
+{
+    // The Logic Chains are created BEFORE the ExecutionSet (the number of chains is not known until the end of the "logicChains" array)
+    typedef StreamLink_<Fxt::LogicChain::Api> ChainLink_T;
+    Cpl::Container::SList<ChainLink_T>        logicChains;
+    size_t                                    numLogicChains = 0;
+    bool                                      foundChains    = false;
+    uint64_t                                  erm            = (uint64_t) (-1);
+    char                                      key[OPTION_FXT_CHASSIS_STREAM_MAX_KEY_LEN];
+
+    executionSetErrorode = Fxt::Type::Error::SUCCESS();
+    parser.beginObject();
+    while ( executionSetErrorode == Fxt::Type::Error::SUCCESS() && parser.nextKey( key, sizeof( key ) ) )
+    {
+        if ( strcmp( key, "logicChains" ) == 0 )
+        {
+            foundChains = true;
+            parser.beginArray();
+            while ( parser.nextElement() )
+            {
+                if ( !readStreamElement_( parser, elementDoc, executionSetErrorode ) )
+                {
+                    break;
+                }
+
+                Fxt::Type::Error      errorCode      = Fxt::Type::Error::SUCCESS();
+                JsonVariant           logicChainJson = elementDoc.as<JsonVariant>();
+                Fxt::LogicChain::Api* logicChain     = Fxt::LogicChain::Api::createLogicChainfromJSON( logicChainJson,
+                                                                                                       componentFactory,
+                                                                                                       generalAllocator,
+                                                                                                       haStatefulDataAllocator,
+                                                                                                       pointFactoryDb,
+                                                                                                       dbForPoints,
+                                                                                                       errorCode );
+                if ( logicChain == nullptr )
+                {
+                    executionSetErrorode = fullErr( Err_T::FAILED_CREATE_LOGIC_CHAIN );
+                    executionSetErrorode.logIt();
+                    break;
+                }
+                if ( errorCode != Fxt::Type::Error::SUCCESS() )
+                {
+                    executionSetErrorode = fullErr( Err_T::LOGIC_CHAIN_CREATE_ERROR );
+                    executionSetErrorode.logIt();
+                    logicChain->~Api();
+                    break;
+                }
+                ChainLink_T* link = new(std::nothrow) ChainLink_T( *logicChain );
+                if ( link == nullptr )
+                {
+                    executionSetErrorode = fullErr( Err_T::NO_MEMORY_LOGIC_CHAIN_LIST );
+                    executionSetErrorode.logIt();
+                    logicChain->~Api();
+                    break;
+                }
+                logicChains.put( *link );
+                numLogicChains++;
+            }
+        }
+        else if ( strcmp( key, "exeRateMultiplier" ) == 0 )
+        {
+            parser.readUnsigned( erm );
+        }
+        else
+        {
+            parser.skipValue();
+        }
+    }
+
+    // Minimal syntax checking of the JSON input
+    if ( checkStream_( parser, executionSetErrorode ) )
+    {
+        if ( !foundChains )
+        {
+            executionSetErrorode = fullErr( Err_T::PARSE_LOGIC_CHAIN_ARRAY );
+            executionSetErrorode.logIt();
+        }
+        else if ( numLogicChains == 0 )
+        {
+            executionSetErrorode = fullErr( Err_T::NO_LOGIC_CHAINS );
+            executionSetErrorode.logIt();
+        }
+        else if ( erm == ((uint64_t) (-1)) )
+        {
+            executionSetErrorode = fullErr( Err_T::EXECUTION_SET_MISSING_ERM );
+            executionSetErrorode.logIt();
+        }
+    }
+
+    // Create ExecutionSet instance
+    ExecutionSetApi* executionSet = nullptr;
+    if ( executionSetErrorode == Fxt::Type::Error::SUCCESS() )
+    {
+        void* memExecutionSet = generalAllocator.allocate( sizeof( ExecutionSet ) );
+        if ( memExecutionSet == nullptr )
+        {
+            executionSetErrorode = fullErr( Err_T::NO_MEMORY_EXECUTION_SET );
+            executionSetErrorode.logIt();
+        }
+        else
+        {
+            executionSet = new(memExecutionSet) ExecutionSet( generalAllocator, (uint16_t) numLogicChains, (size_t) erm );
+        }
+    }
+
+    // Transfer the Logic Chains to the ExecutionSet (or clean-up on failure)
+    ChainLink_T* link;
+    while ( (link = logicChains.get()) )
+    {
+        Fxt::LogicChain::Api& logicChain = link->m_item;
+        delete link;
+        if ( executionSet && executionSetErrorode == Fxt::Type::Error::SUCCESS() )
+        {
+            executionSetErrorode = executionSet->add( logicChain );
+            if ( executionSetErrorode == Fxt::Type::Error::SUCCESS() )
+            {
+                continue;
+            }
+        }
+        logicChain.~Api();
+    }
+    if ( executionSet && executionSetErrorode != Fxt::Type::Error::SUCCESS() )
+    {
+        executionSet->~ExecutionSetApi();
+        return nullptr;
+    }
+
+    return executionSet;
+}
@@ -18,6 +18,7 @@
 #include "Fxt/Type/Error.h"
 #include "Fxt/System/PeriodApi.h"
 #include "Cpl/Json/Arduino.h"
+#include "Cpl/Json/PullParser.h"
 #include "Cpl/Memory/ContiguousAllocator.h"
 
 ///
@@ -131,6 +132,21 @@ public:
                                                         Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
                                                         Fxt::Point::DatabaseApi&            dbForPoints,
                                                         Fxt::Type::Error&                   executionSetErrorode ) noexcept;
+
+    /** Same as createExecutionSetfromJSON() - except the ExecutionSet is
+        parsed from a JSON stream.  The 'parser' MUST be positioned at the
+        ExecutionSet's JSON Object. Each Logic Chain is deserialized - one at a
+        time - into 'elementDoc', i.e. the capacity of 'elementDoc' only needs
+        to be large enough for the largest individual Logic Chain.
+     */
+    static ExecutionSetApi* createExecutionSetfromStream( Cpl::Json::PullParser&              parser,
+                                                          JsonDocument&                       elementDoc,
+                                                          Fxt::Component::FactoryDatabaseApi& componentFactory,
+                                                          Cpl::Memory::ContiguousAllocator&   generalAllocator,
+                                                          Cpl::Memory::ContiguousAllocator&   haStatefulDataAllocator,
+                                                          Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
+                                                          Fxt::Point::DatabaseApi&            dbForPoints,
+                                                          Fxt::Type::Error&                   executionSetErrorode ) noexcept;
 public:
     /// Virtual destructor
     virtual ~ExecutionSetApi(){};
@@ -0,0 +1,184 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "HotSwap.h"
+#include "Error.h"
+#include "Fxt/Point/OverlayDatabase.h"
+
+
+///
+using namespace Fxt::Chassis;
+
+//////////////////////////////////////////////////
+HotSwap::HotSwap( Api&                                chassis,
+                  Fxt::Component::FactoryDatabaseApi& componentFactory,
+                  Fxt::Card::FactoryDatabaseApi&      cardFactoryDb,
+                  Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
+                  Fxt::Point::DatabaseApi&            pointDb,
+                  Fxt::Point::DatabaseApi&            stagingDb,
+                  Cpl::Memory::ContiguousAllocator&   shadowGeneralAllocator,
+                  Cpl::Memory::ContiguousAllocator&   shadowCardStatefulDataAllocator,
+                  Cpl::Memory::ContiguousAllocator&   shadowHaStatefulDataAllocator ) noexcept
+    : m_chassis( chassis )
+    , m_componentFactory( componentFactory )
+    , m_cardFactoryDb( cardFactoryDb )
+    , m_pointFactoryDb( pointFactoryDb )
+    , m_pointDb( pointDb )
+    , m_stagingDb( stagingDb )
+    , m_generalAllocator( shadowGeneralAllocator )
+    , m_cardStatefulAllocator( shadowCardStatefulDataAllocator )
+    , m_haStatefulAllocator( shadowHaStatefulDataAllocator )
+{
+}
+
+HotSwap::~HotSwap()
+{
+    reclaimRetired();
+}
+
+//////////////////////////////////////////////////
+Fxt::Type::Error HotSwap::replaceScanner( uint16_t    scannerIndex,
+                                          JsonVariant scannerJsonObject,
+                                          uint64_t    currentElapsedTimeUsec ) noexcept
+{
+    reclaimRetired();
+
+    // Create the new Scanner (its Points are added to the staging database)
+    Fxt::Point::OverlayDatabase overlay( m_stagingDb, m_pointDb );
+    Fxt::Type::Error            errorCode  = Fxt::Type::Error::SUCCESS();
+    ScannerApi*                 newScanner = ScannerApi::createScannerfromJSON( scannerJsonObject,
+                                                                                m_generalAllocator,
+                                                                                m_cardStatefulAllocator,
+                                                                                m_haStatefulAllocator,
+                                                                                m_cardFactoryDb,
+                                                                                m_pointFactoryDb,
+                                                                                overlay,
+                                                                                errorCode );
+    if ( newScanner == nullptr )
+    {
+        m_stagingDb.cleanupPointsAfterNodeCreateFailure();
+        errorCode = fullErr( Err_T::FAILED_CREATE_SCANNER );
+        errorCode.logIt();
+        return errorCode;
+    }
+
+    // Swap
+    ScannerApi* oldScanner = nullptr;
+    errorCode              = m_chassis.replaceScanner( scannerIndex, *newScanner, m_stagingDb, m_pointDb, currentElapsedTimeUsec, oldScanner );
+    if ( errorCode != Fxt::Type::Error::SUCCESS() )
+    {
+        newScanner->~ScannerApi();
+    }
+    else
+    {
+        m_retiredScanners.put( *oldScanner );
+    }
+
+    // The staged Points are now owned by the Node's Point database (or have been abandoned)
+    m_stagingDb.cleanupPointsAfterNodeCreateFailure();
+    return errorCode;
+}
+
+Fxt::Type::Error HotSwap::replaceExecutionSet( uint16_t    executionSetIndex,
+                                               JsonVariant executionSetJsonObject,
+                                               uint64_t    currentElapsedTimeUsec ) noexcept
+{
+    reclaimRetired();
+
+    // Create the new Execution Set (its Points are added to the staging database)
+    Fxt::Point::OverlayDatabase overlay( m_stagingDb, m_pointDb );
+    Fxt::Type::Error            errorCode = Fxt::Type::Error::SUCCESS();
+    ExecutionSetApi*            newExeSet = ExecutionSetApi::createExecutionSetfromJSON( executionSetJsonObject,
+                                                                                         m_componentFactory,
+                                                                                         m_generalAllocator,
+                                                                                         m_haStatefulAllocator,
+                                                                                         m_pointFactoryDb,
+                                                                                         overlay,
+                                                                                         errorCode );
+    if ( newExeSet == nullptr )
+    {
+        m_stagingDb.cleanupPointsAfterNodeCreateFailure();
+        errorCode = fullErr( Err_T::FAILED_CREATE_EXESET );
+        errorCode.logIt();
+        return errorCode;
+    }
+
+    // Resolve references: new Points take precedence over the existing Points
+    if ( newExeSet->resolveReferences( overlay ) != Fxt::Type::Error::SUCCESS() )
+    {
+        newExeSet->~ExecutionSetApi();
+        m_stagingDb.cleanupPointsAfterNodeCreateFailure();
+        errorCode = fullErr( Err_T::FAILED_POINT_RESOLVE );
+        errorCode.logIt();
+        return errorCode;
+    }
+
+    // Swap
+    ExecutionSetApi* oldExeSet = nullptr;
+    errorCode                  = m_chassis.replaceExecutionSet( executionSetIndex, *newExeSet, m_stagingDb, m_pointDb, currentElapsedTimeUsec, oldExeSet );
+    if ( errorCode != Fxt::Type::Error::SUCCESS() )
+    {
+        newExeSet->~ExecutionSetApi();
+    }
+    else
+    {
+        m_retiredExecutionSets.put( *oldExeSet );
+    }
+
+    // The staged Points are now owned by the Node's Point database (or have been abandoned)
+    m_stagingDb.cleanupPointsAfterNodeCreateFailure();
+    return errorCode;
+}
+
+//////////////////////////////////////////////////
+void HotSwap::reclaimRetired() noexcept
+{
+    // Note: Scanners with asynchronous cards can take 'a while' to fully stop
+    ScannerApi* scanner = m_retiredScanners.first();
+    while ( scanner )
+    {
+        ScannerApi* next = m_retiredScanners.next( *scanner );
+        if ( !scanner->isStarted() )
+        {
+            m_retiredScanners.remove( *scanner );
+            scanner->~ScannerApi();
+        }
+        scanner = next;
+    }
+
+    ExecutionSetApi* exeSet = m_retiredExecutionSets.first();
+    while ( exeSet )
+    {
+        ExecutionSetApi* next = m_retiredExecutionSets.next( *exeSet );
+        if ( !exeSet->isStarted() )
+        {
+            m_retiredExecutionSets.remove( *exeSet );
+            exeSet->~ExecutionSetApi();
+        }
+        exeSet = next;
+    }
+}
+
+unsigned HotSwap::getNumRetired() const noexcept
+{
+    unsigned count = 0;
+    for ( ScannerApi* scanner = m_retiredScanners.first(); scanner; scanner = m_retiredScanners.next( *scanner ) )
+    {
+        count++;
+    }
+    for ( ExecutionSetApi* exeSet = m_retiredExecutionSets.first(); exeSet; exeSet = m_retiredExecutionSets.next( *exeSet ) )
+    {
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,140 @@
+#ifndef Fxt_Chassis_HotSwap_h_
+#define Fxt_Chassis_HotSwap_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Chassis/Api.h"
+#include "Fxt/Card/FactoryDatabaseApi.h"
+#include "Cpl/Container/DList.h"
+
+///
+namespace Fxt {
+///
+namespace Chassis {
+
+
+/** This concrete class provides incremental re-provisioning of a single
+    Chassis, i.e. a Scanner (aka a set of IO Cards) or an ExecutionSet (aka a
+    set of Logic Chains) is re-created from its JSON definition and swapped
+    into the running Chassis - without stopping the rest of the Chassis (or
+    the Node).
+
+    The replacement is created using the 'shadow' allocators, i.e. the
+    Chassis's current memory is NOT touched until the swap occurs.  The new
+    Points are created in the 'staging' Point database, and the replacement's
+    Point references are resolved against the staging database first, and
+    then the Node's Point database (see Fxt::Point::OverlayDatabase).  The
+    actual swap is performed by Api::replaceScanner()/replaceExecutionSet().
+
+    Notes/Limitations:
+        - The memory for a replaced Scanner/ExecutionSet (and its Points) is
+          NOT reclaimed, i.e. each hot-swap consumes memory from the shadow
+          allocators.  When the shadow allocators are exhausted the
+          application must fall back to re-provisioning the entire Node.
+        - The number of Scanners and ExecutionSets in the Chassis is fixed,
+          i.e. a card/logic-chain is added/removed by replacing its
+          containing Scanner/ExecutionSet.
+        - The HA stateful data for the replacement is allocated from the
+          shadow HA allocator, i.e. it is NOT part of the Node's HA heap.
+        - A replaced Point that is aliased by a Point of another Chassis
+          can NOT be redirected at this Chassis's FER boundary, i.e. the
+          swap fails with HOTSWAP_FOREIGN_POINT.
+        - The class is NOT thread safe and MUST NOT be called from the
+          Chassis thread.
+ */
+class HotSwap
+{
+public:
+    /** Constructor.  The 'stagingDb' must be dedicated to the instance, i.e.
+        it is empty when not in use.
+     */
+    HotSwap( Api&                                chassis,
+             Fxt::Component::FactoryDatabaseApi& componentFactory,
+             Fxt::Card::FactoryDatabaseApi&      cardFactoryDb,
+             Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
+             Fxt::Point::DatabaseApi&            pointDb,
+             Fxt::Point::DatabaseApi&            stagingDb,
+             Cpl::Memory::ContiguousAllocator&   shadowGeneralAllocator,
+             Cpl::Memory::ContiguousAllocator&   shadowCardStatefulDataAllocator,
+             Cpl::Memory::ContiguousAllocator&   shadowHaStatefulDataAllocator ) noexcept;
+
+    /// Destructor.  Destroys all replaced Scanners/ExecutionSets that have stopped
+    ~HotSwap();
+
+public:
+    /** This method creates a new Scanner from 'scannerJsonObject' and swaps it
+        with the Chassis's Scanner at 'scannerIndex'.  Returns SUCCESS if the
+        swap occurred; else an error code is returned and the Chassis is
+        unchanged.
+     */
+    Fxt::Type::Error replaceScanner( uint16_t    scannerIndex,
+                                     JsonVariant scannerJsonObject,
+                                     uint64_t    currentElapsedTimeUsec ) noexcept;
+
+    /** This method creates a new ExecutionSet from 'executionSetJsonObject' and
+        swaps it with the Chassis's ExecutionSet at 'executionSetIndex'.
+        Returns SUCCESS if the swap occurred; else an error code is returned
+        and the Chassis is unchanged.
+     */
+    Fxt::Type::Error replaceExecutionSet( uint16_t    executionSetIndex,
+                                          JsonVariant executionSetJsonObject,
+                                          uint64_t    currentElapsedTimeUsec ) noexcept;
+
+public:
+    /** This method calls the destructor on replaced Scanners/ExecutionSets that
+        have fully stopped.  Note: The memory is NOT reclaimed (see class notes)
+     */
+    void reclaimRetired() noexcept;
+
+    /// Returns the number of replaced Scanners/ExecutionSets that have not been destroyed
+    unsigned getNumRetired() const noexcept;
+
+protected:
+    /// Chassis being re-provisioned
+    Api&                                m_chassis;
+
+    /// Component factory
+    Fxt::Component::FactoryDatabaseApi& m_componentFactory;
+
+    /// Card factory
+    Fxt::Card::FactoryDatabaseApi&      m_cardFactoryDb;
+
+    /// Point factory
+    Fxt::Point::FactoryDatabaseApi&     m_pointFactoryDb;
+
+    /// The Node's Point Database
+    Fxt::Point::DatabaseApi&            m_pointDb;
+
+    /// Staging Point Database
+    Fxt::Point::DatabaseApi&            m_stagingDb;
+
+    /// Shadow general allocator
+    Cpl::Memory::ContiguousAllocator&   m_generalAllocator;
+
+    /// Shadow Card Stateful allocator
+    Cpl::Memory::ContiguousAllocator&   m_cardStatefulAllocator;
+
+    /// Shadow HA Stateful allocator
+    Cpl::Memory::ContiguousAllocator&   m_haStatefulAllocator;
+
+    /// Replaced Scanners (waiting to be destroyed)
+    Cpl::Container::DList<ScannerApi>       m_retiredScanners;
+
+    /// Replaced ExecutionSets (waiting to be destroyed)
+    Cpl::Container::DList<ExecutionSetApi>  m_retiredExecutionSets;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
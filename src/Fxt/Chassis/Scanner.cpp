@@ -13,8 +13,11 @@
 
 #include "Scanner.h"
 #include "Error.h"
+#include "Stream_.h"
+#include "Cpl/Container/SList.h"
 #include "Cpl/System/Assert.h"
 #include <new>
+#include <string.h>
 
 
 ///
@@ -26,6 +29,8 @@ Scanner::Scanner( Cpl::Memory::ContiguousAllocator&   generalAllocator,
                   size_t                              scanRateMultipler )
     : m_inputPeriod( *this )
     , m_outputPeriod( *this )
+    , m_inputTransfers( generalAllocator, numCards )
+    , m_outputTransfers( generalAllocator, numCards )
     , m_cards( nullptr )
     , m_chassisMboxPtr( nullptr )
     , m_error( Fxt::Type::Error::SUCCESS() )
@@ -47,6 +52,13 @@ Scanner::Scanner( Cpl::Memory::ContiguousAllocator&   generalAllocator,
         // Zero the array so we can tell if there are missing cards
         memset( m_cards, 0, sizeof( Fxt::Card::Api* ) * numCards );
     }
+
+    // Check that the transfer plans were allocated
+    if ( m_error == Fxt::Type::Error::SUCCESS() && ( !m_inputTransfers.isValid() || !m_outputTransfers.isValid() ) )
+    {
+        m_error = fullErr( Err_T::NO_MEMORY_TRANSFER_PLAN );
+        m_error.logIt();
+    }
 }
 
 Scanner::~Scanner()
@@ -92,6 +104,17 @@ bool Scanner::start( Cpl::Itc::PostApi& chassisMbox, uint64_t currentElapsedTime
             }
         }
 
+        // Build the block transfer plans.  Note: Cards that do not support
+        // delegating their copies continue to perform the copies themselves
+        m_inputTransfers.clear();
+        m_outputTransfers.clear();
+        for ( uint16_t i=0; i < m_numCards; i++ )
+        {
+            m_cards[i]->delegateBlockTransfers( m_inputTransfers, m_outputTransfers );
+        }
+        m_inputTransfers.optimize();
+        m_outputTransfers.optimize();
+
         m_chassisMboxPtr = &chassisMbox;
         m_started        = true;
     }
@@ -113,6 +136,10 @@ void Scanner::stop( Cpl::Itc::PostApi& chassisMbox ) noexcept
             }
         }
 
+        // Stopping a card clears its delegated transfers
+        m_inputTransfers.clear();
+        m_outputTransfers.clear();
+
         m_chassisMboxPtr = nullptr;
         m_started        = false;
     }
@@ -191,6 +218,9 @@ bool Scanner::scanInputs( uint64_t currentElapsedTimeUsec ) noexcept
                 return false;
             }
         }
+
+        // Transfer the IO Registers to the Virtual Points
+        m_inputTransfers.execute();
     }
 
     return true;
@@ -201,6 +231,9 @@ bool Scanner::flushOutputs( uint64_t currentElapsedTimeUsec ) noexcept
     // Only execute if there is no error AND the Scanner was actually started
     if ( m_error == Fxt::Type::Error::SUCCESS() && m_started )
     {
+        // Transfer the Virtual Points to the IO Registers
+        m_outputTransfers.execute();
+
         // Flush all of the IO Cards
         for ( uint16_t i=0; i < m_numCards; i++ )
         {
@@ -322,3 +355,130 @@ ScannerApi* ScannerApi::createScannerfromJSON( JsonVariant
     return scanner;
 }
 
+//////////////////////////////////////////////////
+ScannerApi* ScannerApi::createScannerfromStream( Cpl::Json::PullParser&              parser,
+                                                 JsonDocument&                       elementDoc,
+                                                 Cpl::Memory::ContiguousAllocator&   generalAllocator,
+                                                 Cpl::Memory::ContiguousAllocator&   cardStatefulDataAllocator,
+                                                 Cpl::Memory::ContiguousAllocator&   haStatefulDataAllocator,
+                                                 Fxt::Card::FactoryDatabaseApi&      cardFactoryDb,
+                                                 Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
+                                                 Fxt::Point::DatabaseApi&            dbForPoints,
+                                                 Fxt::Type::Error&                   scannerErrorode ) noexcept
+{
+    // The cards are created BEFORE the Scanner (the number of cards is not known until the end of the "cards" array)
+    Cpl::Container::SList<Fxt::Card::Api> cards;
+    size_t                                numCards   = 0;
+    bool                                  foundCards = false;
+    uint64_t                              srm        = (uint64_t) (-1);
+    char                                  key[OPTION_FXT_CHASSIS_STREAM_MAX_KEY_LEN];
+
+    scannerErrorode = Fxt::Type::Error::SUCCESS();
+    parser.beginObject();
+    while ( scannerErrorode == Fxt::Type::Error::SUCCESS() && parser.nextKey( key, sizeof( key ) ) )
+    {
+        if ( strcmp( key, "cards" ) == 0 )
+        {
+            foundCards = true;
+            parser.beginArray();
+            while ( parser.nextElement() )
+            {
+                if ( !readStreamElement_( parser, elementDoc, scannerErrorode ) )
+                {
+                    break;
+                }
+
+                Fxt::Type::Error    errorCode = Fxt::Type::Error::SUCCESS();
+                JsonObject          cardJson  = elementDoc.as<JsonObject>();
+                Fxt::Card::Api*     card      = cardFactoryDb.createCardfromJSON( cardJson,
+                                                                                  generalAllocator,
+                                                                                  cardStatefulDataAllocator,
+                                                                                  haStatefulDataAllocator,
+                                                                                  pointFactoryDb,
+                                                                                  dbForPoints,
+                                                                                  errorCode );
+                if ( card == nullptr )
+                {
+                    scannerErrorode = fullErr( Err_T::FAILED_CREATE_CARD );
+                    scannerErrorode.logIt();
+                    break;
+                }
+                if ( errorCode != Fxt::Type::Error::SUCCESS() )
+                {
+                    scannerErrorode = fullErr( Err_T::CARD_CREATE_ERROR );
+                    scannerErrorode.logIt();
+                    card->~Api();
+                    break;
+                }
+                cards.put( *card );
+                numCards++;
+            }
+        }
+        else if ( strcmp( key, "scanRateMultiplier" ) == 0 )
+        {
+            parser.readUnsigned( srm );
+        }
+        else
+        {
+            parser.skipValue();
+        }
+    }
+
+    // Minimal syntax checking of the JSON input
+    if ( checkStream_( parser, scannerErrorode ) )
+    {
+        if ( !foundCards )
+        {
+            scannerErrorode = fullErr( Err_T::PARSE_CARDS_ARRAY );
+            scannerErrorode.logIt();
+        }
+        else if ( numCards == 0 )
+        {
+            scannerErrorode = fullErr( Err_T::NO_CARDS );
+            scannerErrorode.logIt();
+        }
+        else if ( srm == ((uint64_t) (-1)) )
+        {
+            scannerErrorode = fullErr( Err_T::SCANNER_MISSING_SRM );
+            scannerErrorode.logIt();
+        }
+    }
+
+    // Create Scanner instance
+    ScannerApi* scanner = nullptr;
+    if ( scannerErrorode == Fxt::Type::Error::SUCCESS() )
+    {
+        void* memScanner = generalAllocator.allocate( sizeof( Scanner ) );
+        if ( memScanner == nullptr )
+        {
+            scannerErrorode = fullErr( Err_T::NO_MEMORY_SCANNER );
+            scannerErrorode.logIt();
+        }
+        else
+        {
+            scanner = new(memScanner) Scanner( generalAllocator, (uint16_t) numCards, (size_t) srm );
+        }
+    }
+
+    // Transfer the IO Cards to the Scanner (or clean-up on failure)
+    Fxt::Card::Api* card;
+    while ( (card = cards.get()) )
+    {
+        if ( scanner && scannerErrorode == Fxt::Type::Error::SUCCESS() )
+        {
+            scannerErrorode = scanner->add( *card );
+            if ( scannerErrorode == Fxt::Type::Error::SUCCESS() )
+            {
+                continue;
+            }
+        }
+        card->~Api();
+    }
+    if ( scanner && scannerErrorode != Fxt::Type::Error::SUCCESS() )
+    {
+        scanner->~ScannerApi();
+        return nullptr;
+    }
+
+    return scanner;
+}
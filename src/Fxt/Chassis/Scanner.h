@@ -22,7 +22,13 @@ namespace Fxt {
 namespace Chassis {
 
 
-/** This concrete class implements the ScannerAPI interface
+/** This concrete class implements the ScannerAPI interface.
+
+    When the Scanner is started, the IO Register <--> Virtual Point copies
+    of all of its cards are collected into two 'block transfer plans' (one
+    for inputs, one for outputs).  Copies of adjacent card Banks are merged
+    into a single copy, i.e. the IO turnaround for the scanner is a minimal
+    set of memcpy() calls instead of two copies per card.
  */
 class Scanner : public ScannerApi
 {
@@ -130,6 +136,12 @@ protected:
     /// Output Period instance
     Outputs             m_outputPeriod;
 
+    /// Block copies for the IO Register -> Virtual Point input transfers
+    Fxt::Card::BlockTransferPlan    m_inputTransfers;
+
+    /// Block copies for the Virtual Point -> IO Register output transfers
+    Fxt::Card::BlockTransferPlan    m_outputTransfers;
+
     /// Array/List of IO Cards
     Fxt::Card::Api**    m_cards;
 
@@ -19,6 +19,7 @@
 #include "Fxt/Card/FactoryDatabaseApi.h"
 #include "Fxt/System/PeriodApi.h"
 #include "Cpl/Json/Arduino.h"
+#include "Cpl/Json/PullParser.h"
 #include "Cpl/Memory/ContiguousAllocator.h"
 
 ///
@@ -132,6 +133,22 @@ public:
                                               Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
                                               Fxt::Point::DatabaseApi&            dbForPoints,
                                               Fxt::Type::Error&                   scannerErrorode ) noexcept;
+
+    /** Same as createScannerfromJSON() - except the Scanner is parsed from
+        a JSON stream.  The 'parser' MUST be positioned at the Scanner's JSON
+        Object. Each IO Card is deserialized - one at a time - into
+        'elementDoc', i.e. the capacity of 'elementDoc' only needs to be large
+        enough for the largest individual IO card.
+     */
+    static ScannerApi* createScannerfromStream( Cpl::Json::PullParser&              parser,
+                                                JsonDocument&                       elementDoc,
+                                                Cpl::Memory::ContiguousAllocator&   generalAllocator,
+                                                Cpl::Memory::ContiguousAllocator&   cardStatefulDataAllocator,
+                                                Cpl::Memory::ContiguousAllocator&   haStatefulDataAllocator,
+                                                Fxt::Card::FactoryDatabaseApi&      cardFactoryDb,
+                                                Fxt::Point::FactoryDatabaseApi&     pointFactoryDb,
+                                                Fxt::Point::DatabaseApi&            dbForPoints,
+                                                Fxt::Type::Error&                   scannerErrorode ) noexcept;
 public:
     /// Virtual destructor
     virtual ~ScannerApi(){};
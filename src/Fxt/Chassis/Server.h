@@ -65,16 +65,22 @@ protected:
     void appRun()
     {
         TICKSOURCE::startMainLoop();
-        bool run = true;
+        bool          run         = true;
+        unsigned long numExecuted = 0;
         while ( run )
         {
             run = TICKSOURCE::waitAndProcessEvents();
             if ( run )
             {
-                uint64_t now = Fxt::System::ElapsedTime::now();
+                uint32_t passStart = Fxt::System::PerfCounter::now();
+                uint64_t now       = Fxt::System::ElapsedTime::now();
                 m_inputScheduler.executeScheduler( now );
                 m_executionScheduler.executeScheduler( now );
                 m_outputScheduler.executeScheduler( now );
+                updateStats( passStart,
+                             m_inputScheduler.getNumExecuted() + m_executionScheduler.getNumExecuted() + m_outputScheduler.getNumExecuted(),
+                             m_inputScheduler.getNumSlippages() + m_executionScheduler.getNumSlippages() + m_outputScheduler.getNumSlippages(),
+                             numExecuted );
             }
         }
         TICKSOURCE::stopMainLoop();
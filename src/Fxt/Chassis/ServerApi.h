@@ -15,6 +15,8 @@
 
 #include "Cpl/Itc/CloseSync.h"
 #include "Fxt/System/PeriodApi.h"
+#include "Fxt/System/PerfCounter.h"
+#include <atomic>
 
 ///
 namespace Fxt {
@@ -44,6 +46,10 @@ public:
     /// Constructor  
     ServerApi( Cpl::Itc::PostApi& myMbox ) 
         : Cpl::Itc::CloseSync( myMbox )
+        , m_numCycles( 0 )
+        , m_lastCycleTime( 0 )
+        , m_maxCycleTime( 0 )
+        , m_numSlippages( 0 )
     {
     }
 
@@ -53,6 +59,61 @@ public:
     {
         return m_mbox;
     }
+
+public:
+    /** The following methods return the Server's execution statistics.  The
+        statistics are updated (lock-free) by the Chassis thread and can be 
+        read from any thread.  A 'cycle' is a pass of the Chassis schedulers 
+        that executed at least one Period.  Times are in nanoseconds (see
+        Fxt::System::PerfCounter).  Note: The resolution is that of the
+        platform's PerfCounter implementation, i.e. the build must select a
+        high resolution implementation (e.g. src/Fxt/System/_posix) instead
+        of the millisecond src/Fxt/System/_cpl implementation.
+     */
+    unsigned long getNumCycles() const noexcept { return m_numCycles.load( std::memory_order_relaxed ); }
+
+    /// See getNumCycles()
+    unsigned long getLastCycleTime() const noexcept { return m_lastCycleTime.load( std::memory_order_relaxed ); }
+
+    /// See getNumCycles()
+    unsigned long getMaxCycleTime() const noexcept { return m_maxCycleTime.load( std::memory_order_relaxed ); }
+
+    /// Returns the total number of Periods that did not execute 'on time' (see Fxt::System::PeriodicScheduler)
+    unsigned long getNumSlippages() const noexcept { return m_numSlippages.load( std::memory_order_relaxed ); }
+
+protected:
+    /** Helper method that is called - by the Chassis thread - after each pass
+        of the schedulers.  'numExecuted' and 'numSlippages' are the running
+        totals of the Server's schedulers.
+     */
+    void updateStats( uint32_t passStartTime, unsigned long numExecuted, unsigned long numSlippages, unsigned long& prevNumExecuted ) noexcept
+    {
+        if ( numExecuted != prevNumExecuted )
+        {
+            prevNumExecuted       = numExecuted;
+            unsigned long elapsed = Fxt::System::PerfCounter::delta( passStartTime );
+            m_lastCycleTime.store( elapsed, std::memory_order_relaxed );
+            if ( elapsed > m_maxCycleTime.load( std::memory_order_relaxed ) )
+            {
+                m_maxCycleTime.store( elapsed, std::memory_order_relaxed );
+            }
+            m_numCycles.store( m_numCycles.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        }
+        m_numSlippages.store( numSlippages, std::memory_order_relaxed );
+    }
+
+protected:
+    /// Number of cycles
+    std::atomic<unsigned long>  m_numCycles;
+
+    /// Execution time of the most recent cycle
+    std::atomic<unsigned long>  m_lastCycleTime;
+
+    /// Worst case cycle execution time
+    std::atomic<unsigned long>  m_maxCycleTime;
+
+    /// Number of slippages
+    std::atomic<unsigned long>  m_numSlippages;
 };
 
 
@@ -0,0 +1,85 @@
+#ifndef Fxt_Chassis_Stream_h_
+#define Fxt_Chassis_Stream_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file
+
+    This file contains PRIVATE helpers for the Chassis createXxxfromStream()
+    methods.  The Application should NOT include/use this file.
+ */
+
+#include "Fxt/Chassis/Error.h"
+#include "Cpl/Json/PullParser.h"
+#include "Cpl/Container/Item.h"
+
+/// Maximum length, in bytes, of a JSON key name that is parsed when streaming
+#ifndef OPTION_FXT_CHASSIS_STREAM_MAX_KEY_LEN
+#define OPTION_FXT_CHASSIS_STREAM_MAX_KEY_LEN   32
+#endif
+
+///
+namespace Fxt {
+///
+namespace Chassis {
+
+
+/** Deserializes the next element from the stream. Returns false (and
+    updates 'errorCode') on error
+ */
+inline bool readStreamElement_( Cpl::Json::PullParser& parser, JsonDocument& elementDoc, Fxt::Type::Error& errorCode ) noexcept
+{
+    DeserializationError err = parser.readValue( elementDoc );
+    if ( err == DeserializationError::Ok )
+    {
+        return true;
+    }
+
+    errorCode = fullErr( err == DeserializationError::NoMemory ? Err_T::STREAM_ELEMENT_TOO_LARGE : Err_T::STREAM_SYNTAX_ERROR );
+    errorCode.logIt();
+    return false;
+}
+
+/** Converts a parser failure to an error code. Returns false if there is
+    an error (i.e. 'errorCode' is not SUCCESS or the parser failed)
+ */
+inline bool checkStream_( Cpl::Json::PullParser& parser, Fxt::Type::Error& errorCode ) noexcept
+{
+    if ( errorCode != Fxt::Type::Error::SUCCESS() )
+    {
+        return false;
+    }
+    if ( parser.isError() )
+    {
+        errorCode = fullErr( Err_T::STREAM_SYNTAX_ERROR );
+        errorCode.logIt();
+        return false;
+    }
+    return true;
+}
+
+/** Transient wrapper used to hold a list of objects (that are NOT
+    Container Items) until their containing object is created.
+ */
+template <class T>
+class StreamLink_ : public Cpl::Container::Item
+{
+public:
+    /// Constructor
+    StreamLink_( T& item ) :m_item( item ) {}
+
+    /// The object being held
+    T& m_item;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
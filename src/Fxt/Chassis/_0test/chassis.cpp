@@ -23,8 +23,8 @@
 #include "Fxt/Card/FactoryDatabase.h"
 #include "Fxt/Card/Mock/AnalogIn8Factory.h"
 #include "Fxt/Card/Mock/Digital8Factory.h"
-#include "Fxt/Component/Digital/And16GateFactory.h"
-#include "Fxt/Component/Digital/ByteDemuxFactory.h"
+#include "Fxt/Component/Digital/And8GateFactory.h"
+#include "Fxt/Component/Digital/Demux8Uint8Factory.h"
 #include "Cpl/Memory/LeanHeap.h"
 #include "Cpl/System/Trace.h"
 #include "Cpl/System/Api.h"
@@ -128,12 +128,12 @@ using namespace Fxt::Chassis;
                                         "                \"channel\": 1, " \
                                         "                \"id\": 9, " \
                                         "                \"ioRegId\": 10, " \
-                                        "                \"type\": \"918cff9e-8007-4666-99ac-384b9624329c\", " \
-                                        "                \"typeName\": \"Fxt::Point::Uint8\", " \
+                                        "                \"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\", " \
+                                        "                \"typeName\": \"Fxt::Point::Bool\", " \
                                         "                \"name\": \"InputPt\", " \
                                         "                \"initial\": { " \
                                         "                  \"valid\": true, " \
-                                        "                  \"val\": 128, " \
+                                        "                  \"val\": true, " \
                                         "                  \"id\": 11 " \
                                         "                } " \
                                         "              } " \
@@ -143,12 +143,12 @@ using namespace Fxt::Chassis;
                                         "                \"channel\": 1, " \
                                         "                \"id\": 12, " \
                                         "                \"ioRegId\": 13, " \
-                                        "                \"type\": \"918cff9e-8007-4666-99ac-384b9624329c\", " \
-                                        "                \"typeName\": \"Fxt::Point::Uint8\", " \
+                                        "                \"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\", " \
+                                        "                \"typeName\": \"Fxt::Point::Bool\", " \
                                         "                \"name\": \"OutputPt\", " \
                                         "                \"initial\": { " \
                                         "                  \"valid\": true, " \
-                                        "                  \"val\": 1, " \
+                                        "                  \"val\": true, " \
                                         "                  \"id\": 14 " \
                                         "                } " \
                                         "              } " \
@@ -172,13 +172,13 @@ using namespace Fxt::Chassis;
                                         "              \"id\": 100, " \
                                         "              \"name\": \"ByteDemux #1\", " \
                                         "              \"type\": \"8c55aa52-3bc8-4b8a-ad73-c434a0bbd4b4\", " \
-                                        "              \"typeName\": \"Fxt::Component::Digital::ByteDemux\", " \
+                                        "              \"typeName\": \"Fxt::Component::Digital::Demux8Uint8\", " \
                                         "              \"inputs\": [ " \
                                         "                { " \
                                         "                  \"name\": \"input byte\", " \
                                         "                  \"type\": \"918cff9e-8007-4666-99ac-384b9624329c\", " \
                                         "                  \"typeName\": \"Fxt::Point::Uint8\", " \
-                                        "                  \"idRef\": 9 " \
+                                        "                  \"idRef\": 24 " \
                                         "                } " \
                                         "              ], " \
                                         "              \"outputs\": [ " \
@@ -195,7 +195,7 @@ using namespace Fxt::Chassis;
                                         "              \"id\": 101, " \
                                         "              \"name\": \"AND Gate#1\", " \
                                         "              \"type\": \"e62e395c-d27a-4821-bba9-aa1e6de42a05\", " \
-                                        "              \"typeName\": \"Fxt::Component::Digital::And16Gate\", " \
+                                        "              \"typeName\": \"Fxt::Component::Digital::And8Gate\", " \
                                         "              \"inputs\": [ " \
                                         "                { " \
                                         "                  \"name\": \"Signal#1\", " \
@@ -244,6 +244,16 @@ using namespace Fxt::Chassis;
                                         "                \"val\": true, " \
                                         "                \"id\": 22" \
                                         "              } " \
+                                        "            }, " \
+                                        "            { " \
+                                        "              \"id\": 24, " \
+                                        "              \"name\": \"Auto-byte\", " \
+                                        "              \"type\": \"918cff9e-8007-4666-99ac-384b9624329c\", " \
+                                        "              \"typeName\": \"Fxt::Point::Uint8\", " \
+                                        "              \"initial\": { " \
+                                        "                \"val\": 128, " \
+                                        "                \"id\": 25" \
+                                        "              } " \
                                         "            } " \
                                         "          ] " \
                                         "        } " \
@@ -268,8 +278,8 @@ TEST_CASE( "Chassis" )
     Cpl::Memory::LeanHeap                               cardStatefulAllocator( cardStateFullHeap_, sizeof( cardStateFullHeap_ ) );
     Cpl::Memory::LeanHeap                               haStatefulAllocator( haStateFullHeap_, sizeof( haStateFullHeap_ ) );
     Fxt::Component::FactoryDatabase                     componentFactoryDb;
-    Fxt::Component::Digital::ByteDemuxFactory        byteSplitterFactory( componentFactoryDb );
-    Fxt::Component::Digital::And16GateFactory           and16GateFactory( componentFactoryDb );
+    Fxt::Component::Digital::Demux8Uint8Factory         byteSplitterFactory( componentFactoryDb );
+    Fxt::Component::Digital::And8GateFactory            and8GateFactory( componentFactoryDb );
     Fxt::Point::Database<MAX_POINTS>                    pointDb;
     Fxt::Point::FactoryDatabase                         pointFactoryDb;
     Fxt::Type::Error                                    chassisError;
@@ -386,12 +396,12 @@ TEST_CASE( "Chassis" )
         REQUIRE( floatPointPtr->isNotValid() );
 
         // Digital: Verify Points are invalid
-        Fxt::Point::Uint8* uint8PointPtr = (Fxt::Point::Uint8*) pointDb.lookupById( 9 );    
-        REQUIRE( uint8PointPtr );
-        REQUIRE( uint8PointPtr->isNotValid() );
-        uint8PointPtr = (Fxt::Point::Uint8*) pointDb.lookupById( 12 );                      
-        REQUIRE( uint8PointPtr );
-        REQUIRE( uint8PointPtr->isNotValid() );
+        Fxt::Point::Bool* digitalPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( 9 );
+        REQUIRE( digitalPointPtr );
+        REQUIRE( digitalPointPtr->isNotValid() );
+        digitalPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( 12 );
+        REQUIRE( digitalPointPtr );
+        REQUIRE( digitalPointPtr->isNotValid() );
 
         // Shared Points: Verify Points are valid
         bool boolPointVal = false;
@@ -444,13 +454,14 @@ TEST_CASE( "Chassis" )
         REQUIRE( Cpl::Math::areFloatsEqual( floatPointVal, 0.0F ) );
      
         // Digital: Verify Point values
-        uint8_t uint8PointVal = 0;
-        uint8PointPtr = (Fxt::Point::Uint8*) pointDb.lookupById( 9 );
-        REQUIRE( uint8PointPtr );
-        REQUIRE( uint8PointPtr->read( uint8PointVal ) );
-        REQUIRE( uint8PointVal == 128 );
-        uint8PointPtr = (Fxt::Point::Uint8*) pointDb.lookupById( 12 );
-        REQUIRE( uint8PointPtr->isNotValid() );  // Nothing drives this output
+        bool digitalPointVal = false;
+        digitalPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( 9 );
+        REQUIRE( digitalPointPtr );
+        REQUIRE( digitalPointPtr->read( digitalPointVal ) );
+        REQUIRE( digitalPointVal == true );
+        digitalPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( 12 );
+        REQUIRE( digitalPointPtr->read( digitalPointVal ) );  // Nothing drives this output, i.e. it retains its initial value
+        REQUIRE( digitalPointVal == true );
 
         // Shared Points: Verify Point values
         boolPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( 15 );
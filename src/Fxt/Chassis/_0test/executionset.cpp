@@ -17,8 +17,8 @@
 #include "Fxt/Point/Uint8.h"
 #include "Fxt/Point/Bool.h"
 #include "Fxt/Point/Factory.h"
-#include "Fxt/Component/Digital/And16GateFactory.h"
-#include "Fxt/Component/Digital/ByteDemuxFactory.h"
+#include "Fxt/Component/Digital/And8GateFactory.h"
+#include "Fxt/Component/Digital/Demux8Uint8Factory.h"
 #include "Fxt/Component/FactoryDatabase.h"
 #include "Cpl/Memory/LeanHeap.h"
 #include "Cpl/System/Trace.h"
@@ -44,7 +44,7 @@ using namespace Fxt::Chassis;
                             "     \"id\": 100," \
                             "     \"name\": \"ByteDemux #1\"," \
                             "     \"type\": \"8c55aa52-3bc8-4b8a-ad73-c434a0bbd4b4\"," \
-                            "     \"typeName\": \"Fxt::Component::Digital::ByteDemux\"," \
+                            "     \"typeName\": \"Fxt::Component::Digital::Demux8Uint8\"," \
                             "     \"inputs\": [" \
                             "         {" \
                             "             \"name\": \"input byte\"," \
@@ -67,7 +67,7 @@ using namespace Fxt::Chassis;
                             "     \"id\": 101," \
                             "     \"name\": \"AND Gate#1\"," \
                             "     \"type\": \"e62e395c-d27a-4821-bba9-aa1e6de42a05\"," \
-                            "     \"typeName\": \"Fxt::Component::Digital::And16Gate\"," \
+                            "     \"typeName\": \"Fxt::Component::Digital::And8Gate\"," \
                             "     \"inputs\": [" \
                             "         {" \
                             "             \"name\": \"Signal#1\"," \
@@ -144,8 +144,8 @@ TEST_CASE( "LogicChain" )
     Fxt::Point::Database<MAX_POINTS>                    pointDb;
     Fxt::Component::FactoryDatabase                     componentFactoryDb;
     Fxt::Point::FactoryDatabase                         pointFactoryDb;
-    Fxt::Component::Digital::ByteDemuxFactory        byteSplitterFactory( componentFactoryDb );
-    Fxt::Component::Digital::And16GateFactory           and16GateFactory( componentFactoryDb );
+    Fxt::Component::Digital::Demux8Uint8Factory         byteSplitterFactory( componentFactoryDb );
+    Fxt::Component::Digital::And8GateFactory            and8GateFactory( componentFactoryDb );
     Fxt::Type::Error                                    executionSetError;
     Fxt::Point::Factory<Fxt::Point::Uint8>              factoryUint8( pointFactoryDb );
     Fxt::Point::Factory<Fxt::Point::Bool>               factoryBool( pointFactoryDb );
@@ -0,0 +1,344 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/System/Tick1MsecBlocking.h"
+#include "Fxt/Chassis/Chassis.h"
+#include "Fxt/Chassis/HotSwap.h"
+#include "Fxt/Chassis/Error.h"
+#include "Fxt/Chassis/Server.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/OverlayDatabase.h"
+#include "Fxt/Component/FactoryDatabase.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Bool.h"
+#include "Fxt/Point/Uint8.h"
+#include "Fxt/Point/Factory.h"
+#include "Fxt/Card/FactoryDatabase.h"
+#include "Fxt/Card/Mock/Digital8Factory.h"
+#include "Fxt/Component/Digital/Not64GateFactory.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/System/Trace.h"
+#include "Cpl/System/Api.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+/// 
+using namespace Fxt::Chassis;
+
+#define BOOL_TYPE   "\"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\""
+#define UINT8_TYPE  "\"918cff9e-8007-4666-99ac-384b9624329c\""
+
+#define SCANNER(initialVal, extraInput, slot2) \
+    "{ \"name\": \"My Scanner\", \"id\": 1, \"scanRateMultiplier\": 1, \"cards\": [ " \
+    "  { \"name\": \"dio\", \"type\": \"59d33888-62c7-45b2-a4d4-9dbc55914ed3\", \"slot\": 0, \"points\": { " \
+    "    \"inputs\": [ " \
+    "      { \"channel\": 1, \"id\": 1, \"ioRegId\": 2, \"type\": " BOOL_TYPE ", \"initial\": { \"valid\": true, \"val\": " initialVal ", \"id\": 3 } } " \
+    extraInput \
+    "    ] } } " \
+    slot2 \
+    "] }"
+
+#define EXTRA_INPUT ", { \"channel\": 2, \"id\": 8, \"ioRegId\": 9, \"type\": " BOOL_TYPE " } "
+#define DUP_SLOT    ", { \"name\": \"dio2\", \"type\": \"59d33888-62c7-45b2-a4d4-9dbc55914ed3\", \"slot\": 0, \"points\": { \"inputs\": [ " \
+                    "      { \"channel\": 1, \"id\": 10, \"ioRegId\": 11, \"type\": " BOOL_TYPE " } ] } } "
+
+#define EXESET(negate, outType) \
+    "{ \"name\": \"My Execution Set\", \"id\": 1, \"exeRateMultiplier\": 1, \"logicChains\": [ " \
+    "  { \"name\": \"chain\", \"id\": 1, \"components\": [ " \
+    "    { \"name\": \"not\", \"type\": \"31d8a613-bc99-4d0d-a96f-4b4dc9b0cc6f\", " \
+    "      \"inputs\":  [ { \"name\": \"in\",  \"type\": " BOOL_TYPE ", \"idRef\": 7 } ], " \
+    "      \"outputs\": [ { \"name\": \"out\", \"type\": " BOOL_TYPE ", \"idRef\": 6, \"negate\": " negate " } ] } ], " \
+    "    \"connectionPts\": [ " \
+    "      { \"id\": 6, \"name\": \"out\", \"type\": " outType " }, " \
+    "      { \"id\": 7, \"name\": \"in\",  \"type\": " BOOL_TYPE ", \"aliasOf\": 1 } ] " \
+    "  } ] }"
+
+#define CHASSIS_DEFINITION  "{ \"name\": \"My Chassis\", \"id\": 1, \"fer\": 1000, " \
+                            "  \"scanners\": [ " SCANNER( "true", "", "" ) " ], " \
+                            "  \"executionSets\": [ " EXESET( "false", BOOL_TYPE ) " ] }"
+
+static size_t generalHeap_[10000];
+static size_t cardStatefulHeap_[1000];
+static size_t haStatefulHeap_[1000];
+static size_t shadowGeneralHeap_[10000];
+static size_t shadowCardStatefulHeap_[1000];
+static size_t shadowHaStatefulHeap_[1000];
+
+#define MAX_POINTS      100
+
+static bool readBool( Fxt::Point::DatabaseApi& db, uint32_t id, bool& val )
+{
+    Fxt::Point::Bool* pt = (Fxt::Point::Bool*) db.lookupById( id );
+    return pt && pt->read( val );
+}
+
+static bool waitForBool( Fxt::Point::DatabaseApi& db, uint32_t id, bool expected )
+{
+    for ( int i=0; i < 100; i++ )
+    {
+        bool val;
+        if ( readBool( db, id, val ) && val == expected )
+        {
+            return true;
+        }
+        Cpl::System::Api::sleep( 10 );
+    }
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "HotSwap" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap                               generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap                               cardStatefulAllocator( cardStatefulHeap_, sizeof( cardStatefulHeap_ ) );
+    Cpl::Memory::LeanHeap                               haStatefulAllocator( haStatefulHeap_, sizeof( haStatefulHeap_ ) );
+    Cpl::Memory::LeanHeap                               shadowGeneralAllocator( shadowGeneralHeap_, sizeof( shadowGeneralHeap_ ) );
+    Cpl::Memory::LeanHeap                               shadowCardStatefulAllocator( shadowCardStatefulHeap_, sizeof( shadowCardStatefulHeap_ ) );
+    Cpl::Memory::LeanHeap                               shadowHaStatefulAllocator( shadowHaStatefulHeap_, sizeof( shadowHaStatefulHeap_ ) );
+    Fxt::Component::FactoryDatabase                     componentFactoryDb;
+    Fxt::Component::Digital::Not64GateFactory          notGateFactory( componentFactoryDb );
+    Fxt::Point::Database<MAX_POINTS>                    pointDb;
+    Fxt::Point::Database<MAX_POINTS>                    stagingDb;
+    Fxt::Point::FactoryDatabase                         pointFactoryDb;
+    Fxt::Point::Factory<Fxt::Point::Bool>               factoryBool( pointFactoryDb );
+    Fxt::Point::Factory<Fxt::Point::Uint8>              factoryUint8( pointFactoryDb );
+    Fxt::Card::FactoryDatabase                          cardFactoryDb;
+    Fxt::Card::Mock::Digital8Factory                    factoryCardDigital8( cardFactoryDb );
+    Fxt::Type::Error                                    chassisError;
+    Server<Fxt::System::Tick1MsecBlocking>              chassisServer( 1000LL );
+
+    StaticJsonDocument<4096> doc;
+    REQUIRE( deserializeJson( doc, CHASSIS_DEFINITION ) == DeserializationError::Ok );
+    Api* uut = Api::createChassisfromJSON( doc.as<JsonVariant>(),
+                                           chassisServer,
+                                           componentFactoryDb,
+                                           cardFactoryDb,
+                                           generalAllocator,
+                                           cardStatefulAllocator,
+                                           haStatefulAllocator,
+                                           pointFactoryDb,
+                                           pointDb,
+                                           chassisError );
+    REQUIRE( uut );
+    REQUIRE( uut->resolveReferences( pointDb ) == Fxt::Type::Error::SUCCESS() );
+
+    HotSwap hotSwap( *uut,
+                     componentFactoryDb,
+                     cardFactoryDb,
+                     pointFactoryDb,
+                     pointDb,
+                     stagingDb,
+                     shadowGeneralAllocator,
+                     shadowCardStatefulAllocator,
+                     shadowHaStatefulAllocator );
+
+    SECTION( "overlay" )
+    {
+        Fxt::Point::OverlayDatabase overlay( stagingDb, pointDb );
+        Fxt::Point::Api*            existing = pointDb.lookupById( 1 );
+        REQUIRE( overlay.lookupById( 1 ) == existing );
+        Fxt::Point::Bool* staged = new(shadowGeneralAllocator.allocate( sizeof( Fxt::Point::Bool ) )) Fxt::Point::Bool( overlay, 1, shadowCardStatefulAllocator );
+        REQUIRE( stagingDb.lookupById( 1 ) == staged );
+        REQUIRE( overlay.lookupById( 1 ) == staged );
+        REQUIRE( overlay.lookupById( 6 ) == pointDb.lookupById( 6 ) );
+        REQUIRE( overlay.add( *staged ) == false );
+        stagingDb.cleanupPointsAfterNodeCreateFailure();
+        REQUIRE( overlay.lookupById( 1 ) == existing );
+    }
+
+    SECTION( "stopped chassis" )
+    {
+        Fxt::Point::Api* oldPt1 = pointDb.lookupById( 1 );
+        REQUIRE( pointDb.lookupById( 8 ) == nullptr );
+
+        StaticJsonDocument<2048> scannerDoc;
+        REQUIRE( deserializeJson( scannerDoc, SCANNER( "false", EXTRA_INPUT, "" ) ) == DeserializationError::Ok );
+        ScannerApi* oldScanner = uut->getScanner( 0 );
+        REQUIRE( hotSwap.replaceScanner( 0, scannerDoc.as<JsonVariant>(), Fxt::System::ElapsedTime::now() ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut->getScanner( 0 ) != oldScanner );
+        REQUIRE( hotSwap.getNumRetired() == 1 );
+
+        // Existing point references are redirected, new points are added
+        REQUIRE( pointDb.lookupById( 1 ) == oldPt1 );
+        REQUIRE( oldPt1->isAlias() );
+        REQUIRE( pointDb.lookupById( 8 ) != nullptr );
+        REQUIRE( pointDb.lookupById( 7 )->getStartOfStatefulMemory_() == oldPt1->getStartOfStatefulMemory_() );
+        REQUIRE( stagingDb.lookupById( 1 ) == nullptr );
+        Fxt::Card::Mock::Digital8* card = (Fxt::Card::Mock::Digital8*) Api::getCard( *uut, 0 );
+        REQUIRE( card );
+
+        // Errors
+        REQUIRE( hotSwap.replaceScanner( 1, scannerDoc.as<JsonVariant>(), 0 ) == fullErr( Err_T::HOTSWAP_INVALID_INDEX ) );
+        REQUIRE( deserializeJson( scannerDoc, SCANNER( "false", "", DUP_SLOT ) ) == DeserializationError::Ok );
+        REQUIRE( hotSwap.replaceScanner( 0, scannerDoc.as<JsonVariant>(), 0 ) == fullErr( Err_T::DUPLICATE_SLOT_ASSIGNMENTS ) );
+        StaticJsonDocument<2048> exeDoc;
+        REQUIRE( deserializeJson( exeDoc, EXESET( "false", UINT8_TYPE ) ) == DeserializationError::Ok );
+        REQUIRE( hotSwap.replaceExecutionSet( 0, exeDoc.as<JsonVariant>(), 0 ) != Fxt::Type::Error::SUCCESS() );
+        REQUIRE( stagingDb.lookupById( 6 ) == nullptr );
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( hotSwap.getNumRetired() == 0 );    // The stopped Scanner was destroyed on the next replace
+    }
+
+    SECTION( "incompatible point" )
+    {
+        // Replace the chain's output with a different point type that is NOT referenced by a component
+        StaticJsonDocument<2048> exeDoc;
+        REQUIRE( deserializeJson( exeDoc, EXESET( "false", BOOL_TYPE ) ) == DeserializationError::Ok );
+        exeDoc["logicChains"][0]["connectionPts"][0]["id"] = 30;
+        exeDoc["logicChains"][0]["components"][0]["outputs"][0]["idRef"] = 30;
+        JsonObject extra = exeDoc["logicChains"][0]["connectionPts"].createNestedObject();
+        extra["id"]   = 8;
+        extra["type"] = "918cff9e-8007-4666-99ac-384b9624329c";
+        REQUIRE( hotSwap.replaceExecutionSet( 0, exeDoc.as<JsonVariant>(), 0 ) == Fxt::Type::Error::SUCCESS() );
+
+        StaticJsonDocument<2048> scannerDoc;
+        REQUIRE( deserializeJson( scannerDoc, SCANNER( "false", EXTRA_INPUT, "" ) ) == DeserializationError::Ok );
+        REQUIRE( hotSwap.replaceScanner( 0, scannerDoc.as<JsonVariant>(), 0 ) == fullErr( Err_T::HOTSWAP_INCOMPATIBLE_POINT ) );
+        REQUIRE( stagingDb.lookupById( 1 ) == nullptr );
+    }
+
+    SECTION( "running chassis" )
+    {
+        Cpl::System::Thread* t1  = Cpl::System::Thread::create( chassisServer, "Chassis" );
+        for ( uint8_t i=0; i < 100; i++ )
+        {
+            Cpl::System::Api::sleep( 10 );
+            if ( chassisServer.isRunning() )
+            {
+                break;
+            }
+        }
+        REQUIRE( chassisServer.isRunning() );
+
+        // Output := !input
+        REQUIRE( uut->start( Fxt::System::ElapsedTime::now() ) );
+        REQUIRE( waitForBool( pointDb, 6, false ) );
+
+        // Replace the card (new initial value for the input)
+        StaticJsonDocument<2048> scannerDoc;
+        REQUIRE( deserializeJson( scannerDoc, SCANNER( "false", EXTRA_INPUT, "" ) ) == DeserializationError::Ok );
+        REQUIRE( hotSwap.replaceScanner( 0, scannerDoc.as<JsonVariant>(), Fxt::System::ElapsedTime::now() ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut->isStarted() );
+        REQUIRE( waitForBool( pointDb, 6, true ) );
+        Fxt::Card::Mock::Digital8* card = (Fxt::Card::Mock::Digital8*) Api::getCard( *uut, 0 );
+        REQUIRE( card );
+        card->setInputBit( 0 );
+        REQUIRE( waitForBool( pointDb, 6, false ) );
+
+        // Replace the logic chain: Output := input
+        StaticJsonDocument<2048> exeDoc;
+        REQUIRE( deserializeJson( exeDoc, EXESET( "true", BOOL_TYPE ) ) == DeserializationError::Ok );
+        REQUIRE( hotSwap.replaceExecutionSet( 0, exeDoc.as<JsonVariant>(), Fxt::System::ElapsedTime::now() ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( waitForBool( pointDb, 6, true ) );
+        card->clearInputBit( 0 );
+        REQUIRE( waitForBool( pointDb, 6, false ) );
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        uut->stop();
+        hotSwap.reclaimRetired();
+        REQUIRE( hotSwap.getNumRetired() == 0 );
+        chassisServer.pleaseStop();
+        Cpl::System::Api::sleep( 300 ); // allow time for threads to stop
+        REQUIRE( t1->isRunning() == false );
+        Cpl::System::Thread::destroy( *t1 );
+    }
+
+    SECTION( "aliased by another chassis" )
+    {
+        // Second Chassis: its logic chain aliases Point 1 (owned by the first Chassis)
+        StaticJsonDocument<4096> doc2;
+        REQUIRE( deserializeJson( doc2, CHASSIS_DEFINITION ) == DeserializationError::Ok );
+        JsonObject input = doc2["scanners"][0]["cards"][0]["points"]["inputs"][0];
+        input["id"]            = 20;
+        input["ioRegId"]       = 21;
+        input["initial"]["id"] = 22;
+        JsonObject chain = doc2["executionSets"][0]["logicChains"][0];
+        chain["connectionPts"][0]["id"]                = 26;
+        chain["connectionPts"][1]["id"]                = 27;
+        chain["components"][0]["outputs"][0]["idRef"]  = 26;
+        chain["components"][0]["inputs"][0]["idRef"]   = 27;
+        Server<Fxt::System::Tick1MsecBlocking> chassisServer2( 1000LL );
+        Api* uut2 = Api::createChassisfromJSON( doc2.as<JsonVariant>(),
+                                                chassisServer2,
+                                                componentFactoryDb,
+                                                cardFactoryDb,
+                                                generalAllocator,
+                                                cardStatefulAllocator,
+                                                haStatefulAllocator,
+                                                pointFactoryDb,
+                                                pointDb,
+                                                chassisError );
+        REQUIRE( uut2 );
+        REQUIRE( uut2->resolveReferences( pointDb ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( pointDb.lookupById( 27 )->getStartOfStatefulMemory_() == pointDb.lookupById( 1 )->getStartOfStatefulMemory_() );
+
+        Cpl::System::Thread* t1 = Cpl::System::Thread::create( chassisServer, "Chassis" );
+        Cpl::System::Thread* t2 = Cpl::System::Thread::create( chassisServer2, "Chassis2" );
+        for ( uint8_t i=0; i < 100; i++ )
+        {
+            Cpl::System::Api::sleep( 10 );
+            if ( chassisServer.isRunning() && chassisServer2.isRunning() )
+            {
+                break;
+            }
+        }
+        REQUIRE( chassisServer.isRunning() );
+        REQUIRE( chassisServer2.isRunning() );
+        REQUIRE( uut->start( Fxt::System::ElapsedTime::now() ) );
+        REQUIRE( uut2->start( Fxt::System::ElapsedTime::now() ) );
+        REQUIRE( waitForBool( pointDb, 26, false ) );
+
+        // Replacing Point 1 would redirect a Point of the (running) second Chassis -->rejected
+        Fxt::Point::Api*         oldPt1     = pointDb.lookupById( 1 );
+        ScannerApi*              oldScanner = uut->getScanner( 0 );
+        StaticJsonDocument<2048> scannerDoc;
+        REQUIRE( deserializeJson( scannerDoc, SCANNER( "false", "", "" ) ) == DeserializationError::Ok );
+        REQUIRE( hotSwap.replaceScanner( 0, scannerDoc.as<JsonVariant>(), Fxt::System::ElapsedTime::now() ) == fullErr( Err_T::HOTSWAP_FOREIGN_POINT ) );
+        REQUIRE( uut->getScanner( 0 ) == oldScanner );
+        REQUIRE( oldPt1->isAlias() == false );
+        REQUIRE( pointDb.lookupById( 27 )->getStartOfStatefulMemory_() == oldPt1->getStartOfStatefulMemory_() );
+        REQUIRE( stagingDb.lookupById( 1 ) == nullptr );
+        REQUIRE( uut->isStarted() );
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        // Both Chassis continue to run
+        Fxt::Card::Mock::Digital8* card = (Fxt::Card::Mock::Digital8*) Api::getCard( *uut, 0 );
+        REQUIRE( card );
+        card->clearInputBit( 0 );
+        REQUIRE( waitForBool( pointDb, 6, true ) );
+        REQUIRE( waitForBool( pointDb, 26, true ) );
+
+        // Replacing a Point that is NOT aliased outside of the Chassis is allowed
+        StaticJsonDocument<2048> exeDoc;
+        REQUIRE( deserializeJson( exeDoc, EXESET( "true", BOOL_TYPE ) ) == DeserializationError::Ok );
+        REQUIRE( hotSwap.replaceExecutionSet( 0, exeDoc.as<JsonVariant>(), Fxt::System::ElapsedTime::now() ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( waitForBool( pointDb, 6, false ) );
+
+        uut->stop();
+        uut2->stop();
+        hotSwap.reclaimRetired();
+        chassisServer.pleaseStop();
+        chassisServer2.pleaseStop();
+        Cpl::System::Api::sleep( 300 ); // allow time for threads to stop
+        REQUIRE( t1->isRunning() == false );
+        REQUIRE( t2->isRunning() == false );
+        Cpl::System::Thread::destroy( *t1 );
+        Cpl::System::Thread::destroy( *t2 );
+        uut2->~Api();
+    }
+
+    uut->~Api();
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -15,6 +15,7 @@
 #include "Fxt/Point/Database.h"
 #include "Fxt/Point/FactoryDatabase.h"
 #include "Fxt/Point/Uint8.h"
+#include "Fxt/Point/Bool.h"
 #include "Fxt/Point/Float.h"
 #include "Fxt/Point/Factory.h"
 #include "Fxt/Card/FactoryDatabase.h"
@@ -23,6 +24,7 @@
 #include "Cpl/Memory/LeanHeap.h"
 #include "Cpl/System/Trace.h"
 #include "Cpl/Math/real.h"
+#include "Cpl/Dm/MailboxServer.h"
 #include <string.h>
 
 #define SECT_   "_0test"
@@ -95,12 +97,12 @@ using namespace Fxt::Chassis;
                            "               \"channel\": 1," \
                            "                \"id\": 9," \
                            "                \"ioRegId\": 10," \
-                           "                \"type\": \"918cff9e-8007-4666-99ac-384b9624329c\"," \
-                           "                \"typeName\": \"Fxt::Point::Uint8\"," \
+                           "                \"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\"," \
+                           "                \"typeName\": \"Fxt::Point::Bool\"," \
                            "                \"name\": \"InputPt\"," \
                            "                \"initial\": {" \
                            "                  \"valid\": true," \
-                           "                  \"val\": 128," \
+                           "                  \"val\": true," \
                            "                  \"id\": 11" \
                            "                }" \
                            "           }" \
@@ -110,12 +112,12 @@ using namespace Fxt::Chassis;
                            "              \"channel\": 1," \
                            "              \"id\": 12," \
                            "              \"ioRegId\": 13," \
-                           "              \"type\": \"918cff9e-8007-4666-99ac-384b9624329c\"," \
-                           "              \"typeName\": \"Fxt::Point::Uint8\"," \
+                           "              \"type\": \"f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0\"," \
+                           "              \"typeName\": \"Fxt::Point::Bool\"," \
                            "              \"name\": \"OutputPt\"," \
                            "              \"initial\": {" \
                            "                 \"valid\": true," \
-                           "                 \"val\": 1," \
+                           "                 \"val\": true," \
                            "                 \"id\": 14" \
                            "              }" \
                            "           }" \
@@ -144,10 +146,12 @@ TEST_CASE( "Scanner" )
     Fxt::Type::Error                                    scannerError;
     Fxt::Point::Factory<Fxt::Point::Uint8>              factoryUint8( pointFactoryDb );
     Fxt::Point::Factory<Fxt::Point::Float>              factoryFloat( pointFactoryDb );
+    Fxt::Point::Factory<Fxt::Point::Bool>               factoryBool( pointFactoryDb );
     Fxt::Card::FactoryDatabase                          cardFactoryDb;
     Fxt::Card::Mock::AnalogIn8Factory                   factoryCardAnalogIn8( cardFactoryDb );
     Fxt::Card::Mock::Digital8Factory                    factoryCardDigital8( cardFactoryDb );
     Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN>  buf;
+    Cpl::Dm::MailboxServer                              chassisMbox;
 
 
 
@@ -203,7 +207,7 @@ TEST_CASE( "Scanner" )
         REQUIRE( uut->getScanRateMultiplier() == 2 );
 
         
-        bool result  = uut->start( 00L );
+        bool result  = uut->start( chassisMbox, 00L );
         scannerError = uut->getErrorCode();
         CPL_SYSTEM_TRACE_MSG( SECT_, ("result=%d, scanner error=%s", result, scannerError.toText( buf )) );
         REQUIRE( result );
@@ -227,15 +231,15 @@ TEST_CASE( "Scanner" )
         REQUIRE( Cpl::Math::areFloatsEqual( pointVal, 0.0F ) );
 
         // Digital card
-        Fxt::Point::Uint8* pointPtr2 = (Fxt::Point::Uint8*) pointDb.lookupById( 10 );
-        uint8_t pointVal2 = 0;
+        Fxt::Point::Bool* pointPtr2 = (Fxt::Point::Bool*) pointDb.lookupById( 10 );
+        bool pointVal2 = false;
         REQUIRE( pointPtr2->read( pointVal2 ) );
-        REQUIRE( pointVal2 == 128 );
+        REQUIRE( pointVal2 == true );
 
-        pointPtr2 = (Fxt::Point::Uint8*) pointDb.lookupById( 13 );
-        pointVal2 = 0;
+        pointPtr2 = (Fxt::Point::Bool*) pointDb.lookupById( 13 );
+        pointVal2 = false;
         REQUIRE( pointPtr2->read( pointVal2 ) );
-        REQUIRE( pointVal2 == 1 );
+        REQUIRE( pointVal2 == true );
 
         
         result = uut->getInputPeriod().execute( 0LL, 0LL );
@@ -259,24 +263,24 @@ TEST_CASE( "Scanner" )
         REQUIRE( Cpl::Math::areFloatsEqual( pointVal, 0.0F ) );
 
         // Digital card
-        pointPtr2 = (Fxt::Point::Uint8*) pointDb.lookupById( 9 );
+        pointPtr2 = (Fxt::Point::Bool*) pointDb.lookupById( 9 );
         REQUIRE( pointPtr2->read( pointVal2 ) );
-        REQUIRE( pointVal2 == 128 );
-        pointPtr2 = (Fxt::Point::Uint8*) pointDb.lookupById( 12 );
-        pointPtr2->write( 32 );
+        REQUIRE( pointVal2 == true );
+        pointPtr2 = (Fxt::Point::Bool*) pointDb.lookupById( 12 );
+        pointPtr2->write( false );
 
 
         result = uut->getOutputPeriod().execute( 0LL, 0LL );
 
 
         // Digital Card
-        pointPtr2 = (Fxt::Point::Uint8*) pointDb.lookupById( 13 );
+        pointPtr2 = (Fxt::Point::Bool*) pointDb.lookupById( 13 );
         REQUIRE( pointPtr2->read( pointVal2 ) );
-        REQUIRE( pointVal2 == 32 );
+        REQUIRE( pointVal2 == false );
 
 
         // Stop
-        uut->stop();
+        uut->stop( chassisMbox );
 
         // Destroy the Scanner
         uut->~ScannerApi();
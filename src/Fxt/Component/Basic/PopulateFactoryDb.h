@@ -21,9 +21,13 @@
 
 #include "Fxt/Component/Basic/Wire64FloatFactory.h"
 #include "Fxt/Component/Basic/Wire64BoolFactory.h"
+#include "Fxt/Component/Basic/WireArrayFloatFactory.h"
+#include "Fxt/Component/Basic/WireArrayBoolFactory.h"
 
 static Fxt::Component::Basic::Wire64FloatFactory         wire64FloatFactory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
 static Fxt::Component::Basic::Wire64BoolFactory          wire64BoolFactory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
+static Fxt::Component::Basic::WireArrayFloatFactory      wireArrayFloatFactory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
+static Fxt::Component::Basic::WireArrayBoolFactory       wireArrayBoolFactory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
 
 
 #endif  // end header latch
@@ -0,0 +1,133 @@
+#ifndef Fxt_Component_Basic_WireArrayBase_h_
+#define Fxt_Component_Basic_WireArrayBase_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Common_.h"
+#include "Cpl/Json/Arduino.h"
+#include "Fxt/Point/Api.h"
+#include "Fxt/Point/FactoryDatabaseApi.h"
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Basic {
+
+
+/** This partially concrete class implements a Component that is a pass-through
+    connector between two arrays of points. It is the 'array' version of the
+    Wire64 component, i.e. the inputs and outputs are specified as ranges of
+    Point IDs (start ID + count) instead of individual references. Up to 
+    MAX_INPUTS Inputs/Outputs are supported.
+
+    The concrete child determines the allowed data type. For given instance
+    All inputs/outputs MUST have the same type.
+
+    The total number of inputs must equal the total number of outputs. The
+    ranges are flattened in order, i.e. the Nth input Point (across all input
+    ranges) is copied to the Nth output Point (across all output ranges). The
+    input and output ranges do NOT need to have the same boundaries.
+
+    IF an input value is invalid, then its corresponding output value is set to
+    invalid.
+
+    The component has NO stateful data
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+       "name": "rack#1 connections"                         // Text label for the component
+       "type": "751a2c34-6d9a-4553-a29c-6d5109a22090",      // Identifies the card type.  Value comes from the Supported/Available-card-list
+       "typeName": "Fxt::Component::Basic::WireArrayFloat"  // OPTIONAL: Human readable type name
+       "inputs": [                                          // Array of input ranges
+          {
+            "name": "Rack#1 AIN",                           // human readable name for the input range
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signals
+            "typeName": "Fxt::Point::Float",                // OPTIONAL: Human readable Type name for the input signals. The type is child class specific!
+            "idRef": 4294967295,                            // Point ID of the FIRST point in the range
+            "count": 512                                    // OPTIONAL: Number of Points in the range. Default is 1
+          },
+          ...
+       ],
+       "outputs": [                                         // Array of output ranges
+          {
+            "name":"Rack#1 Signals"                         // Human readable name for the output range
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the output signals
+            "typeName": "Fxt::Point::Float",                // OPTIONAL: Human readable Type name for the output signals
+            "idRef":4294967295,                             // Point ID of the FIRST point in the range
+            "count": 512                                    // OPTIONAL: Number of Points in the range. Default is 1
+          },
+          ...
+       ]
+    }
+
+
+    \endcode
+ */
+class WireArrayBase : public Fxt::Component::Common_
+{
+public:
+    /// Maximum number of Input signals
+    static constexpr unsigned       MAX_INPUTS = 4096;
+
+    /// Maximum number of Output signals (MUST be the same a max inputs)
+    static constexpr unsigned       MAX_OUTPUTS = MAX_INPUTS;
+
+public:
+    /// Size (in bytes) of Stateful data that will be allocated on the HA Heap
+    static constexpr const size_t   HA_STATEFUL_HEAP_SIZE = 0;
+
+protected:
+    /// Constructor
+    WireArrayBase();
+
+    /// Destructor
+    ~WireArrayBase();
+
+public:
+    /// See Fxt::Component::Api
+    Fxt::Type::Error resolveReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept;
+
+    /// See Fxt::Component::Api
+    Fxt::Type::Error execute( int64_t currentTickUsec ) noexcept;
+
+protected:
+    /// Helper method to parse the card's JSON config
+    bool parseConfiguration( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                             JsonVariant&                      obj,
+                             unsigned                          minInputs,
+                             unsigned                          maxInputs,
+                             unsigned                          minOutputs,
+                             unsigned                          maxOutputs ) noexcept;
+
+
+    /// Helper method that returns the point type's GUID
+    virtual const char* getPointTypeGuid() const noexcept = 0;
+
+    /** Copy the data+state from ALL input points to their corresponding output
+        points, i.e. the child class provides the (type specific) loop so that
+        there is only a single virtual call per execution cycle.
+     */
+    virtual void copyPoints() noexcept = 0;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,92 @@
+#ifndef Fxt_Component_Basic_WireArrayBool_h_
+#define Fxt_Component_Basic_WireArrayBool_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Basic/WireArrayBase.h"
+#include "Fxt/Point/Bool.h"
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Basic {
+
+
+/** This concrete class implements a Component that connects two arrays of
+    Boolean points. Up to MAX_INPUTS inputs/output pairs are supported.
+ */
+class WireArrayBool : public WireArrayBase
+{
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "0c3ef504-7c41-4272-8b9e-6c287e6ff002";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Component::Basic::WireArrayBool";
+
+    /// Size (in bytes) of Stateful data that will be allocated on the HA Heap
+    static constexpr const size_t   HA_STATEFUL_HEAP_SIZE = 0;
+
+public:
+    /// Constructor
+    WireArrayBool( JsonVariant&                       componentObject,
+                   Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                   Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                   Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                   Fxt::Point::DatabaseApi&           dbForPoints )
+        :WireArrayBase()
+    {
+        parseConfiguration( generalAllocator, componentObject, 1, MAX_INPUTS, 1, MAX_OUTPUTS );
+    }
+
+public:
+    /// See Fxt::Component::Api
+    const char* getTypeGuid() const noexcept
+    {
+        return GUID_STRING;
+    }
+
+    /// See Fxt::Component::Api
+    const char* getTypeName() const noexcept
+    {
+        return TYPE_NAME;
+    }
+
+
+protected:
+    /// See Fxt::Component::Basic::WireArrayBase
+    const char* getPointTypeGuid() const noexcept
+    {
+        return Fxt::Point::Bool::GUID_STRING;
+    }
+
+    /// See Fxt::Component::Basic::WireArrayBase
+    void copyPoints() noexcept
+    {
+        Fxt::Point::Bool** inPts  = (Fxt::Point::Bool**) m_inputRefs;
+        Fxt::Point::Bool** outPts = (Fxt::Point::Bool**) m_outputRefs;
+        for ( unsigned i=0; i < m_numInputs; i++ )
+        {
+            outPts[i]->write( *(inPts[i]) );
+        }
+    }
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
\ No newline at end of file
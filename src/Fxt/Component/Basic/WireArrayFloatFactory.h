@@ -0,0 +1,34 @@
+#ifndef Fxt_Component_Basic_WireArrayFloatFactory_h_
+#define Fxt_Component_Basic_WireArrayFloatFactory_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Component/FactoryCommon_.h"
+#include "Fxt/Component/Basic/WireArrayFloat.h"
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Basic {
+
+
+/// Define factory type
+typedef Factory<WireArrayFloat> WireArrayFloatFactory;
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
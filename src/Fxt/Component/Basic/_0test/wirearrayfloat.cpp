@@ -0,0 +1,241 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Component/Basic/WireArrayFloat.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Bool.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/Math/real.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+/// 
+using namespace Fxt::Component::Basic;
+
+// Inputs: two ranges [0..3] and [4..5], Outputs: one range [8..13]
+static const char* COMP_DEFINTION = R"literalString(
+{
+  "components": [
+    {
+      "name": "test",
+      "type": "751a2c34-6d9a-4553-a29c-6d5109a22090",
+      "typeName": "Fxt::Component::Basic::WireArrayFloat",
+      "inputs": [
+        {
+          "name": "Rack A",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 0,
+          "count": 4
+        },
+        {
+          "name": "Rack B",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 4,
+          "count": 2
+        }
+      ],
+      "outputs": [
+        {
+          "name": "Signals",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 8,
+          "count": 6
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static const char* COMP_DEFINTION_MISMATCHED = R"literalString(
+{
+  "components": [
+    {
+      "name": "test",
+      "type": "751a2c34-6d9a-4553-a29c-6d5109a22090",
+      "inputs": [
+        { "idRef": 0, "count": 4 }
+      ],
+      "outputs": [
+        { "idRef": 8, "count": 5 }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static const char* COMP_DEFINTION_TOO_MANY = R"literalString(
+{
+  "components": [
+    {
+      "name": "test",
+      "type": "751a2c34-6d9a-4553-a29c-6d5109a22090",
+      "inputs": [
+        { "idRef": 0, "count": 4096 },
+        { "idRef": 5000 }
+      ],
+      "outputs": [
+        { "idRef": 10000, "count": 4097 }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+
+#define MAX_POINTS              14
+#define NUM_CHANNELS            6
+#define FIRST_INPUT_ID          0
+#define FIRST_OUTPUT_ID         8
+
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "WireArrayFloat" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap statefulAllocator( statefulHeap_, sizeof( statefulHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> buf;
+    StaticJsonDocument<10240>                          doc;
+
+    SECTION( "create component" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        WireArrayFloat uut( componentObj,
+                            generalAllocator,
+                            statefulAllocator,
+                            pointFactoryDb,
+                            pointDb );
+
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), WireArrayFloat::GUID_STRING ) == 0 );
+        REQUIRE( strcmp( uut.getTypeName(), WireArrayFloat::TYPE_NAME ) == 0 );
+        REQUIRE( uut.isStarted() == false );
+    }
+
+    SECTION( "create component - bad ranges" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION_MISMATCHED );
+        REQUIRE( err == DeserializationError::Ok );
+        JsonVariant componentObj = doc["components"][0];
+        WireArrayFloat uut( componentObj,
+                            generalAllocator,
+                            statefulAllocator,
+                            pointFactoryDb,
+                            pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Component::fullErr( Fxt::Component::Err_T::MISMATCHED_INPUTS_OUTPUTS ) );
+
+        err = deserializeJson( doc, COMP_DEFINTION_TOO_MANY );
+        REQUIRE( err == DeserializationError::Ok );
+        componentObj = doc["components"][0];
+        WireArrayFloat uut2( componentObj,
+                             generalAllocator,
+                             statefulAllocator,
+                             pointFactoryDb,
+                             pointDb );
+        REQUIRE( uut2.getErrorCode() == Fxt::Component::fullErr( Fxt::Component::Err_T::INCORRECT_NUM_INPUT_REFS ) );
+    }
+
+    SECTION( "execute component" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        WireArrayFloat uut( componentObj,
+                            generalAllocator,
+                            statefulAllocator,
+                            pointFactoryDb,
+                            pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        Fxt::Point::Float* inPts[NUM_CHANNELS];
+        Fxt::Point::Float* outPts[NUM_CHANNELS];
+        for ( unsigned i=0; i < NUM_CHANNELS; i++ )
+        {
+            inPts[i]  = new(std::nothrow) Fxt::Point::Float( pointDb, FIRST_INPUT_ID + i, statefulAllocator );
+            outPts[i] = new(std::nothrow) Fxt::Point::Float( pointDb, FIRST_OUTPUT_ID + i, statefulAllocator );
+        }
+
+        Fxt::Type::Error errCode = uut.resolveReferences( pointDb );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( errCode, buf )) );
+        REQUIRE( errCode == Fxt::Type::Error::SUCCESS() );
+
+        REQUIRE( uut.start( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        for ( unsigned i=0; i < NUM_CHANNELS; i++ )
+        {
+            REQUIRE( outPts[i]->isNotValid() );
+        }
+
+        for ( unsigned i=0; i < NUM_CHANNELS; i++ )
+        {
+            inPts[i]->write( i * 1.5F );
+        }
+        inPts[4]->setInvalid();
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        for ( unsigned i=0; i < NUM_CHANNELS; i++ )
+        {
+            float value;
+            if ( i == 4 )
+            {
+                REQUIRE( outPts[i]->isNotValid() );
+            }
+            else
+            {
+                REQUIRE( outPts[i]->read( value ) );
+                REQUIRE( Cpl::Math::areFloatsEqual( value, i * 1.5F ) );
+            }
+        }
+    }
+
+    SECTION( "wrong point type" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        WireArrayFloat uut( componentObj,
+                            generalAllocator,
+                            statefulAllocator,
+                            pointFactoryDb,
+                            pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        for ( unsigned i=0; i < NUM_CHANNELS; i++ )
+        {
+            new(std::nothrow) Fxt::Point::Float( pointDb, FIRST_INPUT_ID + i, statefulAllocator );
+        }
+        for ( unsigned i=0; i < NUM_CHANNELS - 1; i++ )
+        {
+            new(std::nothrow) Fxt::Point::Float( pointDb, FIRST_OUTPUT_ID + i, statefulAllocator );
+        }
+        new(std::nothrow) Fxt::Point::Bool( pointDb, FIRST_OUTPUT_ID + NUM_CHANNELS - 1, statefulAllocator );
+
+        REQUIRE( uut.resolveReferences( pointDb ) == Fxt::Component::fullErr( Fxt::Component::Err_T::OUTPUT_REFRENCE_BAD_TYPE ) );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -217,22 +217,25 @@ bool Common_::parseInputReferences( Cpl::Memory::ContiguousAllocator& generalAll
         }
 
         // Set the array entries to all ones.  This is so 'missing optional points' are indicated by a -1
-        memset( m_inputRefs, 0xFF, sizeof( sizeof( Fxt::Point::Api* ) * maxPoints ) );
+        memset( m_inputRefs, 0xFF, sizeof( Fxt::Point::Api* ) * maxPoints );
 
         // Search for the named elements
-        for ( unsigned i=0; i <= m_numInputs; i++ )
+        for ( unsigned i=0; i < m_numInputs; i++ )
         {
             JsonObject elem = inputs[i];
 
             // Look-up expected names
             for ( unsigned j=0; j < maxPoints; j++ )
             {
-                const char* keyVal = names[j].keyName;
+                const char* keyVal = elem[names[j].keyName];
 
                 // Match found -->parse the reference
                 if ( keyVal != nullptr && strcmp( keyVal, names[j].keyValue ) == 0 )
                 {
-                    parsePointReference( (size_t*) m_inputRefs, j, elem );
+                    if ( !parsePointReference( (size_t*) m_inputRefs, j, elem ) )
+                    {
+                        return false;
+                    }
                 }
             }
         }
@@ -241,7 +244,7 @@ bool Common_::parseInputReferences( Cpl::Memory::ContiguousAllocator& generalAll
         for ( unsigned j=0; j < maxPoints; j++ )
         {
             // Throw an error if required KV pair is missing
-            if ( m_inputRefs[j] == nullptr && names[j].required == true )
+            if ( ((size_t) m_inputRefs[j]) == ((size_t) -1) && names[j].required == true )
             {
                 m_error = fullErr( Err_T::MISSING_REQUIRED_FIELD );
                 m_error.logIt( "%s. Missing %s", getTypeName(), names[j].keyValue );
@@ -249,6 +252,9 @@ bool Common_::parseInputReferences( Cpl::Memory::ContiguousAllocator& generalAll
             }
         }
 
+        // The reference array is indexed by 'name' (missing optional references are resolved to nullptr)
+        m_numInputs = maxPoints;
+
         // If get here everything is GOOD
         return true;
     }
@@ -286,22 +292,25 @@ bool Common_::parseOutputReferences( Cpl::Memory::ContiguousAllocator& generalAl
         }
 
         // Set the array entries to all ones.  This is so 'missing optional points' are indicated by a -1
-        memset( m_outputRefs, 0xFF, sizeof( sizeof( Fxt::Point::Api* ) * maxPoints ) );
+        memset( m_outputRefs, 0xFF, sizeof( Fxt::Point::Api* ) * maxPoints );
 
         // Search for the named elements
-        for ( unsigned i=0; i <= m_numOutputs; i++ )
+        for ( unsigned i=0; i < m_numOutputs; i++ )
         {
             JsonObject elem = outputs[i];
 
             // Look-up expected names
             for ( unsigned j=0; j < maxPoints; j++ )
             {
-                const char* keyVal = names[j].keyName;
+                const char* keyVal = elem[names[j].keyName];
 
                 // Match found -->parse the reference
                 if ( keyVal != nullptr && strcmp( keyVal, names[j].keyValue ) == 0 )
                 {
-                    parsePointReference( (size_t*) m_outputRefs, j, elem );
+                    if ( !parsePointReference( (size_t*) m_outputRefs, j, elem ) )
+                    {
+                        return false;
+                    }
                 }
             }
         }
@@ -310,7 +319,7 @@ bool Common_::parseOutputReferences( Cpl::Memory::ContiguousAllocator& generalAl
         for ( unsigned j=0; j < maxPoints; j++ )
         {
             // Throw an error if required KV pair is missing
-            if ( m_outputRefs[j] == nullptr && names[j].required == true )
+            if ( ((size_t) m_outputRefs[j]) == ((size_t) -1) && names[j].required == true )
             {
                 m_error = fullErr( Err_T::MISSING_REQUIRED_FIELD );
                 m_error.logIt( "%s. Missing %s", getTypeName(), names[j].keyValue );
@@ -318,6 +327,9 @@ bool Common_::parseOutputReferences( Cpl::Memory::ContiguousAllocator& generalAl
             }
         }
 
+        // The reference array is indexed by 'name' (missing optional references are resolved to nullptr)
+        m_numOutputs = maxPoints;
+
         // If get here everything is GOOD
         return true;
     }
@@ -325,6 +337,108 @@ bool Common_::parseOutputReferences( Cpl::Memory::ContiguousAllocator& generalAl
     return false;
 }
 
+/////////////////////////////////////////////////
+bool Common_::parseInputRangeReferences( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                         JsonVariant&                      obj,
+                                         unsigned                          minPoints,
+                                         unsigned                          maxPoints ) noexcept
+{
+    JsonArray inputs = obj["inputs"];
+    if ( !inputs.isNull() )
+    {
+        return parsePointRanges( generalAllocator,
+                                 inputs,
+                                 minPoints,
+                                 maxPoints,
+                                 m_inputRefs,
+                                 m_numInputs,
+                                 Err_T::INCORRECT_NUM_INPUT_REFS,
+                                 Err_T::BAD_INPUT_REFERENCE );
+    }
+
+    return minPoints == 0;
+}
+
+bool Common_::parseOutputRangeReferences( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                          JsonVariant&                      obj,
+                                          unsigned                          minPoints,
+                                          unsigned                          maxPoints ) noexcept
+{
+    JsonArray outputs = obj["outputs"];
+    if ( !outputs.isNull() )
+    {
+        return parsePointRanges( generalAllocator,
+                                 outputs,
+                                 minPoints,
+                                 maxPoints,
+                                 m_outputRefs,
+                                 m_numOutputs,
+                                 Err_T::INCORRECT_NUM_OUTPUT_REFS,
+                                 Err_T::BAD_OUTPUT_REFERENCE );
+    }
+
+    return minPoints == 0;
+}
+
+bool Common_::parsePointRanges( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                JsonArray&                        arrayObj,
+                                unsigned                          minPoints,
+                                unsigned                          maxPoints,
+                                Fxt::Point::Api**&                dstReferences,
+                                unsigned&                         numPoints,
+                                Err_T                             errIncorrectNum,
+                                Err_T                             errBadRef )
+{
+    // Validate the ranges and total number of points
+    size_t total   = 0;
+    size_t nRanges = arrayObj.size();
+    for ( size_t i=0; i < nRanges; i++ )
+    {
+        JsonObject elem    = arrayObj[i];
+        uint32_t   startId = elem["idRef"] | Fxt::Point::Api::INVALID_ID;
+        uint32_t   count   = elem["count"] | 1;
+        if ( startId == Fxt::Point::Api::INVALID_ID || count == 0 || count > Fxt::Point::Api::INVALID_ID - startId )
+        {
+            m_error = fullErr( errBadRef );
+            m_error.logIt( "%s. range=%u", getTypeName(), (unsigned) i );
+            return false;
+        }
+        total += count;
+    }
+    if ( total < minPoints || total > maxPoints )
+    {
+        m_error = fullErr( errIncorrectNum );
+        m_error.logIt( "%s. numPoints=%u", getTypeName(), (unsigned) total );
+        return false;
+    }
+    numPoints = (unsigned) total;
+
+    // Allocate memory for the flattened references (a single allocation for all ranges)
+    dstReferences = (Fxt::Point::Api**) generalAllocator.allocate( sizeof( Fxt::Point::Api* ) * numPoints );
+    if ( dstReferences == nullptr )
+    {
+        m_error = fullErr( Fxt::Component::Err_T::OUT_OF_MEMORY );
+        m_error.logIt( getTypeName() );
+        return false;
+    }
+
+    // Start by storing the point IDs
+    size_t* refs = (size_t*) dstReferences;
+    unsigned idx = 0;
+    for ( size_t i=0; i < nRanges; i++ )
+    {
+        JsonObject elem    = arrayObj[i];
+        uint32_t   startId = elem["idRef"];
+        uint32_t   count   = elem["count"] | 1;
+        for ( uint32_t j=0; j < count; j++ )
+        {
+            refs[idx++] = startId + j;
+        }
+    }
+
+    return true;
+}
+
 /////////////////////////////////////////////////
 bool Common_::resolveInputOutputReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept
 {
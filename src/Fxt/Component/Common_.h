@@ -87,6 +87,24 @@ protected:
                                 unsigned                          minPoints,
                                 unsigned                          maxPoints ) noexcept;
 
+    /** Parse range inputs.  Each element in the 'inputs' array is a contiguous
+        range of Point IDs, i.e. "idRef" is the first Point ID in the range and
+        "count" is the number of Points in the range (default is 1).  The
+        m_inputRefs array is flattened, i.e. it contains the Point references
+        for all ranges in order.  'minPoints' and 'maxPoints' are the limits on
+        the TOTAL number of Points (not the number of ranges).
+     */
+    bool parseInputRangeReferences( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                    JsonVariant&                      obj,
+                                    unsigned                          minPoints,
+                                    unsigned                          maxPoints ) noexcept;
+
+    /// Parse range outputs. See parseInputRangeReferences() for details
+    bool parseOutputRangeReferences( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                     JsonVariant&                      obj,
+                                     unsigned                          minPoints,
+                                     unsigned                          maxPoints ) noexcept;
+
 protected:
     /// Helper method to extract Point references
     bool parsePointReferences( size_t           dstReferences[],
@@ -99,6 +117,19 @@ protected:
                               JsonObject&      objInstance );
 
 
+    /** Helper method that allocates and populates a flattened Point reference
+        array from an array of Point ranges.  Returns the number of Points in
+        'numPoints'.  Returns false if there is an error (and sets m_error)
+     */
+    bool parsePointRanges( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                           JsonArray&                        arrayObj,
+                           unsigned                          minPoints,
+                           unsigned                          maxPoints,
+                           Fxt::Point::Api**&                dstReferences,
+                           unsigned&                         numPoints,
+                           Err_T                             errIncorrectNum,
+                           Err_T                             errBadRef );
+
     /// Helper that resolve Inputs and Outputs references
     bool resolveInputOutputReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept;
 
@@ -0,0 +1,265 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "PidBase.h"
+#include "Cpl/System/Assert.h"
+#include "Fxt/Point/Bool.h"
+#include <stdint.h>
+
+///
+using namespace Fxt::Component::Controller;
+
+///
+const Fxt::Component::Common_::NamedRef_T PidBase::m_inputNames[PidBase::MAX_INPUTS] ={
+    { "var", "PV", true },
+    { "var", "SP", true },
+    { "var", "MAN", false },
+    { "var", "MV", false },
+    { "var", "RST", false },
+};
+
+///
+const Fxt::Component::Common_::NamedRef_T PidBase::m_outputNames[PidBase::MAX_OUTPUTS] ={
+    { "var", "OUT", true },
+};
+
+#define MIN_INPUTS      2
+#define MIN_OUTPUTS     1
+
+
+///////////////////////////////////////////////////////////////////////////////
+PidBase::PidBase()
+    : Common_()
+    , m_inIntAttr( nullptr )
+    , m_inFloatAttr( nullptr )
+    , m_outIntAttr( nullptr )
+    , m_outFloatAttr( nullptr )
+    , m_prevTickUsec( 0 )
+    , m_prevReset( false )
+    , m_firstCycle( true )
+{
+    // Child class does all of the work
+}
+
+PidBase::~PidBase()
+{
+    // Nothing required
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Fxt::Type::Error PidBase::start( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // NOTE: The stateful data (i.e. the integrator) is NOT reset when started.
+    //       This allows a 'standby' node to resume with the HA state from the
+    //       primary node.  Only the elapsed-time marker is re-initialized.
+    m_prevTickUsec = (int64_t) currentElapsedTimeUsec;
+    m_prevReset    = false;
+    m_firstCycle   = true;
+    return Common_::start( currentElapsedTimeUsec );
+}
+
+Fxt::Type::Error PidBase::execute( int64_t currentTickUsec ) noexcept
+{
+    // NOTE: The method NEVER fails
+
+    // Calculate the elapsed time since the last cycle
+    uint32_t deltaUsec = 0;
+    if ( !m_firstCycle && currentTickUsec > m_prevTickUsec )
+    {
+        deltaUsec = (uint32_t) (currentTickUsec - m_prevTickUsec);
+    }
+    m_prevTickUsec = currentTickUsec;
+    m_firstCycle   = false;
+
+    // Reset on the rising edge of the RST input
+    bool resetVal;
+    Fxt::Point::Bool* resetPt = (Fxt::Point::Bool*) m_inputRefs[eIDX_RST];
+    if ( resetPt && resetPt->read( resetVal ) )
+    {
+        if ( resetVal && !m_prevReset )
+        {
+            resetState();
+            deltaUsec = 0;
+        }
+        m_prevReset = resetVal;
+    }
+
+    // Get the manual mode (an invalid MAN input is treated as automatic mode)
+    bool manualMode = false;
+    Fxt::Point::Bool* manualPt = (Fxt::Point::Bool*) m_inputRefs[eIDX_MAN];
+    if ( manualPt && !manualPt->read( manualMode ) )
+    {
+        manualMode = false;
+    }
+
+    // Run the controller
+    if ( !calculateOutput( deltaUsec, manualMode ) )
+    {
+        // Set the output to invalid when a required input is invalid
+        m_outputRefs[eIDX_OUT]->setInvalid();
+    }
+
+    return Fxt::Type::Error::SUCCESS();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool PidBase::readInput( unsigned refIdx, double& dstValue ) noexcept
+{
+    if ( m_inFloatAttr )
+    {
+        return (m_inFloatAttr->readFunc)(m_inputRefs[refIdx], dstValue);
+    }
+
+    uint64_t raw;
+    bool     valid = (m_inIntAttr->readFunc)(m_inputRefs[refIdx], raw);
+    dstValue       = m_inIntAttr->isSigned ? (double) ((int64_t) raw) : (double) raw;
+    return valid;
+}
+
+bool PidBase::readInput( unsigned refIdx, int64_t& dstValue ) noexcept
+{
+    if ( m_inIntAttr )
+    {
+        // Note: The read functions sign extend signed integers
+        uint64_t raw;
+        bool     valid = (m_inIntAttr->readFunc)(m_inputRefs[refIdx], raw);
+        dstValue       = (int64_t) raw;
+        return valid;
+    }
+
+    double realVal;
+    bool   valid = (m_inFloatAttr->readFunc)(m_inputRefs[refIdx], realVal);
+    dstValue     = (int64_t) realVal;
+    return valid;
+}
+
+void PidBase::writeOutput( double value ) noexcept
+{
+    if ( m_outFloatAttr )
+    {
+        (m_outFloatAttr->writeFunc)(m_outputRefs[eIDX_OUT], value);
+    }
+    else
+    {
+        (m_outIntAttr->writeFunc)(m_outputRefs[eIDX_OUT], (uint64_t) ((int64_t) value));
+    }
+}
+
+void PidBase::writeOutput( int64_t value ) noexcept
+{
+    if ( m_outIntAttr )
+    {
+        (m_outIntAttr->writeFunc)(m_outputRefs[eIDX_OUT], (uint64_t) value);
+    }
+    else
+    {
+        (m_outFloatAttr->writeFunc)(m_outputRefs[eIDX_OUT], (double) value);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool PidBase::parseConfiguration( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                  Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator,
+                                  JsonVariant&                      obj ) noexcept
+{
+    // Parse references
+    if ( !parseInputReferences( generalAllocator, obj, m_inputNames, MIN_INPUTS, MAX_INPUTS ) ||
+         !parseOutputReferences( generalAllocator, obj, m_outputNames, MIN_OUTPUTS, MAX_OUTPUTS ) )
+    {
+        if ( m_error == Fxt::Type::Error::SUCCESS() )
+        {
+            m_error = fullErr( Err_T::MISSING_REQUIRED_FIELD );
+            m_error.logIt( getTypeName() );
+        }
+        return false;
+    }
+
+    // Manual mode requires a manual value
+    if ( ((size_t) m_inputRefs[eIDX_MAN]) != ((size_t) -1) && ((size_t) m_inputRefs[eIDX_MV]) == ((size_t) -1) )
+    {
+        m_error = fullErr( Err_T::MISSING_REQUIRED_FIELD );
+        m_error.logIt( "%s. MAN requires MV", getTypeName() );
+        return false;
+    }
+
+    // Parse the tuning constants
+    if ( obj["kp"].isNull() || obj["outMin"].isNull() || obj["outMax"].isNull() ||
+         !parseJsonKonstants( obj ) )
+    {
+        m_error = fullErr( Err_T::MISSING_REQUIRED_FIELD );
+        m_error.logIt( "%s. Bad/missing tuning constants", getTypeName() );
+        return false;
+    }
+
+    // Allocate my stateful data
+    if ( !allocateStatefulData( haStatefulDataAllocator ) )
+    {
+        m_error = fullErr( Err_T::OUT_OF_MEMORY );
+        m_error.logIt( "%s. Stateful Allocator", getTypeName() );
+        return false;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+Fxt::Type::Error PidBase::resolveReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept
+{
+    // Resolve references
+    if ( !resolveInputOutputReferences( pointDb ) )
+    {
+        return m_error;
+    }
+
+    // Validate the numeric INPUT Point types
+    const char* numericGuid = m_inputRefs[eIDX_PV]->getTypeGuid();
+    if ( Fxt::Point::Api::validatePointTypes( m_inputRefs + eIDX_PV, 2, numericGuid ) == false ||
+         Fxt::Point::Api::validatePointTypes( m_inputRefs + eIDX_MV, 1, numericGuid ) == false )
+    {
+        m_error = fullErr( Err_T::INPUT_REFRENCE_BAD_TYPE );
+        m_error.logIt( getTypeName() );
+        return m_error;
+    }
+    m_inIntAttr   = Fxt::Point::NumericHandlers::getIntegerPointAttributes( numericGuid );
+    m_inFloatAttr = Fxt::Point::NumericHandlers::getFloatPointAttributes( numericGuid );
+    if ( m_inIntAttr == nullptr && m_inFloatAttr == nullptr )
+    {
+        m_error = fullErr( Err_T::INPUT_REFRENCE_BAD_TYPE );
+        m_error.logIt( "%s. Not a numeric type", getTypeName() );
+        return m_error;
+    }
+
+    // Validate the Boolean INPUT Point types
+    if ( Fxt::Point::Api::validatePointTypes( m_inputRefs + eIDX_MAN, 1, Fxt::Point::Bool::GUID_STRING ) == false ||
+         Fxt::Point::Api::validatePointTypes( m_inputRefs + eIDX_RST, 1, Fxt::Point::Bool::GUID_STRING ) == false )
+    {
+        m_error = fullErr( Err_T::INPUT_REFRENCE_BAD_TYPE );
+        m_error.logIt( getTypeName() );
+        return m_error;
+    }
+
+    // Validate the OUTPUT Point type
+    const char* outputGuid = m_outputRefs[eIDX_OUT]->getTypeGuid();
+    m_outIntAttr           = Fxt::Point::NumericHandlers::getIntegerPointAttributes( outputGuid );
+    m_outFloatAttr         = Fxt::Point::NumericHandlers::getFloatPointAttributes( outputGuid );
+    if ( m_outIntAttr == nullptr && m_outFloatAttr == nullptr )
+    {
+        m_error = fullErr( Err_T::OUTPUT_REFRENCE_BAD_TYPE );
+        m_error.logIt( "%s. Not a numeric type", getTypeName() );
+        return m_error;
+    }
+
+    m_error = Fxt::Type::Error::SUCCESS();   // Set my state to 'ready-to-start'
+    return m_error;
+}
@@ -0,0 +1,254 @@
+#ifndef Fxt_Component_Controller_PidBase_h_
+#define Fxt_Component_Controller_PidBase_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Common_.h"
+#include "Cpl/Json/Arduino.h"
+#include "Fxt/Point/Api.h"
+#include "Fxt/Point/FactoryDatabaseApi.h"
+#include "Fxt/Point/NumericHandlers.h"
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Controller {
+
+
+/** This partially concrete class implements a Component that is a PID
+    (Proportional-Integral-Derivative) controller.  The concrete child class
+    determines the numeric representation (floating point vs. fixed point)
+    used for the internal calculations.
+
+    Inputs:
+        Process Variable (PV)
+        Setpoint (SP)
+        Optional manual mode (MAN). When true, the output tracks MV (default is false)
+        Optional manual value (MV). Output value when in manual mode.  Required if MAN is specified.
+        Optional reset (RST). A rising edge resets the integrator and derivative state.
+
+        Note: PV, SP, and MV MUST all be the same numeric type. The input/output
+              numeric types are read/written via Fxt::Point::NumericHandlers.
+
+    Outputs:
+        Controller output (OUT).  Can be any numeric type.
+
+    Logic:
+        err   := SP - PV
+        P     := kp * err
+        I     := I + ki * err * dt
+        D     := filtered( -kd * dPV/dt )      // Derivative-on-measurement, i.e. no setpoint 'kick'
+        OUT   := clamp( P + I + D, outMin, outMax )
+
+        Anti-windup: The integrator is clamped to [outMin, outMax] and is NOT
+        updated when the output is saturated and the error would drive it
+        further into saturation (conditional integration).
+
+        Bumpless transfer: While in manual mode the integrator is back
+        calculated so that P + I + D == MV, i.e. there is no 'bump' in the
+        output when switching back to automatic mode.
+
+        The derivative term is passed through a first order low pass filter
+        with a time constant of 'dFilterTc' seconds. A value of zero disables
+        the filter.
+
+    IF PV or SP (or MV when in manual mode) is invalid, THEN the output signal
+    is invalid.
+
+    The component HAS stateful data (allocated on the HA Heap), i.e. the
+    integrator and derivative state survive a fail-over.
+        Integrator
+        Filtered derivative
+        Previous PV
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+       "name": "PID#1"                                      // *Text label for the component
+       "type": "<child class GUID>",                        // Identifies the card type.  Value comes from the Supported/Available-card-list
+       "typeName": "Fxt::Component::Controller::PidFloat"   // *OPTIONAL: Human readable type name
+       "kp": <numeric>,                                     // Proportional gain
+       "ki": <numeric>,                                     // OPTIONAL: Integral gain (per second). Default is 0
+       "kd": <numeric>,                                     // OPTIONAL: Derivative gain (seconds). Default is 0
+       "dFilterTc": <numeric>,                              // OPTIONAL: Derivative filter time constant (seconds). Default is 0 (no filtering)
+       "outMin": <numeric>,                                 // Minimum output value
+       "outMax": <numeric>,                                 // Maximum output value
+       "inputs": [                                          // Array of Point references that supply the Component's input values.
+          {
+            "name": "temperature",                          // *Human readable name for the input signal
+            "var": "PV",                                    // MUST BE: PV.  Process variable
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signal.  Can be Any numeric type.
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the input signal
+            "idRef": 4294967295                             // Point ID Reference to the point to read the input value from
+          },
+          {
+            "name": "setpoint",                             // *Human readable name for the input signal
+            "var": "SP",                                    // MUST BE: SP.  Setpoint
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signal.  Can be Any numeric type.
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the input signal
+            "idRef": 4294967295                             // Point ID Reference to the point to read the input value from
+          },
+          {                                                 // OPTIONAL
+            "name": "manual mode",                          // *Human readable name for the input signal
+            "var": "MAN",                                   // MUST BE: MAN.  Manual mode enabled
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the input signal
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the input signal
+            "idRef": 4294967295                             // Point ID Reference to the point to read the input value from
+          },
+          {                                                 // OPTIONAL
+            "name": "manual value",                         // *Human readable name for the input signal
+            "var": "MV",                                    // MUST BE: MV.  Manual output value
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signal.  Can be Any numeric type.
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the input signal
+            "idRef": 4294967295                             // Point ID Reference to the point to read the input value from
+          },
+          {                                                 // OPTIONAL
+            "name": "Start-over",                           // *Human readable name for the input signal
+            "var": "RST",                                   // MUST BE: RST.  Reset pulse (reset on the rising edge)
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the input signal
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the input signal
+            "idRef": 4294967295                             // Point ID Reference to the point to read the input value from
+          }
+       ],
+       "outputs": [
+          {
+            "name": "Output",                               // *Human readable name for the output signal
+            "var": "OUT",                                   // MUST BE: OUT.  Controller output
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the output signal. Can be Any numeric type.
+            "typeName": "Fxt::Point::Float",                // *OPTIONAL: Human readable Type name for the output signal
+            "idRef": 4294967295                             // Point ID reference to the point that is updated with the output value
+          }
+       ]
+    }
+
+    *The field is NOT parsed/used by the firmware
+
+    \endcode
+ */
+class PidBase : public Fxt::Component::Common_
+{
+public:
+    /// Maximum number of Input signals
+    static constexpr unsigned MAX_INPUTS = 5;
+
+    /// Maximum number of Output signals
+    static constexpr unsigned MAX_OUTPUTS = 1;
+
+protected:
+    /// Input reference indexes (i.e. the order of the 'named' references)
+    enum InputIdx_T
+    {
+        eIDX_PV = 0,    //!< Process variable
+        eIDX_SP,        //!< Setpoint
+        eIDX_MAN,       //!< Manual mode
+        eIDX_MV,        //!< Manual value
+        eIDX_RST        //!< Reset
+    };
+
+    /// Output reference indexes
+    enum OutputIdx_T
+    {
+        eIDX_OUT = 0    //!< Controller output
+    };
+
+protected:
+    /// Constructor
+    PidBase();
+
+    /// Destructor
+    ~PidBase();
+
+public:
+    /// See Fxt::Component::Api
+    Fxt::Type::Error start( uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Component::Api
+    Fxt::Type::Error resolveReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept;
+
+    /// See Fxt::Component::Api
+    Fxt::Type::Error execute( int64_t currentTickUsec ) noexcept;
+
+protected:
+    /// Helper method to parse the card's JSON config
+    bool parseConfiguration( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                             Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator,
+                             JsonVariant&                      obj ) noexcept;
+
+    /// Helper method that parses the tuning constants.  Returns false if there is missing/bad tuning constants
+    virtual bool parseJsonKonstants( JsonVariant& obj ) noexcept = 0;
+
+    /// Helper method that allocates (and zeros) the stateful data from the HA heap
+    virtual bool allocateStatefulData( Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator ) noexcept = 0;
+
+    /** Helper method that performs the actual PID calculation and writes the
+        output point.  'deltaUsec' is the elapsed time since the previous
+        execution cycle (zero on the first cycle after being started). Returns
+        false if one or more of the required inputs is invalid.
+     */
+    virtual bool calculateOutput( uint32_t deltaUsec, bool manualMode ) noexcept = 0;
+
+    /// Helper method that clears the integrator and derivative state
+    virtual void resetState() noexcept = 0;
+
+protected:
+    /// Helper method that reads a numeric input as a double. Returns false if the input is invalid
+    bool readInput( unsigned refIdx, double& dstValue ) noexcept;
+
+    /// Helper method that reads a numeric input as a signed integer (floating point values are truncated). Returns false if the input is invalid
+    bool readInput( unsigned refIdx, int64_t& dstValue ) noexcept;
+
+    /// Helper method that writes the output from a double
+    void writeOutput( double value ) noexcept;
+
+    /// Helper method that writes the output from a signed integer
+    void writeOutput( int64_t value ) noexcept;
+
+protected:
+    /// Named input references (the array order MUST match InputIdx_T)
+    static const NamedRef_T                                 m_inputNames[MAX_INPUTS];
+
+    /// Named output references (the array order MUST match OutputIdx_T)
+    static const NamedRef_T                                 m_outputNames[MAX_OUTPUTS];
+
+    /// Integer attributes for the PV/SP/MV inputs (is nullptr when the input type is a floating point type)
+    const Fxt::Point::NumericHandlers::IntegerAttributes_T* m_inIntAttr;
+
+    /// Float attributes for the PV/SP/MV inputs (is nullptr when the input type is an integer type)
+    const Fxt::Point::NumericHandlers::FloatAttributes_T*   m_inFloatAttr;
+
+    /// Integer attributes for the output (is nullptr when the output type is a floating point type)
+    const Fxt::Point::NumericHandlers::IntegerAttributes_T* m_outIntAttr;
+
+    /// Float attributes for the output (is nullptr when the output type is an integer type)
+    const Fxt::Point::NumericHandlers::FloatAttributes_T*   m_outFloatAttr;
+
+    /// Elapsed time of the previous execution cycle
+    int64_t                                                 m_prevTickUsec;
+
+    /// Previous value of the RST input
+    bool                                                    m_prevReset;
+
+    /// Set to true when the next execution cycle is the first cycle after being started
+    bool                                                    m_firstCycle;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,261 @@
+#ifndef Fxt_Component_Controller_PidFixed_h_
+#define Fxt_Component_Controller_PidFixed_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Controller/PidBase.h"
+#include <string.h>
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Controller {
+
+
+/** This concrete class implements a PID Component that uses Q16.16 fixed
+    point math for its internal calculations, i.e. it is intended for
+    targets without a hardware FPU.  See PidBase for the details.
+
+    The input/output values are converted to/from Q16.16. This means the
+    magnitude of the input/output values (and the tuning constants) MUST be
+    less than 32768.  Floating point inputs/outputs are supported, but the
+    fractional part of the values is truncated to 16 bits.  Integer inputs are
+    treated as whole numbers (i.e. the output is rounded down to an integer
+    when the output point is an integer type).
+ */
+class PidFixed : public PidBase
+{
+protected:
+    /// Stateful data (allocated on the HA heap).  All values are Q16.16
+    struct StateBlock_T
+    {
+        int64_t integral;   //!< Integrator
+        int64_t derivative; //!< Filtered derivative term
+        int64_t prevPv;     //!< Process variable from the previous cycle
+    };
+
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "8a914bff-d0ea-4c1e-8053-fed4c8c48ee2";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Component::Controller::PidFixed";
+
+    /// Size (in bytes) of Stateful data that will be allocated on the HA Heap
+    static constexpr const size_t   HA_STATEFUL_HEAP_SIZE = sizeof( StateBlock_T );
+
+    /// Number of fractional bits
+    static constexpr const unsigned Q_BITS = 16;
+
+public:
+    /// Constructor
+    PidFixed( JsonVariant&                       componentObject,
+              Cpl::Memory::ContiguousAllocator&  generalAllocator,
+              Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+              Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+              Fxt::Point::DatabaseApi&           dbForPoints )
+        : PidBase()
+        , m_state( nullptr )
+    {
+        parseConfiguration( generalAllocator, haStatefulDataAllocator, componentObject );
+    }
+
+public:
+    /// See Fxt::Component::Api
+    const char* getTypeGuid() const noexcept
+    {
+        return GUID_STRING;
+    }
+
+    /// See Fxt::Component::Api
+    const char* getTypeName() const noexcept
+    {
+        return TYPE_NAME;
+    }
+
+protected:
+    /// See Fxt::Component::Controller::PidBase
+    bool parseJsonKonstants( JsonVariant& obj ) noexcept
+    {
+        float tf = obj["dFilterTc"] | 0.0F;
+        m_kp     = toQ( obj["kp"] | 0.0 );
+        m_ki     = toQ( obj["ki"] | 0.0 );
+        m_kdUsec = (int64_t) ((obj["kd"] | 0.0) * 1000000.0 * (1 << Q_BITS));  // Q16.16 kd pre-scaled by 1E6 (i.e. kd * 1E6 / dtUsec -->Q16.16)
+        m_tfUsec = (int64_t) (tf * 1000000.0F);
+        m_outMin = toQ( obj["outMin"] | 0.0 );
+        m_outMax = toQ( obj["outMax"] | 0.0 );
+        return m_outMin <= m_outMax && tf >= 0.0F;
+    }
+
+    /// See Fxt::Component::Controller::PidBase
+    bool allocateStatefulData( Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator ) noexcept
+    {
+        m_state = (StateBlock_T*) haStatefulDataAllocator.allocate( sizeof( StateBlock_T ) );
+        if ( m_state )
+        {
+            memset( m_state, 0, sizeof( StateBlock_T ) );
+        }
+        return m_state != nullptr;
+    }
+
+    /// See Fxt::Component::Controller::PidBase
+    void resetState() noexcept
+    {
+        m_state->integral   = 0;
+        m_state->derivative = 0;
+    }
+
+    /// See Fxt::Component::Controller::PidBase
+    bool calculateOutput( uint32_t deltaUsec, bool manualMode ) noexcept
+    {
+        int64_t pv;
+        int64_t sp;
+        if ( !readInputQ( eIDX_PV, pv ) || !readInputQ( eIDX_SP, sp ) )
+        {
+            return false;
+        }
+        int64_t err = sp - pv;
+
+        // Proportional and (filtered) derivative-on-measurement terms
+        int64_t p = (m_kp * err) >> Q_BITS;
+        if ( deltaUsec > 0 )
+        {
+            int64_t dRaw = -((m_kdUsec / deltaUsec) * (pv - m_state->prevPv)) >> Q_BITS;
+            if ( m_tfUsec > 0 )
+            {
+                int64_t alpha = (m_tfUsec << Q_BITS) / (m_tfUsec + deltaUsec);
+                dRaw          = (alpha * m_state->derivative + ((1 << Q_BITS) - alpha) * dRaw) >> Q_BITS;
+            }
+            m_state->derivative = dRaw;
+        }
+        m_state->prevPv = pv;
+        int64_t d       = m_state->derivative;
+
+        // Manual mode: output tracks MV and the integrator is back calculated (bumpless transfer)
+        int64_t out;
+        if ( manualMode )
+        {
+            int64_t mv;
+            if ( !readInputQ( eIDX_MV, mv ) )
+            {
+                return false;
+            }
+            out               = clamp( mv );
+            m_state->integral = clamp( out - p - d );
+        }
+
+        // Automatic mode (with conditional integration for anti-windup)
+        else
+        {
+            int64_t integral = clamp( m_state->integral + (((m_ki * err) >> Q_BITS) * deltaUsec) / 1000000 );
+            out              = p + integral + d;
+            if ( out > m_outMax )
+            {
+                out = m_outMax;
+                if ( err < 0 )
+                {
+                    m_state->integral = integral;
+                }
+            }
+            else if ( out < m_outMin )
+            {
+                out = m_outMin;
+                if ( err > 0 )
+                {
+                    m_state->integral = integral;
+                }
+            }
+            else
+            {
+                m_state->integral = integral;
+            }
+        }
+
+        writeOutputQ( out );
+        return true;
+    }
+
+protected:
+    /// Helper method to convert a real number to Q16.16
+    static inline int64_t toQ( double value ) noexcept
+    {
+        return (int64_t) (value * (1 << Q_BITS));
+    }
+
+    /// Helper method to read an input as a Q16.16 value
+    inline bool readInputQ( unsigned refIdx, int64_t& dstValue ) noexcept
+    {
+        if ( m_inIntAttr )
+        {
+            int64_t value;
+            bool    valid = readInput( refIdx, value );
+            dstValue      = value * (1 << Q_BITS);
+            return valid;
+        }
+
+        double value;
+        bool   valid = readInput( refIdx, value );
+        dstValue     = toQ( value );
+        return valid;
+    }
+
+    /// Helper method to write the output from a Q16.16 value
+    inline void writeOutputQ( int64_t value ) noexcept
+    {
+        if ( m_outIntAttr )
+        {
+            writeOutput( (int64_t) (value >> Q_BITS) );
+        }
+        else
+        {
+            writeOutput( ((double) value) / (1 << Q_BITS) );
+        }
+    }
+
+    /// Helper method to limit a value to the output range
+    inline int64_t clamp( int64_t value ) const noexcept
+    {
+        return value > m_outMax ? m_outMax : value < m_outMin ? m_outMin : value;
+    }
+
+protected:
+    /// Stateful data
+    StateBlock_T*   m_state;
+
+    /// Proportional gain (Q16.16)
+    int64_t         m_kp;
+
+    /// Integral gain, per second (Q16.16)
+    int64_t         m_ki;
+
+    /// Derivative gain, in microseconds (Q16.16)
+    int64_t         m_kdUsec;
+
+    /// Derivative filter time constant in microseconds
+    int64_t         m_tfUsec;
+
+    /// Minimum output value (Q16.16)
+    int64_t         m_outMin;
+
+    /// Maximum output value (Q16.16)
+    int64_t         m_outMax;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
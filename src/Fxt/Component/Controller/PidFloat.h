@@ -0,0 +1,216 @@
+#ifndef Fxt_Component_Controller_PidFloat_h_
+#define Fxt_Component_Controller_PidFloat_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Controller/PidBase.h"
+#include <string.h>
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Controller {
+
+
+/** This concrete class implements a PID Component that uses single precision
+    floating point math for its internal calculations.  See PidBase for the
+    details.
+ */
+class PidFloat : public PidBase
+{
+protected:
+    /// Stateful data (allocated on the HA heap)
+    struct StateBlock_T
+    {
+        float integral;     //!< Integrator
+        float derivative;   //!< Filtered derivative term
+        float prevPv;       //!< Process variable from the previous cycle
+    };
+
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "9a220331-3df9-4fc7-88f3-acb580310be2";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Component::Controller::PidFloat";
+
+    /// Size (in bytes) of Stateful data that will be allocated on the HA Heap
+    static constexpr const size_t   HA_STATEFUL_HEAP_SIZE = sizeof( StateBlock_T );
+
+public:
+    /// Constructor
+    PidFloat( JsonVariant&                       componentObject,
+              Cpl::Memory::ContiguousAllocator&  generalAllocator,
+              Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+              Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+              Fxt::Point::DatabaseApi&           dbForPoints )
+        : PidBase()
+        , m_state( nullptr )
+    {
+        parseConfiguration( generalAllocator, haStatefulDataAllocator, componentObject );
+    }
+
+public:
+    /// See Fxt::Component::Api
+    const char* getTypeGuid() const noexcept
+    {
+        return GUID_STRING;
+    }
+
+    /// See Fxt::Component::Api
+    const char* getTypeName() const noexcept
+    {
+        return TYPE_NAME;
+    }
+
+protected:
+    /// See Fxt::Component::Controller::PidBase
+    bool parseJsonKonstants( JsonVariant& obj ) noexcept
+    {
+        m_kp     = obj["kp"] | 0.0F;
+        m_ki     = obj["ki"] | 0.0F;
+        m_kd     = obj["kd"] | 0.0F;
+        m_tf     = obj["dFilterTc"] | 0.0F;
+        m_outMin = obj["outMin"] | 0.0F;
+        m_outMax = obj["outMax"] | 0.0F;
+        return m_outMin <= m_outMax && m_tf >= 0.0F;
+    }
+
+    /// See Fxt::Component::Controller::PidBase
+    bool allocateStatefulData( Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator ) noexcept
+    {
+        m_state = (StateBlock_T*) haStatefulDataAllocator.allocate( sizeof( StateBlock_T ) );
+        if ( m_state )
+        {
+            memset( m_state, 0, sizeof( StateBlock_T ) );
+        }
+        return m_state != nullptr;
+    }
+
+    /// See Fxt::Component::Controller::PidBase
+    void resetState() noexcept
+    {
+        m_state->integral   = 0.0F;
+        m_state->derivative = 0.0F;
+    }
+
+    /// See Fxt::Component::Controller::PidBase
+    bool calculateOutput( uint32_t deltaUsec, bool manualMode ) noexcept
+    {
+        double pvIn;
+        double spIn;
+        if ( !readInput( eIDX_PV, pvIn ) || !readInput( eIDX_SP, spIn ) )
+        {
+            return false;
+        }
+        float pv  = (float) pvIn;
+        float err = (float) spIn - pv;
+
+        // Proportional and (filtered) derivative-on-measurement terms
+        float p = m_kp * err;
+        if ( deltaUsec > 0 )
+        {
+            float dt   = deltaUsec * 1.0E-6F;
+            float dRaw = -m_kd * (pv - m_state->prevPv) / dt;
+            if ( m_tf > 0.0F )
+            {
+                float alpha = m_tf / (m_tf + dt);
+                dRaw        = alpha * m_state->derivative + (1.0F - alpha) * dRaw;
+            }
+            m_state->derivative = dRaw;
+        }
+        m_state->prevPv = pv;
+        float d         = m_state->derivative;
+
+        // Manual mode: output tracks MV and the integrator is back calculated (bumpless transfer)
+        float out;
+        if ( manualMode )
+        {
+            double mvIn;
+            if ( !readInput( eIDX_MV, mvIn ) )
+            {
+                return false;
+            }
+            out                = clamp( (float) mvIn );
+            m_state->integral  = clamp( out - p - d );
+        }
+
+        // Automatic mode (with conditional integration for anti-windup)
+        else
+        {
+            float integral = clamp( m_state->integral + m_ki * err * (deltaUsec * 1.0E-6F) );
+            out            = p + integral + d;
+            if ( out > m_outMax )
+            {
+                out = m_outMax;
+                if ( err < 0.0F )
+                {
+                    m_state->integral = integral;
+                }
+            }
+            else if ( out < m_outMin )
+            {
+                out = m_outMin;
+                if ( err > 0.0F )
+                {
+                    m_state->integral = integral;
+                }
+            }
+            else
+            {
+                m_state->integral = integral;
+            }
+        }
+
+        writeOutput( (double) out );
+        return true;
+    }
+
+protected:
+    /// Helper method to limit a value to the output range
+    inline float clamp( float value ) const noexcept
+    {
+        return value > m_outMax ? m_outMax : value < m_outMin ? m_outMin : value;
+    }
+
+protected:
+    /// Stateful data
+    StateBlock_T*   m_state;
+
+    /// Proportional gain
+    float           m_kp;
+
+    /// Integral gain (per second)
+    float           m_ki;
+
+    /// Derivative gain (seconds)
+    float           m_kd;
+
+    /// Derivative filter time constant (seconds)
+    float           m_tf;
+
+    /// Minimum output value
+    float           m_outMin;
+
+    /// Maximum output value
+    float           m_outMax;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,258 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Component/Controller/PidFixed.h"
+#include "Fxt/Component/Controller/PidFixedFactory.h"
+#include "Fxt/Component/FactoryDatabase.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Float.h"
+#include "Fxt/Point/Bool.h"
+#include "Fxt/Point/Int32.h"
+#include "Fxt/System/ElapsedTime.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/Math/real.h"
+#include <string.h>
+#include <stdio.h>
+
+#define SECT_   "_0test"
+
+///
+using namespace Fxt::Component::Controller;
+
+static const char* COMP_DEFINTION = R"literalString(
+{
+  "components": [
+    {
+      "name": "PID#1",
+      "type": "8a914bff-d0ea-4c1e-8053-fed4c8c48ee2",
+      "typeName": "Fxt::Component::Controller::PidFixed",
+      "kp": 2.0,
+      "ki": 1.0,
+      "kd": 0.5,
+      "dFilterTc": 0.1,
+      "outMin": -100.0,
+      "outMax": 100.0,
+      "inputs": [
+        {
+          "name": "temperature",
+          "var": "PV",
+          "type": "c357de9a-a10b-4c87-83b9-ed230135752d",
+          "typeName": "Fxt::Point::Int32",
+          "idRef": 0
+        },
+        {
+          "name": "setpoint",
+          "var": "SP",
+          "type": "c357de9a-a10b-4c87-83b9-ed230135752d",
+          "typeName": "Fxt::Point::Int32",
+          "idRef": 1
+        },
+        {
+          "name": "Start-over",
+          "var": "RST",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 2
+        }
+      ],
+      "outputs": [
+        {
+          "name": "Output",
+          "var": "OUT",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 3
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+static size_t haHeap_[100];
+
+#define MAX_POINTS              4
+
+#define POINT_ID__PV            0
+#define POINT_ID__SP            1
+#define POINT_ID__RST           2
+#define POINT_ID__OUT           3
+
+#define ONE_SECOND_USEC         (1000LL * 1000LL)
+
+#define BENCHMARK_ITERATIONS    (1000 * 1000)
+
+/// Target execution time, in nanoseconds, of a single execute() call
+#define BENCHMARK_TARGET_NSEC   100
+
+/// Allowance for the code coverage instrumentation of the unit test builds (i.e. the test fails at 3x the target)
+#define BENCHMARK_ALLOWANCE     3
+
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "PidFixed" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap statefulAllocator( statefulHeap_, sizeof( statefulHeap_ ) );
+    Cpl::Memory::LeanHeap haAllocator( haHeap_, sizeof( haHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Component::FactoryDatabase                    componentFactoryDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    PidFixedFactory                                    uut( componentFactoryDb );
+    Fxt::Type::Error                                   componentErrorCode;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> buf;
+    StaticJsonDocument<10240>                          doc;
+    float                                              value;
+
+    DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+    REQUIRE( err == DeserializationError::Ok );
+    JsonVariant componentObj = doc["components"][0];
+
+    SECTION( "create/destroy component" )
+    {
+        Fxt::Component::Api* component = uut.create( componentObj,
+                                                     componentErrorCode,
+                                                     generalAllocator,
+                                                     haAllocator,
+                                                     pointFactoryDb,
+                                                     pointDb );
+        REQUIRE( component != nullptr );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( componentErrorCode, buf )) );
+        REQUIRE( componentErrorCode == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( component->getTypeName(), PidFixed::TYPE_NAME ) == 0 );
+        REQUIRE( strcmp( component->getTypeGuid(), PidFixed::GUID_STRING ) == 0 );
+        REQUIRE( component->resolveReferences( pointDb ) == Fxt::Component::fullErr( Fxt::Component::Err_T::UNRESOLVED_INPUT_REFRENCE ) );
+
+        uut.destroy( *component );
+    }
+
+    SECTION( "execute component" )
+    {
+        Fxt::Component::Api* component = uut.create( componentObj,
+                                                     componentErrorCode,
+                                                     generalAllocator,
+                                                     haAllocator,
+                                                     pointFactoryDb,
+                                                     pointDb );
+        REQUIRE( component != nullptr );
+        REQUIRE( componentErrorCode == Fxt::Type::Error::SUCCESS() );
+
+        Fxt::Point::Int32* ptPv  = new(std::nothrow) Fxt::Point::Int32( pointDb, POINT_ID__PV, statefulAllocator );
+        Fxt::Point::Int32* ptSp  = new(std::nothrow) Fxt::Point::Int32( pointDb, POINT_ID__SP, statefulAllocator );
+        Fxt::Point::Bool*  ptRst = new(std::nothrow) Fxt::Point::Bool( pointDb, POINT_ID__RST, statefulAllocator );
+        Fxt::Point::Float* ptOut = new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__OUT, statefulAllocator );
+
+        Fxt::Type::Error errCode = component->resolveReferences( pointDb );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( errCode, buf )) );
+        REQUIRE( errCode == Fxt::Type::Error::SUCCESS() );
+
+        int64_t nowUsec = 0;
+        REQUIRE( component->start( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+
+        // Invalid inputs
+        REQUIRE( component->execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->isNotValid() );
+
+        // P only on the first cycle
+        ptPv->write( 10 );
+        ptSp->write( 15 );
+        REQUIRE( component->execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 10.0F ) );
+
+        // P + I (PV is not changing -->no D term)
+        nowUsec += ONE_SECOND_USEC;
+        REQUIRE( component->execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 15.0F ) );
+
+        // D term opposes a change in PV
+        ptPv->write( 11 );
+        nowUsec += ONE_SECOND_USEC;
+        REQUIRE( component->execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("out=%g", value) );
+        REQUIRE( value < 8.0F + 4.0F + 5.0F );   // P + I(5+4) - D
+        REQUIRE( value > 8.0F + 4.0F );
+
+        // Saturate low
+        ptSp->write( -1000 );
+        for ( int i=0; i < 100; i++ )
+        {
+            nowUsec += ONE_SECOND_USEC;
+            REQUIRE( component->execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        }
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, -100.0F ) );
+
+        // Reset (rising edge)
+        ptRst->write( true );
+        ptSp->write( 11 );
+        nowUsec += ONE_SECOND_USEC;
+        REQUIRE( component->execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 0.0F ) );
+
+        // No reset when RST stays true
+        ptSp->write( 12 );
+        nowUsec += ONE_SECOND_USEC;
+        REQUIRE( component->execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 3.0F ) );
+
+        // Invalid PV
+        ptPv->setInvalid();
+        REQUIRE( component->execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->isNotValid() );
+
+        uut.destroy( *component );
+    }
+
+    SECTION( "benchmark" )
+    {
+        Fxt::Component::Api* component = uut.create( componentObj,
+                                                     componentErrorCode,
+                                                     generalAllocator,
+                                                     haAllocator,
+                                                     pointFactoryDb,
+                                                     pointDb );
+        REQUIRE( component != nullptr );
+        Fxt::Point::Int32* ptPv = new(std::nothrow) Fxt::Point::Int32( pointDb, POINT_ID__PV, statefulAllocator );
+        Fxt::Point::Int32* ptSp = new(std::nothrow) Fxt::Point::Int32( pointDb, POINT_ID__SP, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Bool( pointDb, POINT_ID__RST, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__OUT, statefulAllocator );
+        REQUIRE( component->resolveReferences( pointDb ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( component->start( 0 ) == Fxt::Type::Error::SUCCESS() );
+        ptPv->write( 10 );
+        ptSp->write( 15 );
+
+        // Only the execute() calls are timed
+        uint64_t start = Fxt::System::ElapsedTime::nowInRealTime();
+        for ( int64_t i=1; i <= BENCHMARK_ITERATIONS; i++ )
+        {
+            component->execute( i * 1000 );   // 1kHz loop
+        }
+        uint64_t elapsed = Fxt::System::ElapsedTime::delta( start, Fxt::System::ElapsedTime::nowInRealTime() );
+        uint64_t nsecPerCall = (elapsed * 1000) / BENCHMARK_ITERATIONS;
+        printf( "\nPidFixed::execute(): %llu ns per call, target=%d ns (%d iterations)\n", (unsigned long long) nsecPerCall, BENCHMARK_TARGET_NSEC, BENCHMARK_ITERATIONS );
+        REQUIRE( nsecPerCall < BENCHMARK_TARGET_NSEC * BENCHMARK_ALLOWANCE );
+
+        uut.destroy( *component );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
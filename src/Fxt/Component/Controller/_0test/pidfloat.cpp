@@ -0,0 +1,361 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Component/Controller/PidFloat.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Float.h"
+#include "Fxt/Point/Bool.h"
+#include "Fxt/Point/Int32.h"
+#include "Fxt/System/ElapsedTime.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/Math/real.h"
+#include <string.h>
+#include <stdio.h>
+
+#define SECT_   "_0test"
+
+///
+using namespace Fxt::Component::Controller;
+
+static const char* COMP_DEFINTION = R"literalString(
+{
+  "components": [
+    {
+      "name": "PID#1",
+      "type": "9a220331-3df9-4fc7-88f3-acb580310be2",
+      "typeName": "Fxt::Component::Controller::PidFloat",
+      "kp": 2.0,
+      "ki": 1.0,
+      "kd": 0.0,
+      "outMin": 0.0,
+      "outMax": 100.0,
+      "inputs": [
+        {
+          "name": "setpoint",
+          "var": "SP",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 1
+        },
+        {
+          "name": "temperature",
+          "var": "PV",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 0
+        },
+        {
+          "name": "manual mode",
+          "var": "MAN",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 2
+        },
+        {
+          "name": "manual value",
+          "var": "MV",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 3
+        }
+      ],
+      "outputs": [
+        {
+          "name": "Output",
+          "var": "OUT",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 4
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static const char* COMP_DEFINTION_MISSING_MV = R"literalString(
+{
+  "components": [
+    {
+      "name": "PID#1",
+      "type": "9a220331-3df9-4fc7-88f3-acb580310be2",
+      "kp": 2.0,
+      "outMin": 0.0,
+      "outMax": 100.0,
+      "inputs": [
+        { "var": "SP", "idRef": 1 },
+        { "var": "PV", "idRef": 0 },
+        { "var": "MAN", "idRef": 2 }
+      ],
+      "outputs": [
+        { "var": "OUT", "idRef": 4 }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+static size_t haHeap_[100];
+
+#define MAX_POINTS              5
+
+#define POINT_ID__PV            0
+#define POINT_ID__SP            1
+#define POINT_ID__MAN           2
+#define POINT_ID__MV            3
+#define POINT_ID__OUT           4
+
+#define ONE_SECOND_USEC         (1000LL * 1000LL)
+
+#define BENCHMARK_ITERATIONS    (1000 * 1000)
+
+/// Target execution time, in nanoseconds, of a single execute() call
+#define BENCHMARK_TARGET_NSEC   100
+
+/// Allowance for the code coverage instrumentation of the unit test builds (i.e. the test fails at 3x the target)
+#define BENCHMARK_ALLOWANCE     3
+
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "PidFloat" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap statefulAllocator( statefulHeap_, sizeof( statefulHeap_ ) );
+    Cpl::Memory::LeanHeap haAllocator( haHeap_, sizeof( haHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> buf;
+    StaticJsonDocument<10240>                          doc;
+    float                                              value;
+
+    SECTION( "create component" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        PidFloat uut( componentObj,
+                      generalAllocator,
+                      haAllocator,
+                      pointFactoryDb,
+                      pointDb );
+
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( uut.getErrorCode(), buf )) );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), PidFloat::GUID_STRING ) == 0 );
+        REQUIRE( strcmp( uut.getTypeName(), PidFloat::TYPE_NAME ) == 0 );
+        REQUIRE( uut.isStarted() == false );
+    }
+
+    SECTION( "create component - missing MV" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION_MISSING_MV );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        PidFloat uut( componentObj,
+                      generalAllocator,
+                      haAllocator,
+                      pointFactoryDb,
+                      pointDb );
+
+        REQUIRE( uut.getErrorCode() == Fxt::Component::fullErr( Fxt::Component::Err_T::MISSING_REQUIRED_FIELD ) );
+    }
+
+    SECTION( "execute component" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        PidFloat uut( componentObj,
+                      generalAllocator,
+                      haAllocator,
+                      pointFactoryDb,
+                      pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        Fxt::Point::Float* ptPv  = new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__PV, statefulAllocator );
+        Fxt::Point::Float* ptSp  = new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__SP, statefulAllocator );
+        Fxt::Point::Bool*  ptMan = new(std::nothrow) Fxt::Point::Bool( pointDb, POINT_ID__MAN, statefulAllocator );
+        Fxt::Point::Float* ptMv  = new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__MV, statefulAllocator );
+        Fxt::Point::Float* ptOut = new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__OUT, statefulAllocator );
+
+        Fxt::Type::Error errCode = uut.resolveReferences( pointDb );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( errCode, buf )) );
+        REQUIRE( errCode == Fxt::Type::Error::SUCCESS() );
+
+        int64_t nowUsec = 0;
+        REQUIRE( uut.start( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.isStarted() == true );
+
+        // Invalid inputs
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->isNotValid() );
+
+        // P only on the first cycle (no elapsed time)
+        ptPv->write( 10.0F );
+        ptSp->write( 15.0F );
+        ptMan->write( false );
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 10.0F ) );
+
+        // P + I (one second)
+        nowUsec += ONE_SECOND_USEC;
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 15.0F ) );
+
+        // Saturate high -->integrator must NOT wind up
+        ptSp->write( 100.0F );
+        for ( int i=0; i < 100; i++ )
+        {
+            nowUsec += ONE_SECOND_USEC;
+            REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        }
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 100.0F ) );
+
+        // Recover from saturation immediately (i.e. integrator stayed at 5)
+        ptSp->write( 10.0F );
+        nowUsec += 1;
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( value < 5.1F );
+
+        // Manual mode
+        ptMan->write( true );
+        ptMv->write( 42.0F );
+        ptSp->write( 12.0F );
+        nowUsec += ONE_SECOND_USEC;
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 42.0F ) );
+
+        // Bumpless transfer back to auto
+        ptMan->write( false );
+        nowUsec += 1;
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( value > 41.9F );
+        REQUIRE( value < 42.1F );
+
+        // Invalid MV in manual mode
+        ptMan->write( true );
+        ptMv->setInvalid();
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->isNotValid() );
+
+        // Stop/Start -->integrator is preserved
+        ptMan->write( false );
+        uut.stop();
+        nowUsec += ONE_SECOND_USEC;
+        REQUIRE( uut.start( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( value > 41.9F );
+        REQUIRE( value < 42.1F );
+    }
+
+    SECTION( "integer point types" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        PidFloat uut( componentObj,
+                      generalAllocator,
+                      haAllocator,
+                      pointFactoryDb,
+                      pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        Fxt::Point::Int32* ptPv  = new(std::nothrow) Fxt::Point::Int32( pointDb, POINT_ID__PV, statefulAllocator );
+        Fxt::Point::Int32* ptSp  = new(std::nothrow) Fxt::Point::Int32( pointDb, POINT_ID__SP, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Bool( pointDb, POINT_ID__MAN, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Int32( pointDb, POINT_ID__MV, statefulAllocator );
+        Fxt::Point::Float* ptOut = new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__OUT, statefulAllocator );
+
+        REQUIRE( uut.resolveReferences( pointDb ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( 0 ) == Fxt::Type::Error::SUCCESS() );
+
+        ptPv->write( -10 );
+        ptSp->write( -5 );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 10.0F ) );
+    }
+
+    SECTION( "mismatched input types" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        PidFloat uut( componentObj,
+                      generalAllocator,
+                      haAllocator,
+                      pointFactoryDb,
+                      pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        new(std::nothrow) Fxt::Point::Int32( pointDb, POINT_ID__PV, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__SP, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Bool( pointDb, POINT_ID__MAN, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Int32( pointDb, POINT_ID__MV, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__OUT, statefulAllocator );
+
+        REQUIRE( uut.resolveReferences( pointDb ) == Fxt::Component::fullErr( Fxt::Component::Err_T::INPUT_REFRENCE_BAD_TYPE ) );
+    }
+
+    SECTION( "benchmark" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        PidFloat uut( componentObj,
+                      generalAllocator,
+                      haAllocator,
+                      pointFactoryDb,
+                      pointDb );
+        Fxt::Point::Float* ptPv  = new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__PV, statefulAllocator );
+        Fxt::Point::Float* ptSp  = new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__SP, statefulAllocator );
+        Fxt::Point::Bool*  ptMan = new(std::nothrow) Fxt::Point::Bool( pointDb, POINT_ID__MAN, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__MV, statefulAllocator );
+        new(std::nothrow) Fxt::Point::Float( pointDb, POINT_ID__OUT, statefulAllocator );
+        REQUIRE( uut.resolveReferences( pointDb ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( 0 ) == Fxt::Type::Error::SUCCESS() );
+        ptPv->write( 10.0F );
+        ptSp->write( 15.0F );
+        ptMan->write( false );
+
+        // Only the execute() calls are timed
+        uint64_t start = Fxt::System::ElapsedTime::nowInRealTime();
+        for ( int64_t i=1; i <= BENCHMARK_ITERATIONS; i++ )
+        {
+            uut.execute( i * 1000 );   // 1kHz loop
+        }
+        uint64_t elapsed = Fxt::System::ElapsedTime::delta( start, Fxt::System::ElapsedTime::nowInRealTime() );
+        uint64_t nsecPerCall = (elapsed * 1000) / BENCHMARK_ITERATIONS;
+        printf( "\nPidFloat::execute(): %llu ns per call, target=%d ns (%d iterations)\n", (unsigned long long) nsecPerCall, BENCHMARK_TARGET_NSEC, BENCHMARK_ITERATIONS );
+        REQUIRE( nsecPerCall < BENCHMARK_TARGET_NSEC * BENCHMARK_ALLOWANCE );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -0,0 +1,192 @@
+#ifndef Fxt_Component_Digital_Edge64_h_
+#define Fxt_Component_Digital_Edge64_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Digital/Packed64Base.h"
+#include <string.h>
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Digital {
+
+
+/** This concrete class implements a Component that detects rising and/or
+    falling edges on up to 64 boolean inputs. The output is true for exactly
+    one execution cycle when the configured edge is detected on its
+    corresponding input.
+
+    IF the Input signal is invalid, THEN its corresponding output signal will
+    be invalid.  In addition, an edge is NOT detected on the first execution 
+    cycle after the input transitions from invalid to valid.
+
+    The component HAS stateful data (allocated on the HA Heap)
+        Previous input values (packed bit set)
+        Previous input valid states (packed bit set)
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+       "name": "Edge#1"                                     // *Text label for the component
+       "type": "320d45c7-4a2f-46b0-8fae-5db1a419b9e3",      // Identifies the card type.  Value comes from the Supported/Available-card-list
+       "typeName": "Fxt::Component::Digital::Edge64"        // *OPTIONAL: Human readable type name
+       "inputs": [                                          // Array of Point references that supply the Component's input values.  Number of elements: 1-64
+          {                                                 // NOTE: Order of the Inputs MUST MATCH the Order of the Outputs
+            "name": "Signal A",                             // *human readable name for the input value
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the input signal
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the input signal
+            "idRef": 4294967295                             // Point ID Reference to the point to read the input value from
+          },
+          ...
+       ],
+       "outputs": [                                         // Array of Point reference where the Component's writes it output values to.  Number of elements: 1-64
+          {                                                 // NOTE: order is IMPORTANT (see comments on the Inputs)
+            "name":"Signal A rising"                        // *Human readable name for the output signal
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the output signal
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the output signal
+            "idRef":4294967295,                             // Point ID reference to the point that is updated with the output value
+            "edge":"rising"                                 // OPTIONAL: (defaults to "rising"). Edge to detect: "rising", "falling", "both"
+          },
+          ...
+       ]
+    }
+
+    *The field is NOT parsed/used by the firmware
+
+    \endcode
+ */
+class Edge64 : public Packed64Base
+{
+protected:
+    /// Stateful data (allocated on the HA heap)
+    struct StateBlock_T
+    {
+        uint64_t prevValues;    //!< Input values from the previous cycle
+        uint64_t prevValid;     //!< Input valid states from the previous cycle
+    };
+
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "320d45c7-4a2f-46b0-8fae-5db1a419b9e3";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Component::Digital::Edge64";
+
+    /// Size (in bytes) of Stateful data that will be allocated on the HA Heap
+    static constexpr const size_t   HA_STATEFUL_HEAP_SIZE = sizeof( StateBlock_T );
+
+public:
+    /// Constructor
+    Edge64( JsonVariant&                       componentObject,
+            Cpl::Memory::ContiguousAllocator&  generalAllocator,
+            Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+            Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+            Fxt::Point::DatabaseApi&           dbForPoints )
+        : Packed64Base()
+        , m_state( nullptr )
+        , m_risingMask( 0 )
+        , m_fallingMask( 0 )
+    {
+        parseConfiguration( generalAllocator, haStatefulDataAllocator, componentObject, 1 );
+    }
+
+public:
+    /// See Fxt::Component::Api
+    const char* getTypeGuid() const noexcept
+    {
+        return GUID_STRING;
+    }
+
+    /// See Fxt::Component::Api
+    const char* getTypeName() const noexcept
+    {
+        return TYPE_NAME;
+    }
+
+    /// See Fxt::Component::Api
+    Fxt::Type::Error execute( int64_t currentTickUsec ) noexcept
+    {
+        // NOTE: The method NEVER fails
+        uint64_t values;
+        uint64_t valid;
+        readInputs( 0, values, valid );
+
+        // Edges are only detected when the input is valid for two consecutive cycles
+        uint64_t bothValid = valid & m_state->prevValid;
+        uint64_t edges     = ((values & ~m_state->prevValues & m_risingMask) | (~values & m_state->prevValues & m_fallingMask)) & bothValid;
+        writeOutputs( edges, valid );
+
+        m_state->prevValues = values;
+        m_state->prevValid  = valid;
+        return Fxt::Type::Error::SUCCESS();
+    }
+
+protected:
+    /// See Fxt::Component::Digital::Packed64Base
+    bool parseChannelConfiguration( unsigned channelIdx, JsonObject& outputObj ) noexcept
+    {
+        uint64_t    bit  = ((uint64_t) 1) << channelIdx;
+        const char* edge = outputObj["edge"] | "rising";
+        if ( strcmp( edge, "rising" ) == 0 )
+        {
+            m_risingMask |= bit;
+        }
+        else if ( strcmp( edge, "falling" ) == 0 )
+        {
+            m_fallingMask |= bit;
+        }
+        else if ( strcmp( edge, "both" ) == 0 )
+        {
+            m_risingMask  |= bit;
+            m_fallingMask |= bit;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    /// See Fxt::Component::Digital::Packed64Base
+    bool allocateStatefulData( Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator ) noexcept
+    {
+        m_state = (StateBlock_T*) haStatefulDataAllocator.allocate( sizeof( StateBlock_T ) );
+        if ( m_state )
+        {
+            memset( m_state, 0, sizeof( StateBlock_T ) );
+        }
+        return m_state != nullptr;
+    }
+
+protected:
+    /// Stateful data
+    StateBlock_T*   m_state;
+
+    /// Channels that detect rising edges
+    uint64_t        m_risingMask;
+
+    /// Channels that detect falling edges
+    uint64_t        m_fallingMask;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,180 @@
+#ifndef Fxt_Component_Digital_Latch64_h_
+#define Fxt_Component_Digital_Latch64_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Digital/Packed64Base.h"
+#include <string.h>
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Digital {
+
+
+/** This concrete class implements a Component that contains up to 64 SR
+    (Set-Reset) latches.  Each latch has two inputs (S and R) and one output
+    (Q).  By default the latches are 'reset dominant', i.e. Q is false when
+    both S and R are true.  A latch can be configured to be 'set dominant'.
+
+        Reset dominant: Q := (Q OR S) AND NOT R
+        Set dominant:   Q := S OR (Q AND NOT R)
+
+    IF either of a latch's inputs is invalid, THEN its output signal will be
+    invalid and the latch's state is NOT changed.
+
+    The component HAS stateful data (allocated on the HA Heap)
+        Latch states (packed bit set)
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+       "name": "Latch#1"                                    // *Text label for the component
+       "type": "778b7f76-3173-41fd-a72b-be241f1f9263",      // Identifies the card type.  Value comes from the Supported/Available-card-list
+       "typeName": "Fxt::Component::Digital::Latch64"       // *OPTIONAL: Human readable type name
+       "inputs": [                                          // Array of Point references that supply the Component's input values.  Number of elements: 2-128
+          {                                                 // NOTE: The inputs are pairs of S and R, i.e. S0, R0, S1, R1, ... The pairs are in the same order as the outputs
+            "name": "Set A",                                // *human readable name for the input value
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the input signal
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the input signal
+            "idRef": 4294967295                             // Point ID Reference to the point to read the input value from
+          },
+          {
+            "name": "Reset A",                              // *human readable name for the input value
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the input signal
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the input signal
+            "idRef": 4294967295                             // Point ID Reference to the point to read the input value from
+          },
+          ...
+       ],
+       "outputs": [                                         // Array of Point reference where the Component's writes it output values to.  Number of elements: 1-64
+          {                                                 // NOTE: order is IMPORTANT (see comments on the Inputs)
+            "name":"Q A"                                    // *Human readable name for the output signal
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the output signal
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the output signal
+            "idRef":4294967295,                             // Point ID reference to the point that is updated with the output value
+            "setDominant":false                             // OPTIONAL: (defaults to false) When true the latch is set dominant
+          },
+          ...
+       ]
+    }
+
+    *The field is NOT parsed/used by the firmware
+
+    \endcode
+ */
+class Latch64 : public Packed64Base
+{
+protected:
+    /// Stateful data (allocated on the HA heap)
+    struct StateBlock_T
+    {
+        uint64_t q;             //!< Latch states
+    };
+
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "778b7f76-3173-41fd-a72b-be241f1f9263";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Component::Digital::Latch64";
+
+    /// Size (in bytes) of Stateful data that will be allocated on the HA Heap
+    static constexpr const size_t   HA_STATEFUL_HEAP_SIZE = sizeof( StateBlock_T );
+
+public:
+    /// Constructor
+    Latch64( JsonVariant&                       componentObject,
+             Cpl::Memory::ContiguousAllocator&  generalAllocator,
+             Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+             Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+             Fxt::Point::DatabaseApi&           dbForPoints )
+        : Packed64Base()
+        , m_state( nullptr )
+        , m_setDominantMask( 0 )
+    {
+        parseConfiguration( generalAllocator, haStatefulDataAllocator, componentObject, 2 );
+    }
+
+public:
+    /// See Fxt::Component::Api
+    const char* getTypeGuid() const noexcept
+    {
+        return GUID_STRING;
+    }
+
+    /// See Fxt::Component::Api
+    const char* getTypeName() const noexcept
+    {
+        return TYPE_NAME;
+    }
+
+    /// See Fxt::Component::Api
+    Fxt::Type::Error execute( int64_t currentTickUsec ) noexcept
+    {
+        // NOTE: The method NEVER fails
+        uint64_t s, sValid;
+        uint64_t r, rValid;
+        readInputs( 0, s, sValid );
+        readInputs( 1, r, rValid );
+
+        // Only update the latches that have valid inputs
+        uint64_t valid = sValid & rValid;
+        uint64_t q     = m_state->q;
+        uint64_t newQ  = (s & m_setDominantMask) | ((q | s) & ~r);
+        m_state->q     = (newQ & valid) | (q & ~valid);
+
+        writeOutputs( m_state->q, valid );
+        return Fxt::Type::Error::SUCCESS();
+    }
+
+protected:
+    /// See Fxt::Component::Digital::Packed64Base
+    bool parseChannelConfiguration( unsigned channelIdx, JsonObject& outputObj ) noexcept
+    {
+        if ( outputObj["setDominant"] | false )
+        {
+            m_setDominantMask |= ((uint64_t) 1) << channelIdx;
+        }
+        return true;
+    }
+
+    /// See Fxt::Component::Digital::Packed64Base
+    bool allocateStatefulData( Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator ) noexcept
+    {
+        m_state = (StateBlock_T*) haStatefulDataAllocator.allocate( sizeof( StateBlock_T ) );
+        if ( m_state )
+        {
+            memset( m_state, 0, sizeof( StateBlock_T ) );
+        }
+        return m_state != nullptr;
+    }
+
+protected:
+    /// Stateful data
+    StateBlock_T*   m_state;
+
+    /// Channels that are set dominant
+    uint64_t        m_setDominantMask;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,164 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Packed64Base.h"
+#include "Cpl/System/Assert.h"
+#include "Fxt/Point/Bool.h"
+
+///
+using namespace Fxt::Component::Digital;
+
+
+///////////////////////////////////////////////////////////////////////////////
+Packed64Base::Packed64Base()
+    : Common_()
+    , m_channelMask( 0 )
+    , m_prevTickMsec( 0 )
+    , m_numChannels( 0 )
+    , m_inputsPerChannel( 1 )
+{
+    // Child class does all of the work
+}
+
+Packed64Base::~Packed64Base()
+{
+    // Nothing required
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Fxt::Type::Error Packed64Base::start( uint64_t currentElapsedTimeUsec ) noexcept
+{
+    // NOTE: The stateful data is NOT reset when started.  This allows a 
+    //       'standby' node to resume with the HA state from the primary node.
+    m_prevTickMsec = (int64_t) (currentElapsedTimeUsec / 1000);
+    return Common_::start( currentElapsedTimeUsec );
+}
+
+uint32_t Packed64Base::deltaMsec( int64_t currentTickUsec ) noexcept
+{
+    int64_t  nowMsec = currentTickUsec / 1000;
+    uint32_t delta   = nowMsec > m_prevTickMsec ? (uint32_t) (nowMsec - m_prevTickMsec) : 0;
+    m_prevTickMsec   = nowMsec;
+    return delta;
+}
+
+void Packed64Base::readInputs( unsigned inputOffset, uint64_t& dstValues, uint64_t& dstValid ) noexcept
+{
+    uint64_t           values = 0;
+    uint64_t           valid  = 0;
+    uint64_t           bit    = 1;
+    Fxt::Point::Api**  refs   = m_inputRefs + inputOffset;
+    for ( unsigned i=0; i < m_numChannels; i++, bit <<= 1, refs += m_inputsPerChannel )
+    {
+        bool val;
+        if ( ((Fxt::Point::Bool*) *refs)->read( val ) )
+        {
+            valid  |= bit;
+            values |= val ? bit : 0;
+        }
+    }
+
+    dstValues = values;
+    dstValid  = valid;
+}
+
+void Packed64Base::writeOutputs( uint64_t values, uint64_t valid ) noexcept
+{
+    uint64_t bit = 1;
+    for ( unsigned i=0; i < m_numChannels; i++, bit <<= 1 )
+    {
+        if ( valid & bit )
+        {
+            ((Fxt::Point::Bool*) m_outputRefs[i])->write( (values & bit) != 0 );
+        }
+        else
+        {
+            m_outputRefs[i]->setInvalid();
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Packed64Base::parseConfiguration( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                       Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator,
+                                       JsonVariant&                      obj,
+                                       unsigned                          inputsPerChannel ) noexcept
+{
+    // Parse references
+    m_inputsPerChannel = inputsPerChannel;
+    if ( !parseInputReferences( generalAllocator, obj, inputsPerChannel, MAX_CHANNELS * inputsPerChannel ) ||
+         !parseOutputReferences( generalAllocator, obj, 1, MAX_CHANNELS ) )
+    {
+        return false;
+    }
+
+    // The number of inputs must match the number of outputs
+    if ( m_numInputs != m_numOutputs * inputsPerChannel )
+    {
+        m_error = fullErr( Err_T::MISMATCHED_INPUTS_OUTPUTS );
+        m_error.logIt( "%s. in=%u, out=%u", getTypeName(), m_numInputs, m_numOutputs );
+        return false;
+    }
+    m_numChannels = m_numOutputs;
+    m_channelMask = m_numChannels == MAX_CHANNELS ? ~((uint64_t) 0) : (((uint64_t) 1) << m_numChannels) - 1;
+
+    // Parse the per-channel configuration
+    JsonArray outputs = obj["outputs"];
+    for ( unsigned i=0; i < m_numChannels; i++ )
+    {
+        JsonObject outputObj = outputs[i];
+        if ( !parseChannelConfiguration( i, outputObj ) )
+        {
+            m_error = fullErr( Err_T::MISSING_REQUIRED_FIELD );
+            m_error.logIt( "%s. Bad channel config (%u)", getTypeName(), i );
+            return false;
+        }
+    }
+
+    // Allocate my stateful data
+    if ( !allocateStatefulData( haStatefulDataAllocator ) )
+    {
+        m_error = fullErr( Err_T::OUT_OF_MEMORY );
+        m_error.logIt( "%s. Stateful Allocator", getTypeName() );
+        return false;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Fxt::Type::Error Packed64Base::resolveReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept
+{
+    // Resolve references
+    if ( !resolveInputOutputReferences( pointDb ) )
+    {
+        return m_error;
+    }
+
+    // Validate Point types
+    if ( Fxt::Point::Api::validatePointTypes( m_inputRefs, m_numInputs, Fxt::Point::Bool::GUID_STRING ) == false )
+    {
+        m_error = fullErr( Err_T::INPUT_REFRENCE_BAD_TYPE );
+        m_error.logIt( getTypeName() );
+        return m_error;
+    }
+    if ( Fxt::Point::Api::validatePointTypes( m_outputRefs, m_numOutputs, Fxt::Point::Bool::GUID_STRING ) == false )
+    {
+        m_error = fullErr( Err_T::OUTPUT_REFRENCE_BAD_TYPE );
+        m_error.logIt( getTypeName() );
+        return m_error;
+    }
+
+    m_error = Fxt::Type::Error::SUCCESS();   // Set my state to 'ready-to-start'
+    return m_error;
+}
@@ -0,0 +1,112 @@
+#ifndef Fxt_Component_Digital_Packed64Base_h_
+#define Fxt_Component_Digital_Packed64Base_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Common_.h"
+#include "Cpl/Json/Arduino.h"
+#include "Fxt/Point/FactoryDatabaseApi.h"
+#include <stdint.h>
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Digital {
+
+
+/** This partially concrete class provides the common infrastructure for
+    Components that operate on up to 64 independent boolean 'channels' where
+    the per-channel logic is evaluated using word-wide (i.e. 64 bit) bit
+    operations.  Each channel has one output and 'inputsPerChannel' inputs.
+    The input references are ordered by channel, i.e. the inputs for channel
+    0 are first, followed by the inputs for channel 1, etc.
+
+    All input and output Points MUST be of type Fxt::Point::Bool.
+
+    The child class is responsible for allocating its (packed) stateful data
+    from the HA Heap.
+ */
+class Packed64Base : public Fxt::Component::Common_
+{
+public:
+    /// Maximum number of channels
+    static constexpr unsigned MAX_CHANNELS = 64;
+
+protected:
+    /// Constructor
+    Packed64Base();
+
+    /// Destructor
+    ~Packed64Base();
+
+public:
+    /// See Fxt::Component::Api
+    Fxt::Type::Error start( uint64_t currentElapsedTimeUsec ) noexcept;
+
+    /// See Fxt::Component::Api
+    Fxt::Type::Error resolveReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept;
+
+protected:
+    /// Helper method to parse the card's JSON config
+    bool parseConfiguration( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                             Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator,
+                             JsonVariant&                      obj,
+                             unsigned                          inputsPerChannel ) noexcept;
+
+    /** Helper method that parses the per-channel configuration from the
+        channel's output JSON object. Returns false if there is an error
+     */
+    virtual bool parseChannelConfiguration( unsigned channelIdx, JsonObject& outputObj ) noexcept = 0;
+
+    /// Helper method that allocates (and zeros) the stateful data from the HA heap
+    virtual bool allocateStatefulData( Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator ) noexcept = 0;
+
+protected:
+    /** Helper method that reads the inputs with index 'inputOffset' (within
+        each channel) of all channels into packed bit sets.  Bit N corresponds
+        to channel N.
+     */
+    void readInputs( unsigned inputOffset, uint64_t& dstValues, uint64_t& dstValid ) noexcept;
+
+    /** Helper method that writes all of the output points from packed bit
+        sets. Outputs whose 'valid' bit is zero are set to invalid.
+     */
+    void writeOutputs( uint64_t values, uint64_t valid ) noexcept;
+
+    /** Helper method that returns the number of whole milliseconds that have
+        elapsed since the previous call (or since the component was started)
+     */
+    uint32_t deltaMsec( int64_t currentTickUsec ) noexcept;
+
+protected:
+    /// Bit mask with a bit set for each channel
+    uint64_t    m_channelMask;
+
+    /// Elapsed time (in milliseconds) of the previous execution cycle
+    int64_t     m_prevTickMsec;
+
+    /// Number of channels
+    unsigned    m_numChannels;
+
+    /// Number of inputs per channel
+    unsigned    m_inputsPerChannel;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -23,11 +23,19 @@
 #include "Fxt/Component/Digital/Not64GateFactory.h"
 #include "Fxt/Component/Digital/Demux8Uint8Factory.h"
 #include "Fxt/Component/Digital/Mux8Uint8Factory.h"
+#include "Fxt/Component/Digital/Edge64Factory.h"
+#include "Fxt/Component/Digital/Latch64Factory.h"
+#include "Fxt/Component/Digital/TimerOn64Factory.h"
+#include "Fxt/Component/Digital/TimerOff64Factory.h"
 
 static Fxt::Component::Digital::And8GateFactory             and8GateFactory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
 static Fxt::Component::Digital::Not64GateFactory            not64GateFactory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
 static Fxt::Component::Digital::Demux8Uint8Factory          demux8Uint8Factory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
 static Fxt::Component::Digital::Mux8Uint8Factory            mux8Uint8Factory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
+static Fxt::Component::Digital::Edge64Factory               edge64Factory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
+static Fxt::Component::Digital::Latch64Factory              latch64Factory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
+static Fxt::Component::Digital::TimerOn64Factory            timerOn64Factory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
+static Fxt::Component::Digital::TimerOff64Factory           timerOff64Factory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
 
 
 #endif  // end header latch
@@ -0,0 +1,58 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Timer64Base.h"
+#include <string.h>
+
+///
+using namespace Fxt::Component::Digital;
+
+
+///////////////////////////////////////////////////////////////////////////////
+Timer64Base::Timer64Base()
+    : Packed64Base()
+    , m_state( nullptr )
+    , m_defaultDelayMs( 0 )
+{
+    memset( m_delayMs, 0, sizeof( m_delayMs ) );
+}
+
+Timer64Base::~Timer64Base()
+{
+    // Nothing required
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Timer64Base::parseTimerConfiguration( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                           Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator,
+                                           JsonVariant&                      obj ) noexcept
+{
+    m_defaultDelayMs = obj["delayMs"] | 0U;
+    return parseConfiguration( generalAllocator, haStatefulDataAllocator, obj, 1 );
+}
+
+bool Timer64Base::parseChannelConfiguration( unsigned channelIdx, JsonObject& outputObj ) noexcept
+{
+    m_delayMs[channelIdx] = outputObj["delayMs"] | m_defaultDelayMs;
+    return true;
+}
+
+bool Timer64Base::allocateStatefulData( Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator ) noexcept
+{
+    m_state = (StateBlock_T*) haStatefulDataAllocator.allocate( sizeof( StateBlock_T ) );
+    if ( m_state )
+    {
+        memset( m_state, 0, sizeof( StateBlock_T ) );
+    }
+    return m_state != nullptr;
+}
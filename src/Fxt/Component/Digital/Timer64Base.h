@@ -0,0 +1,105 @@
+#ifndef Fxt_Component_Digital_Timer64Base_h_
+#define Fxt_Component_Digital_Timer64Base_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Digital/Packed64Base.h"
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Digital {
+
+
+/** This partially concrete class provides the common infrastructure for
+    Components that implement up to 64 independent timers, i.e. one timer per
+    channel. Each channel has one input and one output.
+
+    Each timer has a delay (in milliseconds).  The component level "delayMs"
+    field is the default delay for all channels, which can be overridden by
+    the "delayMs" field of an individual output.
+
+    The timers accumulate elapsed time (instead of storing absolute time
+    stamps) so that the stateful data is meaningful after a fail-over to a
+    node with a different time base.
+
+    The component HAS stateful data (allocated on the HA Heap)
+        Timer outputs (packed bit set)
+        Accumulated elapsed time (in milliseconds) per channel
+ */
+class Timer64Base : public Packed64Base
+{
+protected:
+    /// Stateful data (allocated on the HA heap)
+    struct StateBlock_T
+    {
+        uint64_t q;                         //!< Timer outputs
+        uint32_t elapsedMs[MAX_CHANNELS];   //!< Accumulated elapsed time per channel
+    };
+
+public:
+    /// Size (in bytes) of Stateful data that will be allocated on the HA Heap
+    static constexpr const size_t   HA_STATEFUL_HEAP_SIZE = sizeof( StateBlock_T );
+
+protected:
+    /// Constructor
+    Timer64Base();
+
+    /// Destructor
+    ~Timer64Base();
+
+protected:
+    /// Helper method to parse the card's JSON config
+    bool parseTimerConfiguration( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                  Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator,
+                                  JsonVariant&                      obj ) noexcept;
+
+    /// See Fxt::Component::Digital::Packed64Base
+    bool parseChannelConfiguration( unsigned channelIdx, JsonObject& outputObj ) noexcept;
+
+    /// See Fxt::Component::Digital::Packed64Base
+    bool allocateStatefulData( Cpl::Memory::ContiguousAllocator& haStatefulDataAllocator ) noexcept;
+
+protected:
+    /** Helper method that adds 'deltaMs' to the channel's accumulated time
+        (saturating at the channel's delay).  Returns true if the channel's
+        delay has expired.
+     */
+    inline bool accumulate( unsigned channelIdx, uint32_t deltaMs ) noexcept
+    {
+        uint32_t elapsed = m_state->elapsedMs[channelIdx];
+        uint32_t delay   = m_delayMs[channelIdx];
+        elapsed          = delay - elapsed > deltaMs ? elapsed + deltaMs : delay;
+        m_state->elapsedMs[channelIdx] = elapsed;
+        return elapsed >= delay;
+    }
+
+protected:
+    /// Stateful data
+    StateBlock_T*   m_state;
+
+    /// Default delay
+    uint32_t        m_defaultDelayMs;
+
+    /// Per channel delays
+    uint32_t        m_delayMs[MAX_CHANNELS];
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,144 @@
+#ifndef Fxt_Component_Digital_TimerOn64_h_
+#define Fxt_Component_Digital_TimerOn64_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Digital/Timer64Base.h"
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Digital {
+
+
+/** This concrete class implements a Component that contains up to 64 'on
+    delay' timers (TON).  A channel's output becomes true once its input has
+    been continuously true for the channel's delay.  The output becomes false
+    immediately when the input is false.
+
+    IF the Input signal is invalid, THEN its corresponding output signal will
+    be invalid and the channel's timer is reset.
+
+    The component HAS stateful data (allocated on the HA Heap).  See
+    Fxt::Component::Digital::Timer64Base
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+       "name": "TON#1"                                      // *Text label for the component
+       "type": "01243a54-3388-46dd-9798-af9c81869fe3",      // Identifies the card type.  Value comes from the Supported/Available-card-list
+       "typeName": "Fxt::Component::Digital::TimerOn64"     // *OPTIONAL: Human readable type name
+       "delayMs": 1000,                                     // OPTIONAL: (defaults to 0) Default timer delay, in milliseconds, for all channels
+       "inputs": [                                          // Array of Point references that supply the Component's input values.  Number of elements: 1-64
+          {                                                 // NOTE: Order of the Inputs MUST MATCH the Order of the Outputs
+            "name": "Signal A",                             // *human readable name for the input value
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the input signal
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the input signal
+            "idRef": 4294967295                             // Point ID Reference to the point to read the input value from
+          },
+          ...
+       ],
+       "outputs": [                                         // Array of Point reference where the Component's writes it output values to.  Number of elements: 1-64
+          {                                                 // NOTE: order is IMPORTANT (see comments on the Inputs)
+            "name":"Delayed Signal A"                       // *Human readable name for the output signal
+            "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", // REQUIRED Type for the output signal
+            "typeName": "Fxt::Point::Bool",                 // *OPTIONAL: Human readable Type name for the output signal
+            "idRef":4294967295,                             // Point ID reference to the point that is updated with the output value
+            "delayMs":250                                   // OPTIONAL: Overrides the component's default delay for this channel
+          },
+          ...
+       ]
+    }
+
+    *The field is NOT parsed/used by the firmware
+
+    \endcode
+ */
+class TimerOn64 : public Timer64Base
+{
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "01243a54-3388-46dd-9798-af9c81869fe3";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Component::Digital::TimerOn64";
+
+public:
+    /// Constructor
+    TimerOn64( JsonVariant&                       componentObject,
+           Cpl::Memory::ContiguousAllocator&  generalAllocator,
+           Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+           Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+           Fxt::Point::DatabaseApi&           dbForPoints )
+        : Timer64Base()
+    {
+        parseTimerConfiguration( generalAllocator, haStatefulDataAllocator, componentObject );
+    }
+
+public:
+    /// See Fxt::Component::Api
+    const char* getTypeGuid() const noexcept
+    {
+        return GUID_STRING;
+    }
+
+    /// See Fxt::Component::Api
+    const char* getTypeName() const noexcept
+    {
+        return TYPE_NAME;
+    }
+
+    /// See Fxt::Component::Api
+    Fxt::Type::Error execute( int64_t currentTickUsec ) noexcept
+    {
+        // NOTE: The method NEVER fails
+        uint32_t elapsedMs = deltaMsec( currentTickUsec );
+        uint64_t values;
+        uint64_t valid;
+        readInputs( 0, values, valid );
+
+        // Only the channels whose input is (valid) true are timing
+        uint64_t active = values & valid;
+        uint64_t q      = 0;
+        uint64_t bit    = 1;
+        for ( unsigned i=0; i < m_numChannels; i++, bit <<= 1 )
+        {
+            if ( active & bit )
+            {
+                if ( accumulate( i, elapsedMs ) )
+                {
+                    q |= bit;
+                }
+            }
+            else
+            {
+                m_state->elapsedMs[i] = 0;
+            }
+        }
+
+        m_state->q = q;
+        writeOutputs( q, valid );
+        return Fxt::Type::Error::SUCCESS();
+    }
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,230 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Component/Digital/Edge64.h"
+#include "Fxt/Point/Bool.h"
+#include "Fxt/Point/Database.h"
+#include "Cpl/System/Trace.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+/// 
+using namespace Fxt::Component::Digital;
+
+
+static const char* COMP_DEFINTION = R"literalString(
+{
+  "components": [
+    {
+      "name": "EDGE",
+      "type": "320d45c7-4a2f-46b0-8fae-5db1a419b9e3",
+      "typeName": "Fxt::Component::Digital::Edge64",
+      "inputs": [
+        {
+          "name": "IN 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 0
+        },
+        {
+          "name": "IN 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 1
+        },
+        {
+          "name": "IN 2",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 2
+        }
+      ],
+      "outputs": [
+        {
+          "name": "OUT 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 3
+        },
+        {
+          "name": "OUT 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 4,
+          "edge": "falling"
+        },
+        {
+          "name": "OUT 2",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 5,
+          "edge": "both"
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static const char* COMP_DEFINTION_BAD_EDGE = R"literalString(
+{
+  "components": [
+    {
+      "name": "EDGE",
+      "type": "320d45c7-4a2f-46b0-8fae-5db1a419b9e3",
+      "typeName": "Fxt::Component::Digital::Edge64",
+      "inputs": [
+        {
+          "name": "IN 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 0
+        }
+      ],
+      "outputs": [
+        {
+          "name": "OUT 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 3,
+          "edge": "sideways"
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+
+#define MAX_POINTS      6
+
+static bool readOut( Fxt::Point::Bool* pt )
+{
+    bool val = false;
+    REQUIRE( pt->read( val ) );
+    return val;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Edge64" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap generalAllocator(            generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap statefulAllocator(           statefulHeap_, sizeof( statefulHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> buf;
+    StaticJsonDocument<10240>                          doc;
+
+    SECTION( "create component" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        Edge64 uut( componentObj, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), Edge64::GUID_STRING ) == 0 );
+        REQUIRE( strcmp( uut.getTypeName(), Edge64::TYPE_NAME ) == 0 );
+        REQUIRE( uut.isStarted() == false );
+    }
+
+    SECTION( "bad edge" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION_BAD_EDGE );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        Edge64 uut( componentObj, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( uut.getErrorCode() == fullErr( Fxt::Component::Err_T::MISSING_REQUIRED_FIELD ) );
+    }
+
+    SECTION( "execute" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        Edge64 uut( componentObj, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        Fxt::Point::Bool* in[3];
+        Fxt::Point::Bool* out[3];
+        for ( unsigned i=0; i < 3; i++ )
+        {
+            in[i]  = new(std::nothrow) Fxt::Point::Bool( pointDb, i, statefulAllocator );
+            out[i] = new(std::nothrow) Fxt::Point::Bool( pointDb, i + 3, statefulAllocator );
+        }
+
+        Fxt::Type::Error errCode = uut.resolveReferences( pointDb );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( errCode, buf )) );
+        REQUIRE( errCode == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( 0 ) == Fxt::Type::Error::SUCCESS() );
+
+        // Invalid inputs
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( out[0]->isNotValid() );
+        REQUIRE( out[1]->isNotValid() );
+        REQUIRE( out[2]->isNotValid() );
+
+        // Transition from invalid to valid is NOT an edge
+        for ( unsigned i=0; i < 3; i++ )
+        {
+            in[i]->write( true );
+        }
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out[0] ) == false );
+        REQUIRE( readOut( out[1] ) == false );
+        REQUIRE( readOut( out[2] ) == false );
+
+        // Falling edge
+        for ( unsigned i=0; i < 3; i++ )
+        {
+            in[i]->write( false );
+        }
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out[0] ) == false );
+        REQUIRE( readOut( out[1] ) == true );
+        REQUIRE( readOut( out[2] ) == true );
+
+        // No change -->single cycle pulse
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out[0] ) == false );
+        REQUIRE( readOut( out[1] ) == false );
+        REQUIRE( readOut( out[2] ) == false );
+
+        // Rising edge
+        for ( unsigned i=0; i < 3; i++ )
+        {
+            in[i]->write( true );
+        }
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out[0] ) == true );
+        REQUIRE( readOut( out[1] ) == false );
+        REQUIRE( readOut( out[2] ) == true );
+
+        // Invalid input
+        in[0]->setInvalid();
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( out[0]->isNotValid() );
+        REQUIRE( readOut( out[2] ) == false );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
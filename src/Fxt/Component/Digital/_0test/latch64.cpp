@@ -0,0 +1,246 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Component/Digital/Latch64.h"
+#include "Fxt/Point/Bool.h"
+#include "Fxt/Point/Database.h"
+#include "Cpl/System/Trace.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+/// 
+using namespace Fxt::Component::Digital;
+
+
+static const char* COMP_DEFINTION = R"literalString(
+{
+  "components": [
+    {
+      "name": "LATCH",
+      "type": "778b7f76-3173-41fd-a72b-be241f1f9263",
+      "typeName": "Fxt::Component::Digital::Latch64",
+      "inputs": [
+        {
+          "name": "IN 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 0
+        },
+        {
+          "name": "IN 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 1
+        },
+        {
+          "name": "IN 2",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 2
+        },
+        {
+          "name": "IN 3",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 3
+        }
+      ],
+      "outputs": [
+        {
+          "name": "OUT 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 4
+        },
+        {
+          "name": "OUT 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 5,
+          "setDominant": true
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static const char* COMP_DEFINTION_MISMATCHED = R"literalString(
+{
+  "components": [
+    {
+      "name": "LATCH",
+      "type": "778b7f76-3173-41fd-a72b-be241f1f9263",
+      "typeName": "Fxt::Component::Digital::Latch64",
+      "inputs": [
+        {
+          "name": "IN 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 0
+        },
+        {
+          "name": "IN 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 1
+        },
+        {
+          "name": "IN 2",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 2
+        }
+      ],
+      "outputs": [
+        {
+          "name": "OUT 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 4
+        },
+        {
+          "name": "OUT 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 5
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+
+#define MAX_POINTS      6
+
+static bool readOut( Fxt::Point::Bool* pt )
+{
+    bool val = false;
+    REQUIRE( pt->read( val ) );
+    return val;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Latch64" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap generalAllocator(            generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap statefulAllocator(           statefulHeap_, sizeof( statefulHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> buf;
+    StaticJsonDocument<10240>                          doc;
+
+    SECTION( "create component" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        Latch64 uut( componentObj, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), Latch64::GUID_STRING ) == 0 );
+        REQUIRE( strcmp( uut.getTypeName(), Latch64::TYPE_NAME ) == 0 );
+    }
+
+    SECTION( "mismatched inputs" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION_MISMATCHED );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        Latch64 uut( componentObj, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( uut.getErrorCode() == fullErr( Fxt::Component::Err_T::MISMATCHED_INPUTS_OUTPUTS ) );
+    }
+
+    SECTION( "execute" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        Latch64 uut( componentObj, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        Fxt::Point::Bool* s0  = new(std::nothrow) Fxt::Point::Bool( pointDb, 0, statefulAllocator );
+        Fxt::Point::Bool* r0  = new(std::nothrow) Fxt::Point::Bool( pointDb, 1, statefulAllocator );
+        Fxt::Point::Bool* s1  = new(std::nothrow) Fxt::Point::Bool( pointDb, 2, statefulAllocator );
+        Fxt::Point::Bool* r1  = new(std::nothrow) Fxt::Point::Bool( pointDb, 3, statefulAllocator );
+        Fxt::Point::Bool* q0  = new(std::nothrow) Fxt::Point::Bool( pointDb, 4, statefulAllocator );
+        Fxt::Point::Bool* q1  = new(std::nothrow) Fxt::Point::Bool( pointDb, 5, statefulAllocator );
+
+        Fxt::Type::Error errCode = uut.resolveReferences( pointDb );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( errCode, buf )) );
+        REQUIRE( errCode == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( 0 ) == Fxt::Type::Error::SUCCESS() );
+
+        // Invalid inputs
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( q0->isNotValid() );
+        REQUIRE( q1->isNotValid() );
+
+        // Initial state
+        s0->write( false ); r0->write( false );
+        s1->write( false ); r1->write( false );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( q0 ) == false );
+        REQUIRE( readOut( q1 ) == false );
+
+        // Set
+        s0->write( true );
+        s1->write( true );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( q0 ) == true );
+        REQUIRE( readOut( q1 ) == true );
+
+        // Hold
+        s0->write( false );
+        s1->write( false );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( q0 ) == true );
+        REQUIRE( readOut( q1 ) == true );
+
+        // Both set and reset: reset-dominant vs set-dominant
+        s0->write( true ); r0->write( true );
+        s1->write( true ); r1->write( true );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( q0 ) == false );
+        REQUIRE( readOut( q1 ) == true );
+
+        // Reset
+        s1->write( false );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( q1 ) == false );
+
+        // Invalid input does NOT change the latch state
+        s1->write( true ); r1->write( false );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( q1 ) == true );
+        r1->setInvalid();
+        s1->write( false );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( q1->isNotValid() );
+        r1->write( false );
+        REQUIRE( uut.execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( q1 ) == true );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -0,0 +1,266 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Component/Digital/TimerOn64.h"
+#include "Fxt/Component/Digital/TimerOff64.h"
+#include "Fxt/Point/Bool.h"
+#include "Fxt/Point/Database.h"
+#include "Cpl/System/Trace.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+/// 
+using namespace Fxt::Component::Digital;
+
+
+static const char* TON_DEFINTION = R"literalString(
+{
+  "components": [
+    {
+      "name": "TON",
+      "type": "01243a54-3388-46dd-9798-af9c81869fe3",
+      "typeName": "Fxt::Component::Digital::TimerOn64", "delayMs": 100,
+      "inputs": [
+        {
+          "name": "IN 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 0
+        },
+        {
+          "name": "IN 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 1
+        }
+      ],
+      "outputs": [
+        {
+          "name": "OUT 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 2
+        },
+        {
+          "name": "OUT 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 3,
+          "delayMs": 50
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static const char* TOF_DEFINTION = R"literalString(
+{
+  "components": [
+    {
+      "name": "TOF",
+      "type": "0bc586e8-4891-4086-8957-3ece1af15938",
+      "typeName": "Fxt::Component::Digital::TimerOff64", "delayMs": 100,
+      "inputs": [
+        {
+          "name": "IN 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 0
+        },
+        {
+          "name": "IN 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 1
+        }
+      ],
+      "outputs": [
+        {
+          "name": "OUT 0",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 2
+        },
+        {
+          "name": "OUT 1",
+          "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0",
+          "typeName": "Fxt::Point::Bool",
+          "idRef": 3,
+          "delayMs": 50
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+
+#define MAX_POINTS      4
+
+#define MSEC(n)         ((int64_t)(n) * 1000)
+
+static bool readOut( Fxt::Point::Bool* pt )
+{
+    bool val = false;
+    REQUIRE( pt->read( val ) );
+    return val;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Timer64" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap generalAllocator(            generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap statefulAllocator(           statefulHeap_, sizeof( statefulHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> buf;
+    StaticJsonDocument<10240>                          doc;
+
+    Fxt::Point::Bool* in0  = new(std::nothrow) Fxt::Point::Bool( pointDb, 0, statefulAllocator );
+    Fxt::Point::Bool* in1  = new(std::nothrow) Fxt::Point::Bool( pointDb, 1, statefulAllocator );
+    Fxt::Point::Bool* out0 = new(std::nothrow) Fxt::Point::Bool( pointDb, 2, statefulAllocator );
+    Fxt::Point::Bool* out1 = new(std::nothrow) Fxt::Point::Bool( pointDb, 3, statefulAllocator );
+
+    SECTION( "on delay" )
+    {
+        DeserializationError err = deserializeJson( doc, TON_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        TimerOn64 uut( componentObj, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), TimerOn64::GUID_STRING ) == 0 );
+        REQUIRE( strcmp( uut.getTypeName(), TimerOn64::TYPE_NAME ) == 0 );
+
+        Fxt::Type::Error errCode = uut.resolveReferences( pointDb );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( errCode, buf )) );
+        REQUIRE( errCode == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( MSEC( 1000 ) ) == Fxt::Type::Error::SUCCESS() );
+
+        REQUIRE( uut.execute( MSEC( 1000 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( out0->isNotValid() );
+        REQUIRE( out1->isNotValid() );
+
+        in0->write( true );
+        in1->write( true );
+        REQUIRE( uut.execute( MSEC( 1010 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == false );
+        REQUIRE( readOut( out1 ) == false );
+        REQUIRE( uut.execute( MSEC( 1060 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == false );
+        REQUIRE( readOut( out1 ) == true );
+        REQUIRE( uut.execute( MSEC( 1110 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == true );
+        REQUIRE( readOut( out1 ) == true );
+
+        // Input goes false -->output is immediately false
+        in0->write( false );
+        REQUIRE( uut.execute( MSEC( 1120 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == false );
+        REQUIRE( readOut( out1 ) == true );
+
+        // Timer restarts from zero
+        in0->write( true );
+        REQUIRE( uut.execute( MSEC( 1200 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == false );
+
+        // Invalid input resets the timer
+        in1->setInvalid();
+        REQUIRE( uut.execute( MSEC( 1210 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( out1->isNotValid() );
+        in1->write( true );
+        REQUIRE( uut.execute( MSEC( 1220 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out1 ) == false );
+
+        // Re-start (i.e. fail-over) preserves the accumulated time
+        uut.stop();
+        REQUIRE( uut.start( MSEC( 5000 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.execute( MSEC( 5020 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == true );
+        REQUIRE( readOut( out1 ) == false );
+        REQUIRE( uut.execute( MSEC( 5040 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out1 ) == true );
+    }
+
+    SECTION( "off delay" )
+    {
+        DeserializationError err = deserializeJson( doc, TOF_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        TimerOff64 uut( componentObj, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+        REQUIRE( uut.getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( uut.getTypeGuid(), TimerOff64::GUID_STRING ) == 0 );
+        REQUIRE( strcmp( uut.getTypeName(), TimerOff64::TYPE_NAME ) == 0 );
+
+        Fxt::Type::Error errCode = uut.resolveReferences( pointDb );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( errCode, buf )) );
+        REQUIRE( errCode == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.start( 0 ) == Fxt::Type::Error::SUCCESS() );
+
+        in0->write( false );
+        in1->write( false );
+        REQUIRE( uut.execute( MSEC( 0 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == false );
+        REQUIRE( readOut( out1 ) == false );
+
+        // Input true -->output is immediately true
+        in0->write( true );
+        in1->write( true );
+        REQUIRE( uut.execute( MSEC( 10 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == true );
+        REQUIRE( readOut( out1 ) == true );
+
+        in0->write( false );
+        in1->write( false );
+        REQUIRE( uut.execute( MSEC( 20 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == true );
+        REQUIRE( readOut( out1 ) == true );
+        REQUIRE( uut.execute( MSEC( 70 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == true );
+        REQUIRE( readOut( out1 ) == false );
+        REQUIRE( uut.execute( MSEC( 120 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == false );
+        REQUIRE( readOut( out1 ) == false );
+
+        // A true input re-triggers the timer
+        in0->write( true );
+        REQUIRE( uut.execute( MSEC( 130 ) ) == Fxt::Type::Error::SUCCESS() );
+        in0->write( false );
+        REQUIRE( uut.execute( MSEC( 200 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == true );
+        in0->write( true );
+        REQUIRE( uut.execute( MSEC( 210 ) ) == Fxt::Type::Error::SUCCESS() );
+        in0->write( false );
+        REQUIRE( uut.execute( MSEC( 290 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == true );
+
+        // Invalid input resets the timer
+        in0->setInvalid();
+        REQUIRE( uut.execute( MSEC( 300 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( out0->isNotValid() );
+        in0->write( false );
+        REQUIRE( uut.execute( MSEC( 310 ) ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( readOut( out0 ) == false );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
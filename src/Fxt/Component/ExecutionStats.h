@@ -0,0 +1,63 @@
+#ifndef Fxt_Component_ExecutionStats_h_
+#define Fxt_Component_ExecutionStats_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include <stdint.h>
+#include <string.h>
+
+
+///
+namespace Fxt {
+///
+namespace Component {
+
+
+/** This struct is a compact block of execution statistics (i.e. profiling data)
+    for a single Component.  The statistics are collected by the Component's
+    containing Logic Chain (when profiling is enabled).  All times are in
+    nanoseconds (see Fxt::System::PerfCounter).
+ */
+struct ExecutionStats_T
+{
+    uint64_t totalTime;     //!< Total execution time
+    uint32_t count;         //!< Number of times the Component's execute() method has been called
+    uint32_t maxTime;       //!< Worst case execution time of a single call
+
+    /// Updates the statistics with the execution time of a single execute() call
+    inline void update( uint32_t elapsedTime ) noexcept
+    {
+        totalTime += elapsedTime;
+        count++;
+        if ( elapsedTime > maxTime )
+        {
+            maxTime = elapsedTime;
+        }
+    }
+
+    /// Clears the statistics
+    inline void reset() noexcept
+    {
+        memset( this, 0, sizeof( ExecutionStats_T ) );
+    }
+
+    /// Returns the average execution time (returns zero if there has been no calls)
+    inline uint32_t average() const noexcept
+    {
+        return count == 0 ? 0 : (uint32_t) (totalTime / count);
+    }
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -13,6 +13,7 @@
 
 #include "FactoryDatabase.h"
 #include "Error.h"
+#include "Fxt/System/AllocTag.h"
 #include "Cpl/System/Assert.h"
 
 ///
@@ -54,6 +55,8 @@ Api* FactoryDatabase::createComponentfromJSON( JsonVariant&
         return nullptr;
     }
 
+    // Charge the memory allocations to the sub-system
+    Fxt::System::AllocTag::ScopeBlock allocTag( Fxt::System::AllocTag::eCOMPONENTS );
     return factory->create( componentObj,
                             componentErrorCode,
                             generalAllocator,
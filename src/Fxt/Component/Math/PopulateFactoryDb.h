@@ -20,8 +20,10 @@
 
 
 #include "Fxt/Component/Math/Scaler64FloatFactory.h"
+#include "Fxt/Component/Math/ScalerArrayFloatFactory.h"
 
 static Fxt::Component::Math::Scaler64FloatFactory         scaler64FloatFactory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
+static Fxt::Component::Math::ScalerArrayFloatFactory      scalerArrayFloatFactory_( FXT_MY_APP_COMPONENT_FACTORY_DB );
 
 
 #endif  // end header latch
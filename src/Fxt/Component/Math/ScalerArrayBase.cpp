@@ -0,0 +1,136 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "ScalerArrayBase.h"
+#include <stdint.h>
+
+///
+using namespace Fxt::Component::Math;
+
+
+///////////////////////////////////////////////////////////////////////////////
+ScalerArrayBase::ScalerArrayBase()
+    : Common_()
+    , m_rangeLengths( nullptr )
+    , m_numRanges( 0 )
+{
+    // Child class does all of the work
+}
+
+ScalerArrayBase::~ScalerArrayBase()
+{
+    // Nothing required
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+Fxt::Type::Error ScalerArrayBase::execute( int64_t currentTickUsec ) noexcept
+{
+    // NOTE: The method NEVER fails
+
+    // Scale the inputs (one range at a time)
+    unsigned refIdx = 0;
+    for ( unsigned i=0; i < m_numRanges; i++ )
+    {
+        calculateOutputs( i, refIdx, m_rangeLengths[i] );
+        refIdx += m_rangeLengths[i];
+    }
+
+    return Fxt::Type::Error::SUCCESS();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ScalerArrayBase::parseConfiguration( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                                          JsonVariant&                      obj,
+                                          unsigned                          minInputs,
+                                          unsigned                          maxInputs,
+                                          unsigned                          minOutputs,
+                                          unsigned                          maxOutputs ) noexcept
+{
+    // Parse references
+    if ( !parseInputRangeReferences( generalAllocator, obj, minInputs, maxInputs ) ||
+         !parseOutputRangeReferences( generalAllocator, obj, minOutputs, maxOutputs ) )
+    {
+        if ( m_error == Fxt::Type::Error::SUCCESS() )
+        {
+            m_error = fullErr( Err_T::MISSING_REQUIRED_FIELD );
+            m_error.logIt( getTypeName() );
+        }
+        return false;
+    }
+
+    // The number of inputs must match the number of outputs
+    if ( m_numInputs != m_numOutputs )
+    {
+        m_error = fullErr( Err_T::MISMATCHED_INPUTS_OUTPUTS );
+        m_error.logIt( "%s. in=%u, out=%u", getTypeName(), m_numInputs, m_numOutputs );
+        return false;
+    }
+
+    // Allocate memory for internal lists
+    JsonArray inputs = obj["inputs"];
+    m_numRanges      = (unsigned) inputs.size();
+    m_rangeLengths   = (uint16_t*) generalAllocator.allocate( sizeof( uint16_t ) * m_numRanges );
+    if ( m_rangeLengths == nullptr || allocateKonstants( generalAllocator, m_numRanges ) == false )
+    {
+        m_error = fullErr( Fxt::Component::Err_T::OUT_OF_MEMORY );
+        m_error.logIt( getTypeName() );
+        return false;
+    }
+
+    // Parse the Konstants
+    for ( unsigned i=0; i < m_numRanges; i++ )
+    {
+        JsonObject elem = inputs[i];
+        m_rangeLengths[i] = elem["count"] | 1;      // Note: The range was validated when parsing the references
+
+        // Validate the json
+        if ( elem["m"].isNull() || elem["b"].isNull() ||
+             !parseJsonKonstants( i, elem ) )
+        {
+            m_error = fullErr( Err_T::MISSING_REQUIRED_FIELD );
+            m_error.logIt( getTypeName() );
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+Fxt::Type::Error ScalerArrayBase::resolveReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept
+{
+    // Resolve references
+    if ( !resolveInputOutputReferences( pointDb ) )
+    {
+        return m_error;
+    }
+
+    // Validate Point types
+    if ( !Fxt::Point::Api::validatePointTypes( m_inputRefs, m_numInputs, getPointTypeGuid() ) )
+    {
+        m_error = fullErr( Err_T::INPUT_REFRENCE_BAD_TYPE );
+        m_error.logIt( getTypeName() );
+        return m_error;
+    }
+    if ( !Fxt::Point::Api::validatePointTypes( m_outputRefs, m_numOutputs, getPointTypeGuid() ) )
+    {
+        m_error = fullErr( Err_T::OUTPUT_REFRENCE_BAD_TYPE );
+        m_error.logIt( getTypeName() );
+        return m_error;
+    }
+
+    m_error = Fxt::Type::Error::SUCCESS();   // Set my state to 'ready-to-start'
+    return m_error;
+}
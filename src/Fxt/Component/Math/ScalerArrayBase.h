@@ -0,0 +1,149 @@
+#ifndef Fxt_Component_Math_ScalerArrayBase_h_
+#define Fxt_Component_Math_ScalerArrayBase_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Common_.h"
+#include "Cpl/Json/Arduino.h"
+#include "Fxt/Point/Api.h"
+#include "Fxt/Point/FactoryDatabaseApi.h"
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Math {
+
+
+/** This partially concrete class implements a Component that scales arrays of
+    values using a simple mx + b formula.  It is the 'array' version of the
+    Scaler64 component, i.e. the inputs and outputs are specified as ranges of
+    Point IDs (start ID + count) instead of individual references, and the 
+    scaling constants are specified per input range (not per point). Up to 
+    MAX_INPUTS Inputs/Outputs are supported.
+
+    The concrete child determines the allowed data type. All inputs/outputs 
+    MUST have the same type.
+    
+    The total number of inputs must equal the total number of outputs. The
+    ranges are flattened in order, i.e. the Nth input Point (across all input
+    ranges) is scaled and written to the Nth output Point (across all output
+    ranges).
+
+    IF an input value is invalid, then its corresponding output value is set to
+    invalid.
+
+    The component has NO stateful data
+
+    \code
+
+    JSON Definition
+    --------------------
+    {
+       "name": "rack#1 scaling"                             // Text label for the component
+       "type": "f191f131-a903-46e3-b8d0-0c29309ccfc8",      // Identifies the card type.  Value comes from the Supported/Available-card-list
+       "typeName": "Fxt::Component::Math::ScalerArrayFloat" // OPTIONAL: Human readable type name
+       "inputs": [                                          // Array of input ranges.  The max number of inputs is determined by the child class
+          {                                             
+            "name": "Rack#1 AIN",                           // human readable name for the input range
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the input signals
+            "typeName": "Fxt::Point::Float",                // OPTIONAL: Human readable Type name for the input signals. The type is child class specific!
+            "m": <numeric>,                                 // 'm' constant in the mx+b formula (applies to ALL points in the range)
+            "b": <numeric>,                                 // 'b' constant int the mx+b formula (applies to ALL points in the range)
+            "idRef": 4294967295,                            // Point ID of the FIRST point in the range
+            "count": 512                                    // OPTIONAL: Number of Points in the range. Default is 1
+          },
+          ...
+       ],
+       "outputs": [                                         // Array of output ranges.  The max number of outputs is determined by the child class
+          {
+            "name":"Rack#1 Scaled"                          // Human readable name for the output range
+            "type": "708745fa-cef6-4364-abad-063a40f35cbc", // REQUIRED Type for the output signals
+            "typeName": "Fxt::Point::Float",                // OPTIONAL: Human readable Type name for the output signals
+            "idRef":4294967295,                             // Point ID of the FIRST point in the range
+            "count": 512                                    // OPTIONAL: Number of Points in the range. Default is 1
+          },
+          ...
+       ]
+    }
+
+
+    \endcode
+ */
+class ScalerArrayBase : public Fxt::Component::Common_
+{
+public:
+    /// Maximum number of Input signals
+    static constexpr unsigned       MAX_INPUTS = 4096;
+
+    /// Maximum number of Output signals (MUST be the same a max inputs)
+    static constexpr unsigned       MAX_OUTPUTS = MAX_INPUTS;
+
+public:
+    /// Size (in bytes) of Stateful data that will be allocated on the HA Heap
+    static constexpr const size_t   HA_STATEFUL_HEAP_SIZE = 0;
+
+protected:
+    /// Constructor
+    ScalerArrayBase();
+
+    /// Destructor
+    ~ScalerArrayBase();
+
+public:
+    /// See Fxt::Component::Api
+    Fxt::Type::Error resolveReferences( Fxt::Point::DatabaseApi& pointDb )  noexcept;
+
+    /// See Fxt::Component::Api
+    Fxt::Type::Error execute( int64_t currentTickUsec ) noexcept;
+
+protected:
+    /// Helper method to parse the card's JSON config
+    bool parseConfiguration( Cpl::Memory::ContiguousAllocator& generalAllocator,
+                             JsonVariant&                      obj,
+                             unsigned                          minInputs,
+                             unsigned                          maxInputs,
+                             unsigned                          minOutputs,
+                             unsigned                          maxOutputs ) noexcept;
+
+    /// Helper method that allocates memory for the type specific constants (one set of constants per input range)
+    virtual bool allocateKonstants( Cpl::Memory::ContiguousAllocator& generalAllocator, unsigned numRanges ) noexcept = 0;
+
+    /// Helper method to parse Kconstants for an input range
+    virtual bool parseJsonKonstants( unsigned rangeIdx, JsonObject& elem ) noexcept = 0;
+
+    /** Helper method that performs the actual math for a single input range. 
+        'firstRefIndex' is the index (into the flattened references) of the
+        first point in the range. Invalid inputs MUST set their corresponding
+        output to invalid.
+     */
+    virtual void calculateOutputs( unsigned rangeIdx, unsigned firstRefIndex, unsigned numPoints ) noexcept = 0;
+
+    /// Helper method that returns the point type's GUID
+    virtual const char* getPointTypeGuid() const noexcept = 0;
+
+protected:
+    /// Number of points in each input range
+    uint16_t*       m_rangeLengths;
+
+    /// Number of input ranges
+    unsigned        m_numRanges;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,135 @@
+#ifndef Fxt_Component_Math_ScalerArrayFloat_h_
+#define Fxt_Component_Math_ScalerArrayFloat_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Component/Math/ScalerArrayBase.h"
+#include "Fxt/Point/Float.h"
+
+///
+namespace Fxt {
+///
+namespace Component {
+///
+namespace Math {
+
+
+/** This concrete class implements a Component that scales arrays of float
+    values (using a simple mx + b formula). Up to MAX_INPUTS inputs/output
+    pairs are supported.
+ */
+class ScalerArrayFloat : public ScalerArrayBase
+{
+public:
+    /// Type ID for the card
+    static constexpr const char*    GUID_STRING = "f191f131-a903-46e3-b8d0-0c29309ccfc8";
+
+    /// Type name for the card
+    static constexpr const char*    TYPE_NAME   = "Fxt::Component::Math::ScalerArrayFloat";
+
+    /// Size (in bytes) of Stateful data that will be allocated on the HA Heap
+    static constexpr const size_t   HA_STATEFUL_HEAP_SIZE = 0;
+
+public:
+    /// Constructor
+    ScalerArrayFloat( JsonVariant&                       componentObject,
+                      Cpl::Memory::ContiguousAllocator&  generalAllocator,
+                      Cpl::Memory::ContiguousAllocator&  haStatefulDataAllocator,
+                      Fxt::Point::FactoryDatabaseApi&    pointFactoryDb,
+                      Fxt::Point::DatabaseApi&           dbForPoints )
+        :ScalerArrayBase()
+        , m_konstants( nullptr )
+    {
+        parseConfiguration( generalAllocator, componentObject, 1, MAX_INPUTS, 1, MAX_OUTPUTS );
+    }
+
+public:
+    /// See Fxt::Component::Api
+    const char* getTypeGuid() const noexcept
+    {
+        return GUID_STRING;
+    }
+
+    /// See Fxt::Component::Api
+    const char* getTypeName() const noexcept
+    {
+        return TYPE_NAME;
+    }
+
+
+protected:
+    /// See Fxt::Component::Math::ScalerArrayBase
+    bool allocateKonstants( Cpl::Memory::ContiguousAllocator& generalAllocator, unsigned numRanges ) noexcept
+    {
+        m_konstants = (Konstants_T*) generalAllocator.allocate( sizeof( Konstants_T ) * numRanges );
+        return m_konstants != nullptr;
+    }
+
+    /// See Fxt::Component::Math::ScalerArrayBase
+    bool parseJsonKonstants( unsigned rangeIdx, JsonObject& elem ) noexcept
+    {
+        if ( elem["m"].is<float>() && elem["b"].is<float>() )
+        {
+            m_konstants[rangeIdx].m = elem["m"];
+            m_konstants[rangeIdx].b = elem["b"];
+            return true;
+        }
+        return false;
+    }
+
+    /// See Fxt::Component::Math::ScalerArrayBase
+    const char* getPointTypeGuid() const noexcept
+    {
+        return Fxt::Point::Float::GUID_STRING;
+    }
+
+    /// See Fxt::Component::Math::ScalerArrayBase
+    void calculateOutputs( unsigned rangeIdx, unsigned firstRefIndex, unsigned numPoints ) noexcept
+    {
+        Fxt::Point::Float** inPts  = ((Fxt::Point::Float**) m_inputRefs) + firstRefIndex;
+        Fxt::Point::Float** outPts = ((Fxt::Point::Float**) m_outputRefs) + firstRefIndex;
+        float               m      = m_konstants[rangeIdx].m;
+        float               b      = m_konstants[rangeIdx].b;
+
+        for ( unsigned i=0; i < numPoints; i++ )
+        {
+            float inVal;
+            if ( inPts[i]->read( inVal ) )
+            {
+                outPts[i]->write( inVal * m + b );
+            }
+            else
+            {
+                outPts[i]->setInvalid();
+            }
+        }
+    }
+
+protected:
+    /// Struct to hold the scaling constants
+    struct Konstants_T
+    {
+        float m;        //!< 'm' constant in the mx+b formula
+        float b;        //!< 'b' constant in the mx+b formula
+    };
+
+    /// List of Scaling constants (one per input range)
+    Konstants_T*        m_konstants;
+};
+
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
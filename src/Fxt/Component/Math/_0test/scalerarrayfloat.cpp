@@ -0,0 +1,207 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Component/Math/ScalerArrayFloat.h"
+#include "Fxt/Component/Math/ScalerArrayFloatFactory.h"
+#include "Fxt/Component/FactoryDatabase.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/Math/real.h"
+#include <string.h>
+
+#define SECT_   "_0test"
+
+/// 
+using namespace Fxt::Component::Math;
+
+// Inputs: [0..2] (m=2,b=1) and [3] (m=-1,b=0). Outputs: [10..11] and [12..13]
+static const char* COMP_DEFINTION = R"literalString(
+{
+  "components": [
+    {
+      "name": "rack scaling",
+      "type": "f191f131-a903-46e3-b8d0-0c29309ccfc8",
+      "typeName": "Fxt::Component::Math::ScalerArrayFloat",
+      "inputs": [
+        {
+          "name": "Rack A",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "m": 2,
+          "b": 1,
+          "idRef": 0,
+          "count": 3
+        },
+        {
+          "name": "Rack B",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "m": -1,
+          "b": 0,
+          "idRef": 3
+        }
+      ],
+      "outputs": [
+        {
+          "name": "Scaled Rack A",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 10,
+          "count": 2
+        },
+        {
+          "name": "Scaled Rack B",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 12,
+          "count": 2
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static const char* COMP_DEFINTION_MISSING_M = R"literalString(
+{
+  "components": [
+    {
+      "name": "rack scaling",
+      "type": "f191f131-a903-46e3-b8d0-0c29309ccfc8",
+      "inputs": [
+        { "b": 1, "idRef": 0, "count": 4 }
+      ],
+      "outputs": [
+        { "idRef": 10, "count": 4 }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+
+#define MAX_POINTS              14
+#define NUM_CHANNELS            4
+#define FIRST_INPUT_ID          0
+#define FIRST_OUTPUT_ID         10
+
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "ScalerArrayFloat" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap statefulAllocator( statefulHeap_, sizeof( statefulHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                   pointDb;
+    Fxt::Component::FactoryDatabase                    componentFactoryDb;
+    Fxt::Point::FactoryDatabase                        pointFactoryDb;
+    ScalerArrayFloatFactory                            uut( componentFactoryDb );
+    Fxt::Type::Error                                   componentErrorCode;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN> buf;
+    StaticJsonDocument<10240>                          doc;
+
+    SECTION( "create/destroy component" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        Fxt::Component::Api* component = uut.create( componentObj,
+                                                     componentErrorCode,
+                                                     generalAllocator,
+                                                     statefulAllocator,
+                                                     pointFactoryDb,
+                                                     pointDb );
+        REQUIRE( component != nullptr );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( componentErrorCode, buf )) );
+        REQUIRE( componentErrorCode == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( strcmp( component->getTypeName(), ScalerArrayFloat::TYPE_NAME ) == 0 );
+        REQUIRE( strcmp( component->getTypeGuid(), ScalerArrayFloat::GUID_STRING ) == 0 );
+        REQUIRE( component->resolveReferences( pointDb ) == Fxt::Component::fullErr( Fxt::Component::Err_T::UNRESOLVED_INPUT_REFRENCE ) );
+
+        uut.destroy( *component );
+    }
+
+    SECTION( "create - missing constant" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION_MISSING_M );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        Fxt::Component::Api* component = uut.create( componentObj,
+                                                     componentErrorCode,
+                                                     generalAllocator,
+                                                     statefulAllocator,
+                                                     pointFactoryDb,
+                                                     pointDb );
+        REQUIRE( component != nullptr );
+        REQUIRE( componentErrorCode == Fxt::Component::fullErr( Fxt::Component::Err_T::MISSING_REQUIRED_FIELD ) );
+
+        uut.destroy( *component );
+    }
+
+    SECTION( "execute component" )
+    {
+        DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+        REQUIRE( err == DeserializationError::Ok );
+
+        JsonVariant componentObj = doc["components"][0];
+        Fxt::Component::Api* component = uut.create( componentObj,
+                                                     componentErrorCode,
+                                                     generalAllocator,
+                                                     statefulAllocator,
+                                                     pointFactoryDb,
+                                                     pointDb );
+        REQUIRE( component != nullptr );
+        REQUIRE( componentErrorCode == Fxt::Type::Error::SUCCESS() );
+
+        Fxt::Point::Float* inPts[NUM_CHANNELS];
+        Fxt::Point::Float* outPts[NUM_CHANNELS];
+        for ( unsigned i=0; i < NUM_CHANNELS; i++ )
+        {
+            inPts[i]  = new(std::nothrow) Fxt::Point::Float( pointDb, FIRST_INPUT_ID + i, statefulAllocator );
+            outPts[i] = new(std::nothrow) Fxt::Point::Float( pointDb, FIRST_OUTPUT_ID + i, statefulAllocator );
+        }
+
+        Fxt::Type::Error errCode = component->resolveReferences( pointDb );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", Fxt::Type::Error::toText( errCode, buf )) );
+        REQUIRE( errCode == Fxt::Type::Error::SUCCESS() );
+
+        REQUIRE( component->start( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( component->execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        for ( unsigned i=0; i < NUM_CHANNELS; i++ )
+        {
+            REQUIRE( outPts[i]->isNotValid() );
+        }
+
+        inPts[0]->write( 1.0F );
+        inPts[1]->write( 2.0F );
+        inPts[3]->write( 4.0F );
+        REQUIRE( component->execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        float value;
+        REQUIRE( outPts[0]->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 3.0F ) );
+        REQUIRE( outPts[1]->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, 5.0F ) );
+        REQUIRE( outPts[2]->isNotValid() );
+        REQUIRE( outPts[3]->read( value ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( value, -4.0F ) );
+
+        uut.destroy( *component );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -21,6 +21,7 @@
 #include "Cpl/Memory/ContiguousAllocator.h"
 #include "Cpl/Json/Arduino.h"
 #include "Fxt/Component/FactoryDatabaseApi.h"
+#include "Fxt/Component/ExecutionStats.h"
 #include <stdint.h>
 
 
@@ -41,6 +42,15 @@ namespace LogicChain {
             - A Component Input can reference a Virtual (input) Point from an IO Card 
             - A Component Output can reference a Virtual (output) Point to a an IO Card
 
+    NOTE: A Connector Point can be an 'alias' of an existing Point (the
+          'producer').  An alias point shares the producer's stateful data,
+          i.e. a Component writing the producer point is also 'writing' the
+          alias point - there is no copy operation (e.g. a Wire Component) and
+          no memory is allocated for the alias's stateful data.  The producer
+          must be the same type as the alias and it must already exist when
+          the Logic Chain is created (e.g. a Virtual Point or a preceding
+          connector point in the same Logic Chain).
+
    \code
     Required/Defined JSON fields/structure:
         {
@@ -56,7 +66,8 @@ namespace LogicChain {
                   "type":           "<Points's Type GUID: 8-4-4-4-12 format>",
                   "typeCfg:         <OPTIONAL type configuration for complex types, e.g. "typeCfg":{"numElems":2}>,
                   "typeName":       "*<OPTIONAL: human readable point type>",
-                  "name":           "*<human readable name for the point>"
+                  "name":           "*<human readable name for the point>",
+                  "aliasOf":        <OPTIONAL: ID of the 'producer' point. When specified the connector point does NOT have its own stateful data, instead it reads/writes the producer's stateful data (i.e. zero-copy wiring)>
               },
               ...
             ]
@@ -172,6 +183,40 @@ public:
      */
     virtual Fxt::Component::Api* getComponent( uint16_t componentIndex ) noexcept = 0;
 
+public:
+    /** This method enables/disables the collection of per-Component execution
+        statistics (i.e. profiling).  When enabled, each Component's execute()
+        call is timed using Fxt::System::PerfCounter. Profiling is disabled by
+        default.  The statistics are NOT cleared when profiling is enabled/disabled.
+        The method can be safely called from any thread.
+
+        Note: Enabling profiling fails silently if the Logic Chain was not able
+              to allocate memory for the statistics when it was created.
+     */
+    virtual void enableProfiling( bool enabled ) noexcept = 0;
+
+    /** This method returns true if profiling is currently enabled
+     */
+    virtual bool isProfilingEnabled() const noexcept = 0;
+
+    /** Returns a pointer to the execution statistics for the specified
+        Component.  If not a valid index, the Logic Chain is in an error state,
+        or no memory was allocated for the statistics, then nullptr is returned.
+
+        Note: The statistics are updated by the Chassis thread, i.e. the caller
+              is responsible for tolerating 'torn' reads when reading the
+              statistics from a different thread.
+     */
+    virtual const Fxt::Component::ExecutionStats_T* getComponentStats( uint16_t componentIndex ) const noexcept = 0;
+
+    /** This method requests that the execution statistics for ALL of the
+        Logic Chain's Components be cleared.  The statistics are cleared by the
+        Chassis thread at the start of the Logic Chain's next execution cycle
+        (or when the Logic Chain is started), i.e. the method can be safely
+        called from any thread.
+     */
+    virtual void resetProfiling() noexcept = 0;
+
 public:
     /** This method attempts to parse the provided JSON Object that represents
         a Logic Chain and create the contained components.  If there is an error
@@ -13,6 +13,9 @@
 
 #include "Chain.h"
 #include "Cpl/System/Assert.h"
+#include "Fxt/System/PerfCounter.h"
+#include "Fxt/System/AllocTag.h"
+#include "Cpl/Memory/LeanHeap.h"
 #include <new>
 
 
@@ -25,12 +28,15 @@ Chain::Chain( Cpl::Memory::ContiguousAllocator&   generalAllocator,
               uint16_t                            numAutoPoints )
     : m_components( nullptr )
     , m_autoPoints( nullptr )
+    , m_stats( nullptr )
     , m_error( Fxt::Type::Error::SUCCESS() )
     , m_numComponents( numComponents )
     , m_numAutoPoints( numAutoPoints )
     , m_nextComponentIdx( 0 )
     , m_nextAutoPtsIdx( 0 )
     , m_started( false )
+    , m_profiling( false )
+    , m_resetPending( false )
 {
     // Allocate my array of Component pointers
     m_components = (Fxt::Component::Api**) generalAllocator.allocate( sizeof( Fxt::Component::Api* ) * numComponents );
@@ -59,6 +65,14 @@ Chain::Chain( Cpl::Memory::ContiguousAllocator&   generalAllocator,
         // Zero the array so we can tell if there are missing auto points
         memset( m_autoPoints, 0, sizeof( Fxt::Point::Api* ) * m_numAutoPoints );
     }
+
+    // Allocate my profiling statistics.  Note: Failing to allocate the 
+    // statistics is NOT an error - it just means profiling is not available
+    m_stats = (Fxt::Component::ExecutionStats_T*) generalAllocator.allocate( sizeof( Fxt::Component::ExecutionStats_T ) * numComponents );
+    if ( m_stats != nullptr )
+    {
+        memset( m_stats, 0, sizeof( Fxt::Component::ExecutionStats_T ) * numComponents );
+    }
 }
 
 Chain::~Chain()
@@ -123,6 +137,9 @@ Fxt::Type::Error Chain::start( uint64_t currentElapsedTimeUsec ) noexcept
             m_autoPoints[i]->updateFromSetter();
         }
 
+        // Apply a pending statistics reset
+        applyPendingReset();
+
         // Start the individual components (and additional error checking)
         for ( uint16_t i=0; i < m_numComponents; i++ )
         {
@@ -195,14 +212,30 @@ Fxt::Type::Error Chain::execute( int64_t currentTickUsec ) noexcept
             m_autoPoints[i]->updateFromSetter();
         }
 
-        // Execute the Components
-        for ( uint16_t i=0; i < m_numComponents; i++ )
+        // Apply a pending statistics reset (i.e. the statistics are only modified by the Chassis thread)
+        applyPendingReset();
+
+        // Execute the Components with profiling
+        if ( m_profiling.load( std::memory_order_relaxed ) )
         {
-            if ( m_components[i]->execute( currentTickUsec ) != Fxt::Type::Error::SUCCESS() )
+            if ( !executeWithProfiling( currentTickUsec ) )
             {
                 m_error = fullErr( Err_T::COMPONENT_FAILURE );
                 m_error.logIt();
-                break;
+            }
+        }
+
+        // Execute the Components (fast path)
+        else
+        {
+            for ( uint16_t i=0; i < m_numComponents; i++ )
+            {
+                if ( m_components[i]->execute( currentTickUsec ) != Fxt::Type::Error::SUCCESS() )
+                {
+                    m_error = fullErr( Err_T::COMPONENT_FAILURE );
+                    m_error.logIt();
+                    break;
+                }
             }
         }
     }
@@ -210,6 +243,62 @@ Fxt::Type::Error Chain::execute( int64_t currentTickUsec ) noexcept
     return m_error;
 }
 
+bool Chain::executeWithProfiling( int64_t currentTickUsec ) noexcept
+{
+    uint32_t startTime = Fxt::System::PerfCounter::now();
+    for ( uint16_t i=0; i < m_numComponents; i++ )
+    {
+        // NOTE: The end time of the current component is the start time of the next component (i.e. one timer read per component)
+        bool     result  = m_components[i]->execute( currentTickUsec ) == Fxt::Type::Error::SUCCESS();
+        uint32_t endTime = Fxt::System::PerfCounter::now();
+        m_stats[i].update( Fxt::System::PerfCounter::delta( startTime, endTime ) );
+        if ( !result )
+        {
+            return false;
+        }
+        startTime = endTime;
+    }
+
+    return true;
+}
+
+//////////////////////////////////////////////////
+void Chain::enableProfiling( bool enabled ) noexcept
+{
+    m_profiling.store( enabled && m_stats != nullptr, std::memory_order_relaxed );
+}
+
+bool Chain::isProfilingEnabled() const noexcept
+{
+    return m_profiling.load( std::memory_order_relaxed );
+}
+
+const Fxt::Component::ExecutionStats_T* Chain::getComponentStats( uint16_t componentIndex ) const noexcept
+{
+    if ( componentIndex >= m_numComponents || m_stats == nullptr || m_error != Fxt::Type::Error::SUCCESS() )
+    {
+        return nullptr;
+    }
+    return &m_stats[componentIndex];
+}
+
+void Chain::resetProfiling() noexcept
+{
+    // The reset is performed by the Chassis thread (see applyPendingReset())
+    m_resetPending.store( true, std::memory_order_release );
+}
+
+void Chain::applyPendingReset() noexcept
+{
+    if ( m_resetPending.load( std::memory_order_acquire ) && m_resetPending.exchange( false, std::memory_order_acq_rel ) && m_stats != nullptr )
+    {
+        for ( uint16_t i=0; i < m_numComponents; i++ )
+        {
+            m_stats[i].reset();
+        }
+    }
+}
+
 
 //////////////////////////////////////////////////
 Fxt::Type::Error Chain::add( Fxt::Component::Api& componentToAdd ) noexcept
@@ -259,6 +348,9 @@ Api* Api::createLogicChainfromJSON( JsonVariant                         logicCha
                                     Fxt::Point::DatabaseApi&            dbForPoints,
                                     Fxt::Type::Error&                   logicChainErrorode ) noexcept
 {
+    // Charge the memory allocations to the sub-system
+    Fxt::System::AllocTag::ScopeBlock allocTag( Fxt::System::AllocTag::eLOGIC_CHAINS );
+
     // Minimal syntax checking of the JSON input
     if ( logicChainObject["components"].is<JsonArray>() == false )
     {
@@ -331,16 +423,36 @@ Api* Api::createLogicChainfromJSON( JsonVariant                         logicCha
     // Create Connector Points
     if ( logicChainObject["connectionPts"].is<JsonArray>() )
     {
+        // Scratch memory for the stateful data of alias points (it is discarded once the point is aliased)
+        size_t                scratchMemory[( OPTION_FXT_LOGICCHAIN_ALIAS_SCRATCH_SIZE + sizeof( size_t ) - 1 ) / sizeof( size_t )];
+        Cpl::Memory::LeanHeap scratchAllocator( scratchMemory, sizeof( scratchMemory ) );
+
         JsonArray connectionPts = logicChainObject["connectionPts"];
         size_t    numPoints     = connectionPts.size();
         for ( size_t i=0; i < numPoints; i++ )
         {
             Fxt::Type::Error pointError;
             JsonObject       pointJson = connectionPts[i];
+
+            // Look-up the producer point for alias points
+            Fxt::Point::Api* producer = nullptr;
+            if ( !pointJson["aliasOf"].isNull() )
+            {
+                producer = pointJson["aliasOf"].is<unsigned long>() ? dbForPoints.lookupById( pointJson["aliasOf"].as<unsigned long>() ) : nullptr;
+                if ( producer == nullptr )
+                {
+                    logicChainErrorode = fullErr( Err_T::MISSING_ALIAS_PRODUCER );
+                    logicChainErrorode.logIt();
+                    logicChain->~Api();
+                    return nullptr;
+                }
+                scratchAllocator.reset();
+            }
+
             Fxt::Point::Api* pt = pointFactoryDb.createPointfromJSON( pointJson,
                                                                       pointError,
                                                                       generalAllocator,
-                                                                      generalAllocator,     // Note: Connector points are NOT part of the HA data
+                                                                      producer ? (Cpl::Memory::ContiguousAllocator&) scratchAllocator : generalAllocator, // Note: Connector points are NOT part of the HA data
                                                                       dbForPoints,
                                                                       "id",
                                                                       false ); // Do NOT create setters (connector points can NOT have an initial value)
@@ -358,6 +470,13 @@ Api* Api::createLogicChainfromJSON( JsonVariant                         logicCha
                 logicChain->~Api();
                 return nullptr;
             }
+            if ( producer && !pt->aliasTo_( *producer ) )
+            {
+                logicChainErrorode = fullErr( Err_T::FAILED_ALIAS_POINT );
+                logicChainErrorode.logIt();
+                logicChain->~Api();
+                return nullptr;
+            }
         }
     }
 
@@ -13,11 +13,22 @@
 /** @file */
 
 
+#include "colony_config.h"
 #include "Fxt/LogicChain/Api.h"
 #include "Fxt/LogicChain/Error.h"
 #include "Fxt/Point/DatabaseApi.h"
 #include "Cpl/Json/Arduino.h"
 #include "Cpl/Memory/ContiguousAllocator.h"
+#include <atomic>
+
+
+/** Size, in bytes, of the scratch memory (allocated on the stack) that is used
+    when creating an alias Connector Point.  The value must be at least the
+    size of the stateful data of the largest Point type that is aliased.
+ */
+#ifndef OPTION_FXT_LOGICCHAIN_ALIAS_SCRATCH_SIZE
+#define OPTION_FXT_LOGICCHAIN_ALIAS_SCRATCH_SIZE     256
+#endif
 
 ///
 namespace Fxt {
@@ -69,6 +80,26 @@ public:
     /// See Fxt::LogicChain::Api
     Fxt::Component::Api* getComponent( uint16_t componentIndex ) noexcept;
 
+public:
+    /// See Fxt::LogicChain::Api
+    void enableProfiling( bool enabled ) noexcept;
+
+    /// See Fxt::LogicChain::Api
+    bool isProfilingEnabled() const noexcept;
+
+    /// See Fxt::LogicChain::Api
+    const Fxt::Component::ExecutionStats_T* getComponentStats( uint16_t componentIndex ) const noexcept;
+
+    /// See Fxt::LogicChain::Api
+    void resetProfiling() noexcept;
+
+protected:
+    /// Helper method that executes the Components with profiling enabled
+    bool executeWithProfiling( int64_t currentTickUsec ) noexcept;
+
+    /// Helper method that clears the statistics if a reset has been requested. MUST be called from the Chassis thread
+    void applyPendingReset() noexcept;
+
 protected:
     /// Array/List of components in the logic chain
     Fxt::Component::Api**               m_components;
@@ -76,6 +107,9 @@ protected:
     /// Array/List of Auto points in the logic chain
     Fxt::Point::Api**                   m_autoPoints;
 
+    /// Array of per-component execution statistics (is nullptr if the allocation failed)
+    Fxt::Component::ExecutionStats_T*   m_stats;
+
     /// Error state. A value of 0 indicates NO error
     Fxt::Type::Error                    m_error;
 
@@ -93,6 +127,12 @@ protected:
 
     /// My started state
     bool                                m_started;
+
+    /// Profiling enabled state (is written by a non-Chassis thread, e.g. the TShell)
+    std::atomic<bool>                   m_profiling;
+
+    /// Pending request to clear the statistics (is consumed by the Chassis thread)
+    std::atomic<bool>                   m_resetPending;
 };
 
 
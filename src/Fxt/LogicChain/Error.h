@@ -50,6 +50,8 @@ namespace LogicChain {
     @param POINT_CREATE_ERROR               One or more connector points were not successfully created
     @param AUTO_POINT_CREATE_ERROR          One or more connector points were not successfully created
     @param FAILED_POINT_RESOLVE             One or more Components failed when resolving their' point references
+    @param MISSING_ALIAS_PRODUCER           The 'aliasOf' point for one or more connector points does not exist
+    @param FAILED_ALIAS_POINT               One or more connector points could not be aliased (e.g. type mismatch) to its producer point
  */
 BETTER_ENUM( Err_T, uint8_t
              , SUCCESS = 0
@@ -72,6 +74,8 @@ BETTER_ENUM( Err_T, uint8_t
              , POINT_CREATE_ERROR
              , AUTO_POINT_CREATE_ERROR
              , FAILED_POINT_RESOLVE
+             , MISSING_ALIAS_PRODUCER
+             , FAILED_ALIAS_POINT
 );
 
 /** This concrete class defines the Error Category for the Logic Chain namespace.
@@ -0,0 +1,196 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/LogicChain/Chain.h"
+#include "Fxt/Component/Basic/Wire64FloatFactory.h"
+#include "Fxt/Component/FactoryDatabase.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Factory.h"
+#include "Fxt/Point/Float.h"
+#include "Fxt/Point/Bool.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/System/Trace.h"
+#include <string.h>
+#include <new>
+
+#define SECT_   "_0test"
+
+/// 
+using namespace Fxt::LogicChain;
+
+// Point 0 --> Wire#1 --> Point 1 (alias: Point 2) --> Wire#2 --> Point 3
+static const char* LC_DEFINTION = R"literalString(
+{
+  "name": "alias chain",
+  "id": 1,
+  "components": [
+    {
+      "name": "Wire#1",
+      "type": "e6759a22-06c1-4aad-8190-67bf36425903",
+      "typeName": "Fxt::Component::Basic::Wire64Float",
+      "inputs": [
+        {
+          "name": "In",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 0
+        }
+      ],
+      "outputs": [
+        {
+          "name": "Out",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 1
+        }
+      ]
+    },
+    {
+      "name": "Wire#2",
+      "type": "e6759a22-06c1-4aad-8190-67bf36425903",
+      "typeName": "Fxt::Component::Basic::Wire64Float",
+      "inputs": [
+        {
+          "name": "In",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 2
+        }
+      ],
+      "outputs": [
+        {
+          "name": "Out",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 3
+        }
+      ]
+    }
+  ],
+  "connectionPts": [
+    {
+      "id": 1,
+      "name": "Wire#1 output",
+      "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+      "typeName": "Fxt::Point::Float"
+    },
+    {
+      "id": 2,
+      "name": "Wire#2 input",
+      "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+      "typeName": "Fxt::Point::Float",
+      "aliasOf": 1
+    },
+    {
+      "id": 3,
+      "name": "Wire#2 output",
+      "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+      "typeName": "Fxt::Point::Float"
+    }
+  ]
+}
+)literalString";
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+
+#define MAX_POINTS      4
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "alias" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap                               generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap                               statefulAllocator( statefulHeap_, sizeof( statefulHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                    pointDb;
+    Fxt::Point::FactoryDatabase                         pointFactoryDb;
+    Fxt::Component::FactoryDatabase                     componentFactoryDb;
+    Fxt::Component::Basic::Wire64FloatFactory           wireFactory( componentFactoryDb );
+    Fxt::Point::Factory<Fxt::Point::Float>              factoryFloat( pointFactoryDb );
+    Fxt::Point::Factory<Fxt::Point::Bool>               factoryBool( pointFactoryDb );
+    Fxt::Type::Error                                    logicChainError;
+    Cpl::Text::FString<Fxt::Type::Error::MAX_TEXT_LEN>  buf;
+
+    StaticJsonDocument<4096> doc;
+    DeserializationError err = deserializeJson( doc, LC_DEFINTION );
+    REQUIRE( err == DeserializationError::Ok );
+
+    // Input point (i.e. a Virtual Point from an IO card)
+    Fxt::Point::Float* ptIn = new(std::nothrow) Fxt::Point::Float( pointDb, 0, statefulAllocator );
+    REQUIRE( ptIn );
+
+    SECTION( "zero-copy" )
+    {
+        Api* uut = Api::createLogicChainfromJSON( doc.as<JsonVariant>(), componentFactoryDb, generalAllocator, statefulAllocator, pointFactoryDb, pointDb, logicChainError );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", logicChainError.toText( buf )) );
+        REQUIRE( uut );
+        REQUIRE( logicChainError == Fxt::Type::Error::SUCCESS() );
+
+        Fxt::Point::Float* pt1 = (Fxt::Point::Float*) pointDb.lookupById( 1 );
+        Fxt::Point::Float* pt2 = (Fxt::Point::Float*) pointDb.lookupById( 2 );
+        Fxt::Point::Float* pt3 = (Fxt::Point::Float*) pointDb.lookupById( 3 );
+        REQUIRE( pt1 );
+        REQUIRE( pt2 );
+        REQUIRE( pt3 );
+        REQUIRE( pt1->isAlias() == false );
+        REQUIRE( pt2->isAlias() );
+        REQUIRE( pt3->isAlias() == false );
+        REQUIRE( pt2->getStartOfStatefulMemory_() == pt1->getStartOfStatefulMemory_() );
+
+        REQUIRE( uut->resolveReferences( pointDb ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut->start( 0 ) == Fxt::Type::Error::SUCCESS() );
+
+        float value;
+        REQUIRE( uut->execute( 0 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( pt3->isNotValid() );
+
+        ptIn->write( 3.5F );
+        REQUIRE( uut->execute( 1000 ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( pt2->read( value ) );
+        REQUIRE( value == 3.5F );
+        REQUIRE( pt3->read( value ) );
+        REQUIRE( value == 3.5F );
+
+        // Writes to the alias are writes to the producer
+        pt2->write( 7.0F );
+        REQUIRE( pt1->read( value ) );
+        REQUIRE( value == 7.0F );
+        pt2->setInvalid();
+        REQUIRE( pt1->isNotValid() );
+
+        uut->stop();
+        uut->~Api();
+    }
+
+    SECTION( "missing producer" )
+    {
+        doc["connectionPts"][1]["aliasOf"] = 99;
+        Api* uut = Api::createLogicChainfromJSON( doc.as<JsonVariant>(), componentFactoryDb, generalAllocator, statefulAllocator, pointFactoryDb, pointDb, logicChainError );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", logicChainError.toText( buf )) );
+        REQUIRE( uut == nullptr );
+        REQUIRE( logicChainError == fullErr( Err_T::MISSING_ALIAS_PRODUCER ) );
+    }
+
+    SECTION( "type mismatch" )
+    {
+        doc["connectionPts"][1]["type"] = Fxt::Point::Bool::GUID_STRING;
+        Api* uut = Api::createLogicChainfromJSON( doc.as<JsonVariant>(), componentFactoryDb, generalAllocator, statefulAllocator, pointFactoryDb, pointDb, logicChainError );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("error Code=%s", logicChainError.toText( buf )) );
+        REQUIRE( uut == nullptr );
+        REQUIRE( logicChainError == fullErr( Err_T::FAILED_ALIAS_POINT ) );
+    }
+
+    pointDb.clearPoints();
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
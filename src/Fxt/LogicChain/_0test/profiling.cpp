@@ -0,0 +1,203 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/LogicChain/Chain.h"
+#include "Fxt/Component/Basic/Wire64Float.h"
+#include "Fxt/Point/Database.h"
+#include "Fxt/Point/FactoryDatabase.h"
+#include "Fxt/Point/Float.h"
+#include "Fxt/System/PerfCounter.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/Trace.h"
+#include <string.h>
+#include <new>
+
+#define SECT_   "_0test"
+
+/// 
+using namespace Fxt::LogicChain;
+
+static const char* COMP_DEFINTION = R"literalString(
+{
+  "components": [
+    {
+      "name": "first",
+      "type": "e6759a22-06c1-4aad-8190-67bf36425903",
+      "typeName": "Fxt::Component::Basic::Wire64Float",
+      "inputs": [
+        {
+          "name": "Signal A",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 0
+        }
+      ],
+      "outputs": [
+        {
+          "name": "Signal AA",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 1
+        }
+      ]
+    },
+    {
+      "name": "second",
+      "type": "e6759a22-06c1-4aad-8190-67bf36425903",
+      "typeName": "Fxt::Component::Basic::Wire64Float",
+      "inputs": [
+        {
+          "name": "Signal AA",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 1
+        }
+      ],
+      "outputs": [
+        {
+          "name": "Signal AAA",
+          "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+          "typeName": "Fxt::Point::Float",
+          "idRef": 2
+        }
+      ]
+    }
+  ]
+}
+)literalString";
+
+static size_t generalHeap_[10000];
+static size_t statefulHeap_[10000];
+
+#define MAX_POINTS      3
+#define NUM_CYCLES      100
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "profiling" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Cpl::Memory::LeanHeap                               generalAllocator( generalHeap_, sizeof( generalHeap_ ) );
+    Cpl::Memory::LeanHeap                               statefulAllocator( statefulHeap_, sizeof( statefulHeap_ ) );
+    Fxt::Point::Database<MAX_POINTS>                    pointDb;
+    Fxt::Point::FactoryDatabase                         pointFactoryDb;
+
+    StaticJsonDocument<4096> doc;
+    DeserializationError err = deserializeJson( doc, COMP_DEFINTION );
+    REQUIRE( err == DeserializationError::Ok );
+
+    JsonVariant componentObj1 = doc["components"][0];
+    JsonVariant componentObj2 = doc["components"][1];
+    Fxt::Component::Basic::Wire64Float* component1 = new(std::nothrow) Fxt::Component::Basic::Wire64Float( componentObj1, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+    Fxt::Component::Basic::Wire64Float* component2 = new(std::nothrow) Fxt::Component::Basic::Wire64Float( componentObj2, generalAllocator, statefulAllocator, pointFactoryDb, pointDb );
+    REQUIRE( component1->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+    REQUIRE( component2->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+    Fxt::Point::Float* ptIn  = new(std::nothrow) Fxt::Point::Float( pointDb, 0, statefulAllocator );
+    Fxt::Point::Float* ptMid = new(std::nothrow) Fxt::Point::Float( pointDb, 1, statefulAllocator );
+    Fxt::Point::Float* ptOut = new(std::nothrow) Fxt::Point::Float( pointDb, 2, statefulAllocator );
+    REQUIRE( ptIn );
+    REQUIRE( ptMid );
+    REQUIRE( ptOut );
+
+    Chain uut( generalAllocator, 2, 0 );
+    REQUIRE( uut.add( *component1 ) == Fxt::Type::Error::SUCCESS() );
+    REQUIRE( uut.add( *component2 ) == Fxt::Type::Error::SUCCESS() );
+    REQUIRE( uut.resolveReferences( pointDb ) == Fxt::Type::Error::SUCCESS() );
+
+    int64_t nowUsec = Cpl::System::ElapsedTime::milliseconds() * 1000;
+    REQUIRE( uut.start( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+
+    SECTION( "disabled" )
+    {
+        REQUIRE( uut.isProfilingEnabled() == false );
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.getComponentStats( 0 )->count == 0 );
+        REQUIRE( uut.getComponentStats( 1 )->count == 0 );
+        REQUIRE( uut.getComponentStats( 2 ) == nullptr );
+    }
+
+    SECTION( "enabled" )
+    {
+        uut.enableProfiling( true );
+        REQUIRE( uut.isProfilingEnabled() );
+
+        ptIn->write( 1.0F );
+        for ( int i=0; i < NUM_CYCLES; i++ )
+        {
+            REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        }
+        float value;
+        REQUIRE( ptOut->read( value ) );
+        REQUIRE( value == 1.0F );
+
+        for ( uint16_t idx=0; idx < 2; idx++ )
+        {
+            const Fxt::Component::ExecutionStats_T* stats = uut.getComponentStats( idx );
+            REQUIRE( stats );
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("component %u: count=%lu, total=%llu ns, avg=%lu ns, max=%lu ns",
+                                          idx,
+                                          (unsigned long) stats->count,
+                                          (unsigned long long) stats->totalTime,
+                                          (unsigned long) stats->average(),
+                                          (unsigned long) stats->maxTime) );
+            REQUIRE( stats->count == NUM_CYCLES );
+            REQUIRE( stats->totalTime > 0 );
+            REQUIRE( stats->totalTime >= stats->maxTime );
+            REQUIRE( stats->maxTime >= stats->average() );
+        }
+
+        // Disabling does NOT clear the stats
+        uut.enableProfiling( false );
+        REQUIRE( uut.isProfilingEnabled() == false );
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.getComponentStats( 0 )->count == NUM_CYCLES );
+
+        // The reset is applied by the next execution cycle
+        uut.resetProfiling();
+        REQUIRE( uut.getComponentStats( 0 )->count == NUM_CYCLES );
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.getComponentStats( 0 )->count == 0 );
+        REQUIRE( uut.getComponentStats( 0 )->totalTime == 0 );
+        REQUIRE( uut.getComponentStats( 1 )->maxTime == 0 );
+
+        // Reset while profiling is enabled, i.e. only the next cycle is counted
+        uut.enableProfiling( true );
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        uut.resetProfiling();
+        REQUIRE( uut.execute( nowUsec ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut.getComponentStats( 0 )->count == 1 );
+    }
+
+    SECTION( "perfcounter" )
+    {
+        uint32_t start = Fxt::System::PerfCounter::now();
+        Cpl::System::Api::sleep( 10 );
+        uint32_t delta = Fxt::System::PerfCounter::delta( start );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("10ms sleep. delta=%lu ns", (unsigned long) delta) );
+        REQUIRE( delta >= 9 * 1000000UL );
+
+        // The counter has a sub-millisecond resolution (i.e. per-Component times are meaningful)
+        uint32_t tick1 = Fxt::System::PerfCounter::now();
+        uint32_t tick2;
+        while ( (tick2 = Fxt::System::PerfCounter::now()) == tick1 )
+        {
+        }
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("resolution=%lu ns", (unsigned long) Fxt::System::PerfCounter::delta( tick1, tick2 )) );
+        REQUIRE( Fxt::System::PerfCounter::delta( tick1, tick2 ) < 1000000UL );
+    }
+
+    uut.stop();
+    pointDb.clearPoints();
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
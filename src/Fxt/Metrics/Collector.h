@@ -0,0 +1,47 @@
+#ifndef Fxt_Metrics_Collector_h_
+#define Fxt_Metrics_Collector_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/Container/Item.h"
+
+
+///
+namespace Fxt {
+///
+namespace Metrics {
+
+
+/** This abstract class defines the interface for 'sampling' metric values
+    that are maintained elsewhere (e.g. a Node's heap usage).  Collectors are
+    registered with a Fxt::Metrics::Registry and are called - in the
+    rendering thread - immediately before the metrics are rendered.  This
+    allows sub-systems to expose their existing statistics without adding
+    any work to their own threads.
+
+    A Collector MUST NOT block and MUST NOT call back into the Registry.
+ */
+class Collector : public Cpl::Container::Item
+{
+public:
+    /// Updates the collector's metrics with the current values
+    virtual void collect() noexcept = 0;
+
+public:
+    /// Virtual destructor
+    virtual ~Collector() {}
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
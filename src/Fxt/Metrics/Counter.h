@@ -0,0 +1,76 @@
+#ifndef Fxt_Metrics_Counter_h_
+#define Fxt_Metrics_Counter_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Metrics/Metric.h"
+#include <atomic>
+
+
+///
+namespace Fxt {
+///
+namespace Metrics {
+
+
+/** This concrete class implements a lock-free counter metric.  The value is
+    an 'unsigned long' so that it is lock-free on both 32 bit and 64 bit
+    targets.
+ */
+class Counter : public Metric
+{
+public:
+    /// Constructor
+    Counter( const char* name, const char* help, const char* labels = nullptr ) noexcept
+        : Metric( name, help, eCOUNTER, labels )
+        , m_value( 0 )
+    {
+    }
+
+public:
+    /// Increments the counter
+    inline void increment( unsigned long delta = 1 ) noexcept
+    {
+        m_value.fetch_add( delta, std::memory_order_relaxed );
+    }
+
+    /** Sets the counter's value.  This method is intended for 'sampled'
+        counters, i.e. when the running total is maintained by the sub-system
+        and is copied into the metric by a Fxt::Metrics::Collector.
+     */
+    inline void set( unsigned long newValue ) noexcept
+    {
+        m_value.store( newValue, std::memory_order_relaxed );
+    }
+
+    /// Returns the counter's value
+    inline unsigned long get() const noexcept
+    {
+        return m_value.load( std::memory_order_relaxed );
+    }
+
+public:
+    /// See Fxt::Metrics::Metric
+    void appendValue( Cpl::Text::String& dst ) const noexcept
+    {
+        dst.formatAppend( "%lu", get() );
+    }
+
+protected:
+    /// Value
+    std::atomic<unsigned long>  m_value;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
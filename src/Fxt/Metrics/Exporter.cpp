@@ -0,0 +1,175 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Exporter.h"
+#include "Cpl/System/ElapsedTime.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/Trace.h"
+
+#define SECT_   "Fxt::Metrics"
+
+///
+using namespace Fxt::Metrics;
+
+static const char* RESPONSE_OK_          = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nConnection: close\r\n\r\n";
+static const char* RESPONSE_NOT_FOUND_   = "HTTP/1.0 404 Not Found\r\nContent-Type: text/plain\r\nConnection: close\r\n\r\nNot Found\n";
+static const char* RESPONSE_BAD_METHOD_  = "HTTP/1.0 405 Method Not Allowed\r\nAllow: GET\r\nContent-Type: text/plain\r\nConnection: close\r\n\r\nMethod Not Allowed\n";
+
+
+//////////////////////////////////////////////////
+Exporter::Exporter( Registry& registry ) noexcept
+    : m_registry( registry )
+    , m_numRequests( 0 )
+    , m_pending( false )
+    , m_stopRequested( false )
+{
+}
+
+Exporter::~Exporter()
+{
+    if ( m_pending )
+    {
+        Cpl::Io::Socket::InputOutput discard( m_pendingFd );
+        discard.close();
+    }
+}
+
+void Exporter::pleaseStop()
+{
+    m_stopRequested = true;
+}
+
+//////////////////////////////////////////////////
+bool Exporter::newConnection( Cpl::Io::Descriptor newFd, const char* rawConnectionInfo )
+{
+    CPL_SYSTEM_TRACE_MSG( SECT_, ("Exporter: accepted connection from: %s", rawConnectionInfo) );
+
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    if ( m_pending )
+    {
+        // Discard the previous connection that was never handed off
+        Cpl::Io::Socket::InputOutput discard( m_pendingFd );
+        discard.close();
+    }
+    m_pendingFd = newFd;
+    m_pending   = true;
+    return true;
+}
+
+void Exporter::appRun()
+{
+    while ( !m_stopRequested )
+    {
+        Cpl::Io::Descriptor fd;
+        bool                newConnection = false;
+        {
+            Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+            if ( m_pending )
+            {
+                fd            = m_pendingFd;
+                m_pending     = false;
+                newConnection = true;
+            }
+        }
+
+        if ( !newConnection )
+        {
+            Cpl::System::Api::sleep( OPTION_FXT_METRICS_EXPORTER_POLL_MS );
+            continue;
+        }
+
+        m_stream.activate( fd );
+        serve();
+        m_stream.close();
+    }
+}
+
+//////////////////////////////////////////////////
+void Exporter::serve() noexcept
+{
+    if ( !readRequest() )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Exporter: incomplete request (or time-out)") );
+        return;
+    }
+    m_numRequests++;
+
+    // Request line: <method> <path> <version>
+    if ( !m_requestLine.startsWith( "GET " ) )
+    {
+        m_stream.write( RESPONSE_BAD_METHOD_ );
+        return;
+    }
+    if ( !m_requestLine.startsWith( "GET /metrics " ) && !m_requestLine.startsWith( "GET /metrics?" ) && !m_requestLine.startsWith( "GET / " ) )
+    {
+        m_stream.write( RESPONSE_NOT_FOUND_ );
+        return;
+    }
+
+    if ( m_stream.write( RESPONSE_OK_ ) )
+    {
+        m_registry.render( m_stream, m_workBuffer );
+    }
+}
+
+bool Exporter::readRequest() noexcept
+{
+    // Read till the end of the request header (i.e. an empty line).  Only the request line is retained
+    m_requestLine.clear();
+    unsigned long startTime   = Cpl::System::ElapsedTime::milliseconds();
+    bool          inFirstLine = true;
+    unsigned      numNewlines = 0;
+    while ( !m_stopRequested )
+    {
+        if ( !m_stream.available() )
+        {
+            if ( Cpl::System::ElapsedTime::expiredMilliseconds( startTime, OPTION_FXT_METRICS_REQUEST_TIMEOUT_MS ) )
+            {
+                return false;
+            }
+            Cpl::System::Api::sleep( OPTION_FXT_METRICS_EXPORTER_POLL_MS );
+            continue;
+        }
+
+        char buffer[64];
+        int  bytesRead = 0;
+        if ( !m_stream.read( buffer, sizeof( buffer ), bytesRead ) || bytesRead <= 0 )
+        {
+            return false;
+        }
+        for ( int i=0; i < bytesRead; i++ )
+        {
+            char c = buffer[i];
+            if ( c == '\r' )
+            {
+                continue;
+            }
+            if ( c == '\n' )
+            {
+                inFirstLine = false;
+                if ( ++numNewlines == 2 )
+                {
+                    return true;
+                }
+                continue;
+            }
+            numNewlines = 0;
+            if ( inFirstLine )
+            {
+                m_requestLine += c;
+            }
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,128 @@
+#ifndef Fxt_Metrics_Exporter_h_
+#define Fxt_Metrics_Exporter_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "colony_config.h"
+#include "Fxt/Metrics/Registry.h"
+#include "Cpl/Io/Socket/Listener.h"
+#include "Cpl/Io/Socket/InputOutput.h"
+#include "Cpl/System/Mutex.h"
+#include "Cpl/Text/FString.h"
+
+
+/// Polling interval, in milliseconds, of the Exporter thread
+#ifndef OPTION_FXT_METRICS_EXPORTER_POLL_MS
+#define OPTION_FXT_METRICS_EXPORTER_POLL_MS         10
+#endif
+
+/// Time, in milliseconds, allowed for a client to send its complete HTTP request
+#ifndef OPTION_FXT_METRICS_REQUEST_TIMEOUT_MS
+#define OPTION_FXT_METRICS_REQUEST_TIMEOUT_MS       1000
+#endif
+
+/// Maximum length, in bytes, of the HTTP request line that is retained (the remainder of the request is discarded)
+#ifndef OPTION_FXT_METRICS_MAX_REQUEST_LINE_LEN
+#define OPTION_FXT_METRICS_MAX_REQUEST_LINE_LEN     128
+#endif
+
+/// Maximum length, in bytes, of a single rendered line
+#ifndef OPTION_FXT_METRICS_MAX_LINE_LEN
+#define OPTION_FXT_METRICS_MAX_LINE_LEN             256
+#endif
+
+
+///
+namespace Fxt {
+///
+namespace Metrics {
+
+
+/** This concrete class is a minimal HTTP/1.0 server that exposes the content
+    of a Fxt::Metrics::Registry in the Prometheus text format, i.e. it
+    responds to 'GET /metrics' (and 'GET /') requests.  Any other request is
+    rejected.  Each connection serves a single request and then it is closed
+    (i.e. the response body is terminated by closing the connection).
+
+    The Exporter executes in its own thread, i.e. rendering the metrics never
+    executes in - or blocks - a Chassis thread.  The Application is
+    responsible for starting a Cpl::Io::Socket::Listener (with this instance
+    as the Listener's client).  The Listener's callback only hands off the
+    connection.  A newly accepted connection that has not yet been served
+    replaces a previously accepted connection that has not been served.
+
+    Usage: curl http://localhost:<port>/metrics
+ */
+class Exporter : public Cpl::System::Runnable, public Cpl::Io::Socket::Listener::Client
+{
+public:
+    /// Constructor
+    Exporter( Registry& registry ) noexcept;
+
+    /// Destructor
+    ~Exporter();
+
+public:
+    /// Returns the number of requests that have been served (successfully or not)
+    unsigned long getNumRequests() const noexcept { return m_numRequests; }
+
+public:
+    /// See Cpl::Io::Socket::Listener::Client
+    bool newConnection( Cpl::Io::Descriptor newFd, const char* rawConnectionInfo );
+
+    /// See Cpl::System::Runnable
+    void pleaseStop();
+
+protected:
+    /// See Cpl::System::Runnable
+    void appRun();
+
+protected:
+    /// Helper method: reads the request and sends the response
+    void serve() noexcept;
+
+    /// Helper method: reads the HTTP request header.  Returns false on an IO error or time-out
+    bool readRequest() noexcept;
+
+protected:
+    /// Registry
+    Registry&                                                     m_registry;
+
+    /// Mutex (protects the pending connection)
+    Cpl::System::Mutex                                            m_lock;
+
+    /// Socket stream
+    Cpl::Io::Socket::InputOutput                                  m_stream;
+
+    /// Accepted connection that has not yet been handed off to the Exporter thread
+    Cpl::Io::Descriptor                                           m_pendingFd;
+
+    /// The request line (i.e. the first line) of the current request
+    Cpl::Text::FString<OPTION_FXT_METRICS_MAX_REQUEST_LINE_LEN>   m_requestLine;
+
+    /// Work buffer for rendering
+    Cpl::Text::FString<OPTION_FXT_METRICS_MAX_LINE_LEN>           m_workBuffer;
+
+    /// Statistics
+    volatile unsigned long                                        m_numRequests;
+
+    /// True when there is pending connection
+    bool                                                          m_pending;
+
+    /// Stop request
+    volatile bool                                                 m_stopRequested;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
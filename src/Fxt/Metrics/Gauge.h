@@ -0,0 +1,72 @@
+#ifndef Fxt_Metrics_Gauge_h_
+#define Fxt_Metrics_Gauge_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Metrics/Metric.h"
+#include <atomic>
+
+
+///
+namespace Fxt {
+///
+namespace Metrics {
+
+
+/** This concrete class implements a lock-free gauge metric.  The value is a
+    'long' so that it is lock-free on both 32 bit and 64 bit targets.
+ */
+class Gauge : public Metric
+{
+public:
+    /// Constructor
+    Gauge( const char* name, const char* help, const char* labels = nullptr ) noexcept
+        : Metric( name, help, eGAUGE, labels )
+        , m_value( 0 )
+    {
+    }
+
+public:
+    /// Sets the gauge's value
+    inline void set( long newValue ) noexcept
+    {
+        m_value.store( newValue, std::memory_order_relaxed );
+    }
+
+    /// Adds 'delta' (which can be negative) to the gauge's value
+    inline void add( long delta ) noexcept
+    {
+        m_value.fetch_add( delta, std::memory_order_relaxed );
+    }
+
+    /// Returns the gauge's value
+    inline long get() const noexcept
+    {
+        return m_value.load( std::memory_order_relaxed );
+    }
+
+public:
+    /// See Fxt::Metrics::Metric
+    void appendValue( Cpl::Text::String& dst ) const noexcept
+    {
+        dst.formatAppend( "%ld", get() );
+    }
+
+protected:
+    /// Value
+    std::atomic<long>   m_value;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
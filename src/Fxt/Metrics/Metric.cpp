@@ -0,0 +1,32 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Metric.h"
+
+///
+using namespace Fxt::Metrics;
+
+
+//////////////////////////////////////////////////
+Metric::Metric( const char* name, const char* help, Type_T type, const char* labels ) noexcept
+    : m_name( name )
+    , m_help( help )
+    , m_labels( labels )
+    , m_type( type )
+{
+}
+
+const char* Metric::getTypeText() const noexcept
+{
+    return m_type == eCOUNTER ? "counter" : "gauge";
+}
@@ -0,0 +1,96 @@
+#ifndef Fxt_Metrics_Metric_h_
+#define Fxt_Metrics_Metric_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/Container/Item.h"
+#include "Cpl/Text/String.h"
+
+
+///
+namespace Fxt {
+///
+namespace Metrics {
+
+
+/** This abstract class defines a single named metric that can be registered
+    with a Fxt::Metrics::Registry.  Metrics with the same name (but with
+    different labels) are rendered as a single metric 'family', i.e. they
+    MUST have the same help text and type.
+
+    The name, help text, and labels strings are NOT copied, i.e. they must
+    stay in scope for the life time of the metric.  The 'labels' string is
+    the content of Prometheus label set WITHOUT the enclosing braces, e.g.
+    'chassis="0",heap="general"'.  A nullptr or empty string means the metric
+    has no labels.
+
+    Updating the metric's value is lock-free, i.e. it can be done from any
+    thread (including a Chassis thread) without blocking.
+ */
+class Metric : public Cpl::Container::Item
+{
+public:
+    /// Metric types
+    enum Type_T
+    {
+        eCOUNTER = 0,   //!< Monotonically increasing value
+        eGAUGE          //!< Value that can go up and down
+    };
+
+public:
+    /// Constructor
+    Metric( const char* name, const char* help, Type_T type, const char* labels = nullptr ) noexcept;
+
+public:
+    /// Returns the metric's name
+    inline const char* getName() const noexcept { return m_name; }
+
+    /// Returns the metric's help text
+    inline const char* getHelp() const noexcept { return m_help; }
+
+    /// Returns the metric's labels (returns nullptr if there are no labels)
+    inline const char* getLabels() const noexcept { return m_labels; }
+
+    /// Returns the metric's type
+    inline Type_T getType() const noexcept { return m_type; }
+
+    /// Returns the metric's type as a Prometheus type string
+    const char* getTypeText() const noexcept;
+
+public:
+    /** This method appends the metric's current value (as text) to 'dst'.
+        The method can be called from any thread.
+     */
+    virtual void appendValue( Cpl::Text::String& dst ) const noexcept = 0;
+
+public:
+    /// Virtual destructor
+    virtual ~Metric() {}
+
+protected:
+    /// Name
+    const char*     m_name;
+
+    /// Help text
+    const char*     m_help;
+
+    /// Labels
+    const char*     m_labels;
+
+    /// Type
+    Type_T          m_type;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
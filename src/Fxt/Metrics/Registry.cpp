@@ -0,0 +1,122 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Registry.h"
+#include <string.h>
+
+///
+using namespace Fxt::Metrics;
+
+
+//////////////////////////////////////////////////
+Registry::Registry() noexcept
+{
+}
+
+void Registry::add( Metric& metricToAdd ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    m_metrics.putLast( metricToAdd );
+}
+
+void Registry::remove( Metric& metricToRemove ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    m_metrics.remove( metricToRemove );
+}
+
+void Registry::add( Collector& collectorToAdd ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    m_collectors.putLast( collectorToAdd );
+}
+
+void Registry::remove( Collector& collectorToRemove ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    m_collectors.remove( collectorToRemove );
+}
+
+//////////////////////////////////////////////////
+bool Registry::render( Cpl::Io::Output& dst, Cpl::Text::String& workBuffer ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+
+    // Sample the 'external' values
+    Collector* collector = m_collectors.first();
+    while ( collector )
+    {
+        collector->collect();
+        collector = m_collectors.next( *collector );
+    }
+
+    // Render one metric family at a time (the number of metrics is small, i.e. the O(n^2) search is acceptable)
+    Metric* family = m_metrics.first();
+    while ( family )
+    {
+        if ( !isFamilyRendered( *family ) )
+        {
+            workBuffer.format( "# HELP %s %s\n", family->getName(), family->getHelp() );
+            if ( !dst.write( workBuffer ) )
+            {
+                return false;
+            }
+            workBuffer.format( "# TYPE %s %s\n", family->getName(), family->getTypeText() );
+            if ( !dst.write( workBuffer ) )
+            {
+                return false;
+            }
+
+            Metric* metric = family;
+            while ( metric )
+            {
+                if ( strcmp( metric->getName(), family->getName() ) == 0 )
+                {
+                    const char* labels = metric->getLabels();
+                    if ( labels && *labels != '\0' )
+                    {
+                        workBuffer.format( "%s{%s} ", metric->getName(), labels );
+                    }
+                    else
+                    {
+                        workBuffer.format( "%s ", metric->getName() );
+                    }
+                    metric->appendValue( workBuffer );
+                    workBuffer += '\n';
+                    if ( !dst.write( workBuffer ) )
+                    {
+                        return false;
+                    }
+                }
+                metric = m_metrics.next( *metric );
+            }
+        }
+        family = m_metrics.next( *family );
+    }
+
+    return true;
+}
+
+bool Registry::isFamilyRendered( const Metric& metric ) const noexcept
+{
+    Metric* item = m_metrics.first();
+    while ( item && item != &metric )
+    {
+        if ( strcmp( item->getName(), metric.getName() ) == 0 )
+        {
+            return true;
+        }
+        item = m_metrics.next( *item );
+    }
+    return false;
+}
@@ -0,0 +1,91 @@
+#ifndef Fxt_Metrics_Registry_h_
+#define Fxt_Metrics_Registry_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Metrics/Metric.h"
+#include "Fxt/Metrics/Collector.h"
+#include "Cpl/Container/SList.h"
+#include "Cpl/System/Mutex.h"
+#include "Cpl/Io/Output.h"
+
+
+///
+namespace Fxt {
+///
+namespace Metrics {
+
+
+/** This concrete class is a registry of metrics (and collectors).  The
+    registry renders the metrics using the Prometheus text exposition format,
+    i.e. each metric family (all metrics with the same name) is rendered as:
+
+    \code
+    # HELP <name> <help text>
+    # TYPE <name> counter|gauge
+    <name>{<labels>} <value>
+    ...
+    \endcode
+
+    Adding/removing metrics and rendering are thread safe.  The registry's
+    mutex is NOT used when a metric's value is updated, i.e. the threads that
+    update metric values (e.g. the Chassis threads) are never blocked by the
+    rendering.  Note: A metric MUST be removed from the registry before it is
+    destroyed.
+ */
+class Registry
+{
+public:
+    /// Constructor
+    Registry() noexcept;
+
+public:
+    /// Adds a metric
+    void add( Metric& metricToAdd ) noexcept;
+
+    /// Removes a metric
+    void remove( Metric& metricToRemove ) noexcept;
+
+    /// Adds a collector
+    void add( Collector& collectorToAdd ) noexcept;
+
+    /// Removes a collector
+    void remove( Collector& collectorToRemove ) noexcept;
+
+public:
+    /** This method calls all of the registered collectors and then renders
+        all of the registered metrics to 'dst'.  The 'workBuffer' is used to
+        format each output line, i.e. it must be large enough for the longest
+        line (a line that does not fit is truncated).  Returns false if there
+        was an error writing to 'dst'.
+     */
+    bool render( Cpl::Io::Output& dst, Cpl::Text::String& workBuffer ) noexcept;
+
+protected:
+    /// Helper method: returns true if a metric - before 'metric' in the list - has the same name
+    bool isFamilyRendered( const Metric& metric ) const noexcept;
+
+protected:
+    /// Mutex
+    Cpl::System::Mutex                  m_lock;
+
+    /// Registered metrics
+    Cpl::Container::SList<Metric>       m_metrics;
+
+    /// Registered collectors
+    Cpl::Container::SList<Collector>    m_collectors;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
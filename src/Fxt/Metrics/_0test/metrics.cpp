@@ -0,0 +1,279 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Metrics/Registry.h"
+#include "Fxt/Metrics/Counter.h"
+#include "Fxt/Metrics/Gauge.h"
+#include "Fxt/Metrics/Exporter.h"
+#include "Fxt/Node/Metrics/Collector.h"
+#include "Fxt/Node/Mock/Kestrel/Factory.h"
+#include "Fxt/Card/Mock/AnalogIn8.h"
+#include "Cpl/Io/Socket/Posix/Listener.h"
+#include "Cpl/Io/Socket/Posix/Connector.h"
+#include "Cpl/Io/Socket/InputOutput.h"
+#include "Cpl/System/Thread.h"
+#include "Cpl/System/Trace.h"
+#include "Cpl/System/Api.h"
+#include <string.h>
+
+#define SECT_                   "_0test"
+
+#define PORT_NUM_               5048
+
+#define MAX_POINTS              23
+
+#define HEAP_SIZE_GENERAL       10000
+#define HEAP_SIZE_CARD          (Fxt::Card::Mock::AnalogIn8::CARD_STATEFUL_HEAP_SIZE)
+#define HEAP_SIZE_HA            10000
+
+#define WAIT_LOOP_MS            10
+#define MAX_WAIT_LOOPS          1000
+
+///
+using namespace Fxt::Metrics;
+
+static const char* NODE_DEFINITION = R"literalString(
+{
+  "name": "My Metrics Kestrel Node",
+  "id": 3,
+  "type": "d65ee614-dce4-43f0-af2c-830e3664ecaf",
+  "chassis": [
+    {
+      "name": "My Chassis",
+      "id": 1,
+      "scanners": [
+        {
+          "name": "My Scanner",
+          "id": 1,
+          "cards": [
+            {
+              "name": "bob",
+              "type": "1968f533-e323-4ae4-8493-9a572f3bd195",
+              "slot": 22,
+              "points": {
+                "inputs": [
+                  {
+                    "channel": 2,
+                    "id": 4,
+                    "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+                    "initial": { "valid": true, "val": 1.2, "id": 6 },
+                    "ioRegId": 5
+                  }
+                ]
+              }
+            }
+          ],
+          "scanRateMultiplier": 1
+        }
+      ],
+      "executionSets": [
+        {
+          "name": "My Execution Set",
+          "id": 1,
+          "logicChains": [
+            {
+              "name": "my logic chain",
+              "id": 1,
+              "components": [
+                {
+                  "id": 101,
+                  "name": "AND Gate#1",
+                  "type": "e62e395c-d27a-4821-bba9-aa1e6de42a05",
+                  "inputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 0 },
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 21 }
+                  ],
+                  "outputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 20 }
+                  ]
+                }
+              ],
+              "connectionPts": [
+                { "id": 20, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0" }
+              ],
+              "autoPts": [
+                { "id": 21, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 22 } }
+              ]
+            }
+          ],
+          "exeRateMultiplier": 1
+        }
+      ],
+      "sharedPts": [
+        { "id": 0, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 1 } }
+      ],
+      "fer": 1000
+    }
+  ]
+}
+)literalString";
+
+/// Output stream that captures the rendered text
+class StringOutput : public Cpl::Io::Output
+{
+public:
+    StringOutput( Cpl::Text::String& dst ) :m_dst( dst ) {}
+
+    bool write( const void* buffer, int maxBytes, int& bytesWritten )
+    {
+        m_dst.appendTo( (const char*) buffer, maxBytes );
+        bytesWritten = maxBytes;
+        return true;
+    }
+    void flush() {}
+    bool isEos() { return false; }
+    void close() {}
+
+    Cpl::Text::String& m_dst;
+};
+
+/// Sends an HTTP request and returns the complete response
+static bool httpRequest( const char* request, Cpl::Text::String& response )
+{
+    Cpl::Io::Socket::Posix::Connector connector;
+    Cpl::Io::Descriptor               fd;
+    if ( connector.establish( "localhost", PORT_NUM_, fd ) != Cpl::Io::Socket::Connector::eSUCCESS )
+    {
+        return false;
+    }
+
+    Cpl::Io::Socket::InputOutput stream( fd );
+    bool                         result = stream.write( request );
+    response.clear();
+    char buffer[128];
+    int  bytesRead;
+    while ( result && stream.read( buffer, sizeof( buffer ) - 1, bytesRead ) && bytesRead > 0 )
+    {
+        response.appendTo( buffer, bytesRead );
+    }
+    stream.close();
+    return result;
+}
+
+/// Waits (but not forever) for a Runnable to terminate
+static void waitForStop( Cpl::System::Runnable& runnable )
+{
+    for ( int i=0; i < MAX_WAIT_LOOPS && runnable.isRunning(); i++ )
+    {
+        Cpl::System::Api::sleep( WAIT_LOOP_MS );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Metrics" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+    Registry                  uut;
+    Cpl::Text::FString<4096>  text;
+    Cpl::Text::FString<128>   workBuf;
+    StringOutput              out( text );
+
+    SECTION( "render" )
+    {
+        Counter requests( "app_requests_total", "Number of requests", "path=\"/a\"" );
+        Gauge   depth( "app_queue_depth", "Queue depth" );
+        Counter requestsB( "app_requests_total", "Number of requests", "path=\"/b\"" );
+        uut.add( requests );
+        uut.add( depth );
+        uut.add( requestsB );
+
+        requests.increment();
+        requests.increment( 2 );
+        requestsB.set( 7 );
+        depth.set( 5 );
+        depth.add( -7 );
+        REQUIRE( requests.get() == 3 );
+        REQUIRE( depth.get() == -2 );
+
+        REQUIRE( uut.render( out, workBuf ) );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("\n%s", text.getString()) );
+        REQUIRE( text == "# HELP app_requests_total Number of requests\n"
+                         "# TYPE app_requests_total counter\n"
+                         "app_requests_total{path=\"/a\"} 3\n"
+                         "app_requests_total{path=\"/b\"} 7\n"
+                         "# HELP app_queue_depth Queue depth\n"
+                         "# TYPE app_queue_depth gauge\n"
+                         "app_queue_depth -2\n" );
+
+        uut.remove( requests );
+        text.clear();
+        REQUIRE( uut.render( out, workBuf ) );
+        REQUIRE( text.indexOf( "# TYPE app_requests_total counter\napp_requests_total{path=\"/b\"} 7\n" ) >= 0 );
+        REQUIRE( text.indexOf( "{path=\"/a\"}" ) < 0 );
+        uut.remove( depth );
+        uut.remove( requestsB );
+    }
+
+    SECTION( "node collector + exporter" )
+    {
+        Fxt::Point::Database<MAX_POINTS>    pointDb;
+        Fxt::Type::Error                    nodeError;
+        Fxt::Node::Mock::Kestrel::Factory   factory( HEAP_SIZE_GENERAL, HEAP_SIZE_CARD, HEAP_SIZE_HA );
+        StaticJsonDocument<10240>           doc;
+        REQUIRE( deserializeJson( doc, NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+        JsonVariant     nodeJsonObj = doc.as<JsonVariant>();
+        Fxt::Node::Api* node        = factory.createFromJSON( nodeJsonObj, pointDb, nodeError );
+        REQUIRE( node );
+
+        Fxt::Node::Metrics::Collector collector( *node, uut );
+        REQUIRE( node->start( Fxt::System::ElapsedTime::now() ) );
+        Cpl::System::Api::sleep( 100 );
+
+        REQUIRE( uut.render( out, workBuf ) );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("\n%s", text.getString()) );
+        REQUIRE( text.indexOf( "# TYPE fxt_chassis_cycles_total counter\n" ) >= 0 );
+        REQUIRE( text.indexOf( "fxt_chassis_cycles_total{chassis=\"0\"} 0\n" ) < 0 );
+        REQUIRE( text.indexOf( "fxt_chassis_card_errors{chassis=\"0\"} 0\n" ) >= 0 );
+        REQUIRE( text.indexOf( "fxt_node_heap_alloc_failures_total{heap=\"general\"} 0\n" ) >= 0 );
+        REQUIRE( text.indexOf( "fxt_node_heap_size_bytes{heap=\"haStateful\"} " ) >= 0 );
+        REQUIRE( text.indexOf( "fxt_log_overflows_total 0\n" ) >= 0 );
+        REQUIRE( node->getChassis( 0 )->getServer().getNumCycles() > 0 );
+        REQUIRE( node->getChassis( 0 )->getServer().getMaxCycleTime() >= node->getChassis( 0 )->getServer().getLastCycleTime() );
+        REQUIRE( node->getChassis( 0 )->getServer().getMaxCycleTime() % 1000000UL != 0 );   // i.e. NOT quantized to 1ms
+
+        // Scrape over a socket
+        Exporter                         exporter( uut );
+        Cpl::Io::Socket::Posix::Listener listener;
+        Cpl::System::Thread*             exporterThread = Cpl::System::Thread::create( exporter, "Exporter" );
+        Cpl::System::Thread*             listenerThread = Cpl::System::Thread::create( listener, "Listener" );
+        REQUIRE( exporterThread );
+        REQUIRE( listenerThread );
+        listener.startListening( exporter, PORT_NUM_ );
+        Cpl::System::Api::sleep( 100 );
+
+        Cpl::Text::FString<4096> response;
+        REQUIRE( httpRequest( "GET /metrics HTTP/1.1\r\nHost: localhost\r\nAccept: */*\r\n\r\n", response ) );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("\n%s", response.getString()) );
+        REQUIRE( response.startsWith( "HTTP/1.0 200 OK\r\n" ) );
+        REQUIRE( response.indexOf( "\r\n\r\n# HELP fxt_chassis_cycles_total " ) >= 0 );
+        REQUIRE( response.indexOf( "fxt_node_heap_used_bytes{heap=\"cardStateful\"} " ) >= 0 );
+
+        REQUIRE( httpRequest( "GET /bob HTTP/1.1\r\n\r\n", response ) );
+        REQUIRE( response.startsWith( "HTTP/1.0 404 " ) );
+        REQUIRE( httpRequest( "POST /metrics HTTP/1.1\r\n\r\n", response ) );
+        REQUIRE( response.startsWith( "HTTP/1.0 405 " ) );
+        REQUIRE( exporter.getNumRequests() == 3 );
+
+        listener.terminate();
+        exporter.pleaseStop();
+        waitForStop( exporter );
+        waitForStop( listener );
+        Cpl::System::Thread::destroy( *exporterThread );
+        Cpl::System::Thread::destroy( *listenerThread );
+
+        node->stop();
+        factory.destroy( *node );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
@@ -0,0 +1,107 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "AccountingHeap.h"
+#include <string.h>
+#include <new>
+
+#define BYTES_TO_WORDS(n)		(( (n) + ( sizeof( size_t ) - 1 ) ) / sizeof( size_t ))
+
+///
+using namespace Fxt::Node;
+
+
+//////////////////////////////////////////////////
+AccountingHeap::AccountingHeap( size_t* heapMemory, size_t sizeInBytes, bool zeroFill )
+    : LeanHeap( heapMemory, sizeInBytes, zeroFill )
+    , m_overflow( nullptr )
+    , m_numFailures( 0 )
+    , m_highWatermark( 0 )
+    , m_measureMode( false )
+{
+    memset( m_bytesByTag, 0, sizeof( m_bytesByTag ) );
+}
+
+AccountingHeap::~AccountingHeap()
+{
+    clearUsage();
+}
+
+//////////////////////////////////////////////////
+void* AccountingHeap::allocate( size_t numbytes )
+{
+    size_t numWords = BYTES_TO_WORDS( numbytes );
+    m_bytesByTag[Fxt::System::AllocTag::getCurrent()] += numWords * sizeof( size_t );
+
+    void* result = LeanHeap::allocate( numbytes );
+    if ( result )
+    {
+        size_t used = (m_staringHeapSize - m_wordsRemaining) * sizeof( size_t );
+        if ( used > m_highWatermark )
+        {
+            m_highWatermark = used;
+        }
+        return result;
+    }
+
+    // Satisfy the request from the platform heap when measuring
+    if ( m_measureMode )
+    {
+        size_t* block = new(std::nothrow) size_t[numWords + 1];
+        if ( block )
+        {
+            memset( block, 0, (numWords + 1) * sizeof( size_t ) );
+            *block     = (size_t) m_overflow;
+            m_overflow = block;
+            return block + 1;
+        }
+    }
+
+    m_numFailures++;
+    return nullptr;
+}
+
+void AccountingHeap::reset() noexcept
+{
+    LeanHeap::reset();
+    clearUsage();
+}
+
+void AccountingHeap::clearUsage() noexcept
+{
+    while ( m_overflow )
+    {
+        size_t* next = (size_t*) *m_overflow;
+        delete[] m_overflow;
+        m_overflow = next;
+    }
+    memset( m_bytesByTag, 0, sizeof( m_bytesByTag ) );
+    m_numFailures = 0;
+}
+
+//////////////////////////////////////////////////
+void AccountingHeap::getUsage( HeapUsage_T& dst ) noexcept
+{
+    dst.totalBytes    = m_staringHeapSize * sizeof( size_t );
+    dst.usedBytes     = (m_staringHeapSize - m_wordsRemaining) * sizeof( size_t );
+    dst.highWatermark = m_highWatermark;
+    dst.numFailures   = m_numFailures;
+    dst.requiredBytes = 0;
+    dst.locked        = false;
+    dst.hugePages     = false;
+    for ( unsigned i=0; i < Fxt::System::AllocTag::eNUM_TAGS; i++ )
+    {
+        dst.bytesByTag[i]  = m_bytesByTag[i];
+        dst.requiredBytes += m_bytesByTag[i];
+    }
+}
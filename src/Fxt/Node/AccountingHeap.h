@@ -0,0 +1,96 @@
+#ifndef Fxt_Node_AccountingHeap_h_
+#define Fxt_Node_AccountingHeap_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Cpl/Memory/LeanHeap.h"
+#include "Fxt/System/AllocTag.h"
+
+///
+namespace Fxt {
+///
+namespace Node {
+
+
+/// Heap usage/accounting information
+struct HeapUsage_T
+{
+    size_t totalBytes;                                      //!< Size, in bytes, of the heap
+    size_t usedBytes;                                       //!< Number of bytes currently allocated from the heap
+    size_t highWatermark;                                   //!< Maximum number of bytes allocated from the heap (across resets)
+    size_t requiredBytes;                                   //!< Number of bytes requested from the heap (includes failed requests, and 'overflow' allocations when in measure mode)
+    size_t numFailures;                                     //!< Number of failed allocations
+    size_t bytesByTag[Fxt::System::AllocTag::eNUM_TAGS];    //!< Number of bytes requested by sub-system (see Fxt::System::AllocTag)
+    bool   locked;                                          //!< True if the heap's memory is pre-faulted and locked into physical memory (see Fxt::System::LockedMemory)
+    bool   hugePages;                                       //!< True if the heap's memory is backed by huge pages
+};
+
+
+/** This concrete class extends the LeanHeap to track its memory usage by
+    sub-system (see Fxt::System::AllocTag).
+
+    The heap also supports a 'measure' mode.  When in measure mode, requests
+    that do not fit in the heap are satisfied from the platform's heap (aka
+    new/delete) instead of failing.  This allows an Application to determine
+    the exact heap requirements - for a given Node definition - by performing
+    a dry-run Node creation with arbitrarily small heaps.  The 'overflow'
+    memory is freed when the heap is reset or destroyed.
+ */
+class AccountingHeap : public Cpl::Memory::LeanHeap
+{
+public:
+    /// Constructor.  See Cpl::Memory::LeanHeap
+    AccountingHeap( size_t* heapMemory, size_t sizeInBytes, bool zeroFill = true );
+
+    /// Destructor
+    ~AccountingHeap();
+
+public:
+    /// See Cpl::Memory::Allocator
+    void* allocate( size_t numbytes );
+
+    /// See Cpl::Memory::ContiguousAllocator.  Note: The usage (but not the high watermark) is cleared
+    void reset() noexcept;
+
+public:
+    /// Enables/disables measure mode
+    void setMeasureMode( bool enabled ) noexcept { m_measureMode = enabled; }
+
+    /// Returns the heap's usage/accounting information
+    void getUsage( HeapUsage_T& dst ) noexcept;
+
+protected:
+    /// Helper method: clears the usage information (and frees any overflow memory)
+    void clearUsage() noexcept;
+
+protected:
+    /// Overflow allocations (when in measure mode). The first word of each block is the link to the next block
+    size_t*     m_overflow;
+
+    /// Requested bytes by tag
+    size_t      m_bytesByTag[Fxt::System::AllocTag::eNUM_TAGS];
+
+    /// Number of failed allocations
+    size_t      m_numFailures;
+
+    /// High watermark (in bytes)
+    size_t      m_highWatermark;
+
+    /// Measure mode
+    bool        m_measureMode;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
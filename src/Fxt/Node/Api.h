@@ -16,7 +16,10 @@
 #include "Fxt/Type/Error.h"
 #include "Fxt/Chassis/Api.h"
 #include "Fxt/Point/DatabaseApi.h"
+#include "Fxt/Node/AccountingHeap.h"
+#include "Fxt/Node/ConfigDigest.h"
 #include "Cpl/System/Thread.h"
+#include "Cpl/Container/Item.h"
 #include "Cpl/Json/Arduino.h"
 #include <stdint.h>
 
@@ -30,9 +33,17 @@ namespace Node {
 
 /** This abstract class defines operations that can be performed on Node
 
+    A process can contain multiple Node instances (e.g. many simulated Nodes
+    for plant-scale simulation or HIL testing).  Each Node has its own heaps,
+    Point Database, and Chassis threads.  The Factory databases (i.e. the
+    Point, IO Card, and Component factories) and the type metadata are
+    shared - read-only - by all of the Nodes.  The Node Factory maintains the
+    list of Nodes, i.e. the Node 'is-a' Item so that it can be contained in
+    the list (see getNode(), getNumNodes()).
+
     NOTE: Node semantics are NOT thread-safe.
  */
-class Api
+class Api : public Cpl::Container::Item
 {
 public:
     /** This method is used to start/run the Node's chassis. If the node fails
@@ -74,6 +85,27 @@ public:
     /// Returns the Node's HA Stateful allocator
     virtual Cpl::Memory::ContiguousAllocator&   getHaStatefulAlloactor() noexcept = 0;
 
+public:
+    /// Identifies the Node's heaps
+    enum HeapId_T
+    {
+        eGENERAL_HEAP = 0,      //!< General heap
+        eCARD_STATEFUL_HEAP,    //!< Card stateful data heap
+        eHA_STATEFUL_HEAP,      //!< HA stateful data heap
+        eNUM_HEAPS              //!< Number of heaps (not a valid heap)
+    };
+
+    /** This method returns the usage/accounting information for the specified
+        heap. Returns false if 'heap' is not valid.
+     */
+    virtual bool getHeapUsage( HeapId_T heap, HeapUsage_T& dst ) noexcept = 0;
+
+    /** This method enables 'measure mode' for all of the Node's heaps (see
+        Fxt::Node::AccountingHeap).  This method should only be called as part
+        of a 'dry-run' Node creation (see Fxt::Node::FactoryApi::measureFromJSON())
+     */
+    virtual void enableHeapMeasureMode() noexcept = 0;
+
 
 public:
     /**  Returns the total number of Chassis instances. If the Node is in an 
@@ -86,12 +118,41 @@ public:
      */
     virtual Fxt::Chassis::Api* getChassis( uint16_t chassisIndex ) noexcept = 0;
 
+    /** Returns the index of the CPU core that the specified Chassis' thread is
+        pinned to (see Fxt::System::CpuAffinity). NOT_PINNED is returned if
+        the Chassis' thread is not pinned to a core, or the index is not valid.
+     */
+    virtual int getChassisCpuCore( uint16_t chassisIndex ) const noexcept = 0;
+
+    /** This method returns the region of the HA Stateful heap that was
+        allocated by the specified Chassis, i.e. 'offset' is relative to the
+        start of the HA heap.  The regions of the Node's Chassis are
+        contiguous and in Chassis order, i.e. a region includes the gap (see
+        FactoryCommon_::separateChassisHeaps()) that precedes it, and the last
+        Chassis' region extends to the end of the allocated HA data.  Returns
+        false if the index is not valid or the region was not recorded (see
+        setChassisHaEnd()).
+     */
+    virtual bool getChassisHaRegion( uint16_t chassisIndex, size_t& offset, size_t& len ) noexcept = 0;
+
+    /** This method records the end (i.e. the number of allocated bytes of
+        the HA Stateful heap) of the specified Chassis' HA data.  This method
+        is used by the Node Factory.
+     */
+    virtual void setChassisHaEnd( uint16_t chassisIndex, size_t haEndOffset ) noexcept = 0;
+
+    /// Value returned by getChassisCpuCore() when a Chassis thread is NOT pinned to a core
+    static constexpr int NOT_PINNED = -1;
+
 public:
     /** This method is used to add a Chassis to the Node.  If the add is
         successful then Fxt::Type::Err_T::SUCCESS is returned; else and error
         code is returned.
 
         Note: Node will destroy the thread when the Node is deleted.
+
+        Note: If the Node was configured to pin the Chassis to a CPU core, the
+              Chassis' thread is pinned when the Chassis is added.
      */
     virtual Fxt::Type::Error add( Fxt::Chassis::Api&       chassisToAdd,
                                   Cpl::System::Thread&     chassisThreadToAdd ) noexcept = 0;
@@ -103,6 +164,21 @@ public:
      */
     virtual Fxt::Type::Error getErrorCode() const noexcept = 0;
 
+public:
+    /** This method returns the digest of the JSON definition that the Node
+        was created from (see Fxt::Node::ConfigDigest).  nullptr is returned
+        if the Node was NOT created by FactoryApi::createFromJSON() (i.e. it
+        was created from a JSON stream or a Node Image), or if there was
+        insufficient memory to create the digest.
+     */
+    virtual const ConfigDigest* getConfigDigest() const noexcept = 0;
+
+    /** This method transfers ownership of 'digest' to the Node, i.e. the
+        Node deletes the digest when the Node is deleted.  This method is
+        used by the Node Factory.
+     */
+    virtual void setConfigDigest( ConfigDigest* digest ) noexcept = 0;
+
 public:
     /** This method creates a Chassis server (aka runnable object) and the 
         thread that the Chassis to execute in. When successful a pointer to the 
@@ -121,12 +197,23 @@ public:
     virtual void destroyChassisThread( Cpl::System::Thread& chassisThreadToDelete ) noexcept = 0;
 
 public:
-    /** Returns a pointer to the one-and-only created Node instance for the platform.
-        If the Node has not yet been created (or has been destroyed), then nullptr is 
-        returned.
+    /** Returns a pointer to the 'current' Node instance, i.e. the most
+        recently created Node that has not been destroyed.  If there are no
+        Nodes, then nullptr is returned.  For a platform with a single Node,
+        this is the one-and-only Node instance.
      */
     static Api* getNode() noexcept;
 
+    /** Returns a pointer to the Node at position 'index' in the list of
+        Nodes (in creation order).  If 'index' is out of range, then nullptr
+        is returned.  Note: The position of a Node changes when a Node that
+        was created before it is destroyed.
+     */
+    static Api* getNode( uint16_t index ) noexcept;
+
+    /// Returns the number of Node instances (that have not been destroyed)
+    static uint16_t getNumNodes() noexcept;
+
 public:
     /// Virtual destructor to make the compiler happy
     virtual ~Api() {}
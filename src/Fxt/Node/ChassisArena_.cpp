@@ -0,0 +1,125 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "ChassisArena_.h"
+
+#define ROUND_TO_SIZET(n)       ((((n) + sizeof( size_t ) - 1) / sizeof( size_t )) * sizeof( size_t ))
+#define ROUND_UP(n,a)           Fxt::System::CacheAlignedAllocator::roundUp( n, a )
+
+///
+using namespace Fxt::Node;
+
+
+//////////////////////////////////////////////////
+ChassisArena_::ChassisArena_( Cpl::Memory::ContiguousAllocator& parent, Cpl::System::Mutex& parentLock, size_t alignment ) noexcept
+    : m_parent( parent )
+    , m_parentLock( parentLock )
+    , m_ptr( nullptr )
+    , m_remaining( 0 )
+    , m_allocated( 0 )
+    , m_alignment( alignment )
+    , m_chunkSize( ROUND_UP( OPTION_FXT_NODE_CHASSIS_ARENA_CHUNK_SIZE > alignment ? OPTION_FXT_NODE_CHASSIS_ARENA_CHUNK_SIZE : alignment, alignment ) )
+{
+}
+
+//////////////////////////////////////////////////
+void* ChassisArena_::allocate( size_t numbytes )
+{
+    // Keep all allocations aligned to size_t (same as the LeanHeap)
+    numbytes = ROUND_TO_SIZET( numbytes );
+
+    // Allocate from the current chunk
+    if ( numbytes <= m_remaining )
+    {
+        void* result = m_ptr;
+        m_ptr       += numbytes;
+        m_remaining -= numbytes;
+        m_allocated += numbytes;
+        return result;
+    }
+
+    // Large requests bypass the arena (so as not to discard the current chunk)
+    if ( numbytes > m_chunkSize / 2 )
+    {
+        Cpl::System::Mutex::ScopeBlock criticalSection( m_parentLock );
+        void* result = allocateFromParent( numbytes );
+        if ( result )
+        {
+            m_allocated += numbytes;
+        }
+        return result;
+    }
+
+    // Get a new chunk
+    void* chunk;
+    {
+        Cpl::System::Mutex::ScopeBlock criticalSection( m_parentLock );
+        chunk = allocateFromParent( m_chunkSize );
+        if ( chunk == nullptr )
+        {
+            // The parent does not have room for a full chunk -->try an exact allocation
+            chunk = allocateFromParent( numbytes );
+            if ( chunk )
+            {
+                m_allocated += numbytes;
+            }
+            return chunk;
+        }
+    }
+
+    m_ptr        = ((uint8_t*) chunk) + numbytes;
+    m_remaining  = m_chunkSize - numbytes;
+    m_allocated += numbytes;
+    return chunk;
+}
+
+void* ChassisArena_::allocateFromParent( size_t numbytes ) noexcept
+{
+    // Pad the request so the block 'owns' all of its cache lines/pages
+    size_t   alignedSize = ROUND_UP( numbytes, m_alignment );
+    size_t   padding;
+    size_t   usedLen;
+    uint8_t* start = m_parent.getMemoryStart( usedLen );
+    if ( start )
+    {
+        // Contiguous parent: pad to the next alignment boundary (i.e. the next allocation starts at 'start + usedLen')
+        size_t next = (size_t) (start + usedLen);
+        padding     = ROUND_UP( next, m_alignment ) - next;
+    }
+    else
+    {
+        // Unknown parent address: worst case padding
+        padding = m_alignment - m_parent.wordSize();
+    }
+
+    uint8_t* result = (uint8_t*) m_parent.allocate( padding + alignedSize );
+    if ( result == nullptr )
+    {
+        return nullptr;
+    }
+
+    return result + (ROUND_UP( (size_t) result, m_alignment ) - (size_t) result);
+}
+
+void ChassisArena_::reset() noexcept
+{
+    m_ptr       = nullptr;
+    m_remaining = 0;
+    m_allocated = 0;
+}
+
+uint8_t* ChassisArena_::getMemoryStart( size_t& dstAllocatedLenInBytes ) noexcept
+{
+    dstAllocatedLenInBytes = m_allocated;
+    return nullptr;
+}
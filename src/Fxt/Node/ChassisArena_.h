@@ -0,0 +1,118 @@
+#ifndef Fxt_Node_ChassisArena_h_
+#define Fxt_Node_ChassisArena_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Cpl/Memory/ContiguousAllocator.h"
+#include "Cpl/System/Mutex.h"
+#include "Fxt/System/CacheAlignedAllocator.h"
+
+
+/** Size, in bytes, of the chunks that a Chassis Arena allocates from its
+    parent heap.  Allocation requests larger than half of the chunk size
+    bypass the arena and are allocated directly from the parent heap.
+ */
+#ifndef OPTION_FXT_NODE_CHASSIS_ARENA_CHUNK_SIZE
+#define OPTION_FXT_NODE_CHASSIS_ARENA_CHUNK_SIZE    512
+#endif
+
+///
+namespace Fxt {
+///
+namespace Node {
+
+
+/** This concrete class is a per-chassis 'sub-arena' that is used when
+    multiple Chassis are constructed concurrently (i.e. on different threads)
+    from the same - non thread safe - Node heap.  The arena allocates
+    chunks of OPTION_FXT_NODE_CHASSIS_ARENA_CHUNK_SIZE bytes from its parent
+    heap (while holding the parent's mutex) and then satisfies individual
+    allocations from its current chunk WITHOUT any locking.
+
+    The unused tail of a chunk is NOT returned to the parent heap, i.e. each
+    arena can 'waste' up to one chunk (per chunk replacement) of the parent
+    heap.  When the parent heap does not have enough memory for a full chunk
+    the request is allocated directly from the parent heap.
+
+    All memory that the arena allocates from its parent heap (i.e. chunks and
+    'bypass' requests) is aligned to - and sized in multiples of - the arena's
+    'alignment'.  This ensures that the data of different Chassis never share
+    a cache line (default alignment), or a virtual memory page (e.g. when the
+    Chassis is pinned to a CPU core and the arena's memory is 'first touched'
+    by a thread on that core for NUMA placement).  The chunk size is increased
+    to the alignment when the alignment is larger than
+    OPTION_FXT_NODE_CHASSIS_ARENA_CHUNK_SIZE.
+
+    NOTES:
+        - The arena's memory is NOT contiguous.  The getMemoryStart() method
+          always returns nullptr.
+        - The reset() method does NOT return memory to the parent heap.
+        - The arena is a transient object, i.e. it is only needed while the
+          Chassis is being constructed.  The allocated memory is owned by the
+          parent heap.
+ */
+class ChassisArena_ : public Cpl::Memory::ContiguousAllocator
+{
+public:
+    /** Constructor.  The 'parentLock' MUST be shared by all arenas that use
+        the same parent heap. 'alignment' MUST be a power of 2 and a multiple
+        of sizeof(size_t).
+     */
+    ChassisArena_( Cpl::Memory::ContiguousAllocator& parent,
+                   Cpl::System::Mutex&               parentLock,
+                   size_t                            alignment = OPTION_FXT_SYSTEM_CACHE_LINE_SIZE ) noexcept;
+
+public:
+    /// See Cpl::Memory::Allocator
+    void* allocate( size_t numbytes );
+
+    /// See Cpl::Memory::Allocator
+    size_t wordSize() const noexcept { return sizeof( size_t ); }
+
+    /// See Cpl::Memory::ContiguousAllocator.  Discards the current chunk
+    void reset() noexcept;
+
+    /// See Cpl::Memory::ContiguousAllocator.  Always returns nullptr (the total number of bytes allocated is still returned)
+    uint8_t* getMemoryStart( size_t& dstAllocatedLenInBytes ) noexcept;
+
+protected:
+    /// Helper method: allocates (aligned) memory from the parent heap.  Assumes the caller holds the parent's lock
+    void* allocateFromParent( size_t numbytes ) noexcept;
+
+protected:
+    /// Parent heap
+    Cpl::Memory::ContiguousAllocator&   m_parent;
+
+    /// Mutex that protects the parent heap
+    Cpl::System::Mutex&                 m_parentLock;
+
+    /// Next free byte in the current chunk
+    uint8_t*                            m_ptr;
+
+    /// Number of free bytes in the current chunk
+    size_t                              m_remaining;
+
+    /// Total number of bytes allocated
+    size_t                              m_allocated;
+
+    /// Alignment of the memory allocated from the parent heap
+    size_t                              m_alignment;
+
+    /// Chunk size
+    size_t                              m_chunkSize;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
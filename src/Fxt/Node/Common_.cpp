@@ -18,7 +18,10 @@
 #include "Cpl/System/Assert.h"
 #include "Cpl/System/Thread.h"
 #include "Cpl/System/Api.h"
+#include "Cpl/System/Trace.h"
+#include "Fxt/System/CpuAffinity.h"
 #include <new>
+#include <stdlib.h>
 
 #ifndef OPTION_FXT_NODE_WAIT_THREAD_MAX_LOOP_ITERATIONS
 #define OPTION_FXT_NODE_WAIT_THREAD_MAX_LOOP_ITERATIONS 100
@@ -27,25 +30,37 @@
 #define OPTION_FXT_NODE_WAIT_THREAD_WAIT_TIME_MS        1
 #endif
 
+/// Number of CPU yields (i.e. sleep(0)) when waiting for a Chassis thread to start - before falling back to the millisecond sleeps
+#ifndef OPTION_FXT_NODE_WAIT_THREAD_YIELD_ITERATIONS
+#define OPTION_FXT_NODE_WAIT_THREAD_YIELD_ITERATIONS    200
+#endif
+
 // Note: The LeanHeap expect memory to aligned to size_t -->hence the extra macros to help with the allocation/sizing
 #define BYTES_AS_SIZET(n)       (((n)+sizeof(size_t)-1)/ sizeof(size_t))
 #define SIZET_TO_BYTES(m)       (m*sizeof(size_t))
 
+
+#define SECT_                   "Fxt::Node"
+
 ///
 using namespace Fxt::Node;
 
+constexpr int Fxt::Node::Api::NOT_PINNED;
+
 
 //////////////////////////////////////////////////
 Common_::Common_( uint8_t                  numChassis,
                   Fxt::Point::DatabaseApi& pointDb,
                   size_t                   sizeGeneralHeap,
                   size_t                   sizeCardStatefulHeap,
-                  size_t                   sizeHaStatefulHeap )
-    : m_generalAllocator( new size_t[BYTES_AS_SIZET( sizeGeneralHeap )], SIZET_TO_BYTES( BYTES_AS_SIZET( sizeGeneralHeap ) ) )
-    , m_cardStatefulAllocator( new size_t[BYTES_AS_SIZET( sizeCardStatefulHeap )], SIZET_TO_BYTES( BYTES_AS_SIZET( sizeCardStatefulHeap ) ) )
-    , m_haStatefulAllocator( new size_t[BYTES_AS_SIZET( sizeHaStatefulHeap )], SIZET_TO_BYTES( BYTES_AS_SIZET( sizeHaStatefulHeap ) ) )
+                  size_t                   sizeHaStatefulHeap,
+                  bool                     lockedHeaps )
+    : m_generalAllocator( allocateHeapMemory( eGENERAL_HEAP, sizeGeneralHeap, lockedHeaps ), SIZET_TO_BYTES( BYTES_AS_SIZET( sizeGeneralHeap ) ), false )
+    , m_cardStatefulAllocator( allocateHeapMemory( eCARD_STATEFUL_HEAP, sizeCardStatefulHeap, lockedHeaps ), SIZET_TO_BYTES( BYTES_AS_SIZET( sizeCardStatefulHeap ) ), false )
+    , m_haStatefulAllocator( allocateHeapMemory( eHA_STATEFUL_HEAP, sizeHaStatefulHeap, lockedHeaps ), SIZET_TO_BYTES( BYTES_AS_SIZET( sizeHaStatefulHeap ) ), false )
     , m_pointDb( pointDb )
     , m_chassis( nullptr )
+    , m_configDigest( nullptr )
     , m_error( Fxt::Type::Error::SUCCESS() )
     , m_numChassis( numChassis )
     , m_nextChassisIdx( 0 )
@@ -58,7 +73,7 @@ Common_::Common_( uint8_t                  numChassis,
     // The bulk of the work is done the child class
 }
 
-bool Common_::initialize( size_t sizeCardStatefulHeap ) noexcept
+bool Common_::initialize( size_t sizeCardStatefulHeap, const int* chassisCpuCores ) noexcept
 {
     // Check if heap allocations worked
     size_t dummy;
@@ -88,6 +103,10 @@ bool Common_::initialize( size_t sizeCardStatefulHeap ) noexcept
         {
             // Zero the array so we can tell if there are chassis
             memset( m_chassis, 0, sizeof( Chassis_T ) * m_numChassis );
+            for ( uint16_t i=0; i < m_numChassis; i++ )
+            {
+                m_chassis[i].cpuCore = chassisCpuCores ? chassisCpuCores[i] : NOT_PINNED;
+            }
         }
     }
 
@@ -119,11 +138,38 @@ Common_::~Common_()
         }
     }
 
-    // Free my local heaps
+    // Free the configuration digest
+    delete m_configDigest;
+
+    // Free my local heaps (Note: locked memory is released by its destructor)
     size_t dummy;
-    delete[] m_generalAllocator.getMemoryStart( dummy );
-    delete[] m_cardStatefulAllocator.getMemoryStart( dummy );
-    delete[] m_haStatefulAllocator.getMemoryStart( dummy );
+    if ( m_lockedMemory[eGENERAL_HEAP].getData() == nullptr )
+    {
+        free( m_generalAllocator.getMemoryStart( dummy ) );
+    }
+    if ( m_lockedMemory[eCARD_STATEFUL_HEAP].getData() == nullptr )
+    {
+        free( m_cardStatefulAllocator.getMemoryStart( dummy ) );
+    }
+    if ( m_lockedMemory[eHA_STATEFUL_HEAP].getData() == nullptr )
+    {
+        free( m_haStatefulAllocator.getMemoryStart( dummy ) );
+    }
+}
+
+size_t* Common_::allocateHeapMemory( HeapId_T heap, size_t sizeInBytes, bool locked ) noexcept
+{
+    // Note: The heap's memory is zero filled - by the allocation - so that the memory is NOT touched until it is
+    //       allocated from the heap (i.e. 'first touch' NUMA placement by the Chassis builder threads)
+    if ( locked && sizeInBytes > 0 )
+    {
+        if ( m_lockedMemory[heap].create( SIZET_TO_BYTES( BYTES_AS_SIZET( sizeInBytes ) ), true ) )
+        {
+            return (size_t*) m_lockedMemory[heap].getData();
+        }
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Unable to allocate locked memory for heap #%d (%lu bytes). Using the platform heap", heap, (unsigned long) sizeInBytes) );
+    }
+    return (size_t*) calloc( BYTES_AS_SIZET( sizeInBytes ), sizeof( size_t ) );
 }
 
 //////////////////////////////////////////////////
@@ -142,6 +188,35 @@ Cpl::Memory::ContiguousAllocator& Common_::getHaStatefulAlloactor() noexcept
     return m_haStatefulAllocator;
 }
 
+bool Common_::getHeapUsage( HeapId_T heap, HeapUsage_T& dst ) noexcept
+{
+    switch ( heap )
+    {
+    case eGENERAL_HEAP:
+        m_generalAllocator.getUsage( dst );
+        break;
+    case eCARD_STATEFUL_HEAP:
+        m_cardStatefulAllocator.getUsage( dst );
+        break;
+    case eHA_STATEFUL_HEAP:
+        m_haStatefulAllocator.getUsage( dst );
+        break;
+    default:
+        return false;
+    }
+
+    dst.locked    = m_lockedMemory[heap].getData() != nullptr;
+    dst.hugePages = m_lockedMemory[heap].isHugePages();
+    return true;
+}
+
+void Common_::enableHeapMeasureMode() noexcept
+{
+    m_generalAllocator.setMeasureMode( true );
+    m_cardStatefulAllocator.setMeasureMode( true );
+    m_haStatefulAllocator.setMeasureMode( true );
+}
+
 //////////////////////////////////////////////////
 bool Common_::start( uint64_t currentElapsedTimeUsec ) noexcept
 {
@@ -249,6 +324,14 @@ void Common_::destroyChassisThread( Cpl::System::Thread & chassisThreadToDelete
 
 bool Common_::waitForThreadToRun( Cpl::System::Runnable & runnable )
 {
+    for ( unsigned i=0; i < OPTION_FXT_NODE_WAIT_THREAD_YIELD_ITERATIONS; i++ )
+    {
+        if ( runnable.isRunning() )
+        {
+            return true;
+        }
+        Cpl::System::Api::sleep( 0 );
+    }
     for ( uint8_t i=0; i < OPTION_FXT_NODE_WAIT_THREAD_MAX_LOOP_ITERATIONS; i++ )
     {
         Cpl::System::Api::sleep( OPTION_FXT_NODE_WAIT_THREAD_WAIT_TIME_MS );
@@ -275,6 +358,58 @@ Fxt::Chassis::Api* Common_::getChassis( uint16_t chassisIndex ) noexcept
     return m_chassis[chassisIndex].chassis;
 }
 
+int Common_::getChassisCpuCore( uint16_t chassisIndex ) const noexcept
+{
+    if ( chassisIndex >= m_numChassis || m_chassis == nullptr )
+    {
+        return NOT_PINNED;
+    }
+    return m_chassis[chassisIndex].cpuCore;
+}
+
+bool Common_::getChassisHaRegion( uint16_t chassisIndex, size_t& offset, size_t& len ) noexcept
+{
+    if ( chassisIndex >= m_numChassis || m_chassis == nullptr || !m_chassis[chassisIndex].haRecorded )
+    {
+        return false;
+    }
+
+    size_t allocatedLen;
+    m_haStatefulAllocator.getMemoryStart( allocatedLen );
+    size_t end = chassisIndex + 1 == m_numChassis ? allocatedLen : m_chassis[chassisIndex].haEnd;
+    offset     = 0;
+    if ( chassisIndex > 0 )
+    {
+        if ( !m_chassis[chassisIndex - 1].haRecorded )
+        {
+            return false;
+        }
+        offset = m_chassis[chassisIndex - 1].haEnd;
+    }
+    len = end > offset ? end - offset : 0;
+    return true;
+}
+
+void Common_::setChassisHaEnd( uint16_t chassisIndex, size_t haEndOffset ) noexcept
+{
+    if ( chassisIndex < m_numChassis && m_chassis )
+    {
+        m_chassis[chassisIndex].haEnd      = haEndOffset;
+        m_chassis[chassisIndex].haRecorded = true;
+    }
+}
+
+const ConfigDigest* Common_::getConfigDigest() const noexcept
+{
+    return m_configDigest;
+}
+
+void Common_::setConfigDigest( ConfigDigest* digest ) noexcept
+{
+    delete m_configDigest;
+    m_configDigest = digest;
+}
+
 
 
 
@@ -293,6 +428,13 @@ Fxt::Type::Error Common_::add( Fxt::Chassis::Api&       chassisToAdd,
         {
             m_chassis[m_nextChassisIdx].chassis = &chassisToAdd;
             m_chassis[m_nextChassisIdx].thread  = &chassisThreadToAdd;
+
+            // Pin the chassis thread (failing to pin is NOT an error)
+            int cpuCore = m_chassis[m_nextChassisIdx].cpuCore;
+            if ( cpuCore != NOT_PINNED && !Fxt::System::CpuAffinity::setThreadAffinity( chassisThreadToAdd, (unsigned) cpuCore ) )
+            {
+                CPL_SYSTEM_TRACE_MSG( SECT_, ("Failed to pin Chassis #%u to CPU core %d", m_nextChassisIdx, cpuCore) );
+            }
             m_nextChassisIdx++;
         }
     }
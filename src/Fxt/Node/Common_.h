@@ -14,7 +14,8 @@
 
 
 #include "Fxt/Node/Api.h"
-#include "Cpl/Memory/LeanHeap.h"
+#include "Fxt/Node/AccountingHeap.h"
+#include "Fxt/System/LockedMemory.h"
 
 ///
 namespace Fxt {
@@ -33,22 +34,35 @@ protected:
     {
         Fxt::Chassis::Api*          chassis;      //!< Chassis pointer
         Cpl::System::Thread*        thread;       //!< Chassis thread pointer
+        int                         cpuCore;      //!< CPU core index the Chassis thread is pinned to (or NOT_PINNED)
+        size_t                      haEnd;        //!< End of the Chassis' HA data (relative to the start of the HA heap)
+        bool                        haRecorded;   //!< True when 'haEnd' has been set
     };
 
 protected:
-    /// Constructor.  
+    /** Constructor.  When 'lockedHeaps' is true, the heaps are backed by
+        huge pages that are pre-faulted and locked into physical memory (see
+        Fxt::System::LockedMemory).  If the locked memory can not be
+        allocated, the heap falls back to the platform heap (i.e. it is NOT
+        an error).
+     */
     Common_( uint8_t                  numChassis,
              Fxt::Point::DatabaseApi& pointDb,
              size_t                   sizeGeneralHeap,
              size_t                   sizeCardStatefulHeap,
-             size_t                   sizeHaStatefulHeap );
+             size_t                   sizeHaStatefulHeap,
+             bool                     lockedHeaps = false );
 
     /// Destructor
     ~Common_();
 
     /** Helper method that initialize the instance (Base constructor does not work - because I need to call child virtual functions
+
+        'chassisCpuCores' is an optional array (of 'numChassis' elements) of
+        CPU core indexes to pin the individual Chassis threads to.  Use
+        NOT_PINNED for a Chassis thread that should not be pinned.
      */
-    bool initialize( size_t sizeCardStatefulHeap ) noexcept;
+    bool initialize( size_t sizeCardStatefulHeap, const int* chassisCpuCores = nullptr ) noexcept;
 
 public:
     /// See Fxt::Node::Api
@@ -76,6 +90,12 @@ public:
     /// See Fxt::Node::Api
     Cpl::Memory::ContiguousAllocator& getHaStatefulAlloactor() noexcept;
 
+    /// See Fxt::Node::Api
+    bool getHeapUsage( HeapId_T heap, HeapUsage_T& dst ) noexcept;
+
+    /// See Fxt::Node::Api
+    void enableHeapMeasureMode() noexcept;
+
     /// See Fxt::Node::Api.  Assumes the thread was created using Cpl::System::Thread::create() method
     void destroyChassisThread( Cpl::System::Thread& chassisThreadToDelete ) noexcept;
 
@@ -85,19 +105,40 @@ public:
     /// See Fxt::Node::Api
     Fxt::Chassis::Api* getChassis( uint16_t chassisIndex ) noexcept;
 
+    /// See Fxt::Node::Api
+    int getChassisCpuCore( uint16_t chassisIndex ) const noexcept;
+
+    /// See Fxt::Node::Api
+    bool getChassisHaRegion( uint16_t chassisIndex, size_t& offset, size_t& len ) noexcept;
+
+    /// See Fxt::Node::Api
+    void setChassisHaEnd( uint16_t chassisIndex, size_t haEndOffset ) noexcept;
+
+    /// See Fxt::Node::Api
+    const ConfigDigest* getConfigDigest() const noexcept;
+
+    /// See Fxt::Node::Api
+    void setConfigDigest( ConfigDigest* digest ) noexcept;
+
 protected:
     /// Helper function that waits (but not forever) for a Chassis thread to spin up.  Returns true if the thread is running when done waiting
     bool waitForThreadToRun( Cpl::System::Runnable& runnable );
 
+    /// Helper method that allocates the (zero filled) memory for a heap.  Returns nullptr if out of memory
+    size_t* allocateHeapMemory( HeapId_T heap, size_t sizeInBytes, bool locked ) noexcept;
+
 protected:
+    /// Locked memory for the heaps.  Note: MUST be declared before the heaps (i.e. constructed first)
+    Fxt::System::LockedMemory           m_lockedMemory[eNUM_HEAPS];
+
     /// Allocator|Heap: General 
-    Cpl::Memory::LeanHeap               m_generalAllocator;
+    AccountingHeap                      m_generalAllocator;
 
     /// Allocator|Heap: Card Stateful data 
-    Cpl::Memory::LeanHeap               m_cardStatefulAllocator;
+    AccountingHeap                      m_cardStatefulAllocator;
 
     /// Allocator|Heap: HA Stateful data 
-    Cpl::Memory::LeanHeap               m_haStatefulAllocator;
+    AccountingHeap                      m_haStatefulAllocator;
 
     /// Point Database
     Fxt::Point::DatabaseApi&            m_pointDb;
@@ -105,6 +146,9 @@ protected:
     /// Array/List of Chassis
     Chassis_T*                          m_chassis;
 
+    /// Digest of the Node's JSON definition (nullptr if not available)
+    ConfigDigest*                       m_configDigest;
+
     /// Error state. A value of 0 indicates NO error
     Fxt::Type::Error                    m_error;
 
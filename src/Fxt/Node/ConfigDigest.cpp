@@ -0,0 +1,407 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "ConfigDigest.h"
+#include "Cpl/Checksum/Crc32EthernetFast.h"
+#include "Cpl/Checksum/Md5Aladdin.h"
+#include "Cpl/Text/format.h"
+#include <string.h>
+#include <new>
+
+///
+using namespace Fxt::Node;
+
+
+/////////////////////////////////
+namespace {
+
+/** Writer (for ArduinoJson) that feeds the canonical form of a JSON value
+    into a CRC32 and/or a MD5 hash
+ */
+class CanonicalWriter_
+{
+public:
+    /// Constructor.  Either of the checksums can be nullptr
+    CanonicalWriter_( Cpl::Checksum::Api32* crc, Cpl::Checksum::ApiMd5* md5 )
+        : m_crc( crc )
+        , m_md5( md5 )
+    {
+    }
+
+public:
+    /// ArduinoJson Writer interface
+    size_t write( uint8_t c )
+    {
+        return write( &c, 1 );
+    }
+
+    /// ArduinoJson Writer interface
+    size_t write( const uint8_t* s, size_t n )
+    {
+        if ( m_crc )
+        {
+            m_crc->accumulate( s, (unsigned) n );
+        }
+        if ( m_md5 )
+        {
+            m_md5->accumulate( s, (unsigned) n );
+        }
+        return n;
+    }
+
+public:
+    /// Writes the canonical form of 'src'
+    void writeValue( JsonVariantConst src, const char* excludeKey1 = nullptr, const char* excludeKey2 = nullptr )
+    {
+        if ( src.is<JsonObjectConst>() )
+        {
+            writeObject( src.as<JsonObjectConst>(), excludeKey1, excludeKey2 );
+        }
+        else if ( src.is<JsonArrayConst>() )
+        {
+            write( '[' );
+            bool first = true;
+            for ( JsonVariantConst item : src.as<JsonArrayConst>() )
+            {
+                if ( !first )
+                {
+                    write( ',' );
+                }
+                writeValue( item );
+                first = false;
+            }
+            write( ']' );
+        }
+        else
+        {
+            // Scalars (and null) use the compact ArduinoJson serialization
+            serializeJson( src, *this );
+        }
+    }
+
+protected:
+    /// Writes the key/value pairs of an object ordered by key.  Note: O(n^2), but the objects of a Node definition only have a handful of keys
+    void writeObject( JsonObjectConst obj, const char* excludeKey1, const char* excludeKey2 )
+    {
+        write( '{' );
+        const char* prevKey = nullptr;
+        for ( ;;)
+        {
+            const char*      nextKey = nullptr;
+            JsonVariantConst nextValue;
+            for ( JsonPairConst kv : obj )
+            {
+                const char* key = kv.key().c_str();
+                if ( (excludeKey1 && strcmp( key, excludeKey1 ) == 0) ||
+                     (excludeKey2 && strcmp( key, excludeKey2 ) == 0) ||
+                     (prevKey && strcmp( key, prevKey ) <= 0) )
+                {
+                    continue;
+                }
+                if ( nextKey == nullptr || strcmp( key, nextKey ) < 0 )
+                {
+                    nextKey   = key;
+                    nextValue = kv.value();
+                }
+            }
+            if ( nextKey == nullptr )
+            {
+                break;
+            }
+
+            if ( prevKey )
+            {
+                write( ',' );
+            }
+            writeKey( nextKey );
+            write( ':' );
+            writeValue( nextValue );
+            prevKey = nextKey;
+        }
+        write( '}' );
+    }
+
+    /// Writes a quoted key
+    void writeKey( const char* key )
+    {
+        write( '"' );
+        for ( ; *key != '\0'; key++ )
+        {
+            if ( *key == '"' || *key == '\\' )
+            {
+                write( '\\' );
+            }
+            write( (uint8_t) *key );
+        }
+        write( '"' );
+    }
+
+protected:
+    /// CRC (can be nullptr)
+    Cpl::Checksum::Api32*  m_crc;
+
+    /// MD5 (can be nullptr)
+    Cpl::Checksum::ApiMd5* m_md5;
+};
+
+}; // end anonymous namespace
+
+
+/////////////////////////////////
+uint32_t ConfigDigest::computeCrc( JsonVariantConst src, const char* excludeKey1, const char* excludeKey2 ) noexcept
+{
+    Cpl::Checksum::Crc32EthernetFast crc;
+    CanonicalWriter_                 writer( &crc, nullptr );
+    writer.writeValue( src, excludeKey1, excludeKey2 );
+    return crc.finalize();
+}
+
+void ConfigDigest::computeHash( JsonVariantConst src, Cpl::Checksum::ApiMd5::Digest_T& dst ) noexcept
+{
+    Cpl::Checksum::Md5Aladdin md5;
+    CanonicalWriter_          writer( nullptr, &md5 );
+    writer.writeValue( src );
+    memcpy( dst, md5.finalize(), sizeof( dst ) );
+}
+
+/////////////////////////////////
+ConfigDigest* ConfigDigest::create( JsonVariantConst nodeJsonObject ) noexcept
+{
+    ConfigDigest* digest = new(std::nothrow) ConfigDigest();
+    if ( digest && !digest->populate( nodeJsonObject ) )
+    {
+        delete digest;
+        return nullptr;
+    }
+    return digest;
+}
+
+ConfigDigest::ConfigDigest() noexcept
+    : m_nodeCrc( 0 )
+    , m_chassis( nullptr )
+    , m_numChassis( 0 )
+{
+    memset( m_hash, 0, sizeof( m_hash ) );
+}
+
+ConfigDigest::~ConfigDigest()
+{
+    for ( uint16_t i=0; i < m_numChassis; i++ )
+    {
+        for ( uint16_t j=0; j < m_chassis[i].numExecutionSets; j++ )
+        {
+            delete[] m_chassis[i].executionSets[j].chains;
+        }
+        delete[] m_chassis[i].executionSets;
+        delete[] m_chassis[i].scanners;
+    }
+    delete[] m_chassis;
+}
+
+bool ConfigDigest::populate( JsonVariantConst nodeJsonObject ) noexcept
+{
+    computeHash( nodeJsonObject, m_hash );
+    m_nodeCrc = computeCrc( nodeJsonObject, "chassis" );
+
+    JsonArrayConst chassisArray = nodeJsonObject["chassis"];
+    uint16_t       numChassis   = (uint16_t) chassisArray.size();
+    if ( numChassis == 0 )
+    {
+        return true;
+    }
+    m_chassis = new(std::nothrow) Chassis_T[numChassis]();
+    if ( m_chassis == nullptr )
+    {
+        return false;
+    }
+    m_numChassis = numChassis;
+
+    uint16_t idxChassis = 0;
+    for ( JsonVariantConst chassisObj : chassisArray )
+    {
+        Chassis_T& chassis = m_chassis[idxChassis++];
+        chassis.crc        = computeCrc( chassisObj, "scanners", "executionSets" );
+
+        // Scanners
+        JsonArrayConst scannerArray = chassisObj["scanners"];
+        uint16_t       numScanners  = (uint16_t) scannerArray.size();
+        if ( numScanners > 0 )
+        {
+            chassis.scanners = new(std::nothrow) uint32_t[numScanners];
+            if ( chassis.scanners == nullptr )
+            {
+                return false;
+            }
+            for ( JsonVariantConst scannerObj : scannerArray )
+            {
+                chassis.scanners[chassis.numScanners++] = computeCrc( scannerObj );
+            }
+        }
+
+        // Execution Sets
+        JsonArrayConst exeSetArray = chassisObj["executionSets"];
+        uint16_t       numExeSets  = (uint16_t) exeSetArray.size();
+        if ( numExeSets > 0 )
+        {
+            chassis.executionSets = new(std::nothrow) ExecutionSet_T[numExeSets]();
+            if ( chassis.executionSets == nullptr )
+            {
+                return false;
+            }
+            chassis.numExecutionSets = numExeSets;
+
+            uint16_t idxExeSet = 0;
+            for ( JsonVariantConst exeSetObj : exeSetArray )
+            {
+                ExecutionSet_T& exeSet = chassis.executionSets[idxExeSet++];
+                exeSet.crc             = computeCrc( exeSetObj, "logicChains" );
+
+                // Logic Chains
+                JsonArrayConst chainArray = exeSetObj["logicChains"];
+                uint16_t       numChains  = (uint16_t) chainArray.size();
+                if ( numChains > 0 )
+                {
+                    exeSet.chains = new(std::nothrow) uint32_t[numChains];
+                    if ( exeSet.chains == nullptr )
+                    {
+                        return false;
+                    }
+                    for ( JsonVariantConst chainObj : chainArray )
+                    {
+                        exeSet.chains[exeSet.numChains++] = computeCrc( chainObj );
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/////////////////////////////////
+void ConfigDigest::getHashText( Cpl::Text::String& dst ) const noexcept
+{
+    Cpl::Text::bufferToAsciiHex( m_hash, sizeof( m_hash ), dst, false );
+}
+
+bool ConfigDigest::isSame( const ConfigDigest& other ) const noexcept
+{
+    return memcmp( m_hash, other.m_hash, sizeof( m_hash ) ) == 0;
+}
+
+void ConfigDigest::report( DiffClient* client, unsigned& numDiffs, Element_T element, Change_T change, uint16_t chassisIdx, uint16_t idx, uint16_t chainIdx ) noexcept
+{
+    numDiffs++;
+    if ( client )
+    {
+        client->configDifference( element, change, chassisIdx, idx, chainIdx );
+    }
+}
+
+unsigned ConfigDigest::diff( const ConfigDigest& newConfig, DiffClient* client ) const noexcept
+{
+    unsigned numDiffs = 0;
+    if ( m_nodeCrc != newConfig.m_nodeCrc )
+    {
+        report( client, numDiffs, eNODE, eMODIFIED, 0 );
+    }
+
+    uint16_t maxChassis = m_numChassis > newConfig.m_numChassis ? m_numChassis : newConfig.m_numChassis;
+    for ( uint16_t i=0; i < maxChassis; i++ )
+    {
+        if ( i >= m_numChassis )
+        {
+            report( client, numDiffs, eCHASSIS, eADDED, i );
+            continue;
+        }
+        if ( i >= newConfig.m_numChassis )
+        {
+            report( client, numDiffs, eCHASSIS, eREMOVED, i );
+            continue;
+        }
+
+        const Chassis_T& cur = m_chassis[i];
+        const Chassis_T& upd = newConfig.m_chassis[i];
+        if ( cur.crc != upd.crc )
+        {
+            report( client, numDiffs, eCHASSIS, eMODIFIED, i );
+        }
+
+        // Scanners
+        uint16_t maxScanners = cur.numScanners > upd.numScanners ? cur.numScanners : upd.numScanners;
+        for ( uint16_t j=0; j < maxScanners; j++ )
+        {
+            if ( j >= cur.numScanners )
+            {
+                report( client, numDiffs, eSCANNER, eADDED, i, j );
+            }
+            else if ( j >= upd.numScanners )
+            {
+                report( client, numDiffs, eSCANNER, eREMOVED, i, j );
+            }
+            else if ( cur.scanners[j] != upd.scanners[j] )
+            {
+                report( client, numDiffs, eSCANNER, eMODIFIED, i, j );
+            }
+        }
+
+        // Execution Sets
+        uint16_t maxExeSets = cur.numExecutionSets > upd.numExecutionSets ? cur.numExecutionSets : upd.numExecutionSets;
+        for ( uint16_t j=0; j < maxExeSets; j++ )
+        {
+            if ( j >= cur.numExecutionSets )
+            {
+                report( client, numDiffs, eEXECUTION_SET, eADDED, i, j );
+                continue;
+            }
+            if ( j >= upd.numExecutionSets )
+            {
+                report( client, numDiffs, eEXECUTION_SET, eREMOVED, i, j );
+                continue;
+            }
+
+            const ExecutionSet_T& curSet = cur.executionSets[j];
+            const ExecutionSet_T& updSet = upd.executionSets[j];
+            if ( curSet.crc != updSet.crc )
+            {
+                report( client, numDiffs, eEXECUTION_SET, eMODIFIED, i, j );
+            }
+
+            // Logic Chains
+            uint16_t maxChains = curSet.numChains > updSet.numChains ? curSet.numChains : updSet.numChains;
+            for ( uint16_t k=0; k < maxChains; k++ )
+            {
+                if ( k >= curSet.numChains )
+                {
+                    report( client, numDiffs, eLOGIC_CHAIN, eADDED, i, j, k );
+                }
+                else if ( k >= updSet.numChains )
+                {
+                    report( client, numDiffs, eLOGIC_CHAIN, eREMOVED, i, j, k );
+                }
+                else if ( curSet.chains[k] != updSet.chains[k] )
+                {
+                    report( client, numDiffs, eLOGIC_CHAIN, eMODIFIED, i, j, k );
+                }
+            }
+        }
+    }
+
+    // Fingerprint collision
+    if ( numDiffs == 0 && !isSame( newConfig ) )
+    {
+        report( client, numDiffs, eNODE, eMODIFIED, 0 );
+    }
+
+    return numDiffs;
+}
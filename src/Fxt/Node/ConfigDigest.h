@@ -0,0 +1,185 @@
+#ifndef Fxt_Node_ConfigDigest_h_
+#define Fxt_Node_ConfigDigest_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Cpl/Json/Arduino.h"
+#include "Cpl/Checksum/ApiMd5.h"
+#include "Cpl/Text/String.h"
+#include <stdint.h>
+
+
+///
+namespace Fxt {
+///
+namespace Node {
+
+
+/** This concrete class contains the 'digest' of a Node's JSON definition.
+    The digest is computed over the canonical form of the definition, i.e.
+    the compact JSON text (no white space) with the key/value pairs of every
+    object ordered by key.  This makes the digest independent of the
+    formatting and of the key order of the source JSON.
+
+    The digest consists of:
+        - The MD5 hash of the entire Node definition.  Two definitions with
+          the same hash are considered identical, i.e. reloading the Node
+          is a no-op.
+        - CRC32 fingerprints of the Node's own fields, and of each Chassis,
+          Scanner, Execution Set, and Logic Chain.  The fingerprints are used
+          to report which elements differ between two definitions (see
+          diff()).
+
+    NOTE: All fields - including the fields that are NOT parsed by the
+          firmware, e.g. "name" - are included in the digest.
+
+    The class is NOT thread safe.
+ */
+class ConfigDigest
+{
+public:
+    /// Identifies an element of a Node definition
+    enum Element_T
+    {
+        eNODE = 0,          //!< The Node's own fields (i.e. excluding its Chassis)
+        eCHASSIS,           //!< The Chassis' own fields (i.e. excluding its Scanners and Execution Sets), e.g. "fer", "sharedPts"
+        eSCANNER,           //!< A Scanner (including its IO Cards)
+        eEXECUTION_SET,     //!< The Execution Set's own fields (i.e. excluding its Logic Chains)
+        eLOGIC_CHAIN        //!< A Logic Chain
+    };
+
+    /// Type of difference
+    enum Change_T
+    {
+        eMODIFIED = 0,      //!< The element exists in both definitions, but is different
+        eADDED,             //!< The element only exists in the new definition
+        eREMOVED            //!< The element only exists in the current definition
+    };
+
+    /** This abstract class defines the callback interface for reporting the
+        differences between two Node definitions (see diff()).
+     */
+    class DiffClient
+    {
+    public:
+        /** This method is called once for each difference.  'chassisIdx'
+            is the index of the Chassis, 'idx' is the index of the Scanner
+            or Execution Set within its Chassis, and 'chainIdx' is the index
+            of the Logic Chain within its Execution Set.  Indexes that do not
+            apply to 'element' are zero.
+
+            When a Chassis (or Execution Set) is added or removed, its
+            Scanners, Execution Sets, and Logic Chains are NOT reported
+            individually.
+         */
+        virtual void configDifference( Element_T element,
+                                       Change_T  change,
+                                       uint16_t  chassisIdx,
+                                       uint16_t  idx,
+                                       uint16_t  chainIdx ) noexcept = 0;
+
+    public:
+        /// Virtual destructor
+        virtual ~DiffClient() {}
+    };
+
+public:
+    /** This method creates the digest of the Node definition 'nodeJsonObject'.
+        The digest is allocated using new(std::nothrow), i.e. it is NOT
+        allocated from the Node's heaps.  Returns nullptr if there is
+        insufficient memory.
+     */
+    static ConfigDigest* create( JsonVariantConst nodeJsonObject ) noexcept;
+
+    /// Destructor
+    ~ConfigDigest();
+
+public:
+    /// Returns the MD5 hash of the Node definition
+    const Cpl::Checksum::ApiMd5::Digest_T& getHash() const noexcept { return m_hash; }
+
+    /// Returns the MD5 hash of the Node definition as an ASCII hex string
+    void getHashText( Cpl::Text::String& dst ) const noexcept;
+
+    /// Returns true if the two Node definitions are identical (i.e. their hashes match)
+    bool isSame( const ConfigDigest& other ) const noexcept;
+
+    /** This method compares the digest (aka the current definition) against
+        'newConfig' and reports each difference to 'client' (when not null).
+        The method returns the number of differences, i.e. zero when the
+        element fingerprints are identical.
+
+        NOTE: If the hashes differ, but all of the element fingerprints match
+              (i.e. a CRC32 collision), a modified eNODE element is reported.
+              This guarantees that the method only returns zero when
+              isSame() returns true.
+     */
+    unsigned diff( const ConfigDigest& newConfig, DiffClient* client = nullptr ) const noexcept;
+
+public:
+    /** This method returns the CRC32 of the canonical form of 'src'.  The
+        optional 'excludeKey1' and 'excludeKey2' are top-level keys (of an
+        object) that are omitted from the canonical form.
+     */
+    static uint32_t computeCrc( JsonVariantConst src, const char* excludeKey1 = nullptr, const char* excludeKey2 = nullptr ) noexcept;
+
+    /// This method computes the MD5 hash of the canonical form of 'src'
+    static void computeHash( JsonVariantConst src, Cpl::Checksum::ApiMd5::Digest_T& dst ) noexcept;
+
+protected:
+    /// Fingerprints of an Execution Set
+    struct ExecutionSet_T
+    {
+        uint32_t  crc;              //!< Execution Set's own fields
+        uint32_t* chains;           //!< Logic Chains
+        uint16_t  numChains;        //!< Number of Logic Chains
+    };
+
+    /// Fingerprints of a Chassis
+    struct Chassis_T
+    {
+        uint32_t        crc;                //!< Chassis' own fields
+        uint32_t*       scanners;           //!< Scanners
+        ExecutionSet_T* executionSets;      //!< Execution Sets
+        uint16_t        numScanners;        //!< Number of Scanners
+        uint16_t        numExecutionSets;   //!< Number of Execution Sets
+    };
+
+protected:
+    /// Constructor
+    ConfigDigest() noexcept;
+
+    /// Helper method that populates the fingerprints.  Returns false if out of memory
+    bool populate( JsonVariantConst nodeJsonObject ) noexcept;
+
+    /// Helper method that reports a difference
+    static void report( DiffClient* client, unsigned& numDiffs, Element_T element, Change_T change, uint16_t chassisIdx, uint16_t idx = 0, uint16_t chainIdx = 0 ) noexcept;
+
+protected:
+    /// Hash of the entire Node definition
+    Cpl::Checksum::ApiMd5::Digest_T m_hash;
+
+    /// Fingerprint of the Node's own fields
+    uint32_t                        m_nodeCrc;
+
+    /// Chassis fingerprints
+    Chassis_T*                      m_chassis;
+
+    /// Number of Chassis
+    uint16_t                        m_numChassis;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
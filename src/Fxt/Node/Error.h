@@ -45,6 +45,13 @@ namespace Node {
     @param FAILED_CREATE_CHASSIS_SERVER     Unable to create a Chassis Server instance
     @param FAILED_CREATE_CHASSIS            Failed to create one or more Chassis
     @param CHASSIS_CREATE_ERROR             One or more Chassis were not successfully created
+    @param PARSE_STREAM                     Streamed JSON input is malformed or was truncated
+    @param STREAM_TYPE_NOT_FIRST            Streamed JSON input: the Node "type" key/value pair does not precede the "chassis" array
+    @param IMAGE_INVALID_HEADER             Node Image: invalid magic, version, or length
+    @param IMAGE_CRC_ERROR                  Node Image: the payload failed its CRC check
+    @param IMAGE_BAD_RECORD                 Node Image: unexpected, truncated, or invalid record
+    @param IMAGE_ELEMENT_ERROR              Node Image: an element's MessagePack data is invalid or does not fit in the element JSON document
+    @param FAILED_CREATE_CHASSIS_WORKER     Unable to allocate the worker(s) for concurrent Chassis construction
 
  */
 BETTER_ENUM( Err_T, uint8_t
@@ -63,6 +70,13 @@ BETTER_ENUM( Err_T, uint8_t
              , FAILED_CREATE_CHASSIS_SERVER
              , FAILED_CREATE_CHASSIS
              , CHASSIS_CREATE_ERROR
+             , PARSE_STREAM
+             , STREAM_TYPE_NOT_FIRST
+             , IMAGE_INVALID_HEADER
+             , IMAGE_CRC_ERROR
+             , IMAGE_BAD_RECORD
+             , IMAGE_ELEMENT_ERROR
+             , FAILED_CREATE_CHASSIS_WORKER
 );
 
 /** This concrete class defines the Error Category for the Logic Chain namespace.
@@ -18,6 +18,7 @@
 #include "Fxt/Card/FactoryDatabase.h"
 #include "Fxt/Component/FactoryDatabase.h"
 #include "Fxt/Node/Api.h"
+#include "Cpl/Io/Input.h"
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -29,6 +30,10 @@ namespace Node {
 /** This abstract class defines the interface for a 'Factory' that knows how
     to create a Node of a specific type.
 
+    A Factory can create any number of Nodes.  Each Node requires its own
+    Point Database (see Fxt::Point::DynamicDatabase for a Point Database that
+    is sized at run time).  The Factory databases are shared by all Nodes.
+
     The semantics of the Factory interface is NOT thread safe.
 
    \code
@@ -71,11 +76,97 @@ public:
         if an error occurred (e.g. out-of-memory) nullptr is returned.
         When an error occurs, the 'nodeErrorode' argument is updated with
         details of the error.
+
+        The digest of the Node's JSON definition is kept with the Node (see
+        Fxt::Node::Api::getConfigDigest() and compareToJSON()).
       */
     virtual Api* createFromJSON( JsonVariant&             nodeJsonObject,
                                  Fxt::Point::DatabaseApi& dbForPoints,
                                  Fxt::Type::Error&        nodeErrorode ) noexcept = 0;
 
+    /** This method creates a Node by parsing the Node's JSON definition as
+        it is read from 'nodeJsonStream' (e.g. a file, socket, TPipe, etc.),
+        i.e. the Node's JSON text is NEVER held in memory as a whole.  The
+        individual IO Cards, Logic Chains, and Shared Points are deserialized
+        - one at a time - into 'elementDoc'.  This means the memory required
+        to create a Node is bounded by the size of its largest element (and
+        NOT by the size of the Node definition).
+
+        The Node's "type" key/value pair MUST precede its "chassis" array.
+
+        The semantics for the return value and 'nodeErrorode' are the same as
+        createFromJSON().
+      */
+    virtual Api* createFromStream( Cpl::Io::Input&          nodeJsonStream,
+                                   JsonDocument&            elementDoc,
+                                   Fxt::Point::DatabaseApi& dbForPoints,
+                                   Fxt::Type::Error&        nodeErrorode ) noexcept = 0;
+
+    /** This method creates a Node from a pre-compiled binary Node Image
+        (see Fxt/Node/Image.h).  The image is accessed directly from memory,
+        i.e. 'image' is typically a memory mapped file or a region of XIP
+        flash.  The Node is constructed in a single pass with NO JSON text
+        parsing.  The individual IO Cards, Logic Chains, and Shared Points are
+        decoded - one at a time - into 'elementDoc'.
+
+        The image's memory is only accessed during the call, i.e. it can be
+        unmapped/released once the method returns.
+
+        The semantics for the return value and 'nodeErrorode' are the same as
+        createFromJSON().
+      */
+    virtual Api* createFromImage( const void*              image,
+                                  size_t                   imageLen,
+                                  JsonDocument&            elementDoc,
+                                  Fxt::Point::DatabaseApi& dbForPoints,
+                                  Fxt::Type::Error&        nodeErrorode ) noexcept = 0;
+
+public:
+    /** This method performs a 'dry-run' creation of the Node defined by
+        'nodeJsonObject' to determine the Node's exact heap requirements.  The
+        Node's heaps are put into measure mode (see Fxt::Node::AccountingHeap),
+        i.e. the dry-run succeeds even when the Factory's configured heap
+        sizes are too small.  The Node is destroyed before the method returns
+        and it is never added to the list of Nodes (see Api::getNode()).
+
+        On success, 'dstUsage' contains the usage information for each heap
+        (indexed by Api::HeapId_T), where HeapUsage_T::requiredBytes is the
+        minimum heap size, and 'dstJsonBytes' is the amount of memory used by
+        the JSON document that holds 'nodeJsonObject'.
+
+        NOTE: 'scratchDbForPoints' MUST NOT be the Point Database of an
+              existing Node (its content is cleared).
+
+        The method returns SUCCESS if the Node was successfully created; else
+        the Node creation error code is returned.
+     */
+    virtual Fxt::Type::Error measureFromJSON( JsonVariant&             nodeJsonObject,
+                                              Fxt::Point::DatabaseApi& scratchDbForPoints,
+                                              HeapUsage_T              dstUsage[Api::eNUM_HEAPS],
+                                              size_t&                  dstJsonBytes ) noexcept = 0;
+
+
+public:
+    /** This method compares 'nodeJsonObject' against the JSON definition
+        that 'node' was created from (see Fxt::Node::ConfigDigest).  The
+        comparison is done on the canonical form of the definitions, i.e.
+        formatting and key order are ignored.
+
+        The method returns true when the definitions are identical, i.e.
+        reloading the Node is a no-op and the application should continue to
+        run 'node' (instead of tearing it down and re-creating it).  When the
+        definitions are different, false is returned and - when 'diffClient'
+        is not null - each differing Chassis, Scanner, Execution Set, and
+        Logic Chain is reported to 'diffClient'.
+
+        If 'node' does not have a digest (e.g. it was created from a JSON
+        stream), or there is insufficient memory to compute the digest of
+        'nodeJsonObject', false is returned and NO differences are reported,
+        i.e. the Node must be re-created in its entirety.
+     */
+    virtual bool compareToJSON( JsonVariant&               nodeJsonObject,
+                                Api&                       node,
+                                ConfigDigest::DiffClient*  diffClient = nullptr ) noexcept = 0;
 
 
 public:
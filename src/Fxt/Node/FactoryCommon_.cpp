@@ -13,8 +13,28 @@
 
 #include "FactoryCommon_.h"
 #include "Fxt/Chassis/Api.h"
+#include "Fxt/Chassis/Chassis.h"
+#include "Fxt/Chassis/Scanner.h"
+#include "Fxt/Chassis/ExecutionSet.h"
+#include "Fxt/Chassis/Error.h"
+#include "Fxt/Point/OwnershipDatabase.h"
+#include "Fxt/Node/Image.h"
+#include "Cpl/Checksum/Crc32EthernetFast.h"
+#include "Fxt/Node/ChassisArena_.h"
+#include "Fxt/System/CacheAlignedAllocator.h"
+#include "Fxt/System/CpuAffinity.h"
 #include "Cpl/System/Thread.h"
+#include "Cpl/System/Semaphore.h"
+#include "Cpl/System/Mutex.h"
+#include "Cpl/Container/SList.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/Trace.h"
+#include "Cpl/Text/FString.h"
 #include "Error.h"
+#include <string.h>
+#include <new>
+
+#define SECT_   "Fxt::Node"
 
 ///
 using namespace Fxt::Node;
@@ -25,8 +45,10 @@ Fxt::Component::FactoryDatabase     Fxt::Node::FactoryCommon_::g_componentFactor
 
 /////////////////////////////////
 FactoryCommon_::FactoryCommon_()
+    : m_parallelCreate( false )
+    , m_measureMode( false )
+    , m_lockedHeaps( false )
 {
-    // Nothing needed yet...
 }
 
 FactoryCommon_::~FactoryCommon_()
@@ -35,18 +57,68 @@ FactoryCommon_::~FactoryCommon_()
 }
 
 //////////////////////////////////////////////////
-static Api* theOne_;
+/// List of Nodes (in creation order)
+static Cpl::Container::SList<Api>   nodes_( "ignoreMe-invoke-staticConstructor" );
+
+/// Protects the list of Nodes
+static Cpl::System::Mutex           nodesLock_;
+
+/// Helper method: returns the number of allocated bytes in the Node's HA heap
+static size_t haEnd_( Api& node ) noexcept
+{
+    size_t allocatedLen = 0;
+    node.getHaStatefulAlloactor().getMemoryStart( allocatedLen );
+    return allocatedLen;
+}
 
 Api* Api::getNode() noexcept
 {
-    return theOne_;
+    Cpl::System::Mutex::ScopeBlock criticalSection( nodesLock_ );
+    return nodes_.last();
+}
+
+Api* Api::getNode( uint16_t index ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( nodesLock_ );
+    Api* node = nodes_.first();
+    while ( node && index-- > 0 )
+    {
+        node = nodes_.next( *node );
+    }
+    return node;
+}
+
+uint16_t Api::getNumNodes() noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( nodesLock_ );
+    uint16_t numNodes = 0;
+    Api*     node     = nodes_.first();
+    while ( node )
+    {
+        numNodes++;
+        node = nodes_.next( *node );
+    }
+    return numNodes;
+}
+
+void FactoryCommon_::addNode( Api& node ) noexcept
+{
+    // A dry-run Node is NOT a 'real' Node
+    if ( !m_measureMode )
+    {
+        Cpl::System::Mutex::ScopeBlock criticalSection( nodesLock_ );
+        nodes_.putLast( node );
+    }
 }
 
 /////////////////////////////////
 void FactoryCommon_::destroy( Api& nodeToDestroy ) noexcept
 {
+    {
+        Cpl::System::Mutex::ScopeBlock criticalSection( nodesLock_ );
+        nodes_.remove( nodeToDestroy );
+    }
     delete &nodeToDestroy;
-    theOne_ = nullptr;
 }
 
 Api* FactoryCommon_::createFromJSON( JsonVariant&             nodeJsonObject,
@@ -94,10 +166,35 @@ Api* FactoryCommon_::createFromJSON( JsonVariant&             nodeJsonObject,
         return nullptr;
     }
 
+    // Dry-run: measure the heap requirements
+    if ( m_measureMode )
+    {
+        node->enableHeapMeasureMode();
+    }
+
+    // Create the Chassis concurrently (Note: the per sub-system accounting is only exact when constructed sequentially)
+    if ( m_parallelCreate && !m_measureMode && numChassis > 1 && !hasCrossChassisAlias( chassisArray ) )
+    {
+        nodeErrorCode = createChassisConcurrently( *node, chassisArray, dbForPoints );
+        if ( nodeErrorCode != Fxt::Type::Error::SUCCESS() )
+        {
+            destroy( *node );
+            return nullptr;
+        }
+
+        attachConfigDigest( *node, nodeJsonObject );
+        addNode( *node );
+        return node;
+    }
+
     // Create Chassis
     for ( uint8_t i=0; i < numChassis; i++ )
     {
         Fxt::Type::Error errorCode  = Fxt::Type::Error::SUCCESS();
+        if ( i > 0 )
+        {
+            separateChassisHeaps( *node );
+        }
 
         // Create the Chassis thread (and runnable obj) instance
         Fxt::Chassis::ServerApi* serverApi;
@@ -145,11 +242,1022 @@ Api* FactoryCommon_::createFromJSON( JsonVariant&             nodeJsonObject,
             destroy( *node );
             return nullptr;
         }
+        node->setChassisHaEnd( i, haEnd_( *node ) );
     }
 
 
     // If I get here -->everything worked
-    theOne_ = node;
+    attachConfigDigest( *node, nodeJsonObject );
+    addNode( *node );
     return node;
 }
 
+/////////////////////////////////
+Fxt::Type::Error FactoryCommon_::measureFromJSON( JsonVariant&             nodeJsonObject,
+                                                  Fxt::Point::DatabaseApi& scratchDbForPoints,
+                                                  HeapUsage_T              dstUsage[Api::eNUM_HEAPS],
+                                                  size_t&                  dstJsonBytes ) noexcept
+{
+    Fxt::Type::Error result;
+
+    m_measureMode = true;
+    Api* node     = createFromJSON( nodeJsonObject, scratchDbForPoints, result );
+    m_measureMode = false;
+    if ( node )
+    {
+        for ( int i=0; i < Api::eNUM_HEAPS; i++ )
+        {
+            node->getHeapUsage( (Api::HeapId_T) i, dstUsage[i] );
+        }
+        scratchDbForPoints.clearPoints();   // Must clear BEFORE destroying the node
+        destroy( *node );
+    }
+    else
+    {
+        scratchDbForPoints.cleanupPointsAfterNodeCreateFailure();
+    }
+
+    dstJsonBytes = nodeJsonObject.memoryUsage();
+    return result;
+}
+
+/////////////////////////////////
+void FactoryCommon_::attachConfigDigest( Api& node, JsonVariant nodeJsonObject ) noexcept
+{
+    // The digest is not needed for a dry-run
+    if ( !m_measureMode )
+    {
+        node.setConfigDigest( ConfigDigest::create( nodeJsonObject ) );
+    }
+}
+
+bool FactoryCommon_::compareToJSON( JsonVariant&               nodeJsonObject,
+                                    Api&                       node,
+                                    ConfigDigest::DiffClient*  diffClient ) noexcept
+{
+    const ConfigDigest* current = node.getConfigDigest();
+    if ( current == nullptr )
+    {
+        return false;
+    }
+
+    ConfigDigest* updated = ConfigDigest::create( nodeJsonObject );
+    if ( updated == nullptr )
+    {
+        return false;
+    }
+
+    bool same = current->isSame( *updated );
+    if ( !same )
+    {
+        current->diff( *updated, diffClient );
+    }
+    delete updated;
+    return same;
+}
+
+/////////////////////////////////
+/// Returns true if 'src' (or one of its children) defines the Point 'pointId'.  'isPoint' is true when 'src' is a Point definition
+static bool definesPoint_( JsonVariantConst src, uint32_t pointId, bool isPoint ) noexcept
+{
+    if ( src.is<JsonArrayConst>() )
+    {
+        for ( JsonVariantConst item : src.as<JsonArrayConst>() )
+        {
+            if ( definesPoint_( item, pointId, isPoint ) )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    if ( !src.is<JsonObjectConst>() )
+    {
+        return false;
+    }
+
+    JsonObjectConst obj = src.as<JsonObjectConst>();
+    if ( isPoint &&
+         ((obj["id"].is<uint32_t>() && obj["id"].as<uint32_t>() == pointId) ||
+          (obj["ioRegId"].is<uint32_t>() && obj["ioRegId"].as<uint32_t>() == pointId)) )
+    {
+        return true;
+    }
+
+    // Note: The inputs/outputs of a Component are references ("idRef"), i.e. they never match
+    for ( JsonPairConst kv : obj )
+    {
+        const char* key        = kv.key().c_str();
+        bool        childIsPt  = strcmp( key, "inputs" ) == 0 || strcmp( key, "outputs" ) == 0 ||
+                                 strcmp( key, "connectionPts" ) == 0 || strcmp( key, "autoPts" ) == 0 || strcmp( key, "sharedPts" ) == 0 ||
+                                 (isPoint && strcmp( key, "initial" ) == 0);
+        if ( definesPoint_( kv.value(), pointId, childIsPt ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FactoryCommon_::hasCrossChassisAlias( JsonArray& chassisArray ) noexcept
+{
+    for ( JsonObjectConst chassisObj : chassisArray )
+    {
+        for ( JsonObjectConst exeSetObj : chassisObj["executionSets"].as<JsonArrayConst>() )
+        {
+            for ( JsonObjectConst chainObj : exeSetObj["logicChains"].as<JsonArrayConst>() )
+            {
+                for ( JsonObjectConst pointObj : chainObj["connectionPts"].as<JsonArrayConst>() )
+                {
+                    // Note: A producer that can not be found in the Chassis is treated as being in another Chassis
+                    JsonVariantConst aliasOf = pointObj["aliasOf"];
+                    if ( !aliasOf.isNull() && (!aliasOf.is<uint32_t>() || !definesPoint_( chassisObj, aliasOf.as<uint32_t>(), false )) )
+                    {
+                        CPL_SYSTEM_TRACE_MSG( SECT_, ("Cross chassis alias (aliasOf=%lu) -->Chassis are created sequentially", aliasOf.as<unsigned long>()) );
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/////////////////////////////////
+/// Helper method: inserts a cache line sized gap in the specified heap (see separateChassisHeaps())
+static void separateChassisHeap_( Api& node, Api::HeapId_T heapId, bool measureMode ) noexcept
+{
+    // Skip heaps that have not been used (or are full)
+    HeapUsage_T usage;
+    if ( !node.getHeapUsage( heapId, usage ) || usage.requiredBytes == 0 ||
+         (!measureMode && usage.totalBytes - usage.usedBytes < OPTION_FXT_SYSTEM_CACHE_LINE_SIZE) )
+    {
+        return;
+    }
+
+    Cpl::Memory::ContiguousAllocator& heap = heapId == Api::eGENERAL_HEAP ? node.getGeneralAlloactor() :
+                                             heapId == Api::eCARD_STATEFUL_HEAP ? node.getCardStatefulAlloactor() :
+                                             node.getHaStatefulAlloactor();
+    heap.allocate( OPTION_FXT_SYSTEM_CACHE_LINE_SIZE );
+}
+
+void FactoryCommon_::separateChassisHeaps( Api& node ) noexcept
+{
+    for ( int i=0; i < Api::eNUM_HEAPS; i++ )
+    {
+        separateChassisHeap_( node, (Api::HeapId_T) i, m_measureMode );
+    }
+}
+
+/////////////////////////////////
+namespace {
+
+/// Page aligned sub-arenas for pinned Chassis (NUMA placement), else cache line aligned
+#define ARENA_ALIGNMENT_(core)      ((core) != Api::NOT_PINNED ? OPTION_FXT_SYSTEM_PAGE_SIZE : OPTION_FXT_SYSTEM_CACHE_LINE_SIZE)
+
+/** Allocator that gives the Chassis builders exclusive access to the Node's
+    HA heap - one at a time - in Chassis (i.e. JSON) order.  A builder blocks
+    on its first HA allocation until all of the preceding builders have
+    completed.  This makes the layout of the HA heap deterministic, and
+    identical to the layout of a sequentially constructed Node (i.e. the HA
+    image of a Primary matches the HA heap of its Standby).
+ */
+class HaTurnArena_ : public Cpl::Memory::ContiguousAllocator
+{
+public:
+    /// Constructor
+    HaTurnArena_( Api& node ) noexcept
+        : m_node( node )
+        , m_next( nullptr )
+        , m_hasTurn( false )
+    {
+    }
+
+public:
+    /// See Cpl::Memory::Allocator
+    void* allocate( size_t numbytes ) { waitForTurn(); return m_node.getHaStatefulAlloactor().allocate( numbytes ); }
+
+    /// See Cpl::Memory::Allocator
+    size_t wordSize() const noexcept { return m_node.getHaStatefulAlloactor().wordSize(); }
+
+    /// See Cpl::Memory::ContiguousAllocator
+    void reset() noexcept { waitForTurn(); m_node.getHaStatefulAlloactor().reset(); }
+
+    /// See Cpl::Memory::ContiguousAllocator
+    uint8_t* getMemoryStart( size_t& dstAllocatedLenInBytes ) noexcept { waitForTurn(); return m_node.getHaStatefulAlloactor().getMemoryStart( dstAllocatedLenInBytes ); }
+
+public:
+    /// Blocks until the builder has exclusive access to the HA heap
+    void waitForTurn() noexcept
+    {
+        if ( !m_hasTurn )
+        {
+            m_turn.wait();
+            m_hasTurn = true;
+        }
+    }
+
+    /** Hands the HA heap to the next builder (after inserting the same gap as
+        sequential construction does).  MUST be called when the builder has
+        completed - successfully or not.
+     */
+    void passTurn() noexcept
+    {
+        waitForTurn();
+        if ( m_next )
+        {
+            separateChassisHeap_( m_node, Api::eHA_STATEFUL_HEAP, false );
+            m_next->m_turn.signal();
+        }
+    }
+
+public:
+    /// Node
+    Api&                    m_node;
+
+    /// Next builder's arena (nullptr if last)
+    HaTurnArena_*           m_next;
+
+    /// Signaled when it is the builder's turn
+    Cpl::System::Semaphore  m_turn;
+
+    /// True when the builder has exclusive access to the HA heap
+    bool                    m_hasTurn;
+};
+
+/// Transient Runnable object that constructs a single Chassis
+class ChassisBuilder_ : public Cpl::System::Runnable
+{
+public:
+    /// Constructor
+    ChassisBuilder_( JsonObject               chassisObj,
+                     Fxt::Chassis::ServerApi& chassisServer,
+                     Cpl::System::Thread&     chassisThread,
+                     Api&                     node,
+                     Cpl::System::Mutex       heapLocks[2],
+                     Fxt::Point::DatabaseApi& dbForPoints,
+                     Cpl::System::Semaphore&  doneSema,
+                     int                      cpuCore )
+        : m_chassisObj( chassisObj )
+        , m_chassisServer( chassisServer )
+        , m_chassisThread( chassisThread )
+        , m_generalArena( node.getGeneralAlloactor(), heapLocks[0], ARENA_ALIGNMENT_( cpuCore ) )
+        , m_cardStatefulArena( node.getCardStatefulAlloactor(), heapLocks[1], ARENA_ALIGNMENT_( cpuCore ) )
+        , m_haStatefulArena( node )
+        , m_dbForPoints( dbForPoints )
+        , m_doneSema( doneSema )
+        , m_worker( nullptr )
+        , m_chassis( nullptr )
+        , m_errorCode( Fxt::Type::Error::SUCCESS() )
+        , m_haEnd( 0 )
+        , m_cpuCore( cpuCore )
+    {
+    }
+
+protected:
+    /// See Cpl::System::Runnable
+    void appRun()
+    {
+        // Construct the Chassis on the core its thread is pinned to, i.e. the Chassis' memory is 'first touched' by that core (NUMA placement)
+        if ( m_cpuCore != Api::NOT_PINNED )
+        {
+            Fxt::System::CpuAffinity::setThreadAffinity( Cpl::System::Thread::getCurrent(), (unsigned) m_cpuCore );
+        }
+
+        m_chassis = Fxt::Chassis::Api::createChassisfromJSON( m_chassisObj,
+                                                              m_chassisServer,
+                                                              FactoryCommon_::g_componentFactoryDb,
+                                                              FactoryCommon_::g_cardFactoryDb,
+                                                              m_generalArena,
+                                                              m_cardStatefulArena,
+                                                              m_haStatefulArena,
+                                                              FactoryCommon_::g_pointFactoryDb,
+                                                              m_dbForPoints,
+                                                              m_errorCode );
+        m_haStatefulArena.getMemoryStart( m_haEnd );    // Note: Recorded BEFORE the gap for the next Chassis is inserted
+        m_haStatefulArena.passTurn();
+        m_doneSema.signal();
+    }
+
+public:
+    /// Chassis JSON
+    JsonObject                  m_chassisObj;
+
+    /// Chassis server
+    Fxt::Chassis::ServerApi&    m_chassisServer;
+
+    /// Chassis thread
+    Cpl::System::Thread&        m_chassisThread;
+
+    /// Sub-arena: General heap
+    ChassisArena_               m_generalArena;
+
+    /// Sub-arena: Card stateful heap
+    ChassisArena_               m_cardStatefulArena;
+
+    /// HA stateful heap (NOT a sub-arena, i.e. allocated in Chassis order)
+    HaTurnArena_                m_haStatefulArena;
+
+    /// Point database
+    Fxt::Point::DatabaseApi&    m_dbForPoints;
+
+    /// Signaled when the construction has completed
+    Cpl::System::Semaphore&     m_doneSema;
+
+    /// Worker thread (nullptr if the Chassis was constructed in the caller's thread)
+    Cpl::System::Thread*        m_worker;
+
+    /// Created chassis (nullptr if failed)
+    Fxt::Chassis::Api*          m_chassis;
+
+    /// Chassis create result
+    Fxt::Type::Error            m_errorCode;
+
+    /// End of the Chassis' HA data
+    size_t                      m_haEnd;
+
+    /// CPU core to construct the Chassis on (or NOT_PINNED)
+    int                         m_cpuCore;
+};
+
+}; // end anonymous namespace
+
+Fxt::Type::Error FactoryCommon_::createChassisConcurrently( Api&                     node,
+                                                           JsonArray&               chassisArray,
+                                                           Fxt::Point::DatabaseApi& dbForPoints ) noexcept
+{
+    uint8_t                 numChassis = (uint8_t) chassisArray.size();
+    ChassisBuilder_**       builders   = new(std::nothrow) ChassisBuilder_*[numChassis];
+    Cpl::System::Mutex      heapLocks[2];
+    Cpl::System::Semaphore  doneSema;
+    Fxt::Type::Error        result     = Fxt::Type::Error::SUCCESS();
+    if ( builders == nullptr )
+    {
+        result = fullErr( Err_T::FAILED_CREATE_CHASSIS_WORKER );
+        result.logIt();
+        return result;
+    }
+
+    // Create the Chassis threads (and runnable objs).  Note: This is done BEFORE launching the workers since the Node's heaps are NOT thread safe
+    uint8_t numBuilders = 0;
+    for ( ; numBuilders < numChassis; numBuilders++ )
+    {
+        Fxt::Chassis::ServerApi* serverApi;
+        Cpl::System::Thread*     chassisThread = node.createChassisThread( serverApi );
+        if ( chassisThread == nullptr || serverApi == nullptr )
+        {
+            result = fullErr( Err_T::FAILED_CREATE_CHASSIS_SERVER );
+            result.logIt();
+            break;
+        }
+
+        builders[numBuilders] = new(std::nothrow) ChassisBuilder_( chassisArray[numBuilders], *serverApi, *chassisThread, node, heapLocks, dbForPoints, doneSema, node.getChassisCpuCore( numBuilders ) );
+        if ( builders[numBuilders] == nullptr )
+        {
+            node.destroyChassisThread( *chassisThread );
+            result = fullErr( Err_T::FAILED_CREATE_CHASSIS_WORKER );
+            result.logIt();
+            break;
+        }
+    }
+
+    // Construct the chassis
+    if ( result == Fxt::Type::Error::SUCCESS() )
+    {
+        // The HA heap is handed from builder to builder in Chassis order
+        for ( uint8_t i=1; i < numBuilders; i++ )
+        {
+            builders[i - 1]->m_haStatefulArena.m_next = &(builders[i]->m_haStatefulArena);
+        }
+        builders[0]->m_haStatefulArena.m_turn.signal();
+
+        for ( uint8_t i=0; i < numBuilders; i++ )
+        {
+            Cpl::Text::FString<16> name;
+            name.format( "FxtBld%u", i );
+            builders[i]->m_worker = Cpl::System::Thread::create( *(builders[i]), name );
+
+            // Fall back to constructing the Chassis in the current thread if a worker thread can't be created
+            if ( builders[i]->m_worker == nullptr )
+            {
+                builders[i]->m_cpuCore = Api::NOT_PINNED;   // Do NOT pin the caller's thread
+                builders[i]->run();
+            }
+        }
+
+        // Wait for all of the workers to finish
+        for ( uint8_t i=0; i < numBuilders; i++ )
+        {
+            doneSema.wait();
+        }
+        for ( uint8_t i=0; i < numBuilders; i++ )
+        {
+            while ( builders[i]->isRunning() )
+            {
+                Cpl::System::Api::sleep( 1 );
+            }
+        }
+
+
+        // Clean-up the worker threads (they have all run to completion)
+        for ( uint8_t i=0; i < numBuilders; i++ )
+        {
+            if ( builders[i]->m_worker )
+            {
+                Cpl::System::Thread::destroy( *(builders[i]->m_worker) );
+            }
+        }
+    }
+
+    // Add the Chassis to the Node (in JSON order)
+    for ( uint8_t i=0; i < numBuilders; i++ )
+    {
+        ChassisBuilder_* b = builders[i];
+        if ( result == Fxt::Type::Error::SUCCESS() )
+        {
+            if ( b->m_chassis == nullptr )
+            {
+                result = fullErr( Err_T::FAILED_CREATE_CHASSIS );
+                result.logIt();
+            }
+            else if ( b->m_errorCode != Fxt::Type::Error::SUCCESS() )
+            {
+                result = fullErr( Err_T::CHASSIS_CREATE_ERROR );
+                result.logIt();
+            }
+            else
+            {
+                result = node.add( *(b->m_chassis), b->m_chassisThread );
+                if ( result == Fxt::Type::Error::SUCCESS() )
+                {
+                    node.setChassisHaEnd( i, b->m_haEnd );
+                    delete b;
+                    continue;
+                }
+            }
+        }
+
+        // Clean-up the Chassis that were NOT added to the Node
+        if ( b->m_chassis )
+        {
+            b->m_chassis->~Api();
+        }
+        node.destroyChassisThread( b->m_chassisThread );
+        delete b;
+    }
+
+    delete[] builders;
+    return result;
+}
+
+/////////////////////////////////
+Api* FactoryCommon_::createFromStream( Cpl::Io::Input&          nodeJsonStream,
+                                       JsonDocument&            elementDoc,
+                                       Fxt::Point::DatabaseApi& dbForPoints,
+                                       Fxt::Type::Error&        nodeErrorCode ) noexcept
+{
+    Cpl::Json::PullParser parser( nodeJsonStream );
+    Api*                  node       = nullptr;
+    bool                  typeOk     = false;
+    uint8_t               numChassis = 0;
+    char                  key[16];
+
+    nodeErrorCode = Fxt::Type::Error::SUCCESS();
+    parser.beginObject();
+    while ( nodeErrorCode == Fxt::Type::Error::SUCCESS() && parser.nextKey( key, sizeof( key ) ) )
+    {
+        // Validate the Node type
+        if ( strcmp( key, "type" ) == 0 )
+        {
+            char typeGuid[40];  // 8-4-4-4-12 format GUID + null terminator
+            if ( parser.readString( typeGuid, sizeof( typeGuid ) ) && strcmp( typeGuid, getGuid() ) != 0 )
+            {
+                nodeErrorCode = fullErr( Err_T::NOT_ME );
+                nodeErrorCode.logIt();
+            }
+            typeOk = true;
+        }
+
+        // Create Chassis
+        else if ( strcmp( key, "chassis" ) == 0 )
+        {
+            if ( !typeOk || node != nullptr )
+            {
+                nodeErrorCode = fullErr( Err_T::STREAM_TYPE_NOT_FIRST );
+                nodeErrorCode.logIt();
+                break;
+            }
+
+            // Create Node instance (the number of chassis is not known yet -->so use the max allowed)
+            node = createNode( getMaxAllowedChassis(), dbForPoints, JsonVariant(), nodeErrorCode );
+            if ( node == nullptr )
+            {
+                nodeErrorCode = fullErr( Err_T::NO_MEMORY_NODE );
+                nodeErrorCode.logIt();
+                return nullptr;
+            }
+            if ( node->getErrorCode() != Fxt::Type::Error::SUCCESS() )
+            {
+                nodeErrorCode = fullErr( Err_T::NODE_CREATE_ERROR );
+                nodeErrorCode.logIt();
+                break;
+            }
+
+            parser.beginArray();
+            while ( parser.nextElement() )
+            {
+                if ( numChassis >= getMaxAllowedChassis() )
+                {
+                    nodeErrorCode = fullErr( Err_T::MAX_CHASSIS_EXCEEDED );
+                    nodeErrorCode.logIt();
+                    break;
+                }
+                if ( numChassis > 0 )
+                {
+                    separateChassisHeaps( *node );
+                }
+
+                // Create the Chassis thread (and runnable obj) instance
+                Fxt::Chassis::ServerApi* serverApi;
+                Cpl::System::Thread*     chassisThread = node->createChassisThread( serverApi );
+                if ( chassisThread == nullptr || serverApi == nullptr )
+                {
+                    nodeErrorCode = fullErr( Err_T::FAILED_CREATE_CHASSIS_SERVER );
+                    nodeErrorCode.logIt();
+                    break;
+                }
+
+                // Create the Chassis
+                Fxt::Type::Error   errorCode  = Fxt::Type::Error::SUCCESS();
+                Fxt::Chassis::Api* chassisPtr = Fxt::Chassis::Api::createChassisfromStream( parser,
+                                                                                            elementDoc,
+                                                                                            *serverApi,
+                                                                                            g_componentFactoryDb,
+                                                                                            g_cardFactoryDb,
+                                                                                            node->getGeneralAlloactor(),
+                                                                                            node->getCardStatefulAlloactor(),
+                                                                                            node->getHaStatefulAlloactor(),
+                                                                                            g_pointFactoryDb,
+                                                                                            dbForPoints,
+                                                                                            errorCode );
+                if ( chassisPtr == nullptr )
+                {
+                    nodeErrorCode = fullErr( Err_T::FAILED_CREATE_CHASSIS );
+                    nodeErrorCode.logIt();
+                    node->destroyChassisThread( *chassisThread );   // Destroy the thread before deleting the node
+                    break;
+                }
+                nodeErrorCode = node->add( *chassisPtr, *chassisThread );
+                if ( nodeErrorCode != Fxt::Type::Error::SUCCESS() )
+                {
+                    node->destroyChassisThread( *chassisThread );   // Destroy the thread before deleting the node
+                    break;
+                }
+                node->setChassisHaEnd( numChassis, haEnd_( *node ) );
+                numChassis++;
+            }
+        }
+        else
+        {
+            parser.skipValue();
+        }
+    }
+
+    // Minimal syntax checking of the JSON input
+    if ( nodeErrorCode == Fxt::Type::Error::SUCCESS() )
+    {
+        if ( parser.isError() )
+        {
+            nodeErrorCode = fullErr( Err_T::PARSE_STREAM );
+            nodeErrorCode.logIt();
+        }
+        else if ( !typeOk )
+        {
+            nodeErrorCode = fullErr( Err_T::NOT_ME );
+            nodeErrorCode.logIt();
+        }
+        else if ( numChassis == 0 )
+        {
+            nodeErrorCode = fullErr( Err_T::PARSE_CHASSIS_ARRAY );
+            nodeErrorCode.logIt();
+        }
+    }
+
+    if ( nodeErrorCode != Fxt::Type::Error::SUCCESS() )
+    {
+        if ( node )
+        {
+            destroy( *node );
+        }
+        return nullptr;
+    }
+
+    // If I get here -->everything worked
+    addNode( *node );
+    return node;
+}
+
+
+/////////////////////////////////
+namespace {
+
+/// Bounds checked, little-endian, reader for a Node Image
+class ImageReader_
+{
+public:
+    /// Constructor
+    ImageReader_( const uint8_t* start, size_t len ) :m_ptr( start ), m_end( start + len ), m_ok( true ) {}
+
+    /// Returns false if a read has gone past the end of the image or an unexpected record tag was encountered
+    bool isOk() const { return m_ok; }
+
+    /// Returns true when the entire image has been consumed
+    bool atEnd() const { return m_ptr == m_end; }
+
+    /// Consumes a record tag
+    bool tag( uint8_t expectedTag ) { if ( u8() != expectedTag ) { m_ok = false; } return m_ok; }
+
+    /// Returns a pointer to the next 'n' bytes (and consumes them). Returns nullptr if past the end of the image
+    const uint8_t* take( size_t n )
+    {
+        if ( !m_ok || (size_t) (m_end - m_ptr) < n )
+        {
+            m_ok = false;
+            return nullptr;
+        }
+        const uint8_t* p = m_ptr;
+        m_ptr += n;
+        return p;
+    }
+
+    /// Reads an unsigned integer of 'n' bytes
+    uint64_t uint( size_t n )
+    {
+        const uint8_t* p   = take( n );
+        uint64_t       val = 0;
+        for ( size_t i=0; p && i < n; i++ )
+        {
+            val |= ((uint64_t) p[i]) << (8 * i);
+        }
+        return val;
+    }
+
+    /// Reads a uint8_t
+    uint8_t u8() { return (uint8_t) uint( 1 ); }
+
+    /// Reads a uint16_t
+    uint16_t u16() { return (uint16_t) uint( 2 ); }
+
+    /// Reads a uint32_t
+    uint32_t u32() { return (uint32_t) uint( 4 ); }
+
+    /// Reads a uint64_t
+    uint64_t u64() { return uint( 8 ); }
+
+protected:
+    /// Current position
+    const uint8_t* m_ptr;
+
+    /// End of the image
+    const uint8_t* m_end;
+
+    /// Status
+    bool           m_ok;
+};
+
+}; // end anonymous namespace
+
+/// Helper method: decodes a single element record
+static bool readImageElement_( ImageReader_& image, uint8_t recordTag, JsonDocument& elementDoc, Fxt::Type::Error& errorCode )
+{
+    uint32_t       len  = image.tag( recordTag ) ? image.u32() : 0;
+    const uint8_t* data = image.take( len );
+    if ( data == nullptr )
+    {
+        errorCode = fullErr( Err_T::IMAGE_BAD_RECORD );
+        errorCode.logIt();
+        return false;
+    }
+    if ( deserializeMsgPack( elementDoc, (const char*) data, len ) != DeserializationError::Ok )
+    {
+        errorCode = fullErr( Err_T::IMAGE_ELEMENT_ERROR );
+        errorCode.logIt();
+        return false;
+    }
+    return true;
+}
+
+/// Helper method: sets and logs an error code. Always returns nullptr
+static Fxt::Chassis::Api* chassisFailure_( Fxt::Type::Error newError, Fxt::Type::Error& errorCode )
+{
+    errorCode = newError;
+    errorCode.logIt();
+    return nullptr;
+}
+
+/// Helper method: creates a single Chassis from the image
+static Fxt::Chassis::Api* createChassisFromImage_( ImageReader_&            image,
+                                                   JsonDocument&            elementDoc,
+                                                   Fxt::Chassis::ServerApi& chassisServer,
+                                                   Api&                     node,
+                                                   Fxt::Point::DatabaseApi& dbForPoints,
+                                                   Fxt::Type::Error&        errorCode ) noexcept
+{
+    Cpl::Memory::ContiguousAllocator& generalAllocator = node.getGeneralAlloactor();
+    Cpl::Memory::ContiguousAllocator& haAllocator      = node.getHaStatefulAlloactor();
+
+    // Chassis record (the counts are pre-computed)
+    uint64_t fer          = image.tag( Fxt::Node::Image::RECORD_CHASSIS ) ? image.u64() : 0;
+    uint16_t numScanners  = image.u16();
+    uint16_t numExeSets   = image.u16();
+    uint16_t numSharedPts = image.u16();
+    if ( !image.isOk() || numScanners == 0 || numExeSets == 0 )
+    {
+        return chassisFailure_( fullErr( Err_T::IMAGE_BAD_RECORD ), errorCode );
+    }
+    uint8_t* ownedPts = Fxt::Chassis::Chassis::allocateOwnedPoints( generalAllocator, dbForPoints );
+    if ( ownedPts == nullptr )
+    {
+        return chassisFailure_( Fxt::Chassis::fullErr( Fxt::Chassis::Err_T::NO_MEMORY_OWNED_PTS_LIST ), errorCode );
+    }
+    Fxt::Point::OwnershipDatabase ownedDb( dbForPoints, ownedPts );
+    void* memChassis = generalAllocator.allocate( sizeof( Fxt::Chassis::Chassis ) );
+    if ( memChassis == nullptr )
+    {
+        return chassisFailure_( Fxt::Chassis::fullErr( Fxt::Chassis::Err_T::NO_MEMORY_CHASSIS ), errorCode );
+    }
+    Fxt::Chassis::Api* chassis = new(memChassis) Fxt::Chassis::Chassis( chassisServer, generalAllocator, fer, numScanners, numExeSets, numSharedPts, ownedPts );
+
+    // Create Scanners (and their cards)
+    for ( uint16_t i=0; i < numScanners && errorCode == Fxt::Type::Error::SUCCESS(); i++ )
+    {
+        uint32_t srm      = image.tag( Fxt::Node::Image::RECORD_SCANNER ) ? image.u32() : 0;
+        uint16_t numCards = image.u16();
+        if ( !image.isOk() || numCards == 0 )
+        {
+            chassisFailure_( fullErr( Err_T::IMAGE_BAD_RECORD ), errorCode );
+            break;
+        }
+        void* memScanner = generalAllocator.allocate( sizeof( Fxt::Chassis::Scanner ) );
+        if ( memScanner == nullptr )
+        {
+            chassisFailure_( Fxt::Chassis::fullErr( Fxt::Chassis::Err_T::NO_MEMORY_SCANNER ), errorCode );
+            break;
+        }
+        Fxt::Chassis::ScannerApi* scanner = new(memScanner) Fxt::Chassis::Scanner( generalAllocator, numCards, srm );
+
+        for ( uint16_t j=0; j < numCards && errorCode == Fxt::Type::Error::SUCCESS(); j++ )
+        {
+            if ( !readImageElement_( image, Fxt::Node::Image::RECORD_CARD, elementDoc, errorCode ) )
+            {
+                break;
+            }
+
+            Fxt::Type::Error cardError = Fxt::Type::Error::SUCCESS();
+            JsonObject       cardJson  = elementDoc.as<JsonObject>();
+            Fxt::Card::Api*  card      = FactoryCommon_::g_cardFactoryDb.createCardfromJSON( cardJson,
+                                                                                             generalAllocator,
+                                                                                             node.getCardStatefulAlloactor(),
+                                                                                             haAllocator,
+                                                                                             FactoryCommon_::g_pointFactoryDb,
+                                                                                             ownedDb,
+                                                                                             cardError );
+            if ( card == nullptr || cardError != Fxt::Type::Error::SUCCESS() )
+            {
+                chassisFailure_( Fxt::Chassis::fullErr( card == nullptr ? Fxt::Chassis::Err_T::FAILED_CREATE_CARD : Fxt::Chassis::Err_T::CARD_CREATE_ERROR ), errorCode );
+                if ( card )
+                {
+                    card->~Api();
+                }
+                break;
+            }
+            errorCode = scanner->add( *card );
+        }
+
+        // Note: The cards MUST be added to the scanner BEFORE the scanner is added to the chassis
+        if ( errorCode == Fxt::Type::Error::SUCCESS() )
+        {
+            errorCode = chassis->add( *scanner );
+        }
+        if ( errorCode != Fxt::Type::Error::SUCCESS() )
+        {
+            scanner->~ScannerApi();
+        }
+    }
+
+    // Create Execution Sets (and their logic chains)
+    for ( uint16_t i=0; i < numExeSets && errorCode == Fxt::Type::Error::SUCCESS(); i++ )
+    {
+        uint32_t erm       = image.tag( Fxt::Node::Image::RECORD_EXESET ) ? image.u32() : 0;
+        uint16_t numChains = image.u16();
+        if ( !image.isOk() || numChains == 0 )
+        {
+            chassisFailure_( fullErr( Err_T::IMAGE_BAD_RECORD ), errorCode );
+            break;
+        }
+        void* memExeSet = generalAllocator.allocate( sizeof( Fxt::Chassis::ExecutionSet ) );
+        if ( memExeSet == nullptr )
+        {
+            chassisFailure_( Fxt::Chassis::fullErr( Fxt::Chassis::Err_T::NO_MEMORY_EXECUTION_SET ), errorCode );
+            break;
+        }
+        Fxt::Chassis::ExecutionSetApi* exeSet = new(memExeSet) Fxt::Chassis::ExecutionSet( generalAllocator, numChains, erm );
+        errorCode = chassis->add( *exeSet );
+        if ( errorCode != Fxt::Type::Error::SUCCESS() )
+        {
+            exeSet->~ExecutionSetApi();
+            break;
+        }
+
+        for ( uint16_t j=0; j < numChains && errorCode == Fxt::Type::Error::SUCCESS(); j++ )
+        {
+            if ( !readImageElement_( image, Fxt::Node::Image::RECORD_LOGIC_CHAIN, elementDoc, errorCode ) )
+            {
+                break;
+            }
+
+            Fxt::Type::Error      chainError = Fxt::Type::Error::SUCCESS();
+            JsonVariant           chainJson  = elementDoc.as<JsonVariant>();
+            Fxt::LogicChain::Api* logicChain = Fxt::LogicChain::Api::createLogicChainfromJSON( chainJson,
+                                                                                               FactoryCommon_::g_componentFactoryDb,
+                                                                                               generalAllocator,
+                                                                                               haAllocator,
+                                                                                               FactoryCommon_::g_pointFactoryDb,
+                                                                                               ownedDb,
+                                                                                               chainError );
+            if ( logicChain == nullptr || chainError != Fxt::Type::Error::SUCCESS() )
+            {
+                chassisFailure_( Fxt::Chassis::fullErr( logicChain == nullptr ? Fxt::Chassis::Err_T::FAILED_CREATE_LOGIC_CHAIN : Fxt::Chassis::Err_T::LOGIC_CHAIN_CREATE_ERROR ), errorCode );
+                if ( logicChain )
+                {
+                    logicChain->~Api();
+                }
+                break;
+            }
+            errorCode = exeSet->add( *logicChain );
+        }
+    }
+
+    // Create Shared Points (with cache line padding, same as Fxt::Chassis::Api::createChassisfromJSON())
+    Fxt::System::CacheAlignedAllocator sharedPtsAllocator( haAllocator );
+    for ( uint16_t i=0; i < numSharedPts && errorCode == Fxt::Type::Error::SUCCESS(); i++ )
+    {
+        if ( !readImageElement_( image, Fxt::Node::Image::RECORD_SHARED_PT, elementDoc, errorCode ) )
+        {
+            break;
+        }
+
+        Fxt::Type::Error pointError;
+        JsonObject       pointJson = elementDoc.as<JsonObject>();
+        Fxt::Point::Api* pt = FactoryCommon_::g_pointFactoryDb.createPointfromJSON( pointJson,
+                                                                                    pointError,
+                                                                                    generalAllocator,
+                                                                                    sharedPtsAllocator,  // Note: Share points ARE part of the HA data
+                                                                                    ownedDb,
+                                                                                    "id",
+                                                                                    true );
+        if ( pt == nullptr )
+        {
+            chassisFailure_( Fxt::Chassis::fullErr( Fxt::Chassis::Err_T::FAILED_CREATE_SHARED_POINTS ), errorCode );
+            break;
+        }
+        errorCode = chassis->add( *pt );
+    }
+
+    // Build the Chassis's execution schedule
+    if ( errorCode == Fxt::Type::Error::SUCCESS() )
+    {
+        errorCode = chassis->buildSchedule();
+    }
+    if ( errorCode != Fxt::Type::Error::SUCCESS() )
+    {
+        chassis->~Api();
+        return nullptr;
+    }
+    return chassis;
+}
+
+/////////////////////////////////
+Api* FactoryCommon_::createFromImage( const void*              image,
+                                      size_t                   imageLen,
+                                      JsonDocument&            elementDoc,
+                                      Fxt::Point::DatabaseApi& dbForPoints,
+                                      Fxt::Type::Error&        nodeErrorCode ) noexcept
+{
+    // Validate the header
+    ImageReader_ header( (const uint8_t*) image, image == nullptr ? 0 : imageLen );
+    uint32_t     magic      = header.u32();
+    uint16_t     version    = header.u16();
+    uint16_t     headerSize = header.u16();
+    uint32_t     payloadLen = header.u32();
+    uint32_t     payloadCrc = header.u32();
+    if ( !header.isOk() ||
+         magic != Image::MAGIC ||
+         version != Image::VERSION ||
+         headerSize != Image::HEADER_SIZE ||
+         payloadLen != imageLen - Image::HEADER_SIZE )
+    {
+        nodeErrorCode = fullErr( Err_T::IMAGE_INVALID_HEADER );
+        nodeErrorCode.logIt();
+        return nullptr;
+    }
+    const uint8_t*                   payload = header.take( payloadLen );
+    Cpl::Checksum::Crc32EthernetFast crc;
+    crc.accumulate( payload, payloadLen );
+    if ( crc.finalize() != payloadCrc )
+    {
+        nodeErrorCode = fullErr( Err_T::IMAGE_CRC_ERROR );
+        nodeErrorCode.logIt();
+        return nullptr;
+    }
+
+    // Validate the Node type
+    ImageReader_   reader( payload, payloadLen );
+    uint8_t        numChassis = reader.tag( Image::RECORD_NODE ) ? reader.u8() : 0;
+    const uint8_t* typeGuid   = reader.take( Image::GUID_SIZE );
+    if ( !reader.isOk() || numChassis == 0 )
+    {
+        nodeErrorCode = fullErr( Err_T::IMAGE_BAD_RECORD );
+        nodeErrorCode.logIt();
+        return nullptr;
+    }
+    if ( strncmp( (const char*) typeGuid, getGuid(), Image::GUID_SIZE ) != 0 )
+    {
+        nodeErrorCode = fullErr( Err_T::NOT_ME );
+        nodeErrorCode.logIt();
+        return nullptr;
+    }
+    if ( numChassis > getMaxAllowedChassis() )
+    {
+        nodeErrorCode = fullErr( Err_T::MAX_CHASSIS_EXCEEDED );
+        nodeErrorCode.logIt();
+        return nullptr;
+    }
+
+    // Create Node instance
+    Api* node = createNode( numChassis, dbForPoints, JsonVariant(), nodeErrorCode );
+    if ( node == nullptr )
+    {
+        nodeErrorCode = fullErr( Err_T::NO_MEMORY_NODE );
+        nodeErrorCode.logIt();
+        return nullptr;
+    }
+    if ( node->getErrorCode() != Fxt::Type::Error::SUCCESS() )
+    {
+        nodeErrorCode = fullErr( Err_T::NODE_CREATE_ERROR );
+        nodeErrorCode.logIt();
+        destroy( *node );
+        return nullptr;
+    }
+
+    // Create Chassis
+    nodeErrorCode = Fxt::Type::Error::SUCCESS();
+    for ( uint8_t i=0; i < numChassis; i++ )
+    {
+        if ( i > 0 )
+        {
+            separateChassisHeaps( *node );
+        }
+
+        // Create the Chassis thread (and runnable obj) instance
+        Fxt::Chassis::ServerApi* serverApi;
+        Cpl::System::Thread*     chassisThread = node->createChassisThread( serverApi );
+        if ( chassisThread == nullptr || serverApi == nullptr )
+        {
+            nodeErrorCode = fullErr( Err_T::FAILED_CREATE_CHASSIS_SERVER );
+            nodeErrorCode.logIt();
+            destroy( *node );
+            return nullptr;
+        }
+
+        // Create the Chassis
+        Fxt::Chassis::Api* chassisPtr = createChassisFromImage_( reader, elementDoc, *serverApi, *node, dbForPoints, nodeErrorCode );
+        if ( chassisPtr == nullptr )
+        {
+            node->destroyChassisThread( *chassisThread );   // Destroy the thread before deleting the node
+            destroy( *node );
+            return nullptr;
+        }
+        nodeErrorCode = node->add( *chassisPtr, *chassisThread );
+        if ( nodeErrorCode != Fxt::Type::Error::SUCCESS() )
+        {
+            node->destroyChassisThread( *chassisThread );   // Destroy the thread before deleting the node
+            destroy( *node );
+            return nullptr;
+        }
+        node->setChassisHaEnd( i, haEnd_( *node ) );
+    }
+
+    // There should be nothing left over
+    if ( !reader.atEnd() )
+    {
+        nodeErrorCode = fullErr( Err_T::IMAGE_BAD_RECORD );
+        nodeErrorCode.logIt();
+        destroy( *node );
+        return nullptr;
+    }
+
+    // If I get here -->everything worked
+    addNode( *node );
+    return node;
+}
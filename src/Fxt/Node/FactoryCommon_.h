@@ -34,6 +34,64 @@ public:
     /// Destructor
     ~FactoryCommon_();
 
+public:
+    /** This method enables/disables concurrent construction of Chassis by
+        createFromJSON().  When enabled - and the Node has more than one
+        Chassis - each Chassis is parsed and constructed on its own (transient)
+        worker thread using per-chassis sub-arenas of the Node's heaps (see
+        Fxt::Node::ChassisArena_).  The default is disabled.
+
+        NOTES:
+            - The Point IDs of the individual Chassis MUST be disjoint, i.e.
+              the Point database is updated concurrently.
+            - The HA stateful heap is NOT split into sub-arenas.  Instead the
+              builders are given exclusive access to it one at a time - in
+              JSON order - i.e. the layout of the HA heap is deterministic
+              and identical to sequential construction (a requirement for
+              Fxt::Node::Ha).  A builder blocks on its first HA allocation
+              until the preceding builders have completed.
+            - Because of the sub-arena chunking, the Node's general and card
+              stateful heaps require additional head room (up to a few
+              OPTION_FXT_NODE_CHASSIS_ARENA_CHUNK_SIZE chunks per Chassis per
+              heap) compared to sequential construction.
+            - If a Logic Chain has a connector Point that is an alias of a
+              Point in a different Chassis ("aliasOf"), the Chassis are
+              created sequentially (see hasCrossChassisAlias()).
+            - Point references are still resolved - sequentially - when
+              the Node is started (a Chassis can reference Points that are
+              created by a different Chassis).
+            - The sub-arenas are cache line aligned so that the data of
+              different Chassis never shares a cache line.  When the Node
+              pins a Chassis to a CPU core (see Fxt::Node::Api::getChassisCpuCore())
+              the worker thread is pinned to the same core and the sub-arenas
+              are page aligned, i.e. the Chassis' memory is 'first touched' -
+              and placed on the NUMA node of - the core that executes the
+              Chassis.  This requires that the Node's heap memory has not
+              been touched before the Chassis are constructed.  The
+              Fxt::Node::Common_ heaps are allocated using calloc() and are
+              NOT zero filled by the heap, i.e. large heaps are backed by
+              fresh (untouched) pages on platforms such as Linux.
+     */
+    void enableParallelChassisCreate( bool enabled ) noexcept { m_parallelCreate = enabled; }
+
+    /** This method enables/disables backing the heaps of subsequently created
+        Nodes with locked memory, i.e. memory that is pre-faulted, locked into
+        physical memory, and - when possible - backed by huge pages (see
+        Fxt::System::LockedMemory).  This eliminates page faults and TLB misses
+        (aka jitter) when the Chassis access their data.  The default is
+        disabled.
+
+        NOTES:
+            - Support is Node and platform specific.  A heap falls back to
+              the platform heap if the locked memory can not be allocated
+              (e.g. because of the OS's RLIMIT_MEMLOCK limit).  Use
+              Fxt::Node::Api::getHeapUsage() to determine if a heap is locked.
+            - Locked memory is pre-faulted by the thread that creates the
+              Node, i.e. it is NOT placed by the Chassis builder threads when
+              using enableParallelChassisCreate().
+     */
+    void enableLockedHeaps( bool enabled ) noexcept { m_lockedHeaps = enabled; }
+
 public:
     /// See Fxt::Node::FactoryApi
     void destroy( Api& nodeToDestroy ) noexcept;
@@ -43,13 +101,82 @@ public:
                          Fxt::Point::DatabaseApi& dbForPoints,
                          Fxt::Type::Error&        nodeErrorode ) noexcept;
 
+    /// See Fxt::Node::FactoryApi
+    Api* createFromStream( Cpl::Io::Input&          nodeJsonStream,
+                           JsonDocument&            elementDoc,
+                           Fxt::Point::DatabaseApi& dbForPoints,
+                           Fxt::Type::Error&        nodeErrorode ) noexcept;
+
+    /// See Fxt::Node::FactoryApi
+    Api* createFromImage( const void*              image,
+                          size_t                   imageLen,
+                          JsonDocument&            elementDoc,
+                          Fxt::Point::DatabaseApi& dbForPoints,
+                          Fxt::Type::Error&        nodeErrorode ) noexcept;
+
+    /// See Fxt::Node::FactoryApi
+    Fxt::Type::Error measureFromJSON( JsonVariant&             nodeJsonObject,
+                                      Fxt::Point::DatabaseApi& scratchDbForPoints,
+                                      HeapUsage_T              dstUsage[Api::eNUM_HEAPS],
+                                      size_t&                  dstJsonBytes ) noexcept;
+
+    /// See Fxt::Node::FactoryApi
+    bool compareToJSON( JsonVariant&               nodeJsonObject,
+                        Api&                       node,
+                        ConfigDigest::DiffClient*  diffClient = nullptr ) noexcept;
+
 protected:
-    /// Helper method that perform the Node specific create.  Assumes the new(std::nothrow) is used to allocate the Node instance
+    /** Helper method that perform the Node specific create.  Assumes the new(std::nothrow) is used to allocate the Node instance.
+        Note: 'nodeJsonObject' is a null JsonVariant when the Node is created from a JSON stream or a Node Image
+     */
     virtual Api* createNode( uint8_t                    numChassis,
                              Fxt::Point::DatabaseApi&   pointDb,
                              JsonVariant                nodeJsonObject,
                              Fxt::Type::Error&          nodeErrorCode ) noexcept = 0;
 
+    /** Helper method that adds a successfully created Node to the list of
+        Nodes (see Fxt::Node::Api::getNode()).  A dry-run Node (see
+        measureFromJSON()) is NOT added.
+     */
+    void addNode( Api& node ) noexcept;
+
+    /** Helper method that computes - and transfers to the Node - the digest
+        of the Node's JSON definition.  Failing to create the digest is NOT an
+        error, i.e. the Node simply does not have a digest.
+     */
+    void attachConfigDigest( Api& node, JsonVariant nodeJsonObject ) noexcept;
+
+    /** Helper method that inserts a cache line sized gap in each of the
+        Node's heaps so that the data of consecutively (i.e. sequentially)
+        constructed Chassis never shares a cache line.  Heaps that are unused,
+        or that do not have room for the gap, are skipped.
+     */
+    void separateChassisHeaps( Api& node ) noexcept;
+
+    /** Helper method that returns true if a Logic Chain of one Chassis has a
+        connector Point that is an alias of a Point in a different Chassis
+        (e.g. that Chassis' Shared Points).  The alias' producer is looked up
+        when the Logic Chain is created, i.e. the Chassis MUST be created
+        sequentially (in JSON order).  Note: An 'aliasOf' ID that can not be
+        found in the Chassis' definition is treated as a cross Chassis alias.
+     */
+    static bool hasCrossChassisAlias( JsonArray& chassisArray ) noexcept;
+
+    /// Helper method that constructs the Node's Chassis concurrently.  Returns SUCCESS if all of the Chassis were created and added to the Node
+    Fxt::Type::Error createChassisConcurrently( Api&                     node,
+                                                JsonArray&               chassisArray,
+                                                Fxt::Point::DatabaseApi& dbForPoints ) noexcept;
+
+protected:
+    /// Concurrent Chassis construction enabled
+    bool m_parallelCreate;
+
+    /// Set while performing a measureFromJSON() dry-run
+    bool m_measureMode;
+
+    /// Back the Node heaps with locked memory
+    bool m_lockedHeaps;
+
 public:
     // NOTE: The following members are made public to facilitate accessing the factory databases
 
@@ -0,0 +1,201 @@
+#ifndef Fxt_Node_Ha_Frame_h_
+#define Fxt_Node_Ha_Frame_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file
+
+    This file defines the wire format of the frames that a Primary Node sends
+    to its Standby Node (see Fxt::Node::Ha::Primary and Fxt::Node::Ha::Standby).
+    The 'image' is the allocated content of the Node's HA Stateful heap,
+    followed by the allocated content of the Chassis' 'shadow' HA heaps (i.e.
+    the HA data of hot-swapped Scanners/ExecutionSets - see
+    Fxt::Chassis::HotSwap) in Chassis order.
+
+    \code
+
+    All multi-byte fields are little-endian.
+
+    Header (HEADER_SIZE bytes):
+        uint32_t    magic           MAGIC
+        uint16_t    version         VERSION
+        uint8_t     frameType       FRAME_FULL, FRAME_DELTA, or FRAME_HEARTBEAT
+        uint8_t     reserved        Always zero
+        uint32_t    sequence        Snapshot sequence number (a heartbeat contains the sequence number of the last snapshot sent)
+        uint32_t    imageLen        Size, in bytes, of the image
+        uint32_t    payloadLen      Number of bytes following the header
+        uint32_t    imageCrc        CRC32 (Cpl::Checksum::Crc32EthernetFast) of the complete image (i.e. after a delta has been applied)
+        uint8_t     identity[20]    Identity of the image's layout (see computeIdentity())
+
+    Payload:
+        FRAME_FULL          <imageLen bytes of image>
+        FRAME_DELTA         A sequence of records.  Each record is:
+                                uint32_t offset, uint32_t len, <len bytes of image starting at 'offset'>
+        FRAME_HEARTBEAT     <no payload>
+
+    \endcode
+
+    A delta frame is relative to the snapshot with the previous sequence
+    number, i.e. it can only be applied when the receiver has the snapshot
+    'sequence-1' with the same identity.
+ */
+
+#include "Fxt/Node/Api.h"
+#include "Fxt/Node/ConfigDigest.h"
+#include "Cpl/Checksum/Crc32EthernetFast.h"
+#include <stdint.h>
+#include <string.h>
+
+///
+namespace Fxt {
+///
+namespace Node {
+///
+namespace Ha {
+
+/// Magic value: 'FXHA' when stored little-endian
+static constexpr uint32_t MAGIC              = 0x41485846;
+
+/// Current frame format version
+static constexpr uint16_t VERSION            = 2;
+
+/// Size, in bytes, of the image identity
+static constexpr unsigned IDENTITY_SIZE      = 20;
+
+/// Size, in bytes, of the frame header
+static constexpr unsigned HEADER_SIZE        = 24 + IDENTITY_SIZE;
+
+/// Size, in bytes, of a delta record's header
+static constexpr unsigned RECORD_HEADER_SIZE = 8;
+
+/// Frame types
+static constexpr uint8_t  FRAME_FULL         = 'F';
+static constexpr uint8_t  FRAME_DELTA        = 'D';  //!< Frame type
+static constexpr uint8_t  FRAME_HEARTBEAT    = 'H';  //!< Frame type
+
+
+/// Frame header
+struct Header_T
+{
+    uint32_t    sequence;       //!< Snapshot sequence number
+    uint32_t    imageLen;       //!< Size of the image
+    uint32_t    payloadLen;     //!< Number of bytes following the header
+    uint32_t    imageCrc;       //!< CRC of the complete image
+    uint8_t     frameType;      //!< Frame type
+    uint8_t     identity[IDENTITY_SIZE];    //!< Identity of the image's layout
+};
+
+/// Helper method: stores 'numBytes' of 'val' in little-endian order
+inline void encodeUint( uint8_t* dst, uint32_t val, unsigned numBytes ) noexcept
+{
+    for ( unsigned i=0; i < numBytes; i++ )
+    {
+        dst[i] = (uint8_t) (val >> (8 * i));
+    }
+}
+
+/// Helper method: returns the value of 'numBytes' of little-endian data
+inline uint32_t decodeUint( const uint8_t* src, unsigned numBytes ) noexcept
+{
+    uint32_t val = 0;
+    for ( unsigned i=0; i < numBytes; i++ )
+    {
+        val |= ((uint32_t) src[i]) << (8 * i);
+    }
+    return val;
+}
+
+/// Helper method: encodes a frame header into 'dst' (which must be at least HEADER_SIZE bytes)
+inline void encodeHeader( uint8_t* dst, const Header_T& header ) noexcept
+{
+    encodeUint( dst, MAGIC, 4 );
+    encodeUint( dst + 4, VERSION, 2 );
+    dst[6] = header.frameType;
+    dst[7] = 0;
+    encodeUint( dst + 8, header.sequence, 4 );
+    encodeUint( dst + 12, header.imageLen, 4 );
+    encodeUint( dst + 16, header.payloadLen, 4 );
+    encodeUint( dst + 20, header.imageCrc, 4 );
+    memcpy( dst + 24, header.identity, IDENTITY_SIZE );
+}
+
+/** Helper method: decodes a frame header from 'src' (which must be at least
+    HEADER_SIZE bytes). Returns false if 'src' is not a valid header
+ */
+inline bool decodeHeader( const uint8_t* src, Header_T& header ) noexcept
+{
+    if ( decodeUint( src, 4 ) != MAGIC || decodeUint( src + 4, 2 ) != VERSION )
+    {
+        return false;
+    }
+    header.frameType  = src[6];
+    header.sequence   = decodeUint( src + 8, 4 );
+    header.imageLen   = decodeUint( src + 12, 4 );
+    header.payloadLen = decodeUint( src + 16, 4 );
+    header.imageCrc   = decodeUint( src + 20, 4 );
+    memcpy( header.identity, src + 24, IDENTITY_SIZE );
+    return header.frameType == FRAME_FULL || header.frameType == FRAME_DELTA || header.frameType == FRAME_HEARTBEAT;
+}
+
+/** Helper method: computes the identity of the HA image of 'node' into 'dst'
+    (which must be at least IDENTITY_SIZE bytes).  The identity consists of
+    the MD5 hash of the Node's definition (all zeros when the Node does not
+    have a Fxt::Node::ConfigDigest), followed by the CRC32 of the image's
+    layout, i.e. the Node type, the HA regions of the individual Chassis (see
+    Fxt::Node::Api::getChassisHaRegion()), and the allocated size of each
+    Chassis' shadow HA heap.  'shadowHaHeaps' is either nullptr or an array
+    of getNumChassis() entries (where a nullptr entry indicates a Chassis
+    without a shadow HA heap).
+
+    Returns false if the HA regions of the Node's Chassis are not known.
+ */
+inline bool computeIdentity( Fxt::Node::Api&                           node,
+                             Cpl::Memory::ContiguousAllocator* const*  shadowHaHeaps,
+                             uint8_t*                                  dst ) noexcept
+{
+    const Fxt::Node::ConfigDigest* digest = node.getConfigDigest();
+    memset( dst, 0, IDENTITY_SIZE );
+    if ( digest )
+    {
+        memcpy( dst, digest->getHash(), sizeof( Cpl::Checksum::ApiMd5::Digest_T ) );
+    }
+
+    Cpl::Checksum::Crc32EthernetFast crc;
+    const char*                      typeGuid   = node.getTypeGuid();
+    uint16_t                         numChassis = node.getNumChassis();
+    uint8_t                          raw[12];
+    crc.accumulate( typeGuid, (unsigned) strlen( typeGuid ) );
+    for ( uint16_t i=0; i < numChassis; i++ )
+    {
+        size_t offset;
+        size_t len;
+        size_t shadowLen = 0;
+        if ( !node.getChassisHaRegion( i, offset, len ) )
+        {
+            return false;
+        }
+        if ( shadowHaHeaps && shadowHaHeaps[i] )
+        {
+            shadowHaHeaps[i]->getMemoryStart( shadowLen );
+        }
+        encodeUint( raw, (uint32_t) offset, 4 );
+        encodeUint( raw + 4, (uint32_t) len, 4 );
+        encodeUint( raw + 8, (uint32_t) shadowLen, 4 );
+        crc.accumulate( raw, sizeof( raw ) );
+    }
+    encodeUint( dst + 16, crc.finalize(), 4 );
+    return true;
+}
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,455 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Primary.h"
+#include "Frame.h"
+#include "Fxt/System/ElapsedTime.h"
+#include "Cpl/System/ElapsedTime.h"
+#include "Cpl/Checksum/Crc32EthernetFast.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/Trace.h"
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+#define SECT_   "Fxt::Node::Ha"
+
+///
+using namespace Fxt::Node::Ha;
+
+
+//////////////////////////////////////////////////
+Primary::Primary( Fxt::Node::Api&             node,
+                  Cpl::Io::Socket::Connector& connector,
+                  const char*                 standbyHostName,
+                  int                         standbyPortNum,
+                  uint32_t                    shipEveryNCycles,
+                  uint32_t                    heartbeatMsec,
+                  uint32_t                    fullSnapshotInterval ) noexcept
+    : m_node( node )
+    , m_connector( connector )
+    , m_host( standbyHostName )
+    , m_copyMsgs( nullptr )
+    , m_shadowHeaps( nullptr )
+    , m_current( nullptr )
+    , m_previous( nullptr )
+    , m_maxImageLen( 0 )
+    , m_previousLen( 0 )
+    , m_previousCrc( 0 )
+    , m_lastConnectAttempt( 0 )
+    , m_copied( new(std::nothrow) Cpl::System::Semaphore() )
+    , m_shadowCapacity( 0 )
+    , m_port( standbyPortNum )
+    , m_numChassis( node.getNumChassis() )
+    , m_shipCycles( shipEveryNCycles == 0 ? 1 : shipEveryNCycles )
+    , m_heartbeatMsec( heartbeatMsec )
+    , m_fullInterval( fullSnapshotInterval )
+    , m_sinceFull( 0 )
+    , m_sequence( 0 )
+    , m_numFull( 0 )
+    , m_numDelta( 0 )
+    , m_numHeartbeats( 0 )
+    , m_numAbandoned( 0 )
+    , m_connected( false )
+    , m_connectAttempted( false )
+    , m_stopRequested( false )
+{
+    memset( m_identity, 0, sizeof( m_identity ) );
+    memset( m_previousIdentity, 0, sizeof( m_previousIdentity ) );
+
+    // Size the snapshot buffers to the capacity of the HA heap
+    Fxt::Node::HeapUsage_T usage;
+    if ( m_node.getHeapUsage( Fxt::Node::Api::eHA_STATEFUL_HEAP, usage ) )
+    {
+        allocateBuffers( usage.totalBytes );
+    }
+
+    uint16_t numChassis = m_numChassis;
+    if ( numChassis > 0 )
+    {
+        m_copyMsgs    = new(std::nothrow) CopyMsg[numChassis];
+        m_shadowHeaps = new(std::nothrow) Cpl::Memory::ContiguousAllocator*[numChassis];
+        for ( uint16_t i=0; m_copyMsgs && i < numChassis; i++ )
+        {
+            m_copyMsgs[i].m_copied = m_copied;
+        }
+        for ( uint16_t i=0; m_shadowHeaps && i < numChassis; i++ )
+        {
+            m_shadowHeaps[i] = nullptr;
+        }
+    }
+}
+
+Primary::~Primary()
+{
+    disconnect();
+
+    // A stalled Chassis still references the copy messages, the semaphore, and the snapshot buffer (i.e. they can NOT be freed)
+    if ( copiesPending() )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Primary: a Chassis has not completed its copy. The snapshot memory is NOT freed") );
+        delete[] m_shadowHeaps;
+        free( m_previous );
+        return;
+    }
+    delete[] m_copyMsgs;
+    delete m_copied;
+    delete[] m_shadowHeaps;
+    free( m_current );
+    free( m_previous );
+}
+
+bool Primary::setShadowHaHeap( uint16_t chassisIndex, Cpl::Memory::ContiguousAllocator& shadowHaHeap, size_t shadowHeapSize ) noexcept
+{
+    Fxt::Node::HeapUsage_T usage;
+    if ( m_shadowHeaps == nullptr || chassisIndex >= m_numChassis || m_shadowHeaps[chassisIndex] != nullptr ||
+         !m_node.getHeapUsage( Fxt::Node::Api::eHA_STATEFUL_HEAP, usage ) ||
+         !allocateBuffers( usage.totalBytes + m_shadowCapacity + shadowHeapSize ) )
+    {
+        return false;
+    }
+
+    m_shadowHeaps[chassisIndex]  = &shadowHaHeap;
+    m_shadowCapacity            += shadowHeapSize;
+    return true;
+}
+
+bool Primary::allocateBuffers( size_t maxImageLen ) noexcept
+{
+    uint8_t* current  = (uint8_t*) malloc( maxImageLen );
+    uint8_t* previous = (uint8_t*) malloc( maxImageLen );
+    if ( current == nullptr || previous == nullptr )
+    {
+        free( current );
+        free( previous );
+        return false;
+    }
+
+    free( m_current );
+    free( m_previous );
+    m_current     = current;
+    m_previous    = previous;
+    m_maxImageLen = maxImageLen;
+    m_previousLen = 0;
+    return true;
+}
+
+void Primary::pleaseStop()
+{
+    m_stopRequested = true;
+}
+
+//////////////////////////////////////////////////
+void Primary::appRun()
+{
+    Fxt::Chassis::Api* chassis = m_node.getChassis( 0 );
+    if ( chassis == nullptr || m_copyMsgs == nullptr || m_shadowHeaps == nullptr || m_copied == nullptr || m_maxImageLen == 0 )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Primary: Node has no Chassis (or out-of-memory). Nothing to ship") );
+        return;
+    }
+    uint64_t shipInterval      = chassis->getFER() * m_shipCycles;
+    uint64_t heartbeatInterval = Fxt::System::ElapsedTime::millisecondsToMicroseconds( m_heartbeatMsec );
+    uint64_t lastShipped       = Fxt::System::ElapsedTime::now();
+    uint64_t lastSent          = lastShipped;
+
+    while ( !m_stopRequested )
+    {
+        Cpl::System::Api::sleep( OPTION_FXT_NODE_HA_POLL_MS );
+        if ( !connect() )
+        {
+            continue;
+        }
+
+        // Snapshot (and heartbeat) timing
+        uint64_t now = Fxt::System::ElapsedTime::now();
+        bool     ok  = true;
+        if ( Fxt::System::ElapsedTime::expired( lastShipped, shipInterval, now ) )
+        {
+            lastShipped     = now;
+            size_t imageLen = snapshot();
+            if ( imageLen > 0 )
+            {
+                lastSent = now;
+                ok       = sendSnapshot( imageLen );
+            }
+        }
+        else if ( Fxt::System::ElapsedTime::expired( lastSent, heartbeatInterval, now ) )
+        {
+            lastSent = now;
+            ok       = sendHeartbeat();
+        }
+
+        if ( !ok )
+        {
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("Primary: lost connection to the Standby (%s:%d)", m_host, m_port) );
+            disconnect();
+        }
+    }
+
+    // Give a late Chassis a chance to complete its copy (before the Primary is destroyed)
+    unsigned long start = Cpl::System::ElapsedTime::milliseconds();
+    while ( copiesPending() && !Cpl::System::ElapsedTime::expiredMilliseconds( start, OPTION_FXT_NODE_HA_SNAPSHOT_TIMEOUT_MS ) )
+    {
+        m_copied->timedWait( OPTION_FXT_NODE_HA_POLL_MS );
+    }
+    disconnect();
+}
+
+//////////////////////////////////////////////////
+size_t Primary::snapshot() noexcept
+{
+    // Do NOT start a new snapshot until a stalled Chassis has completed its previous copy
+    if ( copiesPending() )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Primary: a Chassis has not completed its previous copy. Snapshot skipped") );
+        m_numAbandoned++;
+        return 0;
+    }
+
+    size_t   haLen;
+    uint8_t* ha = m_node.getHaStatefulAlloactor().getMemoryStart( haLen );
+    if ( ha == nullptr || !computeIdentity( m_node, m_shadowHeaps, m_identity ) )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Primary: the layout of the HA heap is not known. Nothing to ship") );
+        return 0;
+    }
+
+    // Layout: <HA heap><shadow HA heap of Chassis 0>...<shadow HA heap of Chassis N-1>
+    uint16_t numChassis = m_numChassis;
+    size_t   imageLen   = haLen;
+    for ( uint16_t i=0; i < numChassis; i++ )
+    {
+        size_t offset = 0;
+        size_t len    = 0;
+        m_node.getChassisHaRegion( i, offset, len );
+        CopyMsg& msg     = m_copyMsgs[i];
+        msg.m_src        = ha + offset;
+        msg.m_len        = len;
+        msg.m_shadowHeap = m_shadowHeaps[i];
+        msg.m_shadowLen  = 0;
+        if ( msg.m_shadowHeap )
+        {
+            msg.m_shadowHeap->getMemoryStart( msg.m_shadowLen );
+        }
+        msg.m_shadowDst  = m_current + imageLen;
+        imageLen        += msg.m_shadowLen;
+    }
+    if ( imageLen > m_maxImageLen )
+    {
+        return 0;
+    }
+    for ( uint16_t i=0; i < numChassis; i++ )
+    {
+        m_copyMsgs[i].m_dst = m_current + (m_copyMsgs[i].m_src - ha);
+    }
+
+    // The HA data does not change when the Node is not running
+    if ( !m_node.isStarted() )
+    {
+        for ( uint16_t i=0; i < numChassis; i++ )
+        {
+            m_copyMsgs[i].copy();
+        }
+        return imageLen;
+    }
+
+    // Each Chassis copies its own HA data on its FER boundary
+    for ( uint16_t i=0; i < numChassis; i++ )
+    {
+        m_copyMsgs[i].m_pending = true;
+        m_node.getChassis( i )->getServer().getMailbox().post( m_copyMsgs[i] );
+    }
+    unsigned long start = Cpl::System::ElapsedTime::milliseconds();
+    while ( copiesPending() )
+    {
+        unsigned long elapsed = Cpl::System::ElapsedTime::deltaMilliseconds( start );
+        if ( elapsed >= OPTION_FXT_NODE_HA_SNAPSHOT_TIMEOUT_MS )
+        {
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("Primary: a Chassis did not copy its HA data within %lu ms. Snapshot abandoned", (unsigned long) OPTION_FXT_NODE_HA_SNAPSHOT_TIMEOUT_MS) );
+            m_numAbandoned++;
+            return 0;
+        }
+        unsigned long remaining = OPTION_FXT_NODE_HA_SNAPSHOT_TIMEOUT_MS - elapsed;
+        m_copied->timedWait( remaining < OPTION_FXT_NODE_HA_POLL_MS ? remaining : OPTION_FXT_NODE_HA_POLL_MS );
+    }
+    return imageLen;
+}
+
+bool Primary::copiesPending() const noexcept
+{
+    for ( uint16_t i=0; m_copyMsgs && i < m_numChassis; i++ )
+    {
+        if ( m_copyMsgs[i].m_pending )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Primary::sendSnapshot( size_t imageLen ) noexcept
+{
+    Cpl::Checksum::Crc32EthernetFast crc;
+    crc.accumulate( m_current, imageLen );
+
+    // Send a full snapshot when there is no delta base (or when the delta is not smaller)
+    Header_T header;
+    header.sequence = m_sequence + 1;
+    header.imageLen = (uint32_t) imageLen;
+    header.imageCrc = crc.finalize();
+    memcpy( header.identity, m_identity, IDENTITY_SIZE );
+    bool full       = m_previousLen != imageLen || m_sinceFull >= m_fullInterval || memcmp( m_identity, m_previousIdentity, IDENTITY_SIZE ) != 0;
+    if ( !full )
+    {
+        header.payloadLen = (uint32_t) writeDelta( imageLen, nullptr );
+        full              = header.payloadLen >= imageLen;
+    }
+    if ( full )
+    {
+        header.payloadLen = (uint32_t) imageLen;
+    }
+    header.frameType = full ? FRAME_FULL : FRAME_DELTA;
+
+    uint8_t rawHeader[HEADER_SIZE];
+    encodeHeader( rawHeader, header );
+    if ( !m_stream.write( rawHeader, sizeof( rawHeader ) ) )
+    {
+        return false;
+    }
+    if ( full )
+    {
+        if ( !m_stream.write( m_current, (int) imageLen ) )
+        {
+            return false;
+        }
+        m_sinceFull = 0;
+        m_numFull++;
+    }
+    else
+    {
+        if ( writeDelta( imageLen, &m_stream ) != header.payloadLen )
+        {
+            return false;
+        }
+        m_sinceFull++;
+        m_numDelta++;
+    }
+
+    // The sent snapshot becomes the delta base
+    uint8_t* temp = m_previous;
+    m_previous    = m_current;
+    m_current     = temp;
+    m_previousLen = imageLen;
+    m_previousCrc = header.imageCrc;
+    m_sequence    = header.sequence;
+    memcpy( m_previousIdentity, m_identity, IDENTITY_SIZE );
+    return true;
+}
+
+size_t Primary::writeDelta( size_t imageLen, Cpl::Io::Output* stream ) noexcept
+{
+    // Coalesce adjacent changed blocks into a single record
+    size_t payloadLen = 0;
+    size_t offset     = 0;
+    while ( offset < imageLen )
+    {
+        size_t blockLen = imageLen - offset < OPTION_FXT_NODE_HA_DELTA_BLOCK_SIZE ? imageLen - offset : OPTION_FXT_NODE_HA_DELTA_BLOCK_SIZE;
+        if ( memcmp( m_current + offset, m_previous + offset, blockLen ) == 0 )
+        {
+            offset += blockLen;
+            continue;
+        }
+
+        size_t start = offset;
+        while ( offset < imageLen )
+        {
+            blockLen = imageLen - offset < OPTION_FXT_NODE_HA_DELTA_BLOCK_SIZE ? imageLen - offset : OPTION_FXT_NODE_HA_DELTA_BLOCK_SIZE;
+            if ( memcmp( m_current + offset, m_previous + offset, blockLen ) == 0 )
+            {
+                break;
+            }
+            offset += blockLen;
+        }
+
+        size_t len  = offset - start;
+        payloadLen += RECORD_HEADER_SIZE + len;
+        if ( stream )
+        {
+            uint8_t rawRecord[RECORD_HEADER_SIZE];
+            encodeUint( rawRecord, (uint32_t) start, 4 );
+            encodeUint( rawRecord + 4, (uint32_t) len, 4 );
+            if ( !stream->write( rawRecord, sizeof( rawRecord ) ) || !stream->write( m_current + start, (int) len ) )
+            {
+                return 0;
+            }
+        }
+    }
+    return payloadLen;
+}
+
+bool Primary::sendHeartbeat() noexcept
+{
+    Header_T header;
+    header.frameType  = FRAME_HEARTBEAT;
+    header.sequence   = m_sequence;
+    header.imageLen   = (uint32_t) m_previousLen;
+    header.payloadLen = 0;
+    header.imageCrc   = m_previousCrc;
+    memcpy( header.identity, m_previousIdentity, IDENTITY_SIZE );
+
+    uint8_t rawHeader[HEADER_SIZE];
+    encodeHeader( rawHeader, header );
+    m_numHeartbeats++;
+    return m_stream.write( rawHeader, sizeof( rawHeader ) );
+}
+
+//////////////////////////////////////////////////
+bool Primary::connect() noexcept
+{
+    if ( m_connected )
+    {
+        return true;
+    }
+
+    // Throttle the connection attempts to the heartbeat rate
+    uint64_t now = Fxt::System::ElapsedTime::now();
+    if ( m_connectAttempted && !Fxt::System::ElapsedTime::expired( m_lastConnectAttempt, Fxt::System::ElapsedTime::millisecondsToMicroseconds( m_heartbeatMsec ), now ) )
+    {
+        return false;
+    }
+    m_lastConnectAttempt = now;
+    m_connectAttempted   = true;
+
+    Cpl::Io::Descriptor fd;
+    if ( m_connector.establish( m_host, m_port, fd ) != Cpl::Io::Socket::Connector::eSUCCESS )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Primary: unable to connect to the Standby (%s:%d)", m_host, m_port) );
+        return false;
+    }
+
+    // A new connection always starts with a full snapshot
+    m_stream.activate( fd );
+    m_previousLen = 0;
+    m_connected   = true;
+    return true;
+}
+
+void Primary::disconnect() noexcept
+{
+    if ( m_connected )
+    {
+        m_stream.close();
+        m_connected = false;
+    }
+}
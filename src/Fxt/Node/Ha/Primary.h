@@ -0,0 +1,327 @@
+#ifndef Fxt_Node_Ha_Primary_h_
+#define Fxt_Node_Ha_Primary_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "colony_config.h"
+#include "Fxt/Node/Api.h"
+#include "Cpl/System/Runnable.h"
+#include "Cpl/System/Semaphore.h"
+#include "Cpl/Itc/Message.h"
+#include "Cpl/Io/Socket/Connector.h"
+#include "Cpl/Io/Socket/InputOutput.h"
+#include "Fxt/Node/Ha/Frame.h"
+#include <atomic>
+
+
+/// Interval, in milliseconds, between heartbeat frames
+#ifndef OPTION_FXT_NODE_HA_HEARTBEAT_MS
+#define OPTION_FXT_NODE_HA_HEARTBEAT_MS             100
+#endif
+
+/// Granularity, in bytes, used when comparing snapshots to build a delta frame
+#ifndef OPTION_FXT_NODE_HA_DELTA_BLOCK_SIZE
+#define OPTION_FXT_NODE_HA_DELTA_BLOCK_SIZE         64
+#endif
+
+/// Number of snapshot frames between 'full' snapshot frames (i.e. all other snapshots are sent as deltas)
+#ifndef OPTION_FXT_NODE_HA_FULL_SNAPSHOT_INTERVAL
+#define OPTION_FXT_NODE_HA_FULL_SNAPSHOT_INTERVAL   100
+#endif
+
+/// Polling interval, in milliseconds, of the Primary/Standby threads
+#ifndef OPTION_FXT_NODE_HA_POLL_MS
+#define OPTION_FXT_NODE_HA_POLL_MS                  1
+#endif
+
+/** Maximum time, in milliseconds, that the Primary waits for ALL of the
+    Chassis to copy their HA data.  When the time-out expires, the snapshot
+    is abandoned (i.e. it is NOT sent).
+ */
+#ifndef OPTION_FXT_NODE_HA_SNAPSHOT_TIMEOUT_MS
+#define OPTION_FXT_NODE_HA_SNAPSHOT_TIMEOUT_MS      OPTION_FXT_NODE_HA_HEARTBEAT_MS
+#endif
+
+
+///
+namespace Fxt {
+///
+namespace Node {
+///
+namespace Ha {
+
+
+/** This concrete class is the 'primary' half of a warm standby HA pair.  It
+    ships the content of the Node's HA Stateful heap to a Standby Node
+    (see Fxt::Node::Ha::Standby) every N cycles of the Node's first Chassis.
+    The Primary connects to the Standby, i.e. the Standby is the socket
+    listener.
+
+    A snapshot is taken by posting a 'copy' message to each Chassis Server
+    (see Fxt::Chassis::Api::getServer()).  Each Chassis copies ITS region of
+    the HA heap (see Fxt::Node::Api::getChassisHaRegion()) - and its shadow
+    HA heap (see setShadowHaHeap()) - on its own FER boundary, i.e. the
+    Chassis are never held and do not wait for each other.  The data of an
+    individual Chassis is consistent, but the regions of different Chassis
+    are copied at different times (i.e. a value that a Chassis reads from a
+    Point of another Chassis is as-of the owning Chassis' boundary).  The
+    Primary waits up to OPTION_FXT_NODE_HA_SNAPSHOT_TIMEOUT_MS for the
+    copies to complete, i.e. a stalled Chassis causes the snapshot to be
+    abandoned - it does not stall the Primary (or the other Chassis).  No
+    new snapshot is started until the stalled Chassis has completed its copy.
+
+    Each frame contains the identity of the image (see computeIdentity() in
+    Fxt/Node/Ha/Frame.h), i.e. the Standby rejects images whose definition
+    or layout does not match the Standby Node.
+
+    Snapshots are sent as deltas (i.e. only the OPTION_FXT_NODE_HA_DELTA_BLOCK_SIZE
+    blocks that changed since the previous snapshot), except for the first
+    snapshot after a connection is established, when the image identity
+    changes, and every 'fullSnapshotInterval' snapshots.  Heartbeat frames are
+    sent when no snapshot has been sent for 'heartbeatMsec'.  See
+    Fxt/Node/Ha/Frame.h for the wire format.
+
+    The Primary executes in its own thread.  The Node MUST be created (and
+    its Chassis added) BEFORE the Primary thread is started, and the thread
+    MUST be stopped before the Node is destroyed.
+ */
+class Primary : public Cpl::System::Runnable
+{
+public:
+    /** Constructor.  The 'standbyHostName' string must stay in scope for the
+        life time of the instance.  A snapshot is sent every 'shipEveryNCycles'
+        FER periods of the Node's first Chassis.
+     */
+    Primary( Fxt::Node::Api&             node,
+             Cpl::Io::Socket::Connector& connector,
+             const char*                 standbyHostName,
+             int                         standbyPortNum,
+             uint32_t                    shipEveryNCycles,
+             uint32_t                    heartbeatMsec        = OPTION_FXT_NODE_HA_HEARTBEAT_MS,
+             uint32_t                    fullSnapshotInterval = OPTION_FXT_NODE_HA_FULL_SNAPSHOT_INTERVAL ) noexcept;
+
+    /// Destructor
+    ~Primary();
+
+public:
+    /** This method includes the shadow HA heap of a Chassis (i.e. the HA
+        data of its hot-swapped Scanners/ExecutionSets - see
+        Fxt::Chassis::HotSwap) in the snapshots.  'shadowHeapSize' is the
+        capacity of the heap.  This method MUST be called BEFORE the Primary
+        thread is started.  Returns false if the index is not valid or there
+        is insufficient memory.
+     */
+    bool setShadowHaHeap( uint16_t chassisIndex, Cpl::Memory::ContiguousAllocator& shadowHaHeap, size_t shadowHeapSize ) noexcept;
+
+public:
+    /// Returns true if there is a connection to the Standby
+    bool isConnected() const noexcept { return m_connected; }
+
+    /// Returns the sequence number of the last snapshot sent
+    uint32_t getSequenceNumber() const noexcept { return m_sequence; }
+
+    /// Returns the number of full snapshot frames sent
+    uint32_t getNumFullFrames() const noexcept { return m_numFull; }
+
+    /// Returns the number of delta snapshot frames sent
+    uint32_t getNumDeltaFrames() const noexcept { return m_numDelta; }
+
+    /// Returns the number of heartbeat frames sent
+    uint32_t getNumHeartbeats() const noexcept { return m_numHeartbeats; }
+
+    /// Returns the number of snapshots that were abandoned (i.e. a Chassis did not copy its HA data in time)
+    uint32_t getNumAbandoned() const noexcept { return m_numAbandoned; }
+
+public:
+    /// See Cpl::System::Runnable
+    void pleaseStop();
+
+protected:
+    /// See Cpl::System::Runnable
+    void appRun();
+
+protected:
+    /// Helper method: takes a snapshot of the HA heap(s).  Returns the image size (zero if the snapshot was abandoned)
+    size_t snapshot() noexcept;
+
+    /// Helper method: returns true if at least one Chassis has NOT completed its copy
+    bool copiesPending() const noexcept;
+
+    /// Helper method: (re)allocates the snapshot buffers.  Returns false if out of memory
+    bool allocateBuffers( size_t maxImageLen ) noexcept;
+
+    /// Helper method: sends the current snapshot.  Returns false on an IO error
+    bool sendSnapshot( size_t imageLen ) noexcept;
+
+    /// Helper method: sends a heartbeat frame.  Returns false on an IO error
+    bool sendHeartbeat() noexcept;
+
+    /// Helper method: visits the changed blocks.  Returns the delta payload size. The blocks are written when 'stream' is not null
+    size_t writeDelta( size_t imageLen, Cpl::Io::Output* stream ) noexcept;
+
+    /// Helper method: connects to the Standby.  Returns true if connected
+    bool connect() noexcept;
+
+    /// Helper method: closes the connection
+    void disconnect() noexcept;
+
+protected:
+    /// Message that copies a Chassis' HA data (on a FER boundary)
+    class CopyMsg : public Cpl::Itc::Message
+    {
+    public:
+        /// Constructor
+        CopyMsg() :m_copied( nullptr ), m_shadowHeap( nullptr ), m_src( nullptr ), m_dst( nullptr ), m_len( 0 ), m_shadowDst( nullptr ), m_shadowLen( 0 ), m_pending( false ) {}
+
+        /// Copies the Chassis' HA data
+        void copy() noexcept
+        {
+            memcpy( m_dst, m_src, m_len );
+            if ( m_shadowLen > 0 )
+            {
+                size_t   allocatedLen;
+                uint8_t* shadow = m_shadowHeap->getMemoryStart( allocatedLen );
+                memcpy( m_shadowDst, shadow, m_shadowLen );
+            }
+        }
+
+        /// See Cpl::Itc::Message.  Executes in the Chassis thread
+        void process() noexcept
+        {
+            // Note: Clearing the pending flag MUST be the last access to the Primary's memory
+            copy();
+            m_copied->signal();
+            m_pending = false;
+        }
+
+        /// Signaled when the copy has completed
+        Cpl::System::Semaphore*             m_copied;
+
+        /// The Chassis' shadow HA heap (nullptr if none)
+        Cpl::Memory::ContiguousAllocator*   m_shadowHeap;
+
+        /// Start of the Chassis' HA region
+        const uint8_t*                      m_src;
+
+        /// Destination of the Chassis' HA region
+        uint8_t*                            m_dst;
+
+        /// Size of the Chassis' HA region
+        size_t                              m_len;
+
+        /// Destination of the Chassis' shadow HA data
+        uint8_t*                            m_shadowDst;
+
+        /// Size of the Chassis' shadow HA data
+        size_t                              m_shadowLen;
+
+        /// True while the message is waiting to be processed by the Chassis
+        std::atomic<bool>                   m_pending;
+    };
+
+protected:
+    /// The Node
+    Fxt::Node::Api&                 m_node;
+
+    /// Socket connector
+    Cpl::Io::Socket::Connector&     m_connector;
+
+    /// Socket stream
+    Cpl::Io::Socket::InputOutput    m_stream;
+
+    /// Remote host
+    const char*                     m_host;
+
+    /// Copy messages (one per Chassis)
+    CopyMsg*                        m_copyMsgs;
+
+    /// Shadow HA heaps (one per Chassis, nullptr entries when not used)
+    Cpl::Memory::ContiguousAllocator** m_shadowHeaps;
+
+    /// Current snapshot
+    uint8_t*                        m_current;
+
+    /// Previously sent snapshot (i.e. the delta base)
+    uint8_t*                        m_previous;
+
+    /// Size of the snapshot buffers
+    size_t                          m_maxImageLen;
+
+    /// Size of the previously sent snapshot (zero when there is no delta base)
+    size_t                          m_previousLen;
+
+    /// CRC of the previously sent snapshot
+    uint32_t                        m_previousCrc;
+
+    /// Identity of the current snapshot
+    uint8_t                         m_identity[IDENTITY_SIZE];
+
+    /// Identity of the previously sent snapshot
+    uint8_t                         m_previousIdentity[IDENTITY_SIZE];
+
+    /// Time of the last connection attempt
+    uint64_t                        m_lastConnectAttempt;
+
+    /// Semaphore: Signaled when a Chassis has completed its copy
+    Cpl::System::Semaphore*         m_copied;
+
+    /// Capacity of the shadow HA heaps
+    size_t                          m_shadowCapacity;
+
+    /// Remote port
+    int                             m_port;
+
+    /// Number of Chassis (cached: the Node can be destroyed before the Primary)
+    uint16_t                        m_numChassis;
+
+    /// Snapshot interval (in FER periods of the first Chassis)
+    uint32_t                        m_shipCycles;
+
+    /// Heartbeat interval
+    uint32_t                        m_heartbeatMsec;
+
+    /// Number of snapshots between full snapshots
+    uint32_t                        m_fullInterval;
+
+    /// Snapshots sent since the last full snapshot
+    uint32_t                        m_sinceFull;
+
+    /// Sequence number of the last snapshot sent
+    uint32_t                        m_sequence;
+
+    /// Statistics
+    uint32_t                        m_numFull;
+
+    /// Statistics
+    uint32_t                        m_numDelta;
+
+    /// Statistics
+    uint32_t                        m_numHeartbeats;
+
+    /// Statistics
+    uint32_t                        m_numAbandoned;
+
+    /// Connection state
+    volatile bool                   m_connected;
+
+    /// True once a connection has been attempted
+    bool                            m_connectAttempted;
+
+    /// Stop request
+    volatile bool                   m_stopRequested;
+};
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,335 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Standby.h"
+#include "Cpl/Checksum/Crc32EthernetFast.h"
+#include "Cpl/System/ElapsedTime.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/Trace.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SECT_   "Fxt::Node::Ha"
+
+///
+using namespace Fxt::Node::Ha;
+
+
+//////////////////////////////////////////////////
+Standby::Standby( size_t                                     maxImageLen,
+                  uint32_t                                   failoverTimeoutMsec,
+                  Fxt::Node::Api*                            standbyNode,
+                  Cpl::Memory::ContiguousAllocator* const*   shadowHaHeaps ) noexcept
+    : m_working( (uint8_t*) malloc( maxImageLen ) )
+    , m_committed( (uint8_t*) malloc( maxImageLen ) )
+    , m_maxImageLen( 0 )
+    , m_committedLen( 0 )
+    , m_committedSeq( 0 )
+    , m_node( standbyNode )
+    , m_shadowHeaps( shadowHaHeaps )
+    , m_lastRxTime( 0 )
+    , m_failoverMsec( failoverTimeoutMsec )
+    , m_numDiscarded( 0 )
+    , m_numRejected( 0 )
+    , m_pending( false )
+    , m_connected( false )
+    , m_primarySeen( false )
+    , m_hasSnapshot( false )
+    , m_stopRequested( false )
+{
+    memset( m_committedIdentity, 0, sizeof( m_committedIdentity ) );
+    if ( m_working && m_committed )
+    {
+        m_maxImageLen = maxImageLen;
+    }
+}
+
+Standby::~Standby()
+{
+    disconnect();
+    if ( m_pending )
+    {
+        Cpl::Io::Socket::InputOutput discard( m_pendingFd );
+        discard.close();
+    }
+    free( m_working );
+    free( m_committed );
+}
+
+void Standby::pleaseStop()
+{
+    m_stopRequested = true;
+}
+
+//////////////////////////////////////////////////
+bool Standby::isFailoverRequired() const noexcept
+{
+    return m_primarySeen && Cpl::System::ElapsedTime::expiredMilliseconds( m_lastRxTime, m_failoverMsec );
+}
+
+bool Standby::hasSnapshot( uint32_t& sequenceNumber ) const noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    sequenceNumber = m_committedSeq;
+    return m_hasSnapshot;
+}
+
+bool Standby::restore( Fxt::Node::Api& node, Cpl::Memory::ContiguousAllocator* const* shadowHaHeaps ) noexcept
+{
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    size_t   allocatedLen;
+    uint8_t* haHeap = node.getHaStatefulAlloactor().getMemoryStart( allocatedLen );
+    uint8_t  identity[IDENTITY_SIZE];
+    bool     sameIdentity = computeIdentity( node, shadowHaHeaps, identity ) && memcmp( identity, m_committedIdentity, IDENTITY_SIZE ) == 0;
+
+    // Layout: <HA heap><shadow HA heap of Chassis 0>...<shadow HA heap of Chassis N-1>
+    size_t   imageLen   = allocatedLen;
+    uint16_t numChassis = node.getNumChassis();
+    for ( uint16_t i=0; shadowHaHeaps && i < numChassis; i++ )
+    {
+        size_t shadowLen = 0;
+        if ( shadowHaHeaps[i] )
+        {
+            shadowHaHeaps[i]->getMemoryStart( shadowLen );
+        }
+        imageLen += shadowLen;
+    }
+    if ( !m_hasSnapshot || node.isStarted() || haHeap == nullptr || !sameIdentity || imageLen != m_committedLen )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Standby: unable to restore snapshot (snapshot=%d, seq=%lu, len=%lu, haLen=%lu, sameIdentity=%d)",
+                                       m_hasSnapshot, (unsigned long) m_committedSeq, (unsigned long) m_committedLen, (unsigned long) imageLen, sameIdentity) );
+        return false;
+    }
+
+    memcpy( haHeap, m_committed, allocatedLen );
+    size_t offset = allocatedLen;
+    for ( uint16_t i=0; shadowHaHeaps && i < numChassis; i++ )
+    {
+        size_t shadowLen = 0;
+        if ( shadowHaHeaps[i] )
+        {
+            uint8_t* shadow = shadowHaHeaps[i]->getMemoryStart( shadowLen );
+            memcpy( shadow, m_committed + offset, shadowLen );
+        }
+        offset += shadowLen;
+    }
+    CPL_SYSTEM_TRACE_MSG( SECT_, ("Standby: restored snapshot seq=%lu (%lu bytes)", (unsigned long) m_committedSeq, (unsigned long) m_committedLen) );
+    return true;
+}
+
+//////////////////////////////////////////////////
+bool Standby::newConnection( Cpl::Io::Descriptor newFd, const char* rawConnectionInfo )
+{
+    CPL_SYSTEM_TRACE_MSG( SECT_, ("Standby: accepted connection from: %s", rawConnectionInfo) );
+
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    if ( m_pending )
+    {
+        // Discard the previous connection that was never handed off
+        Cpl::Io::Socket::InputOutput discard( m_pendingFd );
+        discard.close();
+    }
+    m_pendingFd = newFd;
+    m_pending   = true;
+    return true;
+}
+
+void Standby::appRun()
+{
+    while ( !m_stopRequested )
+    {
+        // The newest connection wins
+        Cpl::Io::Descriptor fd;
+        bool                newConnection = false;
+        {
+            Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+            if ( m_pending )
+            {
+                fd            = m_pendingFd;
+                m_pending     = false;
+                newConnection = true;
+            }
+        }
+        if ( newConnection )
+        {
+            disconnect();
+            m_stream.activate( fd );
+            m_connected  = true;
+            m_lastRxTime = Cpl::System::ElapsedTime::milliseconds();
+        }
+
+        // Wait for the next frame
+        if ( !m_connected || !m_stream.available() )
+        {
+            if ( m_connected && Cpl::System::ElapsedTime::expiredMilliseconds( m_lastRxTime, m_failoverMsec ) )
+            {
+                CPL_SYSTEM_TRACE_MSG( SECT_, ("Standby: no frames from the Primary for %lu ms", (unsigned long) m_failoverMsec) );
+                disconnect();
+            }
+            Cpl::System::Api::sleep( OPTION_FXT_NODE_HA_POLL_MS );
+            continue;
+        }
+
+        if ( !processFrame() )
+        {
+            disconnect();
+        }
+    }
+
+    disconnect();
+}
+
+//////////////////////////////////////////////////
+bool Standby::processFrame() noexcept
+{
+    uint8_t  rawHeader[HEADER_SIZE];
+    Header_T header;
+    if ( !readAll( rawHeader, sizeof( rawHeader ) ) )
+    {
+        return false;
+    }
+    if ( !decodeHeader( rawHeader, header ) || header.imageLen > m_maxImageLen )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Standby: invalid frame header") );
+        return false;
+    }
+
+    // Heartbeat
+    m_lastRxTime  = Cpl::System::ElapsedTime::milliseconds();
+    m_primarySeen = true;
+    if ( header.frameType == FRAME_HEARTBEAT )
+    {
+        return skip( header.payloadLen );
+    }
+
+    // Reject images that do not match the Standby Node (the connection is kept, i.e. fail-over detection continues)
+    if ( m_node )
+    {
+        uint8_t expected[IDENTITY_SIZE];
+        if ( !computeIdentity( *m_node, m_shadowHeaps, expected ) || memcmp( expected, header.identity, IDENTITY_SIZE ) != 0 )
+        {
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("Standby: rejected seq=%lu (the image identity does not match the Standby Node)", (unsigned long) header.sequence) );
+            m_numRejected++;
+            return skip( header.payloadLen );
+        }
+    }
+
+    // Full snapshot
+    if ( header.frameType == FRAME_FULL )
+    {
+        if ( header.payloadLen != header.imageLen || !readAll( m_working, header.imageLen ) )
+        {
+            revert();
+            return false;
+        }
+        return commit( header );
+    }
+
+    // Delta snapshot: MUST be relative to the committed snapshot
+    if ( !m_hasSnapshot || header.sequence != m_committedSeq + 1 || header.imageLen != m_committedLen || memcmp( header.identity, m_committedIdentity, IDENTITY_SIZE ) != 0 )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Standby: discarded delta seq=%lu (committed seq=%lu)", (unsigned long) header.sequence, (unsigned long) m_committedSeq) );
+        m_numDiscarded++;
+        return false;
+    }
+    uint32_t remaining = header.payloadLen;
+    while ( remaining > 0 )
+    {
+        uint8_t rawRecord[RECORD_HEADER_SIZE];
+        if ( remaining < RECORD_HEADER_SIZE || !readAll( rawRecord, sizeof( rawRecord ) ) )
+        {
+            revert();
+            return false;
+        }
+        uint32_t offset = decodeUint( rawRecord, 4 );
+        uint32_t len    = decodeUint( rawRecord + 4, 4 );
+        remaining      -= RECORD_HEADER_SIZE;
+        if ( len > remaining || offset > header.imageLen || len > header.imageLen - offset || !readAll( m_working + offset, len ) )
+        {
+            revert();
+            return false;
+        }
+        remaining -= len;
+    }
+    return commit( header );
+}
+
+bool Standby::commit( const Header_T& header ) noexcept
+{
+    Cpl::Checksum::Crc32EthernetFast crc;
+    crc.accumulate( m_working, header.imageLen );
+    if ( crc.finalize() != header.imageCrc )
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Standby: CRC error. Discarded seq=%lu", (unsigned long) header.sequence) );
+        m_numDiscarded++;
+        revert();
+        return false;
+    }
+
+    Cpl::System::Mutex::ScopeBlock criticalSection( m_lock );
+    memcpy( m_committed, m_working, header.imageLen );
+    m_committedLen = header.imageLen;
+    m_committedSeq = header.sequence;
+    m_hasSnapshot  = true;
+    memcpy( m_committedIdentity, header.identity, IDENTITY_SIZE );
+    return true;
+}
+
+void Standby::revert() noexcept
+{
+    if ( m_hasSnapshot )
+    {
+        memcpy( m_working, m_committed, m_committedLen );
+    }
+}
+
+//////////////////////////////////////////////////
+bool Standby::readAll( void* dst, size_t numBytes ) noexcept
+{
+    uint8_t* ptr = (uint8_t*) dst;
+    while ( numBytes > 0 )
+    {
+        int bytesRead = 0;
+        if ( !m_stream.read( ptr, (int) numBytes, bytesRead ) || bytesRead <= 0 )
+        {
+            return false;
+        }
+        ptr      += bytesRead;
+        numBytes -= bytesRead;
+    }
+    return true;
+}
+
+bool Standby::skip( size_t numBytes ) noexcept
+{
+    uint8_t buffer[64];
+    while ( numBytes > 0 )
+    {
+        size_t chunk = numBytes < sizeof( buffer ) ? numBytes : sizeof( buffer );
+        if ( !readAll( buffer, chunk ) )
+        {
+            return false;
+        }
+        numBytes -= chunk;
+    }
+    return true;
+}
+
+void Standby::disconnect() noexcept
+{
+    if ( m_connected )
+    {
+        m_stream.close();
+        m_connected = false;
+    }
+}
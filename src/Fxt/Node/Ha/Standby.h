@@ -0,0 +1,209 @@
+#ifndef Fxt_Node_Ha_Standby_h_
+#define Fxt_Node_Ha_Standby_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "colony_config.h"
+#include "Fxt/Node/Ha/Primary.h"
+#include "Fxt/Node/Ha/Frame.h"
+#include "Cpl/Io/Socket/Listener.h"
+#include "Cpl/System/Mutex.h"
+
+
+/// Time, in milliseconds, without receiving a frame from the Primary before the Primary is declared 'failed'
+#ifndef OPTION_FXT_NODE_HA_FAILOVER_TIMEOUT_MS
+#define OPTION_FXT_NODE_HA_FAILOVER_TIMEOUT_MS      (5*OPTION_FXT_NODE_HA_HEARTBEAT_MS)
+#endif
+
+
+///
+namespace Fxt {
+///
+namespace Node {
+///
+namespace Ha {
+
+
+/** This concrete class is the 'standby' half of a warm standby HA pair.  It
+    receives the HA Stateful heap snapshots from a Primary Node (see
+    Fxt::Node::Ha::Primary) and retains the last consistent snapshot, i.e. a
+    snapshot is only 'committed' after the complete image has passed its CRC
+    check.  A delta frame that can not be applied (e.g. a missing sequence
+    number or a CRC failure) is discarded and the connection is closed, i.e.
+    the Primary re-connects and starts over with a full snapshot.
+
+    The Primary is declared 'failed' when no frame (snapshot or heartbeat) has
+    been received for 'failoverTimeoutMsec'.  The Application is responsible
+    for the actual fail-over, i.e. stopping the Standby thread, calling
+    restore() to copy the last consistent snapshot into the Standby Node's
+    HA heap, and then starting the Standby Node.
+
+    The Standby and Primary Nodes MUST be created from the same Node
+    definition with the same Node type and heap sizes, i.e. the layout of
+    their HA heaps MUST be identical.  Note: Concurrent Chassis construction
+    (see Fxt::Node::FactoryCommon_::enableParallelChassisCreate()) allocates
+    the HA heap in Chassis order, i.e. it produces the same HA layout as
+    sequential construction.  Each frame contains the identity of the image
+    (see computeIdentity() in Fxt/Node/Ha/Frame.h).  When the Standby is
+    constructed with its Node, frames whose identity does not match the
+    Standby Node are rejected, and restore() always verifies the identity of
+    the snapshot.  Note: A Chassis that has been hot-swapped on the Primary
+    (see Fxt::Chassis::HotSwap) changes the identity, i.e. the same
+    Scanner/ExecutionSet must be hot-swapped on the Standby Node before its
+    snapshots are accepted.
+
+    The Application is responsible for starting a Cpl::Io::Socket::Listener
+    (with this instance as the Listener's client).  A newly accepted
+    connection replaces the current connection.  The Standby executes in its
+    own thread, i.e. the Listener's callback only hands off the connection.
+ */
+class Standby : public Cpl::System::Runnable, public Cpl::Io::Socket::Listener::Client
+{
+public:
+    /** Constructor. 'maxImageLen' is the maximum size, in bytes, of the
+        Primary's HA image (e.g. the size of the Node's HA heap plus the
+        size of the shadow HA heaps).  When 'standbyNode' is not nullptr,
+        frames whose image identity does not match 'standbyNode' (and its
+        'shadowHaHeaps' - see computeIdentity()) are rejected.
+     */
+    Standby( size_t                                     maxImageLen,
+             uint32_t                                   failoverTimeoutMsec = OPTION_FXT_NODE_HA_FAILOVER_TIMEOUT_MS,
+             Fxt::Node::Api*                            standbyNode         = nullptr,
+             Cpl::Memory::ContiguousAllocator* const*   shadowHaHeaps       = nullptr ) noexcept;
+
+    /// Destructor
+    ~Standby();
+
+public:
+    /** This method returns true if the Primary has been 'seen' (i.e. at least
+        one frame was received) and no frame has been received for the
+        fail-over timeout period.  The method can be called from any thread.
+     */
+    bool isFailoverRequired() const noexcept;
+
+    /** This method returns true if there is a consistent snapshot.  The
+        sequence number of the snapshot is returned via 'sequenceNumber'.
+        The method can be called from any thread.
+     */
+    bool hasSnapshot( uint32_t& sequenceNumber ) const noexcept;
+
+    /** This method copies the last consistent snapshot into the HA heap of
+        'node' (and into the 'shadowHaHeaps' of its Chassis - see
+        computeIdentity()).  The Node MUST be in the stopped state.  Returns
+        false if there is no snapshot, the Node is running, or the identity
+        of the snapshot does not match 'node'.
+     */
+    bool restore( Fxt::Node::Api& node, Cpl::Memory::ContiguousAllocator* const* shadowHaHeaps = nullptr ) noexcept;
+
+    /// Returns the number of snapshot frames that were discarded
+    uint32_t getNumDiscarded() const noexcept { return m_numDiscarded; }
+
+    /// Returns the number of frames that were rejected because their image identity did not match the Standby Node
+    uint32_t getNumRejected() const noexcept { return m_numRejected; }
+
+public:
+    /// See Cpl::Io::Socket::Listener::Client
+    bool newConnection( Cpl::Io::Descriptor newFd, const char* rawConnectionInfo );
+
+    /// See Cpl::System::Runnable
+    void pleaseStop();
+
+protected:
+    /// See Cpl::System::Runnable
+    void appRun();
+
+protected:
+    /// Helper method: reads and processes a single frame.  Returns false on an IO or framing error
+    bool processFrame() noexcept;
+
+    /// Helper method: reads exactly 'numBytes'.  Returns false on an IO error
+    bool readAll( void* dst, size_t numBytes ) noexcept;
+
+    /// Helper method: discards 'numBytes' of input.  Returns false on an IO error
+    bool skip( size_t numBytes ) noexcept;
+
+    /// Helper method: verifies and commits the working image.  Returns false if the image is not valid
+    bool commit( const Header_T& header ) noexcept;
+
+    /// Helper method: restores the working image to the committed snapshot
+    void revert() noexcept;
+
+    /// Helper method: closes the current connection
+    void disconnect() noexcept;
+
+protected:
+    /// Mutex (protects the pending connection and the committed snapshot)
+    mutable Cpl::System::Mutex      m_lock;
+
+    /// Socket stream
+    Cpl::Io::Socket::InputOutput    m_stream;
+
+    /// Accepted connection that has not yet been handed off to the Standby thread
+    Cpl::Io::Descriptor             m_pendingFd;
+
+    /// Working image (i.e. the image being received)
+    uint8_t*                        m_working;
+
+    /// Last consistent snapshot
+    uint8_t*                        m_committed;
+
+    /// Size of the image buffers
+    size_t                          m_maxImageLen;
+
+    /// Size of the committed snapshot
+    size_t                          m_committedLen;
+
+    /// Sequence number of the committed snapshot
+    uint32_t                        m_committedSeq;
+
+    /// Identity of the committed snapshot
+    uint8_t                         m_committedIdentity[IDENTITY_SIZE];
+
+    /// The Standby Node (nullptr if the image identity is not checked on receive)
+    Fxt::Node::Api*                 m_node;
+
+    /// The Standby Node's shadow HA heaps (can be nullptr)
+    Cpl::Memory::ContiguousAllocator* const* m_shadowHeaps;
+
+    /// Time (in milliseconds) of the last received frame
+    volatile unsigned long          m_lastRxTime;
+
+    /// Fail-over timeout
+    uint32_t                        m_failoverMsec;
+
+    /// Statistics
+    uint32_t                        m_numDiscarded;
+
+    /// Statistics
+    uint32_t                        m_numRejected;
+
+    /// True when there is pending connection
+    bool                            m_pending;
+
+    /// Connection state
+    bool                            m_connected;
+
+    /// True once at least one frame has been received from the Primary
+    volatile bool                   m_primarySeen;
+
+    /// True when there is a committed snapshot
+    bool                            m_hasSnapshot;
+
+    /// Stop request
+    volatile bool                   m_stopRequested;
+};
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -0,0 +1,543 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Catch/catch.hpp"
+#include "Cpl/System/_testsupport/Shutdown_TS.h"
+#include "Fxt/Node/Ha/Primary.h"
+#include "Fxt/Node/Ha/Standby.h"
+#include "Fxt/Node/Ha/Frame.h"
+#include "Fxt/Node/Mock/Kestrel/Factory.h"
+#include "Fxt/Card/Mock/AnalogIn8.h"
+#include "Fxt/Point/Bool.h"
+#include "Cpl/Io/Socket/Posix/Listener.h"
+#include "Cpl/Io/Socket/Posix/Connector.h"
+#include "Cpl/System/Thread.h"
+#include "Cpl/System/Trace.h"
+#include "Cpl/System/Api.h"
+#include "Cpl/System/Semaphore.h"
+#include "Cpl/Itc/Message.h"
+#include "Cpl/Memory/LeanHeap.h"
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define SECT_                   "_0test"
+
+#define PORT_NUM_               5047
+
+#define FXT_PT_SHARED_1         0
+#define FXT_PT_ANDGATE_1        20
+#define MAX_POINTS              23
+
+#define HEAP_SIZE_GENERAL       10000
+#define HEAP_SIZE_CARD          (2 * Fxt::Card::Mock::AnalogIn8::CARD_STATEFUL_HEAP_SIZE)
+#define HEAP_SIZE_HA            10000
+
+#define WAIT_LOOP_MS            10
+#define MAX_WAIT_LOOPS          1000
+
+///
+using namespace Fxt::Node::Ha;
+
+// Two Chassis (i.e. the snapshots hold two Chassis threads)
+static const char* NODE_DEFINITION = R"literalString(
+{
+  "name": "My HA Kestrel Node",
+  "id": 3,
+  "type": "d65ee614-dce4-43f0-af2c-830e3664ecaf",
+  "chassis": [
+    {
+      "name": "My Chassis",
+      "id": 1,
+      "scanners": [
+        {
+          "name": "My Scanner",
+          "id": 1,
+          "cards": [
+            {
+              "name": "bob",
+              "type": "1968f533-e323-4ae4-8493-9a572f3bd195",
+              "slot": 22,
+              "points": {
+                "inputs": [
+                  {
+                    "channel": 2,
+                    "id": 4,
+                    "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+                    "initial": { "valid": true, "val": 1.2, "id": 6 },
+                    "ioRegId": 5
+                  }
+                ]
+              }
+            }
+          ],
+          "scanRateMultiplier": 1
+        }
+      ],
+      "executionSets": [
+        {
+          "name": "My Execution Set",
+          "id": 1,
+          "logicChains": [
+            {
+              "name": "my logic chain",
+              "id": 1,
+              "components": [
+                {
+                  "id": 101,
+                  "name": "AND Gate#1",
+                  "type": "e62e395c-d27a-4821-bba9-aa1e6de42a05",
+                  "inputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 0 },
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 21 }
+                  ],
+                  "outputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 20 }
+                  ]
+                }
+              ],
+              "connectionPts": [
+                { "id": 20, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0" }
+              ],
+              "autoPts": [
+                { "id": 21, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 22 } }
+              ]
+            }
+          ],
+          "exeRateMultiplier": 1
+        }
+      ],
+      "sharedPts": [
+        { "id": 0, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 1 } }
+      ],
+      "fer": 1000
+    },
+    {
+      "name": "My Second Chassis",
+      "id": 1,
+      "scanners": [
+        {
+          "name": "My Scanner",
+          "id": 1,
+          "cards": [
+            {
+              "name": "bob",
+              "type": "1968f533-e323-4ae4-8493-9a572f3bd195",
+              "slot": 22,
+              "points": {
+                "inputs": [
+                  {
+                    "channel": 2,
+                    "id": 7,
+                    "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+                    "initial": { "valid": true, "val": 2.5, "id": 9 },
+                    "ioRegId": 8
+                  }
+                ]
+              }
+            }
+          ],
+          "scanRateMultiplier": 1
+        }
+      ],
+      "executionSets": [
+        {
+          "name": "My Execution Set",
+          "id": 1,
+          "logicChains": [
+            {
+              "name": "my logic chain",
+              "id": 1,
+              "components": [
+                {
+                  "id": 102,
+                  "name": "AND Gate#1",
+                  "type": "e62e395c-d27a-4821-bba9-aa1e6de42a05",
+                  "inputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 2 },
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 11 }
+                  ],
+                  "outputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 10 }
+                  ]
+                }
+              ],
+              "connectionPts": [
+                { "id": 10, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0" }
+              ],
+              "autoPts": [
+                { "id": 11, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 12 } }
+              ]
+            }
+          ],
+          "exeRateMultiplier": 1
+        }
+      ],
+      "sharedPts": [
+        { "id": 2, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 3 } }
+      ],
+      "fer": 1000
+    }
+  ]
+}
+)literalString";
+
+/// Holds a Chassis thread (i.e. simulates a stalled Chassis) until released
+class StallMsg : public Cpl::Itc::Message
+{
+public:
+    /// See Cpl::Itc::Message
+    void process() noexcept { m_stalled.signal(); m_release.wait(); }
+
+    /// Signaled when the Chassis is stalled
+    Cpl::System::Semaphore m_stalled;
+
+    /// Releases the Chassis
+    Cpl::System::Semaphore m_release;
+};
+
+/// Creates a Node from NODE_DEFINITION with an optional new Node name
+static Fxt::Node::Api* createNode( Fxt::Node::FactoryApi& factory, Fxt::Point::DatabaseApi& pointDb, JsonDocument& doc, const char* newName = nullptr )
+{
+    Fxt::Type::Error nodeError;
+    if ( deserializeJson( doc, NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) != DeserializationError::Ok )
+    {
+        return nullptr;
+    }
+    if ( newName )
+    {
+        doc["name"] = newName;
+    }
+    JsonVariant nodeJsonObj = doc.as<JsonVariant>();
+    return factory.createFromJSON( nodeJsonObj, pointDb, nodeError );
+}
+
+/// Waits (but not forever) for a Runnable to terminate
+static void waitForStop( Cpl::System::Runnable& runnable )
+{
+    for ( int i=0; i < MAX_WAIT_LOOPS && runnable.isRunning(); i++ )
+    {
+        Cpl::System::Api::sleep( WAIT_LOOP_MS );
+    }
+}
+
+/// Primary process: runs the Node and ships its HA state until 'crashing'.  Note: The process exits (without any cleanup) when done
+static void runPrimary()
+{
+    Fxt::Point::Database<MAX_POINTS>    pointDb;
+    Fxt::Type::Error                    nodeError;
+    Fxt::Node::Mock::Kestrel::Factory   factory( HEAP_SIZE_GENERAL, HEAP_SIZE_CARD, HEAP_SIZE_HA, nullptr, 2 );
+    StaticJsonDocument<10240>           doc;
+    if ( deserializeJson( doc, NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) != DeserializationError::Ok )
+    {
+        _exit( 1 );
+    }
+    JsonVariant     nodeJsonObj = doc.as<JsonVariant>();
+    Fxt::Node::Api* node        = factory.createFromJSON( nodeJsonObj, pointDb, nodeError );
+    if ( node == nullptr || !node->start( Fxt::System::ElapsedTime::now() ) )
+    {
+        _exit( 2 );
+    }
+
+    // Change the HA state (the lock prevents the Chassis from overwriting the value)
+    Fxt::Point::Bool* shared1 = (Fxt::Point::Bool*) pointDb.lookupById( FXT_PT_SHARED_1 );
+    shared1->clear( Fxt::Point::Api::eLOCK );
+
+    // Ship the HA state every 10 cycles
+    Cpl::Io::Socket::Posix::Connector connector;
+    Primary                           primary( *node, connector, "localhost", PORT_NUM_, 10 );
+    Cpl::System::Thread*              thread = Cpl::System::Thread::create( primary, "HaPrimary" );
+    for ( int i=0; i < MAX_WAIT_LOOPS && (primary.getNumFullFrames() == 0 || primary.getNumDeltaFrames() < 10); i++ )
+    {
+        Cpl::System::Api::sleep( WAIT_LOOP_MS );
+    }
+    CPL_SYSTEM_TRACE_MSG( SECT_, ("Primary: seq=%lu, full=%lu, delta=%lu, heartbeats=%lu",
+                                   (unsigned long) primary.getSequenceNumber(),
+                                   (unsigned long) primary.getNumFullFrames(),
+                                   (unsigned long) primary.getNumDeltaFrames(),
+                                   (unsigned long) primary.getNumHeartbeats()) );
+    if ( thread == nullptr || primary.getNumFullFrames() == 0 || primary.getNumDeltaFrames() < 10 )
+    {
+        _exit( 3 );
+    }
+
+    // 'Crash' the Primary, i.e. exit without stopping anything
+    _exit( 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_CASE( "Ha" )
+{
+    Cpl::System::Shutdown_TS::clearAndUseCounter();
+
+    SECTION( "frame" )
+    {
+        Header_T src ={ 7, 1000, 24, 0x12345678, FRAME_DELTA };
+        Header_T dst;
+        uint8_t  raw[HEADER_SIZE];
+        encodeHeader( raw, src );
+        REQUIRE( decodeHeader( raw, dst ) );
+        REQUIRE( dst.frameType == FRAME_DELTA );
+        REQUIRE( dst.sequence == 7 );
+        REQUIRE( dst.imageLen == 1000 );
+        REQUIRE( dst.payloadLen == 24 );
+        REQUIRE( dst.imageCrc == 0x12345678 );
+
+        REQUIRE( memcmp( dst.identity, src.identity, IDENTITY_SIZE ) == 0 );
+        src.identity[0]                 = 0xA5;
+        src.identity[IDENTITY_SIZE - 1] = 0x5A;
+        encodeHeader( raw, src );
+        REQUIRE( decodeHeader( raw, dst ) );
+        REQUIRE( memcmp( dst.identity, src.identity, IDENTITY_SIZE ) == 0 );
+
+        raw[6] = 'X';
+        REQUIRE( decodeHeader( raw, dst ) == false );
+        encodeHeader( raw, src );
+        raw[0]++;
+        REQUIRE( decodeHeader( raw, dst ) == false );
+    }
+
+    SECTION( "standby without a primary" )
+    {
+        Standby  uut( HEAP_SIZE_HA, 50 );
+        uint32_t seqNum;
+        REQUIRE( uut.hasSnapshot( seqNum ) == false );
+        Cpl::System::Api::sleep( 100 );
+        REQUIRE( uut.isFailoverRequired() == false );
+    }
+
+    SECTION( "identity" )
+    {
+        Fxt::Point::Database<MAX_POINTS>    pointDb1;
+        Fxt::Point::Database<MAX_POINTS>    pointDb2;
+        Fxt::Node::Mock::Kestrel::Factory   factory( HEAP_SIZE_GENERAL, HEAP_SIZE_CARD, HEAP_SIZE_HA, nullptr, 2 );
+        StaticJsonDocument<10240>           doc1;
+        StaticJsonDocument<10240>           doc2;
+        Fxt::Node::Api*                     node1 = createNode( factory, pointDb1, doc1 );
+        Fxt::Node::Api*                     node2 = createNode( factory, pointDb2, doc2, "Different name" );
+        REQUIRE( node1 );
+        REQUIRE( node2 );
+
+        // The Chassis' HA regions are contiguous, and cover all of the allocated HA data
+        size_t offset0, len0, offset1, len1, haLen;
+        node1->getHaStatefulAlloactor().getMemoryStart( haLen );
+        REQUIRE( node1->getChassisHaRegion( 0, offset0, len0 ) );
+        REQUIRE( node1->getChassisHaRegion( 1, offset1, len1 ) );
+        REQUIRE( node1->getChassisHaRegion( 2, offset1, len1 ) == false );
+        REQUIRE( node1->getChassisHaRegion( 1, offset1, len1 ) );
+        REQUIRE( offset0 == 0 );
+        REQUIRE( len0 > 0 );
+        REQUIRE( offset1 == len0 );
+        REQUIRE( offset1 + len1 == haLen );
+
+        // Same layout, different definitions
+        uint8_t identity1[IDENTITY_SIZE];
+        uint8_t identity2[IDENTITY_SIZE];
+        REQUIRE( computeIdentity( *node1, nullptr, identity1 ) );
+        REQUIRE( computeIdentity( *node2, nullptr, identity2 ) );
+        REQUIRE( memcmp( identity1, identity2, IDENTITY_SIZE - 4 ) != 0 );
+        REQUIRE( memcmp( identity1 + IDENTITY_SIZE - 4, identity2 + IDENTITY_SIZE - 4, 4 ) == 0 );
+
+        // A shadow HA heap changes the layout
+        size_t                           shadowMem[16];
+        Cpl::Memory::LeanHeap            shadowHeap( shadowMem, sizeof( shadowMem ) );
+        Cpl::Memory::ContiguousAllocator* shadowHeaps[2] ={ nullptr, &shadowHeap };
+        REQUIRE( computeIdentity( *node1, shadowHeaps, identity2 ) );
+        REQUIRE( memcmp( identity1, identity2, IDENTITY_SIZE ) == 0 );
+        shadowHeap.allocate( 8 );
+        REQUIRE( computeIdentity( *node1, shadowHeaps, identity2 ) );
+        REQUIRE( memcmp( identity1, identity2, IDENTITY_SIZE ) != 0 );
+
+        factory.destroy( *node1 );
+        factory.destroy( *node2 );
+    }
+
+    SECTION( "stalled chassis and mismatched standby" )
+    {
+        Fxt::Point::Database<MAX_POINTS>    pointDb1;
+        Fxt::Point::Database<MAX_POINTS>    pointDb2;
+        Fxt::Point::Database<MAX_POINTS>    pointDb3;
+        Fxt::Node::Mock::Kestrel::Factory   factory( HEAP_SIZE_GENERAL, HEAP_SIZE_CARD, HEAP_SIZE_HA, nullptr, 2 );
+        StaticJsonDocument<10240>           doc1;
+        StaticJsonDocument<10240>           doc2;
+        StaticJsonDocument<10240>           doc3;
+        Fxt::Node::Api*                     node  = createNode( factory, pointDb1, doc1 );
+        Fxt::Node::Api*                     match = createNode( factory, pointDb2, doc2 );
+        Fxt::Node::Api*                     other = createNode( factory, pointDb3, doc3, "Different name" );
+        REQUIRE( node );
+        REQUIRE( match );
+        REQUIRE( other );
+        REQUIRE( node->start( Fxt::System::ElapsedTime::now() ) );
+
+        // Two Standbys: one for a matching Node, one for a different Node definition
+        Standby                           standby( HEAP_SIZE_HA, OPTION_FXT_NODE_HA_FAILOVER_TIMEOUT_MS, match );
+        Standby                           mismatched( HEAP_SIZE_HA, OPTION_FXT_NODE_HA_FAILOVER_TIMEOUT_MS, other );
+        Cpl::Io::Socket::Posix::Listener  listener;
+        Cpl::Io::Socket::Posix::Listener  listener2;
+        Cpl::System::Thread*              standbyThread   = Cpl::System::Thread::create( standby, "HaStandby" );
+        Cpl::System::Thread*              standby2Thread  = Cpl::System::Thread::create( mismatched, "HaStandby2" );
+        Cpl::System::Thread*              listenerThread  = Cpl::System::Thread::create( listener, "HaListener" );
+        Cpl::System::Thread*              listener2Thread = Cpl::System::Thread::create( listener2, "HaListener2" );
+        REQUIRE( standbyThread );
+        REQUIRE( standby2Thread );
+        REQUIRE( listenerThread );
+        REQUIRE( listener2Thread );
+        listener.startListening( standby, PORT_NUM_ + 1 );
+        listener2.startListening( mismatched, PORT_NUM_ + 2 );
+
+        Cpl::Io::Socket::Posix::Connector connector;
+        Primary                           primary( *node, connector, "localhost", PORT_NUM_ + 1, 10 );
+        Primary                           primary2( *node, connector, "localhost", PORT_NUM_ + 2, 10 );
+        Cpl::System::Thread*              primaryThread  = Cpl::System::Thread::create( primary, "HaPrimary" );
+        Cpl::System::Thread*              primary2Thread = Cpl::System::Thread::create( primary2, "HaPrimary2" );
+        REQUIRE( primaryThread );
+        REQUIRE( primary2Thread );
+        uint32_t seqNum = 0;
+        for ( int i=0; i < MAX_WAIT_LOOPS && !(standby.hasSnapshot( seqNum ) && mismatched.getNumRejected() > 0); i++ )
+        {
+            Cpl::System::Api::sleep( WAIT_LOOP_MS );
+        }
+        REQUIRE( standby.hasSnapshot( seqNum ) );
+        REQUIRE( standby.getNumRejected() == 0 );
+        REQUIRE( mismatched.getNumRejected() > 0 );
+        REQUIRE( mismatched.hasSnapshot( seqNum ) == false );
+
+        // Stall the second Chassis: the snapshots are abandoned, the first Chassis (and the Primary) keep running
+        StallMsg stall;
+        node->getChassis( 1 )->getServer().getMailbox().post( stall );
+        stall.m_stalled.wait();
+        uint32_t numAbandoned = primary.getNumAbandoned();
+        for ( int i=0; i < MAX_WAIT_LOOPS && primary.getNumAbandoned() < numAbandoned + 2; i++ )
+        {
+            Cpl::System::Api::sleep( WAIT_LOOP_MS );
+        }
+        REQUIRE( primary.getNumAbandoned() >= numAbandoned + 2 );
+        uint32_t stalledSeq = primary.getSequenceNumber();
+        Cpl::System::Api::sleep( 100 );
+        REQUIRE( primary.getSequenceNumber() == stalledSeq );
+        REQUIRE( primary.isConnected() );
+        REQUIRE( standby.isFailoverRequired() == false );   // Heartbeats are still sent
+
+        // Release the Chassis: snapshots resume
+        stall.m_release.signal();
+        for ( int i=0; i < MAX_WAIT_LOOPS && primary.getSequenceNumber() < stalledSeq + 2; i++ )
+        {
+            Cpl::System::Api::sleep( WAIT_LOOP_MS );
+        }
+        REQUIRE( primary.getSequenceNumber() >= stalledSeq + 2 );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Primary: seq=%lu, abandoned=%lu", (unsigned long) primary.getSequenceNumber(), (unsigned long) primary.getNumAbandoned()) );
+
+        primary.pleaseStop();
+        primary2.pleaseStop();
+        waitForStop( primary );
+        waitForStop( primary2 );
+        node->stop();
+        REQUIRE( standby.restore( *other ) == false );      // Different definition
+        listener.terminate();
+        listener2.terminate();
+        standby.pleaseStop();
+        mismatched.pleaseStop();
+        waitForStop( standby );
+        waitForStop( mismatched );
+        REQUIRE( standby.restore( *match ) );
+        Cpl::System::Thread::destroy( *primaryThread );
+        Cpl::System::Thread::destroy( *primary2Thread );
+        Cpl::System::Thread::destroy( *standbyThread );
+        Cpl::System::Thread::destroy( *standby2Thread );
+        waitForStop( listener );
+        waitForStop( listener2 );
+        Cpl::System::Thread::destroy( *listenerThread );
+        Cpl::System::Thread::destroy( *listener2Thread );
+        factory.destroy( *node );
+        factory.destroy( *match );
+        factory.destroy( *other );
+    }
+
+    SECTION( "fail-over across processes" )
+    {
+        // The Primary Node runs in a child process
+        pid_t pid = fork();
+        REQUIRE( pid >= 0 );
+        if ( pid == 0 )
+        {
+            runPrimary();
+        }
+
+        // Standby Node
+        Fxt::Point::Database<MAX_POINTS>    pointDb;
+        Fxt::Type::Error                    nodeError;
+        Fxt::Node::Mock::Kestrel::Factory   factory( HEAP_SIZE_GENERAL, HEAP_SIZE_CARD, HEAP_SIZE_HA, nullptr, 2 );
+        StaticJsonDocument<10240>           doc;
+        REQUIRE( deserializeJson( doc, NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+        JsonVariant     nodeJsonObj = doc.as<JsonVariant>();
+        Fxt::Node::Api* node        = factory.createFromJSON( nodeJsonObj, pointDb, nodeError );
+        REQUIRE( node );
+
+        Standby                          standby( HEAP_SIZE_HA, OPTION_FXT_NODE_HA_FAILOVER_TIMEOUT_MS, node );
+        Cpl::Io::Socket::Posix::Listener listener;
+        Cpl::System::Thread*             standbyThread  = Cpl::System::Thread::create( standby, "HaStandby" );
+        Cpl::System::Thread*             listenerThread = Cpl::System::Thread::create( listener, "HaListener" );
+        REQUIRE( standbyThread );
+        REQUIRE( listenerThread );
+        listener.startListening( standby, PORT_NUM_ );
+
+        // Wait for the Primary to 'crash'
+        for ( int i=0; i < MAX_WAIT_LOOPS && !standby.isFailoverRequired(); i++ )
+        {
+            Cpl::System::Api::sleep( WAIT_LOOP_MS );
+        }
+        int status = -1;
+        REQUIRE( waitpid( pid, &status, 0 ) == pid );
+        REQUIRE( WIFEXITED( status ) );
+        REQUIRE( WEXITSTATUS( status ) == 0 );
+        REQUIRE( standby.isFailoverRequired() );
+
+        uint32_t seqNum = 0;
+        REQUIRE( standby.hasSnapshot( seqNum ) );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Standby: seq=%lu, discarded=%lu", (unsigned long) seqNum, (unsigned long) standby.getNumDiscarded()) );
+        REQUIRE( seqNum > 10 );
+        REQUIRE( standby.getNumDiscarded() == 0 );
+        REQUIRE( standby.getNumRejected() == 0 );
+
+        // Fail-over
+        listener.terminate();
+        standby.pleaseStop();
+        waitForStop( standby );
+        Fxt::Point::Bool* shared1 = (Fxt::Point::Bool*) pointDb.lookupById( FXT_PT_SHARED_1 );
+        Fxt::Point::Bool* andGate = (Fxt::Point::Bool*) pointDb.lookupById( FXT_PT_ANDGATE_1 );
+        REQUIRE( shared1 );
+        REQUIRE( andGate );
+        bool val = true;
+        REQUIRE( standby.restore( *node ) );
+        REQUIRE( shared1->read( val ) );
+        REQUIRE( val == false );
+        REQUIRE( shared1->isLocked() );
+
+        // Resume execution with the Primary's state
+        REQUIRE( node->start( Fxt::System::ElapsedTime::now() ) );
+        REQUIRE( standby.restore( *node ) == false );   // Can't restore a running Node
+        Cpl::System::Api::sleep( 100 );
+        node->stop();
+        val = true;
+        REQUIRE( shared1->read( val ) );
+        REQUIRE( val == false );
+        val = true;
+        REQUIRE( andGate->read( val ) );     // Output is driven by the restored state
+        REQUIRE( val == false );
+
+        factory.destroy( *node );
+        Cpl::System::Thread::destroy( *standbyThread );
+        waitForStop( listener );
+        Cpl::System::Thread::destroy( *listenerThread );
+    }
+
+    REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
+}
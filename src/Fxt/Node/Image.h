@@ -0,0 +1,96 @@
+#ifndef Fxt_Node_Image_h_
+#define Fxt_Node_Image_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file
+
+    This file defines the layout of a binary 'Node Image'.  A Node Image is
+    a pre-compiled Node definition (see scripts/foxtail/nodeimage.py) that
+    can be loaded - in a single pass - directly from memory (e.g. a memory
+    mapped file or XIP flash) without parsing any JSON text.
+
+    \code
+
+    All multi-byte fields are little-endian.
+
+    Header (HEADER_SIZE bytes):
+        uint32_t    magic           MAGIC
+        uint16_t    version         VERSION
+        uint16_t    headerSize      HEADER_SIZE
+        uint32_t    payloadLen      Number of bytes following the header
+        uint32_t    payloadCrc      CRC32 (Cpl::Checksum::Crc32EthernetFast) of the payload
+
+    Payload (a sequence of records).  Each record starts with a single byte tag:
+        RECORD_NODE         uint8_t numChassis, char typeGuid[GUID_SIZE] (null padded)
+        RECORD_CHASSIS      uint64_t fer, uint16_t numScanners, uint16_t numExecutionSets, uint16_t numSharedPts
+        RECORD_SCANNER      uint32_t scanRateMultiplier, uint16_t numCards
+        RECORD_CARD         uint32_t len, <len bytes of MessagePack: the Card's JSON object>
+        RECORD_EXESET       uint32_t exeRateMultiplier, uint16_t numLogicChains
+        RECORD_LOGIC_CHAIN  uint32_t len, <len bytes of MessagePack: the Logic Chain's JSON object>
+        RECORD_SHARED_PT    uint32_t len, <len bytes of MessagePack: the Shared Point's JSON object>
+
+    Record order:
+        NODE
+          CHASSIS                   // repeated 'numChassis' times
+            SCANNER                 // repeated 'numScanners' times
+              CARD                  // repeated 'numCards' times
+            EXESET                  // repeated 'numExecutionSets' times
+              LOGIC_CHAIN           // repeated 'numLogicChains' times
+            SHARED_PT               // repeated 'numSharedPts' times
+
+    \endcode
+
+    The element counts (i.e. the memory allocation sizes for the containers)
+    are pre-computed by the compiler, and the point IDs/references are
+    pre-resolved, i.e. the image is the output of name2id.py.
+
+    The individual elements are MessagePack encoded and are constructed by
+    the existing Card/Logic Chain/Point factories.  Decoding the elements is
+    a small fraction of the Node's create time, which is dominated by
+    constructing the objects and starting the Chassis threads (see the
+    'cold start' test in src/Fxt/Node/_0test/node.cpp).
+ */
+
+#include <stdint.h>
+
+///
+namespace Fxt {
+///
+namespace Node {
+///
+namespace Image {
+
+/// Magic value: 'FXNI' when stored little-endian
+static constexpr uint32_t MAGIC              = 0x494E5846;
+
+/// Current image format version
+static constexpr uint16_t VERSION            = 1;
+
+/// Size, in bytes, of the image header
+static constexpr uint16_t HEADER_SIZE        = 16;
+
+/// Size, in bytes, of the Node type GUID field (8-4-4-4-12 format + null terminator)
+static constexpr unsigned GUID_SIZE          = 37;
+
+/// Record tags
+static constexpr uint8_t  RECORD_NODE        = 'N';
+static constexpr uint8_t  RECORD_CHASSIS     = 'C';  //!< Record tag
+static constexpr uint8_t  RECORD_SCANNER     = 'S';  //!< Record tag
+static constexpr uint8_t  RECORD_CARD        = 'c';  //!< Record tag
+static constexpr uint8_t  RECORD_EXESET      = 'E';  //!< Record tag
+static constexpr uint8_t  RECORD_LOGIC_CHAIN = 'L';  //!< Record tag
+static constexpr uint8_t  RECORD_SHARED_PT   = 'P';  //!< Record tag
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
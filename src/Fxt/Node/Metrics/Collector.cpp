@@ -0,0 +1,153 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Collector.h"
+#include "Cpl/Logging/Api.h"
+#include <new>
+
+///
+using namespace Fxt::Node::Metrics;
+
+
+//////////////////////////////////////////////////
+Collector::ChassisMetrics::ChassisMetrics() noexcept
+    : cycles( "fxt_chassis_cycles_total", "Number of Chassis cycles", labels.getString() )
+    , cycleTime( "fxt_chassis_cycle_time_ns", "Execution time, in nanoseconds, of the most recent Chassis cycle", labels.getString() )
+    , maxCycleTime( "fxt_chassis_cycle_time_max_ns", "Worst case Chassis cycle execution time in nanoseconds", labels.getString() )
+    , slippages( "fxt_chassis_slippages_total", "Number of Chassis Periods that did not execute on time", labels.getString() )
+    , cardErrors( "fxt_chassis_card_errors", "Number of IO Cards in an error state", labels.getString() )
+{
+}
+
+Collector::HeapMetrics::HeapMetrics( const char* labels ) noexcept
+    : size( "fxt_node_heap_size_bytes", "Size, in bytes, of the Node heap", labels )
+    , used( "fxt_node_heap_used_bytes", "Number of bytes currently allocated from the Node heap", labels )
+    , highWatermark( "fxt_node_heap_high_watermark_bytes", "Maximum number of bytes allocated from the Node heap", labels )
+    , failures( "fxt_node_heap_alloc_failures_total", "Number of failed Node heap allocations", labels )
+{
+}
+
+//////////////////////////////////////////////////
+Collector::Collector( Fxt::Node::Api& node, Fxt::Metrics::Registry& registry ) noexcept
+    : m_node( node )
+    , m_registry( registry )
+    , m_chassis( nullptr )
+    , m_heaps{ { "heap=\"general\"" }, { "heap=\"cardStateful\"" }, { "heap=\"haStateful\"" } }
+    , m_logOverflows( "fxt_log_overflows_total", "Number of log entries dropped because the log queue was full" )
+    , m_numChassis( node.getNumChassis() )
+{
+    // Chassis metrics
+    if ( m_numChassis > 0 )
+    {
+        m_chassis = new(std::nothrow) ChassisMetrics[m_numChassis];
+        if ( m_chassis == nullptr )
+        {
+            m_numChassis = 0;
+        }
+    }
+    for ( uint16_t i=0; i < m_numChassis; i++ )
+    {
+        m_chassis[i].labels.format( "chassis=\"%u\"", i );
+        m_registry.add( m_chassis[i].cycles );
+        m_registry.add( m_chassis[i].cycleTime );
+        m_registry.add( m_chassis[i].maxCycleTime );
+        m_registry.add( m_chassis[i].slippages );
+        m_registry.add( m_chassis[i].cardErrors );
+    }
+
+    // Heap metrics
+    for ( unsigned i=0; i < Fxt::Node::Api::eNUM_HEAPS; i++ )
+    {
+        m_registry.add( m_heaps[i].size );
+        m_registry.add( m_heaps[i].used );
+        m_registry.add( m_heaps[i].highWatermark );
+        m_registry.add( m_heaps[i].failures );
+    }
+
+    m_registry.add( m_logOverflows );
+    m_registry.add( *this );
+}
+
+Collector::~Collector()
+{
+    m_registry.remove( *this );
+    m_registry.remove( m_logOverflows );
+    for ( unsigned i=0; i < Fxt::Node::Api::eNUM_HEAPS; i++ )
+    {
+        m_registry.remove( m_heaps[i].size );
+        m_registry.remove( m_heaps[i].used );
+        m_registry.remove( m_heaps[i].highWatermark );
+        m_registry.remove( m_heaps[i].failures );
+    }
+    for ( uint16_t i=0; i < m_numChassis; i++ )
+    {
+        m_registry.remove( m_chassis[i].cycles );
+        m_registry.remove( m_chassis[i].cycleTime );
+        m_registry.remove( m_chassis[i].maxCycleTime );
+        m_registry.remove( m_chassis[i].slippages );
+        m_registry.remove( m_chassis[i].cardErrors );
+    }
+    delete[] m_chassis;
+}
+
+//////////////////////////////////////////////////
+void Collector::collect() noexcept
+{
+    for ( uint16_t i=0; i < m_numChassis; i++ )
+    {
+        Fxt::Chassis::Api* chassis = m_node.getChassis( i );
+        if ( chassis )
+        {
+            Fxt::Chassis::ServerApi& server = chassis->getServer();
+            m_chassis[i].cycles.set( server.getNumCycles() );
+            m_chassis[i].cycleTime.set( (long) server.getLastCycleTime() );
+            m_chassis[i].maxCycleTime.set( (long) server.getMaxCycleTime() );
+            m_chassis[i].slippages.set( server.getNumSlippages() );
+            m_chassis[i].cardErrors.set( countCardErrors( *chassis ) );
+        }
+    }
+
+    for ( unsigned i=0; i < Fxt::Node::Api::eNUM_HEAPS; i++ )
+    {
+        Fxt::Node::HeapUsage_T usage;
+        if ( m_node.getHeapUsage( (Fxt::Node::Api::HeapId_T) i, usage ) )
+        {
+            m_heaps[i].size.set( (long) usage.totalBytes );
+            m_heaps[i].used.set( (long) usage.usedBytes );
+            m_heaps[i].highWatermark.set( (long) usage.highWatermark );
+            m_heaps[i].failures.set( (unsigned long) usage.numFailures );
+        }
+    }
+
+    m_logOverflows.set( Cpl::Logging::getOverflowCount() );
+}
+
+long Collector::countCardErrors( Fxt::Chassis::Api& chassis ) noexcept
+{
+    long     numErrors   = 0;
+    uint16_t numScanners = chassis.getNumScanners();
+    for ( uint16_t i=0; i < numScanners; i++ )
+    {
+        Fxt::Chassis::ScannerApi* scanner  = chassis.getScanner( i );
+        uint16_t                  numCards = scanner ? scanner->getNumCards() : 0;
+        for ( uint16_t j=0; j < numCards; j++ )
+        {
+            Fxt::Card::Api* card = scanner->getCard( j );
+            if ( card && card->getErrorCode() != Fxt::Type::Error::SUCCESS() )
+            {
+                numErrors++;
+            }
+        }
+    }
+    return numErrors;
+}
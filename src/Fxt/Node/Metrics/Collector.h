@@ -0,0 +1,144 @@
+#ifndef Fxt_Node_Metrics_Collector_h_
+#define Fxt_Node_Metrics_Collector_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Node/Api.h"
+#include "Fxt/Metrics/Collector.h"
+#include "Fxt/Metrics/Registry.h"
+#include "Fxt/Metrics/Counter.h"
+#include "Fxt/Metrics/Gauge.h"
+#include "Cpl/Text/FString.h"
+
+
+///
+namespace Fxt {
+///
+namespace Node {
+///
+namespace Metrics {
+
+
+/** This concrete class exposes a Node's statistics as metrics.  The
+    constructor registers the metrics (and the collector itself) with the
+    supplied Registry, and the destructor removes them.  The following
+    metrics are provided:
+
+    \code
+    fxt_chassis_cycles_total{chassis="<idx>"}                Number of Chassis cycles
+    fxt_chassis_cycle_time_ns{chassis="<idx>"}               Execution time of the most recent Chassis cycle
+    fxt_chassis_cycle_time_max_ns{chassis="<idx>"}           Worst case Chassis cycle execution time
+    fxt_chassis_slippages_total{chassis="<idx>"}             Number of Periods that did not execute on time
+    fxt_chassis_card_errors{chassis="<idx>"}                 Number of IO Cards in an error state
+    fxt_node_heap_size_bytes{heap="<heap>"}                  Size of the heap
+    fxt_node_heap_used_bytes{heap="<heap>"}                  Bytes currently allocated from the heap
+    fxt_node_heap_high_watermark_bytes{heap="<heap>"}        Maximum number of bytes allocated from the heap
+    fxt_node_heap_alloc_failures_total{heap="<heap>"}        Number of failed allocations
+    fxt_log_overflows_total                                  Number of log entries dropped (see Cpl::Logging::getOverflowCount())
+    \endcode
+
+    The Chassis statistics are maintained - lock-free - by the Chassis
+    Servers (see Fxt::Chassis::ServerApi).  All of the values are sampled in
+    the rendering thread, i.e. the collector adds NO work to the Chassis
+    threads.
+
+    The Node MUST be created (and its Chassis added) BEFORE the collector is
+    constructed, and the collector MUST be destroyed before the Node is
+    destroyed.
+ */
+class Collector : public Fxt::Metrics::Collector
+{
+public:
+    /// Constructor
+    Collector( Fxt::Node::Api& node, Fxt::Metrics::Registry& registry ) noexcept;
+
+    /// Destructor
+    ~Collector();
+
+public:
+    /// See Fxt::Metrics::Collector
+    void collect() noexcept;
+
+protected:
+    /// Per Chassis metrics
+    struct ChassisMetrics
+    {
+        /// Constructor.  Note: The label string is populated by the Collector (after construction)
+        ChassisMetrics() noexcept;
+
+        /// Label set
+        Cpl::Text::FString<24>      labels;
+
+        /// Metric
+        Fxt::Metrics::Counter       cycles;
+
+        /// Metric
+        Fxt::Metrics::Gauge         cycleTime;
+
+        /// Metric
+        Fxt::Metrics::Gauge         maxCycleTime;
+
+        /// Metric
+        Fxt::Metrics::Counter       slippages;
+
+        /// Metric
+        Fxt::Metrics::Gauge         cardErrors;
+    };
+
+    /// Per Heap metrics
+    struct HeapMetrics
+    {
+        /// Constructor
+        HeapMetrics( const char* labels ) noexcept;
+
+        /// Metric
+        Fxt::Metrics::Gauge         size;
+
+        /// Metric
+        Fxt::Metrics::Gauge         used;
+
+        /// Metric
+        Fxt::Metrics::Gauge         highWatermark;
+
+        /// Metric
+        Fxt::Metrics::Counter       failures;
+    };
+
+protected:
+    /// Helper method: returns the number of cards (of the specified Chassis) that are in an error state
+    static long countCardErrors( Fxt::Chassis::Api& chassis ) noexcept;
+
+protected:
+    /// The Node
+    Fxt::Node::Api&                 m_node;
+
+    /// Registry
+    Fxt::Metrics::Registry&         m_registry;
+
+    /// Chassis metrics (one per Chassis)
+    ChassisMetrics*                 m_chassis;
+
+    /// Heap metrics (one per heap)
+    HeapMetrics                     m_heaps[Fxt::Node::Api::eNUM_HEAPS];
+
+    /// Log overflows
+    Fxt::Metrics::Counter           m_logOverflows;
+
+    /// Number of Chassis
+    uint16_t                        m_numChassis;
+};
+
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -35,12 +35,16 @@ using namespace Fxt::Node::Mock::Kestrel;
 Factory::Factory( size_t                              sizeGeneralHeap,
                   size_t                              sizeCardStatefulHeap,
                   size_t                              sizeHaStatefulHeap,
-                  Cpl::System::SharedEventHandlerApi* eventHandler )
+                  Cpl::System::SharedEventHandlerApi* eventHandler,
+                  uint8_t                             maxAllowedChassis,
+                  const int*                          chassisCpuCores )
     : FactoryCommon_()
     , m_eventHandler( eventHandler )
     , m_sizeGeneralHeap( sizeGeneralHeap )
     , m_sizeCardStatefulHeap( sizeCardStatefulHeap )
     , m_sizeHaStatefulHeap( sizeHaStatefulHeap )
+    , m_chassisCpuCores( chassisCpuCores )
+    , m_maxAllowedChassis( maxAllowedChassis )
 {
 }
 
@@ -53,7 +57,10 @@ Fxt::Node::Api* Factory::createNode( uint8_t                    numChassis,
                                          m_sizeGeneralHeap,
                                          m_sizeCardStatefulHeap,
                                          m_sizeHaStatefulHeap,
-                                         m_eventHandler );
+                                         m_eventHandler,
+                                         numChassis,
+                                         m_chassisCpuCores,
+                                         m_lockedHeaps );
     if ( node == nullptr )
     {
         nodeErrorCode = Fxt::Node::fullErr( Fxt::Node::Err_T::NO_MEMORY_NODE );
@@ -33,11 +33,18 @@ namespace Kestrel {
 class Factory : public Fxt::Node::FactoryCommon_
 {
 public:
-    /// Constructor
+    /** Constructor.  'maxAllowedChassis' allows the mock Node to be used for
+        testing multi-chassis configurations.  'chassisCpuCores' is an optional
+        array (of 'maxAllowedChassis' elements) of CPU cores to pin the Chassis
+        threads to (see Fxt::Node::Common_::initialize()).  The array MUST
+        stay in scope for the life of the factory.
+     */
     Factory( size_t                              sizeGeneralHeap,
              size_t                              sizeCardStatefulHeap,
              size_t                              sizeHaStatefulHeap,
-             Cpl::System::SharedEventHandlerApi* eventHandler = nullptr );
+             Cpl::System::SharedEventHandlerApi* eventHandler      = nullptr,
+             uint8_t                             maxAllowedChassis = Node::MAX_ALLOWED_CHASSIS,
+             const int*                          chassisCpuCores   = nullptr );
 
 public:
     /// See Fxt::Node::FactoryCommon_
@@ -51,7 +58,7 @@ public:
     const char* getGuid() const noexcept { return Node::GUID_STRING; }
 
     /// See Fxt::Node::FactoryApi
-    uint8_t getMaxAllowedChassis() const noexcept { return Node::MAX_ALLOWED_CHASSIS; }
+    uint8_t getMaxAllowedChassis() const noexcept { return m_maxAllowedChassis; }
 
     /// See Fxt::Node::FactoryApi
     const char* getTypeName() const noexcept { return Node::TYPE_NAME; }
@@ -68,6 +75,12 @@ protected:
 
     /// Size, in bytes, of a Node's HA Stateful heap
     size_t  m_sizeHaStatefulHeap;
+
+    /// CPU cores to pin the Chassis threads to (nullptr if not pinned)
+    const int* m_chassisCpuCores;
+
+    /// Maximum number of supported chassis
+    uint8_t m_maxAllowedChassis;
 };
 
 
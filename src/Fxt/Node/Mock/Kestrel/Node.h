@@ -63,20 +63,23 @@ public:
     /// Type name for the card
     static constexpr const char*    TYPE_NAME   = "Fxt::Node::Mock::Kestrel";
 
-    /// Maximum number of supported chassis
+    /// Default maximum number of supported chassis
     static constexpr const uint8_t  MAX_ALLOWED_CHASSIS = 1;
 
 public:
-    /// Constructor
+    /// Constructor.  See Fxt::Node::Common_::initialize() for 'chassisCpuCores', and Fxt::Node::Common_ for 'lockedHeaps'
     Node( Fxt::Point::DatabaseApi&            pointDb,
           size_t                              sizeGeneralHeap,
           size_t                              sizeCardStatefulHeap,
           size_t                              sizeHaStatefulHeap,
-          Cpl::System::SharedEventHandlerApi* eventHandler = nullptr)
-        : Common_( MAX_ALLOWED_CHASSIS, pointDb, sizeGeneralHeap, sizeCardStatefulHeap, sizeHaStatefulHeap )
+          Cpl::System::SharedEventHandlerApi* eventHandler    = nullptr,
+          uint8_t                             numChassis      = MAX_ALLOWED_CHASSIS,
+          const int*                          chassisCpuCores = nullptr,
+          bool                                lockedHeaps     = false )
+        : Common_( numChassis, pointDb, sizeGeneralHeap, sizeCardStatefulHeap, sizeHaStatefulHeap, lockedHeaps )
         , m_eventHandler( eventHandler )
     {
-        initialize( sizeCardStatefulHeap );
+        initialize( sizeCardStatefulHeap, chassisCpuCores );
     }
 
 
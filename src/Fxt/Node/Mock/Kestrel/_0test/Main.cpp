@@ -27,6 +27,7 @@
 #include "Fxt/Card/Mock/TShell/Ain8.h"
 #include "Fxt/Card/Mock/TShell/Dio8.h"
 #include "Fxt/Node/TShell/Node.h"
+#include "Fxt/Node/TShell/Profile.h"
 #include "Fxt/Node/Mock/Kestrel/Factory.h"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -61,6 +62,7 @@ static Cpl::TShell::Cmd::Trace                      traceCmd_( g_cmdlist );
 static Cpl::TShell::Cmd::TPrint                     tprintCmd_( g_cmdlist );
 
 static Fxt::Node::TShell::Node                      nodeCmd_( g_cmdlist, kestrelFactory_, pointDb_ );
+static Fxt::Node::TShell::Profile                   profCmd_( g_cmdlist );
 static Fxt::Card::Mock::TShell::Ain8                ain8Cmd_( g_cmdlist );
 static Fxt::Card::Mock::TShell::Dio8                dio8Cmd_( g_cmdlist );
 
@@ -14,7 +14,6 @@
 #include "Cpl/Text/strip.h"
 #include "Cpl/Text/FString.h"
 #include "Cpl/Text/Tokenizer/TextBlock.h"
-#include "Cpl/Json/ObjectDetector.h"
 #include <string.h>
 #include "Fxt/Node/Api.h"
 #include "Fxt/System/ElapsedTime.h"
@@ -22,6 +21,53 @@
 ///
 using namespace Fxt::Node::TShell;
 
+namespace {
+
+/// Adapts the TShell's out-of-band read to an input stream. A Ctrl-Q aborts the stream
+class OobInput_ : public Cpl::Io::Input
+{
+public:
+    /// Constructor
+    OobInput_( Cpl::TShell::Context_& context ) :m_context( context ), m_bytesRead( 0 ), m_aborted( false ) {}
+
+    /// See Cpl::Io::Input
+    bool read( void* buffer, int numBytes, int& bytesRead )
+    {
+        if ( m_aborted || !m_context.oobRead( buffer, numBytes, bytesRead ) )
+        {
+            return false;
+        }
+        if ( memchr( buffer, 0x11, bytesRead ) != nullptr )
+        {
+            m_aborted = true;
+            return false;
+        }
+        m_bytesRead += bytesRead;
+        return true;
+    }
+
+    /// See Cpl::Io::Input
+    bool available() { return !m_aborted; }
+
+    /// See Cpl::Io::IsEos
+    bool isEos() { return m_aborted; }
+
+    /// See Cpl::Io::Close
+    void close() {}
+
+public:
+    /// Reference to the TShell context
+    Cpl::TShell::Context_&  m_context;
+
+    /// Number of bytes read
+    size_t                  m_bytesRead;
+
+    /// Set to true when the download is aborted
+    bool                    m_aborted;
+};
+
+};
+
 
 ///////////////////////////
 Node::Node( Cpl::Container::Map<Cpl::TShell::Command>& commandList,
@@ -146,6 +192,28 @@ Cpl::TShell::Command::Result_T Node::execute( Cpl::TShell::Context_& context, ch
         outtext.format( "Chassis count:  %u", numChassis );
         io &= context.writeFrame( outtext );
 
+        // Heap usage
+        static const char* heapNames[Fxt::Node::Api::eNUM_HEAPS] ={ "general", "card", "HA" };
+        for ( int i=0; i < Fxt::Node::Api::eNUM_HEAPS; i++ )
+        {
+            Fxt::Node::HeapUsage_T usage;
+            if ( node->getHeapUsage( (Fxt::Node::Api::HeapId_T) i, usage ) )
+            {
+                outtext.format( "Heap %-8s  used=%lu, total=%lu, hwm=%lu, failures=%lu%s", heapNames[i], (unsigned long) usage.usedBytes, (unsigned long) usage.totalBytes, (unsigned long) usage.highWatermark, (unsigned long) usage.numFailures,
+                                usage.hugePages ? ", locked+huge" : usage.locked ? ", locked" : "" );
+                io &= context.writeFrame( outtext );
+                if ( tokens.numParameters() > 1 )
+                {
+                    outtext = "  ";
+                    for ( int t=0; t < Fxt::System::AllocTag::eNUM_TAGS; t++ )
+                    {
+                        outtext.formatAppend( " %s=%lu", Fxt::System::AllocTag::toString( (Fxt::System::AllocTag::Tag_T) t ), (unsigned long) usage.bytesByTag[t] );
+                    }
+                    io &= context.writeFrame( outtext );
+                }
+            }
+        }
+
         if ( tokens.numParameters() > 1 )
         {
             // Iterate over the chassis
@@ -271,65 +339,32 @@ Cpl::TShell::Command::Result_T Node::execute( Cpl::TShell::Context_& context, ch
             return Command::eERROR_FAILED;
         }
 
-        // Download via an Out-of-Bounds read
-        Cpl::Json::ObjectDetector detector;
-        uint8_t* dstBufPtr      = m_jsonBuffer;
-        int      remainingBytes = OPTION_FXT_NODE_TSHELL_NODE_MAX_JSON_FILE_SIZE;
-        int      bytesRead;
-        while ( context.oobRead( dstBufPtr, remainingBytes, bytesRead ) )
+        // Download via an Out-of-Bounds read - and create the Node as the JSON text is streamed in
+        OobInput_        oobfd( context );
+        Fxt::Type::Error nodeError;
+        Fxt::Node::Api*  uut = m_nodeFactory.createFromStream( oobfd,
+                                                               m_jsonDoc,
+                                                               m_pointDb,
+                                                               nodeError );
+        if ( oobfd.m_aborted )
         {
-            // Null terminate the current input
-            dstBufPtr[bytesRead] = '\0';
-
-            size_t startPosition;
-            size_t endPosition;
-
-            if ( detector.scan( dstBufPtr, bytesRead, startPosition, endPosition ) )
-            {
-                DeserializationError err = deserializeJson( m_jsonDoc, m_jsonBuffer + startPosition, endPosition - startPosition + 1 );
-                if ( err != DeserializationError::Ok )
-                {
-                    outtext.format( "ERROR: JSON object invalid: %s", err.c_str() );
-                    context.writeFrame( outtext );
-                    return Command::eERROR_FAILED;
-                }
-
-                JsonVariant      nodeJsonObj = m_jsonDoc.as<JsonVariant>();
-                Fxt::Type::Error nodeError;
-                Fxt::Node::Api* uut = m_nodeFactory.createFromJSON( nodeJsonObj,
-                                                                    m_pointDb,
-                                                                    nodeError );
-                if ( uut == nullptr )
-                {
-                    // Clean up after the failure
-                    m_pointDb.cleanupPointsAfterNodeCreateFailure();
-
-                    outtext.format( "ERROR: Failed to create Node: %s", nodeError.toText( smallBuf ) );
-                    context.writeFrame( outtext );
-                    return Command::eERROR_FAILED;
-                }
-
-                outtext.format( "Download Successful (length=%lu)", endPosition - startPosition + 1 );
-                io &= context.writeFrame( outtext );
-                return io ? Command::eSUCCESS : Command::eERROR_IO;
-            }
-
-            // Check for Ctrl-Q exit
-            if ( strchr( (const char*) dstBufPtr, 0x11 ) != nullptr )
-            {
-                context.writeFrame( "Download ABORTED" );
-                return Command::eERROR_FAILED;
-            }
+            m_pointDb.cleanupPointsAfterNodeCreateFailure();
+            context.writeFrame( "Download ABORTED" );
+            return Command::eERROR_FAILED;
+        }
+        if ( uut == nullptr )
+        {
+            // Clean up after the failure
+            m_pointDb.cleanupPointsAfterNodeCreateFailure();
 
-            // Setup to read the next block of stuffs
-            remainingBytes -= bytesRead;
-            if ( remainingBytes <= 0 )
-            {
-                context.writeFrame( "Download Buffer space exceeded - download ABORTED" );
-                return Command::eERROR_FAILED;
-            }
-            dstBufPtr += bytesRead;
+            outtext.format( "ERROR: Failed to create Node: %s", nodeError.toText( smallBuf ) );
+            context.writeFrame( outtext );
+            return Command::eERROR_FAILED;
         }
+
+        outtext.format( "Download Successful (length=%lu)", (unsigned long) oobfd.m_bytesRead );
+        io &= context.writeFrame( outtext );
+        return io ? Command::eSUCCESS : Command::eERROR_IO;
     }
 
     // If I get here the command failed!
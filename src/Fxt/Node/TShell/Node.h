@@ -35,17 +35,17 @@
 #define FXTNODETSHELL_DETAIL_NODE_      "  Display the current state of the node and allows the user to start/stop the\n" \
                                         "  node. To download a node definition at runtime - enter the 'download' sub-\n" \
                                         "  command followed by a carriage return, then the JSON text for the node\n" \
-                                        "  definition.  Entering a Ctrl-Q + newline will terminate a stalled download"
+                                        "  definition.  Entering a Ctrl-Q + newline will terminate a stalled download.\n" \
+                                        "  The node's heap usage (and if the heap is locked in memory) is also\n" \
+                                        "  displayed ('verbose' displays the usage by sub-system)."
 
 #endif // ifndef allows detailed help to be compacted down to a single character if FLASH/code space is an issue
 
 
-/// Size, in bytes, of buffer to capture the Node JSON file
-#ifndef OPTION_FXT_NODE_TSHELL_NODE_MAX_JSON_FILE_SIZE
-#define OPTION_FXT_NODE_TSHELL_NODE_MAX_JSON_FILE_SIZE      (8*1024)
-#endif
-
-/// Size, in bytes, of the Binary JSON document
+/** Size, in bytes, of the Binary JSON document.  The Node definition is
+    streamed, i.e. the document only needs to hold the largest individual
+    element (IO Card, Logic Chain, Shared Point) of the Node definition.
+ */
 #ifndef OPTION_FXT_NODE_TSHELL_NODE_MAX_JSON_DOC_SIZE
 #define OPTION_FXT_NODE_TSHELL_NODE_MAX_JSON_DOC_SIZE       (8*1024)
 #endif
@@ -89,11 +89,8 @@ protected:
     /// Reference to the Point Database
     Fxt::Point::DatabaseApi&    m_pointDb;
 
-    /// Memory to hold binary JSON definition
+    /// Memory to hold a single binary JSON element of the Node definition
     StaticJsonDocument<OPTION_FXT_NODE_TSHELL_NODE_MAX_JSON_DOC_SIZE> m_jsonDoc;
-
-    /// JSON file buffer
-    uint8_t m_jsonBuffer[OPTION_FXT_NODE_TSHELL_NODE_MAX_JSON_FILE_SIZE+1];
 };
 
 };      // end namespaces
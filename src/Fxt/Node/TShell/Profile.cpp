@@ -0,0 +1,221 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+#include "Profile.h"
+#include "Cpl/Text/atob.h"
+#include "Cpl/Text/Tokenizer/TextBlock.h"
+#include "Fxt/Node/Api.h"
+#include <string.h>
+
+///
+using namespace Fxt::Node::TShell;
+
+/// Actions that are applied to all Logic Chains
+enum Action_T { eQUERY, eENABLE, eDISABLE, eRESET };
+
+// Helper function that applies an action to all Logic Chains in the node. Returns the number of Logic Chains with profiling enabled
+static unsigned applyAction( Fxt::Node::Api* node, Action_T action ) noexcept
+{
+    unsigned numEnabled = 0;
+    uint16_t numChassis = node->getNumChassis();
+    for ( uint16_t chassisIdx=0; chassisIdx < numChassis; chassisIdx++ )
+    {
+        Fxt::Chassis::Api* chassis = node->getChassis( chassisIdx );
+        if ( chassis != nullptr )
+        {
+            uint16_t numExeSets = chassis->getNumExecutionSets();
+            for ( uint16_t exeSetIdx=0; exeSetIdx < numExeSets; exeSetIdx++ )
+            {
+                Fxt::Chassis::ExecutionSetApi* exeSet = chassis->getExecutionSet( exeSetIdx );
+                if ( exeSet != nullptr )
+                {
+                    uint16_t numChains = exeSet->getNumLogicChains();
+                    for ( uint16_t chainIdx=0; chainIdx < numChains; chainIdx++ )
+                    {
+                        Fxt::LogicChain::Api* chain = exeSet->getLogicChain( chainIdx );
+                        if ( chain != nullptr )
+                        {
+                            if ( action == eRESET )
+                            {
+                                chain->resetProfiling();
+                            }
+                            else if ( action != eQUERY )
+                            {
+                                chain->enableProfiling( action == eENABLE );
+                            }
+                            numEnabled += chain->isProfilingEnabled() ? 1 : 0;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return numEnabled;
+}
+
+
+///////////////////////////
+Profile::Profile( Cpl::Container::Map<Cpl::TShell::Command>& commandList ) noexcept
+    : Cpl::TShell::Cmd::Command( commandList, FXTNODETSHELL_VERB_PROFILE_ )
+    , m_numTop( 0 )
+{
+}
+
+
+///////////////////////////
+Cpl::TShell::Command::Result_T Profile::execute( Cpl::TShell::Context_& context, char* cmdString, Cpl::Io::Output& outfd ) noexcept
+{
+    Cpl::Text::Tokenizer::TextBlock tokens( cmdString, context.getDelimiterChar(), context.getTerminatorChar(), context.getQuoteChar(), context.getEscapeChar() );
+    Cpl::Text::String&              outtext  = context.getOutputBuffer();
+    bool                            io       = true;
+
+    // Fail if there is no node
+    Fxt::Node::Api* node = Fxt::Node::Api::getNode();
+    if ( node == nullptr )
+    {
+        context.writeFrame( "ERROR: No valid/working Node instanced defined." );
+        return Command::eERROR_FAILED;
+    }
+
+    // Display profiling state
+    if ( tokens.numParameters() == 1 )
+    {
+        outtext.format( "Profiling enabled: %u Logic Chain(s)", applyAction( node, eQUERY ) );
+        io &= context.writeFrame( outtext );
+        return io ? Command::eSUCCESS : Command::eERROR_IO;
+    }
+
+    // Enable/Disable/Reset
+    if ( tokens.numParameters() == 2 )
+    {
+        const char* subCmd = tokens.getParameter( 1 );
+        Action_T    action;
+        if ( strcmp( subCmd, "on" ) == 0 )
+        {
+            action = eENABLE;
+        }
+        else if ( strcmp( subCmd, "off" ) == 0 )
+        {
+            action = eDISABLE;
+        }
+        else if ( strcmp( subCmd, "reset" ) == 0 )
+        {
+            action = eRESET;
+        }
+        else
+        {
+            return Command::eERROR_INVALID_ARGS;
+        }
+
+        outtext.format( "Profiling enabled: %u Logic Chain(s)", applyAction( node, action ) );
+        io &= context.writeFrame( outtext );
+        return io ? Command::eSUCCESS : Command::eERROR_IO;
+    }
+
+    // Top-N
+    if ( (tokens.numParameters() == 3 || tokens.numParameters() == 4) && strcmp( tokens.getParameter( 1 ), "top" ) == 0 )
+    {
+        unsigned chassisIdx;
+        unsigned maxEntries = OPTION_FXT_NODE_TSHELL_PROFILE_MAX_TOPN;
+        if ( !Cpl::Text::a2ui( chassisIdx, tokens.getParameter( 2 ) ) ||
+            (tokens.numParameters() == 4 && !Cpl::Text::a2ui( maxEntries, tokens.getParameter( 3 ) )) )
+        {
+            return Command::eERROR_INVALID_ARGS;
+        }
+        if ( maxEntries > OPTION_FXT_NODE_TSHELL_PROFILE_MAX_TOPN )
+        {
+            maxEntries = OPTION_FXT_NODE_TSHELL_PROFILE_MAX_TOPN;
+        }
+
+        Fxt::Chassis::Api* chassis = chassisIdx < node->getNumChassis() ? node->getChassis( (uint16_t) chassisIdx ) : nullptr;
+        if ( chassis == nullptr )
+        {
+            outtext.format( "ERROR: Invalid chassis index (%u)", chassisIdx );
+            context.writeFrame( outtext );
+            return Command::eERROR_FAILED;
+        }
+
+        // Build the sorted list
+        m_numTop            = 0;
+        uint16_t numExeSets = chassis->getNumExecutionSets();
+        for ( uint16_t exeSetIdx=0; exeSetIdx < numExeSets; exeSetIdx++ )
+        {
+            Fxt::Chassis::ExecutionSetApi* exeSet = chassis->getExecutionSet( exeSetIdx );
+            if ( exeSet != nullptr )
+            {
+                uint16_t numChains = exeSet->getNumLogicChains();
+                for ( uint16_t chainIdx=0; chainIdx < numChains; chainIdx++ )
+                {
+                    Fxt::LogicChain::Api* chain = exeSet->getLogicChain( chainIdx );
+                    if ( chain != nullptr )
+                    {
+                        uint16_t numComponents = chain->getNumComponents();
+                        for ( uint16_t componentIdx=0; componentIdx < numComponents; componentIdx++ )
+                        {
+                            TopEntry_T entry ={ chain->getComponent( componentIdx ), chain->getComponentStats( componentIdx ), exeSetIdx, chainIdx, componentIdx };
+                            if ( entry.component != nullptr && entry.stats != nullptr && entry.stats->count > 0 )
+                            {
+                                insertTopEntry( entry, maxEntries );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Display the list
+        io &= context.writeFrame( "ES.LC.CO   COUNT      TOTAL(us)  AVG(us)    MAX(us)    TYPE" );
+        for ( unsigned i=0; i < m_numTop; i++ )
+        {
+            const Fxt::Component::ExecutionStats_T* stats = m_top[i].stats;
+            outtext.format( "%02u.%02u.%03u %-10lu %-10llu %-10lu %-10lu %s",
+                            m_top[i].exeSetIdx,
+                            m_top[i].chainIdx,
+                            m_top[i].componentIdx,
+                            (unsigned long) stats->count,
+                            (unsigned long long) (stats->totalTime / 1000),
+                            (unsigned long) (stats->average() / 1000),
+                            (unsigned long) (stats->maxTime / 1000),
+                            m_top[i].component->getTypeName() );
+            io &= context.writeFrame( outtext );
+        }
+        return io ? Command::eSUCCESS : Command::eERROR_IO;
+    }
+
+    // If I get here the command failed!
+    return Command::eERROR_FAILED;
+}
+
+void Profile::insertTopEntry( TopEntry_T& entry, unsigned maxEntries ) noexcept
+{
+    // Find the insertion point
+    unsigned idx = m_numTop;
+    while ( idx > 0 && m_top[idx - 1].stats->totalTime < entry.stats->totalTime )
+    {
+        idx--;
+    }
+
+    // Discard if the list is full and the new entry is the 'smallest'
+    if ( idx >= maxEntries )
+    {
+        return;
+    }
+
+    // Make room for the new entry (dropping the last entry when the list is full)
+    unsigned last = m_numTop < maxEntries ? m_numTop : maxEntries - 1;
+    memmove( &m_top[idx + 1], &m_top[idx], sizeof( TopEntry_T ) * (last - idx) );
+    m_top[idx] = entry;
+    if ( m_numTop < maxEntries )
+    {
+        m_numTop++;
+    }
+}
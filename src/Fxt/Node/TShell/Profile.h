@@ -0,0 +1,104 @@
+#ifndef Fxt_Node_TShell_Profile_h
+#define Fxt_Node_TShell_Profile_h
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "colony_config.h"
+#include "Cpl/TShell/Cmd/Command.h"
+#include "Fxt/Component/ExecutionStats.h"
+#include "Fxt/LogicChain/Api.h"
+
+
+
+#define FXTNODETSHELL_VERB_PROFILE_     "prof"
+
+/** Usage
+                                        "         1         2         3         4         5         6         7         8"
+                                        "12345678901234567890123456789012345678901234567890123456789012345678901234567890"
+*/
+#define FXTNODETSHELL_USAGE_PROFILE_    "prof\n" \
+                                        "prof on|off|reset\n" \
+                                        "prof top <chassisIdx> [<N>]"
+
+/// Detailed Help text
+#ifndef FXTNODETSHELL_DETAIL_PROFILE_
+#define FXTNODETSHELL_DETAIL_PROFILE_   "  Enables/disables/resets the per-Component execution profiling for ALL Logic\n" \
+                                        "  Chains in the Node. The 'top' sub-command lists the N Components (of the\n" \
+                                        "  specified Chassis) with the most total execution time.  The output is:\n" \
+                                        "  <exeSetIdx>.<chainIdx>.<componentIdx> <count> <total> <avg> <max> <type>\n" \
+                                        "  where the times are in microseconds."
+
+#endif // ifndef allows detailed help to be compacted down to a single character if FLASH/code space is an issue
+
+
+/// Maximum number of Components that the 'top' sub-command can list
+#ifndef OPTION_FXT_NODE_TSHELL_PROFILE_MAX_TOPN
+#define OPTION_FXT_NODE_TSHELL_PROFILE_MAX_TOPN     10
+#endif
+
+///
+namespace Fxt {
+///
+namespace Node {
+///
+namespace TShell {
+
+
+
+/** This class implements a TShell command that provides access to the Logic
+    Chain per-Component execution profiling.
+ */
+class Profile : public Cpl::TShell::Cmd::Command
+{
+public:
+    /// See Cpl::TShell::Command                                                               
+    const char* getUsage() const noexcept { return FXTNODETSHELL_USAGE_PROFILE_; }
+
+    /// See Cpl::TShell::Command
+    const char* getHelp() const noexcept { return FXTNODETSHELL_DETAIL_PROFILE_; }
+
+
+public:
+    /// Constructor
+    Profile( Cpl::Container::Map<Cpl::TShell::Command>& commandList ) noexcept;
+
+
+public:
+    /// See Cpl::TShell::Command
+    Cpl::TShell::Command::Result_T execute( Cpl::TShell::Context_& context, char* cmdString, Cpl::Io::Output& outfd ) noexcept;
+
+protected:
+    /// Entry in the 'top' list
+    struct TopEntry_T
+    {
+        Fxt::Component::Api*                    component;      //!< Component
+        const Fxt::Component::ExecutionStats_T* stats;          //!< Component's statistics
+        uint16_t                                exeSetIdx;      //!< Execution Set index
+        uint16_t                                chainIdx;       //!< Logic Chain index
+        uint16_t                                componentIdx;   //!< Component index
+    };
+
+    /// Helper method that inserts an entry into the (sorted) 'top' list. 
+    void insertTopEntry( TopEntry_T& entry, unsigned maxEntries ) noexcept;
+
+protected:
+    /// The 'top' list (sorted by total execution time, most time first)
+    TopEntry_T  m_top[OPTION_FXT_NODE_TSHELL_PROFILE_MAX_TOPN];
+
+    /// Number of entries in the 'top' list
+    unsigned    m_numTop;
+};
+
+};      // end namespaces
+};
+};
+#endif  // end header latch
@@ -22,6 +22,13 @@
 #include "Fxt/Point/Float.h"
 #include "Fxt/Point/Uint8.h"
 #include "Fxt/Point/Bool.h"
+#include "Fxt/Node/Image.h"
+#include "Fxt/Point/DynamicDatabase.h"
+#include "Fxt/Node/ChassisArena_.h"
+#include "Fxt/System/CacheAlignedAllocator.h"
+#include "Fxt/System/LockedMemory.h"
+#include "Cpl/Checksum/Crc32EthernetFast.h"
+#include "Fxt/System/PerfCounter.h"
 
 #define SECT_   "_0test"
 
@@ -256,6 +263,226 @@ static const char* NODE_DEFINITION = R"literalString(
 }
 )literalString";
 
+// Note: The 'type' key/value pair MUST precede the 'chassis' array when streaming
+static const char* STREAM_NODE_DEFINITION = R"literalString(
+{
+  "name": "My Streamed Kestrel Node",
+  "id": 2,
+  "type": "d65ee614-dce4-43f0-af2c-830e3664ecaf",
+  "chassis": [
+    {
+      "name": "My Chassis",
+      "id": 1,
+      "scanners": [
+        {
+          "name": "My Scanner",
+          "id": 1,
+          "cards": [
+            {
+              "name": "bob",
+              "type": "1968f533-e323-4ae4-8493-9a572f3bd195",
+              "slot": 22,
+              "points": {
+                "inputs": [
+                  {
+                    "channel": 2,
+                    "id": 4,
+                    "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+                    "initial": { "valid": true, "val": 1.2, "id": 6 },
+                    "ioRegId": 5
+                  }
+                ]
+              }
+            }
+          ],
+          "scanRateMultiplier": 1
+        }
+      ],
+      "executionSets": [
+        {
+          "name": "My Execution Set",
+          "id": 1,
+          "logicChains": [
+            {
+              "name": "my logic chain",
+              "id": 1,
+              "components": [
+                {
+                  "id": 101,
+                  "name": "AND Gate#1",
+                  "type": "e62e395c-d27a-4821-bba9-aa1e6de42a05",
+                  "inputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 0 },
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 21 }
+                  ],
+                  "outputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 20 }
+                  ]
+                }
+              ],
+              "connectionPts": [
+                { "id": 20, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0" }
+              ],
+              "autoPts": [
+                { "id": 21, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 22 } }
+              ]
+            }
+          ],
+          "exeRateMultiplier": 1
+        }
+      ],
+      "sharedPts": [
+        { "id": 0, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 1 } }
+      ],
+      "fer": 1000
+    }
+  ]
+}
+)literalString";
+
+// Two chassis with disjoint Point IDs (used for concurrent construction)
+static const char* PARALLEL_NODE_DEFINITION = R"literalString(
+{
+  "name": "My Parallel Kestrel Node",
+  "id": 3,
+  "type": "d65ee614-dce4-43f0-af2c-830e3664ecaf",
+  "chassis": [
+    {
+      "name": "My Chassis",
+      "id": 1,
+      "scanners": [
+        {
+          "name": "My Scanner",
+          "id": 1,
+          "cards": [
+            {
+              "name": "bob",
+              "type": "1968f533-e323-4ae4-8493-9a572f3bd195",
+              "slot": 22,
+              "points": {
+                "inputs": [
+                  {
+                    "channel": 2,
+                    "id": 4,
+                    "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+                    "initial": { "valid": true, "val": 1.2, "id": 6 },
+                    "ioRegId": 5
+                  }
+                ]
+              }
+            }
+          ],
+          "scanRateMultiplier": 1
+        }
+      ],
+      "executionSets": [
+        {
+          "name": "My Execution Set",
+          "id": 1,
+          "logicChains": [
+            {
+              "name": "my logic chain",
+              "id": 1,
+              "components": [
+                {
+                  "id": 101,
+                  "name": "AND Gate#1",
+                  "type": "e62e395c-d27a-4821-bba9-aa1e6de42a05",
+                  "inputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 0 },
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 21 }
+                  ],
+                  "outputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 20 }
+                  ]
+                }
+              ],
+              "connectionPts": [
+                { "id": 20, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0" }
+              ],
+              "autoPts": [
+                { "id": 21, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 22 } }
+              ]
+            }
+          ],
+          "exeRateMultiplier": 1
+        }
+      ],
+      "sharedPts": [
+        { "id": 0, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 1 } }
+      ],
+      "fer": 1000
+    },
+    {
+      "name": "My Second Chassis",
+      "id": 1,
+      "scanners": [
+        {
+          "name": "My Scanner",
+          "id": 1,
+          "cards": [
+            {
+              "name": "bob",
+              "type": "1968f533-e323-4ae4-8493-9a572f3bd195",
+              "slot": 22,
+              "points": {
+                "inputs": [
+                  {
+                    "channel": 2,
+                    "id": 7,
+                    "type": "708745fa-cef6-4364-abad-063a40f35cbc",
+                    "initial": { "valid": true, "val": 2.5, "id": 9 },
+                    "ioRegId": 8
+                  }
+                ]
+              }
+            }
+          ],
+          "scanRateMultiplier": 1
+        }
+      ],
+      "executionSets": [
+        {
+          "name": "My Execution Set",
+          "id": 1,
+          "logicChains": [
+            {
+              "name": "my logic chain",
+              "id": 1,
+              "components": [
+                {
+                  "id": 102,
+                  "name": "AND Gate#1",
+                  "type": "e62e395c-d27a-4821-bba9-aa1e6de42a05",
+                  "inputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 2 },
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 11 }
+                  ],
+                  "outputs": [
+                    { "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "idRef": 10 }
+                  ]
+                }
+              ],
+              "connectionPts": [
+                { "id": 10, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0" }
+              ],
+              "autoPts": [
+                { "id": 11, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 12 } }
+              ]
+            }
+          ],
+          "exeRateMultiplier": 1
+        }
+      ],
+      "sharedPts": [
+        { "id": 2, "type": "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0", "initial": { "val": true, "id": 3 } }
+      ],
+      "fer": 1000
+    }
+  ]
+}
+)literalString";
+
 
 #define FXT_PT_SHARED_1             0
 #define FXT_PT_SHARED_2             2
@@ -273,6 +500,141 @@ static const char* NODE_DEFINITION = R"literalString(
 
 #define MAX_POINTS                  FXT_PT_TOTAL_NUM_PTS
 
+namespace {
+
+/// Input stream that returns a string in small chunks
+class StringInput : public Cpl::Io::Input
+{
+public:
+    StringInput( const char* text, int chunkSize=7 ) :m_text( text ), m_remaining( (int) strlen( text ) ), m_chunkSize( chunkSize ) {}
+
+    bool read( void* buffer, int numBytes, int& bytesRead )
+    {
+        if ( m_remaining == 0 )
+        {
+            return false;
+        }
+        bytesRead = numBytes < m_chunkSize ? numBytes : m_chunkSize;
+        bytesRead = bytesRead < m_remaining ? bytesRead : m_remaining;
+        memcpy( buffer, m_text, bytesRead );
+        m_text      += bytesRead;
+        m_remaining -= bytesRead;
+        return true;
+    }
+    bool available() { return m_remaining > 0; }
+    bool isEos() { return m_remaining == 0; }
+    void close() {}
+
+    const char* m_text;
+    int         m_remaining;
+    int         m_chunkSize;
+};
+
+/// Little-endian writer used to construct a Node Image (i.e. what scripts/foxtail/nodeimage.py generates)
+class ImageWriter
+{
+public:
+    ImageWriter( uint8_t* buffer, size_t maxLen ) :m_buf( buffer ), m_max( maxLen ), m_len( 0 ) {}
+
+    void uint( uint64_t val, size_t numBytes )
+    {
+        for ( size_t i=0; i < numBytes && m_len < m_max; i++ )
+        {
+            m_buf[m_len++] = (uint8_t) (val >> (8 * i));
+        }
+    }
+    void element( uint8_t tag, JsonVariant src )
+    {
+        uint( tag, 1 );
+        size_t len = measureMsgPack( src );
+        uint( len, 4 );
+        m_len += serializeMsgPack( src, (char*) m_buf + m_len, m_max - m_len );
+    }
+
+    uint8_t* m_buf;
+    size_t   m_max;
+    size_t   m_len;
+};
+
+/// Records the differences reported by Fxt::Node::ConfigDigest::diff()
+class DiffRecorder : public Fxt::Node::ConfigDigest::DiffClient
+{
+public:
+    DiffRecorder() :m_numDiffs( 0 ) {}
+
+    void configDifference( Fxt::Node::ConfigDigest::Element_T element, Fxt::Node::ConfigDigest::Change_T change, uint16_t chassisIdx, uint16_t idx, uint16_t chainIdx ) noexcept
+    {
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("diff: element=%d, change=%d, chassis=%u, idx=%u, chain=%u", element, change, chassisIdx, idx, chainIdx) );
+        m_text.formatAppend( "%d%d:%u.%u.%u ", element, change, chassisIdx, idx, chainIdx );
+        m_numDiffs++;
+    }
+
+    Cpl::Text::FString<256> m_text;
+    unsigned                m_numDiffs;
+};
+
+/// Compiles a (name2id'd) Node JSON definition into a Node Image.  Returns the image length
+static size_t buildImage( const char* jsonText, uint8_t* dst, size_t maxLen )
+{
+    DynamicJsonDocument doc( 8192 );
+    REQUIRE( deserializeJson( doc, jsonText, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+
+    ImageWriter out( dst + Fxt::Node::Image::HEADER_SIZE, maxLen - Fxt::Node::Image::HEADER_SIZE );
+    JsonArray   chassisArray = doc["chassis"];
+    char        guid[Fxt::Node::Image::GUID_SIZE] ={ 0, };
+    strncpy( guid, doc["type"], sizeof( guid ) - 1 );
+    out.uint( Fxt::Node::Image::RECORD_NODE, 1 );
+    out.uint( chassisArray.size(), 1 );
+    for ( size_t i=0; i < sizeof( guid ); i++ )
+    {
+        out.uint( guid[i], 1 );
+    }
+    for ( JsonObject chassis : chassisArray )
+    {
+        out.uint( Fxt::Node::Image::RECORD_CHASSIS, 1 );
+        out.uint( chassis["fer"], 8 );
+        out.uint( chassis["scanners"].size(), 2 );
+        out.uint( chassis["executionSets"].size(), 2 );
+        out.uint( chassis["sharedPts"].size(), 2 );
+        for ( JsonObject scanner : chassis["scanners"].as<JsonArray>() )
+        {
+            out.uint( Fxt::Node::Image::RECORD_SCANNER, 1 );
+            out.uint( scanner["scanRateMultiplier"], 4 );
+            out.uint( scanner["cards"].size(), 2 );
+            for ( JsonVariant card : scanner["cards"].as<JsonArray>() )
+            {
+                out.element( Fxt::Node::Image::RECORD_CARD, card );
+            }
+        }
+        for ( JsonObject exeSet : chassis["executionSets"].as<JsonArray>() )
+        {
+            out.uint( Fxt::Node::Image::RECORD_EXESET, 1 );
+            out.uint( exeSet["exeRateMultiplier"], 4 );
+            out.uint( exeSet["logicChains"].size(), 2 );
+            for ( JsonVariant chain : exeSet["logicChains"].as<JsonArray>() )
+            {
+                out.element( Fxt::Node::Image::RECORD_LOGIC_CHAIN, chain );
+            }
+        }
+        for ( JsonVariant pt : chassis["sharedPts"].as<JsonArray>() )
+        {
+            out.element( Fxt::Node::Image::RECORD_SHARED_PT, pt );
+        }
+    }
+
+    Cpl::Checksum::Crc32EthernetFast crc;
+    crc.accumulate( out.m_buf, out.m_len );
+    ImageWriter header( dst, Fxt::Node::Image::HEADER_SIZE );
+    header.uint( Fxt::Node::Image::MAGIC, 4 );
+    header.uint( Fxt::Node::Image::VERSION, 2 );
+    header.uint( Fxt::Node::Image::HEADER_SIZE, 2 );
+    header.uint( out.m_len, 4 );
+    header.uint( crc.finalize(), 4 );
+    return Fxt::Node::Image::HEADER_SIZE + out.m_len;
+}
+
+};
+
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -462,5 +824,703 @@ TEST_CASE( "Node" )
         REQUIRE( boolPointVal == true );
     }
 
+    SECTION( "stream create" )
+    {
+        // The element document only needs to hold the largest card/logic-chain/shared-point
+        StaticJsonDocument<2048> elementDoc;
+        StringInput              fd( STREAM_NODE_DEFINITION );
+        REQUIRE( Api::getNode() == nullptr );
+        Api* uut = uutFactory.createFromStream( fd, elementDoc, pointDb, nodeError );
+
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("node error=%s", nodeError.toText( buf )) );
+        REQUIRE( uut );
+        REQUIRE( nodeError == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( Api::getNode() == uut );
+
+        Fxt::Chassis::Api* chassis = uut->getChassis( 0 );
+        REQUIRE( chassis );
+        REQUIRE( chassis->getFER() == 1000 );
+        REQUIRE( chassis->getNumScanners() == 1 );
+        REQUIRE( chassis->getScanner( 0 )->getNumCards() == 1 );
+        REQUIRE( chassis->getNumExecutionSets() == 1 );
+        REQUIRE( chassis->getExecutionSet( 0 )->getNumLogicChains() == 1 );
+        REQUIRE( chassis->getExecutionSet( 0 )->getLogicChain( 0 )->getNumComponents() == 1 );
+
+        // Run at least one interval
+        uut->start( Fxt::System::ElapsedTime::now() );
+        Cpl::System::Api::sleep( 500 );
+        REQUIRE( uut->isStarted() );
+        uut->stop();
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        float floatPointVal = 0;
+        Fxt::Point::Float* floatPointPtr = (Fxt::Point::Float*) pointDb.lookupById( FXT_PT_MOTOR_TEMPERATURE );
+        REQUIRE( floatPointPtr );
+        REQUIRE( floatPointPtr->read( floatPointVal ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( floatPointVal, 1.2F ) );
+        bool boolPointVal = false;
+        Fxt::Point::Bool* boolPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( FXT_PT_OUTPUT_ANDGATE );
+        REQUIRE( boolPointPtr );
+        REQUIRE( boolPointPtr->read( boolPointVal ) );
+        REQUIRE( boolPointVal == true );
+
+        pointDb.clearPoints();
+        uutFactory.destroy( *uut );
+        REQUIRE( Api::getNode() == nullptr );
+    }
+
+    SECTION( "stream errors" )
+    {
+        // Element document too small
+        {
+            StaticJsonDocument<256> elementDoc;
+            StringInput             fd( STREAM_NODE_DEFINITION );
+            Api* uut = uutFactory.createFromStream( fd, elementDoc, pointDb, nodeError );
+            REQUIRE( uut == nullptr );
+            REQUIRE( nodeError == fullErr( Err_T::FAILED_CREATE_CHASSIS ) );
+            REQUIRE( Api::getNode() == nullptr );
+            pointDb.cleanupPointsAfterNodeCreateFailure();
+        }
+
+        StaticJsonDocument<2048> elementDoc;
+
+        // Truncated input
+        {
+            char truncated[1024];
+            strncpy( truncated, STREAM_NODE_DEFINITION, sizeof( truncated ) );
+            truncated[sizeof( truncated ) - 1] = '\0';
+            StringInput fd( truncated );
+            Api* uut = uutFactory.createFromStream( fd, elementDoc, pointDb, nodeError );
+            REQUIRE( uut == nullptr );
+            REQUIRE( nodeError != Fxt::Type::Error::SUCCESS() );
+            pointDb.cleanupPointsAfterNodeCreateFailure();
+        }
+
+        // Wrong type
+        {
+            StringInput fd( "{ \"type\": \"00000000-dce4-43f0-af2c-830e3664ecaf\", \"chassis\": [] }" );
+            REQUIRE( uutFactory.createFromStream( fd, elementDoc, pointDb, nodeError ) == nullptr );
+            REQUIRE( nodeError == fullErr( Err_T::NOT_ME ) );
+        }
+
+        // Type MUST precede the chassis array
+        {
+            StringInput fd( "{ \"chassis\": [], \"type\": \"d65ee614-dce4-43f0-af2c-830e3664ecaf\" }" );
+            REQUIRE( uutFactory.createFromStream( fd, elementDoc, pointDb, nodeError ) == nullptr );
+            REQUIRE( nodeError == fullErr( Err_T::STREAM_TYPE_NOT_FIRST ) );
+        }
+
+        // No chassis
+        {
+            StringInput fd( "{ \"type\": \"d65ee614-dce4-43f0-af2c-830e3664ecaf\", \"chassis\": [] }" );
+            REQUIRE( uutFactory.createFromStream( fd, elementDoc, pointDb, nodeError ) == nullptr );
+            REQUIRE( nodeError == fullErr( Err_T::PARSE_CHASSIS_ARRAY ) );
+        }
+        REQUIRE( Api::getNode() == nullptr );
+    }
+
+    SECTION( "parallel create" )
+    {
+        // Note: The card stateful heap requires head room for the per-chassis sub-arenas
+        Fxt::Node::Mock::Kestrel::Factory uutFactory2( 20000, 4096, 20000, nullptr, 2 );
+        uutFactory2.enableParallelChassisCreate( true );
+        DynamicJsonDocument doc( 8192 );
+        REQUIRE( deserializeJson( doc, PARALLEL_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+        JsonVariant nodeJson = doc.as<JsonVariant>();
+        REQUIRE( Api::getNode() == nullptr );
+        Api* uut = uutFactory2.createFromJSON( nodeJson, pointDb, nodeError );
+
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("node error=%s", nodeError.toText( buf )) );
+        REQUIRE( uut );
+        REQUIRE( nodeError == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut->getNumChassis() == 2 );
+        REQUIRE( uut->getChassis( 0 )->getScanner( 0 )->getNumCards() == 1 );
+        REQUIRE( uut->getChassis( 1 )->getScanner( 0 )->getNumCards() == 1 );
+        REQUIRE( Fxt::System::AllocTag::getCurrent() == Fxt::System::AllocTag::eNODE );
+
+        // Run at least one interval
+        uut->start( Fxt::System::ElapsedTime::now() );
+        Cpl::System::Api::sleep( 500 );
+        REQUIRE( uut->isStarted() );
+        uut->stop();
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        // The chassis are in JSON order
+        float floatPointVal = 0;
+        Fxt::Point::Float* floatPointPtr = (Fxt::Point::Float*) pointDb.lookupById( FXT_PT_MOTOR_TEMPERATURE );
+        REQUIRE( floatPointPtr );
+        REQUIRE( floatPointPtr->read( floatPointVal ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( floatPointVal, 1.2F ) );
+        floatPointPtr = (Fxt::Point::Float*) pointDb.lookupById( 7 );
+        REQUIRE( floatPointPtr );
+        REQUIRE( floatPointPtr->read( floatPointVal ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( floatPointVal, 2.5F ) );
+        bool boolPointVal = false;
+        Fxt::Point::Bool* boolPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( 10 );
+        REQUIRE( boolPointPtr );
+        REQUIRE( boolPointPtr->read( boolPointVal ) );
+        REQUIRE( boolPointVal == true );
+
+        pointDb.clearPoints();
+        uutFactory2.destroy( *uut );
+        REQUIRE( Api::getNode() == nullptr );
+
+        // Failure in one of the chassis
+        DynamicJsonDocument doc2( 8192 );
+        REQUIRE( deserializeJson( doc2, PARALLEL_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+        doc2["chassis"][1]["scanners"][0]["cards"][0]["type"] = "00000000-e323-4ae4-8493-9a572f3bd195";
+        nodeJson = doc2.as<JsonVariant>();
+        uut = uutFactory2.createFromJSON( nodeJson, pointDb, nodeError );
+        REQUIRE( uut == nullptr );
+        REQUIRE( nodeError == fullErr( Err_T::FAILED_CREATE_CHASSIS ) );
+        REQUIRE( Api::getNode() == nullptr );
+        pointDb.cleanupPointsAfterNodeCreateFailure();
+    }
+
+    SECTION( "parallel create HA layout" )
+    {
+        // Concurrent construction places the HA data at the same offsets as sequential construction (i.e. Primary and Standby layouts match)
+        Fxt::Node::Mock::Kestrel::Factory uutFactory2( 20000, 4096, 20000, nullptr, 2 );
+        size_t   haUsed[2];
+        size_t   numHaPoints[2];
+        intptr_t haOffsets[2][64];
+        for ( int parallel=0; parallel < 2; parallel++ )
+        {
+            uutFactory2.enableParallelChassisCreate( parallel != 0 );
+            DynamicJsonDocument doc( 8192 );
+            REQUIRE( deserializeJson( doc, PARALLEL_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+            JsonVariant nodeJson = doc.as<JsonVariant>();
+            Api* uut = uutFactory2.createFromJSON( nodeJson, pointDb, nodeError );
+            REQUIRE( uut );
+            REQUIRE( nodeError == Fxt::Type::Error::SUCCESS() );
+
+            uint8_t* haStart = uut->getHaStatefulAlloactor().getMemoryStart( haUsed[parallel] );
+            REQUIRE( haStart );
+            numHaPoints[parallel] = 0;
+            for ( uint32_t id=0; id < 64; id++ )
+            {
+                Fxt::Point::Api* ptPtr = pointDb.lookupById( id );
+                uint8_t*         pt    = ptPtr ? (uint8_t*) ptPtr->getStartOfStatefulMemory_() : nullptr;
+                haOffsets[parallel][id] = pt >= haStart && pt < haStart + haUsed[parallel] ? pt - haStart : -1;
+                if ( haOffsets[parallel][id] >= 0 )
+                {
+                    numHaPoints[parallel]++;
+                }
+            }
+
+            pointDb.clearPoints();
+            uutFactory2.destroy( *uut );
+            REQUIRE( Api::getNode() == nullptr );
+        }
+        REQUIRE( numHaPoints[0] > 0 );
+        REQUIRE( haUsed[0] == haUsed[1] );
+        REQUIRE( numHaPoints[0] == numHaPoints[1] );
+        REQUIRE( memcmp( haOffsets[0], haOffsets[1], sizeof( haOffsets[0] ) ) == 0 );
+    }
+
+    SECTION( "cross chassis alias" )
+    {
+        // The second chassis' logic chain consumes the first chassis' (cache line padded) Shared Point via an alias
+        // Note: The alias forces sequential construction, even when concurrent construction is enabled
+        Fxt::Node::Mock::Kestrel::Factory uutFactory2( 20000, 4096, 20000, nullptr, 2 );
+        for ( int i=0; i < 10; i++ )
+        {
+            uutFactory2.enableParallelChassisCreate( i != 0 );
+            DynamicJsonDocument doc( 8192 );
+            REQUIRE( deserializeJson( doc, PARALLEL_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+            JsonObject chain = doc["chassis"][1]["executionSets"][0]["logicChains"][0];
+            JsonObject alias = chain["connectionPts"].as<JsonArray>().createNestedObject();
+            alias["id"]      = 13;
+            alias["type"]    = "f574ca64-b5f2-41ae-bdbf-d7cb7d52aeb0";
+            alias["aliasOf"] = FXT_PT_SHARED_1;
+            chain["components"][0]["inputs"][0]["idRef"] = 13;
+            JsonVariant nodeJson = doc.as<JsonVariant>();
+            Api* uut = uutFactory2.createFromJSON( nodeJson, pointDb, nodeError );
+
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("node error=%s", nodeError.toText( buf )) );
+            REQUIRE( uut );
+            REQUIRE( nodeError == Fxt::Type::Error::SUCCESS() );
+            Fxt::Point::Api* sharedPt = pointDb.lookupById( FXT_PT_SHARED_1 );
+            Fxt::Point::Api* aliasPt  = pointDb.lookupById( 13 );
+            REQUIRE( sharedPt );
+            REQUIRE( aliasPt );
+            REQUIRE( sharedPt->getStatefulMemorySize() != aliasPt->getStatefulMemorySize() );
+            REQUIRE( sharedPt->getStatefulDataSize() == aliasPt->getStatefulDataSize() );
+
+            uut->start( Fxt::System::ElapsedTime::now() );
+            Cpl::System::Api::sleep( 100 );
+            REQUIRE( uut->isStarted() );
+            uut->stop();
+            REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+            bool boolPointVal = false;
+            Fxt::Point::Bool* boolPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( 10 );
+            REQUIRE( boolPointPtr );
+            REQUIRE( boolPointPtr->read( boolPointVal ) );
+            REQUIRE( boolPointVal == true );
+
+            // The alias tracks the producer
+            ((Fxt::Point::Bool*) sharedPt)->write( false );
+            REQUIRE( ((Fxt::Point::Bool*) aliasPt)->read( boolPointVal ) );
+            REQUIRE( boolPointVal == false );
+
+            pointDb.clearPoints();
+            uutFactory2.destroy( *uut );
+            REQUIRE( Api::getNode() == nullptr );
+        }
+    }
+
+    SECTION( "cache aware placement" )
+    {
+        static size_t memory_[4096];
+        Cpl::Memory::LeanHeap heap( memory_, sizeof( memory_ ) );
+
+        // Cache aligned allocations never share a cache line
+        heap.allocate( 1 );
+        Fxt::System::CacheAlignedAllocator aligned( heap );
+        size_t p1 = (size_t) aligned.allocate( 3 );
+        size_t p2 = (size_t) aligned.allocate( OPTION_FXT_SYSTEM_CACHE_LINE_SIZE + 1 );
+        size_t p3 = (size_t) heap.allocate( 1 );
+        REQUIRE( p1 );
+        REQUIRE( p2 );
+        REQUIRE( p1 % OPTION_FXT_SYSTEM_CACHE_LINE_SIZE == 0 );
+        REQUIRE( p2 % OPTION_FXT_SYSTEM_CACHE_LINE_SIZE == 0 );
+        REQUIRE( p2 >= p1 + OPTION_FXT_SYSTEM_CACHE_LINE_SIZE );
+        REQUIRE( p3 >= p2 + 2 * OPTION_FXT_SYSTEM_CACHE_LINE_SIZE );
+        REQUIRE( aligned.allocatedSizeForNBytes( 3 ) == OPTION_FXT_SYSTEM_CACHE_LINE_SIZE );
+
+        // Interleaved sub-arenas never share a page
+        heap.reset();
+        heap.allocate( 1 );
+        Cpl::System::Mutex lock;
+        Fxt::Node::ChassisArena_ arenaA( heap, lock, OPTION_FXT_SYSTEM_PAGE_SIZE );
+        Fxt::Node::ChassisArena_ arenaB( heap, lock, OPTION_FXT_SYSTEM_PAGE_SIZE );
+        size_t a1 = (size_t) arenaA.allocate( 10 );
+        size_t b1 = (size_t) arenaB.allocate( 10 );
+        size_t a2 = (size_t) arenaA.allocate( 10 );
+        REQUIRE( a1 );
+        REQUIRE( b1 );
+        REQUIRE( a1 % OPTION_FXT_SYSTEM_PAGE_SIZE == 0 );
+        REQUIRE( b1 % OPTION_FXT_SYSTEM_PAGE_SIZE == 0 );
+        REQUIRE( a1 / OPTION_FXT_SYSTEM_PAGE_SIZE != b1 / OPTION_FXT_SYSTEM_PAGE_SIZE );
+        REQUIRE( a2 / OPTION_FXT_SYSTEM_PAGE_SIZE == a1 / OPTION_FXT_SYSTEM_PAGE_SIZE );
+
+        // Pinned chassis (sequential and concurrent construction)
+        static const int cores[2] ={ 0, 1 };
+        Fxt::Node::Mock::Kestrel::Factory uutFactory2( 65536, 32768, 65536, nullptr, 2, cores );
+        for ( int parallel=0; parallel < 2; parallel++ )
+        {
+            uutFactory2.enableParallelChassisCreate( parallel != 0 );
+            DynamicJsonDocument doc( 8192 );
+            REQUIRE( deserializeJson( doc, PARALLEL_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+            JsonVariant nodeJson = doc.as<JsonVariant>();
+            Api* uut = uutFactory2.createFromJSON( nodeJson, pointDb, nodeError );
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("parallel=%d, node error=%s", parallel, nodeError.toText( buf )) );
+            REQUIRE( uut );
+            REQUIRE( nodeError == Fxt::Type::Error::SUCCESS() );
+            REQUIRE( uut->getChassisCpuCore( 0 ) == 0 );
+            REQUIRE( uut->getChassisCpuCore( 1 ) == 1 );
+            REQUIRE( uut->getChassisCpuCore( 2 ) == Api::NOT_PINNED );
+
+            uut->start( Fxt::System::ElapsedTime::now() );
+            Cpl::System::Api::sleep( 100 );
+            REQUIRE( uut->isStarted() );
+            uut->stop();
+            REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+            bool boolPointVal = false;
+            Fxt::Point::Bool* boolPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( 10 );
+            REQUIRE( boolPointPtr );
+            REQUIRE( boolPointPtr->read( boolPointVal ) );
+            REQUIRE( boolPointVal == true );
+
+            pointDb.clearPoints();
+            uutFactory2.destroy( *uut );
+            REQUIRE( Api::getNode() == nullptr );
+        }
+    }
+
+    SECTION( "locked heaps" )
+    {
+        Fxt::Node::Mock::Kestrel::Factory lockedFactory( 10000,
+                                                         Fxt::Card::Mock::AnalogIn8::CARD_STATEFUL_HEAP_SIZE + Fxt::Card::Mock::Digital8::CARD_STATEFUL_HEAP_SIZE,
+                                                         10000 );
+        lockedFactory.enableLockedHeaps( true );
+        DynamicJsonDocument doc( 8192 );
+        REQUIRE( deserializeJson( doc, STREAM_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+        JsonVariant nodeJson = doc.as<JsonVariant>();
+        Api* uut = lockedFactory.createFromJSON( nodeJson, pointDb, nodeError );
+        REQUIRE( uut );
+        REQUIRE( nodeError == Fxt::Type::Error::SUCCESS() );
+
+        // Note: Locking can fail because of OS limits (the heap falls back to the platform heap)
+        Fxt::System::LockedMemory probe;
+        bool                      canLock = probe.create( 10000, false );
+        probe.close();
+        for ( int i=0; i < Api::eNUM_HEAPS; i++ )
+        {
+            Fxt::Node::HeapUsage_T usage;
+            REQUIRE( uut->getHeapUsage( (Api::HeapId_T) i, usage ) );
+            CPL_SYSTEM_TRACE_MSG( SECT_, ("heap#%d: locked=%d, hugePages=%d, total=%u", i, usage.locked, usage.hugePages, (unsigned) usage.totalBytes) );
+            REQUIRE( usage.locked == canLock );
+            REQUIRE( usage.numFailures == 0 );
+        }
+
+        uut->start( Fxt::System::ElapsedTime::now() );
+        Cpl::System::Api::sleep( 100 );
+        REQUIRE( uut->isStarted() );
+        uut->stop();
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        pointDb.clearPoints();
+        lockedFactory.destroy( *uut );
+        REQUIRE( Api::getNode() == nullptr );
+    }
+
+    SECTION( "heap accounting" )
+    {
+        DynamicJsonDocument doc( 8192 );
+        REQUIRE( deserializeJson( doc, STREAM_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+        JsonVariant nodeJson = doc.as<JsonVariant>();
+
+        // Dry-run with heaps that are too small
+        Fxt::Node::Mock::Kestrel::Factory tinyFactory( 256, 0, 64 );
+        Fxt::Node::HeapUsage_T            usage[Api::eNUM_HEAPS];
+        size_t                            jsonBytes = 0;
+        nodeError = tinyFactory.measureFromJSON( nodeJson, pointDb, usage, jsonBytes );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("measure: error=%s, general=%u, card=%u, ha=%u, json=%u", nodeError.toText( buf ), (unsigned) usage[0].requiredBytes, (unsigned) usage[1].requiredBytes, (unsigned) usage[2].requiredBytes, (unsigned) jsonBytes) );
+        REQUIRE( nodeError == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( Api::getNode() == nullptr );
+        REQUIRE( jsonBytes > 0 );
+        REQUIRE( usage[Api::eGENERAL_HEAP].requiredBytes > usage[Api::eGENERAL_HEAP].totalBytes );
+        REQUIRE( usage[Api::eGENERAL_HEAP].numFailures == 0 );
+        REQUIRE( usage[Api::eGENERAL_HEAP].bytesByTag[Fxt::System::AllocTag::eNODE] > 0 );
+        REQUIRE( usage[Api::eGENERAL_HEAP].bytesByTag[Fxt::System::AllocTag::ePOINTS] > 0 );
+        REQUIRE( usage[Api::eGENERAL_HEAP].bytesByTag[Fxt::System::AllocTag::eCARDS] > 0 );
+        REQUIRE( usage[Api::eGENERAL_HEAP].bytesByTag[Fxt::System::AllocTag::eCOMPONENTS] > 0 );
+        REQUIRE( usage[Api::eGENERAL_HEAP].bytesByTag[Fxt::System::AllocTag::eLOGIC_CHAINS] > 0 );
+        REQUIRE( usage[Api::eHA_STATEFUL_HEAP].bytesByTag[Fxt::System::AllocTag::ePOINTS] > 0 );
+
+        // The tiny heaps fail
+        REQUIRE( tinyFactory.createFromJSON( nodeJson, pointDb, nodeError ) == nullptr );
+        pointDb.cleanupPointsAfterNodeCreateFailure();
+
+        // Create (and run) a node with exactly sized heaps
+        Fxt::Node::Mock::Kestrel::Factory exactFactory( usage[Api::eGENERAL_HEAP].requiredBytes, usage[Api::eCARD_STATEFUL_HEAP].requiredBytes, usage[Api::eHA_STATEFUL_HEAP].requiredBytes );
+        Api* uut = exactFactory.createFromJSON( nodeJson, pointDb, nodeError );
+        REQUIRE( uut );
+        REQUIRE( nodeError == Fxt::Type::Error::SUCCESS() );
+        uut->start( Fxt::System::ElapsedTime::now() );
+        Cpl::System::Api::sleep( 100 );
+        REQUIRE( uut->isStarted() );
+        uut->stop();
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        for ( int i=0; i < Api::eNUM_HEAPS; i++ )
+        {
+            Fxt::Node::HeapUsage_T live;
+            REQUIRE( uut->getHeapUsage( (Api::HeapId_T) i, live ) );
+            REQUIRE( live.usedBytes == usage[i].requiredBytes );
+            REQUIRE( live.totalBytes == live.usedBytes );
+            REQUIRE( live.highWatermark == live.usedBytes );
+            REQUIRE( live.numFailures == 0 );
+        }
+        Fxt::Node::HeapUsage_T dummy;
+        REQUIRE( uut->getHeapUsage( Api::eNUM_HEAPS, dummy ) == false );
+
+        pointDb.clearPoints();
+        exactFactory.destroy( *uut );
+        REQUIRE( Api::getNode() == nullptr );
+    }
+
+    SECTION( "config digest" )
+    {
+        DynamicJsonDocument doc( 8192 );
+        REQUIRE( deserializeJson( doc, STREAM_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+        JsonVariant nodeJson = doc.as<JsonVariant>();
+        Api* uut = uutFactory.createFromJSON( nodeJson, pointDb, nodeError );
+        REQUIRE( uut );
+        REQUIRE( uut->getConfigDigest() );
+        Cpl::Text::FString<64> hashText;
+        uut->getConfigDigest()->getHashText( hashText );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("digest=%s", hashText.getString()) );
+        REQUIRE( hashText.length() == 32 );
+
+        // Same definition
+        DiffRecorder diffs;
+        REQUIRE( uutFactory.compareToJSON( nodeJson, *uut, &diffs ) );
+        REQUIRE( diffs.m_numDiffs == 0 );
+
+        // Same content, different key order/formatting
+        DynamicJsonDocument doc2( 8192 );
+        doc2["chassis"] = doc["chassis"];
+        doc2["type"]    = doc["type"];
+        doc2["id"]      = doc["id"];
+        doc2["name"]    = doc["name"];
+        JsonVariant nodeJson2 = doc2.as<JsonVariant>();
+        REQUIRE( uutFactory.compareToJSON( nodeJson2, *uut, &diffs ) );
+        REQUIRE( diffs.m_numDiffs == 0 );
+        Fxt::Node::ConfigDigest* reordered = Fxt::Node::ConfigDigest::create( nodeJson2 );
+        REQUIRE( reordered );
+        REQUIRE( reordered->isSame( *uut->getConfigDigest() ) );
+        REQUIRE( uut->getConfigDigest()->diff( *reordered ) == 0 );
+        delete reordered;
+
+        // Changed: scanner, logic chain, chassis field, and an added execution set
+        doc2["chassis"][0]["scanners"][0]["scanRateMultiplier"]                          = 2;
+        doc2["chassis"][0]["executionSets"][0]["logicChains"][0]["components"][0]["id"] = 102;
+        doc2["chassis"][0]["fer"]                                                          = 2000;
+        doc2["chassis"][0]["executionSets"].add( doc["chassis"][0]["executionSets"][0] );
+        REQUIRE( uutFactory.compareToJSON( nodeJson2, *uut, &diffs ) == false );
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("diffs=[%s]", diffs.m_text.getString()) );
+        REQUIRE( diffs.m_numDiffs == 4 );
+        REQUIRE( diffs.m_text == "10:0.0.0 20:0.0.0 40:0.0.0 31:0.1.0 " );
+
+        // Changed: Node name only
+        diffs.m_text.clear();
+        diffs.m_numDiffs = 0;
+        doc["name"] = "bob";
+        REQUIRE( uutFactory.compareToJSON( nodeJson, *uut, &diffs ) == false );
+        REQUIRE( diffs.m_text == "00:0.0.0 " );
+
+        pointDb.clearPoints();
+        uutFactory.destroy( *uut );
+
+        // No digest when created from a stream
+        StaticJsonDocument<2048> elementDoc;
+        StringInput              fd( STREAM_NODE_DEFINITION );
+        uut = uutFactory.createFromStream( fd, elementDoc, pointDb, nodeError );
+        REQUIRE( uut );
+        REQUIRE( uut->getConfigDigest() == nullptr );
+        REQUIRE( uutFactory.compareToJSON( nodeJson, *uut ) == false );
+        pointDb.clearPoints();
+        uutFactory.destroy( *uut );
+        REQUIRE( Api::getNode() == nullptr );
+    }
+
+    SECTION( "multiple nodes" )
+    {
+        constexpr unsigned NUM_NODES = 4;
+        DynamicJsonDocument doc( 8192 );
+        REQUIRE( deserializeJson( doc, STREAM_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+        JsonVariant nodeJson = doc.as<JsonVariant>();
+
+        // One factory, one Point Database per Node
+        Fxt::Point::DynamicDatabase* dbs[NUM_NODES];
+        Api*                         nodes[NUM_NODES];
+        for ( unsigned i=0; i < NUM_NODES; i++ )
+        {
+            dbs[i]   = new Fxt::Point::DynamicDatabase( MAX_POINTS );
+            REQUIRE( dbs[i]->getMaxNumPoints() == MAX_POINTS );
+            nodes[i] = uutFactory.createFromJSON( nodeJson, *(dbs[i]), nodeError );
+            REQUIRE( nodes[i] );
+            REQUIRE( Api::getNode() == nodes[i] );
+            REQUIRE( Api::getNumNodes() == i + 1 );
+        }
+        REQUIRE( Api::getNode( 0 ) == nodes[0] );
+        REQUIRE( Api::getNode( NUM_NODES - 1 ) == nodes[NUM_NODES - 1] );
+        REQUIRE( Api::getNode( NUM_NODES ) == nullptr );
+
+        // A dry-run does not change the list of Nodes
+        Fxt::Point::DynamicDatabase scratchDb( MAX_POINTS );
+        Fxt::Node::HeapUsage_T      usage[Api::eNUM_HEAPS];
+        size_t                      jsonBytes;
+        REQUIRE( uutFactory.measureFromJSON( nodeJson, scratchDb, usage, jsonBytes ) == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( Api::getNumNodes() == NUM_NODES );
+        REQUIRE( Api::getNode() == nodes[NUM_NODES - 1] );
+
+        // Run all of the Nodes concurrently.  Each Node has its own Points
+        for ( unsigned i=0; i < NUM_NODES; i++ )
+        {
+            REQUIRE( nodes[i]->start( Fxt::System::ElapsedTime::now() ) );
+        }
+        Cpl::System::Api::sleep( 200 );
+        for ( unsigned i=0; i < NUM_NODES; i++ )
+        {
+            REQUIRE( nodes[i]->isStarted() );
+            Fxt::Point::Bool* pt = (Fxt::Point::Bool*) dbs[i]->lookupById( FXT_PT_OUTPUT_ANDGATE );
+            REQUIRE( pt );
+            bool val = false;
+            REQUIRE( pt->read( val ) );
+            REQUIRE( val == true );
+            for ( unsigned j=0; j < i; j++ )
+            {
+                REQUIRE( pt != dbs[j]->lookupById( FXT_PT_OUTPUT_ANDGATE ) );
+                REQUIRE( nodes[i]->getChassis( 0 ) != nodes[j]->getChassis( 0 ) );
+            }
+        }
+        for ( unsigned i=0; i < NUM_NODES; i++ )
+        {
+            nodes[i]->stop();
+        }
+
+        // Destroy a Node in the 'middle' of the list
+        dbs[1]->clearPoints();
+        uutFactory.destroy( *nodes[1] );
+        REQUIRE( Api::getNumNodes() == NUM_NODES - 1 );
+        REQUIRE( Api::getNode( 1 ) == nodes[2] );
+        REQUIRE( Api::getNode() == nodes[NUM_NODES - 1] );
+
+        // Destroy the 'current' Node
+        dbs[NUM_NODES - 1]->clearPoints();
+        uutFactory.destroy( *nodes[NUM_NODES - 1] );
+        REQUIRE( Api::getNode() == nodes[NUM_NODES - 2] );
+
+        for ( unsigned i=0; i < NUM_NODES; i++ )
+        {
+            if ( i != 1 && i != NUM_NODES - 1 )
+            {
+                dbs[i]->clearPoints();
+                uutFactory.destroy( *nodes[i] );
+            }
+            delete dbs[i];
+        }
+        REQUIRE( Api::getNumNodes() == 0 );
+        REQUIRE( Api::getNode() == nullptr );
+    }
+
+    SECTION( "image create" )
+    {
+        // The element document only needs to hold the largest card/logic-chain/shared-point
+        StaticJsonDocument<2048> elementDoc;
+        static uint8_t           image[2048];
+        size_t                   imageLen = buildImage( STREAM_NODE_DEFINITION, image, sizeof( image ) );
+        REQUIRE( imageLen < sizeof( image ) );
+        REQUIRE( Api::getNode() == nullptr );
+        Api* uut = uutFactory.createFromImage( image, imageLen, elementDoc, pointDb, nodeError );
+
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("node error=%s, imageLen=%u", nodeError.toText( buf ), (unsigned) imageLen) );
+        REQUIRE( uut );
+        REQUIRE( nodeError == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+        REQUIRE( Api::getNode() == uut );
+
+        Fxt::Chassis::Api* chassis = uut->getChassis( 0 );
+        REQUIRE( chassis );
+        REQUIRE( chassis->getFER() == 1000 );
+        REQUIRE( chassis->getNumScanners() == 1 );
+        REQUIRE( chassis->getScanner( 0 )->getNumCards() == 1 );
+        REQUIRE( chassis->getNumExecutionSets() == 1 );
+        REQUIRE( chassis->getExecutionSet( 0 )->getNumLogicChains() == 1 );
+
+        // Run at least one interval
+        uut->start( Fxt::System::ElapsedTime::now() );
+        Cpl::System::Api::sleep( 500 );
+        REQUIRE( uut->isStarted() );
+        uut->stop();
+        REQUIRE( uut->getErrorCode() == Fxt::Type::Error::SUCCESS() );
+
+        float floatPointVal = 0;
+        Fxt::Point::Float* floatPointPtr = (Fxt::Point::Float*) pointDb.lookupById( FXT_PT_MOTOR_TEMPERATURE );
+        REQUIRE( floatPointPtr );
+        REQUIRE( floatPointPtr->read( floatPointVal ) );
+        REQUIRE( Cpl::Math::areFloatsEqual( floatPointVal, 1.2F ) );
+        bool boolPointVal = false;
+        Fxt::Point::Bool* boolPointPtr = (Fxt::Point::Bool*) pointDb.lookupById( FXT_PT_OUTPUT_ANDGATE );
+        REQUIRE( boolPointPtr );
+        REQUIRE( boolPointPtr->read( boolPointVal ) );
+        REQUIRE( boolPointVal == true );
+
+        pointDb.clearPoints();
+        uutFactory.destroy( *uut );
+        REQUIRE( Api::getNode() == nullptr );
+    }
+
+    SECTION( "cold start" )
+    {
+        // Create time of the same Node definition from: JSON text, a JSON stream, and a Node Image
+        static constexpr unsigned NUM_CREATES = 5;
+        StaticJsonDocument<10240> doc;
+        StaticJsonDocument<2048>  elementDoc;
+        static uint8_t            image[2048];
+        size_t                    imageLen   = buildImage( STREAM_NODE_DEFINITION, image, sizeof( image ) );
+        uint64_t                  parseNsec  = 0;
+        uint64_t                  jsonNsec   = 0;
+        uint64_t                  streamNsec = 0;
+        uint64_t                  imageNsec  = 0;
+        uint32_t                  minImage   = UINT32_MAX;
+        for ( unsigned i=0; i < NUM_CREATES; i++ )
+        {
+            uint32_t start = Fxt::System::PerfCounter::now();
+            REQUIRE( deserializeJson( doc, STREAM_NODE_DEFINITION, DeserializationOption::NestingLimit( 20 ) ) == DeserializationError::Ok );
+            parseNsec += Fxt::System::PerfCounter::delta( start );
+            JsonVariant nodeJson = doc.as<JsonVariant>();
+            Api*        uut      = uutFactory.createFromJSON( nodeJson, pointDb, nodeError );
+            jsonNsec += Fxt::System::PerfCounter::delta( start );
+            REQUIRE( uut );
+            pointDb.clearPoints();
+            uutFactory.destroy( *uut );
+
+            StringInput fd( STREAM_NODE_DEFINITION );
+            start       = Fxt::System::PerfCounter::now();
+            uut         = uutFactory.createFromStream( fd, elementDoc, pointDb, nodeError );
+            streamNsec += Fxt::System::PerfCounter::delta( start );
+            REQUIRE( uut );
+            pointDb.clearPoints();
+            uutFactory.destroy( *uut );
+
+            start      = Fxt::System::PerfCounter::now();
+            uut        = uutFactory.createFromImage( image, imageLen, elementDoc, pointDb, nodeError );
+            uint32_t t = Fxt::System::PerfCounter::delta( start );
+            imageNsec += t;
+            minImage   = t < minImage ? t : minImage;
+            REQUIRE( uut );
+            pointDb.clearPoints();
+            uutFactory.destroy( *uut );
+        }
+        CPL_SYSTEM_TRACE_MSG( SECT_, ("Cold start (usec per create): parse=%lu, json=%lu, stream=%lu, image=%lu",
+                                       (unsigned long) (parseNsec / 1000 / NUM_CREATES),
+                                       (unsigned long) (jsonNsec / 1000 / NUM_CREATES),
+                                       (unsigned long) (streamNsec / 1000 / NUM_CREATES),
+                                       (unsigned long) (imageNsec / 1000 / NUM_CREATES)) );
+
+        // Waiting for the Chassis thread to start must NOT always cost a scheduler tick (i.e. a 1ms sleep) per Chassis
+        REQUIRE( minImage < 1000000 );
+    }
+
+    SECTION( "image errors" )
+    {
+        StaticJsonDocument<2048> elementDoc;
+        static uint8_t           image[2048];
+        size_t                   imageLen = buildImage( STREAM_NODE_DEFINITION, image, sizeof( image ) );
+
+        // Bad header
+        REQUIRE( uutFactory.createFromImage( image, Fxt::Node::Image::HEADER_SIZE - 1, elementDoc, pointDb, nodeError ) == nullptr );
+        REQUIRE( nodeError == fullErr( Err_T::IMAGE_INVALID_HEADER ) );
+        REQUIRE( uutFactory.createFromImage( image, imageLen - 1, elementDoc, pointDb, nodeError ) == nullptr );
+        REQUIRE( nodeError == fullErr( Err_T::IMAGE_INVALID_HEADER ) );
+        image[0] ^= 0xFF;
+        REQUIRE( uutFactory.createFromImage( image, imageLen, elementDoc, pointDb, nodeError ) == nullptr );
+        REQUIRE( nodeError == fullErr( Err_T::IMAGE_INVALID_HEADER ) );
+        image[0] ^= 0xFF;
+
+        // Corrupted payload
+        image[imageLen - 1] ^= 0x01;
+        REQUIRE( uutFactory.createFromImage( image, imageLen, elementDoc, pointDb, nodeError ) == nullptr );
+        REQUIRE( nodeError == fullErr( Err_T::IMAGE_CRC_ERROR ) );
+        image[imageLen - 1] ^= 0x01;
+
+        // Wrong type
+        image[Fxt::Node::Image::HEADER_SIZE + 2] = '0';
+        Cpl::Checksum::Crc32EthernetFast crc;
+        crc.accumulate( image + Fxt::Node::Image::HEADER_SIZE, imageLen - Fxt::Node::Image::HEADER_SIZE );
+        uint32_t newCrc = crc.finalize();
+        for ( int i=0; i < 4; i++ )
+        {
+            image[12 + i] = (uint8_t) (newCrc >> (8 * i));
+        }
+        REQUIRE( uutFactory.createFromImage( image, imageLen, elementDoc, pointDb, nodeError ) == nullptr );
+        REQUIRE( nodeError == fullErr( Err_T::NOT_ME ) );
+
+        // Element document too small
+        {
+            StaticJsonDocument<128> smallDoc;
+            imageLen = buildImage( STREAM_NODE_DEFINITION, image, sizeof( image ) );
+            REQUIRE( uutFactory.createFromImage( image, imageLen, smallDoc, pointDb, nodeError ) == nullptr );
+            REQUIRE( nodeError == fullErr( Err_T::IMAGE_ELEMENT_ERROR ) );
+            pointDb.cleanupPointsAfterNodeCreateFailure();
+        }
+        REQUIRE( Api::getNode() == nullptr );
+    }
+
     REQUIRE( Cpl::System::Shutdown_TS::getAndClearCounter() == 0u );
 }
\ No newline at end of file
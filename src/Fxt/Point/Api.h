@@ -87,6 +87,14 @@ public:
      */
     virtual size_t getStatefulMemorySize() const noexcept = 0;
 
+    /** This method returns the size, in bytes, of the Point's data and its
+        dynamic meta-data as requested by the Point, i.e. NOT rounded up (or
+        padded) by the allocator that the stateful memory was allocated from.
+        Two Points with the same type have the same stateful data size
+        regardless of the allocator used.
+     */
+    virtual size_t getStatefulDataSize() const noexcept = 0;
+
     /** This method returns true if the specified point is the same type as the
         instance.
      */
@@ -99,6 +107,11 @@ public:
     /// This method returns true if the Point has a valid 'Setter'
     virtual bool hasSetter() const noexcept = 0;
 
+    /** This method returns true if the Point is an 'alias' of another point,
+        i.e. it does not have its own stateful data (see aliasTo_()).
+     */
+    virtual bool isAlias() const noexcept = 0;
+
     /** This method updates the Point values/state from its 'Setter'.  If the
         point does not have a 'Setter' then this operation does nothing.
      */
@@ -305,6 +318,27 @@ public:
     */
     virtual size_t getDataSize_() noexcept = 0;
 
+    /** This method has PACKAGE Scope, i.e. it is intended to be ONLY accessible
+        by other classes in the Fxt::Point namespace (and the Logic Chain
+        when creating Connector Points).  The Application should NEVER call
+        this method.
+
+        This method converts the Point to an 'alias' of 'producerPoint', i.e.
+        the Point stops using its own stateful data and reads/writes the
+        stateful data of 'producerPoint'. The Point's existing stateful memory
+        is abandoned (it is the caller's responsibility to have allocated it
+        from a scratch allocator). The producer's current value/state is NOT
+        modified.
+
+        The method returns false if the two Points are not the same type or
+        their stateful data sizes are different.  When false is returned the
+        Point is left in a non-functional state, i.e. always invalid.
+
+        This method is NOT Thread Safe and MUST only be called while the Point's
+        containing Node is being created.
+     */
+    virtual bool aliasTo_( Api& producerPoint ) noexcept = 0;
+
 public:
     /// Virtual destructor to make the compiler happy
     virtual ~Api() {}
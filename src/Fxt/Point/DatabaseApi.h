@@ -143,7 +143,10 @@ public:
         If the new instance's "point-id" already exists in the database false
         is returned; else true is returned.
 
-        This method is can ONLY be called from a "Point Thread" 
+        This method is can ONLY be called from a "Point Thread".  The exception
+        is during Node construction, where the method can be called concurrently
+        from multiple threads - as long as the threads add Points with
+        disjoint "point-ids" (see Fxt::Node::FactoryCommon_::enableParallelChassisCreate()).
      */
     virtual bool add( Api& pointInstanceToAdd ) noexcept = 0;
 
@@ -0,0 +1,245 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "DatabaseCommon_.h"
+
+///
+using namespace Fxt::Point;
+
+Cpl::System::Mutex                                              DatabaseCommon_::g_globalMutex;
+StaticJsonDocument<OPTION_FXT_POINT_DATABASE_MAX_CAPACITY_JSON> DatabaseCommon_::g_doc_;
+uint8_t                                                         DatabaseCommon_::g_tempBuffer_[OPTION_FXT_POINT_DATABASE_TEMP_STORAGE_SIZE];
+
+
+//////////////////////////////////////////////////
+DatabaseCommon_::DatabaseCommon_( Fxt::Point::Api** pointTable, size_t maxPoints ) noexcept
+    : m_points( pointTable )
+    , m_maxPoints( maxPoints )
+{
+}
+
+Fxt::Point::Api* DatabaseCommon_::lookupById( uint32_t pointIdToFind ) const noexcept
+{
+    if ( pointIdToFind >= m_maxPoints )
+    {
+        return nullptr;
+    }
+    return m_points[pointIdToFind];
+}
+
+size_t DatabaseCommon_::getMaxNumPoints() const noexcept
+{
+    return m_maxPoints;
+}
+
+bool DatabaseCommon_::add( Api& pointToAdd ) noexcept
+{
+    // Prevent duplicate and out-of-range IDs.  Note: No locking is required for concurrent adds with disjoint IDs (each ID owns its own slot)
+    uint32_t id = pointToAdd.getId();
+    if ( id >= m_maxPoints || m_points[id] != 0 )
+    {
+        return false;
+
+    }
+    m_points[id] = &pointToAdd;
+    return true;
+}
+
+void DatabaseCommon_::clearPoints() noexcept
+{
+    // Walk all possible points
+    for ( size_t i=0; i < m_maxPoints; i++ )
+    {
+        // Call the Point's destructor and then remove the point from the DB
+        if ( m_points[i] != nullptr )
+        {
+            m_points[i]->~Api();
+            m_points[i] = nullptr;
+        }
+    }
+}
+
+void DatabaseCommon_::cleanupPointsAfterNodeCreateFailure() noexcept
+{
+    // Walk all possible points
+    for ( size_t i=0; i < m_maxPoints; i++ )
+    {
+        // Because the state of the Node/Point is unknown -->skip calling the point destructor
+        if ( m_points[i] != nullptr )
+        {
+            m_points[i] = nullptr;
+        }
+    }
+}
+
+void DatabaseCommon_::globalLock_() noexcept
+{
+    g_globalMutex.lock();
+}
+
+void DatabaseCommon_::globalUnlock_() noexcept
+{
+    g_globalMutex.unlock();
+}
+
+//////////////////////////////////////////////////
+bool DatabaseCommon_::toJSON( uint32_t         pointId,
+                              char*            dst,
+                              size_t           dstSize,
+                              bool&            truncated,
+                              bool             verbose,
+                              bool             pretty ) noexcept
+{
+    // Get the point instance
+    Api* point = lookupById( pointId );
+    if ( point == nullptr )
+    {
+        return false;
+    }
+
+    // Get the metadata
+    bool isValid;
+    bool isLocked;
+    point->getMetadata( isValid, isLocked );
+
+    // Get access to the Global JSON document
+    globalLock_();
+    g_doc_.clear();  // Make sure the JSON document is starting "empty"
+
+    // Construct the JSON
+    g_doc_["id"]    = point->getId();
+    g_doc_["valid"] = isValid;
+    if ( verbose )
+    {
+        g_doc_["type"]   = point->getTypeName();
+        g_doc_["locked"] = isLocked;
+    }
+
+    // Have the Point instance fill in the 'val' details
+    bool result = true;
+    if ( isValid && !point->toJSON_( g_doc_, verbose ) )
+    {
+        result = false;
+    }
+
+    // Generate the actual output string
+    if ( result )
+    {
+        size_t jsonLen;
+        size_t outputLen;
+        if ( !pretty )
+        {
+            jsonLen   = measureJson( g_doc_ );
+            outputLen = serializeJson( g_doc_, dst, dstSize );
+        }
+        else
+        {
+            jsonLen   = measureJsonPretty( g_doc_ );
+            outputLen = serializeJsonPretty( g_doc_, dst, dstSize );
+        }
+        truncated = outputLen == jsonLen ? false : true;
+    }
+
+    // Release the Global JSON document
+    globalUnlock_();
+    return result;
+}
+
+bool DatabaseCommon_::fromJSON( const char* src, Cpl::Text::String* errorMsg ) noexcept
+{
+    // Get access to the Global JSON document
+    globalLock_();
+
+    // Parse the JSON payload...
+    DeserializationError err = deserializeJson( g_doc_, src );
+    if ( err )
+    {
+        if ( errorMsg )
+        {
+            *errorMsg = err.c_str();
+        }
+        globalUnlock_();
+        return false;
+    }
+
+    // Valid JSON... Parse the Point identifier
+    if ( g_doc_["id"].isNull() )
+    {
+        if ( errorMsg )
+        {
+            *errorMsg = "No valid 'id' key in the JSON input.";
+        }
+        globalUnlock_();
+        return false;
+    }
+    uint32_t numericId = g_doc_["id"];
+
+    // Look-up the Point name
+    Api* pt = lookupById( numericId );
+    if ( pt == nullptr )
+    {
+        if ( errorMsg )
+        {
+            errorMsg->format( "Point ID (%u) NOT found.", numericId );
+        }
+        globalUnlock_();
+        return false;
+    }
+
+    // Attempt to parse the key/value pairs of interest
+    JsonVariant validKey = g_doc_["valid"];
+    JsonVariant locked   = g_doc_["locked"];
+    JsonVariant valElem  = g_doc_["val"];
+    Api::LockRequest_T lockAction = Api::eNO_REQUEST;
+    if ( locked.isNull() == false )
+    {
+        lockAction = locked.as<bool>() ? Api::eLOCK : Api::eUNLOCK;
+    }
+
+    // Request to invalidate the MP
+    if ( validKey.isNull() == false && validKey.as<bool>() == false )
+    {
+        pt->setInvalid( lockAction );
+    }
+
+    // Write a valid value to the MP
+    else if ( valElem.isNull() == false )
+    {
+        if ( pt->fromJSON_( valElem, lockAction, errorMsg ) == false )
+        {
+            globalUnlock_();
+            return false;
+        }
+    }
+
+    // Just lock/unlock the MP
+    else if ( locked.isNull() == false )
+    {
+        pt->setLockState( lockAction );
+    }
+
+    // Bad Syntax
+    else
+    {
+        if ( errorMsg )
+        {
+            *errorMsg = "JSON syntax is not valid or invalid payload semantics";
+        }
+        globalUnlock_();
+        return false;
+    }
+
+    // Release the Global JSON document
+    globalUnlock_();
+    return true;
+}
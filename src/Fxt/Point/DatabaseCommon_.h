@@ -0,0 +1,145 @@
+#ifndef Fxt_Point_DatabaseCommon_h_
+#define Fxt_Point_DatabaseCommon_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "colony_config.h"
+#include "Fxt/Point/DatabaseApi.h"
+#include "Cpl/Json/Arduino.h"
+#include "Cpl/System/Mutex.h"
+
+
+/** This symbol defines the size, in bytes, of a single/global JSON document
+    buffer that is used for the toJSON() and fromJSON() operations. Only one
+    instance of this buffer is allocated.
+*/
+#ifndef OPTION_FXT_POINT_DATABASE_MAX_CAPACITY_JSON
+#define OPTION_FXT_POINT_DATABASE_MAX_CAPACITY_JSON          (1024*2)
+#endif
+
+/** This symbol defines the size, in bytes, of temporary storage allocated for
+    use by the fromJSON_() method (e.g. create a temporary array instance)
+ */
+#ifndef OPTION_FXT_POINT_DATABASE_TEMP_STORAGE_SIZE
+#define OPTION_FXT_POINT_DATABASE_TEMP_STORAGE_SIZE         (1024*2)
+#endif
+
+
+///
+namespace Fxt {
+///
+namespace Point {
+
+
+/** This partially concrete class implements the Point Database operations
+    for a table of Points.  The memory for the table is provided by the child
+    class.  The global JSON document, temporary buffer, and global lock are
+    shared by ALL Point Database instances (i.e. by all Nodes in a process).
+  */
+class DatabaseCommon_ : public DatabaseApi
+{
+protected:
+    /** Constructor.  'pointTable' is an array of 'maxPoints' elements.  The
+        array is NOT zeroed by the constructor, i.e. the child class is
+        responsible for initializing the array.
+     */
+    DatabaseCommon_( Fxt::Point::Api** pointTable, size_t maxPoints ) noexcept;
+
+public:
+    /// See Fxt::Point::DatabaseApi
+    Fxt::Point::Api* lookupById( uint32_t pointIdToFind ) const noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    size_t getMaxNumPoints() const noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    bool toJSON( uint32_t         pointId,
+                 char*            dst,
+                 size_t           dstSize,
+                 bool&            truncated,
+                 bool             verbose = true,
+                 bool             pretty  = true ) noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    bool fromJSON( const char* src, Cpl::Text::String* errorMsg=0 ) noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    bool add( Api& pointInstanceToAdd ) noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    void clearPoints() noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    void cleanupPointsAfterNodeCreateFailure() noexcept;
+
+public:
+    /** This method has 'PACKAGE Scope' in that is should only be called by
+        other classes in the Cpl::Point namespace.  It is ONLY public to avoid
+        the tight coupling of C++ friend mechanism.
+
+        This method provides a single global lock for ALL Point Database
+        instances. The method is used to protect global Point Database (e.g.
+        the global parse buffer).
+
+        This method locks the global Point Database lock. For every call to
+        globalLock_() there must be corresponding call to globalUnlock_();
+    */
+    static void globalLock_() noexcept;
+
+    /** This method has 'PACKAGE Scope' in that is should only be called by
+        other classes in the Cpl::Point namespace.  It is ONLY public to avoid
+        the tight coupling of C++ friend mechanism.
+
+        This method unlocks the global Point Database lock
+    */
+    static void globalUnlock_() noexcept;
+
+    /** This variable has 'PACKAGE Scope' in that is should only be called by
+        other classes in the Cpl::Point namespace.  It is ONLY public to avoid
+        the tight coupling of C++ friend mechanism.
+
+        Global/single instance of a JSON document. Model Point's need to have
+        acquired the global lock before using this buffer
+     */
+    static StaticJsonDocument<OPTION_FXT_POINT_DATABASE_MAX_CAPACITY_JSON> g_doc_;
+
+    /** This variable has 'PACKAGE Scope' in that is should only be called by
+        other classes in the Cpl::Point namespace.  It is ONLY public to avoid
+        the tight coupling of C++ friend mechanism.
+
+        Global temporary buffer. Model Point's need to have acquired the global
+        lock before using this buffer
+     */
+    static uint8_t   g_tempBuffer_[OPTION_FXT_POINT_DATABASE_TEMP_STORAGE_SIZE];
+
+private:
+    /// Prevent access to the copy constructor -->Point Databases can not be copied!
+    DatabaseCommon_( const DatabaseCommon_& m );
+
+    /// Prevent access to the assignment operator -->Point Databases can not be copied!
+    const DatabaseCommon_& operator=( const DatabaseCommon_& m );
+
+protected:
+    /// Point table.  Note: A Point ID is its index into m_points.
+    Fxt::Point::Api**           m_points;
+
+    /// Number of elements in the Point table
+    size_t                      m_maxPoints;
+
+    /// Mutex for the global lock
+    static Cpl::System::Mutex   g_globalMutex;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
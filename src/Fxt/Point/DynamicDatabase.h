@@ -0,0 +1,57 @@
+#ifndef Fxt_Point_DynamicDatabase_h_
+#define Fxt_Point_DynamicDatabase_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Point/DatabaseCommon_.h"
+#include <new>
+
+
+///
+namespace Fxt {
+///
+namespace Point {
+
+
+/** This concrete class implements a Point Database whose Point table is
+    sized - and allocated from the platform heap - at run time.  This allows
+    an application to create Nodes of different sizes (e.g. many simulated
+    Nodes in a single process) without a separate Database<N> template
+    instance per size.
+
+    If the Point table can not be allocated, the Database has a capacity of
+    zero, i.e. all add() operations fail.
+  */
+class DynamicDatabase : public DatabaseCommon_
+{
+public:
+    /// Constructor.  Use this constructor when creating the instance AFTER main() executes
+    DynamicDatabase( size_t maxNumPoints ) noexcept
+        : DatabaseCommon_( new(std::nothrow) Fxt::Point::Api*[maxNumPoints](), maxNumPoints )
+    {
+        if ( m_points == nullptr )
+        {
+            m_maxPoints = 0;
+        }
+    }
+
+    /// Destructor.  Note: The Database does NOT own its Points, i.e. the application must call clearPoints() before destroying the Database
+    ~DynamicDatabase()
+    {
+        delete[] m_points;
+    }
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -13,6 +13,7 @@
 
 #include "FactoryDatabase.h"
 #include "Error.h"
+#include "Fxt/System/AllocTag.h"
 #include "Cpl/System/Assert.h"
 
 ///
@@ -55,6 +56,8 @@ Api* FactoryDatabase::createPointfromJSON( JsonObject&                        po
         return nullptr;
     }
 
+    // Charge the memory allocations to the sub-system
+    Fxt::System::AllocTag::ScopeBlock allocTag( Fxt::System::AllocTag::ePOINTS );
     return factory->create( pointObject, pointErrorCode, generalAllocator, statefulDataAllocator, dbForPoints, pointIdKeyName, createSetter );
 }
 
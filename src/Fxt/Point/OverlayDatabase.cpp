@@ -0,0 +1,71 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "OverlayDatabase.h"
+
+///
+using namespace Fxt::Point;
+
+//////////////////////////////////////////////////
+OverlayDatabase::OverlayDatabase( DatabaseApi& stagingDb, DatabaseApi& baseDb ) noexcept
+    : m_staging( stagingDb )
+    , m_base( baseDb )
+{
+}
+
+//////////////////////////////////////////////////
+Fxt::Point::Api* OverlayDatabase::lookupById( uint32_t pointIdToFind ) const noexcept
+{
+    Api* pt = m_staging.lookupById( pointIdToFind );
+    return pt ? pt : m_base.lookupById( pointIdToFind );
+}
+
+size_t OverlayDatabase::getMaxNumPoints() const noexcept
+{
+    return m_staging.getMaxNumPoints();
+}
+
+bool OverlayDatabase::toJSON( uint32_t         pointId,
+                              char*            dst,
+                              size_t           dstSize,
+                              bool&            truncated,
+                              bool             verbose,
+                              bool             pretty ) noexcept
+{
+    if ( m_staging.lookupById( pointId ) )
+    {
+        return m_staging.toJSON( pointId, dst, dstSize, truncated, verbose, pretty );
+    }
+    return m_base.toJSON( pointId, dst, dstSize, truncated, verbose, pretty );
+}
+
+bool OverlayDatabase::fromJSON( const char* src, Cpl::Text::String* errorMsg ) noexcept
+{
+    // Note: A failure from the staging database (e.g. ID not found) falls through to the base database
+    return m_staging.fromJSON( src, errorMsg ) || m_base.fromJSON( src, errorMsg );
+}
+
+bool OverlayDatabase::add( Api& pointInstanceToAdd ) noexcept
+{
+    return m_staging.add( pointInstanceToAdd );
+}
+
+void OverlayDatabase::clearPoints() noexcept
+{
+    m_staging.clearPoints();
+}
+
+void OverlayDatabase::cleanupPointsAfterNodeCreateFailure() noexcept
+{
+    m_staging.cleanupPointsAfterNodeCreateFailure();
+}
@@ -0,0 +1,80 @@
+#ifndef Fxt_Point_OverlayDatabase_h_
+#define Fxt_Point_OverlayDatabase_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "Fxt/Point/DatabaseApi.h"
+
+///
+namespace Fxt {
+///
+namespace Point {
+
+
+/** This concrete class layers a 'staging' Point Database on top of a 'base'
+    Point Database.  It is used when creating a replacement Scanner/ExecutionSet
+    for a running Node (i.e. hot-swap).
+
+    - New Points are ALWAYS added to the staging database.  A Point can be
+      added even if the base database already contains a Point with the same
+      ID (i.e. the new Point 'shadows' the existing Point).
+    - Look-ups search the staging database first and then the base database.
+
+    The overlay does NOT own any Points, i.e. clearPoints() and
+    cleanupPointsAfterNodeCreateFailure() only operate on the staging database.
+ */
+class OverlayDatabase : public DatabaseApi
+{
+public:
+    /// Constructor
+    OverlayDatabase( DatabaseApi& stagingDb, DatabaseApi& baseDb ) noexcept;
+
+public:
+    /// See Fxt::Point::DatabaseApi
+    Fxt::Point::Api* lookupById( uint32_t pointIdToFind ) const noexcept;
+
+    /// See Fxt::Point::DatabaseApi.  Returns the size of the staging database
+    size_t getMaxNumPoints() const noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    bool toJSON( uint32_t         pointId,
+                 char*            dst,
+                 size_t           dstSize,
+                 bool&            truncated,
+                 bool             verbose = true,
+                 bool             pretty  = true ) noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    bool fromJSON( const char* src, Cpl::Text::String* errorMsg=0 ) noexcept;
+
+    /// See Fxt::Point::DatabaseApi.  Only the staging database is checked for duplicate IDs
+    bool add( Api& pointInstanceToAdd ) noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    void clearPoints() noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    void cleanupPointsAfterNodeCreateFailure() noexcept;
+
+protected:
+    /// Database that contains the new Points
+    DatabaseApi&    m_staging;
+
+    /// Database that contains the existing Points
+    DatabaseApi&    m_base;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,70 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+
+#include "OwnershipDatabase.h"
+
+///
+using namespace Fxt::Point;
+
+//////////////////////////////////////////////////
+OwnershipDatabase::OwnershipDatabase( DatabaseApi& baseDb, uint8_t* ownedBitmap ) noexcept
+    : m_base( baseDb )
+    , m_owned( ownedBitmap )
+{
+}
+
+//////////////////////////////////////////////////
+Fxt::Point::Api* OwnershipDatabase::lookupById( uint32_t pointIdToFind ) const noexcept
+{
+    return m_base.lookupById( pointIdToFind );
+}
+
+size_t OwnershipDatabase::getMaxNumPoints() const noexcept
+{
+    return m_base.getMaxNumPoints();
+}
+
+bool OwnershipDatabase::toJSON( uint32_t         pointId,
+                                char*            dst,
+                                size_t           dstSize,
+                                bool&            truncated,
+                                bool             verbose,
+                                bool             pretty ) noexcept
+{
+    return m_base.toJSON( pointId, dst, dstSize, truncated, verbose, pretty );
+}
+
+bool OwnershipDatabase::fromJSON( const char* src, Cpl::Text::String* errorMsg ) noexcept
+{
+    return m_base.fromJSON( src, errorMsg );
+}
+
+bool OwnershipDatabase::add( Api& pointInstanceToAdd ) noexcept
+{
+    if ( !m_base.add( pointInstanceToAdd ) )
+    {
+        return false;
+    }
+    setOwned( m_owned, pointInstanceToAdd.getId() );
+    return true;
+}
+
+void OwnershipDatabase::clearPoints() noexcept
+{
+    m_base.clearPoints();
+}
+
+void OwnershipDatabase::cleanupPointsAfterNodeCreateFailure() noexcept
+{
+    m_base.cleanupPointsAfterNodeCreateFailure();
+}
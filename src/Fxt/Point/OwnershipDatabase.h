@@ -0,0 +1,89 @@
+#ifndef Fxt_Point_OwnershipDatabase_h_
+#define Fxt_Point_OwnershipDatabase_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Fxt/Point/DatabaseApi.h"
+#include <stdint.h>
+
+///
+namespace Fxt {
+///
+namespace Point {
+
+
+/** This concrete class decorates a Point Database and records the IDs of
+    all Points that are added through it, i.e. it tracks which Points are
+    'owned' by a single Chassis.  The recorded IDs are stored in a bitmap
+    that is supplied by the application (see bitmapSize()), and the bitmap
+    out-lives the decorator instance.
+
+    All other operations are passed through to the base database.
+ */
+class OwnershipDatabase : public DatabaseApi
+{
+public:
+    /** Constructor.  The 'ownedBitmap' MUST be at least
+        bitmapSize( baseDb.getMaxNumPoints() ) bytes and be zeroed by the
+        application.
+     */
+    OwnershipDatabase( DatabaseApi& baseDb, uint8_t* ownedBitmap ) noexcept;
+
+public:
+    /// Returns the size, in bytes, of the bitmap needed to track 'maxNumPoints' Points
+    static size_t bitmapSize( size_t maxNumPoints ) noexcept { return (maxNumPoints + 7) / 8; }
+
+    /// Returns true if the bit for 'pointId' is set in 'ownedBitmap'
+    static bool isOwned( const uint8_t* ownedBitmap, uint32_t pointId ) noexcept { return (ownedBitmap[pointId / 8] & (1 << (pointId % 8))) != 0; }
+
+    /// Sets the bit for 'pointId' in 'ownedBitmap'
+    static void setOwned( uint8_t* ownedBitmap, uint32_t pointId ) noexcept { ownedBitmap[pointId / 8] |= (uint8_t) (1 << (pointId % 8)); }
+
+public:
+    /// See Fxt::Point::DatabaseApi
+    Fxt::Point::Api* lookupById( uint32_t pointIdToFind ) const noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    size_t getMaxNumPoints() const noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    bool toJSON( uint32_t         pointId,
+                 char*            dst,
+                 size_t           dstSize,
+                 bool&            truncated,
+                 bool             verbose = true,
+                 bool             pretty  = true ) noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    bool fromJSON( const char* src, Cpl::Text::String* errorMsg=0 ) noexcept;
+
+    /// See Fxt::Point::DatabaseApi.  A successfully added Point is recorded as owned
+    bool add( Api& pointInstanceToAdd ) noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    void clearPoints() noexcept;
+
+    /// See Fxt::Point::DatabaseApi
+    void cleanupPointsAfterNodeCreateFailure() noexcept;
+
+protected:
+    /// Database that contains the Points
+    DatabaseApi&    m_base;
+
+    /// Bitmap of owned Point IDs
+    uint8_t*        m_owned;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -30,7 +30,9 @@ PointCommon_::PointCommon_( DatabaseApi&                        db,
     : m_id( pointId )
     , m_state( allocatorForPointStatefulData.allocate( stateSize ) )
     , m_stateSize( allocatorForPointStatefulData.allocatedSizeForNBytes( stateSize ) )
+    , m_dataSize( stateSize )
     , m_setter( setterPoint )
+    , m_alias( false )
 {
     if ( m_state )
     {
@@ -65,6 +67,11 @@ size_t PointCommon_::getStatefulMemorySize() const noexcept
     return m_stateSize;
 }
 
+size_t PointCommon_::getStatefulDataSize() const noexcept
+{
+    return m_dataSize;
+}
+
 uint32_t PointCommon_::getId() const noexcept
 {
     return m_id;
@@ -108,6 +115,31 @@ bool PointCommon_::hasSetter() const noexcept
     return m_setter != nullptr;
 }
 
+bool PointCommon_::isAlias() const noexcept
+{
+    return m_alias;
+}
+
+bool PointCommon_::aliasTo_( Api& producerPoint ) noexcept
+{
+    // Point MUST be the same type AND have the same amount of stateful data.  Note: The allocated sizes can differ, e.g. cache line padded Shared Points
+    void* producerState = producerPoint.getStartOfStatefulMemory_();
+    if ( m_state == nullptr || producerState == nullptr || producerState == m_state ||
+         !isSameType( producerPoint ) || producerPoint.getStatefulDataSize() != m_dataSize )
+    {
+        m_state  = nullptr;
+        m_setter = nullptr;
+        CPL_SYSTEM_TRACE_MSG( FXT_POINT_TRACE_SECT_, ("Failed to alias pointID: %lu to producer pointID: %lu", m_id, producerPoint.getId()) );
+        return false;
+    }
+
+    // Share the producer's stateful data (an alias can NOT have a setter)
+    m_state  = producerState;
+    m_setter = nullptr;
+    m_alias  = true;
+    return true;
+}
+
 bool PointCommon_::readData( void* dstData, size_t dstSize ) const noexcept
 {
     // Return invalid if memory allocation failed
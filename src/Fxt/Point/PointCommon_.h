@@ -53,6 +53,9 @@ public:
     /// See Fxt::Point::Api.  
     size_t getStatefulMemorySize() const noexcept;
 
+    /// See Fxt::Point::Api.
+    size_t getStatefulDataSize() const noexcept;
+
     /// See Fxt::Point::Api
     void setInvalid( LockRequest_T lockRequest = eNO_REQUEST ) noexcept;
 
@@ -69,6 +72,9 @@ public:
     /// See Fxt::Point::Api
     bool hasSetter() const noexcept;
 
+    /// See Fxt::Point::Api
+    bool isAlias() const noexcept;
+
 public:
     /// See Fxt::Point::Api
     void* getStartOfStatefulMemory_() const noexcept;
@@ -79,6 +85,9 @@ public:
                       bool                           srcNotValid,
                       Fxt::Point::Api::LockRequest_T lockRequest = Fxt::Point::Api::eNO_REQUEST ) noexcept;
 
+    /// See Fxt::Point::Api
+    bool aliasTo_( Api& producerPoint ) noexcept;
+
 protected:
     /// See Fxt::Point::Api
     bool readData( void* dstData, size_t dstSize ) const noexcept;
@@ -119,9 +128,15 @@ protected:
     /// Number of bytes in of the data pointed to by m_state
     size_t      m_stateSize;
 
+    /// Number of bytes of stateful data requested by the point (i.e. not rounded up by the allocator)
+    size_t      m_dataSize;
+
     /// Optional reference to the Point's internal setter (aka another Point instance)
     Api*        m_setter;
 
+    /// Set to true when the point is an alias, i.e. m_state is owned by another point
+    bool        m_alias;
+
     
 };
 
@@ -0,0 +1,120 @@
+#ifndef Fxt_System_AllocTag_h_
+#define Fxt_System_AllocTag_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/System/Tls.h"
+#include "Cpl/System/GlobalLock.h"
+#include "Cpl/System/FatalError.h"
+#include <stdint.h>
+#include <new>
+#include <atomic>
+
+///
+namespace Fxt {
+///
+namespace System {
+
+
+/** This static class is used to 'tag' memory allocations by the Foxtail
+    sub-system that requested the memory.  The factories set the current tag
+    - using a ScopeBlock - while they construct an object, and an allocator
+    that does accounting (e.g. Fxt::Node::AccountingHeap) charges each
+    allocation to the current tag.  Tags nest, i.e. the Points created by a
+    Card are charged to ePOINTS, not to eCARDS.
+
+    NOTE: The current tag is per thread (stored in a Cpl::System::Tls
+          variable), i.e. concurrent factories (e.g. the parallel Chassis
+          builders) do not see - or restore - each other's tags.  However, an
+          accounting allocator that is shared by multiple threads is only
+          exact when the Node is constructed by a single thread.
+
+    NOTE: The TLS variable is created on first use, i.e. tags can NOT be
+          used before Cpl::System::Api::initialize() has been called.
+ */
+class AllocTag
+{
+public:
+    /// Allocation tags
+    enum Tag_T
+    {
+        eNODE = 0,      //!< Node, Chassis, Scanner, and Execution Set infrastructure (the default tag)
+        ePOINTS,        //!< Points (including the Points owned by Cards and Logic Chains)
+        eCARDS,         //!< IO Cards
+        eCOMPONENTS,    //!< Logic Chain Components
+        eLOGIC_CHAINS,  //!< Logic Chains
+        eNUM_TAGS       //!< Number of tags (not a valid tag)
+    };
+
+public:
+    /// Returns the current tag
+    static Tag_T getCurrent() noexcept { return (Tag_T) (uintptr_t) tls_().get(); }
+
+    /// Returns a text label for the specified tag
+    static const char* toString( Tag_T tag ) noexcept
+    {
+        static const char* labels[eNUM_TAGS] ={ "node", "points", "cards", "components", "chains" };
+        return tag < eNUM_TAGS ? labels[tag] : "?";
+    }
+
+public:
+    /** Sets the current tag for the life of the instance.  The previous tag
+        is restored when the instance goes out of scope.
+     */
+    class ScopeBlock
+    {
+    public:
+        /// Constructor
+        inline ScopeBlock( Tag_T tag ) noexcept :m_prev( getCurrent() ) { setCurrent_( tag ); }
+
+        /// Destructor
+        inline ~ScopeBlock() { setCurrent_( m_prev ); }
+
+    protected:
+        /// Tag to restore
+        Tag_T m_prev;
+    };
+
+protected:
+    /// Helper method: sets the current tag for the calling thread
+    static void setCurrent_( Tag_T tag ) noexcept { tls_().set( (void*) (uintptr_t) tag ); }
+
+    /** Storage for the current tag (one value per thread).  The initial
+        (per thread) TLS value of zero is eNODE.
+     */
+    static Cpl::System::Tls& tls_() noexcept
+    {
+        static std::atomic<Cpl::System::Tls*> tlsPtr;
+        Cpl::System::Tls* tls = tlsPtr.load( std::memory_order_acquire );
+        if ( tls == nullptr )
+        {
+            Cpl::System::GlobalLock::begin();
+            tls = tlsPtr.load( std::memory_order_relaxed );
+            if ( tls == nullptr )
+            {
+                tls = new(std::nothrow) Cpl::System::Tls();
+                tlsPtr.store( tls, std::memory_order_release );
+            }
+            Cpl::System::GlobalLock::end();
+            if ( tls == nullptr )
+            {
+                Cpl::System::FatalError::logRaw( "Fxt::System::AllocTag. Failed to allocate the TLS variable" );
+            }
+        }
+        return *tls;
+    }
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,99 @@
+#ifndef Fxt_System_CacheAlignedAllocator_h_
+#define Fxt_System_CacheAlignedAllocator_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "colony_config.h"
+#include "Cpl/Memory/ContiguousAllocator.h"
+#include <stdint.h>
+
+
+/// Size, in bytes, of a CPU data cache line.  MUST be a power of 2 and a multiple of sizeof(size_t)
+#ifndef OPTION_FXT_SYSTEM_CACHE_LINE_SIZE
+#define OPTION_FXT_SYSTEM_CACHE_LINE_SIZE       64
+#endif
+
+/// Size, in bytes, of a virtual memory page.  MUST be a power of 2 and a multiple of OPTION_FXT_SYSTEM_CACHE_LINE_SIZE
+#ifndef OPTION_FXT_SYSTEM_PAGE_SIZE
+#define OPTION_FXT_SYSTEM_PAGE_SIZE             4096
+#endif
+
+
+///
+namespace Fxt {
+///
+namespace System {
+
+
+/** This concrete class is a wrapper for a Contiguous Allocator that
+    guarantees that each allocated block starts on a cache line boundary and
+    occupies whole cache lines, i.e. no two allocations (and no allocations
+    made directly from the wrapped allocator) share a cache line.  The intended
+    use is for data that is written by multiple threads/cores (e.g. Shared
+    Points) to prevent false sharing.
+
+    The alignment is done by over-allocating each request by (cache-line-size
+    - word-size) bytes.  The over-allocation is independent of the wrapped
+    allocator's current address, i.e. the amount of memory consumed for a
+    given sequence of requests is deterministic.
+
+    NOTES:
+        - The wrapper is a transient object, i.e. the allocated memory is owned
+          by the wrapped allocator.
+        - The reset() method does nothing.
+ */
+class CacheAlignedAllocator : public Cpl::Memory::ContiguousAllocator
+{
+public:
+    /// Constructor
+    CacheAlignedAllocator( Cpl::Memory::ContiguousAllocator& wrappedAllocator ) noexcept
+        : m_wrapped( wrappedAllocator )
+    {
+    }
+
+public:
+    /// See Cpl::Memory::Allocator
+    void* allocate( size_t numbytes )
+    {
+        uint8_t* mem = (uint8_t*) m_wrapped.allocate( roundUp( numbytes, OPTION_FXT_SYSTEM_CACHE_LINE_SIZE ) + OPTION_FXT_SYSTEM_CACHE_LINE_SIZE - m_wrapped.wordSize() );
+        if ( mem == nullptr )
+        {
+            return nullptr;
+        }
+        return mem + (roundUp( (size_t) mem, OPTION_FXT_SYSTEM_CACHE_LINE_SIZE ) - (size_t) mem);
+    }
+
+    /// See Cpl::Memory::Allocator
+    size_t wordSize() const noexcept { return OPTION_FXT_SYSTEM_CACHE_LINE_SIZE; }
+
+    /// See Cpl::Memory::ContiguousAllocator.  Does nothing
+    void reset() noexcept {}
+
+    /// See Cpl::Memory::ContiguousAllocator.  Returns the wrapped allocator's information
+    uint8_t* getMemoryStart( size_t& dstAllocatedLenInBytes ) noexcept { return m_wrapped.getMemoryStart( dstAllocatedLenInBytes ); }
+
+public:
+    /// Helper method that rounds 'n' up to a multiple of 'alignment' (which MUST be a power of 2)
+    static size_t roundUp( size_t n, size_t alignment ) noexcept
+    {
+        return (n + alignment - 1) & ~(alignment - 1);
+    }
+
+protected:
+    /// The wrapped allocator
+    Cpl::Memory::ContiguousAllocator& m_wrapped;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
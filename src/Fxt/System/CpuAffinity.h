@@ -0,0 +1,47 @@
+#ifndef Fxt_System_CpuAffinity_h_
+#define Fxt_System_CpuAffinity_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "Cpl/System/Thread.h"
+
+
+/// 
+namespace Fxt {
+/// 
+namespace System {
+
+/** This class defines the interface for pinning a thread to a specific CPU
+    core.  Support for CPU affinity is platform specific, i.e. on platforms
+    that do not support it - the methods are no-ops that return false.
+ */
+class CpuAffinity
+{
+public:
+    /** This method pins the specified thread to the CPU core with the index
+        of 'coreIndex' (zero based).  Returns true if successful; else false
+        is returned (e.g. invalid core index or the platform does not support
+        CPU affinity).
+     */
+    static bool setThreadAffinity( Cpl::System::Thread& thread, unsigned coreIndex ) noexcept;
+
+    /** This method returns the number of CPU cores available to the 
+        application.  Returns zero if the platform does not support CPU 
+        affinity.
+     */
+    static unsigned getNumCores() noexcept;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
@@ -0,0 +1,86 @@
+#ifndef Fxt_System_LockedMemory_h_
+#define Fxt_System_LockedMemory_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include "colony_config.h"
+#include <stdlib.h>
+
+
+/// Size, in bytes, of a 'huge' virtual memory page
+#ifndef OPTION_FXT_SYSTEM_HUGE_PAGE_SIZE
+#define OPTION_FXT_SYSTEM_HUGE_PAGE_SIZE        (2*1024*1024)
+#endif
+
+
+///
+namespace Fxt {
+///
+namespace System {
+
+/** This class provides a block of memory that is pre-faulted and locked
+    into physical memory (i.e. it is never paged out), and that is optionally
+    backed by 'huge' pages.  The intended use is for memory that is accessed
+    by time critical threads, e.g. to eliminate page faults and TLB misses
+    from a control loop.  Support for locked memory is platform specific, i.e.
+    on platforms that do not support it - create() always fails.
+
+    Note: The class is NOT thread-safe.
+ */
+class LockedMemory
+{
+public:
+    /// Constructor.  The instance is in the closed state
+    LockedMemory() noexcept;
+
+    /// Destructor.  Ensures the memory is released
+    ~LockedMemory() noexcept;
+
+public:
+    /** This method allocates - at least - 'sizeInBytes' of memory, pre-faults
+        it, and locks it into physical memory.  The content of the memory is
+        zero filled.  When 'useHugePages' is true, the memory is backed by
+        huge pages if possible (i.e. a failure to use huge pages is NOT an
+        error).  Returns true if successful; else false is returned (e.g. the
+        memory could not be locked because of OS limits).  If the instance is
+        already opened, the current memory is released first.
+     */
+    bool create( size_t sizeInBytes, bool useHugePages ) noexcept;
+
+    /// This method releases the memory. It is okay to call close() when not opened
+    void close() noexcept;
+
+public:
+    /// Returns a pointer to the start of the memory.  Returns nullptr when not opened
+    inline void* getData() const noexcept { return m_data; }
+
+    /// Returns the size, in bytes, of the memory. Returns zero when not opened
+    inline size_t getSize() const noexcept { return m_size; }
+
+    /// Returns true if the memory is backed by huge pages
+    inline bool isHugePages() const noexcept { return m_hugePages; }
+
+protected:
+    /// Start of the memory
+    void*       m_data;
+
+    /// Size of the memory (can be larger than the requested size)
+    size_t      m_size;
+
+    /// Huge page backing
+    bool        m_hugePages;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
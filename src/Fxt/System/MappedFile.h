@@ -0,0 +1,70 @@
+#ifndef Fxt_System_MappedFile_h_
+#define Fxt_System_MappedFile_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include <stdlib.h>
+
+
+/// 
+namespace Fxt {
+/// 
+namespace System {
+
+/** This class provides read-only, memory-mapped access to the content of
+    a file, i.e. the file's content is accessed directly from the OS's page
+    cache without copying it into application buffers.  Support for memory
+    mapped files is platform specific, i.e. on platforms that do not support
+    it - open() always fails.
+
+    Note: The class is NOT thread-safe.
+ */
+class MappedFile
+{
+public:
+    /// Constructor.  The instance is in the closed state
+    MappedFile() noexcept;
+
+    /// Destructor.  Ensures the file is unmapped
+    ~MappedFile() noexcept;
+
+public:
+    /** This method maps the content of the specified file into memory.
+        Returns true if successful; else false is returned (e.g. the file
+        does not exist, is empty, or the platform does not support memory
+        mapped files).  If the instance is already opened, the current
+        file is closed first.
+     */
+    bool open( const char* fileName ) noexcept;
+
+    /// This method unmaps the file. It is okay to call close() when not opened
+    void close() noexcept;
+
+public:
+    /// Returns a pointer to the start of the file's content.  Returns nullptr when not opened
+    inline const void* getData() const noexcept { return m_data; }
+
+    /// Returns the size, in bytes, of the file's content. Returns zero when not opened
+    inline size_t getSize() const noexcept { return m_size; }
+
+protected:
+    /// Start of the mapped content
+    const void* m_data;
+
+    /// Size of the mapped content
+    size_t      m_size;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
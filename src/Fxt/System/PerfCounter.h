@@ -0,0 +1,55 @@
+#ifndef Fxt_System_PerfCounter_h_
+#define Fxt_System_PerfCounter_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include <stdint.h>
+
+
+/// 
+namespace Fxt {
+/// 
+namespace System {
+
+/** This class defines the interface to a free running, high resolution counter
+    that is used for measuring (short) execution times, e.g. profiling the 
+    execution of individual Components.  The counter units are nanoseconds,
+    however the actual resolution is platform specific.  
+    
+    The counter is 32 bits and it WILL wrap-around, i.e. only the difference
+    between two (unsigned) counter values is meaningful.  This constrains the
+    maximum measurable interval to ~4.29 seconds.
+
+    The counter is NOT simulated time aware, i.e. it is ALWAYS real time.
+ */
+class PerfCounter
+{
+public:
+    /** This method returns the current counter value in nanoseconds.  The
+        method is required to be callable from any thread and to be 'cheap',
+        i.e. it is called once per Component per execution cycle when
+        profiling is enabled.
+     */
+    static uint32_t now() noexcept;
+
+public:
+    /// This method returns the delta time, in nanoseconds, between the specified 'startTime' and 'endTime'.
+    inline static uint32_t delta( uint32_t startTime, uint32_t endTime = now() ) noexcept
+    {
+        return endTime - startTime;
+    }
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
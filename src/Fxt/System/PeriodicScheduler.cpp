@@ -22,6 +22,8 @@ using namespace Fxt::System;
 PeriodicScheduler::PeriodicScheduler( ReportSlippageFunc_T slippageFunc )
     : m_periods( nullptr )
     , m_reportSlippage( slippageFunc )
+    , m_numExecuted( 0 )
+    , m_numSlippages( 0 )
     , m_firstExecution( true )
 {
 }
@@ -64,6 +66,7 @@ void PeriodicScheduler::executeScheduler( uint64_t currentTick )
                                                period,
                                                (unsigned long) period->m_duration) );
 
+                m_numExecuted++;
                 if ( period->execute( currentTick, period->m_timeMarker ) == false )
                 {
                     // The period encountered a fatal error -->STOP the scheduler
@@ -75,6 +78,7 @@ void PeriodicScheduler::executeScheduler( uint64_t currentTick )
                 if ( ElapsedTime::expired( period->m_timeMarker, period->m_duration, currentTick ) )
                 {
                     // Report the slippage to the application
+                    m_numSlippages++;
                     if ( m_reportSlippage )
                     {
                         CPL_SYSTEM_TRACE_MSG( SECT_, ("Slippage: interval=%lu, tick=%lu, period=%p, dur=%lu",
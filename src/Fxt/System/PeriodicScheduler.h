@@ -102,6 +102,19 @@ public:
      */
     virtual void stop() noexcept;
 
+public:
+    /** This method returns the total number of Period executions (across
+        start/stop cycles). The counter is only updated by the thread that
+        calls executeScheduler()
+     */
+    inline unsigned long getNumExecuted() const noexcept { return m_numExecuted; }
+
+    /** This method returns the total number of times a Period did not execute
+        'on time' (across start/stop cycles). The count is updated whether or
+        not a ReportSlippageFunc_T was provided.
+     */
+    inline unsigned long getNumSlippages() const noexcept { return m_numSlippages; }
+
 
 protected:
     /** Helper method to Round DOWN to the nearest 'period' boundary.
@@ -117,6 +130,12 @@ protected:
     /// Report slippage method
     ReportSlippageFunc_T    m_reportSlippage;
 
+    /// Number of Period executions
+    unsigned long           m_numExecuted;
+
+    /// Number of slippages
+    unsigned long           m_numSlippages;
+
     /// Flag to managing the 'first' execution
     bool                    m_firstExecution;
 };
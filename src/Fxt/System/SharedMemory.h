@@ -0,0 +1,90 @@
+#ifndef Fxt_System_SharedMemory_h_
+#define Fxt_System_SharedMemory_h_
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/** @file */
+
+#include <stdlib.h>
+
+
+/// 
+namespace Fxt {
+/// 
+namespace System {
+
+/** This class provides read/write access to a named shared memory segment
+    that can be mapped by multiple processes on the same host.  One process
+    'creates' the segment; other processes 'attach' to it.  Closing a segment
+    only unmaps it, i.e. the segment remains in the system namespace - and
+    processes that are attached to it stay attached - until it is explicitly
+    removed (see remove()).  This allows the creator to be restarted without
+    its clients having to re-attach.  Support for shared memory is platform
+    specific, i.e. on platforms that do not support it - create() and
+    attach() always fail.
+
+    Note: The class is NOT thread-safe.
+ */
+class SharedMemory
+{
+public:
+    /// Constructor.  The instance is in the closed state
+    SharedMemory() noexcept;
+
+    /// Destructor.  Ensures the segment is unmapped
+    ~SharedMemory() noexcept;
+
+public:
+    /** This method creates the named segment with the specified size and maps
+        it into memory.  If a segment with the same name AND size already
+        exists, it is reused, i.e. its content is preserved and the processes
+        that are attached to it remain attached.  Otherwise the existing
+        segment (if any) is replaced and the content of the new segment is
+        zero filled.  Returns true if successful; else false is returned.  If
+        the instance is already opened, the current segment is closed first.
+     */
+    bool create( const char* name, size_t sizeInBytes ) noexcept;
+
+    /** This method maps an existing named segment into memory.  Returns true
+        if successful; else false is returned. If the instance is already
+        opened, the current segment is closed first.
+     */
+    bool attach( const char* name ) noexcept;
+
+    /** This method unmaps the segment.  The segment is NOT removed from the
+        system namespace.  It is okay to call close() when not opened
+     */
+    void close() noexcept;
+
+    /** This method removes the named segment from the system namespace.
+        Processes that are still attached retain their mapping.  Returns true
+        if the segment was removed.
+     */
+    static bool remove( const char* name ) noexcept;
+
+public:
+    /// Returns a pointer to the start of the segment.  Returns nullptr when not opened
+    inline void* getData() const noexcept { return m_data; }
+
+    /// Returns the size, in bytes, of the segment. Returns zero when not opened
+    inline size_t getSize() const noexcept { return m_size; }
+
+protected:
+    /// Start of the mapped segment
+    void*       m_data;
+
+    /// Size of the mapped segment
+    size_t      m_size;
+};
+
+
+};      // end namespaces
+};
+#endif  // end header latch
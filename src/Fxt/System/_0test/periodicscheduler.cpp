@@ -188,6 +188,8 @@ TEST_CASE( "PeriodicScheduler" )
         REQUIRE( applePeriod.m_count == 3 );
         REQUIRE( orangePeriod.m_count == 1 );
         REQUIRE( cherryPeriod.m_count == 3 );
+        REQUIRE( uut.getNumExecuted() == 7 );
+        REQUIRE( uut.getNumSlippages() == 0 );
 
         uut.stop();
     }
@@ -290,6 +292,8 @@ TEST_CASE( "PeriodicScheduler" )
         REQUIRE( cherryPeriod.m_lastCurrentTick == currentTick );
         REQUIRE( cherryPeriod.m_lastCurrentInterval == intervalTime );
         REQUIRE( slippageCount_ == 4 );
+        REQUIRE( uut.getNumSlippages() == 4 );
+        REQUIRE( uut.getNumExecuted() == applePeriod.m_count + orangePeriod.m_count + cherryPeriod.m_count );
 
         // Verify scheduler stops when an error is encountered
         currentTick += 100 * 1000LL;
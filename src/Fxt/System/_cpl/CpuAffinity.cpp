@@ -0,0 +1,30 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+/* This file provides a platform independent implementation of the Foxtail
+   CPU affinity interface, i.e. CPU affinity is NOT supported.  A platform
+   that supports CPU affinity should exclude this file and provide its own
+   implementation (e.g. the src/Fxt/System/_posix directory)
+ */
+
+#include "Fxt/System/CpuAffinity.h"
+
+
+bool Fxt::System::CpuAffinity::setThreadAffinity( Cpl::System::Thread& thread, unsigned coreIndex ) noexcept
+{
+    return false;
+}
+
+unsigned Fxt::System::CpuAffinity::getNumCores() noexcept
+{
+    return 0;
+}
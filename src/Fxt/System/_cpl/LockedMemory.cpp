@@ -0,0 +1,40 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+/* This file provides a platform independent implementation of the Foxtail
+   locked memory interface, i.e. locked memory is NOT supported.  A platform
+   that supports locked memory should exclude this file and provide its own
+   implementation (e.g. the src/Fxt/System/_posix directory)
+ */
+
+#include "Fxt/System/LockedMemory.h"
+
+///
+using namespace Fxt::System;
+
+LockedMemory::LockedMemory() noexcept
+    : m_data( nullptr )
+    , m_size( 0 )
+    , m_hugePages( false )
+{
+}
+
+LockedMemory::~LockedMemory() noexcept
+{
+}
+
+bool LockedMemory::create( size_t sizeInBytes, bool useHugePages ) noexcept
+{
+    return false;
+}
+
+void LockedMemory::close() noexcept
+{
+}
@@ -0,0 +1,41 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+/* This file provides a platform independent implementation of the Foxtail
+   memory mapped file interface, i.e. memory mapped files are NOT supported.
+   A platform that supports memory mapped files should exclude this file and 
+   provide its own implementation (e.g. the src/Fxt/System/_posix directory)
+ */
+
+#include "Fxt/System/MappedFile.h"
+
+///
+using namespace Fxt::System;
+
+MappedFile::MappedFile() noexcept
+    : m_data( nullptr )
+    , m_size( 0 )
+{
+}
+
+MappedFile::~MappedFile() noexcept
+{
+}
+
+bool MappedFile::open( const char* fileName ) noexcept
+{
+    return false;
+}
+
+void MappedFile::close() noexcept
+{
+}
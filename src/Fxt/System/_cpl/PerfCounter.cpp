@@ -0,0 +1,26 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+/* This file provides a platform independent implementation of the Foxtail
+   Performance counter with ONLY millisecond resolution (i.e. it calls into the
+   CPL Elapsed time interface).  A platform that needs a useful resolution
+   should exclude this file and provide its own implementation (e.g. the
+   src/Fxt/System/_posix, _rp2040, or _cpp11 directories)
+ */
+
+#include "Fxt/System/PerfCounter.h"
+#include "Cpl/System/ElapsedTime.h"
+
+
+uint32_t Fxt::System::PerfCounter::now() noexcept
+{
+    return (uint32_t) (Cpl::System::ElapsedTime::millisecondsInRealTime() * 1000000UL);
+}
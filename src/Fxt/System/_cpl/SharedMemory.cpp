@@ -0,0 +1,51 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+/* This file provides a platform independent implementation of the Foxtail
+   shared memory interface, i.e. shared memory is NOT supported.  A platform
+   that supports shared memory should exclude this file and provide its own
+   implementation (e.g. the src/Fxt/System/_posix directory)
+ */
+
+#include "Fxt/System/SharedMemory.h"
+
+///
+using namespace Fxt::System;
+
+SharedMemory::SharedMemory() noexcept
+    : m_data( nullptr )
+    , m_size( 0 )
+{
+}
+
+SharedMemory::~SharedMemory() noexcept
+{
+}
+
+bool SharedMemory::create( const char* name, size_t sizeInBytes ) noexcept
+{
+    return false;
+}
+
+bool SharedMemory::attach( const char* name ) noexcept
+{
+    return false;
+}
+
+void SharedMemory::close() noexcept
+{
+}
+
+bool SharedMemory::remove( const char* name ) noexcept
+{
+    return false;
+}
@@ -0,0 +1,25 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+/* This file provides a C++11 implementation of the Foxtail Performance counter
+   using the standard library's steady clock (e.g. for Windows builds).  Note:
+   When using this implementation the src/Fxt/System/_cpl/PerfCounter.cpp file
+   must be excluded from the build, e.g. 'src/Fxt/System/_cpl > PerfCounter.cpp'
+ */
+
+#include "Fxt/System/PerfCounter.h"
+#include <chrono>
+
+
+uint32_t Fxt::System::PerfCounter::now() noexcept
+{
+    return (uint32_t) std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
@@ -0,0 +1,45 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+/* This file provides a POSIX (Linux) implementation of the Foxtail CPU 
+   affinity interface.  Note: When using this implementation the 
+   src/Fxt/System/_cpl/CpuAffinity.cpp file must be excluded from the build,
+   e.g. 'src/Fxt/System/_cpl > CpuAffinity.cpp'
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "Fxt/System/CpuAffinity.h"
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+
+bool Fxt::System::CpuAffinity::setThreadAffinity( Cpl::System::Thread& thread, unsigned coreIndex ) noexcept
+{
+    if ( coreIndex >= getNumCores() || coreIndex >= CPU_SETSIZE )
+    {
+        return false;
+    }
+
+    cpu_set_t cpuset;
+    CPU_ZERO( &cpuset );
+    CPU_SET( coreIndex, &cpuset );
+    return pthread_setaffinity_np( thread.getNativeHandle(), sizeof( cpuset ), &cpuset ) == 0;
+}
+
+unsigned Fxt::System::CpuAffinity::getNumCores() noexcept
+{
+    long numCores = sysconf( _SC_NPROCESSORS_ONLN );
+    return numCores > 0 ? (unsigned) numCores : 0;
+}
@@ -0,0 +1,105 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+/* This file provides a POSIX (Linux) implementation of the Foxtail locked
+   memory interface.  Note: When using this implementation the
+   src/Fxt/System/_cpl/LockedMemory.cpp file must be excluded from the build,
+   e.g. 'src/Fxt/System/_cpl > LockedMemory.cpp'
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "Fxt/System/LockedMemory.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define ROUND_UP(n,a)   ((((n) + (a) - 1) / (a)) * (a))
+
+///
+using namespace Fxt::System;
+
+LockedMemory::LockedMemory() noexcept
+    : m_data( nullptr )
+    , m_size( 0 )
+    , m_hugePages( false )
+{
+}
+
+LockedMemory::~LockedMemory() noexcept
+{
+    close();
+}
+
+bool LockedMemory::create( size_t sizeInBytes, bool useHugePages ) noexcept
+{
+    close();
+    if ( sizeInBytes == 0 )
+    {
+        return false;
+    }
+
+    // Explicit huge pages (requires pages to be reserved, e.g. /proc/sys/vm/nr_hugepages)
+    void*  data = MAP_FAILED;
+    size_t size = ROUND_UP( sizeInBytes, (size_t) sysconf( _SC_PAGESIZE ) );
+#ifdef MAP_HUGETLB
+    if ( useHugePages )
+    {
+        size_t hugeSize = ROUND_UP( sizeInBytes, (size_t) OPTION_FXT_SYSTEM_HUGE_PAGE_SIZE );
+        data = mmap( nullptr, hugeSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE, -1, 0 );
+        if ( data != MAP_FAILED )
+        {
+            size        = hugeSize;
+            m_hugePages = true;
+        }
+    }
+#endif
+
+    // Normal pages (with a transparent huge page hint)
+    if ( data == MAP_FAILED )
+    {
+        data = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if ( data == MAP_FAILED )
+        {
+            return false;
+        }
+#ifdef MADV_HUGEPAGE
+        if ( useHugePages )
+        {
+            madvise( data, size, MADV_HUGEPAGE );   // Best effort, i.e. ignore errors
+        }
+#endif
+    }
+
+    // Pre-fault (the memory is zero filled by the OS) and lock the pages into physical memory
+    if ( mlock( data, size ) != 0 )
+    {
+        munmap( data, size );
+        m_hugePages = false;
+        return false;
+    }
+
+    m_data = data;
+    m_size = size;
+    return true;
+}
+
+void LockedMemory::close() noexcept
+{
+    if ( m_data )
+    {
+        munlock( m_data, m_size );
+        munmap( m_data, m_size );
+        m_data      = nullptr;
+        m_size      = 0;
+        m_hugePages = false;
+    }
+}
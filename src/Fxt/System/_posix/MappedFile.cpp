@@ -0,0 +1,80 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+/* This file provides a POSIX implementation of the Foxtail memory mapped
+   file interface.  Note: When using this implementation the 
+   src/Fxt/System/_cpl/MappedFile.cpp file must be excluded from the build,
+   e.g. 'src/Fxt/System/_cpl > MappedFile.cpp'
+ */
+
+#include "Fxt/System/MappedFile.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+///
+using namespace Fxt::System;
+
+MappedFile::MappedFile() noexcept
+    : m_data( nullptr )
+    , m_size( 0 )
+{
+}
+
+MappedFile::~MappedFile() noexcept
+{
+    close();
+}
+
+bool MappedFile::open( const char* fileName ) noexcept
+{
+    close();
+
+    int fd = ::open( fileName, O_RDONLY );
+    if ( fd < 0 )
+    {
+        return false;
+    }
+
+    struct stat info;
+    if ( fstat( fd, &info ) != 0 || info.st_size <= 0 )
+    {
+        ::close( fd );
+        return false;
+    }
+
+    // Note: The mapping remains valid after the file descriptor is closed
+    void* data = mmap( nullptr, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    ::close( fd );
+    if ( data == MAP_FAILED )
+    {
+        return false;
+    }
+
+    // Hint to the OS that the content will be read sequentially
+    madvise( data, (size_t) info.st_size, MADV_SEQUENTIAL );
+
+    m_data = data;
+    m_size = (size_t) info.st_size;
+    return true;
+}
+
+void MappedFile::close() noexcept
+{
+    if ( m_data )
+    {
+        munmap( (void*) m_data, m_size );
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
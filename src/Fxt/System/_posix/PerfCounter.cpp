@@ -0,0 +1,27 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+/* This file provides a POSIX implementation of the Foxtail Performance counter
+   using the monotonic clock.  Note: When using this implementation the 
+   src/Fxt/System/_cpl/PerfCounter.cpp file must be excluded from the build,
+   e.g. 'src/Fxt/System/_cpl > PerfCounter.cpp'
+ */
+
+#include "Fxt/System/PerfCounter.h"
+#include <time.h>
+
+
+uint32_t Fxt::System::PerfCounter::now() noexcept
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (uint32_t) (((uint64_t) ts.tv_sec) * 1000000000ULL + ts.tv_nsec);
+}
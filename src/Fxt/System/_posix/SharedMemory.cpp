@@ -0,0 +1,131 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+
+/* This file provides a POSIX implementation of the Foxtail shared memory 
+   interface.  Note: When using this implementation the 
+   src/Fxt/System/_cpl/SharedMemory.cpp file must be excluded from the build,
+   e.g. 'src/Fxt/System/_cpl > SharedMemory.cpp'
+ */
+
+#include "Fxt/System/SharedMemory.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+///
+using namespace Fxt::System;
+
+SharedMemory::SharedMemory() noexcept
+    : m_data( nullptr )
+    , m_size( 0 )
+{
+}
+
+SharedMemory::~SharedMemory() noexcept
+{
+    close();
+}
+
+bool SharedMemory::create( const char* name, size_t sizeInBytes ) noexcept
+{
+    close();
+    if ( sizeInBytes == 0 )
+    {
+        return false;
+    }
+
+    // Reuse an existing segment of the same size (i.e. attached processes stay attached)
+    int fd = shm_open( name, O_RDWR, 0 );
+    if ( fd >= 0 )
+    {
+        struct stat info;
+        if ( fstat( fd, &info ) != 0 || (size_t) info.st_size != sizeInBytes )
+        {
+            ::close( fd );
+            fd = -1;
+        }
+    }
+
+    // Start with a new (i.e. zero filled) segment
+    if ( fd < 0 )
+    {
+        shm_unlink( name );
+        fd = shm_open( name, O_CREAT | O_EXCL | O_RDWR, 0660 );
+        if ( fd < 0 )
+        {
+            return false;
+        }
+        if ( ftruncate( fd, (off_t) sizeInBytes ) != 0 )
+        {
+            ::close( fd );
+            shm_unlink( name );
+            return false;
+        }
+    }
+
+    // Note: The mapping remains valid after the file descriptor is closed
+    void* data = mmap( nullptr, sizeInBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    ::close( fd );
+    if ( data == MAP_FAILED )
+    {
+        return false;
+    }
+
+    m_data = data;
+    m_size = sizeInBytes;
+    return true;
+}
+
+bool SharedMemory::attach( const char* name ) noexcept
+{
+    close();
+
+    int fd = shm_open( name, O_RDWR, 0 );
+    if ( fd < 0 )
+    {
+        return false;
+    }
+
+    struct stat info;
+    if ( fstat( fd, &info ) != 0 || info.st_size <= 0 )
+    {
+        ::close( fd );
+        return false;
+    }
+
+    void* data = mmap( nullptr, (size_t) info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    ::close( fd );
+    if ( data == MAP_FAILED )
+    {
+        return false;
+    }
+
+    m_data = data;
+    m_size = (size_t) info.st_size;
+    return true;
+}
+
+void SharedMemory::close() noexcept
+{
+    if ( m_data )
+    {
+        munmap( m_data, m_size );
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+
+bool SharedMemory::remove( const char* name ) noexcept
+{
+    return shm_unlink( name ) == 0;
+}
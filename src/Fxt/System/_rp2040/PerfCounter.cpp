@@ -0,0 +1,26 @@
+/*-----------------------------------------------------------------------------
+* This file is part of the Colony.Core Project.  The Colony.Core Project is an
+* open source project with a BSD type of licensing agreement.  See the license
+* agreement (license.txt) in the top/ directory or on the Internet at
+* http://integerfox.com/colony.core/license.txt
+*
+* Copyright (c) 2014-2022  John T. Taylor
+*
+* Redistributions of the source code must retain the above copyright notice.
+*----------------------------------------------------------------------------*/
+
+/* This file provides a RP2040 implementation of the Foxtail Performance counter
+   using the SDK's free running microsecond timer (i.e. the resolution is 1us).
+   Note: When using this implementation the src/Fxt/System/_cpl/PerfCounter.cpp
+   file must be excluded from the build, e.g. 'src/Fxt/System/_cpl > PerfCounter.cpp'
+ */
+
+#include "Fxt/System/PerfCounter.h"
+#include "hardware/timer.h"
+
+
+uint32_t Fxt::System::PerfCounter::now() noexcept
+{
+    // Note: The multiplication wraps 'cleanly', i.e. the difference between two counter values is correct
+    return time_us_32() * 1000U;
+}
@@ -0,0 +1,7 @@
+# Test App
+src/Driver/I2C/_0test < transactionqueue.cpp
+
+# Unit under test
+src/Driver/I2C
+src/Driver/I2C/Simulated
+src/Driver/RHTemp/HUT31D < AsyncApi.cpp
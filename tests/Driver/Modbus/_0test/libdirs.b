@@ -0,0 +1,9 @@
+# Test App
+src/Driver/Modbus/_0test
+
+# Unit under test
+src/Driver/Modbus
+src/Driver/Modbus/Tcp
+
+# support
+src/Cpl/Io/Socket
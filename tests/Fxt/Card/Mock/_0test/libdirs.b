@@ -3,6 +3,7 @@ src/Fxt/Card/Mock
 
 # tests
 src/Fxt/Card/Mock/_0test  
+src/Fxt/System/_cpl < ElapsedTime.cpp
 
 src/Cpl/Logging/_mock4test
 src/Fxt/Logging < Api.cpp
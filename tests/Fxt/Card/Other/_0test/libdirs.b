@@ -0,0 +1,18 @@
+# Unit under test
+src/Fxt/Card/Other
+
+# tests
+src/Fxt/Card/Other/_0test  
+src/Fxt/System/_posix < MappedFile.cpp SharedMemory.cpp
+
+src/Cpl/Logging/_mock4test
+src/Fxt/Logging < Api.cpp
+
+src/Fxt/Card
+src/Fxt/Point
+src/Fxt/Type
+src/Fxt/Type/_categories
+src/Cpl/Io/Stdio/_posix
+src/Cpl/Io/File
+src/Cpl/Io/File/_posix
+src/Cpl/Io/File/_posix/_api
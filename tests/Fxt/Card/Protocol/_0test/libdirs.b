@@ -0,0 +1,15 @@
+# Unit under test
+src/Fxt/Card/Protocol
+
+# tests
+src/Fxt/Card/Protocol/_0test  
+src/Driver/Modbus
+
+src/Cpl/Logging/_mock4test
+src/Fxt/Logging < Api.cpp
+
+src/Fxt/Card
+src/Fxt/Point
+src/Fxt/Type
+src/Fxt/Type/_categories
+src/Cpl/Io/Stdio/_posix
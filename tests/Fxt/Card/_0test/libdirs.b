@@ -4,6 +4,8 @@ src/Fxt/Card
 # tests
 src/Fxt/Card/_0test
 src/Fxt/Card/Mock < Digital8.cpp
+src/Fxt/System/_posix < CpuAffinity.cpp
+src/Fxt/System/_cpl < ElapsedTime.cpp
 
 src/Cpl/Logging/_mock4test
 src/Fxt/Logging < Api.cpp
@@ -8,7 +8,7 @@ src/Cpl/Logging/_mock4test
 src/Fxt/Logging < Api.cpp
 
 src/Fxt/System
-src/Fxt/System/_cpl
+src/Fxt/System/_cpl > PerfCounter.cpp
 src/Fxt/Type
 src/Fxt/Type/_categories
 src/Fxt/Point
@@ -17,6 +17,7 @@ src/Fxt/Card/Mock
 src/Fxt/LogicChain
 src/Fxt/Component
 src/Fxt/Component/Digital
+src/Cpl/Json
 src/Cpl/Io/Stdio/_ansi
 
 
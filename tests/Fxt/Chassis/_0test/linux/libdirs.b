@@ -4,4 +4,4 @@
 [posix|posix64] /top/libdirs/platform_posix_default_for_test_libdirs.b
 [posix|posix64] /top/libdirs/platform_posix_default_realtime_libdirs.b
 /top/libdirs/platform_posix_always_libdirs.b
-
+src/Fxt/System/_posix < PerfCounter.cpp
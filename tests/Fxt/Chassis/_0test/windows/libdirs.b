@@ -3,4 +3,4 @@
 [cpp11] /top/libdirs/platform_cpp11_default_realtime_libdirs.b
 [win32|win64] /top/libdirs/platform_win32_default_for_test_libdirs.b
 [win32|win64] /top/libdirs/platform_win32_default_realtime_libdirs.b
-
+src/Fxt/System/_cpp11
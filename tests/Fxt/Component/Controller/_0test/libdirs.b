@@ -0,0 +1,17 @@
+# Unit under test
+src/Fxt/Component/Controller > OnOff.cpp
+
+# tests
+src/Fxt/Component
+src/Fxt/Component/Controller/_0test > onoff.cpp onofffactory.cpp
+
+src/Cpl/Logging/_mock4test
+src/Fxt/Logging < Api.cpp
+
+src/Fxt/Type
+src/Fxt/Type/_categories
+src/Fxt/Card
+src/Fxt/Point
+src/Fxt/System/_cpl < ElapsedTime.cpp
+src/Cpl/Io/Stdio/_ansi
+
@@ -0,0 +1,6 @@
+# Platforms
+[cpp11] /top/libdirs/platform_cpp11_default_for_test_libdirs.b
+[cpp11] /top/libdirs/platform_cpp11_default_realtime_libdirs.b
+[win32|win64] /top/libdirs/platform_win32_default_for_test_libdirs.b
+[win32|win64] /top/libdirs/platform_win32_default_realtime_libdirs.b
+
@@ -0,0 +1,8 @@
+#ifndef COLONY_CONFIG_H_
+#define COLONY_CONFIG_H_
+
+// Enable Trace
+#define USE_CPL_SYSTEM_TRACE
+
+
+#endif
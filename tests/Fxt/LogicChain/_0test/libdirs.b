@@ -12,6 +12,9 @@ src/Fxt/Type/_categories
 src/Fxt/Point
 src/Fxt/Component
 src/Fxt/Component/Digital
+src/Fxt/Component/Basic
+src/Fxt/System
+src/Fxt/System/_cpl > PerfCounter.cpp
 src/Cpl/Io/Stdio/_ansi
 
 
@@ -0,0 +1,29 @@
+# Unit under test
+src/Fxt/Node/Ha
+src/Fxt/Node
+src/Fxt/Node/Mock/Kestrel
+
+# tests
+src/Fxt/Node/Ha/_0test
+
+src/Cpl/Logging/_mock4test
+src/Fxt/Logging < Api.cpp
+
+src/Fxt/System
+src/Fxt/System/_cpl > LockedMemory.cpp PerfCounter.cpp
+src/Fxt/System/_posix < LockedMemory.cpp PerfCounter.cpp
+src/Fxt/Type
+src/Fxt/Type/_categories
+src/Fxt/Chassis
+src/Fxt/Point
+src/Fxt/Card
+src/Fxt/Card/Mock
+src/Fxt/LogicChain
+src/Fxt/Component
+src/Fxt/Component/Digital
+src/Cpl/Json
+src/Cpl/Checksum
+src/Cpl/Io/Stdio/_ansi
+src/Cpl/Io/Socket
+
+
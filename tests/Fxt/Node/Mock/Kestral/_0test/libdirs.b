@@ -11,7 +11,7 @@ src/Fxt/Logging
 src/Fxt/Node
 src/Fxt/Node/TShell
 src/Fxt/System
-src/Fxt/System/_cpl
+src/Fxt/System/_cpl > PerfCounter.cpp
 src/Fxt/Type
 src/Fxt/Type/_categories
 src/Fxt/Chassis
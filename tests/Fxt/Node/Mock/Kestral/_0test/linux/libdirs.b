@@ -6,4 +6,4 @@ src/Cpl/Io/File/_posix
 src/Cpl/Io/File/_posix/_api
 src/Cpl/System/Posix/_realtime
 src/Cpl/Text/_mappings/_posix
-
+src/Fxt/System/_posix < PerfCounter.cpp
@@ -6,4 +6,4 @@ src/Cpl/Io/Stdio/_win32
 src/Cpl/Io/File/_win32
 src/Cpl/Io/File/_win32/_api
 src/Cpl/System/Win32/_realtime
-
+src/Fxt/System/_cpp11
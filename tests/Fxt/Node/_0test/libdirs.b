@@ -9,7 +9,8 @@ src/Cpl/Logging/_mock4test
 src/Fxt/Logging < Api.cpp
 
 src/Fxt/System
-src/Fxt/System/_cpl
+src/Fxt/System/_cpl > LockedMemory.cpp PerfCounter.cpp
+src/Fxt/System/_posix < LockedMemory.cpp PerfCounter.cpp
 src/Fxt/Type
 src/Fxt/Type/_categories
 src/Fxt/Chassis
@@ -19,6 +20,8 @@ src/Fxt/Card/Mock
 src/Fxt/LogicChain
 src/Fxt/Component
 src/Fxt/Component/Digital
+src/Cpl/Json
+src/Cpl/Checksum
 src/Cpl/Io/Stdio/_ansi
 
 